@@ -0,0 +1,251 @@
+//  bench-regress - time compiling the whole regression corpus in-process
+//
+//  Compiles every regression-tests/*.cpp2 via cpp2::compile, with warmup
+//  and repetition, and reports per-file and aggregate wall times with
+//  95% confidence intervals. Results can be saved to CSV and a later run
+//  can be gated against a saved baseline ("no regression > N%") - build
+//  this file against each cppfront version being compared and diff their
+//  CSVs, since two cppfront versions can't share one process.
+//
+//  Build:  g++ -std=c++20 -I ../include bench-regress.cpp -o cppfront-bench-regress -pthread
+//  Usage:  cppfront-bench-regress [options]
+//
+//      -corpus dir      corpus directory   (default: ../regression-tests)
+//      -reps N          timed repetitions  (default: 5)
+//      -warmup N        warmup repetitions (default: 1)
+//      -save file.csv   write results as CSV
+//      -baseline f.csv  compare against a saved run; nonzero exit on
+//                       aggregate regression beyond the threshold
+//      -threshold pct   allowed aggregate regression (default: 3)
+//      -per-file        also print every file (default: aggregate + outliers)
+//
+
+#include "../source/to_cpp1.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct file_timing {
+    std::string name;
+    double      mean_us = 0;
+    double      ci_us   = 0;    // 95% confidence half-width
+    bool        ok      = true; // note: some corpus files are deliberate error cases
+};
+
+auto now_us()
+    -> double
+{
+    using namespace std::chrono;
+    return static_cast<double>(
+        duration_cast<microseconds>( steady_clock::now().time_since_epoch() ).count()
+    );
+}
+
+auto read_file(std::filesystem::path const& p)
+    -> std::string
+{
+    auto f = std::ifstream{ p, std::ios::binary };
+    return { std::istreambuf_iterator<char>{f}, std::istreambuf_iterator<char>{} };
+}
+
+auto usage()
+    -> int
+{
+    std::cerr <<
+        "usage: cppfront-bench-regress [-corpus dir] [-reps N] [-warmup N]\n"
+        "                              [-save file.csv] [-baseline file.csv]\n"
+        "                              [-threshold pct] [-per-file]\n";
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+auto main(
+    int   argc,
+    char* argv[]
+)
+    -> int
+{
+    auto corpus    = std::string{ "../regression-tests" };
+    auto reps      = 5;
+    auto warmup    = 1;
+    auto save      = std::string{};
+    auto baseline  = std::string{};
+    auto threshold = 3.0;
+    auto per_file  = false;
+
+    for (auto i = 1; i < argc; ++i) {
+        auto arg  = std::string{ argv[i] };
+        auto next = [&]() -> char const* { return i+1 < argc ? argv[++i] : nullptr; };
+        if      (arg == "-corpus"   ) { if (auto v = next()) { corpus    = v; }       else { return usage(); } }
+        else if (arg == "-reps"     ) { if (auto v = next()) { reps      = atoi(v); } else { return usage(); } }
+        else if (arg == "-warmup"   ) { if (auto v = next()) { warmup    = atoi(v); } else { return usage(); } }
+        else if (arg == "-save"     ) { if (auto v = next()) { save      = v; }       else { return usage(); } }
+        else if (arg == "-baseline" ) { if (auto v = next()) { baseline  = v; }       else { return usage(); } }
+        else if (arg == "-threshold") { if (auto v = next()) { threshold = atof(v); } else { return usage(); } }
+        else if (arg == "-per-file" ) { per_file = true; }
+        else                          { return usage(); }
+    }
+    reps = std::max( 1, reps );
+
+    //  Gather the corpus in a stable order
+    //
+    auto files = std::vector<std::filesystem::path>{};
+    {
+        auto ec = std::error_code{};
+        for (auto const& e : std::filesystem::directory_iterator{ corpus, ec }) {
+            if (e.path().extension() == ".cpp2") {
+                files.push_back( e.path() );
+            }
+        }
+        if (files.empty()) {
+            std::cerr << "cppfront-bench-regress: error: no .cpp2 files in '" << corpus << "'\n";
+            return EXIT_FAILURE;
+        }
+        std::sort( files.begin(), files.end() );
+    }
+
+    //  Time each file: warmup runs unmeasured, then 'reps' measured runs.
+    //  Metafunctions like @print write to stdout as a side effect of
+    //  compiling - swallow that during the runs so the report stays clean
+    //
+    auto sink     = std::ostringstream{};
+    auto cout_buf = std::cout.rdbuf( sink.rdbuf() );
+
+    auto timings  = std::vector<file_timing>{};
+    auto ok_count = 0;
+    for (auto const& f : files)
+    {
+        auto source  = read_file( f );
+        auto options = cpp2::compile_options{ .filename = f.filename().string() };
+
+        auto t = file_timing{ .name = f.filename().string() };
+
+        for (auto r = 0; r < warmup; ++r) {
+            t.ok = cpp2::compile( source, options ).ok;
+        }
+
+        auto samples = std::vector<double>{};
+        for (auto r = 0; r < reps; ++r) {
+            auto start = now_us();
+            t.ok = cpp2::compile( source, options ).ok;
+            samples.push_back( now_us() - start );
+        }
+
+        for (auto s : samples) { t.mean_us += s; }
+        t.mean_us /= reps;
+        auto var = 0.0;
+        for (auto s : samples) { var += (s - t.mean_us) * (s - t.mean_us); }
+        var   = reps > 1 ? var / (reps-1) : 0.0;
+        t.ci_us = 1.96 * std::sqrt( var / reps );
+
+        ok_count += t.ok;
+        timings.push_back( t );
+    }
+
+    std::cout.rdbuf( cout_buf );
+
+    //  Report: aggregate (sum of per-file means, CI by summing variances),
+    //  plus per-file detail on request
+    //
+    auto total_us = 0.0;
+    auto total_var = 0.0;
+    for (auto const& t : timings) {
+        total_us  += t.mean_us;
+        auto sd    = t.ci_us / 1.96;
+        total_var += sd * sd;
+    }
+    auto total_ci = 1.96 * std::sqrt( total_var );
+
+    if (per_file) {
+        for (auto const& t : timings) {
+            std::cout
+                << t.name << "  "
+                << t.mean_us/1000 << " ms +/- " << t.ci_us/1000
+                << (t.ok ? "" : "  (error case)") << "\n";
+        }
+    }
+    std::cout
+        << timings.size() << " files (" << ok_count << " compile clean), "
+        << reps << " reps each\n"
+        << "aggregate: " << total_us/1000 << " ms +/- " << total_ci/1000 << " ms\n";
+
+    if (!save.empty()) {
+        auto out = std::ofstream{ save };
+        if (!out.is_open()) {
+            std::cerr << "cppfront-bench-regress: error: could not write '" << save << "'\n";
+            return EXIT_FAILURE;
+        }
+        out << "file,mean_us,ci_us\n";
+        for (auto const& t : timings) {
+            out << t.name << "," << t.mean_us << "," << t.ci_us << "\n";
+        }
+    }
+
+    //  Gate against a baseline: flag per-file changes whose confidence
+    //  intervals don't overlap, and fail on aggregate regression beyond
+    //  the threshold
+    //
+    if (!baseline.empty())
+    {
+        auto in = std::ifstream{ baseline };
+        if (!in.is_open()) {
+            std::cerr << "cppfront-bench-regress: error: could not read '" << baseline << "'\n";
+            return EXIT_FAILURE;
+        }
+        auto base = std::map<std::string, std::pair<double,double>>{};
+        for (auto line = std::string{}; std::getline(in, line); ) {
+            auto c1 = line.find(',');
+            auto c2 = line.find(',', c1+1);
+            if (
+                c1 == std::string::npos
+                || c2 == std::string::npos
+                || line.starts_with("file,")
+                )
+            {
+                continue;
+            }
+            base[line.substr(0, c1)] = {
+                atof( line.substr(c1+1, c2-c1-1).c_str() ),
+                atof( line.substr(c2+1).c_str() )
+            };
+        }
+
+        auto base_total = 0.0;
+        for (auto const& t : timings) {
+            auto b = base.find( t.name );
+            if (b == base.end()) {
+                continue;
+            }
+            base_total += b->second.first;
+            auto delta = t.mean_us - b->second.first;
+            //  Only call out differences the intervals can't explain
+            if (std::abs(delta) > t.ci_us + b->second.second) {
+                std::cout
+                    << (delta > 0 ? "slower: " : "faster: ") << t.name
+                    << "  " << b->second.first/1000 << " -> " << t.mean_us/1000 << " ms ("
+                    << (delta * 100 / b->second.first) << "%)\n";
+            }
+        }
+
+        if (base_total > 0) {
+            auto pct = (total_us - base_total) * 100 / base_total;
+            std::cout << "aggregate vs baseline: " << (pct >= 0 ? "+" : "") << pct << "%\n";
+            if (pct > threshold) {
+                std::cout << "FAIL: aggregate regression exceeds " << threshold << "% threshold\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,301 @@
+//  fuzz-lex - performance-fuzz the lexer and gate its pathological corpus
+//
+//  Mutates inputs toward maximizing lexing time per byte (lex_line and
+//  friends, driven through tokens::lex), so nonlinear slowdowns on
+//  hostile shapes - deeply nested interpolations, operator runs - are
+//  found before an editor paste finds them. Minimized cases live in
+//  lex-corpus/ with per-file time ceilings in lex-corpus/ceilings.txt,
+//  and -check enforces those ceilings as a pass/fail gate.
+//
+//  Build:  g++ -std=c++20 -I ../include fuzz-lex.cpp -o cppfront-fuzz-lex -pthread
+//  Usage:  cppfront-fuzz-lex [options]
+//
+//      -check           gate the corpus against its ceilings (no fuzzing)
+//      -corpus dir      corpus directory          (default: lex-corpus)
+//      -seconds N       fuzzing time budget       (default: 10)
+//      -seed N          fuzzing RNG seed          (default: random)
+//      -reps N          timing repetitions, min-of (default: 5)
+//      -ceiling X       default ns/byte ceiling for corpus files not
+//                       listed in ceilings.txt    (default: 400)
+//      -save file       write the minimized best case found by fuzzing
+//
+
+#include "../source/to_cpp1.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+auto now_ns()
+    -> double
+{
+    using namespace std::chrono;
+    return static_cast<double>(
+        duration_cast<nanoseconds>( steady_clock::now().time_since_epoch() ).count()
+    );
+}
+
+auto read_file(std::filesystem::path const& p)
+    -> std::string
+{
+    auto f = std::ifstream{ p, std::ios::binary };
+    return { std::istreambuf_iterator<char>{f}, std::istreambuf_iterator<char>{} };
+}
+
+//  Lex 'text' as a pure-Cpp2 source and return the best-of-reps
+//  nanoseconds per input byte - min-of is robust against scheduler
+//  noise, and the lines are rebuilt per rep because lexing can edit
+//  them in place (interpolation expansion)
+//
+auto ns_per_byte(
+    std::string const& text,
+    int                reps
+)
+    -> double
+{
+    if (text.empty()) {
+        return 0;
+    }
+    auto best = 0.0;
+    for (auto rep = 0; rep < reps; ++rep)
+    {
+        auto lines = std::vector<cpp2::source_line>{};
+        lines.emplace_back();   // dummy line 0, as the loader adds
+        for (auto pos = std::size_t{0}; pos <= text.size(); )
+        {
+            auto end = text.find('\n', pos);
+            if (end == std::string::npos) {
+                end = text.size();
+            }
+            lines.emplace_back(
+                std::string_view{text}.substr(pos, end - pos),
+                cpp2::source_line::category::cpp2
+            );
+            pos = end + 1;
+        }
+
+        auto errors = std::vector<cpp2::error_entry>{};
+        auto tokens = cpp2::tokens{ errors };
+        auto start  = now_ns();
+        tokens.lex( lines );
+        auto t = (now_ns() - start) / static_cast<double>(text.size());
+        if (
+            rep == 0
+            || t < best
+            )
+        {
+            best = t;
+        }
+    }
+    return best;
+}
+
+//  The seed shapes, each a known way to make the lexer work hard per
+//  byte - the fuzzer only has to find worse combinations of them
+//
+auto make_seeds()
+    -> std::vector<std::string>
+{
+    auto seeds = std::vector<std::string>{};
+
+    //  Nested string interpolation: each level re-lexes the inner
+    //  string as the interpolated expression
+    auto nested = std::string{"x"};
+    for (auto depth = 0; depth < 24; ++depth) {
+        nested = "\"(" + nested + ")$\"";
+    }
+    seeds.push_back( "a := " + nested + ";\n" );
+
+    //  Maximal-munch operator runs
+    auto ops = std::string{"b := c"};
+    for (auto i = 0; i < 300; ++i) {
+        ops += "<<<=>>>=<=>***...&&&";
+    }
+    seeds.push_back( ops + ";\n" );
+
+    //  Digit separators and suffix probing in one long literal
+    seeds.push_back( "n := 0x1'2c3'4d5'6ef" + std::string( 600, '\'' ) + ";\n" );
+
+    //  Comment-boundary churn
+    auto comments = std::string{};
+    for (auto i = 0; i < 200; ++i) {
+        comments += "/**/ //\n";
+    }
+    seeds.push_back( comments );
+
+    return seeds;
+}
+
+auto usage()
+    -> int
+{
+    std::cerr <<
+        "usage: cppfront-fuzz-lex [-check] [-corpus dir] [-seconds N] [-seed N]\n"
+        "                         [-reps N] [-ceiling X] [-save file]\n";
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+auto main(
+    int   argc,
+    char* argv[]
+)
+    -> int
+{
+    auto corpus    = std::string{ "lex-corpus" };
+    auto check     = false;
+    auto seconds   = 10.0;
+    auto seed      = std::random_device{}();
+    auto reps      = 5;
+    auto ceiling   = 400.0;
+    auto save      = std::string{};
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        auto arg  = std::string{ argv[i] };
+        auto next = [&]() -> char const* {
+            return i+1 < argc ? argv[++i] : nullptr;
+        };
+        if      (arg == "-check"  )               { check = true; }
+        else if (arg == "-corpus" ) { if (auto v = next()) { corpus  = v; }                else { return usage(); } }
+        else if (arg == "-seconds") { if (auto v = next()) { seconds = std::atof(v); }     else { return usage(); } }
+        else if (arg == "-seed"   ) { if (auto v = next()) { seed    = unsigned(std::atoll(v)); } else { return usage(); } }
+        else if (arg == "-reps"   ) { if (auto v = next()) { reps    = std::atoi(v); }     else { return usage(); } }
+        else if (arg == "-ceiling") { if (auto v = next()) { ceiling = std::atof(v); }     else { return usage(); } }
+        else if (arg == "-save"   ) { if (auto v = next()) { save    = v; }                else { return usage(); } }
+        else                        { return usage(); }
+    }
+
+    //  -check: the corpus gate - every corpus file must lex under its
+    //  ceiling, so a slowdown on a known-pathological shape fails CI
+    //  instead of freezing an editor
+    //
+    if (check)
+    {
+        auto ceilings = std::map<std::string, double>{};
+        {
+            auto f    = std::ifstream{ corpus + "/ceilings.txt" };
+            auto name = std::string{};
+            auto c    = 0.0;
+            while (f >> name >> c) {
+                ceilings[name] = c;
+            }
+        }
+
+        auto failed = 0;
+        auto files  = std::vector<std::filesystem::path>{};
+        for (auto const& entry : std::filesystem::directory_iterator{ corpus }) {
+            if (entry.path().extension() == ".cpp2") {
+                files.push_back( entry.path() );
+            }
+        }
+        std::sort( files.begin(), files.end() );
+
+        for (auto const& path : files)
+        {
+            auto name  = path.filename().string();
+            auto text  = read_file( path );
+            auto t     = ns_per_byte( text, reps );
+            auto limit = ceilings.contains(name) ? ceilings[name] : ceiling;
+            auto ok    = t <= limit;
+            failed    += !ok;
+            std::cout
+                << (ok ? "pass  " : "FAIL  ") << name
+                << "  " << t << " ns/byte (ceiling " << limit << ")\n";
+        }
+        std::cout << files.size() << " corpus files, " << failed << " over ceiling\n";
+        return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    //  Fuzzing: hill-climb from the seeds toward higher ns/byte, then
+    //  greedily minimize the best case so what gets checked into the
+    //  corpus is small enough to read
+    //
+    auto rng       = std::mt19937_64{ seed };
+    auto rnd       = [&](std::size_t n) { return n == 0 ? std::size_t{0} : rng() % n; };
+    auto seeds     = make_seeds();
+    auto best      = seeds[0];
+    auto best_t    = ns_per_byte( best, reps );
+    for (auto const& s : seeds) {
+        if (auto t = ns_per_byte(s, reps); t > best_t) {
+            best   = s;
+            best_t = t;
+        }
+    }
+
+    auto deadline = now_ns() + seconds * 1e9;
+    auto tried    = 0;
+    while (now_ns() < deadline)
+    {
+        auto cand = best;
+        switch (rnd(4)) {
+        break;case 0: {   // duplicate a span in place
+            auto at  = rnd( cand.size() );
+            auto len = std::min( cand.size() - at, 1 + rnd(64) );
+            cand.insert( at, cand.substr(at, len) );
+        }
+        break;case 1: {   // splice in a span from a seed
+            auto const& s = seeds[ rnd(seeds.size()) ];
+            auto at  = rnd( s.size() );
+            auto len = std::min( s.size() - at, 1 + rnd(64) );
+            cand.insert( rnd(cand.size()), s.substr(at, len) );
+        }
+        break;case 2: {   // delete a span
+            auto at = rnd( cand.size() );
+            cand.erase( at, 1 + rnd(64) );
+        }
+        break;default: {  // flip one byte to hostile punctuation
+            auto const hostile = std::string_view{ "<>*&=.'\"($" };
+            if (!cand.empty()) {
+                cand[ rnd(cand.size()) ] = hostile[ rnd(hostile.size()) ];
+            }
+        }
+        }
+        if (cand.empty() || cand.size() > 65536) {
+            continue;
+        }
+        ++tried;
+        if (auto t = ns_per_byte(cand, reps); t > best_t) {
+            best   = std::move(cand);
+            best_t = t;
+        }
+    }
+
+    //  Minimize: drop chunks as long as most of the badness remains
+    auto floor = best_t * 0.9;
+    for (auto chunk = best.size() / 2; chunk >= 1; chunk /= 2) {
+        for (auto at = std::size_t{0}; at + chunk <= best.size() && best.size() > chunk; ) {
+            auto cand = best;
+            cand.erase( at, chunk );
+            if (
+                !cand.empty()
+                && ns_per_byte(cand, reps) >= floor
+                )
+            {
+                best = std::move(cand);
+            }
+            else {
+                at += chunk;
+            }
+        }
+    }
+    best_t = ns_per_byte( best, reps );
+
+    std::cout
+        << "seed " << seed << ", " << tried << " mutations: worst case "
+        << best_t << " ns/byte over " << best.size() << " bytes\n";
+    if (!save.empty()) {
+        auto f = std::ofstream{ save, std::ios::binary };
+        f.write( best.data(), cpp2::unchecked_narrow<std::streamsize>(best.size()) );
+        std::cout << "wrote " << save << "\n";
+    }
+    return EXIT_SUCCESS;
+}
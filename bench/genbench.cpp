@@ -0,0 +1,131 @@
+
+//  genbench - generate synthetic .cpp2/.h2 stress inputs for the
+//  benchmark driver in this directory, so cppfront's scaling curve
+//  with declaration count, nesting depth, and expression width can
+//  be measured directly.
+//
+//  Build:  g++ -std=c++20 genbench.cpp -o genbench
+//  Usage:  genbench <kind> <K> [M]  (writes the source to stdout)
+//
+//      types K M      K types with M data members and M member functions
+//      inspect K      one function with K nested inspect expressions
+//      strings K      K string literals with M-ish interpolated expressions
+//      ufcs K         one expression chaining K UFCS calls
+//      funcs K        K independent small functions
+//
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+auto usage()
+    -> int
+{
+    std::cerr <<
+        "usage: genbench <kind> <K> [M]\n"
+        "  kinds: types K M | inspect K | strings K | ufcs K | funcs K\n";
+    return EXIT_FAILURE;
+}
+
+auto gen_types(int k, int m)
+    -> void
+{
+    for (auto t = 0; t < k; ++t) {
+        std::cout << "t" << t << ": type = {\n";
+        for (auto i = 0; i < m; ++i) {
+            std::cout << "    m" << i << ": int = " << i << ";\n";
+        }
+        for (auto i = 0; i < m; ++i) {
+            std::cout << "    f" << i << ": (this) -> int = { return m" << i << "; }\n";
+        }
+        std::cout << "}\n";
+    }
+    std::cout << "main: () = { }\n";
+}
+
+auto gen_inspect(int k)
+    -> void
+{
+    std::cout <<
+        "f: (x: int) -> int = {\n"
+        "    return ";
+    for (auto i = 0; i < k; ++i) {
+        std::cout <<
+            "inspect x -> int {\n"
+            "        is " << i << " = " << i << ";\n"
+            "        is _ = " << (i+1 < k ? "(" : "");
+    }
+    std::cout << "0";
+    for (auto i = k-1; i >= 0; --i) {
+        std::cout << ";\n    }" << (i > 0 ? ")" : "");
+    }
+    std::cout <<
+        ";\n"
+        "}\n"
+        "main: () = { f(42); }\n";
+}
+
+auto gen_strings(int k)
+    -> void
+{
+    std::cout << "main: () = {\n    x := 42;\n";
+    for (auto i = 0; i < k; ++i) {
+        std::cout
+            << "    s" << i << ": std::string = \"a(x)$ b(x + " << i
+            << ")$ c(x * x)$ d(x - " << i << ")$\";\n";
+    }
+    std::cout << "}\n";
+}
+
+auto gen_ufcs(int k)
+    -> void
+{
+    std::cout <<
+        "plus: (a: int, b: int) -> int = a + b;\n"
+        "main: () = {\n"
+        "    x := 0;\n"
+        "    y := x";
+    for (auto i = 0; i < k; ++i) {
+        std::cout << ".plus(" << i << ")";
+    }
+    std::cout <<
+        ";\n"
+        "}\n";
+}
+
+auto gen_funcs(int k)
+    -> void
+{
+    for (auto i = 0; i < k; ++i) {
+        std::cout
+            << "w" << i << ": (a: int, b: int) -> int = { c := a + b; return c * " << i
+            << "; }\n";
+    }
+    std::cout << "main: () = { }\n";
+}
+
+auto main(
+    int   argc,
+    char* argv[]
+)
+    -> int
+{
+    if (argc < 3) {
+        return usage();
+    }
+
+    auto kind = std::string{ argv[1] };
+    auto k    = std::max( 1, atoi(argv[2]) );
+    auto m    = argc > 3 ? std::max( 1, atoi(argv[3]) ) : 10;
+
+    if      (kind == "types"  ) { gen_types  (k, m); }
+    else if (kind == "inspect") { gen_inspect(k);    }
+    else if (kind == "strings") { gen_strings(k);    }
+    else if (kind == "ufcs"   ) { gen_ufcs   (k);    }
+    else if (kind == "funcs"  ) { gen_funcs  (k);    }
+    else {
+        return usage();
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+#!/bin/bash
+
+################
+usage() {
+    echo "Usage: $0 [-b <cppfront binary>] [-n <iterations>] [-l <run label>]"
+    echo "    -b <cppfront binary>  The cppfront to benchmark (default: 'cppfront' on PATH)"
+    echo "    -n <iterations>       Times to compile each input; the minimum is reported (default: 3)"
+    echo "    -l <run label>        Label recorded with the results (default: current git commit)"
+    exit 1
+}
+
+cppfront="cppfront"
+iterations=3
+label=""
+
+while getopts "b:n:l:" opt; do
+    case "${opt}" in
+        b) cppfront=${OPTARG};;
+        n) iterations=${OPTARG};;
+        l) label=${OPTARG};;
+        *) usage;;
+    esac
+done
+
+if ! command -v "$cppfront" > /dev/null; then
+    echo "error: cppfront binary '$cppfront' not found"
+    usage
+fi
+
+cd "$(dirname "$0")" || exit 1
+
+if [[ -z "$label" ]]; then
+    label=$(git rev-parse --short HEAD 2>/dev/null || echo "unlabeled")
+fi
+
+################
+# The corpus: the self-hosted sources, the largest regression tests,
+# and synthetic scaled inputs so the scaling curve is visible
+#
+mkdir -p generated
+workdir=$(mktemp -d)
+trap 'rm -rf "$workdir"' EXIT
+
+# gen-wide: many independent small declarations (stresses parse + emit)
+if [[ ! -f generated/gen-wide.cpp2 ]]; then
+    {
+        for i in $(seq 0 499); do
+            printf 'w%d: (a: int, b: int) -> int = { c := a + b; return c * %d; }\n' "$i" "$i"
+        done
+        printf 'main: () = { }\n'
+    } > generated/gen-wide.cpp2
+fi
+
+# gen-deep: one function with deeply nested scopes (stresses sema's scope walks)
+if [[ ! -f generated/gen-deep.cpp2 ]]; then
+    {
+        printf 'main: () = {\n    x := 0;\n'
+        for i in $(seq 1 200); do
+            printf '%*sif x < %d {\n' $((4 + i)) "" "$i"
+        done
+        printf '%*sx = 1;\n' $((205)) ""
+        for i in $(seq 200 -1 1); do
+            printf '%*s}\n' $((4 + i)) ""
+        done
+        printf '}\n'
+    } > generated/gen-deep.cpp2
+fi
+
+inputs="../source/reflect.h2 ../include/cpp2regex.h2 generated/gen-wide.cpp2 generated/gen-deep.cpp2"
+inputs="$inputs $(ls -S ../regression-tests/*.cpp2 | head -5 | tr '\n' ' ')"
+
+################
+# Compile each input 'iterations' times and keep the fastest run -
+# the minimum is the least noisy estimate of the true cost
+#
+results="results.csv"
+if [[ ! -f "$results" ]]; then
+    echo "label,input,min_ms,arena_high_water_bytes" > "$results"
+fi
+
+printf '%-40s %10s %16s\n' "input" "min ms" "arena high water"
+
+for input in $inputs; do
+    name=$(basename "$input")
+    min_ms=""
+    high_water=""
+
+    for _ in $(seq 1 "$iterations"); do
+        output=$("$cppfront" "$input" -verbose -o "$workdir/$name.cpp" 2>&1)
+        ms=$(echo "$output" | sed -n 's/ *Time *\([0-9,]*\) ms.*/\1/p' | tr -d ',')
+        hw=$(echo "$output" | sed -n 's/ *Heap *\([0-9,]*\) bytes arena high water.*/\1/p' | tr -d ',')
+        if [[ -z "$ms" ]]; then
+            echo "error: could not parse -verbose output for $input"
+            echo "$output"
+            exit 1
+        fi
+        if [[ -z "$min_ms" || "$ms" -lt "$min_ms" ]]; then
+            min_ms=$ms
+            high_water=$hw
+        fi
+    done
+
+    printf '%-40s %10s %16s\n' "$name" "$min_ms" "$high_water"
+
+    # Show the change against this input's previous recorded run, if any
+    prev=$(grep ",$name," "$results" | tail -1 | cut -d, -f3)
+    if [[ -n "$prev" && "$prev" -gt 0 ]]; then
+        delta=$((min_ms - prev))
+        printf '%-40s %10s (was %s ms at %s)\n' "" "${delta#+}" "$prev" "$(grep ",$name," "$results" | tail -1 | cut -d, -f1)"
+    fi
+
+    echo "$label,$name,$min_ms,$high_water" >> "$results"
+done
+
+echo
+echo "results appended to bench/$results (label: $label)"
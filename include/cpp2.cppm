@@ -0,0 +1,41 @@
+
+//  Copyright (c) Herb Sutter
+//  SPDX-License-Identifier: CC-BY-NC-ND-4.0
+//
+//  Part of the Cppfront Project, under the Creative Commons CC BY-NC-ND 4.0 DEED license
+//  with LLVM Exceptions. See https://github.com/hsutter/cppfront/blob/main/LICENSE
+//  for license information.
+
+
+//===========================================================================
+//  Module interface unit for the cpp2 runtime
+//
+//  Build this file once as the named module 'cpp2', then run cppfront
+//  with -emit-module: each generated translation unit then emits
+//  '#include "cpp2macros.h"' and 'import cpp2;' instead of re-including
+//  the full runtime headers, so the Cpp1 compiler stops re-parsing the
+//  runtime for every file. For example:
+//
+//      g++ -std=c++23 -fmodules-ts -x c++ cpp2.cppm -c
+//      cl  /std:c++latest /interface /TP cpp2.cppm
+//
+//  Define CPP2_INCLUDE_STD or CPP2_IMPORT_STD when building the module
+//  with the same value the generated code is compiled with
+//===========================================================================
+
+module;
+
+//  The std dependencies stay in the global module fragment, and the macro
+//  layer is textual by nature - importers include cpp2macros.h themselves
+#include "cpp2macros.h"
+
+export module cpp2;
+
+//  'extern "C++"' keeps these entities attached to the global module, so
+//  translation units that 'import cpp2;' link cleanly against ones that
+//  '#include "cpp2util.h"' - the std re-includes inside the headers are
+//  suppressed by their include guards
+export extern "C++" {
+    #include "cpp2util.h"
+    #include "cpp2regex.h"
+}
@@ -0,0 +1,202 @@
+//  Copyright (c) Herb Sutter
+//  SPDX-License-Identifier: CC-BY-NC-ND-4.0
+//
+//  Part of the Cppfront Project, under the Creative Commons CC BY-NC-ND 4.0 DEED license
+//  with LLVM Exceptions. See https://github.com/hsutter/cppfront/blob/main/LICENSE
+//  for license information.
+
+
+//===========================================================================
+//  The textual layer of the cpp2 runtime: the macros that cppfront-
+//  generated code expands (UFCS, bounds and zero checks, source location,
+//  requires-clause workarounds), plus the internal-linkage compiler
+//  version helpers they rely on
+//
+//  Macros cannot cross a module boundary, so in -emit-module builds each
+//  generated translation unit includes this header and gets everything
+//  else with 'import cpp2;' - see cpp2.cppm. cpp2util.h includes this
+//  header, so include-based builds are unchanged
+//===========================================================================
+
+#ifndef CPP2_CPP2MACROS_H
+#define CPP2_CPP2MACROS_H
+
+//  The feature-test macros and std declarations the definitions below use
+#include "cpp2std.h"
+
+//-----------------------------------------------------------------------
+//
+//  Macros
+//
+//-----------------------------------------------------------------------
+//
+#define CPP2_TYPEOF(x)              std::remove_cvref_t<decltype(x)>
+#if __cplusplus >= 202302L && \
+    ( \
+     (defined(__clang_major__) && __clang_major__ >= 15) \
+     || (defined(__GNUC__) && __GNUC__ >= 12) \
+     )
+#define CPP2_COPY(x)                auto(x)
+#else
+#define CPP2_COPY(x)                CPP2_TYPEOF(x)(x)
+#endif
+#define CPP2_FORWARD(x)             std::forward<decltype(x)>(x)
+#define CPP2_PACK_EMPTY(x)          (sizeof...(x) == 0)
+#define CPP2_CONTINUE_BREAK(NAME)   goto CONTINUE_##NAME; CONTINUE_##NAME: continue; goto BREAK_##NAME; BREAK_##NAME: break;
+                                    // these redundant goto's to avoid 'unused label' warnings
+
+//  Compiler version identification.
+// 
+//  This can use useful with 'if constexpr' to disable code known not to
+//  work on some otherwise-supported compilers (without macros), for example:
+// 
+//    //  Disable tests on lower-level compilers that have blocking bugs
+//    []<auto V = gcc_clang_msvc_min_versions(1400, 1600, 1920)> () { if constexpr (V) {
+//        // ... tests that would fail due to older compilers' bugs ...
+//    }}();
+//
+//  Note: Test Clang first because it pretends to be other compilers.
+//
+#if defined(__clang_major__)
+    constexpr auto gcc_ver   = 0;
+    constexpr auto clang_ver = __clang_major__ * 100 + __clang_minor__;
+    constexpr auto msvc_ver  = 0;
+#elif defined(_MSC_VER)
+    constexpr auto gcc_ver   = 0;
+    constexpr auto clang_ver = 0;
+    constexpr auto msvc_ver  = _MSC_VER;
+#elif defined(__GNUC__)
+    constexpr auto gcc_ver   = __GNUC__ * 100 + __GNUC_MINOR__;
+    constexpr auto clang_ver = 0;
+    constexpr auto msvc_ver  = 0;
+#endif
+
+constexpr auto gcc_clang_msvc_min_versions(
+    auto gcc,
+    auto clang,
+    auto msvc
+)
+{
+    return gcc_ver >= gcc || clang_ver >= clang || msvc_ver >= msvc;
+}
+
+
+#if defined(_MSC_VER) && !defined(__clang_major__)
+   // MSVC can't handle 'inline constexpr' variables yet in all cases
+    #define CPP2_CONSTEXPR const
+#else
+    #define CPP2_CONSTEXPR constexpr
+#endif
+
+
+// Workaround <https://github.com/llvm/llvm-project/issues/70556>.
+#define CPP2_FORCE_INLINE_LAMBDA_CLANG /* empty */
+
+// For outlining the no-match fallback arm of an inspect-expression, so
+// the matched arms stay compact in the instruction cache
+#if defined(_MSC_VER) && !defined(__clang_major__)
+    #define CPP2_COLD_LAMBDA /* empty */
+#else
+    #define CPP2_COLD_LAMBDA __attribute__((cold, noinline))
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang_major__)
+    #define CPP2_FORCE_INLINE              __forceinline
+    #define CPP2_FORCE_INLINE_LAMBDA       [[msvc::forceinline]]
+    #define CPP2_LAMBDA_NO_DISCARD
+#else
+    #define CPP2_FORCE_INLINE              __attribute__((always_inline))
+    #if defined(__clang__)
+        #define CPP2_FORCE_INLINE_LAMBDA       /* empty */
+        #undef CPP2_FORCE_INLINE_LAMBDA_CLANG
+        #define CPP2_FORCE_INLINE_LAMBDA_CLANG __attribute__((always_inline))
+    #else
+        #define CPP2_FORCE_INLINE_LAMBDA       __attribute__((always_inline))
+    #endif
+
+    #if defined(__clang_major__)
+        //  Also check __cplusplus, only to satisfy Clang -pedantic-errors
+        #if __cplusplus >= 202302L && (__clang_major__ > 13 || (__clang_major__ == 13 && __clang_minor__ >= 2))
+            #define CPP2_LAMBDA_NO_DISCARD   [[nodiscard]]
+        #else
+            #define CPP2_LAMBDA_NO_DISCARD
+        #endif
+    #elif defined(__GNUC__)
+        #if __GNUC__ >= 9
+            #define CPP2_LAMBDA_NO_DISCARD   [[nodiscard]]
+        #else
+            #define CPP2_LAMBDA_NO_DISCARD
+        #endif
+        #if ((__GNUC__ * 100) + __GNUC_MINOR__) < 1003
+            //  GCC 10.2 doesn't support this feature (10.3 is fine)
+            #undef  CPP2_FORCE_INLINE_LAMBDA
+            #define CPP2_FORCE_INLINE_LAMBDA
+        #endif
+    #else
+        #define CPP2_LAMBDA_NO_DISCARD
+    #endif
+#endif
+
+//  For the failure paths of the safety checks: keep them out of line and
+//  out of the hot code, so that the inline part of a check is just the
+//  comparison and a forward-predicted branch
+#if defined(_MSC_VER) && !defined(__clang_major__)
+    #define CPP2_COLD_OUTLINED             __declspec(noinline)
+#else
+    #define CPP2_COLD_OUTLINED             __attribute__((cold, noinline))
+#endif
+
+//  For cppfront's -function-heat option: generated function definitions
+//  carry the heat recorded for their Cpp2 source position, so
+//  profile-guided linker layout can group them
+#if defined(_MSC_VER) && !defined(__clang_major__)
+    #define CPP2_FUNC_HOT
+    #define CPP2_FUNC_COLD
+#else
+    #define CPP2_FUNC_HOT                  __attribute__((hot))
+    #define CPP2_FUNC_COLD                 __attribute__((cold))
+#endif
+
+
+#ifdef CPP2_USE_SOURCE_LOCATION
+    #define CPP2_SOURCE_LOCATION_PARAM              , [[maybe_unused]] std::source_location where
+    #define CPP2_SOURCE_LOCATION_PARAM_WITH_DEFAULT , [[maybe_unused]] std::source_location where = std::source_location::current()
+    #define CPP2_SOURCE_LOCATION_PARAM_SOLO         [[maybe_unused]] std::source_location where
+    #define CPP2_SOURCE_LOCATION_ARG                , where
+    #define CPP2_SOURCE_LOCATION_VALUE              (cpp2::to_string(where.file_name()) + "(" + cpp2::to_string(where.line()) + ") " + where.function_name())
+#else
+    #define CPP2_SOURCE_LOCATION_PARAM
+    #define CPP2_SOURCE_LOCATION_PARAM_WITH_DEFAULT
+    #define CPP2_SOURCE_LOCATION_PARAM_SOLO
+    #define CPP2_SOURCE_LOCATION_ARG
+    #define CPP2_SOURCE_LOCATION_VALUE              std::string("")
+#endif
+
+//  For C++23: make this std::string_view and drop the macro
+//      Before C++23 std::string_view was not guaranteed to be trivially copyable,
+//      and so in<T> will pass it by const& and really it should be by value
+#define CPP2_MESSAGE_PARAM  char const*
+#define CPP2_CONTRACT_MSG   cpp2::message_to_cstr_adapter
+
+
+//  Call sites for the division and subscript safety checks - the checked
+//  implementations live in cpp2util.h (namespace cpp2::impl)
+//
+#define CPP2_ASSERT_NOT_ZERO(NumType, arg)          (cpp2::impl::assert_not_zero<NumType>((arg)))
+#define CPP2_ASSERT_NOT_ZERO_LITERAL(NumType, arg)  (cpp2::impl::assert_not_zero<NumType, (arg)>('_'))
+#define CPP2_ASSERT_IN_BOUNDS(x,arg)         (cpp2::impl::assert_in_bounds((x),(arg)))
+#define CPP2_ASSERT_IN_BOUNDS_LITERAL(x,arg) (cpp2::impl::assert_in_bounds<(arg)>(x))
+
+
+//  The UFCS and requires-clause workaround macros are textual too, but
+//  their diagnostic line numbers are pinned inside cpp2util.h and cited
+//  by the regression test outputs, so they stay there; when this header
+//  is included standalone (a module build - see cpp2.cppm), pull in
+//  just that section of the header
+#ifndef CPP2_CPP2UTIL_H
+    #define CPP2_UFCS_MACROS_ONLY
+    #include "cpp2util.h"
+    #undef  CPP2_UFCS_MACROS_ONLY
+#endif
+
+#endif // CPP2_CPP2MACROS_H
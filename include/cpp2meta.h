@@ -0,0 +1,57 @@
+
+//  Copyright 2022-2024 Herb Sutter
+//  SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//  Part of the Cppfront Project, under the Apache License v2.0 with LLVM Exceptions.
+//  See https://github.com/hsutter/cppfront/blob/main/LICENSE for license information.
+
+
+//===========================================================================
+//  The C interface between cppfront and -metafunction-lib plugins
+//
+//  This is C, not C++, so that the contract is toolchain-stable: a
+//  plugin keeps working across cppfront rebuilds and compiler
+//  upgrades, and never executes cppfront's own header-inline code in
+//  its own module. All compiler work happens on the cppfront side of
+//  these function pointers
+//===========================================================================
+
+#ifndef CPP2_CPP2META_H
+#define CPP2_CPP2META_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//  The services cppfront passes to a plugin with each metafunction
+//  application - 'type' is an opaque handle to the type declaration
+//  being compiled, and is only valid for the duration of the call
+//
+typedef struct cpp2_meta_services {
+    void* type;
+
+    //  Add a member to the type, written as Cpp2 source text -
+    //  ill-formed text is reported as a compile error against the type
+    void (*add_member)(void* type, char const* source);
+
+    //  Report a compile-time error against the type
+    void (*error)(void* type, char const* message);
+
+    //  The type's name - the returned pointer stays valid until the
+    //  next 'name' call on the same thread
+    char const* (*name)(void* type);
+} cpp2_meta_services;
+
+//  A plugin exports this entry point, and returns nonzero when it
+//  recognized 'name' and applied it:
+//
+//      int cpp2_apply_metafunction(
+//          char const*               name,
+//          cpp2_meta_services const* services
+//      );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -6,71 +6,105 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "cpp2regex.h2"
 
-#line 22 "cpp2regex.h2"
+#line 59 "cpp2regex.h2"
 namespace cpp2 {
 
 namespace regex {
 
-#line 38 "cpp2regex.h2"
+#line 75 "cpp2regex.h2"
 template<typename Iter> class match_group;
 
-#line 48 "cpp2regex.h2"
+#line 85 "cpp2regex.h2"
 template<typename Iter> class match_return;
 
-#line 56 "cpp2regex.h2"
+#line 93 "cpp2regex.h2"
 template<typename CharT, typename Iter, int max_groups> class match_context;
 
-#line 117 "cpp2regex.h2"
+#line 177 "cpp2regex.h2"
 class true_end_func;
 
-#line 125 "cpp2regex.h2"
+#line 185 "cpp2regex.h2"
 class no_reset;
 
-#line 132 "cpp2regex.h2"
+#line 192 "cpp2regex.h2"
 template<typename Func> class on_return;
 
-#line 159 "cpp2regex.h2"
+#line 219 "cpp2regex.h2"
 template<typename CharT, CharT C> class single_class_entry;
 
-#line 168 "cpp2regex.h2"
+#line 228 "cpp2regex.h2"
 template<typename CharT, CharT Start, CharT End> class range_class_entry;
 
-#line 177 "cpp2regex.h2"
+#line 237 "cpp2regex.h2"
 template<typename CharT, typename ...List> class combined_class_entry;
 
-#line 186 "cpp2regex.h2"
+#line 246 "cpp2regex.h2"
 template<typename CharT, CharT ...List> class list_class_entry;
 
-#line 195 "cpp2regex.h2"
+#line 255 "cpp2regex.h2"
 template<typename CharT, string_util::fixed_string Name, typename Inner> class named_class_entry;
 
-#line 202 "cpp2regex.h2"
+#line 262 "cpp2regex.h2"
 template<typename CharT, typename Inner> class negated_class_entry;
 
-#line 211 "cpp2regex.h2"
+#line 271 "cpp2regex.h2"
 template<typename CharT, string_util::fixed_string Name, typename Inner> class shorthand_class_entry;
 
-#line 259 "cpp2regex.h2"
+#line 319 "cpp2regex.h2"
 template<typename CharT> class alternative_token_matcher;
 
-#line 337 "cpp2regex.h2"
+#line 397 "cpp2regex.h2"
 template<typename CharT, bool negate, bool case_insensitive, typename ...List> class class_token_matcher;
 
-#line 492 "cpp2regex.h2"
+#line 567 "cpp2regex.h2"
 class range_flags;
     
 
-#line 501 "cpp2regex.h2"
+#line 576 "cpp2regex.h2"
 template<typename CharT, int min_count, int max_count, int kind> class range_token_matcher;
 
-#line 673 "cpp2regex.h2"
+#line 766 "cpp2regex.h2"
+template<string_util::fixed_string prefix, bool anchored> class prefilter;
+
+#line 813 "cpp2regex.h2"
+template<
+                  int nstates, 
+                  int nclasses, 
+                  string_util::fixed_string pattern, 
+                  string_util::fixed_string classes, 
+                  string_util::fixed_string edges, 
+                  string_util::fixed_string accept, 
+    bool anchor_start, 
+    bool           anchor_end
+    > class dfa_table_matcher;
+
+#line 929 "cpp2regex.h2"
+template<string_util::fixed_string table> class onepass_class;
+
+#line 945 "cpp2regex.h2"
+template<int npatterns> class regex_set_result;
+
+#line 988 "cpp2regex.h2"
+template<
+    int npatterns, 
+    int         nstates, 
+    int         nclasses, 
+                string_util::fixed_string classes, 
+                string_util::fixed_string edges, 
+    string_util::fixed_string accept_any, 
+    string_util::fixed_string accept_end
+    > class regex_set_table;
+
+#line 1086 "cpp2regex.h2"
 template<typename CharT, typename matcher_wrapper> class regular_expression;
 
-#line 756 "cpp2regex.h2"
+#line 1269 "cpp2regex.h2"
 }
 }
 
@@ -99,7 +133,43 @@ using matcher_wrapper_type = typename matcher_wrapper::template wrap<Iter, CharT
 template<typename matcher>
 using matcher_context_type = typename matcher::context;
 
-#line 22 "cpp2regex.h2"
+namespace cpp2::regex {
+
+//  Build a 256-entry lookup table for a character class at compile time.
+//  The entry list, case folding, and negation are all folded into the
+//  table, so matching a narrow character is a single indexed load instead
+//  of a chain of comparisons and tolower/toupper calls.
+//
+template<typename CharT, bool negate, bool case_insensitive, typename... List>
+constexpr auto make_class_table() -> std::array<bool, 256>
+{
+    std::array<bool, 256> ret = {};
+    for (int i = 0; i < 256; ++i) {
+        auto c  = static_cast<CharT>(static_cast<unsigned char>(i));
+        bool in = false;
+        if constexpr (case_insensitive) {
+            in =    (List::includes(string_util::safe_tolower(c)) || ...)
+                 || (List::includes(string_util::safe_toupper(c)) || ...);
+        }
+        else {
+            in = (List::includes(c) || ...);
+        }
+        ret[i] = negate != in;
+    }
+    return ret;
+}
+
+template<typename CharT, bool negate, bool case_insensitive, typename... List>
+inline constexpr std::array<bool, 256> class_table_v = make_class_table<CharT, negate, case_insensitive, List...>();
+
+template<typename CharT, bool negate, bool case_insensitive, typename... List>
+constexpr auto class_table() -> std::array<bool, 256> const&
+{
+    return class_table_v<CharT, negate, case_insensitive, List...>;
+}
+
+}
+
 namespace cpp2 {
 
 namespace regex {
@@ -125,7 +195,7 @@ template<typename Iter> class match_group
     public: match_group(auto const& start_, auto const& end_, auto const& matched_);
 public: match_group();
 
-#line 44 "cpp2regex.h2"
+#line 81 "cpp2regex.h2"
 };
 
 //  Return value for every matcher.
@@ -137,7 +207,7 @@ template<typename Iter> class match_return
     public: match_return(auto const& matched_, auto const& pos_);
 public: match_return();
 
-#line 52 "cpp2regex.h2"
+#line 89 "cpp2regex.h2"
 };
 
 //  Modifiable state during matching.
@@ -151,13 +221,13 @@ template<typename CharT, typename Iter, int max_groups> class match_context
 
     public: match_context(Iter const& begin_, Iter const& end_);
 
-#line 68 "cpp2regex.h2"
+#line 105 "cpp2regex.h2"
     public: match_context(match_context const& that);
-#line 68 "cpp2regex.h2"
+#line 105 "cpp2regex.h2"
     public: auto operator=(match_context const& that) -> match_context& ;
-#line 68 "cpp2regex.h2"
+#line 105 "cpp2regex.h2"
     public: match_context(match_context&& that) noexcept;
-#line 68 "cpp2regex.h2"
+#line 105 "cpp2regex.h2"
     public: auto operator=(match_context&& that) noexcept -> match_context& ;
 
     //  Getter and setter for groups
@@ -166,31 +236,47 @@ template<typename CharT, typename Iter, int max_groups> class match_context
 
     public: [[nodiscard]] auto get_group_end(auto const& group) const& -> int;
 
-#line 80 "cpp2regex.h2"
+#line 117 "cpp2regex.h2"
     public: [[nodiscard]] auto get_group_start(auto const& group) const& -> int;
 
-#line 86 "cpp2regex.h2"
+#line 123 "cpp2regex.h2"
     public: [[nodiscard]] auto get_group_string(auto const& group) const& -> std::string;
 
-#line 93 "cpp2regex.h2"
+#line 129 "cpp2regex.h2"
+    //  Zero-copy variant: a view into the subject, valid as long as the
+    //  subject is. Nothing in the match path allocates when callers stay
+    //  on views.
+    public: [[nodiscard]] auto get_group_view(auto const& group) const& -> std::basic_string_view<CharT>;
+
+#line 139 "cpp2regex.h2"
     public: auto set_group_end(auto const& group, auto const& pos) & -> void;
 
-#line 98 "cpp2regex.h2"
+#line 144 "cpp2regex.h2"
     public: auto set_group_invalid(auto const& group) & -> void;
 
-#line 102 "cpp2regex.h2"
+#line 148 "cpp2regex.h2"
     public: auto set_group_start(auto const& group, auto const& pos) & -> void;
 
-#line 106 "cpp2regex.h2"
+#line 152 "cpp2regex.h2"
     public: [[nodiscard]] auto size() const& -> decltype(auto);
 
+    //  Backtracking budget: when nonnegative, every quantifier attempt
+    //  spends one step, and matching reports failure once the budget is
+    //  exhausted - a hard latency ceiling for adversarial inputs against
+    //  patterns like '(a+)+b' that otherwise backtrack exponentially.
+    //  -1 (the default) means unlimited.
+            public: cpp2::i64 steps_remaining {-1}; 
+
+    public: [[nodiscard]] auto count_step() & -> bool;
+
+#line 168 "cpp2regex.h2"
     //  Misc functions
     //
     public: [[nodiscard]] auto fail() const& -> decltype(auto);
     public: [[nodiscard]] auto pass(cpp2::impl::in<Iter> cur) const& -> decltype(auto);
 };
 
-#line 115 "cpp2regex.h2"
+#line 175 "cpp2regex.h2"
 //  End function that returns a valid match.
 //
 class true_end_func
@@ -198,7 +284,7 @@ class true_end_func
     public: [[nodiscard]] auto operator()(auto const& cur, auto& ctx) const& -> decltype(auto);
 };
 
-#line 123 "cpp2regex.h2"
+#line 183 "cpp2regex.h2"
 //  Empty group reset function.
 //
 class no_reset
@@ -206,30 +292,30 @@ class no_reset
     public: auto operator()([[maybe_unused]] auto& unnamed_param_2) const& -> void;
 };
 
-#line 131 "cpp2regex.h2"
+#line 191 "cpp2regex.h2"
 //  Evaluate func on destruction of the handle.
 template<typename Func> class on_return
  {
     private: Func func; 
 
     public: on_return(Func const& f);
-#line 136 "cpp2regex.h2"
+#line 196 "cpp2regex.h2"
     public: auto operator=(Func const& f) -> on_return& ;
 
-#line 140 "cpp2regex.h2"
+#line 200 "cpp2regex.h2"
     public: ~on_return() noexcept;
     public: on_return(on_return const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(on_return const&) -> void = delete;
 
 
-#line 143 "cpp2regex.h2"
+#line 203 "cpp2regex.h2"
 };
 
-#line 146 "cpp2regex.h2"
+#line 206 "cpp2regex.h2"
 //  Helper for auto deduction of the Func type.
 template<typename Func> [[nodiscard]] auto make_on_return(Func const& func) -> decltype(auto);
 
-#line 150 "cpp2regex.h2"
+#line 210 "cpp2regex.h2"
 //-----------------------------------------------------------------------
 //
 //  Character classes for regular expressions.
@@ -241,98 +327,98 @@ template<typename Func> [[nodiscard]] auto make_on_return(Func const& func) -> d
 //
 template<typename CharT, CharT C> class single_class_entry
  {
-    public: [[nodiscard]] static auto includes(cpp2::impl::in<CharT> c) -> decltype(auto);
+    public: [[nodiscard]] constexpr static auto includes(cpp2::impl::in<CharT> c) -> bool;
     public: [[nodiscard]] static auto to_string() -> decltype(auto);
     public: single_class_entry() = default;
     public: single_class_entry(single_class_entry const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(single_class_entry const&) -> void = delete;
 
-#line 163 "cpp2regex.h2"
+#line 223 "cpp2regex.h2"
 };
 
-#line 166 "cpp2regex.h2"
+#line 226 "cpp2regex.h2"
 //  Class syntax: - Example: a-c
 //
 template<typename CharT, CharT Start, CharT End> class range_class_entry
  {
-    public: [[nodiscard]] static auto includes(cpp2::impl::in<CharT> c) -> decltype(auto);
+    public: [[nodiscard]] constexpr static auto includes(cpp2::impl::in<CharT> c) -> bool;
     public: [[nodiscard]] static auto to_string() -> decltype(auto);
     public: range_class_entry() = default;
     public: range_class_entry(range_class_entry const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(range_class_entry const&) -> void = delete;
 
-#line 172 "cpp2regex.h2"
+#line 232 "cpp2regex.h2"
 };
 
-#line 175 "cpp2regex.h2"
+#line 235 "cpp2regex.h2"
 //  Helper for combining two character classes
 //
 template<typename CharT, typename ...List> class combined_class_entry
  {
-    public: [[nodiscard]] static auto includes(cpp2::impl::in<CharT> c) -> decltype(auto);
+    public: [[nodiscard]] constexpr static auto includes(cpp2::impl::in<CharT> c) -> bool;
     public: [[nodiscard]] static auto to_string() -> decltype(auto);
     public: combined_class_entry() = default;
     public: combined_class_entry(combined_class_entry const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(combined_class_entry const&) -> void = delete;
 
-#line 181 "cpp2regex.h2"
+#line 241 "cpp2regex.h2"
 };
 
-#line 184 "cpp2regex.h2"
+#line 244 "cpp2regex.h2"
 //  Class syntax: <list of characters>  Example: abcd
 //
 template<typename CharT, CharT ...List> class list_class_entry
  {
-    public: [[nodiscard]] static auto includes(cpp2::impl::in<CharT> c) -> decltype(auto);
+    public: [[nodiscard]] constexpr static auto includes(cpp2::impl::in<CharT> c) -> bool;
     public: [[nodiscard]] static auto to_string() -> decltype(auto);
     public: list_class_entry() = default;
     public: list_class_entry(list_class_entry const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(list_class_entry const&) -> void = delete;
 
-#line 190 "cpp2regex.h2"
+#line 250 "cpp2regex.h2"
 };
 
-#line 193 "cpp2regex.h2"
+#line 253 "cpp2regex.h2"
 //  Class syntax: [:<class name:]  Example: [:alnum:]
 //
 template<typename CharT, string_util::fixed_string Name, typename Inner> class named_class_entry
  {
-    public: [[nodiscard]] static auto includes(cpp2::impl::in<CharT> c) -> decltype(auto);
+    public: [[nodiscard]] constexpr static auto includes(cpp2::impl::in<CharT> c) -> bool;
     public: [[nodiscard]] static auto to_string() -> decltype(auto);
     public: named_class_entry() = default;
     public: named_class_entry(named_class_entry const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(named_class_entry const&) -> void = delete;
 
-#line 199 "cpp2regex.h2"
+#line 259 "cpp2regex.h2"
 };
 
-#line 202 "cpp2regex.h2"
+#line 262 "cpp2regex.h2"
 template<typename CharT, typename Inner> class negated_class_entry
 : public Inner {
 
-    public: [[nodiscard]] static auto includes(cpp2::impl::in<CharT> c) -> decltype(auto);
+    public: [[nodiscard]] constexpr static auto includes(cpp2::impl::in<CharT> c) -> bool;
     public: negated_class_entry() = default;
     public: negated_class_entry(negated_class_entry const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(negated_class_entry const&) -> void = delete;
 
-#line 206 "cpp2regex.h2"
+#line 266 "cpp2regex.h2"
 };
 
-#line 209 "cpp2regex.h2"
+#line 269 "cpp2regex.h2"
 //  Short class syntax: \<character>  Example: \w
 //
 template<typename CharT, string_util::fixed_string Name, typename Inner> class shorthand_class_entry
  {
-    public: [[nodiscard]] static auto includes(cpp2::impl::in<CharT> c) -> decltype(auto);
+    public: [[nodiscard]] constexpr static auto includes(cpp2::impl::in<CharT> c) -> bool;
     public: [[nodiscard]] static auto to_string() -> decltype(auto);
     public: shorthand_class_entry() = default;
     public: shorthand_class_entry(shorthand_class_entry const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(shorthand_class_entry const&) -> void = delete;
 
-#line 215 "cpp2regex.h2"
+#line 275 "cpp2regex.h2"
 };
 
-#line 218 "cpp2regex.h2"
+#line 278 "cpp2regex.h2"
 //  Named basic character classes
 //
 template        <typename CharT> using digits_class = named_class_entry<CharT,"digits",range_class_entry<CharT,'0','9'>>;
@@ -369,7 +455,7 @@ template                     <typename CharT> using short_not_space_class = nega
 template<typename CharT> using short_not_vert_space_class = negated_class_entry<CharT,shorthand_class_entry<CharT,"\\V",ver_space_class<CharT>>>;
 template                     <typename CharT> using short_not_word_class = negated_class_entry<CharT,shorthand_class_entry<CharT,"\\W",word_class<CharT>>>;
 
-#line 255 "cpp2regex.h2"
+#line 315 "cpp2regex.h2"
 //  Regex syntax: |  Example: ab|ba
 //
 //  Non greedy implementation. First alternative that matches is chosen.
@@ -378,22 +464,22 @@ template<typename CharT> class alternative_token_matcher
  {
     public: [[nodiscard]] static auto match(auto const& cur, auto& ctx, auto const& end_func, auto const& tail, auto const& ...functions) -> auto;
 
-#line 265 "cpp2regex.h2"
+#line 325 "cpp2regex.h2"
     private: template<typename ...Other> [[nodiscard]] static auto match_first(auto const& cur, auto& ctx, auto const& end_func, auto const& tail, auto const& cur_func, auto const& cur_reset, Other const& ...other) -> auto;
     public: alternative_token_matcher() = default;
     public: alternative_token_matcher(alternative_token_matcher const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(alternative_token_matcher const&) -> void = delete;
 
 
-#line 283 "cpp2regex.h2"
+#line 343 "cpp2regex.h2"
 };
 
-#line 286 "cpp2regex.h2"
+#line 346 "cpp2regex.h2"
 //  Regex syntax: .
 //
 template<typename CharT, bool single_line> [[nodiscard]] auto any_token_matcher(auto& cur, auto& ctx) -> bool;
 
-#line 301 "cpp2regex.h2"
+#line 361 "cpp2regex.h2"
 // TODO: Check if vectorization works at some point with this implementation.
 // char_token_matcher: <tokens: string_util::fixed_string> (inout cur, inout ctx) -> bool = {
 //     if !(std::distance(cur, ctx.end) < tokens..size()) {
@@ -427,21 +513,21 @@ template<typename CharT, bool single_line> [[nodiscard]] auto any_token_matcher(
 //     return matched;
 // }
 
-#line 335 "cpp2regex.h2"
+#line 395 "cpp2regex.h2"
 //  Regex syntax: [<character classes>]  Example: [abcx-y[:digits:]]
 //
 template<typename CharT, bool negate, bool case_insensitive, typename ...List> class class_token_matcher
  {
     public: [[nodiscard]] static auto match(auto& cur, auto& ctx) -> bool;
 
-#line 368 "cpp2regex.h2"
+#line 443 "cpp2regex.h2"
     private: template<typename First, typename ...Other> [[nodiscard]] static auto match_any(cpp2::impl::in<CharT> c) -> bool;
     public: class_token_matcher() = default;
     public: class_token_matcher(class_token_matcher const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(class_token_matcher const&) -> void = delete;
 
 
-#line 381 "cpp2regex.h2"
+#line 456 "cpp2regex.h2"
     // TODO: Implement proper to string
     // to_string: () -> bstring<CharT> = {
     //     r: bstring<CharT> = "[";
@@ -453,10 +539,9 @@ template<typename CharT, bool negate, bool case_insensitive, typename ...List> c
 
     //     return r;
     // }
-#line 392 "cpp2regex.h2"
 };
 
-#line 395 "cpp2regex.h2"
+#line 470 "cpp2regex.h2"
 // Named short classes
 //
 template                    <typename CharT,          bool case_insensitive> using named_class_no_new_line = class_token_matcher<CharT,true,case_insensitive,single_class_entry<CharT,'\n'>>;
@@ -472,7 +557,7 @@ template                    <typename CharT,          bool case_insensitive> usi
 template                    <typename CharT,          bool case_insensitive> using named_class_not_ver_space = class_token_matcher<CharT,true,case_insensitive,ver_space_class<CharT>>;
 template                    <typename CharT,          bool case_insensitive> using named_class_not_word = class_token_matcher<CharT,true,case_insensitive,word_class<CharT>>;
 
-#line 411 "cpp2regex.h2"
+#line 486 "cpp2regex.h2"
 //  Regex syntax: \<number>  Example: \1
 //                \g{name_or_number}
 //                \k{name_or_number}
@@ -481,27 +566,27 @@ template                    <typename CharT,          bool case_insensitive> usi
 //
 template<typename CharT, int group, bool case_insensitive> [[nodiscard]] auto group_ref_token_matcher(auto& cur, auto& ctx) -> bool;
 
-#line 448 "cpp2regex.h2"
+#line 523 "cpp2regex.h2"
 //  Regex syntax: $  Example: aa$
 //
 template<typename CharT, bool match_new_line, bool match_new_line_before_end> [[nodiscard]] auto line_end_token_matcher(auto const& cur, auto& ctx) -> bool;
 
-#line 464 "cpp2regex.h2"
+#line 539 "cpp2regex.h2"
 //  Regex syntax: ^  Example: ^aa
 //
 template<typename CharT, bool match_new_line> [[nodiscard]] auto line_start_token_matcher(auto const& cur, auto& ctx) -> bool;
 
-#line 473 "cpp2regex.h2"
+#line 548 "cpp2regex.h2"
 //  Regex syntax: (?=) or (?!) or (*pla), etc.  Example: (?=AA)
 //
 //  Parsed in group_token.
 //
 template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_matcher(auto const& cur, auto& ctx, auto const& func) -> bool;
 
-#line 488 "cpp2regex.h2"
+#line 563 "cpp2regex.h2"
 // TODO: @enum as template parameter currently not working. See issue https://github.com/hsutter/cppfront/issues/1147
 
-#line 491 "cpp2regex.h2"
+#line 566 "cpp2regex.h2"
 //  Options for range matching.
 class range_flags {
     public: static const int not_greedy;// Try to take as few as possible.
@@ -512,9 +597,9 @@ class range_flags {
     public: range_flags(range_flags const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(range_flags const&) -> void = delete;
 };
-#line 497 "cpp2regex.h2"
+#line 572 "cpp2regex.h2"
 
-#line 499 "cpp2regex.h2"
+#line 574 "cpp2regex.h2"
 //  Regex syntax: <matcher>{min, max}  Example: a{2,4}
 //
 template<typename CharT, int min_count, int max_count, int kind> class range_token_matcher
@@ -522,42 +607,274 @@ template<typename CharT, int min_count, int max_count, int kind> class range_tok
 
     public: template<typename Iter> [[nodiscard]] static auto match(Iter const& cur, auto& ctx, auto const& inner, auto const& reset_func, auto const& end_func, auto const& tail) -> auto;
 
-#line 517 "cpp2regex.h2"
+#line 592 "cpp2regex.h2"
     private: [[nodiscard]] static auto is_below_upper_bound(cpp2::impl::in<int> count) -> bool;
 
-#line 522 "cpp2regex.h2"
+#line 597 "cpp2regex.h2"
     private: [[nodiscard]] static auto is_below_lower_bound(cpp2::impl::in<int> count) -> bool;
 
-#line 527 "cpp2regex.h2"
+#line 602 "cpp2regex.h2"
     private: [[nodiscard]] static auto is_in_range(cpp2::impl::in<int> count) -> bool;
 
-#line 533 "cpp2regex.h2"
+#line 608 "cpp2regex.h2"
     private: template<typename Iter> [[nodiscard]] static auto match_min_count(Iter const& cur, auto& ctx, auto const& inner, auto const& end_func, int& count_r) -> auto;
 
-#line 549 "cpp2regex.h2"
+#line 624 "cpp2regex.h2"
     private: template<typename Iter> [[nodiscard]] static auto match_greedy(cpp2::impl::in<int> count, Iter const& cur, Iter const& last_valid, auto& ctx, auto const& inner, auto const& reset_func, auto const& end_func, auto const& other) -> match_return<Iter>;
 
-#line 579 "cpp2regex.h2"
+#line 660 "cpp2regex.h2"
     private: template<typename Iter> [[nodiscard]] static auto match_possessive(Iter const& cur, auto& ctx, auto const& inner, auto const& end_func, auto const& other) -> match_return<Iter>;
 
-#line 607 "cpp2regex.h2"
+#line 688 "cpp2regex.h2"
     private: template<typename Iter> [[nodiscard]] static auto match_not_greedy(Iter const& cur, auto& ctx, auto const& inner, auto const& end_func, auto const& other) -> match_return<Iter>;
     public: range_token_matcher() = default;
     public: range_token_matcher(range_token_matcher const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(range_token_matcher const&) -> void = delete;
 
 
-#line 633 "cpp2regex.h2"
+#line 719 "cpp2regex.h2"
 };
 
-#line 636 "cpp2regex.h2"
+#line 722 "cpp2regex.h2"
 //  Regex syntax: \b or \B  Example: \bword\b
 //
 //  Matches the start end end of word boundaries.
 //
 template<typename CharT, bool negate> [[nodiscard]] auto word_boundary_token_matcher(auto& cur, auto& ctx) -> bool;
 
-#line 665 "cpp2regex.h2"
+#line 751 "cpp2regex.h2"
+//-----------------------------------------------------------------------
+//
+//  prefilter: skips ahead to candidate match-start positions.
+//
+//  Every generated matcher exports a 'prefilter' alias carrying what the
+//  metafunction could prove about its pattern without running it: a
+//  literal prefix every match has to start with, and whether the pattern
+//  is anchored to the start of the subject. 'search' asks it for the
+//  next viable offset instead of invoking the full matcher at every one.
+//  The prefix scan bottoms out in std::find on the first prefix byte,
+//  which the standard library turns into memchr / vectorized compares on
+//  contiguous character ranges. prefilter<"", false> filters nothing.
+//
+//-----------------------------------------------------------------------
+//
+template<string_util::fixed_string prefix, bool anchored> class prefilter
+ {
+    //  Returns the first position in [cur, end) that can start a match,
+    //  or 'end' if there is none.
+    public: template<typename Iter> [[nodiscard]] static auto find(Iter const& cur, Iter const& begin, Iter const& end) -> Iter;
+    public: prefilter() = default;
+    public: prefilter(prefilter const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(prefilter const&) -> void = delete;
+
+
+#line 795 "cpp2regex.h2"
+};
+
+#line 798 "cpp2regex.h2"
+//-----------------------------------------------------------------------
+//
+//  dfa_table_matcher: the run time for @regex<dfa> - a deterministic
+//  table-driven matcher over tables computed at metafunction time.
+//
+//  The tables arrive as fixed_string template arguments: 'classes'
+//  maps each input byte to a character-equivalence class, 'edges'
+//  holds nstates x nclasses successor entries, each encoded in two
+//  little-endian bytes with a +1 offset (0 means no transition), and
+//  'accept' marks the accepting states with '1'. Matching is
+//  leftmost-longest: scan while transitions exist and remember the
+//  last accepting position.
+//
+//-----------------------------------------------------------------------
+//
+template<
+                  int nstates, 
+                  int nclasses, 
+                  string_util::fixed_string pattern, 
+                  string_util::fixed_string classes, 
+                  string_util::fixed_string edges, 
+                  string_util::fixed_string accept, 
+    bool anchor_start, 
+    bool           anchor_end
+    > class dfa_table_matcher
+ {
+    public: template<typename Iter, typename CharT> class wrap
+     {
+        public: using context = match_context<CharT,Iter,1>;
+
+        public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> match_return<Iter>;
+
+#line 864 "cpp2regex.h2"
+        public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+        public: wrap() = default;
+        public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(wrap const&) -> void = delete;
+
+#line 865 "cpp2regex.h2"
+    };
+
+    //  The DFA handles start anchoring itself; exposing it here lets
+    //  'search' stop after one attempt instead of retrying every offset.
+    public: using prefilter = cpp2::regex::prefilter<"",anchor_start>;
+
+    //  stream_match: resumable whole-subject matching for input that
+    //  arrives in pieces. Feed each chunk as it comes in - only the
+    //  automaton state carries across calls, so chunks can live in a
+    //  ring buffer and nothing is copied or concatenated. 'matches'
+    //  reports whether everything consumed so far forms a complete
+    //  match of the pattern.
+    //
+    public: class stream_match
+     {
+        private: int state {0}; 
+        private: bool dead {false}; 
+
+        //  Consume one chunk. Returns false once no extension of the
+        //  input can match anymore, so callers may stop feeding early.
+        public: [[nodiscard]] auto feed(cpp2::impl::in<std::string_view> chunk) & -> bool;
+
+#line 908 "cpp2regex.h2"
+        public: [[nodiscard]] auto matches() const& -> bool;
+        public: stream_match() = default;
+        public: stream_match(stream_match const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(stream_match const&) -> void = delete;
+
+
+#line 912 "cpp2regex.h2"
+    };
+
+    public: [[nodiscard]] static auto to_string() -> std::string;
+    public: dfa_table_matcher() = default;
+    public: dfa_table_matcher(dfa_table_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(dfa_table_matcher const&) -> void = delete;
+
+#line 915 "cpp2regex.h2"
+};
+
+#line 918 "cpp2regex.h2"
+//-----------------------------------------------------------------------
+//
+//  onepass_class: character-set membership test for @regex<onepass>.
+//
+//  The straight-line matchers that mode generates test each input byte
+//  against a fixed character set; 'table' holds that set as 256 bytes of
+//  '0' / '1', indexed by the byte value - the same flat encoding the DFA
+//  tables above use, so the test is one load and one compare.
+//
+//-----------------------------------------------------------------------
+//
+template<string_util::fixed_string table> class onepass_class
+ {
+    public: template<typename CharT> [[nodiscard]] static auto includes(CharT const& c) -> bool;
+    public: onepass_class() = default;
+    public: onepass_class(onepass_class const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(onepass_class const&) -> void = delete;
+
+
+#line 935 "cpp2regex.h2"
+};
+
+#line 938 "cpp2regex.h2"
+//-----------------------------------------------------------------------
+//
+//  regex_set_result: which patterns of a @regex_set matched, as a
+//  bitmask over the pattern indices in declaration order.
+//
+//-----------------------------------------------------------------------
+//
+template<int npatterns> class regex_set_result
+ {
+    public: std::array<cpp2::u8,(npatterns + 7) / CPP2_ASSERT_NOT_ZERO_LITERAL(CPP2_TYPEOF((npatterns + 7)),8)> mask {}; 
+
+    public: explicit regex_set_result();
+    public: regex_set_result(regex_set_result const& that);
+#line 950 "cpp2regex.h2"
+    public: auto operator=(regex_set_result const& that) -> regex_set_result& ;
+#line 950 "cpp2regex.h2"
+    public: regex_set_result(regex_set_result&& that) noexcept;
+#line 950 "cpp2regex.h2"
+    public: auto operator=(regex_set_result&& that) noexcept -> regex_set_result& ;
+
+    public: [[nodiscard]] auto size() const& -> int;
+
+    public: [[nodiscard]] auto matched(cpp2::impl::in<int> p) const& -> bool;
+
+#line 959 "cpp2regex.h2"
+    public: [[nodiscard]] auto count() const& -> int;
+
+#line 970 "cpp2regex.h2"
+};
+
+#line 973 "cpp2regex.h2"
+//-----------------------------------------------------------------------
+//
+//  regex_set_table: the run time for @regex_set - one combined
+//  automaton over all the patterns of the set, built and serialized by
+//  the metafunction.
+//
+//  'classes' and 'edges' use the same encoding as dfa_table_matcher
+//  above. 'accept_any' and 'accept_end' hold one pattern bitmask per
+//  state: the patterns with a match ending in that state at any
+//  position, and the ones that additionally require end-of-subject.
+//  One scan visits each state in turn, OR-ing in its mask as it goes,
+//  so the cost is O(length) no matter how many patterns are in the set.
+//
+//-----------------------------------------------------------------------
+//
+template<
+    int npatterns, 
+    int         nstates, 
+    int         nclasses, 
+                string_util::fixed_string classes, 
+                string_util::fixed_string edges, 
+    string_util::fixed_string accept_any, 
+    string_util::fixed_string accept_end
+    > class regex_set_table
+ {
+    public: [[nodiscard]] static auto scan(cpp2::impl::in<std::string_view> subject) -> regex_set_result<npatterns>;
+
+#line 1005 "cpp2regex.h2"
+    //  scanner: the resumable form of 'scan' for input that arrives in
+    //  pieces. Feed each chunk as it comes in - the automaton state and
+    //  the result mask carry across calls, so matches spanning chunk
+    //  boundaries are found without copying the pieces together. Call
+    //  finish() when the stream ends to account for the end-anchored
+    //  patterns.
+    //
+    public: class scanner
+     {
+        public: regex_set_result<npatterns> result {}; 
+
+        private: int state {0}; 
+        private: bool dead {false}; 
+
+        public: explicit scanner();
+
+#line 1028 "cpp2regex.h2"
+        //  Consume one chunk. Returns false once every live position
+        //  has died - no pattern can still produce a new match, so
+        //  callers may stop feeding early.
+        public: [[nodiscard]] auto feed(cpp2::impl::in<std::string_view> chunk) & -> bool;
+
+#line 1059 "cpp2regex.h2"
+        //  The result as of the end of the stream: everything matched
+        //  so far, plus the end-anchored patterns accepting right here.
+        //  A const query, so feeding can continue after peeking at it.
+        public: [[nodiscard]] auto finish() const& -> regex_set_result<npatterns>;
+        public: scanner(scanner const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(scanner const&) -> void = delete;
+
+
+#line 1074 "cpp2regex.h2"
+    };
+
+    public: regex_set_table() = default;
+    public: regex_set_table(regex_set_table const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(regex_set_table const&) -> void = delete;
+};
+#line 1076 "cpp2regex.h2"
+
+#line 1078 "cpp2regex.h2"
 //-----------------------------------------------------------------------
 //
 //  Regular expression implementation.
@@ -571,6 +888,28 @@ template<typename CharT, typename matcher_wrapper> class regular_expression
     public: template<typename Iter> using matcher = matcher_wrapper_type<matcher_wrapper,Iter,CharT>;// TODO: Remove when nested types are allowed: https://github.com/hsutter/cppfront/issues/727
     public: template<typename Iter> using context = matcher_context_type<matcher<Iter>>;// TODO: Remove when nested types are allowed: https://github.com/hsutter/cppfront/issues/727
 
+    //  Backtracking budget applied to every match/search started from
+    //  this object: -1 is unlimited. See with_step_limit below, and
+    //  match_context.steps_remaining for what a step is.
+    public: cpp2::i64 max_steps {-1}; 
+
+    public: explicit regular_expression();
+    public: regular_expression(regular_expression const& that);
+#line 1097 "cpp2regex.h2"
+    public: auto operator=(regular_expression const& that) -> regular_expression& ;
+#line 1097 "cpp2regex.h2"
+    public: regular_expression(regular_expression&& that) noexcept;
+#line 1097 "cpp2regex.h2"
+    public: auto operator=(regular_expression&& that) noexcept -> regular_expression& ;
+
+    //  Returns a copy of this regular expression whose matches fail once
+    //  they have spent 'limit' backtracking steps. A limit proportional
+    //  to the subject length gives a linear worst case on patterns that
+    //  would otherwise backtrack exponentially; a match that genuinely
+    //  needs more backtracking than the limit reports "no match".
+    public: [[nodiscard]] auto with_step_limit(cpp2::impl::in<cpp2::i64> limit) const& -> regular_expression;
+
+#line 1110 "cpp2regex.h2"
     public: template<typename Iter> class search_return
      {
         public: bool matched; 
@@ -579,13 +918,15 @@ template<typename CharT, typename matcher_wrapper> class regular_expression
 
         public: search_return(cpp2::impl::in<bool> matched_, context<Iter> const& ctx_, Iter const& pos_);
 
-#line 690 "cpp2regex.h2"
+#line 1122 "cpp2regex.h2"
         public: [[nodiscard]] auto group_number() const& -> decltype(auto);
         public: [[nodiscard]] auto group(cpp2::impl::in<int> g) const& -> decltype(auto);
+        public: [[nodiscard]] auto group_view(cpp2::impl::in<int> g) const& -> decltype(auto);
         public: [[nodiscard]] auto group_start(cpp2::impl::in<int> g) const& -> decltype(auto);
         public: [[nodiscard]] auto group_end(cpp2::impl::in<int> g) const& -> decltype(auto);
 
         public: [[nodiscard]] auto group(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto);
+        public: [[nodiscard]] auto group_view(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto);
         public: [[nodiscard]] auto group_start(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto);
         public: [[nodiscard]] auto group_end(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto);
 
@@ -594,7 +935,46 @@ template<typename CharT, typename matcher_wrapper> class regular_expression
         public: auto operator=(search_return const&) -> void = delete;
 
 
-#line 706 "cpp2regex.h2"
+#line 1140 "cpp2regex.h2"
+    };
+
+    //  Cursor over successive non-overlapping matches in one subject.
+    //  The context - and with it the capture buffer - is set up once and
+    //  reused for every match, so iterating allocates nothing as long as
+    //  callers read captures through the group_view accessors.
+    public: template<typename Iter> class search_all_return
+     {
+        public: context<Iter> ctx; 
+
+        private: Iter cur; 
+        private: bool done {false}; 
+        private: cpp2::i64 max_steps {-1}; 
+
+        public: search_all_return(Iter const& start, Iter const& end, cpp2::impl::in<cpp2::i64> max_steps_);
+
+#line 1160 "cpp2regex.h2"
+        //  Advance to the next match. Returns false when there is none;
+        //  the group accessors stay valid until the next call.
+        public: [[nodiscard]] auto next() & -> bool;
+
+#line 1194 "cpp2regex.h2"
+        public: [[nodiscard]] auto group_number() const& -> decltype(auto);
+        public: [[nodiscard]] auto group(cpp2::impl::in<int> g) const& -> decltype(auto);
+        public: [[nodiscard]] auto group_view(cpp2::impl::in<int> g) const& -> decltype(auto);
+        public: [[nodiscard]] auto group_start(cpp2::impl::in<int> g) const& -> decltype(auto);
+        public: [[nodiscard]] auto group_end(cpp2::impl::in<int> g) const& -> decltype(auto);
+
+        public: [[nodiscard]] auto group(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto);
+        public: [[nodiscard]] auto group_view(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto);
+        public: [[nodiscard]] auto group_start(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto);
+        public: [[nodiscard]] auto group_end(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto);
+
+        private: [[nodiscard]] auto get_group_id(cpp2::impl::in<bstring<CharT>> g) const& -> auto;
+        public: search_all_return(search_all_return const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(search_all_return const&) -> void = delete;
+
+
+#line 1212 "cpp2regex.h2"
     };
 
     public: [[nodiscard]] auto match(cpp2::impl::in<bview<CharT>> str) const& -> decltype(auto);
@@ -602,24 +982,25 @@ template<typename CharT, typename matcher_wrapper> class regular_expression
     public: [[nodiscard]] auto match(cpp2::impl::in<bview<CharT>> str, auto const& start, auto const& length) const& -> decltype(auto);
     public: template<typename Iter> [[nodiscard]] auto match(Iter const& start, Iter const& end) const& -> search_return<Iter>;
 
-#line 719 "cpp2regex.h2"
+#line 1226 "cpp2regex.h2"
     public: [[nodiscard]] auto search(cpp2::impl::in<bview<CharT>> str) const& -> decltype(auto);
     public: [[nodiscard]] auto search(cpp2::impl::in<bview<CharT>> str, auto const& start) const& -> decltype(auto);
     public: [[nodiscard]] auto search(cpp2::impl::in<bview<CharT>> str, auto const& start, auto const& length) const& -> decltype(auto);
     public: template<typename Iter> [[nodiscard]] auto search(Iter const& start, Iter const& end) const& -> search_return<Iter>;
 
-#line 742 "cpp2regex.h2"
+#line 1250 "cpp2regex.h2"
+    public: [[nodiscard]] auto search_all(cpp2::impl::in<bview<CharT>> str) const& -> decltype(auto);
+    public: [[nodiscard]] auto search_all(cpp2::impl::in<bview<CharT>> str, auto const& start) const& -> decltype(auto);
+    public: [[nodiscard]] auto search_all(cpp2::impl::in<bview<CharT>> str, auto const& start, auto const& length) const& -> decltype(auto);
+    public: template<typename Iter> [[nodiscard]] auto search_all(Iter const& start, Iter const& end) const& -> search_all_return<Iter>;
+
     public: [[nodiscard]] auto to_string() const& -> decltype(auto);
 
     //  Helper functions
     //
     private: [[nodiscard]] static auto get_iter(cpp2::impl::in<bview<CharT>> str, auto const& pos) -> auto;
-    public: regular_expression() = default;
-    public: regular_expression(regular_expression const&) = delete; /* No 'that' constructor, suppress copy */
-    public: auto operator=(regular_expression const&) -> void = delete;
-
 
-#line 754 "cpp2regex.h2"
+#line 1267 "cpp2regex.h2"
 };
 
 }
@@ -631,7 +1012,7 @@ template<typename CharT, typename matcher_wrapper> class regular_expression
 
 #line 1 "cpp2regex.h2"
 
-#line 22 "cpp2regex.h2"
+#line 59 "cpp2regex.h2"
 namespace cpp2 {
 
 namespace regex {
@@ -646,55 +1027,55 @@ template <typename Iter> match_return<Iter>::match_return(auto const& matched_,
                                                          , pos{ pos_ }{}
 template <typename Iter> match_return<Iter>::match_return(){}
 
-#line 63 "cpp2regex.h2"
+#line 100 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> match_context<CharT,Iter,max_groups>::match_context(Iter const& begin_, Iter const& end_)
         : begin{ begin_ }
         , end{ end_ }{
 
-#line 66 "cpp2regex.h2"
+#line 103 "cpp2regex.h2"
     }
 
-#line 68 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> match_context<CharT,Iter,max_groups>::match_context(match_context const& that)
                                    : begin{ that.begin }
                                    , end{ that.end }
-                                   , groups{ that.groups }{}
-#line 68 "cpp2regex.h2"
+                                   , groups{ that.groups }
+                                   , steps_remaining{ that.steps_remaining }{}
+#line 105 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> auto match_context<CharT,Iter,max_groups>::operator=(match_context const& that) -> match_context& {
                                    begin = that.begin;
                                    end = that.end;
                                    groups = that.groups;
+                                   steps_remaining = that.steps_remaining;
                                    return *this; }
-#line 68 "cpp2regex.h2"
+#line 105 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> match_context<CharT,Iter,max_groups>::match_context(match_context&& that) noexcept
                                    : begin{ std::move(that).begin }
                                    , end{ std::move(that).end }
-                                   , groups{ std::move(that).groups }{}
-#line 68 "cpp2regex.h2"
+                                   , groups{ std::move(that).groups }
+                                   , steps_remaining{ std::move(that).steps_remaining }{}
+#line 105 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> auto match_context<CharT,Iter,max_groups>::operator=(match_context&& that) noexcept -> match_context& {
                                    begin = std::move(that).begin;
                                    end = std::move(that).end;
                                    groups = std::move(that).groups;
+                                   steps_remaining = std::move(that).steps_remaining;
                                    return *this; }
 
-#line 72 "cpp2regex.h2"
+#line 109 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::get_group(auto const& group) const& -> decltype(auto) { return CPP2_ASSERT_IN_BOUNDS(groups, group);  }
 
-#line 74 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::get_group_end(auto const& group) const& -> int{
         if (cpp2::impl::cmp_greater_eq(group,max_groups) || !(CPP2_ASSERT_IN_BOUNDS(groups, group).matched)) {
             return 0; 
         }
         return cpp2::unchecked_narrow<int>(std::distance(begin, CPP2_ASSERT_IN_BOUNDS(groups, group).end)); 
     }
-#line 80 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::get_group_start(auto const& group) const& -> int{
         if (cpp2::impl::cmp_greater_eq(group,max_groups) || !(CPP2_ASSERT_IN_BOUNDS(groups, group).matched)) {
             return 0; 
         }
         return cpp2::unchecked_narrow<int>(std::distance(begin, CPP2_ASSERT_IN_BOUNDS(groups, group).start)); 
     }
-#line 86 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::get_group_string(auto const& group) const& -> std::string{
         if (cpp2::impl::cmp_greater_eq(group,max_groups) || !(CPP2_ASSERT_IN_BOUNDS(groups, group).matched)) {
             return ""; 
@@ -702,97 +1083,100 @@ template <typename Iter> match_return<Iter>::match_return(){}
         return std::string(CPP2_ASSERT_IN_BOUNDS(groups, group).start, CPP2_ASSERT_IN_BOUNDS(groups, group).end); 
     }
 
-#line 93 "cpp2regex.h2"
+#line 132 "cpp2regex.h2"
+    template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::get_group_view(auto const& group) const& -> std::basic_string_view<CharT>{
+        if (cpp2::impl::cmp_greater_eq(group,max_groups) || !(CPP2_ASSERT_IN_BOUNDS(groups, group).matched)) {
+            return std::basic_string_view<CharT>(); 
+        }
+        return std::basic_string_view<CharT>(CPP2_ASSERT_IN_BOUNDS(groups, group).start, CPP2_ASSERT_IN_BOUNDS(groups, group).end); 
+    }
+
     template <typename CharT, typename Iter, int max_groups> auto match_context<CharT,Iter,max_groups>::set_group_end(auto const& group, auto const& pos) & -> void{
         CPP2_ASSERT_IN_BOUNDS(groups, group).end = pos;
         CPP2_ASSERT_IN_BOUNDS(groups, group).matched = true;
     }
 
-#line 98 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> auto match_context<CharT,Iter,max_groups>::set_group_invalid(auto const& group) & -> void{
         CPP2_ASSERT_IN_BOUNDS(groups, group).matched = false;
     }
 
-#line 102 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> auto match_context<CharT,Iter,max_groups>::set_group_start(auto const& group, auto const& pos) & -> void{
         CPP2_ASSERT_IN_BOUNDS(groups, group).start = pos;
     }
 
-#line 106 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::size() const& -> decltype(auto) { return max_groups;  }
 
-#line 110 "cpp2regex.h2"
+#line 161 "cpp2regex.h2"
+    template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::count_step() & -> bool{
+        if (cpp2::impl::cmp_less(steps_remaining,0)) {return true; }
+        if (steps_remaining == 0) {return false; }
+        steps_remaining -= 1;
+        return true; 
+    }
+
+#line 170 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::fail() const& -> decltype(auto) { return match_return<Iter>(false, end); }
-#line 111 "cpp2regex.h2"
     template <typename CharT, typename Iter, int max_groups> [[nodiscard]] auto match_context<CharT,Iter,max_groups>::pass(cpp2::impl::in<Iter> cur) const& -> decltype(auto) { return match_return<Iter>(true, cur);  }
 
-#line 119 "cpp2regex.h2"
+#line 179 "cpp2regex.h2"
     [[nodiscard]] auto true_end_func::operator()(auto const& cur, auto& ctx) const& -> decltype(auto) { return ctx.pass(cur);  }
 
-#line 127 "cpp2regex.h2"
+#line 187 "cpp2regex.h2"
     auto no_reset::operator()([[maybe_unused]] auto& unnamed_param_2) const& -> void{}
 
-#line 136 "cpp2regex.h2"
+#line 196 "cpp2regex.h2"
     template <typename Func> on_return<Func>::on_return(Func const& f)
         : func{ f }{
 
-#line 138 "cpp2regex.h2"
+#line 198 "cpp2regex.h2"
     }
-#line 136 "cpp2regex.h2"
+#line 196 "cpp2regex.h2"
     template <typename Func> auto on_return<Func>::operator=(Func const& f) -> on_return& {
         func = f;
         return *this;
 
-#line 138 "cpp2regex.h2"
+#line 198 "cpp2regex.h2"
     }
 
-#line 140 "cpp2regex.h2"
     template <typename Func> on_return<Func>::~on_return() noexcept{
         cpp2::move(*this).func();
     }
 
-#line 147 "cpp2regex.h2"
+#line 207 "cpp2regex.h2"
 template<typename Func> [[nodiscard]] auto make_on_return(Func const& func) -> decltype(auto) { return on_return<Func>(func);  }
 
-#line 161 "cpp2regex.h2"
-    template <typename CharT, CharT C> [[nodiscard]] auto single_class_entry<CharT,C>::includes(cpp2::impl::in<CharT> c) -> decltype(auto) { return c == C;  }
-#line 162 "cpp2regex.h2"
+#line 221 "cpp2regex.h2"
+    template <typename CharT, CharT C> [[nodiscard]] constexpr auto single_class_entry<CharT,C>::includes(cpp2::impl::in<CharT> c) -> bool { return c == C;  }
     template <typename CharT, CharT C> [[nodiscard]] auto single_class_entry<CharT,C>::to_string() -> decltype(auto) { return bstring<CharT>(1, C); }
 
-#line 170 "cpp2regex.h2"
-    template <typename CharT, CharT Start, CharT End> [[nodiscard]] auto range_class_entry<CharT,Start,End>::includes(cpp2::impl::in<CharT> c) -> decltype(auto) { return [_0 = Start, _1 = c, _2 = End]{ return cpp2::impl::cmp_less_eq(_0,_1) && cpp2::impl::cmp_less_eq(_1,_2); }();  }
-#line 171 "cpp2regex.h2"
-    template <typename CharT, CharT Start, CharT End> [[nodiscard]] auto range_class_entry<CharT,Start,End>::to_string() -> decltype(auto) { return "" + cpp2::to_string(Start) + "-" + cpp2::to_string(End) + ""; }
+#line 230 "cpp2regex.h2"
+    template <typename CharT, CharT Start, CharT End> [[nodiscard]] constexpr auto range_class_entry<CharT,Start,End>::includes(cpp2::impl::in<CharT> c) -> bool { return [_0 = Start, _1 = c, _2 = End]{ return cpp2::impl::cmp_less_eq(_0,_1) && cpp2::impl::cmp_less_eq(_1,_2); }();  }
+    template <typename CharT, CharT Start, CharT End> [[nodiscard]] auto range_class_entry<CharT,Start,End>::to_string() -> decltype(auto) { return "" + cpp2::string_build(cpp2::to_string(Start), "-", cpp2::to_string(End)) + ""; }
 
-#line 179 "cpp2regex.h2"
-    template <typename CharT, typename ...List> [[nodiscard]] auto combined_class_entry<CharT,List...>::includes(cpp2::impl::in<CharT> c) -> decltype(auto) { return (false || ... || List::includes(c));  }
-#line 180 "cpp2regex.h2"
+#line 239 "cpp2regex.h2"
+    template <typename CharT, typename ...List> [[nodiscard]] constexpr auto combined_class_entry<CharT,List...>::includes(cpp2::impl::in<CharT> c) -> bool { return (false || ... || List::includes(c));  }
     template <typename CharT, typename ...List> [[nodiscard]] auto combined_class_entry<CharT,List...>::to_string() -> decltype(auto) { return (bstring<CharT>() + ... + List::to_string()); }
 
-#line 188 "cpp2regex.h2"
-    template <typename CharT, CharT ...List> [[nodiscard]] auto list_class_entry<CharT,List...>::includes(cpp2::impl::in<CharT> c) -> decltype(auto) { return (false || ... || (List == c));  }
-#line 189 "cpp2regex.h2"
+#line 248 "cpp2regex.h2"
+    template <typename CharT, CharT ...List> [[nodiscard]] constexpr auto list_class_entry<CharT,List...>::includes(cpp2::impl::in<CharT> c) -> bool { return (false || ... || (List == c));  }
     template <typename CharT, CharT ...List> [[nodiscard]] auto list_class_entry<CharT,List...>::to_string() -> decltype(auto) { return (bstring<CharT>() + ... + List); }
 
-#line 197 "cpp2regex.h2"
-    template <typename CharT, string_util::fixed_string Name, typename Inner> [[nodiscard]] auto named_class_entry<CharT,Name,Inner>::includes(cpp2::impl::in<CharT> c) -> decltype(auto) { return Inner::includes(c);  }
-#line 198 "cpp2regex.h2"
+#line 257 "cpp2regex.h2"
+    template <typename CharT, string_util::fixed_string Name, typename Inner> [[nodiscard]] constexpr auto named_class_entry<CharT,Name,Inner>::includes(cpp2::impl::in<CharT> c) -> bool { return Inner::includes(c);  }
     template <typename CharT, string_util::fixed_string Name, typename Inner> [[nodiscard]] auto named_class_entry<CharT,Name,Inner>::to_string() -> decltype(auto) { return "[:" + cpp2::to_string(Name.data()) + ":]"; }
 
-#line 205 "cpp2regex.h2"
-    template <typename CharT, typename Inner> [[nodiscard]] auto negated_class_entry<CharT,Inner>::includes(cpp2::impl::in<CharT> c) -> decltype(auto) { return !(Inner::includes(c));  }
+#line 265 "cpp2regex.h2"
+    template <typename CharT, typename Inner> [[nodiscard]] constexpr auto negated_class_entry<CharT,Inner>::includes(cpp2::impl::in<CharT> c) -> bool { return !(Inner::includes(c));  }
 
-#line 213 "cpp2regex.h2"
-    template <typename CharT, string_util::fixed_string Name, typename Inner> [[nodiscard]] auto shorthand_class_entry<CharT,Name,Inner>::includes(cpp2::impl::in<CharT> c) -> decltype(auto) { return Inner::includes(c);  }
-#line 214 "cpp2regex.h2"
+#line 273 "cpp2regex.h2"
+    template <typename CharT, string_util::fixed_string Name, typename Inner> [[nodiscard]] constexpr auto shorthand_class_entry<CharT,Name,Inner>::includes(cpp2::impl::in<CharT> c) -> bool { return Inner::includes(c);  }
     template <typename CharT, string_util::fixed_string Name, typename Inner> [[nodiscard]] auto shorthand_class_entry<CharT,Name,Inner>::to_string() -> decltype(auto) { return Name.str(); }
 
-#line 261 "cpp2regex.h2"
+#line 321 "cpp2regex.h2"
     template <typename CharT> [[nodiscard]] auto alternative_token_matcher<CharT>::match(auto const& cur, auto& ctx, auto const& end_func, auto const& tail, auto const& ...functions) -> auto{
         return match_first(cur, ctx, end_func, tail, functions...); 
     }
 
-#line 265 "cpp2regex.h2"
     template <typename CharT> template<typename ...Other> [[nodiscard]] auto alternative_token_matcher<CharT>::match_first(auto const& cur, auto& ctx, auto const& end_func, auto const& tail, auto const& cur_func, auto const& cur_reset, Other const& ...other) -> auto
     {
         auto inner_call {[_0 = (tail), _1 = (end_func)](auto const& tail_cur, auto& tail_ctx) -> auto{
@@ -812,7 +1196,7 @@ template<typename Func> [[nodiscard]] auto make_on_return(Func const& func) -> d
         }
     }
 
-#line 288 "cpp2regex.h2"
+#line 348 "cpp2regex.h2"
 template<typename CharT, bool single_line> [[nodiscard]] auto any_token_matcher(auto& cur, auto& ctx) -> bool
 {
     if ( cur != ctx.end                     // any char except the end
@@ -825,10 +1209,25 @@ template<typename CharT, bool single_line> [[nodiscard]] auto any_token_matcher(
     return false; 
 }
 
-#line 339 "cpp2regex.h2"
+#line 399 "cpp2regex.h2"
     template <typename CharT, bool negate, bool case_insensitive, typename ...List> [[nodiscard]] auto class_token_matcher<CharT,negate,case_insensitive,List...>::match(auto& cur, auto& ctx) -> bool
     {
-        if constexpr (case_insensitive) 
+        //  For narrow characters the whole test (entry list, case folding,
+        //  and negation) is baked into a 256-entry compile-time table, so
+        //  the match is a single indexed load.
+        if constexpr (std::is_same_v<CharT,char>) 
+        {
+            if ( cur != ctx.end 
+                && CPP2_ASSERT_IN_BOUNDS((class_table<CharT,negate,case_insensitive,List...>()), cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(*cpp2::impl::assert_not_null(cur))))) 
+            {
+                cur += 1;
+                return true; 
+            }
+            else {
+                return false; 
+            }
+        }
+        else {if constexpr (case_insensitive) 
         {
             if ( cur != ctx.end 
                 && negate != (
@@ -852,10 +1251,9 @@ template<typename CharT, bool single_line> [[nodiscard]] auto any_token_matcher(
             else {
                 return false; 
             }
-        }
+        }}
     }
 
-#line 368 "cpp2regex.h2"
     template <typename CharT, bool negate, bool case_insensitive, typename ...List> template<typename First, typename ...Other> [[nodiscard]] auto class_token_matcher<CharT,negate,case_insensitive,List...>::match_any(cpp2::impl::in<CharT> c) -> bool
     {
         bool r {First::includes(c)}; 
@@ -869,7 +1267,7 @@ template<typename CharT, bool single_line> [[nodiscard]] auto any_token_matcher(
         return r; 
     }
 
-#line 417 "cpp2regex.h2"
+#line 492 "cpp2regex.h2"
 template<typename CharT, int group, bool case_insensitive> [[nodiscard]] auto group_ref_token_matcher(auto& cur, auto& ctx) -> bool
 {
     auto g {ctx.get_group(group)}; 
@@ -900,7 +1298,7 @@ template<typename CharT, int group, bool case_insensitive> [[nodiscard]] auto gr
     }
 }
 
-#line 450 "cpp2regex.h2"
+#line 525 "cpp2regex.h2"
 template<typename CharT, bool match_new_line, bool match_new_line_before_end> [[nodiscard]] auto line_end_token_matcher(auto const& cur, auto& ctx) -> bool
 {
     if (cur == ctx.end || (match_new_line && *cpp2::impl::assert_not_null(cur) == '\n')) {
@@ -914,14 +1312,14 @@ template<typename CharT, bool match_new_line, bool match_new_line_before_end> [[
     }}
 }
 
-#line 466 "cpp2regex.h2"
+#line 541 "cpp2regex.h2"
 template<typename CharT, bool match_new_line> [[nodiscard]] auto line_start_token_matcher(auto const& cur, auto& ctx) -> bool
 {
     return cur == ctx.begin || // Start of string
            (match_new_line && *cpp2::impl::assert_not_null((cur - 1)) == '\n'); // Start of new line
 }
 
-#line 477 "cpp2regex.h2"
+#line 552 "cpp2regex.h2"
 template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_matcher(auto const& cur, auto& ctx, auto const& func) -> bool
 {
     auto r {func(cur, ctx, true_end_func())}; 
@@ -932,12 +1330,12 @@ template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_match
     return cpp2::move(r).matched; 
 }
 
-#line 493 "cpp2regex.h2"
+#line 568 "cpp2regex.h2"
     inline CPP2_CONSTEXPR int range_flags::not_greedy{ 1 };
     inline CPP2_CONSTEXPR int range_flags::greedy{ 2 };
     inline CPP2_CONSTEXPR int range_flags::possessive{ 3 };
 
-#line 504 "cpp2regex.h2"
+#line 579 "cpp2regex.h2"
     template <typename CharT, int min_count, int max_count, int kind> template<typename Iter> [[nodiscard]] auto range_token_matcher<CharT,min_count,max_count,kind>::match(Iter const& cur, auto& ctx, auto const& inner, auto const& reset_func, auto const& end_func, auto const& tail) -> auto
     {
         if (range_flags::possessive == kind) {
@@ -951,26 +1349,22 @@ template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_match
         }}
     }
 
-#line 517 "cpp2regex.h2"
     template <typename CharT, int min_count, int max_count, int kind> [[nodiscard]] auto range_token_matcher<CharT,min_count,max_count,kind>::is_below_upper_bound(cpp2::impl::in<int> count) -> bool{
         if (-1 == max_count) {return true; }
         else {return cpp2::impl::cmp_less(count,max_count); }
     }
 
-#line 522 "cpp2regex.h2"
     template <typename CharT, int min_count, int max_count, int kind> [[nodiscard]] auto range_token_matcher<CharT,min_count,max_count,kind>::is_below_lower_bound(cpp2::impl::in<int> count) -> bool{
         if (-1 == min_count) {return false; }
         else {return cpp2::impl::cmp_less(count,min_count); }
     }
 
-#line 527 "cpp2regex.h2"
     template <typename CharT, int min_count, int max_count, int kind> [[nodiscard]] auto range_token_matcher<CharT,min_count,max_count,kind>::is_in_range(cpp2::impl::in<int> count) -> bool{
         if (-1 != min_count && cpp2::impl::cmp_less(count,min_count)) {return false; }
         if (-1 != max_count && cpp2::impl::cmp_greater(count,max_count)) {return false; }
         return true; 
     }
 
-#line 533 "cpp2regex.h2"
     template <typename CharT, int min_count, int max_count, int kind> template<typename Iter> [[nodiscard]] auto range_token_matcher<CharT,min_count,max_count,kind>::match_min_count(Iter const& cur, auto& ctx, auto const& inner, auto const& end_func, int& count_r) -> auto
     {   // TODO: count_r as out parameter introduces a performance loss.
         auto res {ctx.pass(cur)}; 
@@ -987,9 +1381,14 @@ template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_match
         return res; 
     }
 
-#line 549 "cpp2regex.h2"
     template <typename CharT, int min_count, int max_count, int kind> template<typename Iter> [[nodiscard]] auto range_token_matcher<CharT,min_count,max_count,kind>::match_greedy(cpp2::impl::in<int> count, Iter const& cur, Iter const& last_valid, auto& ctx, auto const& inner, auto const& reset_func, auto const& end_func, auto const& other) -> match_return<Iter>
     {
+        //  Every greedy attempt spends one step of the backtracking
+        //  budget - see match_context.steps_remaining
+        if (!(ctx.count_step())) {
+            return ctx.fail(); 
+        }
+
         auto inner_call {[_0 = (count + 1), _1 = (cur), _2 = (inner), _3 = (reset_func), _4 = (end_func), _5 = (other)](auto const& tail_cur, auto& tail_ctx) -> auto{
             return match_greedy(_0, tail_cur, _1, tail_ctx, _2, _3, _4, _5); 
         }}; 
@@ -1018,7 +1417,6 @@ template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_match
         return r; 
     }
 
-#line 579 "cpp2regex.h2"
     template <typename CharT, int min_count, int max_count, int kind> template<typename Iter> [[nodiscard]] auto range_token_matcher<CharT,min_count,max_count,kind>::match_possessive(Iter const& cur, auto& ctx, auto const& inner, auto const& end_func, auto const& other) -> match_return<Iter>
     {
         auto count {0}; 
@@ -1047,7 +1445,6 @@ template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_match
         return other(cpp2::move(pos), ctx, end_func); 
     }
 
-#line 607 "cpp2regex.h2"
     template <typename CharT, int min_count, int max_count, int kind> template<typename Iter> [[nodiscard]] auto range_token_matcher<CharT,min_count,max_count,kind>::match_not_greedy(Iter const& cur, auto& ctx, auto const& inner, auto const& end_func, auto const& other) -> match_return<Iter>
     {
         auto count {0}; 
@@ -1059,6 +1456,11 @@ template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_match
         auto pos {cpp2::move(start).pos}; 
         while( is_below_upper_bound(count) ) 
         {
+            //  Each lazy retry spends one step of the backtracking budget
+            if (!(ctx.count_step())) {
+                return ctx.fail(); 
+            }
+
             auto o {other(pos, ctx, end_func)}; 
             if (o.matched) {
                 return o; 
@@ -1075,7 +1477,7 @@ template<typename CharT, bool positive> [[nodiscard]] auto lookahead_token_match
         return other(cpp2::move(pos), ctx, end_func); // Upper bound reached.
     }
 
-#line 640 "cpp2regex.h2"
+#line 726 "cpp2regex.h2"
 template<typename CharT, bool negate> [[nodiscard]] auto word_boundary_token_matcher(auto& cur, auto& ctx) -> bool
 {
     word_class<CharT> words {}; 
@@ -1100,32 +1502,250 @@ template<typename CharT, bool negate> [[nodiscard]] auto word_boundary_token_mat
     return is_match; 
 }
 
-#line 684 "cpp2regex.h2"
+#line 770 "cpp2regex.h2"
+    template <string_util::fixed_string prefix, bool anchored> template<typename Iter> [[nodiscard]] auto prefilter<prefix,anchored>::find(Iter const& cur, Iter const& begin, Iter const& end) -> Iter
+    {
+        if (anchored) {
+            if (cur == begin) {
+                return cur; 
+            }
+            return end; 
+        }
+
+        if (cpp2::impl::cmp_greater(CPP2_UFCS(size)(prefix),0u)) {
+            auto pos {cur}; 
+            while( true ) {
+                pos = std::find(pos, end, CPP2_ASSERT_IN_BOUNDS_LITERAL(prefix.c_str, 0));
+                if (cpp2::impl::cmp_less(cpp2::unchecked_narrow<size_t>(std::distance(pos, end)),CPP2_UFCS(size)(prefix))) {
+                    return end; 
+                }
+                if (std::equal(prefix.c_str, prefix.c_str + CPP2_UFCS(size)(prefix), pos)) {
+                    return pos; 
+                }
+                ++pos;
+            }
+        }
+
+        return cur; 
+    }
+
+#line 828 "cpp2regex.h2"
+        template <int nstates, int nclasses, string_util::fixed_string pattern, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept, bool anchor_start, bool anchor_end> template <typename Iter, typename CharT> [[nodiscard]] auto dfa_table_matcher<nstates,nclasses,pattern,classes,edges,accept,anchor_start,anchor_end>::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> match_return<Iter>
+        {
+            if (anchor_start && cur != ctx.begin) {
+                return match_return<Iter>(false, cur); 
+            }
+            ctx.set_group_start(0, cur);
+
+            auto state {0}; 
+            auto pos {cur}; 
+            auto best {cur}; 
+            auto matched {CPP2_ASSERT_IN_BOUNDS_LITERAL(accept.c_str, 0) == '1' && (!(anchor_end) || cur == ctx.end)}; 
+
+            while( pos != ctx.end ) {
+                auto cls {cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(classes.c_str, cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(*cpp2::impl::assert_not_null(pos))))))}; 
+                auto e {(state * nclasses + cpp2::move(cls)) * 2}; 
+                auto next {(cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(edges.c_str, e)))) 
+                        + (cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(edges.c_str, e + 1)))) * 256 
+                        - 1}; 
+                if (next == -1) {
+                    break;
+                }
+                state = cpp2::move(next);
+                ++pos;
+                if (CPP2_ASSERT_IN_BOUNDS(accept.c_str, state) == '1' && (!(anchor_end) || pos == ctx.end)) {
+                    matched = true;
+                    best    = pos;
+                }
+            }
+
+            if (cpp2::move(matched)) {
+                ctx.set_group_end(0, best);
+                return match_return<Iter>(true, cpp2::move(best)); 
+            }
+            return match_return<Iter>(false, cur); 
+        }
+
+        template <int nstates, int nclasses, string_util::fixed_string pattern, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept, bool anchor_start, bool anchor_end> template <typename Iter, typename CharT> [[nodiscard]] auto dfa_table_matcher<nstates,nclasses,pattern,classes,edges,accept,anchor_start,anchor_end>::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{static_cast<void>(name); return -1; }
+
+#line 885 "cpp2regex.h2"
+        template <int nstates, int nclasses, string_util::fixed_string pattern, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept, bool anchor_start, bool anchor_end> [[nodiscard]] auto dfa_table_matcher<nstates,nclasses,pattern,classes,edges,accept,anchor_start,anchor_end>::stream_match::feed(cpp2::impl::in<std::string_view> chunk) & -> bool
+        {
+            if (dead) {
+                return false; 
+            }
+            auto pos {0}; 
+            auto len {cpp2::unchecked_narrow<int>(chunk.size())}; 
+            while( cpp2::impl::cmp_less(pos,len) ) {
+                auto cls {cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(classes.c_str, cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(chunk, pos))))))}; 
+                auto e {(state * nclasses + cpp2::move(cls)) * 2}; 
+                auto next_state {(cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(edges.c_str, e)))) 
+                              + (cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(edges.c_str, e + 1)))) * 256 
+                              - 1}; 
+                if (next_state == -1) {
+                    dead = true;
+                    return false; 
+                }
+                state = cpp2::move(next_state);
+                ++pos;
+            }
+            return true; 
+        }
+
+        template <int nstates, int nclasses, string_util::fixed_string pattern, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept, bool anchor_start, bool anchor_end> [[nodiscard]] auto dfa_table_matcher<nstates,nclasses,pattern,classes,edges,accept,anchor_start,anchor_end>::stream_match::matches() const& -> bool
+        {
+            return !(dead) && CPP2_ASSERT_IN_BOUNDS(accept.c_str, state) == '1'; 
+        }
+
+#line 914 "cpp2regex.h2"
+    template <int nstates, int nclasses, string_util::fixed_string pattern, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept, bool anchor_start, bool anchor_end> [[nodiscard]] auto dfa_table_matcher<nstates,nclasses,pattern,classes,edges,accept,anchor_start,anchor_end>::to_string() -> std::string { return CPP2_UFCS(str)(pattern);  }
+
+#line 931 "cpp2regex.h2"
+    template <string_util::fixed_string table> template<typename CharT> [[nodiscard]] auto onepass_class<table>::includes(CharT const& c) -> bool
+    {
+        return CPP2_ASSERT_IN_BOUNDS(table.c_str, cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(c))) == '1'; 
+    }
+
+#line 949 "cpp2regex.h2"
+    template <int npatterns> regex_set_result<npatterns>::regex_set_result(){}
+    template <int npatterns> regex_set_result<npatterns>::regex_set_result(regex_set_result const& that)
+                                   : mask{ that.mask }{}
+#line 950 "cpp2regex.h2"
+    template <int npatterns> auto regex_set_result<npatterns>::operator=(regex_set_result const& that) -> regex_set_result& {
+                                   mask = that.mask;
+                                   return *this; }
+#line 950 "cpp2regex.h2"
+    template <int npatterns> regex_set_result<npatterns>::regex_set_result(regex_set_result&& that) noexcept
+                                   : mask{ std::move(that).mask }{}
+#line 950 "cpp2regex.h2"
+    template <int npatterns> auto regex_set_result<npatterns>::operator=(regex_set_result&& that) noexcept -> regex_set_result& {
+                                   mask = std::move(that).mask;
+                                   return *this; }
+
+#line 952 "cpp2regex.h2"
+    template <int npatterns> [[nodiscard]] auto regex_set_result<npatterns>::size() const& -> int { return npatterns;  }
+
+    template <int npatterns> [[nodiscard]] auto regex_set_result<npatterns>::matched(cpp2::impl::in<int> p) const& -> bool
+    {
+        return (CPP2_ASSERT_IN_BOUNDS(mask, p / CPP2_ASSERT_NOT_ZERO_LITERAL(CPP2_TYPEOF(p),8)) & cpp2::unchecked_narrow<cpp2::u8>(1 << (p % 8))) != 0; 
+    }
+
+    template <int npatterns> [[nodiscard]] auto regex_set_result<npatterns>::count() const& -> int
+    {
+        auto ret {0}; 
+        auto p {0}; 
+        for( ; cpp2::impl::cmp_less(p,npatterns); ++p ) {
+            if (matched(p)) {
+                ++ret;
+            }
+        }
+        return ret; 
+    }
+
+#line 998 "cpp2regex.h2"
+    template <int npatterns, int nstates, int nclasses, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept_any, string_util::fixed_string accept_end> [[nodiscard]] auto regex_set_table<npatterns,nstates,nclasses,classes,edges,accept_any,accept_end>::scan(cpp2::impl::in<std::string_view> subject) -> regex_set_result<npatterns>
+    {
+        scanner s {}; 
+        static_cast<void>(s.feed(subject));
+        return cpp2::move(s).finish(); 
+    }
+
+#line 1019 "cpp2regex.h2"
+        template <int npatterns, int nstates, int nclasses, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept_any, string_util::fixed_string accept_end> regex_set_table<npatterns,nstates,nclasses,classes,edges,accept_any,accept_end>::scanner::scanner()
+        {
+            //  Patterns that match empty accept before any input
+            auto b {0}; 
+            for( ; cpp2::impl::cmp_less(b,(npatterns + 7) / CPP2_ASSERT_NOT_ZERO_LITERAL(CPP2_TYPEOF((npatterns + 7)),8)); ++b ) {
+                CPP2_ASSERT_IN_BOUNDS(result.mask, b) |= cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(accept_any.c_str, b));
+            }
+        }
+
+#line 1031 "cpp2regex.h2"
+        template <int npatterns, int nstates, int nclasses, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept_any, string_util::fixed_string accept_end> [[nodiscard]] auto regex_set_table<npatterns,nstates,nclasses,classes,edges,accept_any,accept_end>::scanner::feed(cpp2::impl::in<std::string_view> chunk) & -> bool
+        {
+            if (dead) {
+                return false; 
+            }
+            auto nbytes {(npatterns + 7) / CPP2_ASSERT_NOT_ZERO_LITERAL(CPP2_TYPEOF((npatterns + 7)),8)}; 
+            auto pos {0}; 
+            auto len {cpp2::unchecked_narrow<int>(chunk.size())}; 
+            while( cpp2::impl::cmp_less(pos,len) ) {
+                auto cls {cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(classes.c_str, cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(chunk, pos))))))}; 
+                auto e {(state * nclasses + cpp2::move(cls)) * 2}; 
+                auto next_state {(cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(edges.c_str, e)))) 
+                              + (cpp2::impl::as_<int>(cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(edges.c_str, e + 1)))) * 256 
+                              - 1}; 
+                if (next_state == -1) {
+                    dead = true;
+                    return false; 
+                }
+                state = cpp2::move(next_state);
+                ++pos;
+                auto b {0}; 
+                for( ; cpp2::impl::cmp_less(b,nbytes); ++b ) {
+                    CPP2_ASSERT_IN_BOUNDS(result.mask, b) |= cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(accept_any.c_str, state * nbytes + b));
+                }
+            }
+            return true; 
+        }
+
+#line 1062 "cpp2regex.h2"
+        template <int npatterns, int nstates, int nclasses, string_util::fixed_string classes, string_util::fixed_string edges, string_util::fixed_string accept_any, string_util::fixed_string accept_end> [[nodiscard]] auto regex_set_table<npatterns,nstates,nclasses,classes,edges,accept_any,accept_end>::scanner::finish() const& -> regex_set_result<npatterns>
+        {
+            auto ret {result}; 
+            if (!(dead)) {
+                auto nbytes {(npatterns + 7) / CPP2_ASSERT_NOT_ZERO_LITERAL(CPP2_TYPEOF((npatterns + 7)),8)}; 
+                auto b {0}; 
+                for( ; cpp2::impl::cmp_less(b,nbytes); ++b ) {
+                    CPP2_ASSERT_IN_BOUNDS(ret.mask, b) |= cpp2::unchecked_narrow<cpp2::u8>(CPP2_ASSERT_IN_BOUNDS(accept_end.c_str, state * nbytes + b));
+                }
+            }
+            return ret; 
+        }
+
+#line 1096 "cpp2regex.h2"
+    template <typename CharT, typename matcher_wrapper> regular_expression<CharT,matcher_wrapper>::regular_expression(){}
+    template <typename CharT, typename matcher_wrapper> regular_expression<CharT,matcher_wrapper>::regular_expression(regular_expression const& that)
+                                   : max_steps{ that.max_steps }{}
+#line 1097 "cpp2regex.h2"
+    template <typename CharT, typename matcher_wrapper> auto regular_expression<CharT,matcher_wrapper>::operator=(regular_expression const& that) -> regular_expression& {
+                                   max_steps = that.max_steps;
+                                   return *this; }
+#line 1097 "cpp2regex.h2"
+    template <typename CharT, typename matcher_wrapper> regular_expression<CharT,matcher_wrapper>::regular_expression(regular_expression&& that) noexcept
+                                   : max_steps{ std::move(that).max_steps }{}
+#line 1097 "cpp2regex.h2"
+    template <typename CharT, typename matcher_wrapper> auto regular_expression<CharT,matcher_wrapper>::operator=(regular_expression&& that) noexcept -> regular_expression& {
+                                   max_steps = std::move(that).max_steps;
+                                   return *this; }
+
+#line 1104 "cpp2regex.h2"
+    template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::with_step_limit(cpp2::impl::in<cpp2::i64> limit) const& -> regular_expression{
+        auto ret {regular_expression()}; 
+        ret.max_steps = limit;
+        return ret; 
+    }
+
+#line 1116 "cpp2regex.h2"
         template <typename CharT, typename matcher_wrapper> template <typename Iter> regular_expression<CharT,matcher_wrapper>::search_return<Iter>::search_return(cpp2::impl::in<bool> matched_, context<Iter> const& ctx_, Iter const& pos_)
             : matched{ matched_ }
             , ctx{ ctx_ }
             , pos{ cpp2::unchecked_narrow<int>(std::distance(ctx_.begin, pos_)) }{
 
-#line 688 "cpp2regex.h2"
+#line 1120 "cpp2regex.h2"
         }
 
-#line 690 "cpp2regex.h2"
         template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group_number() const& -> decltype(auto) { return ctx.size(); }
-#line 691 "cpp2regex.h2"
         template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group(cpp2::impl::in<int> g) const& -> decltype(auto) { return ctx.get_group_string(g); }
-#line 692 "cpp2regex.h2"
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group_view(cpp2::impl::in<int> g) const& -> decltype(auto) { return ctx.get_group_view(g); }
         template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group_start(cpp2::impl::in<int> g) const& -> decltype(auto) { return ctx.get_group_start(g); }
-#line 693 "cpp2regex.h2"
         template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group_end(cpp2::impl::in<int> g) const& -> decltype(auto) { return ctx.get_group_end(g); }
 
-#line 695 "cpp2regex.h2"
         template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto) { return group(get_group_id(g)); }
-#line 696 "cpp2regex.h2"
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group_view(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto) { return group_view(get_group_id(g)); }
         template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group_start(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto) { return group_start(get_group_id(g)); }
-#line 697 "cpp2regex.h2"
         template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::group_end(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto) { return group_end(get_group_id(g)); }
 
-#line 699 "cpp2regex.h2"
         template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_return<Iter>::get_group_id(cpp2::impl::in<bstring<CharT>> g) const& -> auto{
             auto group_id {matcher<Iter>::get_named_group_index(g)}; 
             if (-1 == group_id) {
@@ -1134,35 +1754,91 @@ template<typename CharT, bool negate> [[nodiscard]] auto word_boundary_token_mat
             return group_id; 
         }
 
-#line 708 "cpp2regex.h2"
+#line 1154 "cpp2regex.h2"
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::search_all_return(Iter const& start, Iter const& end, cpp2::impl::in<cpp2::i64> max_steps_)
+            : ctx{ start, end }
+            , cur{ start }
+            , max_steps{ max_steps_ }{
+
+#line 1158 "cpp2regex.h2"
+        }
+
+#line 1162 "cpp2regex.h2"
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::next() & -> bool{
+            if (done) {
+                return false; 
+            }
+
+            //  Each advance gets a fresh backtracking budget
+            ctx.steps_remaining = max_steps;
+
+            auto pos {matcher_wrapper::prefilter::find(cur, ctx.begin, ctx.end)}; 
+            for( ; true; (pos = matcher_wrapper::prefilter::find(pos + 1, ctx.begin, ctx.end)) ) {
+                auto r {matcher<Iter>::entry(pos, ctx)}; 
+                if (r.matched) {
+                    //  Continue after this match - or one past it, if it was empty.
+                    if (r.pos != pos) {
+                        cur = cpp2::move(r).pos;
+                    }
+                    else {if (pos == ctx.end) {
+                        done = true;
+                    }
+                    else {
+                        cur = pos + 1;
+                    }}
+                    return true; 
+                }
+
+                if (pos == ctx.end) {
+                    done = true;
+                    return false; 
+                }
+            }
+        }
+
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group_number() const& -> decltype(auto) { return ctx.size(); }
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group(cpp2::impl::in<int> g) const& -> decltype(auto) { return ctx.get_group_string(g); }
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group_view(cpp2::impl::in<int> g) const& -> decltype(auto) { return ctx.get_group_view(g); }
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group_start(cpp2::impl::in<int> g) const& -> decltype(auto) { return ctx.get_group_start(g); }
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group_end(cpp2::impl::in<int> g) const& -> decltype(auto) { return ctx.get_group_end(g); }
+
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto) { return group(get_group_id(g)); }
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group_view(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto) { return group_view(get_group_id(g)); }
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group_start(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto) { return group_start(get_group_id(g)); }
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::group_end(cpp2::impl::in<bstring<CharT>> g) const& -> decltype(auto) { return group_end(get_group_id(g)); }
+
+        template <typename CharT, typename matcher_wrapper> template <typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all_return<Iter>::get_group_id(cpp2::impl::in<bstring<CharT>> g) const& -> auto{
+            auto group_id {matcher<Iter>::get_named_group_index(g)}; 
+            if (-1 == group_id) {
+                // TODO: Throw error.
+            }
+            return group_id; 
+        }
+
+#line 1214 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::match(cpp2::impl::in<bview<CharT>> str) const& -> decltype(auto) { return match(str.begin(), str.end()); }
-#line 709 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::match(cpp2::impl::in<bview<CharT>> str, auto const& start) const& -> decltype(auto) { return match(get_iter(str, start), str.end()); }
-#line 710 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::match(cpp2::impl::in<bview<CharT>> str, auto const& start, auto const& length) const& -> decltype(auto) { return match(get_iter(str, start), get_iter(str, start + length));  }
-#line 711 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> template<typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::match(Iter const& start, Iter const& end) const& -> search_return<Iter>
     {
         context<Iter> ctx {start, end}; 
+        ctx.steps_remaining = max_steps;
 
         auto r {matcher<Iter>::entry(start, ctx)}; 
         return search_return<Iter>(r.matched && r.pos == end, cpp2::move(ctx), r.pos); 
     }
 
-#line 719 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search(cpp2::impl::in<bview<CharT>> str) const& -> decltype(auto) { return search(str.begin(), str.end()); }
-#line 720 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search(cpp2::impl::in<bview<CharT>> str, auto const& start) const& -> decltype(auto) { return search(get_iter(str, start), str.end()); }
-#line 721 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search(cpp2::impl::in<bview<CharT>> str, auto const& start, auto const& length) const& -> decltype(auto) { return search(get_iter(str, start), get_iter(str, start + length));  }
-#line 722 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> template<typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search(Iter const& start, Iter const& end) const& -> search_return<Iter>
     {
         context<Iter> ctx {start, end}; 
+        ctx.steps_remaining = max_steps;
         auto r {ctx.fail()}; 
 
-        auto cur {start}; 
-        for( ; true; (++cur) ) {
+        auto cur {matcher_wrapper::prefilter::find(start, start, end)}; 
+        for( ; true; (cur = matcher_wrapper::prefilter::find(cur + 1, start, end)) ) {
             r = matcher<Iter>::entry(cur, ctx);
             if (r.matched) {
                 break;
@@ -1176,10 +1852,14 @@ template<typename CharT, bool negate> [[nodiscard]] auto word_boundary_token_mat
         return search_return<Iter>(r.matched, cpp2::move(ctx), cpp2::move(r).pos); 
     }
 
-#line 742 "cpp2regex.h2"
+    template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all(cpp2::impl::in<bview<CharT>> str) const& -> decltype(auto) { return search_all(str.begin(), str.end()); }
+    template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all(cpp2::impl::in<bview<CharT>> str, auto const& start) const& -> decltype(auto) { return search_all(get_iter(str, start), str.end()); }
+    template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all(cpp2::impl::in<bview<CharT>> str, auto const& start, auto const& length) const& -> decltype(auto) { return search_all(get_iter(str, start), get_iter(str, start + length));  }
+    template <typename CharT, typename matcher_wrapper> template<typename Iter> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::search_all(Iter const& start, Iter const& end) const& -> search_all_return<Iter> { return search_all_return<Iter>(start, end, max_steps);  }
+
     template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::to_string() const& -> decltype(auto) { return matcher_wrapper::to_string();  }
 
-#line 746 "cpp2regex.h2"
+#line 1259 "cpp2regex.h2"
     template <typename CharT, typename matcher_wrapper> [[nodiscard]] auto regular_expression<CharT,matcher_wrapper>::get_iter(cpp2::impl::in<bview<CharT>> str, auto const& pos) -> auto{
         if (cpp2::impl::cmp_less(pos,str.size())) {
             return str.begin() + pos; 
@@ -1189,7 +1869,7 @@ template<typename CharT, bool negate> [[nodiscard]] auto word_boundary_token_mat
         }
     }
 
-#line 756 "cpp2regex.h2"
+#line 1269 "cpp2regex.h2"
 }
 }
 
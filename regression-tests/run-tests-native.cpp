@@ -0,0 +1,450 @@
+//  run-tests-native - order-preserving parallel check of the lowering stage
+//
+//  Runs every *.cpp2 in the corpus through cpp2::compile across worker
+//  threads and diffs, in memory, both the generated Cpp1 and the console
+//  output cppfront would have printed against the checked-in goldens in
+//  test-results/. Results always print in corpus order, no matter which
+//  thread finished first, so two runs are directly comparable.
+//
+//  This covers only the cppfront stage - run-tests.sh remains the
+//  authority for the downstream "compile the Cpp1 and execute it" steps,
+//  which need a Cpp1 compiler and can't run in-process.
+//
+//  Build:  g++ -std=c++20 -I ../include run-tests-native.cpp -o run-tests-native -pthread
+//  Usage:  run-tests-native [options]
+//
+//      -corpus dir   corpus directory         (default: .)
+//      -results dir  golden output directory  (default: <corpus>/test-results)
+//      -jobs N       worker threads           (default: hardware concurrency)
+//      -verbose      also print passing tests, not just failures
+//      -dump dir     write each failing test's actual output into 'dir',
+//                    for diffing against the goldens by hand
+//      -ledger file  also time each test's compile phases and write a
+//                    per-test TSV ledger, plus a family rollup on the
+//                    console - diff two ledgers to see which grammar
+//                    constructs a front-end change made slower
+//                    (implies -jobs 1 unless -jobs is given; idle
+//                    cores keep the timings comparable across runs)
+//      -reps N       timing repetitions for -ledger, min-of (default: 3)
+//
+
+#include "../source/to_cpp1.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+//  Metafunctions like @print write to std::cout as a side effect of
+//  compiling, and that text is part of the golden .cpp2.output files. A
+//  worker routes cout into its own test's capture buffer by pointing
+//  'target' at it; anything printed outside a capture window falls
+//  through to the real console
+//
+class thread_capture_buf : public std::streambuf
+{
+    std::streambuf* fallback;
+
+public:
+    static thread_local std::string* target;
+
+    explicit thread_capture_buf(std::streambuf* fallback_) : fallback{fallback_} {}
+
+protected:
+    auto overflow(int_type ch) -> int_type override
+    {
+        if (traits_type::eq_int_type(ch, traits_type::eof())) {
+            return traits_type::not_eof(ch);
+        }
+        if (target) {
+            target->push_back( traits_type::to_char_type(ch) );
+            return ch;
+        }
+        return fallback->sputc( traits_type::to_char_type(ch) );
+    }
+
+    auto xsputn(char const* s, std::streamsize n) -> std::streamsize override
+    {
+        if (target) {
+            target->append( s, static_cast<std::size_t>(n) );
+            return n;
+        }
+        return fallback->sputn( s, n );
+    }
+};
+
+thread_local std::string* thread_capture_buf::target = nullptr;
+
+struct test_result {
+    std::string name;
+    bool        pass = false;
+    std::string why;            // empty if pass - one reason per line otherwise
+
+    //  Per-phase compile times, min over -reps - filled under -ledger
+    long long   lex_us   = 0;
+    long long   parse_us = 0;
+    long long   sema_us  = 0;
+    long long   emit_us  = 0;
+};
+
+auto read_file(std::filesystem::path const& p)
+    -> std::string
+{
+    auto f = std::ifstream{ p, std::ios::binary };
+    return { std::istreambuf_iterator<char>{f}, std::istreambuf_iterator<char>{} };
+}
+
+//  1-based line number of the first difference, for pointing a human at
+//  the right place without replicating a full diff tool here
+//
+auto first_diff_line(
+    std::string_view a,
+    std::string_view b
+)
+    -> long
+{
+    auto line = long{1};
+    auto n    = std::min( a.size(), b.size() );
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        if (a[i] != b[i]) {
+            return line;
+        }
+        line += a[i] == '\n';
+    }
+    return line;
+}
+
+auto usage()
+    -> int
+{
+    std::cerr <<
+        "usage: run-tests-native [-corpus dir] [-results dir] [-jobs N] [-verbose]\n";
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+auto main(
+    int   argc,
+    char* argv[]
+)
+    -> int
+{
+    auto corpus   = std::string{ "." };
+    auto results  = std::string{};
+    auto jobs     = std::max( 1u, std::thread::hardware_concurrency() );
+    auto jobs_set = false;
+    auto verbose  = false;
+    auto dump     = std::string{};
+    auto ledger   = std::string{};
+    auto reps     = 3;
+
+    for (auto i = 1; i < argc; ++i) {
+        auto arg  = std::string{ argv[i] };
+        auto next = [&]() -> char const* { return i+1 < argc ? argv[++i] : nullptr; };
+        if      (arg == "-corpus" ) { if (auto v = next()) { corpus  = v; } else { return usage(); } }
+        else if (arg == "-results") { if (auto v = next()) { results = v; } else { return usage(); } }
+        else if (arg == "-jobs"   ) { if (auto v = next()) { jobs = std::max(1, atoi(v)); jobs_set = true; } else { return usage(); } }
+        else if (arg == "-verbose") { verbose = true; }
+        else if (arg == "-dump"   ) { if (auto v = next()) { dump    = v; } else { return usage(); } }
+        else if (arg == "-ledger" ) { if (auto v = next()) { ledger  = v; } else { return usage(); } }
+        else if (arg == "-reps"   ) { if (auto v = next()) { reps = std::max(1, atoi(v)); } else { return usage(); } }
+        else                        { return usage(); }
+    }
+
+    //  Timing under contended workers measures the scheduler, not the
+    //  compiler - so a ledger run is serial unless -jobs says otherwise
+    if (
+        !ledger.empty()
+        && !jobs_set
+        )
+    {
+        jobs = 1;
+    }
+    if (results.empty()) {
+        results = (std::filesystem::path{corpus} / "test-results").string();
+    }
+    if (!dump.empty()) {
+        auto ec = std::error_code{};
+        std::filesystem::create_directories( dump, ec );
+    }
+
+    //  Gather the corpus in a stable order
+    //
+    auto files = std::vector<std::filesystem::path>{};
+    {
+        auto ec = std::error_code{};
+        for (auto const& e : std::filesystem::directory_iterator{ corpus, ec }) {
+            if (e.path().extension() == ".cpp2") {
+                files.push_back( e.path() );
+            }
+        }
+        if (files.empty()) {
+            std::cerr << "run-tests-native: error: no .cpp2 files in '" << corpus << "'\n";
+            return EXIT_FAILURE;
+        }
+        std::sort( files.begin(), files.end() );
+    }
+
+    auto all_results = std::vector<test_result>( files.size() );
+
+    //  Check one test: recompile it in-process and diff what run-tests.sh
+    //  would have put in test-results/ - the console text in <name>.cpp2.output
+    //  (progress line, @print output, diagnostics) and the generated <name>.cpp
+    //
+    auto run_one = [&](
+        std::size_t          i,
+        cpp2::compile_options const& options
+    )
+    {
+        auto name = files[i].filename().string();
+        auto r    = test_result{ .name = name };
+        auto fail = [&](std::string msg) { r.why += "        " + std::move(msg) + "\n"; };
+
+        auto console = std::string{ name + "..." };
+
+        auto opts = options;
+        opts.filename = name;
+
+        auto text = read_file(files[i]);
+
+        thread_capture_buf::target = &console;
+        auto res = cpp2::compile( text, opts );
+        thread_capture_buf::target = nullptr;
+
+        //  Under -ledger, record this test's per-phase times, min over
+        //  the extra repetitions - whose console and Cpp1 output is
+        //  captured into a scratch buffer and discarded
+        if (!ledger.empty()) {
+            r.lex_us   = res.lex_us;
+            r.parse_us = res.parse_us;
+            r.sema_us  = res.sema_us;
+            r.emit_us  = res.emit_us;
+            for (auto rep = 1; rep < reps; ++rep) {
+                auto scratch = std::string{};
+                thread_capture_buf::target = &scratch;
+                auto rr = cpp2::compile( text, opts );
+                thread_capture_buf::target = nullptr;
+                r.lex_us   = std::min( r.lex_us  , rr.lex_us   );
+                r.parse_us = std::min( r.parse_us, rr.parse_us );
+                r.sema_us  = std::min( r.sema_us , rr.sema_us  );
+                r.emit_us  = std::min( r.emit_us , rr.emit_us  );
+            }
+        }
+
+        //  Reproduce compile_one's progress/diagnostic text (see cppfront.cpp)
+        if (res.ok) {
+            if      (!res.has_cpp1) { console += " ok (all Cpp2, passes safety checks)\n"; }
+            else if ( res.has_cpp2) { console += " ok (mixed Cpp1/Cpp2, Cpp2 code passes safety checks)\n"; }
+            else                    { console += " ok (all Cpp1)\n"; }
+            console += "\n";
+        }
+        else {
+            console += "\n" + res.diagnostics + "\n";
+        }
+
+        auto golden_output = std::filesystem::path{results} / (name + ".output");
+        if (!std::filesystem::exists( golden_output )) {
+            fail( "missing golden console output " + golden_output.string() );
+        }
+        else if (auto expected = read_file( golden_output );
+            expected != console
+            )
+        {
+            fail(
+                "console output differs from " + golden_output.string()
+                + " (first difference at line "
+                + std::to_string( first_diff_line(expected, console) ) + ")"
+            );
+        }
+
+        auto golden_cpp = std::filesystem::path{results} / (files[i].stem().string() + ".cpp");
+        if (!res.ok) {
+            if (std::filesystem::exists( golden_cpp )) {
+                fail( "compile failed, but golden " + golden_cpp.string() + " expects generated Cpp1" );
+            }
+        }
+        else if (!std::filesystem::exists( golden_cpp )) {
+            fail( "compile succeeded, but there is no golden " + golden_cpp.string() );
+        }
+        else if (auto expected = read_file( golden_cpp );
+            expected != res.cpp1_text
+            )
+        {
+            fail(
+                "generated Cpp1 differs from " + golden_cpp.string()
+                + " (first difference at line "
+                + std::to_string( first_diff_line(expected, res.cpp1_text) ) + ")"
+            );
+        }
+
+        r.pass = r.why.empty();
+        if (
+            !r.pass
+            && !dump.empty()
+            )
+        {
+            std::ofstream{ std::filesystem::path{dump} / (name + ".output"), std::ios::binary }
+                << console;
+            if (res.ok) {
+                std::ofstream{ std::filesystem::path{dump} / (files[i].stem().string() + ".cpp"), std::ios::binary }
+                    << res.cpp1_text;
+            }
+        }
+        all_results[i] = std::move(r);
+    };
+
+    //  The compile flags are process-wide (see the note on cpp2::compile),
+    //  so concurrent compiles must share one option set: run the pure-Cpp2
+    //  tests as one parallel batch and the mixed tests as another, exactly
+    //  mirroring run-tests.sh's "-p if the name starts with pure2" rule
+    //
+    auto capture  = thread_capture_buf{ std::cout.rdbuf() };
+    auto cout_buf = std::cout.rdbuf( &capture );
+
+    for (auto pure2 : { true, false })
+    {
+        auto batch = std::vector<std::size_t>{};
+        for (auto i = std::size_t{0}; i < files.size(); ++i) {
+            if (files[i].filename().string().starts_with("pure2") == pure2) {
+                batch.push_back( i );
+            }
+        }
+
+        auto options = cpp2::compile_options{
+            .import_std = pure2,    //  -p implies -import-std
+            .cpp2_only  = pure2
+        };
+
+        //  Pre-set the process-wide flags to this batch's values, so that
+        //  every concurrent compile's save/set/restore of them stores the
+        //  value they already have - a worker restoring a *different*
+        //  earlier value mid-batch would corrupt its neighbors' output
+        cpp2::flag_import_std = options.import_std;
+        cpp2::flag_cpp2_only  = options.cpp2_only;
+
+        auto next   = std::atomic<std::size_t>{ 0 };
+        auto worker = [&]{
+            for (;;) {
+                auto k = next.fetch_add(1);
+                if (k >= batch.size()) {
+                    return;
+                }
+                //  A hard failure - an exception escaping a phase rather
+                //  than a diagnosed source error - fails its own test only
+                try {
+                    run_one( batch[k], options );
+                }
+                catch (std::exception const& e) {
+                    all_results[batch[k]] = {
+                        files[batch[k]].filename().string(),
+                        false,
+                        std::string{"        internal failure: "} + e.what() + "\n"
+                    };
+                }
+                catch (...) {
+                    all_results[batch[k]] = {
+                        files[batch[k]].filename().string(),
+                        false,
+                        "        internal failure: unknown exception\n"
+                    };
+                }
+            }
+        };
+
+        auto threads = std::vector<std::thread>{};
+        for (auto t = 1u; t < jobs; ++t) {
+            threads.emplace_back( worker );
+        }
+        worker();
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    std::cout.rdbuf( cout_buf );
+
+    //  Report in corpus order
+    //
+    auto failed = 0;
+    for (auto const& r : all_results) {
+        if (!r.pass) {
+            ++failed;
+            std::cout << "    FAIL " << r.name << "\n" << r.why;
+        }
+        else if (verbose) {
+            std::cout << "    ok   " << r.name << "\n";
+        }
+    }
+    std::cout
+        << all_results.size() << " tests: "
+        << all_results.size() - failed << " passed, " << failed << " failed\n";
+
+    //  The phase ledger: one TSV row per test, in corpus order, so two
+    //  runs diff line for line - plus a rollup by test family on the
+    //  console, where a family is the name up to its first '_' (so
+    //  every pure2-regex_* test rolls up into pure2-regex)
+    //
+    if (!ledger.empty())
+    {
+        auto out = std::ofstream{ ledger };
+        if (!out.is_open()) {
+            std::cerr << "run-tests-native: error: could not write '" << ledger << "'\n";
+            return EXIT_FAILURE;
+        }
+        out << "test\tlex_us\tparse_us\tsema_us\temit_us\ttotal_us\n";
+
+        struct family_total {
+            long long lex = 0, parse = 0, sema = 0, emit = 0;
+            int tests = 0;
+        };
+        auto families = std::map<std::string, family_total>{};
+
+        for (auto const& r : all_results)
+        {
+            out << r.name
+                << "\t" << r.lex_us
+                << "\t" << r.parse_us
+                << "\t" << r.sema_us
+                << "\t" << r.emit_us
+                << "\t" << r.lex_us + r.parse_us + r.sema_us + r.emit_us
+                << "\n";
+
+            auto& f = families[ r.name.substr(
+                0, std::min( r.name.find('_'), r.name.find('.') )
+            ) ];
+            f.lex   += r.lex_us;
+            f.parse += r.parse_us;
+            f.sema  += r.sema_us;
+            f.emit  += r.emit_us;
+            ++f.tests;
+        }
+
+        std::cout
+            << "\nphase totals by family (microseconds, min of "
+            << reps << " rep" << (reps == 1 ? "" : "s") << "):\n"
+            << "    family                            tests      lex    parse     sema     emit\n";
+        for (auto const& [fname, f] : families) {
+            std::cout
+                << "    " << std::left  << std::setw(33) << fname
+                << std::right
+                << std::setw(6) << f.tests
+                << std::setw(9) << f.lex
+                << std::setw(9) << f.parse
+                << std::setw(9) << f.sema
+                << std::setw(9) << f.emit
+                << "\n";
+        }
+        std::cout << "wrote " << ledger << "\n";
+    }
+
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
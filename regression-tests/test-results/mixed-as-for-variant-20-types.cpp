@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-as-for-variant-20-types.cpp2"
 
@@ -14,7 +16,6 @@
 template<int I>
 struct X { operator int() const { return I; } };
 
-#line 4 "mixed-as-for-variant-20-types.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
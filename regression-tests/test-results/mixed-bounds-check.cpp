@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-bounds-check.cpp2"
 
@@ -14,7 +16,6 @@
 
 #include <vector>
 
-#line 4 "mixed-bounds-check.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-bounds-safety-with-assert-2.cpp2"
 
@@ -12,7 +14,6 @@
 
 #line 1 "mixed-bounds-safety-with-assert-2.cpp2"
 
-#line 2 "mixed-bounds-safety-with-assert-2.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 10 "mixed-bounds-safety-with-assert-2.cpp2"
@@ -28,7 +29,6 @@ auto add_42_to_subrange(auto& rng, cpp2::impl::in<int> start, cpp2::impl::in<int
 
 #line 1 "mixed-bounds-safety-with-assert-2.cpp2"
 
-#line 2 "mixed-bounds-safety-with-assert-2.cpp2"
 [[nodiscard]] auto main() -> int{
     std::vector<int> v {1, 2, 3, 4, 5}; 
     add_42_to_subrange(v, 1, 3);
@@ -37,7 +37,6 @@ auto add_42_to_subrange(auto& rng, cpp2::impl::in<int> start, cpp2::impl::in<int
         std::cout << i << "\n";
 }
 
-#line 10 "mixed-bounds-safety-with-assert-2.cpp2"
 auto add_42_to_subrange(auto& rng, cpp2::impl::in<int> start, cpp2::impl::in<int> end) -> void
 {
     if (cpp2::bounds_safety.is_active() && !(cpp2::impl::cmp_less_eq(0,start)) ) { cpp2::bounds_safety.report_violation(""); }
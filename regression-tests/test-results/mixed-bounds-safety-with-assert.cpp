@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-bounds-safety-with-assert.cpp2"
 
@@ -12,7 +14,6 @@
 
 #line 1 "mixed-bounds-safety-with-assert.cpp2"
 
-#line 2 "mixed-bounds-safety-with-assert.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 9 "mixed-bounds-safety-with-assert.cpp2"
@@ -28,7 +29,6 @@ auto print_subrange(auto const& rng, cpp2::impl::in<int> start, cpp2::impl::in<i
 
 #line 1 "mixed-bounds-safety-with-assert.cpp2"
 
-#line 2 "mixed-bounds-safety-with-assert.cpp2"
 [[nodiscard]] auto main() -> int{
     std::set_terminate(std::abort);
 
@@ -36,7 +36,6 @@ auto print_subrange(auto const& rng, cpp2::impl::in<int> start, cpp2::impl::in<i
     print_subrange(cpp2::move(v), 1, 13);
 }
 
-#line 9 "mixed-bounds-safety-with-assert.cpp2"
 auto print_subrange(auto const& rng, cpp2::impl::in<int> start, cpp2::impl::in<int> end) -> void{
     if (cpp2::bounds_safety.is_active() && !(cpp2::impl::cmp_less_eq(0,start)) ) { cpp2::bounds_safety.report_violation(""); }
     if (cpp2::bounds_safety.is_active() && !(cpp2::impl::cmp_less_eq(end,CPP2_UFCS(ssize)(rng))) ) { cpp2::bounds_safety.report_violation(""); }
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-bugfix-for-cpp2-comment-cpp1-sequence.cpp2"
 
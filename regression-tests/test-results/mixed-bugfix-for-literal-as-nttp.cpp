@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-bugfix-for-literal-as-nttp.cpp2"
 
@@ -18,7 +20,6 @@ auto main() -> int;
 
 #line 1 "mixed-bugfix-for-literal-as-nttp.cpp2"
 
-#line 2 "mixed-bugfix-for-literal-as-nttp.cpp2"
 auto main() -> int{
   using namespace std::chrono_literals;
   if (cpp2::cpp2_default.is_active() && !(cpp2::impl::as_<cpp2::i32, 10>() == 10) ) { cpp2::cpp2_default.report_violation(""); }
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-bugfix-for-ufcs-non-local.cpp2"
 
@@ -29,7 +31,6 @@ constexpr t<true> o{};
 
 } // namespace ns
 
-#line 9 "mixed-bugfix-for-ufcs-non-local.cpp2"
 namespace ns {
 
 // Variables.
@@ -84,10 +85,8 @@ namespace ns {
 #line 21 "mixed-bugfix-for-ufcs-non-local.cpp2"
 template<t<CPP2_UFCS_NONLOCAL(f)(o)> UnnamedTypeParam1_2> auto g() -> void{}// Fails on GCC ([GCC109781][]) and Clang 12 (a lambda expression cannot appear in this context)
 
-#line 23 "mixed-bugfix-for-ufcs-non-local.cpp2"
 auto g([[maybe_unused]] cpp2::impl::in<t<CPP2_UFCS_NONLOCAL(f)(o)>> unnamed_param_1) -> void{}// Fails on Clang 12 (lambda in unevaluated context).
 
-#line 25 "mixed-bugfix-for-ufcs-non-local.cpp2"
 auto g() -> void{
                      if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(f)(o)) ) { cpp2::cpp2_default.report_violation(""); }}
 
@@ -98,15 +97,12 @@ auto g() -> void{
   inline CPP2_CONSTEXPR bool u::b{ CPP2_UFCS_NONLOCAL(f)(o) };
   
   inline CPP2_CONSTEXPR bool u::c{ [](auto&& x) -> decltype(auto)// Fails on Clang 12 (lambda in unevaluated context).
-#line 43 "mixed-bugfix-for-ufcs-non-local.cpp2"
   requires (std::is_convertible_v<CPP2_TYPEOF(x), std::add_const_t<decltype(f(o))>&>)  { return CPP2_FORWARD(x); }(true) };
 #line 43 "mixed-bugfix-for-ufcs-non-local.cpp2"
   auto u::g(auto const& s, auto const& sz) -> void{
                                   if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(sz)(s) != 0) ) { cpp2::cpp2_default.report_violation(""); }}
 
-#line 46 "mixed-bugfix-for-ufcs-non-local.cpp2"
 }
 
-#line 48 "mixed-bugfix-for-ufcs-non-local.cpp2"
 auto main() -> int{}
 
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-captures-in-expressions-and-postconditions.cpp2"
 
@@ -15,7 +17,6 @@
 #include <algorithm>
 #include <vector>
 
-#line 5 "mixed-captures-in-expressions-and-postconditions.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 17 "mixed-captures-in-expressions-and-postconditions.cpp2"
@@ -42,7 +43,6 @@ auto insert_at(cpp2::impl::in<int> where, cpp2::impl::in<int> val) -> void;
 
 std::vector<int> vec {}; 
 
-#line 19 "mixed-captures-in-expressions-and-postconditions.cpp2"
 auto insert_at(cpp2::impl::in<int> where, cpp2::impl::in<int> val) -> void
 
 #line 22 "mixed-captures-in-expressions-and-postconditions.cpp2"
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-default-arguments.cpp2"
 
@@ -15,7 +17,6 @@ auto cxx(int x, std::string y) -> void {
     std::cout << x << " \"" << y << "\"" << "\n";
 }
 
-#line 5 "mixed-default-arguments.cpp2"
 auto cxx2(cpp2::impl::in<int> x, cpp2::impl::in<std::string> y) -> void;
 
 #line 9 "mixed-default-arguments.cpp2"
@@ -27,10 +28,9 @@ auto main() -> int;
 
 #line 5 "mixed-default-arguments.cpp2"
 auto cxx2(cpp2::impl::in<int> x, cpp2::impl::in<std::string> y) -> void{
-    std::cout << "" + cpp2::to_string(x) + " \"" + cpp2::to_string(y) + "\"\n";
+    std::cout << "" + cpp2::string_build(cpp2::interp(x), " \"", cpp2::interp(y)) + "\"\n";
 }
 
-#line 9 "mixed-default-arguments.cpp2"
 auto main() -> int{
  cxx(1, "test");
  cxx({}, {});
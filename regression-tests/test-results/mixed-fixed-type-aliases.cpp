@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-fixed-type-aliases.cpp2"
 
@@ -22,7 +24,6 @@ namespace my {
     using u16 = float;
 }
 
-#line 9 "mixed-fixed-type-aliases.cpp2"
 auto test(auto const& x) -> void;
 
 #line 15 "mixed-fixed-type-aliases.cpp2"
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-float-literals.cpp2"
 
@@ -67,7 +69,6 @@ void literals_cpp1() {
   // 1e - 10.0f;
 }
 
-#line 57 "mixed-float-literals.cpp2"
 auto literals_cpp2() -> void;
 
 #line 114 "mixed-float-literals.cpp2"
@@ -135,7 +136,6 @@ auto literals_cpp2() -> void{
   // 1.E-10F;
 }
 
-#line 114 "mixed-float-literals.cpp2"
 [[nodiscard]] auto main() -> int{
   literals_cpp1();
   literals_cpp2();
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-forwarding.cpp2"
 
@@ -21,7 +23,6 @@ struct X {
     X(X &&     that) : i{that.i} { std::cout << "move X " << i << "\n"; }
 };
 
-#line 11 "mixed-forwarding.cpp2"
 auto copy_from([[maybe_unused]] auto unnamed_param_1) -> void;
 
 auto use([[maybe_unused]] auto const& unnamed_param_1) -> void;
@@ -44,7 +45,6 @@ CPP2_REQUIRES (std::is_convertible_v<CPP2_TYPEOF(t), std::add_const_t<std::pair<
 #line 11 "mixed-forwarding.cpp2"
 auto copy_from([[maybe_unused]] auto unnamed_param_1) -> void{}
 
-#line 13 "mixed-forwarding.cpp2"
 auto use([[maybe_unused]] auto const& unnamed_param_1) -> void{}
 
 #line 16 "mixed-forwarding.cpp2"
@@ -54,7 +54,6 @@ requires (std::is_convertible_v<CPP2_TYPEOF(t), std::add_const_t<std::pair<X,X>>
     copy_from(t.first);             // copies
     copy_from(CPP2_FORWARD(t).second);// moves
 }
-#line 20 "mixed-forwarding.cpp2"
 auto apply_explicit_forward(auto&& t) -> void
 requires (std::is_convertible_v<CPP2_TYPEOF(t), std::add_const_t<std::pair<X,X>>&>) {
 #line 21 "mixed-forwarding.cpp2"
@@ -62,7 +61,6 @@ requires (std::is_convertible_v<CPP2_TYPEOF(t), std::add_const_t<std::pair<X,X>>
     copy_from(CPP2_FORWARD(t).second);// moves
 }
 
-#line 25 "mixed-forwarding.cpp2"
 [[nodiscard]] auto main() -> int{
     std::pair<X,X> t1 {1, 2}; 
     apply_implicit_forward(t1);
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-function-expression-with-pointer-capture.cpp2"
 
@@ -18,7 +20,6 @@
 #include <algorithm>
 #include <iostream>
 
-#line 8 "mixed-function-expression-with-pointer-capture.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
@@ -0,0 +1,47 @@
+
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "mixed-generator-lazy-sequence.cpp2"
+
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "mixed-generator-lazy-sequence.cpp2"
+#include <iostream>
+
+//  The producing coroutine is (for now) written in a Cpp1 section - Cpp2
+//  function bodies can't contain a yield yet - and Cpp2 consumes it lazily
+cpp2::generator<int> fibonacci(int count)
+{
+    int a = 0;
+    int b = 1;
+    for (int i = 0; i < count; ++i) {
+        co_yield a;
+        int next = a + b;
+        a = b;
+        b = next;
+    }
+}
+
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "mixed-generator-lazy-sequence.cpp2"
+
+#line 17 "mixed-generator-lazy-sequence.cpp2"
+auto main() -> int{
+    auto total {0}; 
+    for ( auto const& x : fibonacci(10) ) {
+        std::cout << x << " ";
+        total += x;
+    }
+    std::cout << "\ntotal: " << cpp2::move(total) << "\n";
+}
+
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-hello.cpp2"
 
@@ -15,7 +17,6 @@
 #include <iostream>
 #include <string>
 
-#line 5 "mixed-hello.cpp2"
 [[nodiscard]] auto name() -> std::string;
 
 #line 11 "mixed-hello.cpp2"
@@ -39,7 +40,6 @@ auto main() -> int {
     return s; 
 }
 
-#line 11 "mixed-hello.cpp2"
 auto decorate(std::string& s) -> void{
     s = "[" + s + "]";
 }
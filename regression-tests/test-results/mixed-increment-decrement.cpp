@@ -3,11 +3,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-increment-decrement.cpp2"
 
-#line 2 "mixed-increment-decrement.cpp2"
 template<typename T> class iterator;
     
 
@@ -27,7 +28,6 @@ template<cpp2::i8 Op, cpp2::i32 Id> class number_line;
 
 #line 1 "mixed-increment-decrement.cpp2"
 
-#line 2 "mixed-increment-decrement.cpp2"
 template<typename T> class iterator {
     public: T x {0}; 
     public: auto operator++() & -> iterator<T>&
@@ -188,16 +188,13 @@ requires (bool(Op & 2))  { auto ret = x; ++x; return ret; }
 auto operator++(number_line_pre_increment<0>& x) -> number_line_pre_increment<0>& { return x;  }
 #line 51 "mixed-increment-decrement.cpp2"
 auto operator++(number_line_pre_increment<0>& x,int) -> number_line_pre_increment<0> { auto ret = x; ++x; return ret; }
-#line 52 "mixed-increment-decrement.cpp2"
 auto operator--(number_line_pre_decrement<0>& x) -> number_line_pre_decrement<0>& { return x;  }
 #line 52 "mixed-increment-decrement.cpp2"
 auto operator--(number_line_pre_decrement<0>& x,int) -> number_line_pre_decrement<0> { auto ret = x; ++x; return ret; }
 
-#line 54 "mixed-increment-decrement.cpp2"
 auto operator++(number_line_pre_increment<1>& x) -> number_line_pre_increment<1> const& { return x;  }
 #line 54 "mixed-increment-decrement.cpp2"
 auto operator++(number_line_pre_increment<1>& x,int) -> number_line_pre_increment<1> const { auto ret = x; ++x; return ret; }
-#line 55 "mixed-increment-decrement.cpp2"
 auto operator--(number_line_pre_decrement<1>& x) -> number_line_pre_decrement<1> const& { return x;  }
 #line 55 "mixed-increment-decrement.cpp2"
 auto operator--(number_line_pre_decrement<1>& x,int) -> number_line_pre_decrement<1> const { auto ret = x; ++x; return ret; }
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-initialization-safety-3.cpp2"
 
@@ -15,7 +17,6 @@
 #include <string>
 #include <vector>
 
-#line 5 "mixed-initialization-safety-3.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 16 "mixed-initialization-safety-3.cpp2"
@@ -49,7 +50,6 @@ auto print_decorated(auto const& x) -> void;
     print_decorated(cpp2::move(x.value()));
 }
 
-#line 16 "mixed-initialization-safety-3.cpp2"
 auto fill(
     cpp2::impl::out<std::string> x, 
     cpp2::impl::in<std::string> value, 
@@ -62,7 +62,6 @@ auto fill(
     x.construct(CPP2_UFCS(substr)(value, 0, count));
 }
 
-#line 26 "mixed-initialization-safety-3.cpp2"
 auto print_decorated(auto const& x) -> void{
     std::cout << ">> [" << x << "]\n";
 }
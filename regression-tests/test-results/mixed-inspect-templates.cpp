@@ -18,7 +18,6 @@
 template <typename A, typename B>
 struct my_type {};
 
-#line 8 "mixed-inspect-templates.cpp2"
 [[nodiscard]] auto fun(auto const& v) -> std::string;
 
 #line 18 "mixed-inspect-templates.cpp2"
@@ -38,11 +37,10 @@ struct my_type {};
         else if (cpp2::impl::is<std::array>(_expr)) { if constexpr( requires{"std::array";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("std::array")),std::string> ) return "std::array"; else return std::string{}; else return std::string{}; }
         else if (cpp2::impl::is<std::variant>(_expr)) { if constexpr( requires{"std::variant";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("std::variant")),std::string> ) return "std::variant"; else return std::string{}; else return std::string{}; }
         else if (cpp2::impl::is<my_type>(_expr)) { if constexpr( requires{"my_type";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("my_type")),std::string> ) return "my_type"; else return std::string{}; else return std::string{}; }
-        else return "unknown"; }
+        else return [&] () CPP2_COLD_LAMBDA -> std::string { return "unknown"; } (); }
     (); 
 }
 
-#line 18 "mixed-inspect-templates.cpp2"
 [[nodiscard]] auto fun2(auto const& v) -> std::string{
     if (cpp2::impl::is<std::vector>(v)) {return "std::vector"; }
     if (cpp2::impl::is<std::array>(v)) {return "std::array"; }
@@ -51,7 +49,6 @@ struct my_type {};
     return "unknown"; 
 }
 
-#line 26 "mixed-inspect-templates.cpp2"
 [[nodiscard]] auto main() -> int{
     std::vector<int> vec {1, 2, 3}; 
     std::array<int,4> arr {1, 2, 3, 4}; 
@@ -29,7 +29,6 @@ constexpr auto empty = [](auto&& x){
     return std::empty(x);
 };
 
-#line 19 "mixed-inspect-values-2.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
@@ -43,7 +42,7 @@ constexpr auto empty = [](auto&& x){
     std::cout << [&] () -> std::string { auto&& _expr = i;
         if (cpp2::impl::is(_expr, (less_than(10)))) { if constexpr( requires{"i less than 10";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("i less than 10")),std::string> ) return "i less than 10"; else return std::string{}; else return std::string{}; }
         else if (cpp2::impl::is(_expr, in(11, 20))) { if constexpr( requires{"i is between 11 and 20";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("i is between 11 and 20")),std::string> ) return "i is between 11 and 20"; else return std::string{}; else return std::string{}; }
-        else return "i is out of our interest"; }
+        else return [&] () CPP2_COLD_LAMBDA -> std::string { return "i is out of our interest"; } (); }
     () << std::endl;
 
     if (cpp2::impl::is(i, (less_than(20)))) {
@@ -15,7 +15,6 @@ auto in(int min, int max) {
     return [=](int x){ return min <= x && x <= max; };
 }
 
-#line 5 "mixed-inspect-values.cpp2"
 [[nodiscard]] auto in_2_3(cpp2::impl::in<int> x) -> bool;
 
 [[nodiscard]] auto main() -> int;
@@ -30,7 +29,6 @@ auto test(auto const& x) -> void;
 #line 5 "mixed-inspect-values.cpp2"
 [[nodiscard]] auto in_2_3(cpp2::impl::in<int> x) -> bool { return cpp2::impl::cmp_less_eq(2,x) && cpp2::impl::cmp_less_eq(x,3);  }
 
-#line 7 "mixed-inspect-values.cpp2"
 [[nodiscard]] auto main() -> int{
     std::variant<double,std::string,double> v {}; 
     v = "rev dodgson";
@@ -55,7 +53,6 @@ auto test(auto const& x) -> void;
     test(3.14);
 }
 
-#line 31 "mixed-inspect-values.cpp2"
 auto test(auto const& x) -> void{
     auto forty_two {42}; 
     std::cout << [&] () -> std::string { auto&& _expr = x;
@@ -65,7 +62,7 @@ auto test(auto const& x) -> void{
         else if (cpp2::impl::is(_expr, cpp2::move(forty_two))) { if constexpr( requires{"the answer";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("the answer")),std::string> ) return "the answer"; else return std::string{}; else return std::string{}; }
         else if (cpp2::impl::is<int>(_expr)) { if constexpr( requires{"integer " + cpp2::to_string(x);} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("integer " + cpp2::to_string(x))),std::string> ) return "integer " + cpp2::to_string(x); else return std::string{}; else return std::string{}; }
         else if (cpp2::impl::is<std::string>(_expr)) { if constexpr( requires{cpp2::impl::as<std::string>(x);} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((cpp2::impl::as<std::string>(x))),std::string> ) return cpp2::impl::as<std::string>(x); else return std::string{}; else return std::string{}; }
-        else return "(no match)"; }
+        else return [&] () CPP2_COLD_LAMBDA -> std::string { return "(no match)"; } (); }
     () << "\n";
 }
 
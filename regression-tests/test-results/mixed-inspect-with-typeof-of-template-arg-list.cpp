@@ -17,7 +17,6 @@ auto calc() {
     return i + j;
 }
 
-#line 7 "mixed-inspect-with-typeof-of-template-arg-list.cpp2"
 [[nodiscard]] auto fun(auto const& v) -> int;
 
 #line 14 "mixed-inspect-with-typeof-of-template-arg-list.cpp2"
@@ -31,11 +30,10 @@ auto calc() {
 [[nodiscard]] auto fun(auto const& v) -> int{
     return [&] () -> int { auto&& _expr = v;
         if (cpp2::impl::is<int>(_expr)) { if constexpr( requires{calc<1,2>();} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((calc<1,2>())),int> ) return calc<1,2>(); else return int{}; else return int{}; }
-        else return 0; }
+        else return [&] () CPP2_COLD_LAMBDA -> int { return 0; } (); }
     (); 
 }
 
-#line 14 "mixed-inspect-with-typeof-of-template-arg-list.cpp2"
 [[nodiscard]] auto main() -> int{
     return fun(42); 
 }
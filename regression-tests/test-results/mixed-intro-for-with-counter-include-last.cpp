@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-intro-for-with-counter-include-last.cpp2"
 
@@ -12,7 +14,6 @@
 
 #line 1 "mixed-intro-for-with-counter-include-last.cpp2"
 
-#line 2 "mixed-intro-for-with-counter-include-last.cpp2"
 [[nodiscard]] auto main() -> int;
 #line 10 "mixed-intro-for-with-counter-include-last.cpp2"
 
@@ -25,7 +26,6 @@
 
 #line 1 "mixed-intro-for-with-counter-include-last.cpp2"
 
-#line 2 "mixed-intro-for-with-counter-include-last.cpp2"
 [[nodiscard]] auto main() -> int
 {
     std::vector<int> v {1, 2, 3, 4, 5}; 
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-is-as-value-with-variant.cpp2"
 
@@ -15,7 +17,6 @@ auto in(int min, int max) {
     return [=](int x){ return min <= x && x <= max; };
 }
 
-#line 5 "mixed-is-as-value-with-variant.cpp2"
 auto test(auto&& v) -> void;
 
 #line 40 "mixed-is-as-value-with-variant.cpp2"
@@ -135,7 +136,6 @@ auto test(auto&& v) -> void{
     test(cpp2::move(v));
 }
 
-#line 110 "mixed-is-as-value-with-variant.cpp2"
 auto header(cpp2::impl::in<int> lvl, cpp2::impl::in<std::string> msg) -> void{
     std::cout << std::string(lvl, '#') << " " << msg << std::endl;
 }
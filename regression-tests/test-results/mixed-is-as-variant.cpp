@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-is-as-variant.cpp2"
 
@@ -67,17 +69,15 @@ auto expect_no_throw(auto&& v, auto&& l) -> std::string try {
 
 #line 1 "mixed-is-as-variant.cpp2"
 auto test(auto&& v) -> void{
-#line 2 "mixed-is-as-variant.cpp2"
     std::cout << "v is empty = " + cpp2::to_string(cpp2::impl::is<void>(v)) + "" << std::endl;
     std::cout << "v is std::monostate = " + cpp2::to_string(cpp2::impl::is<std::monostate>(v)) + "" << std::endl;
     std::cout << "v is X< 0> = " + cpp2::to_string(cpp2::impl::is<X<0>>(v)) + ",\t(v as X< 1>) = " << expect_no_throw(CPP2_FORWARD(v), [](auto&& v) -> decltype(auto) { return cpp2::impl::as_<X<0>>(CPP2_FORWARD(v));  }) << std::endl;
-    std::cout << "v is X< 1> = " + cpp2::to_string(cpp2::impl::is<X<1>>(v)) + ",\t(v as X< 1>).to_string() = " + cpp2::to_string(expect_no_throw(CPP2_FORWARD(v), [](auto&& v) -> std::string{return CPP2_UFCS(to_string)((cpp2::impl::as_<X<1>>(CPP2_FORWARD(v)))); })) + "" << std::endl;
-    std::cout << "v is X<19> = " + cpp2::to_string(cpp2::impl::is<X<19>>(v)) + ",\t(v as X<19>).to_string() = " + cpp2::to_string(expect_no_throw(CPP2_FORWARD(v), [](auto&& v) -> std::string{return CPP2_UFCS(to_string)((cpp2::impl::as_<X<19>>(CPP2_FORWARD(v)))); })) + "" << std::endl;
+    std::cout << "v is X< 1> = " + cpp2::string_build(cpp2::interp(cpp2::impl::is<X<1>>(v)), ",\t(v as X< 1>).to_string() = ", cpp2::interp(expect_no_throw(CPP2_FORWARD(v), [](auto&& v) -> std::string{return CPP2_UFCS(to_string)((cpp2::impl::as_<X<1>>(CPP2_FORWARD(v)))); }))) + "" << std::endl;
+    std::cout << "v is X<19> = " + cpp2::string_build(cpp2::interp(cpp2::impl::is<X<19>>(v)), ",\t(v as X<19>).to_string() = ", cpp2::interp(expect_no_throw(CPP2_FORWARD(v), [](auto&& v) -> std::string{return CPP2_UFCS(to_string)((cpp2::impl::as_<X<19>>(CPP2_FORWARD(v)))); }))) + "" << std::endl;
     std::cout << "v is X<20> = " + cpp2::to_string(cpp2::impl::is<X<20>>(v)) + ",\t(v as X<20>) = " << expect_no_throw(CPP2_FORWARD(v), [](auto&& v) -> decltype(auto) { return cpp2::impl::as_<X<20>>(CPP2_FORWARD(v));  }) << std::endl;
     std::cout << std::endl;
 }
 
-#line 11 "mixed-is-as-variant.cpp2"
 [[nodiscard]] auto main() -> int{
 
     std::variant<std::monostate,X<1>,X<2>,X<3>,X<4>,X<5>,X<6>,X<7>,X<8>,X<9>,X<10>,X<11>,X<12>,X<13>,X<14>,X<15>,X<16>,X<17>,X<18>,X<19>,X<20>> v {
@@ -106,7 +106,6 @@ auto test(auto&& v) -> void{
 
 }
 
-#line 39 "mixed-is-as-variant.cpp2"
 auto run_tests(auto&& v) -> void{
     header(2, "v as lvalue reference");
     test(v);
@@ -118,7 +117,6 @@ auto run_tests(auto&& v) -> void{
     test(std::move(CPP2_FORWARD(v)));
 }
 
-#line 50 "mixed-is-as-variant.cpp2"
 auto header(cpp2::impl::in<int> lvl, cpp2::impl::in<std::string> msg) -> void{
     std::cout << std::string(lvl, '#') << " " << msg << "\n" << std::endl;
 }
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-lifetime-safety-and-null-contracts.cpp2"
 
@@ -16,7 +18,6 @@
 #include <vector>
 #include <string>
 
-#line 6 "mixed-lifetime-safety-and-null-contracts.cpp2"
 [[nodiscard]] auto main() -> int;
 #line 11 "mixed-lifetime-safety-and-null-contracts.cpp2"
 
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-lifetime-safety-pointer-init-4.cpp2"
 
@@ -15,7 +17,6 @@
 #include <iostream>
 #include <random>
 
-#line 5 "mixed-lifetime-safety-pointer-init-4.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 21 "mixed-lifetime-safety-pointer-init-4.cpp2"
@@ -50,7 +51,6 @@ bool flip_a_coin() {
     print_and_decorate(*cpp2::impl::assert_not_null(cpp2::move(p.value())));
 }
 
-#line 21 "mixed-lifetime-safety-pointer-init-4.cpp2"
 auto print_and_decorate(auto const& x) -> void{
     std::cout << ">> " << x << "\n";
 }
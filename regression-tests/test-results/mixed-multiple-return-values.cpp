@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-multiple-return-values.cpp2"
 
@@ -62,7 +64,6 @@ bool flip_a_coin() {
     return  { std::move(i.value()), std::move(s.value()) }; 
 }
 
-#line 22 "mixed-multiple-return-values.cpp2"
 auto do_print(cpp2::impl::in<std::string> name, auto const& value) -> void{
     std::cout << name << " is " << value << "\n";
 }
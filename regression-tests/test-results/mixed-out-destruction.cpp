@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-out-destruction.cpp2"
 
@@ -32,7 +34,6 @@ struct C {
 
 //-------------------------------------------------------
 // 0x: Test one level of out and immediate throw
-#line 22 "mixed-out-destruction.cpp2"
 auto f00() -> void;
 auto f01(cpp2::impl::out<X> x) -> void;
 
@@ -58,17 +59,12 @@ int main() {
 
 #line 22 "mixed-out-destruction.cpp2"
 auto f00() -> void     {   C auto_1 {"f00"}; cpp2::impl::deferred_init<X> x; f01(cpp2::impl::out(&x));}
-#line 23 "mixed-out-destruction.cpp2"
 auto f01(cpp2::impl::out<X> x) -> void{C auto_1 {"f01"}; x.construct();throw_1();}
 
 #line 27 "mixed-out-destruction.cpp2"
 auto f10() -> void     {   C auto_1 {"f10"}; cpp2::impl::deferred_init<X> x; f11(cpp2::impl::out(&x));}
-#line 28 "mixed-out-destruction.cpp2"
 auto f11(cpp2::impl::out<X> x) -> void{C auto_1 {"f11"}; f12(cpp2::impl::out(&x));}
-#line 29 "mixed-out-destruction.cpp2"
 auto f12(cpp2::impl::out<X> x) -> void{C auto_1 {"f12"}; f13(cpp2::impl::out(&x));throw_1();}
-#line 30 "mixed-out-destruction.cpp2"
 auto f13(cpp2::impl::out<X> x) -> void{C auto_1 {"f13"}; f14(cpp2::impl::out(&x));}
-#line 31 "mixed-out-destruction.cpp2"
 auto f14(cpp2::impl::out<X> x) -> void{C auto_1 {"f14"}; x.construct();}
 
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-parameter-passing-generic-out.cpp2"
 
@@ -21,7 +23,6 @@ auto operator<<(std::ostream& o, X const&) -> std::ostream& {
     return o;
 }
 
-#line 11 "mixed-parameter-passing-generic-out.cpp2"
 auto f(auto x_) -> void;
 
 #line 15 "mixed-parameter-passing-generic-out.cpp2"
@@ -38,7 +39,6 @@ auto f(auto x_) -> void{
     x.construct(42);
 }
 
-#line 15 "mixed-parameter-passing-generic-out.cpp2"
 [[nodiscard]] auto main() -> int{
     cpp2::impl::deferred_init<int> a; 
     f(cpp2::impl::out(&a));
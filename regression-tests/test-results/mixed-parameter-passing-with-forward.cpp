@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-parameter-passing-with-forward.cpp2"
 
@@ -16,7 +18,6 @@
 #include <cstdlib>
 #include <ctime>
 
-#line 6 "mixed-parameter-passing-with-forward.cpp2"
 auto copy_from([[maybe_unused]] auto unnamed_param_1) -> void;
 
 auto parameter_styles(
@@ -40,7 +41,6 @@ CPP2_REQUIRES (std::is_convertible_v<CPP2_TYPEOF(e), std::add_const_t<std::strin
 #line 6 "mixed-parameter-passing-with-forward.cpp2"
 auto copy_from([[maybe_unused]] auto unnamed_param_1) -> void{}
 
-#line 8 "mixed-parameter-passing-with-forward.cpp2"
 auto parameter_styles(
     [[maybe_unused]] cpp2::impl::in<std::string> unnamed_param_1, 
     std::string b, 
@@ -77,6 +77,5 @@ requires (std::is_convertible_v<CPP2_TYPEOF(e), std::add_const_t<std::string>&>)
 
 }
 
-#line 42 "mixed-parameter-passing-with-forward.cpp2"
 [[nodiscard]] auto main() -> int{}
 
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-parameter-passing.cpp2"
 
@@ -19,7 +21,6 @@ template<typename T> class container;
 #include <cstdlib>
 #include <ctime>
 
-#line 6 "mixed-parameter-passing.cpp2"
 auto copy_from([[maybe_unused]] auto unnamed_param_1) -> void;
 
 auto parameter_styles(
@@ -56,7 +57,6 @@ auto main() -> int;
 #line 6 "mixed-parameter-passing.cpp2"
 auto copy_from([[maybe_unused]] auto unnamed_param_1) -> void{}
 
-#line 8 "mixed-parameter-passing.cpp2"
 auto parameter_styles(
     [[maybe_unused]] cpp2::impl::in<std::string> unnamed_param_1, 
     std::string b, 
@@ -89,13 +89,11 @@ auto parameter_styles(
 
 }
 
-#line 40 "mixed-parameter-passing.cpp2"
 [[nodiscard]] auto min(auto const& a, auto const& b) -> auto&&
     {if (cpp2::impl::cmp_less(b,a)) {return b; }else {return a; }}
 
 #line 45 "mixed-parameter-passing.cpp2"
     template <typename T> [[nodiscard]] auto container<T>::operator[](cpp2::impl::in<cpp2::i32> idx) const& -> T const& { return CPP2_ASSERT_IN_BOUNDS(buf, idx); }
-#line 46 "mixed-parameter-passing.cpp2"
     template <typename T> [[nodiscard]] auto container<T>::operator[](cpp2::impl::in<cpp2::i32> idx) & -> T& { return CPP2_ASSERT_IN_BOUNDS(buf, idx);  }
 
 #line 49 "mixed-parameter-passing.cpp2"
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-postexpression-with-capture.cpp2"
 
@@ -18,7 +20,6 @@
 #include <algorithm>
 #include <iostream>
 
-#line 8 "mixed-postexpression-with-capture.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 14 "mixed-postexpression-with-capture.cpp2"
@@ -53,7 +54,6 @@ struct make_strings_ret { std::string a; std::string b; };
 
 std::vector<int> vec {}; 
 
-#line 16 "mixed-postexpression-with-capture.cpp2"
 auto insert_at(cpp2::impl::in<int> where, cpp2::impl::in<int> val) -> void
 
 #line 19 "mixed-postexpression-with-capture.cpp2"
@@ -65,7 +65,6 @@ auto insert_at(cpp2::impl::in<int> where, cpp2::impl::in<int> val) -> void
     CPP2_UFCS(push_back)(vec, val);
 }
 
-#line 23 "mixed-postexpression-with-capture.cpp2"
 [[nodiscard]] auto make_string() -> make_string_ret
 
 {
@@ -76,7 +75,6 @@ auto insert_at(cpp2::impl::in<int> where, cpp2::impl::in<int> val) -> void
     ret += " and ";
 cpp2_finally_presuccess.run(); return ret; }
 
-#line 29 "mixed-postexpression-with-capture.cpp2"
 [[nodiscard]] auto make_strings() -> make_strings_ret
 
 #line 35 "mixed-postexpression-with-capture.cpp2"
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-postfix-expression-custom-formatting.cpp2"
 
@@ -12,7 +14,6 @@
 
 #line 1 "mixed-postfix-expression-custom-formatting.cpp2"
 
-#line 2 "mixed-postfix-expression-custom-formatting.cpp2"
 auto call([[maybe_unused]] auto const& unnamed_param_1, [[maybe_unused]] auto const& unnamed_param_2, [[maybe_unused]] auto const& unnamed_param_3, [[maybe_unused]] auto const& unnamed_param_4, [[maybe_unused]] auto const& unnamed_param_5) -> void;
 
 [[nodiscard]] auto test(auto const& a) -> std::string;
@@ -24,10 +25,8 @@ auto call([[maybe_unused]] auto const& unnamed_param_1, [[maybe_unused]] auto co
 
 #line 1 "mixed-postfix-expression-custom-formatting.cpp2"
 
-#line 2 "mixed-postfix-expression-custom-formatting.cpp2"
 auto call([[maybe_unused]] auto const& unnamed_param_1, [[maybe_unused]] auto const& unnamed_param_2, [[maybe_unused]] auto const& unnamed_param_3, [[maybe_unused]] auto const& unnamed_param_4, [[maybe_unused]] auto const& unnamed_param_5) -> void{}
 
-#line 4 "mixed-postfix-expression-custom-formatting.cpp2"
 [[nodiscard]] auto test(auto const& a) -> std::string{
     return call(a, 
         ++*cpp2::impl::assert_not_null(CPP2_UFCS(b)(a, a.c)), "hello", /* polite
@@ -39,6 +38,5 @@ auto call([[maybe_unused]] auto const& unnamed_param_1, [[maybe_unused]] auto co
         ); 
 }
 
-#line 15 "mixed-postfix-expression-custom-formatting.cpp2"
 [[nodiscard]] auto main() -> int{}
 
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-string-interpolation.cpp2"
 
@@ -18,7 +20,6 @@
 
 struct custom_struct_with_no_stringize_customization { } custom;
 
-#line 8 "mixed-string-interpolation.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
@@ -29,7 +30,7 @@ struct custom_struct_with_no_stringize_customization { } custom;
 [[nodiscard]] auto main() -> int{
     auto a {2}; 
     std::optional<int> b {}; 
-    std::cout << "a = " + cpp2::to_string(a) + ", b = " + cpp2::to_string(b) + "\n";
+    std::cout << "a = " + cpp2::string_build(cpp2::interp(a), ", b = ", cpp2::interp(b)) + "\n";
 
     b = 42;
     std::cout << "a^2 + b = " + cpp2::to_string(a * a + CPP2_UFCS(value)(cpp2::move(b))) + "\n";
@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-test-parens.cpp2"
 
@@ -18,7 +20,6 @@ auto f(auto, auto) -> void { }
 
 constexpr int a = 1;
 
-#line 8 "mixed-test-parens.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
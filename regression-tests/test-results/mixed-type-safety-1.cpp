@@ -3,7 +3,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "mixed-type-safety-1.cpp2"
 
@@ -33,10 +35,9 @@ template<typename T> auto print(cpp2::impl::in<std::string> msg, T const& x) ->
 
 #line 12 "mixed-type-safety-1.cpp2"
 template<typename T> auto print(cpp2::impl::in<std::string> msg, T const& x) -> void{
-    std::cout << "" + cpp2::to_string(msg) + " " + cpp2::to_string(x) + "\n";
+    std::cout << "" + cpp2::string_build(cpp2::interp(msg), " ", cpp2::interp(x)) + "\n";
 }
 
-#line 16 "mixed-type-safety-1.cpp2"
 [[nodiscard]] auto main() -> int
 {
     // Full qualification is necessary to avoid ambiguity in C++23
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-assert-optional-not-null.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-assert-optional-not-null.cpp2"
 
-#line 2 "pure2-assert-optional-not-null.cpp2"
 [[nodiscard]] auto fine() -> int;
 
 #line 11 "pure2-assert-optional-not-null.cpp2"
@@ -26,7 +27,6 @@
 
 #line 1 "pure2-assert-optional-not-null.cpp2"
 
-#line 2 "pure2-assert-optional-not-null.cpp2"
 [[nodiscard]] auto fine() -> int
 {
     auto up {CPP2_UFCS_TEMPLATE(cpp2_new<int>)(cpp2::unique, 1)}; 
@@ -36,14 +36,12 @@
     return *cpp2::impl::assert_not_null(cpp2::move(up)) + *cpp2::impl::assert_not_null(cpp2::move(sp)) + *cpp2::impl::assert_not_null(cpp2::move(op)); 
 }
 
-#line 11 "pure2-assert-optional-not-null.cpp2"
 [[nodiscard]] auto bad_optional_access() -> int
 {
     std::optional<int> op {std::nullopt}; 
     return *cpp2::impl::assert_not_null(cpp2::move(op)); 
 }
 
-#line 17 "pure2-assert-optional-not-null.cpp2"
 [[nodiscard]] auto main() -> int
 {
     std::set_terminate(std::abort);
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bounds-safety-span.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-bounds-safety-span.cpp2"
 
-#line 2 "pure2-bounds-safety-span.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 15 "pure2-bounds-safety-span.cpp2"
@@ -26,7 +27,6 @@ auto print_and_decorate(auto const& x) -> void;
 
 #line 1 "pure2-bounds-safety-span.cpp2"
 
-#line 2 "pure2-bounds-safety-span.cpp2"
 [[nodiscard]] auto main() -> int
 {
     std::vector<std::string> words {"decorated", "hello", "world"}; 
@@ -40,7 +40,6 @@ auto print_and_decorate(auto const& x) -> void;
     }
 }
 
-#line 15 "pure2-bounds-safety-span.cpp2"
 auto print_and_decorate(auto const& x) -> void{
     std::cout << ">> " << x << "\n";
 }
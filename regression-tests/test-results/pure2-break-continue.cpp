@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-break-continue.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-break-continue.cpp2"
 
-#line 2 "pure2-break-continue.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 20 "pure2-break-continue.cpp2"
@@ -56,7 +57,6 @@ auto for_break_outer() -> void;
 
 #line 1 "pure2-break-continue.cpp2"
 
-#line 2 "pure2-break-continue.cpp2"
 [[nodiscard]] auto main() -> int
 {
     std::cout <<   "while_continue_inner:\n  "; while_continue_inner();
@@ -75,31 +75,26 @@ auto for_break_outer() -> void;
     std::cout <<   "\nfor_break_outer:\n  ";    for_break_outer();
 }
 
-#line 20 "pure2-break-continue.cpp2"
 auto while_continue_inner() -> void
 {
     auto i {0}; 
     for( ; cpp2::impl::cmp_less(i,3); ++i ) {
         auto j {0}; 
         for( ; cpp2::impl::cmp_less(j,3); ++j ) {{
-#line 26 "pure2-break-continue.cpp2"
             std::cout << i << j << " ";
             if (j == 1) {
                 goto CONTINUE_inner;
             }
             std::cout << "inner ";
         } CPP2_CONTINUE_BREAK(inner) }
-#line 32 "pure2-break-continue.cpp2"
         std::cout << "outer ";
     }
 }
 
-#line 36 "pure2-break-continue.cpp2"
 auto while_continue_outer() -> void
 {
     auto i {0}; 
     for( ; cpp2::impl::cmp_less(i,3); ++i ) {{
-#line 40 "pure2-break-continue.cpp2"
         auto j {0}; 
         for( ; cpp2::impl::cmp_less(j,3); ++j ) {
             std::cout << i << j << " ";
@@ -110,34 +105,28 @@ auto while_continue_outer() -> void
         }
         std::cout << "outer ";
     } CPP2_CONTINUE_BREAK(outer) }
-#line 50 "pure2-break-continue.cpp2"
 }
 
-#line 52 "pure2-break-continue.cpp2"
 auto while_break_inner() -> void
 {
     auto i {0}; 
     for( ; cpp2::impl::cmp_less(i,3); ++i ) {
         auto j {0}; 
         for( ; cpp2::impl::cmp_less(j,3); ++j ) {{
-#line 58 "pure2-break-continue.cpp2"
             std::cout << i << j << " ";
             if (j == 1) {
                 goto BREAK_inner;
             }
             std::cout << "inner ";
         } CPP2_CONTINUE_BREAK(inner) }
-#line 64 "pure2-break-continue.cpp2"
         std::cout << "outer ";
     }
 }
 
-#line 68 "pure2-break-continue.cpp2"
 auto while_break_outer() -> void
 {
     auto i {0}; 
     for( ; cpp2::impl::cmp_less(i,3); ++i ) {{
-#line 72 "pure2-break-continue.cpp2"
         auto j {0}; 
         for( ; cpp2::impl::cmp_less(j,3); ++j ) {
             std::cout << i << j << " ";
@@ -148,17 +137,14 @@ auto while_break_outer() -> void
         }
         std::cout << "outer ";
     } CPP2_CONTINUE_BREAK(outer) }
-#line 82 "pure2-break-continue.cpp2"
 }
 
-#line 84 "pure2-break-continue.cpp2"
 auto do_continue_inner() -> void
 {
     auto i {0}; 
     do {
         auto j {0}; 
         do {{
-#line 90 "pure2-break-continue.cpp2"
             std::cout << i << j << " ";
             if (j == 1) {
                 goto CONTINUE_inner;
@@ -176,12 +162,10 @@ auto do_continue_inner() -> void
     ++i ; return true; }() && cpp2::impl::cmp_less(i,3));
 }
 
-#line 103 "pure2-break-continue.cpp2"
 auto do_continue_outer() -> void
 {
     auto i {0}; 
     do {{
-#line 107 "pure2-break-continue.cpp2"
         auto j {0}; 
         do {
             std::cout << i << j << " ";
@@ -201,14 +185,12 @@ auto do_continue_outer() -> void
     ++i ; return true; }() && cpp2::impl::cmp_less(i,3));
 }
 
-#line 122 "pure2-break-continue.cpp2"
 auto do_break_inner() -> void
 {
     auto i {0}; 
     do {
         auto j {0}; 
         do {{
-#line 128 "pure2-break-continue.cpp2"
             std::cout << i << j << " ";
             if (j == 1) {
                 goto BREAK_inner;
@@ -226,12 +208,10 @@ auto do_break_inner() -> void
     ++i ; return true; }() && cpp2::impl::cmp_less(i,3));
 }
 
-#line 141 "pure2-break-continue.cpp2"
 auto do_break_outer() -> void
 {
     auto i {0}; 
     do {{
-#line 145 "pure2-break-continue.cpp2"
         auto j {0}; 
         do {
             std::cout << i << j << " ";
@@ -251,14 +231,12 @@ auto do_break_outer() -> void
     ++i ; return true; }() && cpp2::impl::cmp_less(i,3));
 }
 
-#line 160 "pure2-break-continue.cpp2"
 auto for_continue_inner() -> void
 {
     std::vector vi {0, 1, 2}; 
     for ( auto const& i : cpp2::move(vi) ) {
         std::vector vj {0, 1, 2}; 
         for ( auto const& j : cpp2::move(vj) ) {{
-#line 166 "pure2-break-continue.cpp2"
             std::cout << i << j << " ";
             if (j == 1) {
                 goto CONTINUE_inner;
@@ -266,17 +244,14 @@ auto for_continue_inner() -> void
             std::cout << "inner ";
         } CPP2_CONTINUE_BREAK(inner) }
 
-#line 173 "pure2-break-continue.cpp2"
         std::cout << "outer ";
     }
 }
 
-#line 177 "pure2-break-continue.cpp2"
 auto for_continue_outer() -> void
 {
     std::vector vi {0, 1, 2}; 
     for ( auto const& i : cpp2::move(vi) ) {{
-#line 181 "pure2-break-continue.cpp2"
         std::vector vj {0, 1, 2}; 
         for ( auto const& j : cpp2::move(vj) ) {
             std::cout << i << j << " ";
@@ -288,17 +263,14 @@ auto for_continue_outer() -> void
 
         std::cout << "outer ";
     } CPP2_CONTINUE_BREAK(outer) }
-#line 192 "pure2-break-continue.cpp2"
 }
 
-#line 194 "pure2-break-continue.cpp2"
 auto for_break_inner() -> void
 {
     std::vector vi {0, 1, 2}; 
     for ( auto const& i : cpp2::move(vi) ) {
         std::vector vj {0, 1, 2}; 
         for ( auto const& j : cpp2::move(vj) ) {{
-#line 200 "pure2-break-continue.cpp2"
             std::cout << i << j << " ";
             if (j == 1) {
                 goto BREAK_inner;
@@ -306,17 +278,14 @@ auto for_break_inner() -> void
             std::cout << "inner ";
         } CPP2_CONTINUE_BREAK(inner) }
 
-#line 207 "pure2-break-continue.cpp2"
         std::cout << "outer ";
     }
 }
 
-#line 211 "pure2-break-continue.cpp2"
 auto for_break_outer() -> void
 {
     std::vector vi {0, 1, 2}; 
     for ( auto const& i : cpp2::move(vi) ) {{
-#line 215 "pure2-break-continue.cpp2"
         std::vector vj {0, 1, 2}; 
         for ( auto const& j : cpp2::move(vj) ) {
             std::cout << i << j << " ";
@@ -328,6 +297,5 @@ auto for_break_outer() -> void
 
         std::cout << "outer ";
     } CPP2_CONTINUE_BREAK(outer) }
-#line 226 "pure2-break-continue.cpp2"
 }
 
@@ -4,18 +4,18 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-discard-precedence.cpp2"
 class quantity;
-#line 2 "pure2-bugfix-for-discard-precedence.cpp2"
   
 
 //=== Cpp2 type definitions and function declarations ===========================
 
 #line 1 "pure2-bugfix-for-discard-precedence.cpp2"
 class quantity {
-#line 2 "pure2-bugfix-for-discard-precedence.cpp2"
   private: cpp2::i32 number; 
   public: quantity(cpp2::impl::in<cpp2::i32> x);
 #line 3 "pure2-bugfix-for-discard-precedence.cpp2"
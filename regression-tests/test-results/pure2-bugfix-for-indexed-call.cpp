@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-indexed-call.cpp2"
 
@@ -13,14 +15,12 @@
 
 #line 1 "pure2-bugfix-for-indexed-call.cpp2"
 auto f([[maybe_unused]] cpp2::impl::in<cpp2::i32> unnamed_param_1) -> void;
-#line 2 "pure2-bugfix-for-indexed-call.cpp2"
 auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
 
 #line 1 "pure2-bugfix-for-indexed-call.cpp2"
 auto f([[maybe_unused]] cpp2::impl::in<cpp2::i32> unnamed_param_1) -> void{}
-#line 2 "pure2-bugfix-for-indexed-call.cpp2"
 auto main() -> int{
   std::array array_of_functions {f, f}; 
   auto index {0}; 
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-max-munch.cpp2"
 
@@ -13,13 +15,11 @@
 
 #line 1 "pure2-bugfix-for-max-munch.cpp2"
 template<typename T> auto inline constexpr v{ 0 };
-#line 2 "pure2-bugfix-for-max-munch.cpp2"
 auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
 
 #line 1 "pure2-bugfix-for-max-munch.cpp2"
 
-#line 2 "pure2-bugfix-for-max-munch.cpp2"
 auto main() -> int { static_cast<void>(v<cpp2::i32> == v<cpp2::i64>);  }
 
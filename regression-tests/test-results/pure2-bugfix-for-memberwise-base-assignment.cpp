@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
 class Base;
-#line 2 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
   
 
 #line 7 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
@@ -19,7 +20,6 @@ class Derived;
 
 #line 1 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
 class Base {
-#line 2 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
   public: explicit Base();
   public: Base([[maybe_unused]] Base const& that);
 #line 3 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
@@ -46,9 +46,7 @@ auto main() -> int;
 
 #line 1 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
 
-#line 2 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
   Base::Base(){}
-#line 3 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
   Base::Base ([[maybe_unused]] Base const& that) { std::cout << "(out this, that)\n"; }
 #line 3 "pure2-bugfix-for-memberwise-base-assignment.cpp2"
   auto Base::operator=([[maybe_unused]] Base const& that) -> Base&  { std::cout << "(out this, that)\n";
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-name-lookup-and-value-decoration.cpp2"
 
@@ -23,13 +25,10 @@ using vals_ret = int;
 
 #line 1 "pure2-bugfix-for-name-lookup-and-value-decoration.cpp2"
 [[nodiscard]] auto vals() -> vals_ret{
-        cpp2::impl::deferred_init<int> i;
-#line 2 "pure2-bugfix-for-name-lookup-and-value-decoration.cpp2"
-    i.construct(42);
-    return std::move(i.value()); 
+    int i {42};
+    return i; 
 }
 
-#line 6 "pure2-bugfix-for-name-lookup-and-value-decoration.cpp2"
 [[nodiscard]] auto main() -> int{
     auto v {vals()}; 
     static_cast<void>(cpp2::move(v));
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-non-local-function-expression.cpp2"
 
@@ -19,7 +21,6 @@ class t;
 //  require Clang 13 or higher; Clang 12 complains "lambda expression in an unevaluated operand"
 //  Standalone Cpp1 repro: https://godbolt.org/z/dznnYTvc6
 
-#line 5 "pure2-bugfix-for-non-local-function-expression.cpp2"
 template<typename T> concept v = []() -> bool { return true;  }(); 
 
 using u = decltype([]() -> void{});
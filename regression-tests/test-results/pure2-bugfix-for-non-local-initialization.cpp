@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-non-local-initialization.cpp2"
 
-#line 2 "pure2-bugfix-for-non-local-initialization.cpp2"
 class t;
   
 
@@ -16,7 +17,6 @@ class t;
 
 #line 1 "pure2-bugfix-for-non-local-initialization.cpp2"
 using u = std::array<cpp2::i32,2>;
-#line 2 "pure2-bugfix-for-non-local-initialization.cpp2"
 class t: public std::integral_constant<u,u{17, 29}> {
 
 };
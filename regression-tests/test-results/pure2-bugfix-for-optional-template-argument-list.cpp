@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-optional-template-argument-list.cpp2"
 
@@ -13,13 +15,11 @@
 
 #line 1 "pure2-bugfix-for-optional-template-argument-list.cpp2"
 extern std::plus<> const plus;
-#line 2 "pure2-bugfix-for-optional-template-argument-list.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
 
 #line 1 "pure2-bugfix-for-optional-template-argument-list.cpp2"
 std::plus<> const plus {}; 
-#line 2 "pure2-bugfix-for-optional-template-argument-list.cpp2"
 [[nodiscard]] auto main() -> int { return std::plus<>()(0, 0); }
 
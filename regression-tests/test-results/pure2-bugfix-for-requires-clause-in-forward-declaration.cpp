@@ -4,18 +4,18 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-requires-clause-in-forward-declaration.cpp2"
 class element;
-#line 2 "pure2-bugfix-for-requires-clause-in-forward-declaration.cpp2"
   
 
 //=== Cpp2 type definitions and function declarations ===========================
 
 #line 1 "pure2-bugfix-for-requires-clause-in-forward-declaration.cpp2"
 class element {
-#line 2 "pure2-bugfix-for-requires-clause-in-forward-declaration.cpp2"
   private: std::string name; 
   public: element(auto&& n)
 CPP2_REQUIRES_ (std::is_convertible_v<CPP2_TYPEOF(n), std::add_const_t<std::string>&>) ;
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-template-argument.cpp2"
 
@@ -18,6 +20,5 @@ auto main() -> int;
 
 #line 1 "pure2-bugfix-for-template-argument.cpp2"
 auto main() -> int { 
-#line 2 "pure2-bugfix-for-template-argument.cpp2"
     std::cout << "" + cpp2::to_string(std::is_void_v<cpp2::i32*> && std::is_void_v<cpp2::i32 const>) + "\n";  }
 
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-ufcs-arguments.cpp2"
 
@@ -95,7 +97,6 @@ CPP2_REQUIRES_ (std::is_convertible_v<CPP2_TYPEOF(m_), std::add_const_t<A>&>) ;
 
 #line 1 "pure2-bugfix-for-ufcs-arguments.cpp2"
 [[nodiscard]] auto print_res(cpp2::impl::in<cpp2::i32> x) -> cpp2::i32{
-#line 2 "pure2-bugfix-for-ufcs-arguments.cpp2"
   std::cout << x;
   if (x == 9) {std::cout << '\n'; }
   return x; 
@@ -103,32 +104,24 @@ CPP2_REQUIRES_ (std::is_convertible_v<CPP2_TYPEOF(m_), std::add_const_t<A>&>) ;
 
 #line 8 "pure2-bugfix-for-ufcs-arguments.cpp2"
   [[nodiscard]] auto t::f() & -> cpp2::i32 { return print_res(0);  }
-#line 9 "pure2-bugfix-for-ufcs-arguments.cpp2"
   [[nodiscard]] auto t::f([[maybe_unused]] auto const& unnamed_param_2) & -> cpp2::i32 { return print_res(1);  }
-#line 10 "pure2-bugfix-for-ufcs-arguments.cpp2"
   template<typename UnnamedTypeParam1_1> [[nodiscard]] auto t::f() & -> cpp2::i32 { return print_res(2);  }
-#line 11 "pure2-bugfix-for-ufcs-arguments.cpp2"
   template<typename UnnamedTypeParam1_2> [[nodiscard]] auto t::f([[maybe_unused]] auto const& unnamed_param_2) & -> cpp2::i32 { return print_res(3);  }
-#line 12 "pure2-bugfix-for-ufcs-arguments.cpp2"
   template<typename UnnamedTypeParam1_3, typename U> [[nodiscard]] auto t::f([[maybe_unused]] auto const& unnamed_param_2, [[maybe_unused]] auto const& unnamed_param_3) & -> cpp2::i32 { return print_res(4);  }
 
 #line 15 "pure2-bugfix-for-ufcs-arguments.cpp2"
 [[nodiscard]] auto f([[maybe_unused]] cpp2::impl::in<t> unnamed_param_1) -> cpp2::i32 { return print_res(5);  }
-#line 16 "pure2-bugfix-for-ufcs-arguments.cpp2"
 [[nodiscard]] auto f([[maybe_unused]] cpp2::impl::in<t> unnamed_param_1, [[maybe_unused]] auto const& unnamed_param_2) -> cpp2::i32 { return print_res(6);  }
-#line 17 "pure2-bugfix-for-ufcs-arguments.cpp2"
 template<typename UnnamedTypeParam1_4> [[nodiscard]] auto f([[maybe_unused]] cpp2::impl::in<t> unnamed_param_1) -> cpp2::i32 { return print_res(7);  }
-#line 18 "pure2-bugfix-for-ufcs-arguments.cpp2"
 template<typename UnnamedTypeParam1_5> [[nodiscard]] auto f([[maybe_unused]] cpp2::impl::in<t> unnamed_param_1, [[maybe_unused]] auto const& unnamed_param_2) -> cpp2::i32 { return print_res(8);  }
-#line 19 "pure2-bugfix-for-ufcs-arguments.cpp2"
 template<typename UnnamedTypeParam1_6, typename U> [[nodiscard]] auto f([[maybe_unused]] cpp2::impl::in<t> unnamed_param_1, [[maybe_unused]] auto const& unnamed_param_2, [[maybe_unused]] auto const& unnamed_param_3) -> cpp2::i32 { return print_res(9);  }
 
 t m {}; 
 t const n {}; 
 
 #line 25 "pure2-bugfix-for-ufcs-arguments.cpp2"
-cpp2::i32 auto_8 {CPP2_UFCS_NONLOCAL(f)(m)}; 
-cpp2::i32 auto_9 {CPP2_UFCS_NONLOCAL(f)(m, 0)}; 
+cpp2::i32 auto_8 {m.f()}; 
+cpp2::i32 auto_9 {m.f(0)}; 
 cpp2::i32 auto_10 {CPP2_UFCS_TEMPLATE_NONLOCAL(f<t>)(m)}; 
 cpp2::i32 auto_11 {CPP2_UFCS_TEMPLATE_NONLOCAL(f<t>)(m, 0)}; 
 cpp2::i32 auto_12 {CPP2_UFCS_TEMPLATE_NONLOCAL(f<t,t>)(m, 0, 0)}; 
@@ -139,10 +132,9 @@ cpp2::i32 auto_16 {CPP2_UFCS_TEMPLATE_NONLOCAL(f<t>)(n, 0)};
 cpp2::i32 auto_17 {CPP2_UFCS_TEMPLATE_NONLOCAL(f<t,t>)(n, 0, 0)}; 
 cpp2::i32 auto_18 {CPP2_UFCS_TEMPLATE_NONLOCAL(f<t,t>)(a<t,t>, 0, 0)}; 
 
-#line 37 "pure2-bugfix-for-ufcs-arguments.cpp2"
 auto main() -> int{
-  static_cast<void>(CPP2_UFCS(f)(m));
-  static_cast<void>(CPP2_UFCS(f)(m, 0));
+  static_cast<void>(m.f());
+  static_cast<void>(m.f(0));
   static_cast<void>(CPP2_UFCS_TEMPLATE(f<t>)(m));
   static_cast<void>(CPP2_UFCS_TEMPLATE(f<t>)(m, 0));
   static_cast<void>(CPP2_UFCS_TEMPLATE(f<t,t>)(m, 0, 0));
@@ -163,7 +155,6 @@ cpp2::i32 auto_19 {CPP2_UFCS_QUALIFIED_TEMPLATE_NONLOCAL((ns::t<0,0>::),f<0>)(0)
 
 namespace ns {
 
-#line 60 "pure2-bugfix-for-ufcs-arguments.cpp2"
   template <int T, int U> template<int V> [[nodiscard]] auto t<T,U>::f([[maybe_unused]] cpp2::impl::in<int> unnamed_param_1) -> cpp2::i32 { return 0;  }
 
 }
@@ -172,7 +163,7 @@ namespace ns {
   auto A::f() const& -> void{}
 
 #line 70 "pure2-bugfix-for-ufcs-arguments.cpp2"
-  auto B::f() const& -> void{CPP2_UFCS(f)(m); }
+  auto B::f() const& -> void{m.f(); }
 
   B::B(auto&& m_)
 requires (std::is_convertible_v<CPP2_TYPEOF(m_), std::add_const_t<A>&>) 
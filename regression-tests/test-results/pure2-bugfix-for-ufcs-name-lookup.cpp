@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
 class identity;
-#line 2 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
   
 
 #line 5 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
@@ -27,7 +28,6 @@ namespace ns {
 
 #line 1 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
 class identity {
-#line 2 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
   public: [[nodiscard]] constexpr auto operator()(auto&& x) const& -> decltype(auto);
 };
 
@@ -52,7 +52,6 @@ auto main() -> int;
 
 #line 1 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
 
-#line 2 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
   [[nodiscard]] constexpr auto identity::operator()(auto&& x) const& -> decltype(auto) { return CPP2_FORWARD(x);  }
 
 #line 6 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
@@ -60,7 +59,6 @@ auto main() -> int;
 
 #line 11 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
 namespace ns {
-#line 12 "pure2-bugfix-for-ufcs-name-lookup.cpp2"
 [[nodiscard]] constexpr auto f([[maybe_unused]] auto const& unnamed_param_1) -> int { return 1;  }
 }
 
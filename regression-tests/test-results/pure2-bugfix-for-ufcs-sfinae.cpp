@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-ufcs-sfinae.cpp2"
 
@@ -17,7 +19,6 @@ class B;
 #line 1 "pure2-bugfix-for-ufcs-sfinae.cpp2"
 template<typename T> [[nodiscard]] auto f() -> std::type_identity_t<decltype(CPP2_UFCS_NONLOCAL(a)(T()))>;
 
-#line 3 "pure2-bugfix-for-ufcs-sfinae.cpp2"
 class B {
       public: B() = default;
       public: B(B const&) = delete; /* No 'that' constructor, suppress copy */
@@ -4,18 +4,18 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-unbraced-function-expression.cpp2"
 class t;
-#line 2 "pure2-bugfix-for-unbraced-function-expression.cpp2"
   
 
 //=== Cpp2 type definitions and function declarations ===========================
 
 #line 1 "pure2-bugfix-for-unbraced-function-expression.cpp2"
 class t {
-#line 2 "pure2-bugfix-for-unbraced-function-expression.cpp2"
   public: auto operator[]([[maybe_unused]] auto const& unnamed_param_2) const& -> void;
   public: t() = default;
   public: t(t const&) = delete; /* No 'that' constructor, suppress copy */
@@ -34,7 +34,6 @@ extern cpp2::i32 y;
 
 #line 1 "pure2-bugfix-for-unbraced-function-expression.cpp2"
 
-#line 2 "pure2-bugfix-for-unbraced-function-expression.cpp2"
   auto t::operator[]([[maybe_unused]] auto const& unnamed_param_2) const& -> void{}
 
 #line 5 "pure2-bugfix-for-unbraced-function-expression.cpp2"
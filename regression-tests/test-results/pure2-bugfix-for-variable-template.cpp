@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-bugfix-for-variable-template.cpp2"
 
@@ -13,13 +15,11 @@
 
 #line 1 "pure2-bugfix-for-variable-template.cpp2"
 template<auto V> extern int const v0;
-#line 2 "pure2-bugfix-for-variable-template.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
 
 #line 1 "pure2-bugfix-for-variable-template.cpp2"
 template<auto V> int const v0 {0}; 
-#line 2 "pure2-bugfix-for-variable-template.cpp2"
 [[nodiscard]] auto main() -> int { return v0<0>; }
 
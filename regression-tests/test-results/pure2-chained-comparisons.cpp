@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-chained-comparisons.cpp2"
 
@@ -18,7 +20,6 @@
 
 #line 1 "pure2-chained-comparisons.cpp2"
 [[nodiscard]] auto main() -> int{
-#line 2 "pure2-chained-comparisons.cpp2"
     auto i {0}; for( ; cpp2::impl::cmp_less(i,3); ++i ) {
         auto j {0}; for( ; cpp2::impl::cmp_less(j,3); ++j ) {
             auto k {0}; for( ; cpp2::impl::cmp_less(k,3); ++k ) {
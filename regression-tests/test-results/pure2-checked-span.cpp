@@ -0,0 +1,39 @@
+
+#define CPP2_IMPORT_STD          Yes
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-checked-span.cpp2"
+
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-checked-span.cpp2"
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-checked-span.cpp2"
+auto main() -> int{
+    std::vector v {10, 20, 30, 40, 50}; 
+    auto n {CPP2_UFCS(ssize)(v)}; 
+
+    auto s {cpp2::checked_span(v, (cpp2::range(0,n)))}; 
+    auto total {0}; 
+    for ( auto const& i : cpp2::range(0,cpp2::move(n)) ) {
+        total += CPP2_ASSERT_IN_BOUNDS(s, i);
+    }
+    std::cout << "total:   " << cpp2::move(total) << "\n";
+
+    auto middle {cpp2::checked_span(v, (cpp2::range(1,3,true)))}; 
+    std::cout << "middle:  " << CPP2_ASSERT_IN_BOUNDS_LITERAL(middle, 1) + CPP2_ASSERT_IN_BOUNDS_LITERAL(middle, 2) + CPP2_ASSERT_IN_BOUNDS_LITERAL(middle, 3) << "\n";
+
+    auto empty {cpp2::checked_span(cpp2::move(v), (cpp2::range(0,0)))}; 
+    std::cout << "empty ok\n";
+}
+
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-contracts.cpp2"
 
@@ -14,7 +16,6 @@
 #line 1 "pure2-contracts.cpp2"
 [[nodiscard]] auto test_condition_evaluation(auto const& tag) -> bool;
 
-#line 3 "pure2-contracts.cpp2"
 extern bool audit;
 
 auto main() -> int;
@@ -24,10 +25,8 @@ auto main() -> int;
 #line 1 "pure2-contracts.cpp2"
 [[nodiscard]] auto test_condition_evaluation(auto const& tag) -> bool{std::cout << tag << "\n"; return true; }
 
-#line 3 "pure2-contracts.cpp2"
 bool audit {true}; 
 
-#line 5 "pure2-contracts.cpp2"
 auto main() -> int{
     //  A few basic tests
     if (cpp2::cpp2_default.is_active() && !(1 != 2) ) { cpp2::cpp2_default.report_violation(CPP2_CONTRACT_MSG("ack, arithmetic is buggy")); }
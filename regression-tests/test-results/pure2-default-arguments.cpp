@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-default-arguments.cpp2"
 
@@ -19,7 +21,6 @@ template<typename T = int, int N = 42> class myclass;
 //  Note: Using source_location requires GCC 11 or higher,
 //        Clang 16 or higher, MSVC 2019 16.10 or higher.
 //        Older compilers will emit failures for this test case.
-#line 5 "pure2-default-arguments.cpp2"
 auto my_function_name(
     char const* fn = CPP2_UFCS_NONLOCAL(function_name)(std::source_location::current())
     ) -> void;
@@ -64,10 +65,8 @@ auto my_function_name(
     std::cout << "calling: " + cpp2::to_string(fn) + "\n";
 }
 
-#line 12 "pure2-default-arguments.cpp2"
 auto f(cpp2::impl::in<cpp2::i32> x) -> void{std::cout << x; }
 
-#line 14 "pure2-default-arguments.cpp2"
 template
     <
         typename AssocContainer, 
@@ -87,13 +86,11 @@ template
 #line 31 "pure2-default-arguments.cpp2"
     template <typename T, int N> template<typename TT, int NN> auto myclass<T,N>::memfunc(cpp2::impl::in<int> MM) -> void{static_cast<void>(MM); }
 
-#line 33 "pure2-default-arguments.cpp2"
 template <typename T,       int N> auto myfunc(cpp2::impl::in<int> M) -> void{
     static_cast<void>(M);
     []<typename TT = int, int NN = 42>(cpp2::impl::in<int> MM = 43) -> void{static_cast<void>(MM); };
 }
 
-#line 38 "pure2-default-arguments.cpp2"
 auto main(int const argc_, char** argv_) -> int{
     auto const args = cpp2::make_args(argc_, argv_); 
 #line 39 "pure2-default-arguments.cpp2"
@@ -119,6 +116,6 @@ auto main(int const argc_, char** argv_) -> int{
 
     combine_maps(m1, m2, [](auto const& x, auto const& y) -> decltype(auto) { return x + y + 33;  });
 
-    std::cout << "" + cpp2::to_string(CPP2_UFCS(size)(m1)) + ", " + cpp2::to_string(CPP2_UFCS(size)(cpp2::move(m2))) + ", " + cpp2::to_string(CPP2_ASSERT_IN_BOUNDS_LITERAL(m1, 1)) + "\n";
+    std::cout << "" + cpp2::string_build(cpp2::interp(CPP2_UFCS(size)(m1)), ", ", cpp2::interp(CPP2_UFCS(size)(cpp2::move(m2))), ", ", cpp2::interp(CPP2_ASSERT_IN_BOUNDS_LITERAL(cpp2::move(m1), 1))) + "\n";
 }
 
@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-defaulted-comparisons-and-final-types.cpp2"
 
-#line 2 "pure2-defaulted-comparisons-and-final-types.cpp2"
 class widget;
 
 
@@ -16,7 +17,6 @@ class widget;
 
 #line 1 "pure2-defaulted-comparisons-and-final-types.cpp2"
 
-#line 2 "pure2-defaulted-comparisons-and-final-types.cpp2"
 class widget final
  {
     private: int v; 
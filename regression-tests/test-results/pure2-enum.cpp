@@ -8,7 +8,6 @@
 
 #line 1 "pure2-enum.cpp2"
 
-#line 2 "pure2-enum.cpp2"
 class skat_game;
     
 
@@ -24,7 +23,6 @@ class file_attributes;
 
 #line 1 "pure2-enum.cpp2"
 
-#line 2 "pure2-enum.cpp2"
 class skat_game {
 private: cpp2::i8 _value; private: constexpr skat_game(cpp2::impl::in<cpp2::i64> _val);
 
@@ -117,7 +115,6 @@ public: [[nodiscard]] static auto from_code(cpp2::impl::in<std::string_view> s)
                 // 2
                 // 4
 
-#line 26 "pure2-enum.cpp2"
 };
 
 auto main() -> int;
@@ -343,7 +340,7 @@ auto main() -> int{
     // if x == 9 { }                    // error, can't compare skat_game and integer
     // if x == rgb::red { }             // error, can't compare skat_game and rgb color
 
-    std::cout << "x.to_string() is " + cpp2::to_string(CPP2_UFCS(to_string)(x)) + "\n";
+    std::cout << "x.to_string() is " + cpp2::to_string(x.to_string()) + "\n";
     std::cout << "x2.to_string() is " + cpp2::to_string(CPP2_UFCS(to_string)(cpp2::move(x2))) + "\n";
     std::cout << "x3.to_string() is " + cpp2::to_string(CPP2_UFCS(to_string)(x3)) + "\n";
     std::cout << "x3.to_code() is " + cpp2::to_string(CPP2_UFCS(to_code)(x3)) + "\n";
@@ -371,7 +368,7 @@ auto main() -> int{
         else if (cpp2::impl::is(_expr, skat_game::hearts)) { if constexpr( requires{"hearts";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("hearts")),std::string> ) return "hearts"; else return std::string{}; else return std::string{}; }
         else if (cpp2::impl::is(_expr, skat_game::spades)) { if constexpr( requires{"spades";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("spades")),std::string> ) return "spades"; else return std::string{}; else return std::string{}; }
         else if (cpp2::impl::is(_expr, skat_game::clubs)) { if constexpr( requires{"clubs";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("clubs")),std::string> ) return "clubs"; else return std::string{}; else return std::string{}; }
-        else return "not a suit"; }
+        else return [&] () CPP2_COLD_LAMBDA -> std::string { return "not a suit"; } (); }
     () << "\n\n";
 
     // x = 9;                           // error, can't assign skat_game from integer
@@ -386,12 +383,12 @@ auto main() -> int{
 
     file_attributes f {file_attributes::cached_and_current}; 
     f &= file_attributes::cached | file_attributes::obsolete;
-    std::cout << "f. get_raw_value() is " + cpp2::to_string(CPP2_UFCS(get_raw_value)(f)) + "\n";
+    std::cout << "f. get_raw_value() is " + cpp2::to_string(f.get_raw_value()) + "\n";
 
     auto f2 {file_attributes::cached}; 
     std::cout << "f2.get_raw_value() is " + cpp2::to_string(CPP2_UFCS(get_raw_value)(f2)) + "\n";
 
-    std::cout << "f  is " << CPP2_UFCS(to_string)(f) << "\n";
+    std::cout << "f  is " << f.to_string() << "\n";
     std::cout << "f2 is " << CPP2_UFCS(to_string)(f2) << "\n";
 
     CPP2_UFCS(clear)(f2, f2);
@@ -399,20 +396,20 @@ auto main() -> int{
     CPP2_UFCS(set)(f2, file_attributes::cached);
     std::cout << "f2 is " << CPP2_UFCS(to_string)(f2) << "\n";
 
-    std::cout << "f. get_raw_value() is " + cpp2::to_string(CPP2_UFCS(get_raw_value)(f)) + "\n";
+    std::cout << "f. get_raw_value() is " + cpp2::to_string(f.get_raw_value()) + "\n";
     std::cout << "f2.get_raw_value() is " + cpp2::to_string(CPP2_UFCS(get_raw_value)(f2)) + "\n";
 
     std::cout << "f  is (f2) is " + cpp2::to_string(cpp2::impl::is(f, (f2))) + "\n";
     std::cout << "f2 is (f ) is " + cpp2::to_string(cpp2::impl::is(f2, (f))) + "\n\n";
 
-    CPP2_UFCS(clear)(f, f2);
-    CPP2_UFCS(set)(f, file_attributes::current | f2);
+    f.clear(f2);
+    f.set(file_attributes::current | f2);
     f  |= file_attributes::obsolete;
     f2 |= file_attributes::current;
 
-    std::cout << "f  is " << CPP2_UFCS(to_string)(f) << "\n";
+    std::cout << "f  is " << f.to_string() << "\n";
     std::cout << "f2 is " << CPP2_UFCS(to_string)(f2) << "\n";
-    std::cout << "f. get_raw_value() is " + cpp2::to_string(CPP2_UFCS(get_raw_value)(f)) + "\n";
+    std::cout << "f. get_raw_value() is " + cpp2::to_string(f.get_raw_value()) + "\n";
     std::cout << "f2.get_raw_value() is " + cpp2::to_string(CPP2_UFCS(get_raw_value)(f2)) + "\n";
     std::cout << "f  == f2   is " + cpp2::to_string(f  == f2  ) + "\n";
     std::cout << "f  is (f2) is " + cpp2::to_string(cpp2::impl::is(f, (f2))) + "\n";
@@ -422,7 +419,7 @@ auto main() -> int{
     std::cout << "inspecting f: " << [&] () -> std::string { auto&& _expr = cpp2::move(f);
         if (cpp2::impl::is(_expr, (file_attributes::current))) { if constexpr( requires{"exactly 'current'";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("exactly 'current'")),std::string> ) return "exactly 'current'"; else return std::string{}; else return std::string{}; }
         else if (cpp2::impl::is(_expr, cpp2::has_flags(cpp2::move(f2)))) { if constexpr( requires{"includes all f2's flags ('cached' and 'current')";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("includes all f2's flags ('cached' and 'current')")),std::string> ) return "includes all f2's flags ('cached' and 'current')"; else return std::string{}; else return std::string{}; }
-        else return "something else"; }
+        else return [&] () CPP2_COLD_LAMBDA -> std::string { return "something else"; } (); }
     () << "\n";
 
     auto f_from_string {file_attributes::from_string("cached_and_current")}; 
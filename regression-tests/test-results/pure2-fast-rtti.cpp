@@ -0,0 +1,136 @@
+
+#define CPP2_IMPORT_STD          Yes
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-fast-rtti.cpp2"
+class Shape;
+    
+
+class Circle;
+    
+
+#line 8 "pure2-fast-rtti.cpp2"
+class Square;
+    
+
+#line 12 "pure2-fast-rtti.cpp2"
+class SmallSquare;
+    
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-fast-rtti.cpp2"
+class Shape {
+    public: [[nodiscard]] virtual auto area() const -> double;
+    public: virtual ~Shape() noexcept;
+public: using cpp2_fast_rtti_self = Shape;
+public: [[nodiscard]] static auto cpp2_fast_rtti_static_node() -> cpp2::fast_rtti::type_node*;
+public: [[nodiscard]] virtual auto cpp2_fast_rtti_node() const -> cpp2::fast_rtti::type_node*;
+
+    public: Shape() = default;
+    public: Shape(Shape const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(Shape const&) -> void = delete;
+
+#line 3 "pure2-fast-rtti.cpp2"
+};
+class Circle: public Shape {
+
+    public: [[nodiscard]] auto area() const -> double override;
+    public: using cpp2_fast_rtti_self = Circle;
+public: [[nodiscard]] static auto cpp2_fast_rtti_static_node() -> cpp2::fast_rtti::type_node*;
+public: [[nodiscard]] virtual auto cpp2_fast_rtti_node() const -> cpp2::fast_rtti::type_node*;
+
+    public: Circle() = default;
+    public: Circle(Circle const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(Circle const&) -> void = delete;
+
+#line 7 "pure2-fast-rtti.cpp2"
+};
+class Square: public Shape {
+
+    public: [[nodiscard]] auto area() const -> double override;
+    public: using cpp2_fast_rtti_self = Square;
+public: [[nodiscard]] static auto cpp2_fast_rtti_static_node() -> cpp2::fast_rtti::type_node*;
+public: [[nodiscard]] virtual auto cpp2_fast_rtti_node() const -> cpp2::fast_rtti::type_node*;
+
+    public: Square() = default;
+    public: Square(Square const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(Square const&) -> void = delete;
+
+#line 11 "pure2-fast-rtti.cpp2"
+};
+class SmallSquare: public Square {
+public: using cpp2_fast_rtti_self = SmallSquare;
+public: [[nodiscard]] static auto cpp2_fast_rtti_static_node() -> cpp2::fast_rtti::type_node*;
+public: [[nodiscard]] virtual auto cpp2_fast_rtti_node() const -> cpp2::fast_rtti::type_node*;
+
+    public: SmallSquare() = default;
+    public: SmallSquare(SmallSquare const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(SmallSquare const&) -> void = delete;
+
+
+#line 14 "pure2-fast-rtti.cpp2"
+};
+
+auto describe(Shape const* s) -> void;
+
+#line 22 "pure2-fast-rtti.cpp2"
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-fast-rtti.cpp2"
+
+    [[nodiscard]] auto Shape::area() const -> double { return 0.0;  }
+
+    Shape::~Shape() noexcept{}
+
+[[nodiscard]] auto Shape::cpp2_fast_rtti_static_node() -> cpp2::fast_rtti::type_node* { return cpp2::fast_rtti::node_of<Shape,void>(); }
+[[nodiscard]] auto Shape::cpp2_fast_rtti_node() const -> cpp2::fast_rtti::type_node* { return Shape::cpp2_fast_rtti_static_node(); }
+
+#line 6 "pure2-fast-rtti.cpp2"
+    [[nodiscard]] auto Circle::area() const -> double { return 3.14;  }
+
+
+    [[nodiscard]] auto Circle::cpp2_fast_rtti_static_node() -> cpp2::fast_rtti::type_node* { return cpp2::fast_rtti::node_of<Circle,Shape>(); }
+[[nodiscard]] auto Circle::cpp2_fast_rtti_node() const -> cpp2::fast_rtti::type_node* { return Circle::cpp2_fast_rtti_static_node(); }
+
+#line 10 "pure2-fast-rtti.cpp2"
+    [[nodiscard]] auto Square::area() const -> double { return 4.0;  }
+
+
+    [[nodiscard]] auto Square::cpp2_fast_rtti_static_node() -> cpp2::fast_rtti::type_node* { return cpp2::fast_rtti::node_of<Square,Shape>(); }
+[[nodiscard]] auto Square::cpp2_fast_rtti_node() const -> cpp2::fast_rtti::type_node* { return Square::cpp2_fast_rtti_static_node(); }
+
+[[nodiscard]] auto SmallSquare::cpp2_fast_rtti_static_node() -> cpp2::fast_rtti::type_node* { return cpp2::fast_rtti::node_of<SmallSquare,Square>(); }
+[[nodiscard]] auto SmallSquare::cpp2_fast_rtti_node() const -> cpp2::fast_rtti::type_node* { return SmallSquare::cpp2_fast_rtti_static_node(); }
+
+#line 16 "pure2-fast-rtti.cpp2"
+auto describe(Shape const* s) -> void{
+    if (cpp2::impl::is<Circle>(*cpp2::impl::assert_not_null(s))) {std::cout << "circle\n";}
+    else {if (cpp2::impl::is<Square>(*cpp2::impl::assert_not_null(s))) {std::cout << "square\n"; }
+    else                 { std::cout << "shape\n"; }}
+}
+
+auto main() -> int{
+    Circle c {}; 
+    Square q {}; 
+    SmallSquare sq {}; 
+    Shape sh {}; 
+    describe(&c);
+    describe(&q);
+    describe(&sq);
+    describe(&sh);
+
+    Shape const* s {&sq}; 
+    std::cout << "as Square area: " << CPP2_UFCS(area)((cpp2::impl::as_<Square>(*cpp2::impl::assert_not_null(s)))) << "\n";
+    std::cout << "is SmallSquare: " << (cpp2::impl::is<SmallSquare>(*cpp2::impl::assert_not_null(s))) << "\n";
+    std::cout << "is Circle: " << (cpp2::impl::is<Circle>(*cpp2::impl::assert_not_null(cpp2::move(s)))) << "\n";
+}
+
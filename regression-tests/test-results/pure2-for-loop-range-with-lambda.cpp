@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-for-loop-range-with-lambda.cpp2"
 
@@ -14,7 +16,6 @@
 #line 1 "pure2-for-loop-range-with-lambda.cpp2"
 [[nodiscard]] auto first(auto&& f, [[maybe_unused]] auto&& ...unnamed_param_2) -> decltype(auto);
 
-#line 3 "pure2-for-loop-range-with-lambda.cpp2"
 auto main(int const argc_, char** argv_) -> int;
 
 //=== Cpp2 function definitions =================================================
@@ -22,7 +23,6 @@ auto main(int const argc_, char** argv_) -> int;
 #line 1 "pure2-for-loop-range-with-lambda.cpp2"
 [[nodiscard]] auto first(auto&& f, [[maybe_unused]] auto&& ...unnamed_param_2) -> decltype(auto) { return CPP2_FORWARD(f);  }
 
-#line 3 "pure2-for-loop-range-with-lambda.cpp2"
 auto main(int const argc_, char** argv_) -> int{
    auto const args = cpp2::make_args(argc_, argv_); 
 #line 4 "pure2-for-loop-range-with-lambda.cpp2"
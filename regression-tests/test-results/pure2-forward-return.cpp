@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-forward-return.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-forward-return.cpp2"
 
-#line 2 "pure2-forward-return.cpp2"
 [[nodiscard]] auto first(auto&& rng) -> decltype(auto);
 
 #line 7 "pure2-forward-return.cpp2"
@@ -26,18 +27,14 @@ extern int const global;
 
 #line 1 "pure2-forward-return.cpp2"
 
-#line 2 "pure2-forward-return.cpp2"
 [[nodiscard]] auto first(auto&& rng) -> decltype(auto) { 
     if (cpp2::bounds_safety.is_active() && !(!(std::empty(rng))) ) { cpp2::bounds_safety.report_violation(""); }
 
-#line 5 "pure2-forward-return.cpp2"
     return *cpp2::impl::assert_not_null(std::begin(CPP2_FORWARD(rng)));  }
 
 int const global {42}; 
-#line 8 "pure2-forward-return.cpp2"
 [[nodiscard]] auto f() -> int const&{return global; }
 
-#line 10 "pure2-forward-return.cpp2"
 [[nodiscard]] auto main() -> int{
     std::vector v {1, 2, 3}; 
     first(v) = 4;
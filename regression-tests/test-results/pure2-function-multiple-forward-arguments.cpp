@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-function-multiple-forward-arguments.cpp2"
 
@@ -27,7 +29,6 @@ requires (std::is_convertible_v<CPP2_TYPEOF(s1), std::add_const_t<std::string>&>
     std::cout << CPP2_FORWARD(s1) << CPP2_FORWARD(s2) << CPP2_FORWARD(s3) << std::endl;
 }
 
-#line 5 "pure2-function-multiple-forward-arguments.cpp2"
 auto main() -> int{
     std::string b {"b"}; 
     std::string c {"c"}; 
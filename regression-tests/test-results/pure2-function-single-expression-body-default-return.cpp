@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-function-single-expression-body-default-return.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-function-single-expression-body-default-return.cpp2"
 
-#line 2 "pure2-function-single-expression-body-default-return.cpp2"
 [[nodiscard]] auto f() -> decltype(auto);
 
 auto g2() -> void;
@@ -27,18 +28,13 @@ auto main() -> int;
 
 #line 1 "pure2-function-single-expression-body-default-return.cpp2"
 
-#line 2 "pure2-function-single-expression-body-default-return.cpp2"
 [[nodiscard]] auto f() -> decltype(auto) { return std::cout << "hi";  }
 
-#line 4 "pure2-function-single-expression-body-default-return.cpp2"
 auto g2() -> void{}
-#line 5 "pure2-function-single-expression-body-default-return.cpp2"
 [[nodiscard]] auto g() -> decltype(auto) { return g2();  }
 
-#line 7 "pure2-function-single-expression-body-default-return.cpp2"
 [[nodiscard]] auto h() -> decltype(auto) { return cpp2::impl::cmp_greater(2,0);  }
 
-#line 9 "pure2-function-single-expression-body-default-return.cpp2"
 auto main() -> int{
     f() << " ho";
     static_assert(std::is_same_v<decltype(g()),void>);
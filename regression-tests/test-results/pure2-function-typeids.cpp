@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-function-typeids.cpp2"
 
@@ -15,7 +17,6 @@
 
 //  --- Scaffolding
 
-#line 4 "pure2-function-typeids.cpp2"
 auto f() -> void;
 
 auto g_in(      cpp2::impl::in<std::string> s) -> void;
@@ -45,25 +46,16 @@ auto main() -> int;
 #line 4 "pure2-function-typeids.cpp2"
 auto f() -> void{std::cout << "hello world!\n"; }
 
-#line 6 "pure2-function-typeids.cpp2"
 auto g_in(      cpp2::impl::in<std::string> s) -> void{std::cout << "Come in, " + cpp2::to_string(s) + "\n";}
-#line 7 "pure2-function-typeids.cpp2"
 auto g_inout(std::string& s) -> void{std::cout << "Come in awhile, but take some biscuits on your way out, " + cpp2::to_string(s) + "!\n"; }
-#line 8 "pure2-function-typeids.cpp2"
 auto g_out(cpp2::impl::out<std::string> s) -> void{s.construct("A Powerful Mage");}
-#line 9 "pure2-function-typeids.cpp2"
 auto g_move(std::string&& s) -> void{std::cout << "I hear you've moving, " + cpp2::to_string(cpp2::move(s)) + "?\n";}
 
-#line 11 "pure2-function-typeids.cpp2"
 [[nodiscard]] auto h_forward(std::string& s) -> std::string&{std::cout << "Inout " + cpp2::to_string(s) + " ... "; return s; }
-#line 12 "pure2-function-typeids.cpp2"
 [[nodiscard]] auto h_out(cpp2::impl::in<std::string> s) -> std::string{std::cout << "In " + cpp2::to_string(s) + " ... ";return "yohoho"; }
 
-#line 14 "pure2-function-typeids.cpp2"
 [[nodiscard]] auto f1(cpp2::impl::in<std::function<int(cpp2::impl::in<int> x)>> a) -> int { return a(1);  }
-#line 15 "pure2-function-typeids.cpp2"
 [[nodiscard]] auto f2(int(*a)(cpp2::impl::in<int> x)) -> int { return a(2); }
-#line 16 "pure2-function-typeids.cpp2"
 [[nodiscard]] auto g   (cpp2::impl::in<int> x) -> int { return x + 42; }
 
 #line 24 "pure2-function-typeids.cpp2"
@@ -0,0 +1,89 @@
+
+#define CPP2_IMPORT_STD          Yes
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-hashable-bytewise.cpp2"
+class pod;
+    
+
+#line 6 "pure2-hashable-bytewise.cpp2"
+class padded;
+    
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-hashable-bytewise.cpp2"
+class pod {
+    public: cpp2::i32 a; 
+    public: cpp2::i32 b; 
+    public: pod(auto&& a_, auto&& b_)
+CPP2_REQUIRES_ (std::is_convertible_v<CPP2_TYPEOF(a_), std::add_const_t<cpp2::i32>&> && std::is_convertible_v<CPP2_TYPEOF(b_), std::add_const_t<cpp2::i32>&>) ;
+public: [[nodiscard]] auto hash() const& -> size_t;
+
+#line 4 "pure2-hashable-bytewise.cpp2"
+};
+
+class padded {
+    public: char c; 
+    public: cpp2::i64 n; 
+    public: padded(auto&& c_, auto&& n_)
+CPP2_REQUIRES_ (std::is_convertible_v<CPP2_TYPEOF(c_), std::add_const_t<char>&> && std::is_convertible_v<CPP2_TYPEOF(n_), std::add_const_t<cpp2::i64>&>) ;
+public: [[nodiscard]] auto hash() const& -> size_t;
+
+#line 9 "pure2-hashable-bytewise.cpp2"
+};
+
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-hashable-bytewise.cpp2"
+
+
+pod::pod(auto&& a_, auto&& b_)
+requires (std::is_convertible_v<CPP2_TYPEOF(a_), std::add_const_t<cpp2::i32>&> && std::is_convertible_v<CPP2_TYPEOF(b_), std::add_const_t<cpp2::i32>&>) 
+                                                                             : a{ CPP2_FORWARD(a_) }
+                                                                             , b{ CPP2_FORWARD(b_) }{}
+[[nodiscard]] auto pod::hash() const& -> size_t{
+if constexpr (std::has_unique_object_representations_v<pod>) {
+return cpp2::hash_bytes((*this)); 
+}
+
+size_t ret {0}; 
+cpp2::hash_combine(ret, std::hash<cpp2::i32>()(a));
+cpp2::hash_combine(ret, std::hash<cpp2::i32>()(b));
+return ret; 
+}
+
+padded::padded(auto&& c_, auto&& n_)
+requires (std::is_convertible_v<CPP2_TYPEOF(c_), std::add_const_t<char>&> && std::is_convertible_v<CPP2_TYPEOF(n_), std::add_const_t<cpp2::i64>&>) 
+                                                                              : c{ CPP2_FORWARD(c_) }
+                                                                              , n{ CPP2_FORWARD(n_) }{}
+[[nodiscard]] auto padded::hash() const& -> size_t{
+if constexpr (std::has_unique_object_representations_v<padded>) {
+return cpp2::hash_bytes((*this)); 
+}
+
+size_t ret {0}; 
+cpp2::hash_combine(ret, std::hash<char>()(c));
+cpp2::hash_combine(ret, std::hash<cpp2::i64>()(n));
+return ret; 
+}
+#line 11 "pure2-hashable-bytewise.cpp2"
+auto main() -> int{
+    pod x {1, 2}; 
+    pod y {1, 2}; 
+    pod z {1, 3}; 
+    padded p {'a', 42}; 
+    padded q {'a', 42}; 
+    std::cout << "equal pods hash equal:   " << (x.hash() == cpp2::move(y).hash()) << "\n";
+    std::cout << "unequal pods differ:     " << (cpp2::move(x).hash() != cpp2::move(z).hash()) << "\n";
+    std::cout << "padded still memberwise: " << (cpp2::move(p).hash() == cpp2::move(q).hash()) << "\n";
+}
+
@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-hashable.cpp2"
 class base;
-#line 2 "pure2-hashable.cpp2"
     
 
 #line 5 "pure2-hashable.cpp2"
@@ -19,7 +20,6 @@ class mystruct;
 
 #line 1 "pure2-hashable.cpp2"
 class base {
-#line 2 "pure2-hashable.cpp2"
     public: cpp2::i32 h; 
     public: base(auto&& h_)
 CPP2_REQUIRES_ (std::is_convertible_v<CPP2_TYPEOF(h_), std::add_const_t<cpp2::i32>&>) ;
@@ -58,6 +58,9 @@ requires (std::is_convertible_v<CPP2_TYPEOF(h_), std::add_const_t<cpp2::i32>&>)
                                                            h = CPP2_FORWARD(h_);
                                                            return *this;}
 [[nodiscard]] auto base::hash() const& -> size_t{
+if constexpr (std::has_unique_object_representations_v<base>) {
+return cpp2::hash_bytes((*this)); 
+}
 
 size_t ret {0}; 
 cpp2::hash_combine(ret, std::hash<cpp2::i32>()(h));
@@ -71,6 +74,9 @@ requires (std::is_convertible_v<CPP2_TYPEOF(i_), std::add_const_t<cpp2::i32>&> &
                                                                                                        , j{ CPP2_FORWARD(j_) }
                                                                                                        , k{ CPP2_FORWARD(k_) }{}
 [[nodiscard]] auto mystruct::hash() const& -> size_t{
+if constexpr (std::has_unique_object_representations_v<mystruct>) {
+return cpp2::hash_bytes((*this)); 
+}
 
 size_t ret {0}; 
 cpp2::hash_combine(ret, base::hash());
@@ -82,6 +88,9 @@ return ret;
 #line 12 "pure2-hashable.cpp2"
 auto main() -> int{
     mystruct x {2, "three", 4u}; 
-    std::cout << CPP2_UFCS(hash)(cpp2::move(x));
+    mystruct y {2, "three", 4u}; 
+    mystruct z {2, "three", 5u}; 
+    std::cout << "equal values hash equal: " << (CPP2_UFCS(hash)(x) == CPP2_UFCS(hash)(cpp2::move(y))) << "\n";
+    std::cout << "unequal values differ:   " << (CPP2_UFCS(hash)(cpp2::move(x)) != CPP2_UFCS(hash)(cpp2::move(z))) << "\n";
 }
 
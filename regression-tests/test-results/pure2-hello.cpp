@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-hello.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-hello.cpp2"
 
-#line 2 "pure2-hello.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 6 "pure2-hello.cpp2"
@@ -26,19 +27,16 @@ auto decorate(std::string& s) -> void;
 
 #line 1 "pure2-hello.cpp2"
 
-#line 2 "pure2-hello.cpp2"
 [[nodiscard]] auto main() -> int{
     std::cout << "Hello " << name() << "\n";
 }
 
-#line 6 "pure2-hello.cpp2"
 [[nodiscard]] auto name() -> std::string{
     std::string s {"world"}; 
     decorate(s);
     return s; 
 }
 
-#line 12 "pure2-hello.cpp2"
 auto decorate(std::string& s) -> void{
     s = "[" + s + "]";
 }
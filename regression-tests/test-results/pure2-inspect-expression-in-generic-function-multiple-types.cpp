@@ -21,7 +21,6 @@ auto test_generic(auto const& x, auto const& msg) -> void;
 
 #line 1 "pure2-inspect-expression-in-generic-function-multiple-types.cpp2"
 [[nodiscard]] auto main() -> int{
-#line 2 "pure2-inspect-expression-in-generic-function-multiple-types.cpp2"
     std::variant<int,int,double> v {42.0}; 
     std::any a {cpp2::impl::as_<std::string>("xyzzy")}; 
     std::optional<int> o {}; 
@@ -40,7 +39,6 @@ auto test_generic(auto const& x, auto const& msg) -> void;
     test_generic(cpp2::move(o), "optional<int>");
 }
 
-#line 20 "pure2-inspect-expression-in-generic-function-multiple-types.cpp2"
 auto test_generic(auto const& x, auto const& msg) -> void{
     std::cout 
         << std::setw(30) << msg 
@@ -48,7 +46,7 @@ auto test_generic(auto const& x, auto const& msg) -> void{
         << [&] () -> std::string { auto&& _expr = x;
             if (cpp2::impl::is<int>(_expr)) { if constexpr( requires{"integer " + std::to_string(cpp2::impl::as<int>(x));} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("integer " + std::to_string(cpp2::impl::as<int>(x)))),std::string> ) return "integer " + std::to_string(cpp2::impl::as<int>(x)); else return std::string{}; else return std::string{}; }
             else if (cpp2::impl::is<std::string>(_expr)) { if constexpr( requires{'"' + cpp2::impl::as<std::string>(x) + '"';} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(('"' + cpp2::impl::as<std::string>(x) + '"')),std::string> ) return '"' + cpp2::impl::as<std::string>(x) + '"'; else return std::string{}; else return std::string{}; }
-            else return "not an int or string"; }
+            else return [&] () CPP2_COLD_LAMBDA -> std::string { return "not an int or string"; } (); }
         () 
         << "\n";
 }
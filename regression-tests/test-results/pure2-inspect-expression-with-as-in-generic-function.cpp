@@ -21,20 +21,18 @@ auto print_an_int(auto const& x) -> void;
 
 #line 1 "pure2-inspect-expression-with-as-in-generic-function.cpp2"
 [[nodiscard]] auto main() -> int{
-#line 2 "pure2-inspect-expression-with-as-in-generic-function.cpp2"
     print_an_int("syzygy");
     print_an_int(1);
     print_an_int(1.1);
 }
 
-#line 7 "pure2-inspect-expression-with-as-in-generic-function.cpp2"
 auto print_an_int(auto const& x) -> void{
     std::cout 
         << std::setw(30) << cpp2::to_string(x) 
         << " value is " 
         << [&] () -> std::string { auto&& _expr = x;
             if (cpp2::impl::is<int>(_expr)) { if constexpr( requires{std::to_string(cpp2::impl::as<int>(x));} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((std::to_string(cpp2::impl::as<int>(x)))),std::string> ) return std::to_string(cpp2::impl::as<int>(x)); else return std::string{}; else return std::string{}; }
-            else return "not an int"; }
+            else return [&] () CPP2_COLD_LAMBDA -> std::string { return "not an int"; } (); }
         () 
         << "\n";
 }
@@ -13,7 +13,6 @@
 
 #line 1 "pure2-inspect-fallback-with-variant-any-optional.cpp2"
 
-#line 2 "pure2-inspect-fallback-with-variant-any-optional.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 14 "pure2-inspect-fallback-with-variant-any-optional.cpp2"
@@ -23,7 +22,6 @@ auto test_generic(auto const& x, auto const& msg) -> void;
 
 #line 1 "pure2-inspect-fallback-with-variant-any-optional.cpp2"
 
-#line 2 "pure2-inspect-fallback-with-variant-any-optional.cpp2"
 [[nodiscard]] auto main() -> int{
     std::variant<int,int,std::string> v {cpp2::impl::as_<std::string>("xyzzy")}; 
     std::any a {cpp2::impl::as_<std::string>("xyzzy")}; 
@@ -36,7 +34,6 @@ auto test_generic(auto const& x, auto const& msg) -> void;
     test_generic(cpp2::move(o), "optional<string>");
 }
 
-#line 14 "pure2-inspect-fallback-with-variant-any-optional.cpp2"
 auto test_generic(auto const& x, auto const& msg) -> void{
     std::cout 
         << "\n" << msg << "\n    ..." 
@@ -45,7 +42,7 @@ auto test_generic(auto const& x, auto const& msg) -> void{
             else if (cpp2::impl::is<std::variant<int,std::string>>(_expr)) { if constexpr( requires{" matches std::variant<int, std::string>";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((" matches std::variant<int, std::string>")),std::string> ) return " matches std::variant<int, std::string>"; else return std::string{}; else return std::string{}; }
             else if (cpp2::impl::is<std::any>(_expr)) { if constexpr( requires{" matches std::any";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((" matches std::any")),std::string> ) return " matches std::any"; else return std::string{}; else return std::string{}; }
             else if (cpp2::impl::is<std::optional<std::string>>(_expr)) { if constexpr( requires{" matches std::optional<std::string>";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((" matches std::optional<std::string>")),std::string> ) return " matches std::optional<std::string>"; else return std::string{}; else return std::string{}; }
-            else return " no match"; }
+            else return [&] () CPP2_COLD_LAMBDA -> std::string { return " no match"; } (); }
         () 
         << "\n";
 }
@@ -13,7 +13,6 @@
 
 #line 1 "pure2-inspect-generic-void-empty-with-variant-any-optional.cpp2"
 
-#line 2 "pure2-inspect-generic-void-empty-with-variant-any-optional.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 18 "pure2-inspect-generic-void-empty-with-variant-any-optional.cpp2"
@@ -23,7 +22,6 @@ auto test_generic(auto const& x, auto const& msg) -> void;
 
 #line 1 "pure2-inspect-generic-void-empty-with-variant-any-optional.cpp2"
 
-#line 2 "pure2-inspect-generic-void-empty-with-variant-any-optional.cpp2"
 [[nodiscard]] auto main() -> int{
     std::unique_ptr<int> p {}; 
     std::vector<int>::iterator i {}; 
@@ -40,13 +38,12 @@ auto test_generic(auto const& x, auto const& msg) -> void;
     test_generic(cpp2::move(o), "optional<string>");
 }
 
-#line 18 "pure2-inspect-generic-void-empty-with-variant-any-optional.cpp2"
 auto test_generic(auto const& x, auto const& msg) -> void{
     std::cout 
         << "\n" << msg << "\n    ..." 
         << [&] () -> std::string { auto&& _expr = x;
             if (cpp2::impl::is<void>(_expr)) { if constexpr( requires{" VOYDE AND EMPTIE";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((" VOYDE AND EMPTIE")),std::string> ) return " VOYDE AND EMPTIE"; else return std::string{}; else return std::string{}; }
-            else return " no match"; }
+            else return [&] () CPP2_COLD_LAMBDA -> std::string { return " no match"; } (); }
         () 
         << "\n";
 }
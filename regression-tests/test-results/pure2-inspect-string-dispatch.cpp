@@ -0,0 +1,63 @@
+
+#define CPP2_IMPORT_STD          Yes
+
+//=== Cpp2 type declarations ====================================================
+
+
+#include "cpp2util.h"
+
+#line 1 "pure2-inspect-string-dispatch.cpp2"
+
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-inspect-string-dispatch.cpp2"
+//  The alternatives are all plain string literals, so the lowering
+//  dispatches through a compile-time sorted table instead of
+//  comparing each literal in turn
+
+[[nodiscard]] auto describe(cpp2::impl::in<std::string> cmd) -> std::string;
+
+#line 16 "pure2-inspect-string-dispatch.cpp2"
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-inspect-string-dispatch.cpp2"
+
+#line 5 "pure2-inspect-string-dispatch.cpp2"
+[[nodiscard]] auto describe(cpp2::impl::in<std::string> cmd) -> std::string{
+    return [&] () -> std::string { auto&& _expr = cmd; static constexpr auto _alts = cpp2::impl::string_dispatch_table<5>({"help", "version", "build", "test", "clean"}); auto _match = _alts.find(_expr); 
+        if (_match == 0) { if constexpr( requires{"show help";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("show help")),std::string> ) return "show help"; else return std::string{}; else return std::string{}; }
+        else if (_match == 1) { if constexpr( requires{"show version";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("show version")),std::string> ) return "show version"; else return std::string{}; else return std::string{}; }
+        else if (_match == 2) { if constexpr( requires{"run build";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("run build")),std::string> ) return "run build"; else return std::string{}; else return std::string{}; }
+        else if (_match == 3) { if constexpr( requires{"run tests";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("run tests")),std::string> ) return "run tests"; else return std::string{}; else return std::string{}; }
+        else if (_match == 4) { if constexpr( requires{"clean tree";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("clean tree")),std::string> ) return "clean tree"; else return std::string{}; else return std::string{}; }
+        else return [&] () CPP2_COLD_LAMBDA -> std::string { return "unknown"; } (); }
+    (); 
+}
+
+auto main() -> int{
+    std::cout << describe("build") << "\n";
+    std::cout << describe("version") << "\n";
+    std::cout << describe("nope") << "\n";
+
+    //  A variant inspected against string literals takes the
+    //  sequential fallback inside the same table
+    std::variant<int,std::string> v {"test"}; 
+    std::cout << [&] () -> std::string { auto&& _expr = cpp2::move(v); static constexpr auto _alts = cpp2::impl::string_dispatch_table<4>({"help", "test", "build", "clean"}); auto _match = _alts.find(_expr); 
+        if (_match == 0) { if constexpr( requires{"h";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("h")),std::string> ) return "h"; else return std::string{}; else return std::string{}; }
+        else if (_match == 1) { if constexpr( requires{"t";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("t")),std::string> ) return "t"; else return std::string{}; else return std::string{}; }
+        else if (_match == 2) { if constexpr( requires{"b";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("b")),std::string> ) return "b"; else return std::string{}; else return std::string{}; }
+        else if (_match == 3) { if constexpr( requires{"c";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("c")),std::string> ) return "c"; else return std::string{}; else return std::string{}; }
+        else return [&] () CPP2_COLD_LAMBDA -> std::string { return "?"; } (); }
+    () << "\n";
+
+    //  Below the size threshold the straightforward form is kept
+    std::cout << [&] () -> std::string { auto&& _expr = std::string("b");
+        if (cpp2::impl::is(_expr, "a")) { if constexpr( requires{"A";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("A")),std::string> ) return "A"; else return std::string{}; else return std::string{}; }
+        else if (cpp2::impl::is(_expr, "b")) { if constexpr( requires{"B";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("B")),std::string> ) return "B"; else return std::string{}; else return std::string{}; }
+        else return [&] () CPP2_COLD_LAMBDA -> std::string { return "?"; } (); }
+    () << "\n";
+}
+
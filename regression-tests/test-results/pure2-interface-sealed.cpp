@@ -0,0 +1,109 @@
+
+#define CPP2_IMPORT_STD          Yes
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-interface-sealed.cpp2"
+class Shape;
+    
+
+#line 6 "pure2-interface-sealed.cpp2"
+class Circle;
+    
+
+#line 12 "pure2-interface-sealed.cpp2"
+class Square;
+    
+
+#line 18 "pure2-interface-sealed.cpp2"
+class printer;
+    
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-interface-sealed.cpp2"
+class Shape {
+    public: [[nodiscard]] virtual auto area() const -> double = 0;
+    public: [[nodiscard]] virtual auto name() const -> std::string = 0;
+    public: virtual ~Shape() noexcept;
+public: template<typename Visitor> [[nodiscard]] static auto visit(Shape& obj, Visitor&& v) -> auto;
+
+    public: Shape() = default;
+    public: Shape(Shape const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(Shape const&) -> void = delete;
+
+#line 4 "pure2-interface-sealed.cpp2"
+};
+
+class Circle final: public Shape {
+
+    public: [[nodiscard]] auto area() const -> double override;
+    public: [[nodiscard]] auto name() const -> std::string override;
+    public: Circle() = default;
+    public: Circle(Circle const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(Circle const&) -> void = delete;
+
+#line 10 "pure2-interface-sealed.cpp2"
+};
+
+class Square final: public Shape {
+
+    public: [[nodiscard]] auto area() const -> double override;
+    public: [[nodiscard]] auto name() const -> std::string override;
+    public: Square() = default;
+    public: Square(Square const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(Square const&) -> void = delete;
+
+#line 16 "pure2-interface-sealed.cpp2"
+};
+
+class printer {
+    public: auto operator()(auto const& s) const& -> void;
+    public: printer() = default;
+    public: printer(printer const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(printer const&) -> void = delete;
+
+
+#line 22 "pure2-interface-sealed.cpp2"
+};
+
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-interface-sealed.cpp2"
+
+
+Shape::~Shape() noexcept{}
+template<typename Visitor> [[nodiscard]] auto Shape::visit(Shape& obj, Visitor&& v) -> auto{
+if (cpp2::impl::is<Circle>(obj)) {return v(cpp2::impl::as_<Circle>(obj)); }
+return CPP2_FORWARD(v)(cpp2::impl::as_<Square>(obj)); 
+}
+    [[nodiscard]] auto Circle::area() const -> double { return 3.14;  }
+    [[nodiscard]] auto Circle::name() const -> std::string { return "circle";  }
+
+#line 14 "pure2-interface-sealed.cpp2"
+    [[nodiscard]] auto Square::area() const -> double { return 4.0;  }
+    [[nodiscard]] auto Square::name() const -> std::string { return "square";  }
+
+#line 19 "pure2-interface-sealed.cpp2"
+    auto printer::operator()(auto const& s) const& -> void{
+        std::cout << CPP2_UFCS(name)(s) << " area " << CPP2_UFCS(area)(s) << "\n";
+    }
+
+#line 24 "pure2-interface-sealed.cpp2"
+auto main() -> int{
+    Circle c {}; 
+    Square q {}; 
+    printer p {}; 
+    Shape* s {&c}; 
+    Shape::visit(*cpp2::impl::assert_not_null(s), p);
+    s = &q;
+    Shape::visit(*cpp2::impl::assert_not_null(cpp2::move(s)), cpp2::move(p));
+}
+
@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-interpolation.cpp2"
 
-#line 2 "pure2-interpolation.cpp2"
 class item;
     
 
@@ -16,7 +17,6 @@ class item;
 
 #line 1 "pure2-interpolation.cpp2"
 
-#line 2 "pure2-interpolation.cpp2"
 class item {
     public: [[nodiscard]] auto name() const& -> std::string;
     public: [[nodiscard]] auto color() const& -> std::string;
@@ -32,11 +32,8 @@ class item {
 
 #line 3 "pure2-interpolation.cpp2"
     [[nodiscard]] auto item::name() const& -> std::string { return "Dog kennel";  }
-#line 4 "pure2-interpolation.cpp2"
     [[nodiscard]] auto item::color() const& -> std::string { return "mauve";  }
-#line 5 "pure2-interpolation.cpp2"
     [[nodiscard]] auto item::price() const& -> double { return 3.14;  }
-#line 6 "pure2-interpolation.cpp2"
     [[nodiscard]] auto item::count() const& -> int { return 42;  }
 
 #line 9 "pure2-interpolation.cpp2"
@@ -46,10 +43,10 @@ auto const& x{0};
 
 #line 11 "pure2-interpolation.cpp2"
     {
-        std::cout << "g" + cpp2::to_string(x) + "g" + cpp2::to_string(x) + "g"  << "\n";
-        std::cout << "" + cpp2::to_string(x) + "g" + cpp2::to_string(x) + "g"   << "\n";
-        std::cout << "" + cpp2::to_string(x) + "g" + cpp2::to_string(x) + ""    << "\n";
-        std::cout << "" + cpp2::to_string(x) + cpp2::to_string(x) + ""     << "\n";
+        std::cout << "g" + cpp2::string_build(cpp2::interp(x), "g", cpp2::interp(x)) + "g"  << "\n";
+        std::cout << "" + cpp2::string_build(cpp2::interp(x), "g", cpp2::interp(x)) + "g"   << "\n";
+        std::cout << "" + cpp2::string_build(cpp2::interp(x), "g", cpp2::interp(x)) + ""    << "\n";
+        std::cout << "" + cpp2::string_build(cpp2::interp(x), cpp2::interp(x)) + ""     << "\n";
         std::cout << "\"" + cpp2::to_string(x) + "\""     << "\n";
         std::cout << "\"" + cpp2::to_string(x) + ""       << "\n";
         std::cout << "\""           << "\n";
@@ -66,7 +63,7 @@ auto const& x{item()};
     {
         std::cout << std::left << std::setw(20) << CPP2_UFCS(name)(x) << " color " << std::left << std::setw(10) << CPP2_UFCS(color)(x) << " price " << std::setw(10) << std::setprecision(3) << CPP2_UFCS(price)(x) << " in stock = " << std::boolalpha << (cpp2::impl::cmp_greater(CPP2_UFCS(count)(x),0)) << "\n";
 
-        std::cout << "" + cpp2::to_string(CPP2_UFCS(name)(x), "{:20}") + " color " + cpp2::to_string(CPP2_UFCS(color)(x), "{:10}") + " price " + cpp2::to_string(CPP2_UFCS(price)(x), "{: <10.2f}") + " in stock = " + cpp2::to_string(cpp2::impl::cmp_greater(CPP2_UFCS(count)(x),0)) + "\n";
+        std::cout << "" + cpp2::string_build(cpp2::interp(CPP2_UFCS(name)(x), "{:20}"), " color ", cpp2::interp(CPP2_UFCS(color)(x), "{:10}"), " price ", cpp2::interp(CPP2_UFCS(price)(x), "{: <10.2f}"), " in stock = ", cpp2::interp(cpp2::impl::cmp_greater(CPP2_UFCS(count)(x),0))) + "\n";
     }
 }
 
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-intro-example-hello-2022.cpp2"
 
@@ -24,7 +26,6 @@ auto print_it(auto const& x, auto const& len) -> void;
 
 #line 1 "pure2-intro-example-hello-2022.cpp2"
 [[nodiscard]] auto main() -> int{
-#line 2 "pure2-intro-example-hello-2022.cpp2"
     std::vector<std::string> vec {
             "hello", "2022"}; 
 
@@ -34,13 +35,11 @@ auto print_it(auto const& x, auto const& len) -> void;
     }
 }
 
-#line 11 "pure2-intro-example-hello-2022.cpp2"
 [[nodiscard]] auto decorate(auto& x) -> int{
     x = "[" + x + "]";
     return CPP2_UFCS(ssize)(x); 
 }
 
-#line 16 "pure2-intro-example-hello-2022.cpp2"
 auto print_it(auto const& x, auto const& len) -> void{
     std::cout 
         << ">> " << x 
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-intro-example-three-loops.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-intro-example-three-loops.cpp2"
 
-#line 2 "pure2-intro-example-three-loops.cpp2"
 auto print(auto const& x) -> void;
 
 #line 6 "pure2-intro-example-three-loops.cpp2"
@@ -29,18 +30,15 @@ auto decorate_and_print(auto& x) -> void;
 
 #line 1 "pure2-intro-example-three-loops.cpp2"
 
-#line 2 "pure2-intro-example-three-loops.cpp2"
 auto print(auto const& x) -> void{
     std::cout << ">> " << x << "\n";
 }
 
-#line 6 "pure2-intro-example-three-loops.cpp2"
 auto decorate_and_print(auto& x) -> void{
     x = "[" + x + "]";
     print(x);
 }
 
-#line 11 "pure2-intro-example-three-loops.cpp2"
 [[nodiscard]] auto main() -> int{
     std::vector<std::string> words {
         "hello", "big", "world"}; 
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-is-with-free-functions-predicate.cpp2"
 
@@ -30,7 +32,6 @@ auto fun(auto const& v) -> void;
 
 #line 1 "pure2-is-with-free-functions-predicate.cpp2"
 auto fun(auto const& v) -> void{
-#line 2 "pure2-is-with-free-functions-predicate.cpp2"
     if (cpp2::impl::is(v, (pred_i))) {
         std::cout << "" + cpp2::to_string(v) + " is integer bigger than 3" << std::endl;
     }
@@ -44,24 +45,20 @@ auto fun(auto const& v) -> void{
     }
 }
 
-#line 15 "pure2-is-with-free-functions-predicate.cpp2"
 [[nodiscard]] auto main() -> int{
     fun(3.14);
     fun(42);
     fun('a');
 }
 
-#line 21 "pure2-is-with-free-functions-predicate.cpp2"
 [[nodiscard]] auto pred_i(cpp2::impl::in<int> x) -> bool{
     return cpp2::impl::cmp_greater(x,3); 
 }
 
-#line 25 "pure2-is-with-free-functions-predicate.cpp2"
 [[nodiscard]] auto pred_d(cpp2::impl::in<double> x) -> bool{
     return cpp2::impl::cmp_greater(x,3); 
 }
 
-#line 29 "pure2-is-with-free-functions-predicate.cpp2"
 [[nodiscard]] auto pred_(auto const& x) -> bool{
     return cpp2::impl::cmp_greater(x,3); 
 }
@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-is-with-polymorphic-types.cpp2"
 class A;
-#line 2 "pure2-is-with-polymorphic-types.cpp2"
 
 template<int I> class VA;
 
@@ -83,7 +84,6 @@ auto fun(auto const& v, auto const& name) -> void{
     std::cout << std::endl;
 }
 
-#line 29 "pure2-is-with-polymorphic-types.cpp2"
 auto main() -> int{
 
     VC vc {}; 
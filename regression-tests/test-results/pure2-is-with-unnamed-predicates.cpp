@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-is-with-unnamed-predicates.cpp2"
 
@@ -21,7 +23,6 @@ auto fun(auto const& v) -> void;
 
 #line 1 "pure2-is-with-unnamed-predicates.cpp2"
 auto fun(auto const& v) -> void{
-#line 2 "pure2-is-with-unnamed-predicates.cpp2"
     if (cpp2::impl::is(v, ([](cpp2::impl::in<int> x) -> decltype(auto) { return cpp2::impl::cmp_greater(x,3); }))) {
         std::cout << "" + cpp2::to_string(v) + " is integer bigger than 3" << std::endl;
     }
@@ -35,7 +36,6 @@ auto fun(auto const& v) -> void{
     }
 }
 
-#line 15 "pure2-is-with-unnamed-predicates.cpp2"
 [[nodiscard]] auto main() -> int{
     fun(3.14);
     fun(42);
@@ -45,7 +45,6 @@ class WithGenOp {
     public: auto operator=(WithGenOp const&) -> void = delete;
 
 
-#line 37 "pure2-is-with-variable-and-value.cpp2"
 };
 
 class Cmp {
@@ -62,7 +61,6 @@ class Cmp {
 
 #line 1 "pure2-is-with-variable-and-value.cpp2"
 auto fun(auto const& name, auto const& v) -> void{
-#line 2 "pure2-is-with-variable-and-value.cpp2"
     std::cout << name << ": " << 
                 [&] () -> std::string { auto&& _expr = v;
                 if (cpp2::impl::is(_expr, (42))) { if constexpr( requires{"42";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("42")),std::string> ) return "42"; else return std::string{}; else return std::string{}; }
@@ -70,12 +68,11 @@ auto fun(auto const& name, auto const& v) -> void{
                 else if (cpp2::impl::is(_expr, -123)) { if constexpr( requires{"generic op_is";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("generic op_is")),std::string> ) return "generic op_is"; else return std::string{}; else return std::string{}; }
                 else if (cpp2::impl::is(_expr, 4321)) { if constexpr( requires{"comparable";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("comparable")),std::string> ) return "comparable"; else return std::string{}; else return std::string{}; }
                 else if (cpp2::impl::is(_expr, "text")) { if constexpr( requires{"text";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("text")),std::string> ) return "text"; else return std::string{}; else return std::string{}; }
-                else return "unknown"; }
+                else return [&] () CPP2_COLD_LAMBDA -> std::string { return "unknown"; } (); }
               () 
               << std::endl;
 }
 
-#line 14 "pure2-is-with-variable-and-value.cpp2"
 [[nodiscard]] auto main() -> int{
     fun("3.14", 3.14);
     fun("42", 42);
@@ -77,7 +77,6 @@ class types;
 
 #line 1 "pure2-last-use.cpp2"
 auto f_inout([[maybe_unused]] auto& unnamed_param_1) -> void;
-#line 2 "pure2-last-use.cpp2"
 auto f_copy([[maybe_unused]] auto ...unnamed_param_1) -> void;
 [[nodiscard]] auto pred([[maybe_unused]] auto const& ...unnamed_param_1) -> decltype(auto);
 [[nodiscard]] auto pred_copy([[maybe_unused]] auto ...unnamed_param_1) -> decltype(auto);
@@ -252,7 +251,6 @@ CPP2_REQUIRES_ (std::is_convertible_v<CPP2_TYPEOF(a_), std::add_const_t<std::uni
 
 #line 258 "pure2-last-use.cpp2"
                            // OK: No error about 'a' being unused.
-#line 259 "pure2-last-use.cpp2"
 };
 
 extern int gi;
@@ -541,7 +539,6 @@ CPP2_REQUIRES_ (std::is_convertible_v<CPP2_TYPEOF(x_), std::add_const_t<std::uni
 //     do (_)
 //     { }
 //   }
-#line 986 "pure2-last-use.cpp2"
 };
 
 auto skip_hidden_names() -> void;
@@ -553,13 +550,9 @@ auto main(int const argc_, char** argv_) -> int;
 
 #line 1 "pure2-last-use.cpp2"
 auto f_inout([[maybe_unused]] auto& unnamed_param_1) -> void{}
-#line 2 "pure2-last-use.cpp2"
 auto f_copy([[maybe_unused]] auto ...unnamed_param_1) -> void{}
-#line 3 "pure2-last-use.cpp2"
 [[nodiscard]] auto pred([[maybe_unused]] auto const& ...unnamed_param_1) -> decltype(auto) { return true; }
-#line 4 "pure2-last-use.cpp2"
 [[nodiscard]] auto pred_copy([[maybe_unused]] auto ...unnamed_param_1) -> decltype(auto) { return true;  }
-#line 5 "pure2-last-use.cpp2"
 template<typename T> [[nodiscard]] constexpr auto identity(T&& x) -> decltype(auto)
 requires (std::is_reference_v<T>) {return CPP2_FORWARD(x); }
 #line 6 "pure2-last-use.cpp2"
@@ -625,7 +618,7 @@ auto issue_313() -> void{
     auto k {cpp2_new<int>(0)}; 
     static_cast<void>([&] () -> int { auto&& _expr = *cpp2::impl::assert_not_null(identity(j)) + *cpp2::impl::assert_not_null(identity(j));
         if (cpp2::impl::is(_expr, (*cpp2::impl::assert_not_null(identity(k)) + *cpp2::impl::assert_not_null(identity(k))))) { if constexpr( requires{0;} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((0)),int> ) return 0; else return int{}; else return int{}; }
-        else return 0; }
+        else return [&] () CPP2_COLD_LAMBDA -> int { return 0; } (); }
     ());
 
   }
@@ -634,7 +627,6 @@ auto issue_313() -> void{
 //     _ = :() identity(a$)* + identity(a$)*;
 //   }
 }
-#line 73 "pure2-last-use.cpp2"
 auto issue_313_1(std::unique_ptr<int> x) -> void{
                                                                                  if (cpp2::cpp2_default.is_active() && !(*cpp2::impl::assert_not_null(identity(x)) + *cpp2::impl::assert_not_null(identity(x))) ) { cpp2::cpp2_default.report_violation(""); }}
 
@@ -661,30 +653,25 @@ auto issue_683(auto const& args) -> void{
     n.construct(0);
 }
 
-#line 114 "pure2-last-use.cpp2"
 auto issue_825() -> void{
   static_cast<void>([](std::unique_ptr<int> b) -> decltype(auto) { return f_copy(std::move(cpp2::move(b)));  });
   static_cast<void>([](std::unique_ptr<int>&& c) -> decltype(auto) { return f_copy(std::move(cpp2::move(c)));  });
   static_cast<void>([](auto&& d) -> decltype(auto) { return f_copy(CPP2_FORWARD(d));  }(cpp2_new<int>(0)));
 }
 
-#line 120 "pure2-last-use.cpp2"
 auto issue_832() -> void{
   auto i {0}; 
   while( i ) {}
 }
 
-#line 125 "pure2-last-use.cpp2"
 [[nodiscard]] auto make_copy(auto x) -> auto { return cpp2::move(x);  }
 
-#line 127 "pure2-last-use.cpp2"
 auto issue_847_4(std::vector<int> v) -> void{
   for ( 
   auto x : CPP2_UFCS(make_copy)(cpp2::move(v)) ) {
     f_copy(cpp2::move(x));
   }
 }
-#line 133 "pure2-last-use.cpp2"
 auto issue_847_0(std::vector<std::unique_ptr<int>> v) -> void{
   // TODO Use 'std::views::as_rvalue`
   for ( 
@@ -699,16 +686,13 @@ auto issue_847_5(auto&& v) -> void{
     f_copy(CPP2_FORWARD(x));
   }
 }
-#line 151 "pure2-last-use.cpp2"
 auto issue_847_2(auto&& v) -> void{
   for ( 
   [[maybe_unused]] auto&& unnamed_param_1 : CPP2_UFCS(make_copy)(CPP2_FORWARD(v)) ) {
   }
 }
-#line 156 "pure2-last-use.cpp2"
 auto issue_847_3(int x) -> void{for ( [[maybe_unused]] auto const& unnamed_param_1 : { cpp2::move(x) } ) {}}
 
-#line 158 "pure2-last-use.cpp2"
 auto issue_850() -> void{
     std::vector v {1, 2, 3, 4, 5}; 
 
@@ -799,7 +783,6 @@ requires (std::is_convertible_v<CPP2_TYPEOF(A_), std::add_const_t<std::add_lvalu
                                                                                         : issue_857_7_A_as_base{ CPP2_FORWARD(A_) }
                                                                                         , std::monostate{  }{}
 
-#line 346 "pure2-last-use.cpp2"
   auto issue_857_8::d() && -> void{}
 
   issue_857_8::issue_857_8(auto&& a_, auto&& b_, auto&& c_)
@@ -869,7 +852,6 @@ issue_869_1::issue_869_1(issue_869_1 const& that)
                                                issue_869_1 res {}; CPP2_UFCS(set_i)(res, cpp2_new<int>(0));
 #line 372 "pure2-last-use.cpp2"
 return res; }
-#line 373 "pure2-last-use.cpp2"
 auto issue_884() -> void{
   static_cast<void>([]() -> void{
     auto x {cpp2_new<int>(0)}; 
@@ -1267,16 +1249,13 @@ auto issue_884() -> void{
   });
 }
 
-#line 770 "pure2-last-use.cpp2"
 auto issue_888_0(std::string r, int size) -> void{
   static_cast<void>(CPP2_UFCS_MOVE(size)(cpp2::move(r)));
 }
-#line 773 "pure2-last-use.cpp2"
 auto issue_888_1([[maybe_unused]] std::string unnamed_param_1, std::move_only_function<int([[maybe_unused]] cpp2::impl::in<int> unnamed_param_1)> size) -> void{
   static_cast<void>(CPP2_UFCS_MOVE(size)(0));
 }
 
-#line 777 "pure2-last-use.cpp2"
 auto issue_890() -> void{
   auto x {cpp2_new<int>(0)}; 
 {
@@ -1288,26 +1267,22 @@ auto const& x{cpp2_new<int>(0)};
 #line 781 "pure2-last-use.cpp2"
 }
 
-#line 783 "pure2-last-use.cpp2"
 auto issue_962(cpp2::impl::in<::std::string> s) -> void{
   using ::std::string;
   std::cout << "A: " + cpp2::to_string(s) + "" << std::endl;
 }
 
-#line 788 "pure2-last-use.cpp2"
 auto draw() -> void{
   auto pos {0}; 
   std::move_only_function<int([[maybe_unused]] cpp2::impl::in<int> unnamed_param_1)> vertex {}; 
   static_cast<void>(CPP2_UFCS_MOVE(vertex)((cpp2::move(pos))));
 }
 
-#line 794 "pure2-last-use.cpp2"
 auto enum_0() -> void{
     cpp2::impl::deferred_init<std::string> underlying_type; 
     if (true) {}
     underlying_type.construct("");
 }
-#line 799 "pure2-last-use.cpp2"
 auto enum_1() -> void{
     auto max_value {cpp2_new<int>(0)}; 
     std::reference_wrapper<std::unique_ptr<int> const> min_value {max_value}; 
@@ -1337,7 +1312,6 @@ auto enum_1() -> void{
         f_copy(std::move(cpp2::move(v)));
     } while ( *cpp2::impl::assert_not_null(identity(z)));
 }
-#line 828 "pure2-last-use.cpp2"
 auto enum_2() -> void{
     auto umax {cpp2_new<int>(0)}; 
     if (pred(umax)) {
@@ -1350,7 +1324,6 @@ auto enum_2() -> void{
 
 #line 839 "pure2-last-use.cpp2"
   auto cpp2_union::destroy() & -> void{}
-#line 840 "pure2-last-use.cpp2"
   cpp2_union::~cpp2_union() noexcept{
     destroy();
     static_cast<void>(cpp2::move((*this)));
@@ -1366,28 +1339,22 @@ requires (std::is_convertible_v<CPP2_TYPEOF(string_), std::add_const_t<std::stri
                                                                 std::unique_ptr<int> ret {};
 #line 852 "pure2-last-use.cpp2"
 return ret; }
-#line 853 "pure2-last-use.cpp2"
 auto deferred_non_copyable_0() -> void{
   cpp2::impl::deferred_init<std::unique_ptr<int>> p; 
   p.construct();
   f_copy(std::move(cpp2::move(p.value())));
 }
 
-#line 859 "pure2-last-use.cpp2"
 [[nodiscard]] auto deferred_non_copyable_1() -> auto{
   cpp2::impl::deferred_init<std::unique_ptr<int>> p; 
   p.construct();
   return std::move(cpp2::move(p.value())); 
 }
 
-#line 865 "pure2-last-use.cpp2"
 [[nodiscard]] auto deferred_non_copyable_2() -> deferred_non_copyable_2_ret{
-      cpp2::impl::deferred_init<std::unique_ptr<int>> p;
-#line 866 "pure2-last-use.cpp2"
-  p.construct();
-return std::move(p.value()); }
+  std::unique_ptr<int> p {};
+return p; }
 
-#line 869 "pure2-last-use.cpp2"
 auto loops() -> void{
   static_cast<void>([]() -> void{
     auto x {cpp2_new<int>(0)}; 
@@ -1473,7 +1440,6 @@ auto g() -> void{
 
 }
 
-#line 950 "pure2-last-use.cpp2"
 auto loops_and_captures() -> void{
   static_cast<void>([]() -> void{
     auto x {cpp2_new<int>(0)}; 
@@ -1570,7 +1536,6 @@ auto x{cpp2_new<int>(0)};
   });
 }
 
-#line 1038 "pure2-last-use.cpp2"
 auto main(int const argc_, char** argv_) -> int{
   auto const args = cpp2::make_args(argc_, argv_); 
 #line 1039 "pure2-last-use.cpp2"
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-look-up-parameter-across-unnamed-function.cpp2"
 
@@ -29,7 +31,6 @@ using g_ret = int;
 
 #line 1 "pure2-look-up-parameter-across-unnamed-function.cpp2"
 
-#line 2 "pure2-look-up-parameter-across-unnamed-function.cpp2"
 [[nodiscard]] auto f() -> f_ret{
     int ri {0};
 #line 3 "pure2-look-up-parameter-across-unnamed-function.cpp2"
@@ -39,18 +40,14 @@ using g_ret = int;
     return ri; // "return;" is implicit"
 }
 
-#line 9 "pure2-look-up-parameter-across-unnamed-function.cpp2"
 [[nodiscard]] auto g() -> g_ret{
-        cpp2::impl::deferred_init<int> ri;
-#line 10 "pure2-look-up-parameter-across-unnamed-function.cpp2"
-    ri.construct(0);
+    int ri {0};
     auto pred {[](auto const& e) -> decltype(auto) { return e == 1;  }}; 
-    ri.value() = 42;
-    cpp2::move(pred)(ri.value());
-    return std::move(ri.value()); 
+    ri = 42;
+    cpp2::move(pred)(ri);
+    return ri; 
 }
 
-#line 17 "pure2-look-up-parameter-across-unnamed-function.cpp2"
 [[nodiscard]] auto main() -> int{
     std::cout << f() + g() << "\n";
 }
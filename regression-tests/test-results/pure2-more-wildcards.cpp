@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-more-wildcards.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-more-wildcards.cpp2"
 
-#line 2 "pure2-more-wildcards.cpp2"
 [[nodiscard]] auto less_than(auto const& value) -> decltype(auto);
 
 [[nodiscard]] auto main() -> int;
@@ -22,10 +23,8 @@
 
 #line 1 "pure2-more-wildcards.cpp2"
 
-#line 2 "pure2-more-wildcards.cpp2"
 [[nodiscard]] auto less_than(auto const& value) -> decltype(auto) { return [_0 = value](auto const& x) mutable -> decltype(auto) { return cpp2::impl::cmp_less(x,_0);  };  }
 
-#line 4 "pure2-more-wildcards.cpp2"
 [[nodiscard]] auto main() -> int
 {
     auto const x {2}; 
@@ -0,0 +1,59 @@
+
+#define CPP2_IMPORT_STD          Yes
+
+//=== Cpp2 type declarations ====================================================
+
+
+#include "cpp2util.h"
+
+#line 1 "pure2-nrvo-named-return.cpp2"
+
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-nrvo-named-return.cpp2"
+
+using nrvo_eligible_ret = std::string;
+//  A single named return value with one top-level construction lowers
+//  without the deferred_init wrapper, as 'T ret {init}; ... return ret;'
+//  so the Cpp1 compiler can elide the move - assert by inspecting
+//  test-results: no std::move in nrvo_eligible's return path
+
+#line 6 "pure2-nrvo-named-return.cpp2"
+[[nodiscard]] auto nrvo_eligible() -> nrvo_eligible_ret;
+using branchy_ret = std::string;
+
+
+#line 11 "pure2-nrvo-named-return.cpp2"
+//  Two construction points - this one keeps the deferred_init lowering
+
+[[nodiscard]] auto branchy(cpp2::impl::in<bool> which) -> branchy_ret;
+
+#line 19 "pure2-nrvo-named-return.cpp2"
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-nrvo-named-return.cpp2"
+
+#line 6 "pure2-nrvo-named-return.cpp2"
+[[nodiscard]] auto nrvo_eligible() -> nrvo_eligible_ret{
+    std::string ret {"constructed in place"};
+    return ret; 
+}
+
+#line 13 "pure2-nrvo-named-return.cpp2"
+[[nodiscard]] auto branchy(cpp2::impl::in<bool> which) -> branchy_ret{
+        cpp2::impl::deferred_init<std::string> ret;
+#line 14 "pure2-nrvo-named-return.cpp2"
+    if (which) {ret.construct("left"); }
+    else     { ret.construct("right");}
+    return std::move(ret.value()); 
+}
+
+auto main() -> int{
+    std::cout << nrvo_eligible() << "\n";
+    std::cout << branchy(true) << "\n";
+    std::cout << branchy(false) << "\n";
+}
+
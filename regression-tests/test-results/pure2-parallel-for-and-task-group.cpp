@@ -0,0 +1,44 @@
+
+#define CPP2_IMPORT_STD          Yes
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-parallel-for-and-task-group.cpp2"
+
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-parallel-for-and-task-group.cpp2"
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-parallel-for-and-task-group.cpp2"
+auto main() -> int{
+    auto n {100000}; 
+    std::vector<cpp2::i64> partials {}; 
+    CPP2_UFCS(resize)(partials, n);
+
+    //  Each index writes its own slot, so no synchronization is needed
+    cpp2::parallel_for(cpp2::range(0,cpp2::move(n)), [_0 = (&partials)](auto const& i) mutable -> void{CPP2_ASSERT_IN_BOUNDS((*cpp2::impl::assert_not_null(_0)), i) = i; });
+
+    cpp2::i64 total {0}; 
+    for ( auto const& p : cpp2::move(partials) ) {total += p; }
+    std::cout << "parallel total: " << cpp2::move(total) << "\n";
+
+    auto a {0}; 
+    auto b {0}; 
+    {
+        cpp2::task_group g {}; 
+        CPP2_UFCS(spawn)(g, [_0 = (&a)]() mutable -> void{*cpp2::impl::assert_not_null(_0) = 1; });
+        CPP2_UFCS(spawn)(g, [_0 = (&b)]() mutable -> void{*cpp2::impl::assert_not_null(_0) = 2; });
+        CPP2_UFCS(sync)(cpp2::move(g));
+    }
+    std::cout << "spawned work:   " << cpp2::move(a) + cpp2::move(b) << "\n";
+}
+
@@ -18,12 +18,10 @@ class outer;
 
 //  Exercise the pretty-print visualizer for the various grammar elements
 
-#line 4 "pure2-print.cpp2"
 extern bool testing_enabled;
 
 class outer {
 
-#line 8 "pure2-print.cpp2"
     public: template<typename T> 
 CPP2_REQUIRES_ (true) static const T object_alias;
     public: class mytype final
@@ -98,7 +96,6 @@ requires (true) inline CPP2_CONSTEXPR T outer::object_alias{ 42 };
 #line 12 "pure2-print.cpp2"
         [[nodiscard]] auto outer::mytype::f() -> int { return 42;  }
 
-#line 14 "pure2-print.cpp2"
         [[nodiscard]] auto outer::mytype::g(cpp2::impl::in<int> i) const -> int{
             using namespace ::std;
 
@@ -118,7 +115,6 @@ requires (true) inline CPP2_CONSTEXPR T outer::object_alias{ 42 };
             return ret; 
         }
 
-#line 33 "pure2-print.cpp2"
         [[nodiscard]] auto outer::mytype::h(cpp2::impl::in<std::string> s, std::map<int const,std::string>& m) -> std::string
 
 #line 36 "pure2-print.cpp2"
@@ -136,7 +132,6 @@ requires (true) inline CPP2_CONSTEXPR T outer::object_alias{ 42 };
 
             for ( [[maybe_unused]] auto const& unnamed_param_1 : m ) { { do {goto CONTINUE_label; } while (false); c(); } CPP2_CONTINUE_BREAK(label) }
 
-#line 47 "pure2-print.cpp2"
             if (cpp2::impl::is(!(CPP2_UFCS(empty)(s)), (true))) {cpp2::move(a)(); }
             else {if (!(CPP2_UFCS(empty)(m))) {cpp2::move(b)(); }
             else {cpp2::move(c)(); }}
@@ -146,7 +141,6 @@ requires (true) inline CPP2_CONSTEXPR T outer::object_alias{ 42 };
             return [_0 = (s + CPP2_ASSERT_IN_BOUNDS_LITERAL(m, 0))]() mutable -> std::string { return _0;  }(); 
         }
 
-#line 56 "pure2-print.cpp2"
         template<typename T> [[nodiscard]] auto outer::mytype::values([[maybe_unused]] T const& unnamed_param_2) const& -> values_ret{
                 cpp2::impl::deferred_init<int> offset;
                 cpp2::impl::deferred_init<std::string> name;
@@ -155,20 +149,15 @@ requires (true) inline CPP2_CONSTEXPR T outer::object_alias{ 42 };
             name.construct("plugh");
         return  { std::move(offset.value()), std::move(name.value()) }; }
 
-#line 61 "pure2-print.cpp2"
         outer::mytype::mytype(){}
 
-#line 63 "pure2-print.cpp2"
         outer::mytype::mytype([[maybe_unused]] mytype const& that){}
 
-#line 65 "pure2-print.cpp2"
         outer::mytype::mytype([[maybe_unused]] cpp2::impl::in<int> unnamed_param_2){}
 
-#line 67 "pure2-print.cpp2"
         auto outer::mytype::variadic(auto const& ...x) -> void
 requires ((std::is_convertible_v<CPP2_TYPEOF(x), int> && ...)) {(std::cout << ... << x); }
 
-#line 70 "pure2-print.cpp2"
     auto outer::test() -> void{
         namespace namespace_alias = ::std;
 
@@ -187,7 +176,7 @@ requires ((std::is_convertible_v<CPP2_TYPEOF(x), int> && ...)) {(std::cout << ..
 
         cout << [&] () -> namespace_alias::string { auto&& _expr = CPP2_UFCS(g)(cpp2::move(var), 42);
             if (cpp2::impl::is(_expr, 43)) { if constexpr( requires{"forty-and-three";} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF(("forty-and-three")),namespace_alias::string> ) return "forty-and-three"; else return namespace_alias::string{}; else return namespace_alias::string{}; }
-            else return "default case"; }
+            else return [&] () CPP2_COLD_LAMBDA -> namespace_alias::string { return "default case"; } (); }
         () << "\n";
     }
 
@@ -198,11 +187,9 @@ requires (cpp2::impl::cmp_greater_eq(sizeof...(Args),0u)) {
         (out << ... << args);
     }
 
-#line 100 "pure2-print.cpp2"
     template<typename ...Args> [[nodiscard]] auto outer::all(Args const& ...args) -> bool { 
         return (... && args);  }
 
-#line 103 "pure2-print.cpp2"
     auto outer::y([[maybe_unused]] cpp2::impl::in<CPP2_TYPEOF(0)> unnamed_param_1) -> void{}
 
 #line 107 "pure2-print.cpp2"
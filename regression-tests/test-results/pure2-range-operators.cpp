@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-range-operators.cpp2"
 
@@ -13,14 +15,12 @@
 
 #line 1 "pure2-range-operators.cpp2"
 
-#line 2 "pure2-range-operators.cpp2"
 auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
 
 #line 1 "pure2-range-operators.cpp2"
 
-#line 2 "pure2-range-operators.cpp2"
 auto main() -> int{
     std::vector v {
         "Aardvark", "Baboon", "Cat", "Dolphin", "Elephant", "Flicker", "Grue", "Wumpus"}; 
@@ -32,12 +32,12 @@ auto main() -> int{
 
     std::cout << "\nAnd from indexes 1..=5 they are:\n";
     for ( auto const& e : cpp2::range(1,5,true) ) {
-        std::cout << "  " + cpp2::to_string(e) + "  " + cpp2::to_string(CPP2_ASSERT_IN_BOUNDS(v, e)) + "\n";
+        std::cout << "  " + cpp2::string_build(cpp2::interp(e), "  ", cpp2::interp(CPP2_ASSERT_IN_BOUNDS(v, e))) + "\n";
     }
 
     std::cout << "\nAnd test the range when mixing signed & unsigned types:\n";
     for ( auto const& e : cpp2::range(0,CPP2_UFCS(size)(v)) ) {
-        std::cout << "  " + cpp2::to_string(e) + "  " + cpp2::to_string(CPP2_ASSERT_IN_BOUNDS(v, e)) + "\n";
+        std::cout << "  " + cpp2::string_build(cpp2::interp(e), "  ", cpp2::interp(CPP2_ASSERT_IN_BOUNDS(v, e))) + "\n";
     }
 
     std::list all_about {
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-raw-string-literal-and-interpolation.cpp2"
 
@@ -18,7 +20,6 @@
 
 #line 1 "pure2-raw-string-literal-and-interpolation.cpp2"
 [[nodiscard]] auto main() -> int{
-#line 2 "pure2-raw-string-literal-and-interpolation.cpp2"
     auto i {42}; 
     std::map<std::string,int> m {}; 
     CPP2_ASSERT_IN_BOUNDS(m, "one") = 1;
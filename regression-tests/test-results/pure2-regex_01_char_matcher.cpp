@@ -5,7 +5,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-regex_01_char_matcher.cpp2"
 
@@ -48,6 +50,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141\142\143",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_01_matcher() = default;
@@ -56,293 +60,18 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: class regex_02_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_02_matcher() = default;
-        public: regex_02_matcher(regex_02_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_02_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: class regex_03_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_03_matcher() = default;
-        public: regex_03_matcher(regex_03_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_03_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_03_matcher> regex_03 {}; public: class regex_04_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_04_matcher() = default;
-        public: regex_04_matcher(regex_04_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_04_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_04_matcher> regex_04 {}; public: class regex_05_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_05_matcher() = default;
-        public: regex_05_matcher(regex_05_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_05_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: class regex_06_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_06_matcher() = default;
-        public: regex_06_matcher(regex_06_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_06_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_07_matcher() = default;
-        public: regex_07_matcher(regex_07_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_07_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: class regex_08_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_08_matcher() = default;
-        public: regex_08_matcher(regex_08_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_08_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: class regex_09_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_09_matcher() = default;
-        public: regex_09_matcher(regex_09_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_09_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_09_matcher> regex_09 {}; public: class regex_10_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_10_matcher() = default;
-        public: regex_10_matcher(regex_10_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_10_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_10_matcher> regex_10 {}; public: class regex_11_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_11_matcher() = default;
-        public: regex_11_matcher(regex_11_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_11_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_11_matcher> regex_11 {}; public: class regex_12_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_12_matcher() = default;
-        public: regex_12_matcher(regex_12_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_12_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_12_matcher> regex_12 {}; 
+  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: using regex_02_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: using regex_03_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_03_matcher> regex_03 {}; public: using regex_04_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_04_matcher> regex_04 {}; public: using regex_05_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: using regex_06_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: using regex_07_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: using regex_08_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: using regex_09_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_09_matcher> regex_09 {}; public: using regex_10_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_10_matcher> regex_10 {}; public: using regex_11_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_11_matcher> regex_11 {}; public: using regex_12_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_12_matcher> regex_12 {}; 
   public: test_tests_01_char_matcher() = default;
   public: test_tests_01_char_matcher(test_tests_01_char_matcher const&) = delete; /* No 'that' constructor, suppress copy */
   public: auto operator=(test_tests_01_char_matcher const&) -> void = delete;
@@ -356,7 +85,6 @@ auto main() -> int;
 
 #line 1 "pure2-regex_01_char_matcher.cpp2"
 [[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
-#line 2 "pure2-regex_01_char_matcher.cpp2"
   std::string result {""}; 
 
   auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
@@ -467,7 +195,6 @@ auto main() -> int;
   return result; 
 }
 
-#line 112 "pure2-regex_01_char_matcher.cpp2"
 [[nodiscard]] auto sanitize(std::string str) -> std::string
 {
   str = cpp2::string_util::replace_all(str, "\a", "\\a");
@@ -480,7 +207,6 @@ auto main() -> int;
   return cpp2::move(str); 
 }
 
-#line 124 "pure2-regex_01_char_matcher.cpp2"
 template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
            cpp2::impl::in<std::string> resultExpected) -> void{
 
@@ -518,7 +244,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   if (!(CPP2_UFCS(empty)(warning))) {
     warning += " ";
   }
-  std::cout << "" + cpp2::to_string(id) + "_" + cpp2::to_string(kind) + ": " + cpp2::to_string(cpp2::move(status)) + " " + cpp2::to_string(cpp2::move(warning)) + "regex: " + cpp2::to_string(regex_str) + " parsed_regex: " + cpp2::to_string(CPP2_UFCS(to_string)(regex)) + " str: " + cpp2::to_string(sanitize(str)) + " result_expr: " + cpp2::to_string(resultExpr) + " expected_results " + cpp2::to_string(sanitize(resultExpected)) + "" << std::endl;
+  std::cout << "" + cpp2::string_build(cpp2::interp(id), "_", cpp2::interp(kind), ": ", cpp2::interp(cpp2::move(status)), " ", cpp2::interp(cpp2::move(warning)), "regex: ", cpp2::interp(regex_str), " parsed_regex: ", cpp2::interp(CPP2_UFCS(to_string)(regex)), " str: ", cpp2::interp(sanitize(str)), " result_expr: ", cpp2::interp(resultExpr), " expected_results ", cpp2::interp(sanitize(resultExpected))) + "" << std::endl;
 }
 
 #line 178 "pure2-regex_01_char_matcher.cpp2"
@@ -587,6 +313,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_01_char_matcher::regex_01_matcher::to_string() -> std::string{return R"(abc)"; }
 
 
@@ -594,561 +321,22 @@ int i{0};
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_02_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
-  auto r {ctx.pass(cur)}; 
-  do {
 
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_02_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_02_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_02_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_03_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_03_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_03_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_03_matcher::to_string() -> std::string{return R"(abc)"; }
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_04_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_04_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_04_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_04_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_05_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_05_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_05_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_05_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_06_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_06_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_06_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_06_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_07_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_07_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_07_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_07_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_08_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_08_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_08_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_08_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_09_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_09_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_09_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_09_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_10_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_10_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_10_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_10_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_11_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_11_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_11_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_11_matcher::to_string() -> std::string{return R"(abc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_12_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_12_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_01_char_matcher::regex_12_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_01_char_matcher::regex_12_matcher::to_string() -> std::string{return R"(abc)"; }
 
 
 #line 195 "pure2-regex_01_char_matcher.cpp2"
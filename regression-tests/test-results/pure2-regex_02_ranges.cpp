@@ -5,7 +5,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-regex_02_ranges.cpp2"
 
@@ -58,6 +60,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_01_matcher() = default;
@@ -66,7 +70,9 @@ public: class func_1 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: class regex_02_matcher {
+  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: using regex_02_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: using regex_03_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_03_matcher> regex_03 {}; public: class regex_04_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -94,15 +100,25 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_02_matcher() = default;
-        public: regex_02_matcher(regex_02_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_02_matcher const&) -> void = delete;
+        public: regex_04_matcher() = default;
+        public: regex_04_matcher(regex_04_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_04_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: class regex_03_matcher {
+  public: cpp2::regex::regular_expression<char,regex_04_matcher> regex_04 {}; public: using regex_05_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: using regex_06_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: using regex_07_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: using regex_08_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: using regex_09_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_09_matcher> regex_09 {}; public: using regex_10_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_10_matcher> regex_10 {}; public: using regex_11_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_11_matcher> regex_11 {}; public: using regex_12_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_12_matcher> regex_12 {}; public: class regex_13_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -130,15 +146,19 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_03_matcher() = default;
-        public: regex_03_matcher(regex_03_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_03_matcher const&) -> void = delete;
+        public: regex_13_matcher() = default;
+        public: regex_13_matcher(regex_13_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_13_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_03_matcher> regex_03 {}; public: class regex_04_matcher {
+  public: cpp2::regex::regular_expression<char,regex_13_matcher> regex_13 {}; public: using regex_14_matcher = regex_13_matcher;
+public: cpp2::regex::regular_expression<char,regex_14_matcher> regex_14 {}; public: using regex_15_matcher = regex_13_matcher;
+public: cpp2::regex::regular_expression<char,regex_15_matcher> regex_15 {}; public: class regex_16_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -166,15 +186,21 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141\142",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_04_matcher() = default;
-        public: regex_04_matcher(regex_04_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_04_matcher const&) -> void = delete;
+        public: regex_16_matcher() = default;
+        public: regex_16_matcher(regex_16_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_16_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_04_matcher> regex_04 {}; public: class regex_05_matcher {
+  public: cpp2::regex::regular_expression<char,regex_16_matcher> regex_16 {}; public: using regex_17_matcher = regex_16_matcher;
+public: cpp2::regex::regular_expression<char,regex_17_matcher> regex_17 {}; public: using regex_18_matcher = regex_16_matcher;
+public: cpp2::regex::regular_expression<char,regex_18_matcher> regex_18 {}; public: using regex_19_matcher = regex_16_matcher;
+public: cpp2::regex::regular_expression<char,regex_19_matcher> regex_19 {}; public: using regex_20_matcher = regex_16_matcher;
+public: cpp2::regex::regular_expression<char,regex_20_matcher> regex_20 {}; public: class regex_21_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -202,15 +228,23 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_05_matcher() = default;
-        public: regex_05_matcher(regex_05_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_05_matcher const&) -> void = delete;
+        public: regex_21_matcher() = default;
+        public: regex_21_matcher(regex_21_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_21_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: class regex_06_matcher {
+  public: cpp2::regex::regular_expression<char,regex_21_matcher> regex_21 {}; public: using regex_22_matcher = regex_16_matcher;
+public: cpp2::regex::regular_expression<char,regex_22_matcher> regex_22 {}; public: using regex_23_matcher = regex_16_matcher;
+public: cpp2::regex::regular_expression<char,regex_23_matcher> regex_23 {}; public: using regex_24_matcher = regex_16_matcher;
+public: cpp2::regex::regular_expression<char,regex_24_matcher> regex_24 {}; public: using regex_25_matcher = regex_21_matcher;
+public: cpp2::regex::regular_expression<char,regex_25_matcher> regex_25 {}; public: using regex_26_matcher = regex_21_matcher;
+public: cpp2::regex::regular_expression<char,regex_26_matcher> regex_26 {}; public: using regex_27_matcher = regex_21_matcher;
+public: cpp2::regex::regular_expression<char,regex_27_matcher> regex_27 {}; public: class regex_28_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -238,15 +272,19 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_06_matcher() = default;
-        public: regex_06_matcher(regex_06_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_06_matcher const&) -> void = delete;
+        public: regex_28_matcher() = default;
+        public: regex_28_matcher(regex_28_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_28_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
+  public: cpp2::regex::regular_expression<char,regex_28_matcher> regex_28 {}; public: using regex_29_matcher = regex_28_matcher;
+public: cpp2::regex::regular_expression<char,regex_29_matcher> regex_29 {}; public: using regex_30_matcher = regex_28_matcher;
+public: cpp2::regex::regular_expression<char,regex_30_matcher> regex_30 {}; public: class regex_31_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -274,15 +312,19 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_07_matcher() = default;
-        public: regex_07_matcher(regex_07_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_07_matcher const&) -> void = delete;
+        public: regex_31_matcher() = default;
+        public: regex_31_matcher(regex_31_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_31_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: class regex_08_matcher {
+  public: cpp2::regex::regular_expression<char,regex_31_matcher> regex_31 {}; public: using regex_32_matcher = regex_31_matcher;
+public: cpp2::regex::regular_expression<char,regex_32_matcher> regex_32 {}; public: using regex_33_matcher = regex_31_matcher;
+public: cpp2::regex::regular_expression<char,regex_33_matcher> regex_33 {}; public: class regex_34_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -310,15 +352,17 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_08_matcher() = default;
-        public: regex_08_matcher(regex_08_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_08_matcher const&) -> void = delete;
+        public: regex_34_matcher() = default;
+        public: regex_34_matcher(regex_34_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_34_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: class regex_09_matcher {
+  public: cpp2::regex::regular_expression<char,regex_34_matcher> regex_34 {}; public: class regex_35_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -346,15 +390,18 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_09_matcher() = default;
-        public: regex_09_matcher(regex_09_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_09_matcher const&) -> void = delete;
+        public: regex_35_matcher() = default;
+        public: regex_35_matcher(regex_35_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_35_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_09_matcher> regex_09 {}; public: class regex_10_matcher {
+  public: cpp2::regex::regular_expression<char,regex_35_matcher> regex_35 {}; public: using regex_36_matcher = regex_35_matcher;
+public: cpp2::regex::regular_expression<char,regex_36_matcher> regex_36 {}; public: class regex_37_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -382,15 +429,18 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_10_matcher() = default;
-        public: regex_10_matcher(regex_10_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_10_matcher const&) -> void = delete;
+        public: regex_37_matcher() = default;
+        public: regex_37_matcher(regex_37_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_37_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_10_matcher> regex_10 {}; public: class regex_11_matcher {
+  public: cpp2::regex::regular_expression<char,regex_37_matcher> regex_37 {}; public: using regex_38_matcher = regex_35_matcher;
+public: cpp2::regex::regular_expression<char,regex_38_matcher> regex_38 {}; public: class regex_39_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -418,15 +468,17 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_11_matcher() = default;
-        public: regex_11_matcher(regex_11_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_11_matcher const&) -> void = delete;
+        public: regex_39_matcher() = default;
+        public: regex_39_matcher(regex_39_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_39_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_11_matcher> regex_11 {}; public: class regex_12_matcher {
+  public: cpp2::regex::regular_expression<char,regex_39_matcher> regex_39 {}; public: class regex_40_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -454,4357 +506,243 @@ public: class func_1 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_12_matcher() = default;
-        public: regex_12_matcher(regex_12_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_12_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_12_matcher> regex_12 {}; public: class regex_13_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
 
-  };
+  public: [[nodiscard]] static auto to_string() -> std::string;
 
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+        public: regex_40_matcher() = default;
+        public: regex_40_matcher(regex_40_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_40_matcher const&) -> void = delete;
 
   };
 
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
+  public: cpp2::regex::regular_expression<char,regex_40_matcher> regex_40 {}; 
+  public: test_tests_02_ranges() = default;
+  public: test_tests_02_ranges(test_tests_02_ranges const&) = delete; /* No 'that' constructor, suppress copy */
+  public: auto operator=(test_tests_02_ranges const&) -> void = delete;
 
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
 
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+#line 250 "pure2-regex_02_ranges.cpp2"
+};
+auto main() -> int;
 
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
+//=== Cpp2 function definitions =================================================
 
-  };
+#line 1 "pure2-regex_02_ranges.cpp2"
+[[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
+  std::string result {""}; 
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
+  auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
+  auto start {std::distance(CPP2_UFCS(cbegin)((*cpp2::impl::assert_not_null(_0))), iter)}; 
+    auto firstDollar {CPP2_UFCS(find)((*cpp2::impl::assert_not_null(_0)), "$", start)}; 
+    auto firstAt {CPP2_UFCS(find)((*cpp2::impl::assert_not_null(_0)), "@", cpp2::move(start))}; 
 
-        public: regex_13_matcher() = default;
-        public: regex_13_matcher(regex_13_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_13_matcher const&) -> void = delete;
+  auto end {std::min(cpp2::move(firstDollar), cpp2::move(firstAt))}; 
+  if (end != std::string::npos) {
+   return CPP2_UFCS(cbegin)((*cpp2::impl::assert_not_null(_0))) + cpp2::move(end); 
+  }
+  else {
+   return CPP2_UFCS(cend)((*cpp2::impl::assert_not_null(_0))); 
+  }
+  }}; 
+  auto extract_group_and_advance {[](auto& iter) -> auto{
+    auto start {iter}; 
 
-  };
+    for( ; std::isdigit(*cpp2::impl::assert_not_null(iter)); ++iter ) {}
 
-  public: cpp2::regex::regular_expression<char,regex_13_matcher> regex_13 {}; public: class regex_14_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+    return std::stoi(std::string(cpp2::move(start), iter)); 
+  }}; 
+  auto extract_until {[](auto& iter, cpp2::impl::in<char> to) -> auto{
+    auto start {iter}; 
 
-  };
+    for( ; (to != *cpp2::impl::assert_not_null(iter)); ++iter ) {}// TODO: Without bracket: error: postfix unary * (dereference) cannot be immediately followed by a (, identifier, or literal - add whitespace before * here if you meant binary * (multiplication)
 
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+    return std::string(cpp2::move(start), iter); 
+  }}; 
 
-  };
+  auto iter {CPP2_UFCS(begin)(resultExpr)}; 
 
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+  while( iter != CPP2_UFCS(end)(resultExpr) ) {
+    auto next {get_next(iter)}; 
 
-  };
+    if (next != iter) {
+      result += std::string(iter, next);
+    }
+    if (next != CPP2_UFCS(end)(resultExpr)) {
+      if (*cpp2::impl::assert_not_null(next) == '$') {
+        ++next;
 
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+        if (*cpp2::impl::assert_not_null(next) == '&') {
+          ++next;
+          result += CPP2_UFCS(group)(r, 0);
+        }
+        else {if (*cpp2::impl::assert_not_null(next) == '-' || *cpp2::impl::assert_not_null(next) == '+') {
+          auto is_start {*cpp2::impl::assert_not_null(next) == '-'}; 
+          ++next;
+          if (*cpp2::impl::assert_not_null(next) == '{') {
+            ++next; // Skip {
+            auto group {extract_until(next, '}')}; 
+            ++next; // Skip }
+            result += CPP2_UFCS(group)(r, cpp2::move(group));
+          }
+          else {if (*cpp2::impl::assert_not_null(next) == '[') {
+            ++next; // Skip [
+            auto group {extract_group_and_advance(next)}; 
+            ++next; // Skip ]
 
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+            if (cpp2::move(is_start)) {
+              result += std::to_string(CPP2_UFCS(group_start)(r, cpp2::move(group)));
+            }
+            else {
+              result += std::to_string(CPP2_UFCS(group_end)(r, cpp2::move(group)));
+            }
+          }
+          else {
+            // Return max group
+            result += CPP2_UFCS(group)(r, CPP2_UFCS(group_number)(r) - 1);
+          }}
+        }
+        else {if (std::isdigit(*cpp2::impl::assert_not_null(next))) {
+          auto group {extract_group_and_advance(next)}; 
+          result += CPP2_UFCS(group)(r, cpp2::move(group));
+        }
+        else {
+          std::cerr << "Not implemented";
+        }}}
+      }
+      else {if (*cpp2::impl::assert_not_null(next) == '@') {
+        ++next;
 
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
+        if (*cpp2::impl::assert_not_null(next) == '-' || *cpp2::impl::assert_not_null(next) == '+') {
+          auto i {0}; 
+          for( ; cpp2::impl::cmp_less(i,cpp2::unchecked_narrow<int>(CPP2_UFCS(group_number)(r))); ++i ) {
+            auto pos {0}; 
+            if (*cpp2::impl::assert_not_null(next) == '-') {
+              pos = CPP2_UFCS(group_start)(r, i);
+            }
+            else {
+              pos = CPP2_UFCS(group_end)(r, i);
+            }
+            result +=  std::to_string(cpp2::move(pos));
+          }
+        }
+        else {
+          std::cerr << "Not implemented";
+        }
+      }
+      else {
+        std::cerr << "Not implemented.";
+      }}
+    }
+    iter = cpp2::move(next);
+  }
 
-  };
+  return result; 
+}
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
+[[nodiscard]] auto sanitize(std::string str) -> std::string
+{
+  str = cpp2::string_util::replace_all(str, "\a", "\\a");
+  str = cpp2::string_util::replace_all(str, "\f", "\\f");
+  str = cpp2::string_util::replace_all(str, "\x1b", "\\e");
+  str = cpp2::string_util::replace_all(str, "\n", "\\n");
+  str = cpp2::string_util::replace_all(str, "\r", "\\r");
+  str = cpp2::string_util::replace_all(str, "\t", "\\t");
 
-        public: regex_14_matcher() = default;
-        public: regex_14_matcher(regex_14_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_14_matcher const&) -> void = delete;
+  return cpp2::move(str); 
+}
 
-  };
+template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
+           cpp2::impl::in<std::string> resultExpected) -> void{
 
-  public: cpp2::regex::regular_expression<char,regex_14_matcher> regex_14 {}; public: class regex_15_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+  std::string warning {""}; 
+  if (CPP2_UFCS(to_string)(regex) != regex_str) {
+    warning = "Warning: Parsed regex does not match.";
+  }
 
-  };
+  std::string status {"OK"}; 
 
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+  auto r {CPP2_UFCS(search)(regex, str)}; 
 
-  };
+  if ("y" == kind || "yM" == kind || "yS" == kind || "yB" == kind) {
+    if (!(r.matched)) {
+      status = "Failure: Regex should apply.";
+    }
+    else {
+      // Have a match check the result
 
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+      auto result {create_result(resultExpr, cpp2::move(r))}; 
 
-  };
+      if (result != resultExpected) {
+        status = "Failure: Result is wrong. (is: " + cpp2::to_string(sanitize(cpp2::move(result))) + ")";
+      }
+    }
+  }
+  else {if ("n" == kind) {
+    if (r.matched) {
+      status = "Failure: Regex should not apply. Result is '" + cpp2::to_string(CPP2_UFCS(group)(cpp2::move(r), 0)) + "'";
+    }
+  }else {
+    status = "Unknown kind '" + cpp2::to_string(kind) + "'";
+  }}
 
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+  if (!(CPP2_UFCS(empty)(warning))) {
+    warning += " ";
+  }
+  std::cout << "" + cpp2::string_build(cpp2::interp(id), "_", cpp2::interp(kind), ": ", cpp2::interp(cpp2::move(status)), " ", cpp2::interp(cpp2::move(warning)), "regex: ", cpp2::interp(regex_str), " parsed_regex: ", cpp2::interp(CPP2_UFCS(to_string)(regex)), " str: ", cpp2::interp(sanitize(str)), " result_expr: ", cpp2::interp(resultExpr), " expected_results ", cpp2::interp(sanitize(resultExpected))) + "" << std::endl;
+}
 
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_15_matcher() = default;
-        public: regex_15_matcher(regex_15_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_15_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_15_matcher> regex_15 {}; public: class regex_16_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_16_matcher() = default;
-        public: regex_16_matcher(regex_16_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_16_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_16_matcher> regex_16 {}; public: class regex_17_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_17_matcher() = default;
-        public: regex_17_matcher(regex_17_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_17_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_17_matcher> regex_17 {}; public: class regex_18_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_18_matcher() = default;
-        public: regex_18_matcher(regex_18_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_18_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_18_matcher> regex_18 {}; public: class regex_19_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_19_matcher() = default;
-        public: regex_19_matcher(regex_19_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_19_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_19_matcher> regex_19 {}; public: class regex_20_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_20_matcher() = default;
-        public: regex_20_matcher(regex_20_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_20_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_20_matcher> regex_20 {}; public: class regex_21_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_21_matcher() = default;
-        public: regex_21_matcher(regex_21_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_21_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_21_matcher> regex_21 {}; public: class regex_22_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_22_matcher() = default;
-        public: regex_22_matcher(regex_22_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_22_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_22_matcher> regex_22 {}; public: class regex_23_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_23_matcher() = default;
-        public: regex_23_matcher(regex_23_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_23_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_23_matcher> regex_23 {}; public: class regex_24_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_24_matcher() = default;
-        public: regex_24_matcher(regex_24_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_24_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_24_matcher> regex_24 {}; public: class regex_25_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_25_matcher() = default;
-        public: regex_25_matcher(regex_25_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_25_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_25_matcher> regex_25 {}; public: class regex_26_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_26_matcher() = default;
-        public: regex_26_matcher(regex_26_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_26_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_26_matcher> regex_26 {}; public: class regex_27_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_27_matcher() = default;
-        public: regex_27_matcher(regex_27_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_27_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_27_matcher> regex_27 {}; public: class regex_28_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_28_matcher() = default;
-        public: regex_28_matcher(regex_28_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_28_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_28_matcher> regex_28 {}; public: class regex_29_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_29_matcher() = default;
-        public: regex_29_matcher(regex_29_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_29_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_29_matcher> regex_29 {}; public: class regex_30_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_30_matcher() = default;
-        public: regex_30_matcher(regex_30_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_30_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_30_matcher> regex_30 {}; public: class regex_31_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_31_matcher() = default;
-        public: regex_31_matcher(regex_31_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_31_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_31_matcher> regex_31 {}; public: class regex_32_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_32_matcher() = default;
-        public: regex_32_matcher(regex_32_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_32_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_32_matcher> regex_32 {}; public: class regex_33_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_33_matcher() = default;
-        public: regex_33_matcher(regex_33_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_33_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_33_matcher> regex_33 {}; public: class regex_34_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_34_matcher() = default;
-        public: regex_34_matcher(regex_34_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_34_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_34_matcher> regex_34 {}; public: class regex_35_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_35_matcher() = default;
-        public: regex_35_matcher(regex_35_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_35_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_35_matcher> regex_35 {}; public: class regex_36_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_36_matcher() = default;
-        public: regex_36_matcher(regex_36_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_36_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_36_matcher> regex_36 {}; public: class regex_37_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_37_matcher() = default;
-        public: regex_37_matcher(regex_37_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_37_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_37_matcher> regex_37 {}; public: class regex_38_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_38_matcher() = default;
-        public: regex_38_matcher(regex_38_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_38_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_38_matcher> regex_38 {}; public: class regex_39_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_39_matcher() = default;
-        public: regex_39_matcher(regex_39_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_39_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_39_matcher> regex_39 {}; public: class regex_40_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_40_matcher() = default;
-        public: regex_40_matcher(regex_40_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_40_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_40_matcher> regex_40 {}; 
-  public: test_tests_02_ranges() = default;
-  public: test_tests_02_ranges(test_tests_02_ranges const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(test_tests_02_ranges const&) -> void = delete;
-
-
-#line 250 "pure2-regex_02_ranges.cpp2"
-};
-auto main() -> int;
-
-//=== Cpp2 function definitions =================================================
-
-#line 1 "pure2-regex_02_ranges.cpp2"
-[[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
-#line 2 "pure2-regex_02_ranges.cpp2"
-  std::string result {""}; 
-
-  auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
-  auto start {std::distance(CPP2_UFCS(cbegin)((*cpp2::impl::assert_not_null(_0))), iter)}; 
-    auto firstDollar {CPP2_UFCS(find)((*cpp2::impl::assert_not_null(_0)), "$", start)}; 
-    auto firstAt {CPP2_UFCS(find)((*cpp2::impl::assert_not_null(_0)), "@", cpp2::move(start))}; 
-
-  auto end {std::min(cpp2::move(firstDollar), cpp2::move(firstAt))}; 
-  if (end != std::string::npos) {
-   return CPP2_UFCS(cbegin)((*cpp2::impl::assert_not_null(_0))) + cpp2::move(end); 
-  }
-  else {
-   return CPP2_UFCS(cend)((*cpp2::impl::assert_not_null(_0))); 
-  }
-  }}; 
-  auto extract_group_and_advance {[](auto& iter) -> auto{
-    auto start {iter}; 
-
-    for( ; std::isdigit(*cpp2::impl::assert_not_null(iter)); ++iter ) {}
-
-    return std::stoi(std::string(cpp2::move(start), iter)); 
-  }}; 
-  auto extract_until {[](auto& iter, cpp2::impl::in<char> to) -> auto{
-    auto start {iter}; 
-
-    for( ; (to != *cpp2::impl::assert_not_null(iter)); ++iter ) {}// TODO: Without bracket: error: postfix unary * (dereference) cannot be immediately followed by a (, identifier, or literal - add whitespace before * here if you meant binary * (multiplication)
-
-    return std::string(cpp2::move(start), iter); 
-  }}; 
-
-  auto iter {CPP2_UFCS(begin)(resultExpr)}; 
-
-  while( iter != CPP2_UFCS(end)(resultExpr) ) {
-    auto next {get_next(iter)}; 
-
-    if (next != iter) {
-      result += std::string(iter, next);
-    }
-    if (next != CPP2_UFCS(end)(resultExpr)) {
-      if (*cpp2::impl::assert_not_null(next) == '$') {
-        ++next;
-
-        if (*cpp2::impl::assert_not_null(next) == '&') {
-          ++next;
-          result += CPP2_UFCS(group)(r, 0);
-        }
-        else {if (*cpp2::impl::assert_not_null(next) == '-' || *cpp2::impl::assert_not_null(next) == '+') {
-          auto is_start {*cpp2::impl::assert_not_null(next) == '-'}; 
-          ++next;
-          if (*cpp2::impl::assert_not_null(next) == '{') {
-            ++next; // Skip {
-            auto group {extract_until(next, '}')}; 
-            ++next; // Skip }
-            result += CPP2_UFCS(group)(r, cpp2::move(group));
-          }
-          else {if (*cpp2::impl::assert_not_null(next) == '[') {
-            ++next; // Skip [
-            auto group {extract_group_and_advance(next)}; 
-            ++next; // Skip ]
-
-            if (cpp2::move(is_start)) {
-              result += std::to_string(CPP2_UFCS(group_start)(r, cpp2::move(group)));
-            }
-            else {
-              result += std::to_string(CPP2_UFCS(group_end)(r, cpp2::move(group)));
-            }
-          }
-          else {
-            // Return max group
-            result += CPP2_UFCS(group)(r, CPP2_UFCS(group_number)(r) - 1);
-          }}
-        }
-        else {if (std::isdigit(*cpp2::impl::assert_not_null(next))) {
-          auto group {extract_group_and_advance(next)}; 
-          result += CPP2_UFCS(group)(r, cpp2::move(group));
-        }
-        else {
-          std::cerr << "Not implemented";
-        }}}
-      }
-      else {if (*cpp2::impl::assert_not_null(next) == '@') {
-        ++next;
-
-        if (*cpp2::impl::assert_not_null(next) == '-' || *cpp2::impl::assert_not_null(next) == '+') {
-          auto i {0}; 
-          for( ; cpp2::impl::cmp_less(i,cpp2::unchecked_narrow<int>(CPP2_UFCS(group_number)(r))); ++i ) {
-            auto pos {0}; 
-            if (*cpp2::impl::assert_not_null(next) == '-') {
-              pos = CPP2_UFCS(group_start)(r, i);
-            }
-            else {
-              pos = CPP2_UFCS(group_end)(r, i);
-            }
-            result +=  std::to_string(cpp2::move(pos));
-          }
-        }
-        else {
-          std::cerr << "Not implemented";
-        }
-      }
-      else {
-        std::cerr << "Not implemented.";
-      }}
-    }
-    iter = cpp2::move(next);
-  }
-
-  return result; 
-}
-
-#line 112 "pure2-regex_02_ranges.cpp2"
-[[nodiscard]] auto sanitize(std::string str) -> std::string
-{
-  str = cpp2::string_util::replace_all(str, "\a", "\\a");
-  str = cpp2::string_util::replace_all(str, "\f", "\\f");
-  str = cpp2::string_util::replace_all(str, "\x1b", "\\e");
-  str = cpp2::string_util::replace_all(str, "\n", "\\n");
-  str = cpp2::string_util::replace_all(str, "\r", "\\r");
-  str = cpp2::string_util::replace_all(str, "\t", "\\t");
-
-  return cpp2::move(str); 
-}
-
-#line 124 "pure2-regex_02_ranges.cpp2"
-template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
-           cpp2::impl::in<std::string> resultExpected) -> void{
-
-  std::string warning {""}; 
-  if (CPP2_UFCS(to_string)(regex) != regex_str) {
-    warning = "Warning: Parsed regex does not match.";
-  }
-
-  std::string status {"OK"}; 
-
-  auto r {CPP2_UFCS(search)(regex, str)}; 
-
-  if ("y" == kind || "yM" == kind || "yS" == kind || "yB" == kind) {
-    if (!(r.matched)) {
-      status = "Failure: Regex should apply.";
-    }
-    else {
-      // Have a match check the result
-
-      auto result {create_result(resultExpr, cpp2::move(r))}; 
-
-      if (result != resultExpected) {
-        status = "Failure: Result is wrong. (is: " + cpp2::to_string(sanitize(cpp2::move(result))) + ")";
-      }
-    }
-  }
-  else {if ("n" == kind) {
-    if (r.matched) {
-      status = "Failure: Regex should not apply. Result is '" + cpp2::to_string(CPP2_UFCS(group)(cpp2::move(r), 0)) + "'";
-    }
-  }else {
-    status = "Unknown kind '" + cpp2::to_string(kind) + "'";
-  }}
-
-  if (!(CPP2_UFCS(empty)(warning))) {
-    warning += " ";
-  }
-  std::cout << "" + cpp2::to_string(id) + "_" + cpp2::to_string(kind) + ": " + cpp2::to_string(cpp2::move(status)) + " " + cpp2::to_string(cpp2::move(warning)) + "regex: " + cpp2::to_string(regex_str) + " parsed_regex: " + cpp2::to_string(CPP2_UFCS(to_string)(regex)) + " str: " + cpp2::to_string(sanitize(str)) + " result_expr: " + cpp2::to_string(resultExpr) + " expected_results " + cpp2::to_string(sanitize(resultExpected)) + "" << std::endl;
-}
-
-#line 206 "pure2-regex_02_ranges.cpp2"
-  auto test_tests_02_ranges::run() const& -> void{
-    std::cout << "Running tests_02_ranges:" << std::endl;
-    test(regex_01, "01", R"(ab*c)", "abc", "y", R"($&)", "abc");
-    test(regex_02, "02", R"(ab*c)", "abc", "y", R"($-[0])", "0");
-    test(regex_03, "03", R"(ab*c)", "abc", "y", R"($+[0])", "3");
-    test(regex_04, "04", R"(ab*bc)", "abc", "y", R"($&)", "abc");
-    test(regex_05, "05", R"(ab*bc)", "abc", "y", R"($-[0])", "0");
-    test(regex_06, "06", R"(ab*bc)", "abc", "y", R"($+[0])", "3");
-    test(regex_07, "07", R"(ab*bc)", "abbc", "y", R"($&)", "abbc");
-    test(regex_08, "08", R"(ab*bc)", "abbc", "y", R"($-[0])", "0");
-    test(regex_09, "09", R"(ab*bc)", "abbc", "y", R"($+[0])", "4");
-    test(regex_10, "10", R"(ab*bc)", "abbbbc", "y", R"($&)", "abbbbc");
-    test(regex_11, "11", R"(ab*bc)", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_12, "12", R"(ab*bc)", "abbbbc", "y", R"($+[0])", "6");
-    test(regex_13, "13", R"(ab{0,}bc)", "abbbbc", "y", R"($&)", "abbbbc");
-    test(regex_14, "14", R"(ab{0,}bc)", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_15, "15", R"(ab{0,}bc)", "abbbbc", "y", R"($+[0])", "6");
-    test(regex_16, "16", R"(ab+bc)", "abbc", "y", R"($&)", "abbc");
-    test(regex_17, "17", R"(ab+bc)", "abbc", "y", R"($-[0])", "0");
-    test(regex_18, "18", R"(ab+bc)", "abbc", "y", R"($+[0])", "4");
-    test(regex_19, "19", R"(ab+bc)", "abc", "n", R"(-)", "-");
-    test(regex_20, "20", R"(ab+bc)", "abq", "n", R"(-)", "-");
-    test(regex_21, "21", R"(ab{1,}bc)", "abq", "n", R"(-)", "-");
-    test(regex_22, "22", R"(ab+bc)", "abbbbc", "y", R"($&)", "abbbbc");
-    test(regex_23, "23", R"(ab+bc)", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_24, "24", R"(ab+bc)", "abbbbc", "y", R"($+[0])", "6");
-    test(regex_25, "25", R"(ab{1,}bc)", "abbbbc", "y", R"($&)", "abbbbc");
-    test(regex_26, "26", R"(ab{1,}bc)", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_27, "27", R"(ab{1,}bc)", "abbbbc", "y", R"($+[0])", "6");
-    test(regex_28, "28", R"(ab{1,3}bc)", "abbbbc", "y", R"($&)", "abbbbc");
-    test(regex_29, "29", R"(ab{1,3}bc)", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_30, "30", R"(ab{1,3}bc)", "abbbbc", "y", R"($+[0])", "6");
-    test(regex_31, "31", R"(ab{3,4}bc)", "abbbbc", "y", R"($&)", "abbbbc");
-    test(regex_32, "32", R"(ab{3,4}bc)", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_33, "33", R"(ab{3,4}bc)", "abbbbc", "y", R"($+[0])", "6");
-    test(regex_34, "34", R"(ab{4,5}bc)", "abbbbc", "n", R"(-)", "-");
-    test(regex_35, "35", R"(ab?bc)", "abbc", "y", R"($&)", "abbc");
-    test(regex_36, "36", R"(ab?bc)", "abc", "y", R"($&)", "abc");
-    test(regex_37, "37", R"(ab{0,1}bc)", "abc", "y", R"($&)", "abc");
-    test(regex_38, "38", R"(ab?bc)", "abbbbc", "n", R"(-)", "-");
-    test(regex_39, "39", R"(ab?c)", "abc", "y", R"($&)", "abc");
-    test(regex_40, "40", R"(ab{0,1}c)", "abc", "y", R"($&)", "abc");
-    std::cout << std::endl;
-  }
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_2 {"c"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::to_string() -> std::string{return R"(ab*c)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_02_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_02_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_02_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_2 {"c"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_02_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_02_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_02_matcher::to_string() -> std::string{return R"(ab*c)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_03_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_03_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_03_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_2 {"c"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_03_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_03_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_03_matcher::to_string() -> std::string{return R"(ab*c)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_05_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_05_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_05_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_05_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_05_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_05_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_06_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_06_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_06_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_06_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_06_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_06_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_07_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_07_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_07_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_07_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_07_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_07_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_08_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_08_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_08_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_08_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_08_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_08_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_09_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_09_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_09_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_09_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_09_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_09_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_10_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_10_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_10_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_10_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_10_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_10_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_11_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_11_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_11_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_11_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_11_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_11_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_12_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_12_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_12_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_12_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_12_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_12_matcher::to_string() -> std::string{return R"(ab*bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::to_string() -> std::string{return R"(ab{0,}bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_14_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_14_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_14_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_14_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_14_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_14_matcher::to_string() -> std::string{return R"(ab{0,}bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_15_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_15_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_15_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_15_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_15_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_15_matcher::to_string() -> std::string{return R"(ab{0,}bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::to_string() -> std::string{return R"(ab+bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_17_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_17_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_17_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_17_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_17_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_17_matcher::to_string() -> std::string{return R"(ab+bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_18_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_18_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_18_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_18_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_18_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_18_matcher::to_string() -> std::string{return R"(ab+bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_19_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_19_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_19_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_19_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_19_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_19_matcher::to_string() -> std::string{return R"(ab+bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_20_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_20_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_20_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_20_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_20_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_20_matcher::to_string() -> std::string{return R"(ab+bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::to_string() -> std::string{return R"(ab{1,}bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_22_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_22_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_22_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_22_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_22_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_22_matcher::to_string() -> std::string{return R"(ab+bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_23_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_23_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_23_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_23_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_23_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_23_matcher::to_string() -> std::string{return R"(ab+bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_24_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_24_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_24_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_24_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_24_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_24_matcher::to_string() -> std::string{return R"(ab+bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_25_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_25_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_25_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_25_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_25_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_25_matcher::to_string() -> std::string{return R"(ab{1,}bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_26_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_26_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_26_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_26_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_26_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_02_ranges::regex_26_matcher::to_string() -> std::string{return R"(ab{1,}bc)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_27_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_27_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_27_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_27_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_27_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
+#line 206 "pure2-regex_02_ranges.cpp2"
+  auto test_tests_02_ranges::run() const& -> void{
+    std::cout << "Running tests_02_ranges:" << std::endl;
+    test(regex_01, "01", R"(ab*c)", "abc", "y", R"($&)", "abc");
+    test(regex_02, "02", R"(ab*c)", "abc", "y", R"($-[0])", "0");
+    test(regex_03, "03", R"(ab*c)", "abc", "y", R"($+[0])", "3");
+    test(regex_04, "04", R"(ab*bc)", "abc", "y", R"($&)", "abc");
+    test(regex_05, "05", R"(ab*bc)", "abc", "y", R"($-[0])", "0");
+    test(regex_06, "06", R"(ab*bc)", "abc", "y", R"($+[0])", "3");
+    test(regex_07, "07", R"(ab*bc)", "abbc", "y", R"($&)", "abbc");
+    test(regex_08, "08", R"(ab*bc)", "abbc", "y", R"($-[0])", "0");
+    test(regex_09, "09", R"(ab*bc)", "abbc", "y", R"($+[0])", "4");
+    test(regex_10, "10", R"(ab*bc)", "abbbbc", "y", R"($&)", "abbbbc");
+    test(regex_11, "11", R"(ab*bc)", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_12, "12", R"(ab*bc)", "abbbbc", "y", R"($+[0])", "6");
+    test(regex_13, "13", R"(ab{0,}bc)", "abbbbc", "y", R"($&)", "abbbbc");
+    test(regex_14, "14", R"(ab{0,}bc)", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_15, "15", R"(ab{0,}bc)", "abbbbc", "y", R"($+[0])", "6");
+    test(regex_16, "16", R"(ab+bc)", "abbc", "y", R"($&)", "abbc");
+    test(regex_17, "17", R"(ab+bc)", "abbc", "y", R"($-[0])", "0");
+    test(regex_18, "18", R"(ab+bc)", "abbc", "y", R"($+[0])", "4");
+    test(regex_19, "19", R"(ab+bc)", "abc", "n", R"(-)", "-");
+    test(regex_20, "20", R"(ab+bc)", "abq", "n", R"(-)", "-");
+    test(regex_21, "21", R"(ab{1,}bc)", "abq", "n", R"(-)", "-");
+    test(regex_22, "22", R"(ab+bc)", "abbbbc", "y", R"($&)", "abbbbc");
+    test(regex_23, "23", R"(ab+bc)", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_24, "24", R"(ab+bc)", "abbbbc", "y", R"($+[0])", "6");
+    test(regex_25, "25", R"(ab{1,}bc)", "abbbbc", "y", R"($&)", "abbbbc");
+    test(regex_26, "26", R"(ab{1,}bc)", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_27, "27", R"(ab{1,}bc)", "abbbbc", "y", R"($+[0])", "6");
+    test(regex_28, "28", R"(ab{1,3}bc)", "abbbbc", "y", R"($&)", "abbbbc");
+    test(regex_29, "29", R"(ab{1,3}bc)", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_30, "30", R"(ab{1,3}bc)", "abbbbc", "y", R"($+[0])", "6");
+    test(regex_31, "31", R"(ab{3,4}bc)", "abbbbc", "y", R"($&)", "abbbbc");
+    test(regex_32, "32", R"(ab{3,4}bc)", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_33, "33", R"(ab{3,4}bc)", "abbbbc", "y", R"($+[0])", "6");
+    test(regex_34, "34", R"(ab{4,5}bc)", "abbbbc", "n", R"(-)", "-");
+    test(regex_35, "35", R"(ab?bc)", "abbc", "y", R"($&)", "abbc");
+    test(regex_36, "36", R"(ab?bc)", "abc", "y", R"($&)", "abc");
+    test(regex_37, "37", R"(ab{0,1}bc)", "abc", "y", R"($&)", "abc");
+    test(regex_38, "38", R"(ab?bc)", "abbbbc", "n", R"(-)", "-");
+    test(regex_39, "39", R"(ab?c)", "abc", "y", R"($&)", "abc");
+    test(regex_40, "40", R"(ab{0,1}c)", "abc", "y", R"($&)", "abc");
+    std::cout << std::endl;
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_27_matcher::to_string() -> std::string{return R"(ab{1,}bc)"; }
-
 
 
 
 
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -4836,7 +774,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -4859,7 +797,7 @@ int i{0};
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,3,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -4868,23 +806,23 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
 
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
+  std::array<char,1 + 1> str_tmp_2 {"c"}; 
+  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
   r.matched = false;
   break;
   }
 {
 int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
+  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
   if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
   }
 }
-  if (r.matched) {r.pos += 2;}
+  if (r.matched) {r.pos += 1;}
   else {break;}
   }
    while ( 
@@ -4899,7 +837,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -4907,19 +845,24 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::to_string() -> std::string{return R"(ab{1,3}bc)"; }
+
+  [[nodiscard]] auto test_tests_02_ranges::regex_01_matcher::to_string() -> std::string{return R"(ab*c)"; }
+
+
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_29_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -4951,7 +894,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_29_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -4974,7 +917,7 @@ int i{0};
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,3,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -4983,7 +926,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_29_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5014,7 +957,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_29_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -5022,134 +965,36 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_29_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_29_matcher::to_string() -> std::string{return R"(ab{1,3}bc)"; }
-
-
-
 
+  [[nodiscard]] auto test_tests_02_ranges::regex_04_matcher::to_string() -> std::string{return R"(ab*bc)"; }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_30_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
-  auto r {ctx.pass(cur)}; 
-  do {
 
-  std::array<char,1 + 1> str_tmp_1 {"b"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_30_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
-  auto r {ctx.pass(cur)}; 
-  do {
 
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,3,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_30_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
-  auto r {ctx.pass(cur)}; 
-  do {
 
-  std::array<char,2 + 1> str_tmp_2 {"bc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),2)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,2); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 2;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_30_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_30_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_30_matcher::to_string() -> std::string{return R"(ab{1,3}bc)"; }
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5181,7 +1026,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5204,7 +1049,7 @@ int i{0};
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -5213,7 +1058,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5244,7 +1089,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -5252,19 +1097,24 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::to_string() -> std::string{return R"(ab{3,4}bc)"; }
+
+  [[nodiscard]] auto test_tests_02_ranges::regex_13_matcher::to_string() -> std::string{return R"(ab{0,}bc)"; }
+
+
+
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_32_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5296,7 +1146,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_32_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5319,7 +1169,7 @@ int i{0};
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -5328,7 +1178,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_32_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5359,7 +1209,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_32_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -5367,19 +1217,28 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_32_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_32_matcher::to_string() -> std::string{return R"(ab{3,4}bc)"; }
+
+  [[nodiscard]] auto test_tests_02_ranges::regex_16_matcher::to_string() -> std::string{return R"(ab+bc)"; }
+
+
+
+
+
+
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_33_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5411,7 +1270,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_33_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5434,7 +1293,7 @@ int i{0};
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -5443,7 +1302,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_33_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5474,7 +1333,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_33_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -5482,19 +1341,32 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_33_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_33_matcher::to_string() -> std::string{return R"(ab{3,4}bc)"; }
+
+  [[nodiscard]] auto test_tests_02_ranges::regex_21_matcher::to_string() -> std::string{return R"(ab{1,}bc)"; }
+
+
+
+
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+
+
+
+
+
+
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5526,7 +1398,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5549,7 +1421,7 @@ int i{0};
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,4,5,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,1,3,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -5558,7 +1430,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5589,7 +1461,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -5597,19 +1469,24 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::to_string() -> std::string{return R"(ab{4,5}bc)"; }
+
+  [[nodiscard]] auto test_tests_02_ranges::regex_28_matcher::to_string() -> std::string{return R"(ab{1,3}bc)"; }
+
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5641,7 +1518,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5664,7 +1541,7 @@ int i{0};
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -5673,7 +1550,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5704,7 +1581,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -5712,19 +1589,24 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::to_string() -> std::string{return R"(ab?bc)"; }
+
+  [[nodiscard]] auto test_tests_02_ranges::regex_31_matcher::to_string() -> std::string{return R"(ab{3,4}bc)"; }
+
+
+
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_36_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5756,7 +1638,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_36_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5779,7 +1661,7 @@ int i{0};
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,4,5,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -5788,7 +1670,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_36_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5819,7 +1701,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_36_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -5827,19 +1709,20 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_36_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_36_matcher::to_string() -> std::string{return R"(ab?bc)"; }
 
+  [[nodiscard]] auto test_tests_02_ranges::regex_34_matcher::to_string() -> std::string{return R"(ab{4,5}bc)"; }
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5871,7 +1754,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5903,7 +1786,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5934,7 +1817,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -5942,19 +1825,22 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::to_string() -> std::string{return R"(ab{0,1}bc)"; }
+
+  [[nodiscard]] auto test_tests_02_ranges::regex_35_matcher::to_string() -> std::string{return R"(ab?bc)"; }
+
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_38_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -5986,7 +1872,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_38_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -6018,7 +1904,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_38_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -6049,7 +1935,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_38_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -6057,12 +1943,15 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_38_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_02_ranges::regex_38_matcher::to_string() -> std::string{return R"(ab?bc)"; }
+
+  [[nodiscard]] auto test_tests_02_ranges::regex_37_matcher::to_string() -> std::string{return R"(ab{0,1}bc)"; }
+
+
 
 
 
@@ -6177,6 +2066,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_02_ranges::regex_39_matcher::to_string() -> std::string{return R"(ab?c)"; }
 
 
@@ -6292,6 +2182,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_02_ranges::regex_40_matcher::to_string() -> std::string{return R"(ab{0,1}c)"; }
 
 
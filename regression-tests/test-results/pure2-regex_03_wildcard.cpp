@@ -5,7 +5,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-regex_03_wildcard.cpp2"
 
@@ -58,6 +60,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_01_matcher() = default;
@@ -66,7 +70,9 @@ public: class func_1 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: class regex_02_matcher {
+  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: using regex_02_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: using regex_03_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_03_matcher> regex_03 {}; public: class regex_04_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -94,15 +100,19 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_02_matcher() = default;
-        public: regex_02_matcher(regex_02_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_02_matcher const&) -> void = delete;
+        public: regex_04_matcher() = default;
+        public: regex_04_matcher(regex_04_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_04_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: class regex_03_matcher {
+  public: cpp2::regex::regular_expression<char,regex_04_matcher> regex_04 {}; public: using regex_05_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: using regex_06_matcher = regex_04_matcher;
+public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -130,15 +140,19 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_03_matcher() = default;
-        public: regex_03_matcher(regex_03_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_03_matcher const&) -> void = delete;
+        public: regex_07_matcher() = default;
+        public: regex_07_matcher(regex_07_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_07_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_03_matcher> regex_03 {}; public: class regex_04_matcher {
+  public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: using regex_08_matcher = regex_07_matcher;
+public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: using regex_09_matcher = regex_07_matcher;
+public: cpp2::regex::regular_expression<char,regex_09_matcher> regex_09 {}; public: class regex_10_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -166,15 +180,19 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_04_matcher() = default;
-        public: regex_04_matcher(regex_04_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_04_matcher const&) -> void = delete;
+        public: regex_10_matcher() = default;
+        public: regex_10_matcher(regex_10_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_10_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_04_matcher> regex_04 {}; public: class regex_05_matcher {
+  public: cpp2::regex::regular_expression<char,regex_10_matcher> regex_10 {}; public: using regex_11_matcher = regex_10_matcher;
+public: cpp2::regex::regular_expression<char,regex_11_matcher> regex_11 {}; public: using regex_12_matcher = regex_10_matcher;
+public: cpp2::regex::regular_expression<char,regex_12_matcher> regex_12 {}; public: class regex_13_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -202,28 +220,20 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_05_matcher() = default;
-        public: regex_05_matcher(regex_05_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_05_matcher const&) -> void = delete;
+        public: regex_13_matcher() = default;
+        public: regex_13_matcher(regex_13_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_13_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: class regex_06_matcher {
+  public: cpp2::regex::regular_expression<char,regex_13_matcher> regex_13 {}; public: class regex_14_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
+public: class func_0 {
   public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
 
   };
@@ -238,28 +248,21 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_06_matcher() = default;
-        public: regex_06_matcher(regex_06_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_06_matcher const&) -> void = delete;
+        public: regex_14_matcher() = default;
+        public: regex_14_matcher(regex_14_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_14_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
+  public: cpp2::regex::regular_expression<char,regex_14_matcher> regex_14 {}; public: using regex_15_matcher = regex_14_matcher;
+public: cpp2::regex::regular_expression<char,regex_15_matcher> regex_15 {}; public: class regex_16_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
+public: class func_0 {
   public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
 
   };
@@ -274,15 +277,17 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_07_matcher() = default;
-        public: regex_07_matcher(regex_07_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_07_matcher const&) -> void = delete;
+        public: regex_16_matcher() = default;
+        public: regex_16_matcher(regex_16_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_16_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: class regex_08_matcher {
+  public: cpp2::regex::regular_expression<char,regex_16_matcher> regex_16 {}; public: class regex_17_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -310,15 +315,17 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_08_matcher() = default;
-        public: regex_08_matcher(regex_08_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_08_matcher const&) -> void = delete;
+        public: regex_17_matcher() = default;
+        public: regex_17_matcher(regex_17_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_17_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: class regex_09_matcher {
+  public: cpp2::regex::regular_expression<char,regex_17_matcher> regex_17 {}; public: class regex_18_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_1 {
@@ -346,1038 +353,229 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
-        public: regex_09_matcher() = default;
-        public: regex_09_matcher(regex_09_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_09_matcher const&) -> void = delete;
+        public: regex_18_matcher() = default;
+        public: regex_18_matcher(regex_18_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_18_matcher const&) -> void = delete;
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_09_matcher> regex_09 {}; public: class regex_10_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
+  public: cpp2::regex::regular_expression<char,regex_18_matcher> regex_18 {}; public: using regex_19_matcher = regex_17_matcher;
+public: cpp2::regex::regular_expression<char,regex_19_matcher> regex_19 {}; public: using regex_20_matcher = regex_18_matcher;
+public: cpp2::regex::regular_expression<char,regex_20_matcher> regex_20 {}; 
+  public: test_tests_03_wildcard() = default;
+  public: test_tests_03_wildcard(test_tests_03_wildcard const&) = delete; /* No 'that' constructor, suppress copy */
+  public: auto operator=(test_tests_03_wildcard const&) -> void = delete;
 
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
 
-  };
+#line 210 "pure2-regex_03_wildcard.cpp2"
+};
+auto main() -> int;
 
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+//=== Cpp2 function definitions =================================================
 
-  };
+#line 1 "pure2-regex_03_wildcard.cpp2"
+[[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
+  std::string result {""}; 
 
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+  auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
+  auto start {std::distance(CPP2_UFCS(cbegin)((*cpp2::impl::assert_not_null(_0))), iter)}; 
+    auto firstDollar {CPP2_UFCS(find)((*cpp2::impl::assert_not_null(_0)), "$", start)}; 
+    auto firstAt {CPP2_UFCS(find)((*cpp2::impl::assert_not_null(_0)), "@", cpp2::move(start))}; 
 
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+  auto end {std::min(cpp2::move(firstDollar), cpp2::move(firstAt))}; 
+  if (end != std::string::npos) {
+   return CPP2_UFCS(cbegin)((*cpp2::impl::assert_not_null(_0))) + cpp2::move(end); 
+  }
+  else {
+   return CPP2_UFCS(cend)((*cpp2::impl::assert_not_null(_0))); 
+  }
+  }}; 
+  auto extract_group_and_advance {[](auto& iter) -> auto{
+    auto start {iter}; 
 
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
+    for( ; std::isdigit(*cpp2::impl::assert_not_null(iter)); ++iter ) {}
 
-  };
+    return std::stoi(std::string(cpp2::move(start), iter)); 
+  }}; 
+  auto extract_until {[](auto& iter, cpp2::impl::in<char> to) -> auto{
+    auto start {iter}; 
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
+    for( ; (to != *cpp2::impl::assert_not_null(iter)); ++iter ) {}// TODO: Without bracket: error: postfix unary * (dereference) cannot be immediately followed by a (, identifier, or literal - add whitespace before * here if you meant binary * (multiplication)
 
-        public: regex_10_matcher() = default;
-        public: regex_10_matcher(regex_10_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_10_matcher const&) -> void = delete;
+    return std::string(cpp2::move(start), iter); 
+  }}; 
 
-  };
+  auto iter {CPP2_UFCS(begin)(resultExpr)}; 
 
-  public: cpp2::regex::regular_expression<char,regex_10_matcher> regex_10 {}; public: class regex_11_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+  while( iter != CPP2_UFCS(end)(resultExpr) ) {
+    auto next {get_next(iter)}; 
 
-  };
+    if (next != iter) {
+      result += std::string(iter, next);
+    }
+    if (next != CPP2_UFCS(end)(resultExpr)) {
+      if (*cpp2::impl::assert_not_null(next) == '$') {
+        ++next;
 
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+        if (*cpp2::impl::assert_not_null(next) == '&') {
+          ++next;
+          result += CPP2_UFCS(group)(r, 0);
+        }
+        else {if (*cpp2::impl::assert_not_null(next) == '-' || *cpp2::impl::assert_not_null(next) == '+') {
+          auto is_start {*cpp2::impl::assert_not_null(next) == '-'}; 
+          ++next;
+          if (*cpp2::impl::assert_not_null(next) == '{') {
+            ++next; // Skip {
+            auto group {extract_until(next, '}')}; 
+            ++next; // Skip }
+            result += CPP2_UFCS(group)(r, cpp2::move(group));
+          }
+          else {if (*cpp2::impl::assert_not_null(next) == '[') {
+            ++next; // Skip [
+            auto group {extract_group_and_advance(next)}; 
+            ++next; // Skip ]
 
-  };
+            if (cpp2::move(is_start)) {
+              result += std::to_string(CPP2_UFCS(group_start)(r, cpp2::move(group)));
+            }
+            else {
+              result += std::to_string(CPP2_UFCS(group_end)(r, cpp2::move(group)));
+            }
+          }
+          else {
+            // Return max group
+            result += CPP2_UFCS(group)(r, CPP2_UFCS(group_number)(r) - 1);
+          }}
+        }
+        else {if (std::isdigit(*cpp2::impl::assert_not_null(next))) {
+          auto group {extract_group_and_advance(next)}; 
+          result += CPP2_UFCS(group)(r, cpp2::move(group));
+        }
+        else {
+          std::cerr << "Not implemented";
+        }}}
+      }
+      else {if (*cpp2::impl::assert_not_null(next) == '@') {
+        ++next;
 
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+        if (*cpp2::impl::assert_not_null(next) == '-' || *cpp2::impl::assert_not_null(next) == '+') {
+          auto i {0}; 
+          for( ; cpp2::impl::cmp_less(i,cpp2::unchecked_narrow<int>(CPP2_UFCS(group_number)(r))); ++i ) {
+            auto pos {0}; 
+            if (*cpp2::impl::assert_not_null(next) == '-') {
+              pos = CPP2_UFCS(group_start)(r, i);
+            }
+            else {
+              pos = CPP2_UFCS(group_end)(r, i);
+            }
+            result +=  std::to_string(cpp2::move(pos));
+          }
+        }
+        else {
+          std::cerr << "Not implemented";
+        }
+      }
+      else {
+        std::cerr << "Not implemented.";
+      }}
+    }
+    iter = cpp2::move(next);
+  }
 
-  };
+  return result; 
+}
 
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+[[nodiscard]] auto sanitize(std::string str) -> std::string
+{
+  str = cpp2::string_util::replace_all(str, "\a", "\\a");
+  str = cpp2::string_util::replace_all(str, "\f", "\\f");
+  str = cpp2::string_util::replace_all(str, "\x1b", "\\e");
+  str = cpp2::string_util::replace_all(str, "\n", "\\n");
+  str = cpp2::string_util::replace_all(str, "\r", "\\r");
+  str = cpp2::string_util::replace_all(str, "\t", "\\t");
 
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+  return cpp2::move(str); 
+}
 
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
+template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
+           cpp2::impl::in<std::string> resultExpected) -> void{
 
-  };
+  std::string warning {""}; 
+  if (CPP2_UFCS(to_string)(regex) != regex_str) {
+    warning = "Warning: Parsed regex does not match.";
+  }
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
+  std::string status {"OK"}; 
 
-        public: regex_11_matcher() = default;
-        public: regex_11_matcher(regex_11_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_11_matcher const&) -> void = delete;
+  auto r {CPP2_UFCS(search)(regex, str)}; 
 
-  };
+  if ("y" == kind || "yM" == kind || "yS" == kind || "yB" == kind) {
+    if (!(r.matched)) {
+      status = "Failure: Regex should apply.";
+    }
+    else {
+      // Have a match check the result
 
-  public: cpp2::regex::regular_expression<char,regex_11_matcher> regex_11 {}; public: class regex_12_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+      auto result {create_result(resultExpr, cpp2::move(r))}; 
 
-  };
+      if (result != resultExpected) {
+        status = "Failure: Result is wrong. (is: " + cpp2::to_string(sanitize(cpp2::move(result))) + ")";
+      }
+    }
+  }
+  else {if ("n" == kind) {
+    if (r.matched) {
+      status = "Failure: Regex should not apply. Result is '" + cpp2::to_string(CPP2_UFCS(group)(cpp2::move(r), 0)) + "'";
+    }
+  }else {
+    status = "Unknown kind '" + cpp2::to_string(kind) + "'";
+  }}
 
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_12_matcher() = default;
-        public: regex_12_matcher(regex_12_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_12_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_12_matcher> regex_12 {}; public: class regex_13_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_13_matcher() = default;
-        public: regex_13_matcher(regex_13_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_13_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_13_matcher> regex_13 {}; public: class regex_14_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_14_matcher() = default;
-        public: regex_14_matcher(regex_14_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_14_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_14_matcher> regex_14 {}; public: class regex_15_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_15_matcher() = default;
-        public: regex_15_matcher(regex_15_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_15_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_15_matcher> regex_15 {}; public: class regex_16_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_16_matcher() = default;
-        public: regex_16_matcher(regex_16_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_16_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_16_matcher> regex_16 {}; public: class regex_17_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_17_matcher() = default;
-        public: regex_17_matcher(regex_17_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_17_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_17_matcher> regex_17 {}; public: class regex_18_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_18_matcher() = default;
-        public: regex_18_matcher(regex_18_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_18_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_18_matcher> regex_18 {}; public: class regex_19_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_19_matcher() = default;
-        public: regex_19_matcher(regex_19_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_19_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_19_matcher> regex_19 {}; public: class regex_20_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_1 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: class func_2 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_20_matcher() = default;
-        public: regex_20_matcher(regex_20_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_20_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_20_matcher> regex_20 {}; 
-  public: test_tests_03_wildcard() = default;
-  public: test_tests_03_wildcard(test_tests_03_wildcard const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(test_tests_03_wildcard const&) -> void = delete;
-
-
-#line 210 "pure2-regex_03_wildcard.cpp2"
-};
-auto main() -> int;
-
-//=== Cpp2 function definitions =================================================
-
-#line 1 "pure2-regex_03_wildcard.cpp2"
-[[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
-#line 2 "pure2-regex_03_wildcard.cpp2"
-  std::string result {""}; 
-
-  auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
-  auto start {std::distance(CPP2_UFCS(cbegin)((*cpp2::impl::assert_not_null(_0))), iter)}; 
-    auto firstDollar {CPP2_UFCS(find)((*cpp2::impl::assert_not_null(_0)), "$", start)}; 
-    auto firstAt {CPP2_UFCS(find)((*cpp2::impl::assert_not_null(_0)), "@", cpp2::move(start))}; 
-
-  auto end {std::min(cpp2::move(firstDollar), cpp2::move(firstAt))}; 
-  if (end != std::string::npos) {
-   return CPP2_UFCS(cbegin)((*cpp2::impl::assert_not_null(_0))) + cpp2::move(end); 
-  }
-  else {
-   return CPP2_UFCS(cend)((*cpp2::impl::assert_not_null(_0))); 
-  }
-  }}; 
-  auto extract_group_and_advance {[](auto& iter) -> auto{
-    auto start {iter}; 
-
-    for( ; std::isdigit(*cpp2::impl::assert_not_null(iter)); ++iter ) {}
-
-    return std::stoi(std::string(cpp2::move(start), iter)); 
-  }}; 
-  auto extract_until {[](auto& iter, cpp2::impl::in<char> to) -> auto{
-    auto start {iter}; 
-
-    for( ; (to != *cpp2::impl::assert_not_null(iter)); ++iter ) {}// TODO: Without bracket: error: postfix unary * (dereference) cannot be immediately followed by a (, identifier, or literal - add whitespace before * here if you meant binary * (multiplication)
-
-    return std::string(cpp2::move(start), iter); 
-  }}; 
-
-  auto iter {CPP2_UFCS(begin)(resultExpr)}; 
-
-  while( iter != CPP2_UFCS(end)(resultExpr) ) {
-    auto next {get_next(iter)}; 
-
-    if (next != iter) {
-      result += std::string(iter, next);
-    }
-    if (next != CPP2_UFCS(end)(resultExpr)) {
-      if (*cpp2::impl::assert_not_null(next) == '$') {
-        ++next;
-
-        if (*cpp2::impl::assert_not_null(next) == '&') {
-          ++next;
-          result += CPP2_UFCS(group)(r, 0);
-        }
-        else {if (*cpp2::impl::assert_not_null(next) == '-' || *cpp2::impl::assert_not_null(next) == '+') {
-          auto is_start {*cpp2::impl::assert_not_null(next) == '-'}; 
-          ++next;
-          if (*cpp2::impl::assert_not_null(next) == '{') {
-            ++next; // Skip {
-            auto group {extract_until(next, '}')}; 
-            ++next; // Skip }
-            result += CPP2_UFCS(group)(r, cpp2::move(group));
-          }
-          else {if (*cpp2::impl::assert_not_null(next) == '[') {
-            ++next; // Skip [
-            auto group {extract_group_and_advance(next)}; 
-            ++next; // Skip ]
-
-            if (cpp2::move(is_start)) {
-              result += std::to_string(CPP2_UFCS(group_start)(r, cpp2::move(group)));
-            }
-            else {
-              result += std::to_string(CPP2_UFCS(group_end)(r, cpp2::move(group)));
-            }
-          }
-          else {
-            // Return max group
-            result += CPP2_UFCS(group)(r, CPP2_UFCS(group_number)(r) - 1);
-          }}
-        }
-        else {if (std::isdigit(*cpp2::impl::assert_not_null(next))) {
-          auto group {extract_group_and_advance(next)}; 
-          result += CPP2_UFCS(group)(r, cpp2::move(group));
-        }
-        else {
-          std::cerr << "Not implemented";
-        }}}
-      }
-      else {if (*cpp2::impl::assert_not_null(next) == '@') {
-        ++next;
-
-        if (*cpp2::impl::assert_not_null(next) == '-' || *cpp2::impl::assert_not_null(next) == '+') {
-          auto i {0}; 
-          for( ; cpp2::impl::cmp_less(i,cpp2::unchecked_narrow<int>(CPP2_UFCS(group_number)(r))); ++i ) {
-            auto pos {0}; 
-            if (*cpp2::impl::assert_not_null(next) == '-') {
-              pos = CPP2_UFCS(group_start)(r, i);
-            }
-            else {
-              pos = CPP2_UFCS(group_end)(r, i);
-            }
-            result +=  std::to_string(cpp2::move(pos));
-          }
-        }
-        else {
-          std::cerr << "Not implemented";
-        }
-      }
-      else {
-        std::cerr << "Not implemented.";
-      }}
-    }
-    iter = cpp2::move(next);
-  }
-
-  return result; 
-}
-
-#line 112 "pure2-regex_03_wildcard.cpp2"
-[[nodiscard]] auto sanitize(std::string str) -> std::string
-{
-  str = cpp2::string_util::replace_all(str, "\a", "\\a");
-  str = cpp2::string_util::replace_all(str, "\f", "\\f");
-  str = cpp2::string_util::replace_all(str, "\x1b", "\\e");
-  str = cpp2::string_util::replace_all(str, "\n", "\\n");
-  str = cpp2::string_util::replace_all(str, "\r", "\\r");
-  str = cpp2::string_util::replace_all(str, "\t", "\\t");
-
-  return cpp2::move(str); 
-}
-
-#line 124 "pure2-regex_03_wildcard.cpp2"
-template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
-           cpp2::impl::in<std::string> resultExpected) -> void{
-
-  std::string warning {""}; 
-  if (CPP2_UFCS(to_string)(regex) != regex_str) {
-    warning = "Warning: Parsed regex does not match.";
-  }
-
-  std::string status {"OK"}; 
-
-  auto r {CPP2_UFCS(search)(regex, str)}; 
-
-  if ("y" == kind || "yM" == kind || "yS" == kind || "yB" == kind) {
-    if (!(r.matched)) {
-      status = "Failure: Regex should apply.";
-    }
-    else {
-      // Have a match check the result
-
-      auto result {create_result(resultExpr, cpp2::move(r))}; 
-
-      if (result != resultExpected) {
-        status = "Failure: Result is wrong. (is: " + cpp2::to_string(sanitize(cpp2::move(result))) + ")";
-      }
-    }
-  }
-  else {if ("n" == kind) {
-    if (r.matched) {
-      status = "Failure: Regex should not apply. Result is '" + cpp2::to_string(CPP2_UFCS(group)(cpp2::move(r), 0)) + "'";
-    }
-  }else {
-    status = "Unknown kind '" + cpp2::to_string(kind) + "'";
-  }}
-
-  if (!(CPP2_UFCS(empty)(warning))) {
-    warning += " ";
-  }
-  std::cout << "" + cpp2::to_string(id) + "_" + cpp2::to_string(kind) + ": " + cpp2::to_string(cpp2::move(status)) + " " + cpp2::to_string(cpp2::move(warning)) + "regex: " + cpp2::to_string(regex_str) + " parsed_regex: " + cpp2::to_string(CPP2_UFCS(to_string)(regex)) + " str: " + cpp2::to_string(sanitize(str)) + " result_expr: " + cpp2::to_string(resultExpr) + " expected_results " + cpp2::to_string(sanitize(resultExpected)) + "" << std::endl;
-}
-
-#line 186 "pure2-regex_03_wildcard.cpp2"
-  auto test_tests_03_wildcard::run() const& -> void{
-    std::cout << "Running tests_03_wildcard:" << std::endl;
-    test(regex_01, "01", R"(.{1})", "abbbbc", "y", R"($&)", "a");
-    test(regex_02, "02", R"(.{1})", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_03, "03", R"(.{1})", "abbbbc", "y", R"($+[0])", "1");
-    test(regex_04, "04", R"(.{3,4})", "abbbbc", "y", R"($&)", "abbb");
-    test(regex_05, "05", R"(.{3,4})", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_06, "06", R"(.{3,4})", "abbbbc", "y", R"($+[0])", "4");
-    test(regex_07, "07", R"(\N{1})", "abbbbc", "y", R"($&)", "a");
-    test(regex_08, "08", R"(\N{1})", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_09, "09", R"(\N{1})", "abbbbc", "y", R"($+[0])", "1");
-    test(regex_10, "10", R"(\N{3,4})", "abbbbc", "y", R"($&)", "abbb");
-    test(regex_11, "11", R"(\N{3,4})", "abbbbc", "y", R"($-[0])", "0");
-    test(regex_12, "12", R"(\N{3,4})", "abbbbc", "y", R"($+[0])", "4");
-    test(regex_13, "13", R"(\N{ 3 , 4 })", "abbbbc", "y", R"($+[0])", "4");
-    test(regex_14, "14", R"(a.c)", "abc", "y", R"($&)", "abc");
-    test(regex_15, "15", R"(a.c)", "axc", "y", R"($&)", "axc");
-    test(regex_16, "16", R"(a\Nc)", "abc", "y", R"($&)", "abc");
-    test(regex_17, "17", R"(a.*c)", "axyzc", "y", R"($&)", "axyzc");
-    test(regex_18, "18", R"(a\N*c)", "axyzc", "y", R"($&)", "axyzc");
-    test(regex_19, "19", R"(a.*c)", "axyzd", "n", R"(-)", "-");
-    test(regex_20, "20", R"(a\N*c)", "axyzd", "n", R"(-)", "-");
-    std::cout << std::endl;
-  }
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::to_string() -> std::string{return R"(.{1})"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_02_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_02_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_02_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_02_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_02_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_03_wildcard::regex_02_matcher::to_string() -> std::string{return R"(.{1})"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_03_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_03_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_03_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_03_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_03_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_03_wildcard::regex_03_matcher::to_string() -> std::string{return R"(.{1})"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::to_string() -> std::string{return R"(.{3,4})"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_05_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_05_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_05_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_05_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_05_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_03_wildcard::regex_05_matcher::to_string() -> std::string{return R"(.{3,4})"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_06_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_06_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_06_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_06_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_06_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
+  if (!(CPP2_UFCS(empty)(warning))) {
+    warning += " ";
   }
+  std::cout << "" + cpp2::string_build(cpp2::interp(id), "_", cpp2::interp(kind), ": ", cpp2::interp(cpp2::move(status)), " ", cpp2::interp(cpp2::move(warning)), "regex: ", cpp2::interp(regex_str), " parsed_regex: ", cpp2::interp(CPP2_UFCS(to_string)(regex)), " str: ", cpp2::interp(sanitize(str)), " result_expr: ", cpp2::interp(resultExpr), " expected_results ", cpp2::interp(sanitize(resultExpected))) + "" << std::endl;
+}
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_06_matcher::to_string() -> std::string{return R"(.{3,4})"; }
-
+#line 186 "pure2-regex_03_wildcard.cpp2"
+  auto test_tests_03_wildcard::run() const& -> void{
+    std::cout << "Running tests_03_wildcard:" << std::endl;
+    test(regex_01, "01", R"(.{1})", "abbbbc", "y", R"($&)", "a");
+    test(regex_02, "02", R"(.{1})", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_03, "03", R"(.{1})", "abbbbc", "y", R"($+[0])", "1");
+    test(regex_04, "04", R"(.{3,4})", "abbbbc", "y", R"($&)", "abbb");
+    test(regex_05, "05", R"(.{3,4})", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_06, "06", R"(.{3,4})", "abbbbc", "y", R"($+[0])", "4");
+    test(regex_07, "07", R"(\N{1})", "abbbbc", "y", R"($&)", "a");
+    test(regex_08, "08", R"(\N{1})", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_09, "09", R"(\N{1})", "abbbbc", "y", R"($+[0])", "1");
+    test(regex_10, "10", R"(\N{3,4})", "abbbbc", "y", R"($&)", "abbb");
+    test(regex_11, "11", R"(\N{3,4})", "abbbbc", "y", R"($-[0])", "0");
+    test(regex_12, "12", R"(\N{3,4})", "abbbbc", "y", R"($+[0])", "4");
+    test(regex_13, "13", R"(\N{ 3 , 4 })", "abbbbc", "y", R"($+[0])", "4");
+    test(regex_14, "14", R"(a.c)", "abc", "y", R"($&)", "abc");
+    test(regex_15, "15", R"(a.c)", "axc", "y", R"($&)", "axc");
+    test(regex_16, "16", R"(a\Nc)", "abc", "y", R"($&)", "abc");
+    test(regex_17, "17", R"(a.*c)", "axyzc", "y", R"($&)", "axyzc");
+    test(regex_18, "18", R"(a\N*c)", "axyzc", "y", R"($&)", "axyzc");
+    test(regex_19, "19", R"(a.*c)", "axyzd", "n", R"(-)", "-");
+    test(regex_20, "20", R"(a\N*c)", "axyzd", "n", R"(-)", "-");
+    std::cout << std::endl;
+  }
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
-  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
+  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
   }
    while ( 
   false
@@ -1392,7 +590,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1410,7 +608,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1427,7 +625,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -1435,97 +633,28 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::to_string() -> std::string{return R"(\N{1})"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_08_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_08_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_08_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_03_wildcard::regex_01_matcher::to_string() -> std::string{return R"(.{1})"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_08_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_08_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_08_matcher::to_string() -> std::string{return R"(\N{1})"; }
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_09_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
-  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
+  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
   }
    while ( 
   false
@@ -1540,7 +669,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_09_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1549,7 +678,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,1,1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -1558,7 +687,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_09_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1575,7 +704,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_09_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -1583,93 +712,24 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_09_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_09_matcher::to_string() -> std::string{return R"(\N{1})"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_03_wildcard::regex_04_matcher::to_string() -> std::string{return R"(.{3,4})"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::to_string() -> std::string{return R"(\N{3,4})"; }
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_11_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1688,7 +748,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_11_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1697,7 +757,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   false
   );
   if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+  r = cpp2::regex::range_token_matcher<char,1,1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -1706,7 +766,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_11_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1723,7 +783,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_11_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -1731,93 +791,24 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_11_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_11_matcher::to_string() -> std::string{return R"(\N{3,4})"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_12_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_12_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_12_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_03_wildcard::regex_07_matcher::to_string() -> std::string{return R"(\N{1})"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_12_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_12_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_12_matcher::to_string() -> std::string{return R"(\N{3,4})"; }
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1836,7 +827,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1854,7 +845,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -1871,7 +862,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -1879,51 +870,28 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::to_string() -> std::string{return R"(\N{3,4})"; }
 
+  [[nodiscard]] auto test_tests_03_wildcard::regex_10_matcher::to_string() -> std::string{return R"(\N{3,4})"; }
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_14_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
-  auto r {ctx.pass(cur)}; 
-  do {
 
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
 
-  std::array<char,1 + 1> str_tmp_1 {"c"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
+
+
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+  auto r {ctx.pass(cur)}; 
+  do {
+  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
   }
    while ( 
   false
@@ -1937,65 +905,17 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_14_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_14_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_03_wildcard::regex_14_matcher::to_string() -> std::string{return R"(a.c)"; }
-
-
-
-
-
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_15_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,1 + 1> str_tmp_1 {"c"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
   }
    while ( 
   false
   );
   if (r.matched) {
-  r = other(r.pos, ctx);
+  r = cpp2::regex::range_token_matcher<char,3,4,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
   }
   else {
   r.pos = ctx.end;
@@ -2003,59 +923,11 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_15_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_15_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_03_wildcard::regex_15_matcher::to_string() -> std::string{return R"(a.c)"; }
-
-
-
-
-
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_16_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,1 + 1> str_tmp_1 {"c"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
   }
    while ( 
   false
@@ -2069,7 +941,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_16_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -2077,38 +949,20 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_16_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_16_matcher::to_string() -> std::string{return R"(a\Nc)"; }
-
-
 
+  [[nodiscard]] auto test_tests_03_wildcard::regex_13_matcher::to_string() -> std::string{return R"(\N{3,4})"; }
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_14_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -2126,24 +980,7 @@ int i{0};
 }
   if (r.matched) {r.pos += 1;}
   else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
+  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
 
   std::array<char,1 + 1> str_tmp_1 {"c"}; 
   if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
@@ -2171,7 +1008,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_14_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -2179,38 +1016,22 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_14_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::to_string() -> std::string{return R"(a.*c)"; }
 
+  [[nodiscard]] auto test_tests_03_wildcard::regex_14_matcher::to_string() -> std::string{return R"(a.c)"; }
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_16_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -2228,24 +1049,7 @@ int i{0};
 }
   if (r.matched) {r.pos += 1;}
   else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
+  if (!(cpp2::regex::named_class_no_new_line<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
 
   std::array<char,1 + 1> str_tmp_1 {"c"}; 
   if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
@@ -2273,7 +1077,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_16_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -2281,19 +1085,20 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_16_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::to_string() -> std::string{return R"(a\N*c)"; }
+
+  [[nodiscard]] auto test_tests_03_wildcard::regex_16_matcher::to_string() -> std::string{return R"(a\Nc)"; }
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_19_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -2312,7 +1117,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_19_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -2344,7 +1149,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_19_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -2375,7 +1180,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_19_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -2383,19 +1188,20 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_19_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_19_matcher::to_string() -> std::string{return R"(a.*c)"; }
+
+  [[nodiscard]] auto test_tests_03_wildcard::regex_17_matcher::to_string() -> std::string{return R"(a.*c)"; }
 
 
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_20_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -2414,7 +1220,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_20_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -2446,7 +1252,7 @@ int i{0};
   }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_20_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
 
   auto r {ctx.pass(cur)}; 
   do {
@@ -2477,7 +1283,7 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_20_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
   ctx.set_group_start(0, cur);
 
   auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
@@ -2485,12 +1291,17 @@ int i{0};
   return r; 
   }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_20_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
   static_cast<void>(name);
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_03_wildcard::regex_20_matcher::to_string() -> std::string{return R"(a\N*c)"; }
+
+  [[nodiscard]] auto test_tests_03_wildcard::regex_18_matcher::to_string() -> std::string{return R"(a\N*c)"; }
+
+
+
+
 
 
 #line 211 "pure2-regex_03_wildcard.cpp2"
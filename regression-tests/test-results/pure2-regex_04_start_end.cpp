@@ -5,7 +5,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-regex_04_start_end.cpp2"
 
@@ -48,6 +50,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141\142\143",true>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_01_matcher() = default;
@@ -56,7 +60,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: class regex_02_matcher {
+  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: using regex_02_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: class regex_03_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_0 {
@@ -74,31 +79,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_02_matcher() = default;
-        public: regex_02_matcher(regex_02_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_02_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: class regex_03_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"\141\142\143",true>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -108,7 +89,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_03_matcher> regex_03 {}; public: class regex_04_matcher {
+  public: cpp2::regex::regular_expression<char,regex_03_matcher> regex_03 {}; public: using regex_04_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_04_matcher> regex_04 {}; public: class regex_05_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_0 {
@@ -126,31 +108,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_04_matcher() = default;
-        public: regex_04_matcher(regex_04_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_04_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_04_matcher> regex_04 {}; public: class regex_05_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"\141\142\143",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -160,7 +118,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: class regex_06_matcher {
+  public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: using regex_06_matcher = regex_05_matcher;
+public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_0 {
@@ -178,31 +137,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_06_matcher() = default;
-        public: regex_06_matcher(regex_06_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_06_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"",true>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -230,6 +165,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_08_matcher() = default;
@@ -256,6 +193,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_09_matcher() = default;
@@ -278,7 +217,6 @@ auto main() -> int;
 
 #line 1 "pure2-regex_04_start_end.cpp2"
 [[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
-#line 2 "pure2-regex_04_start_end.cpp2"
   std::string result {""}; 
 
   auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
@@ -389,7 +327,6 @@ auto main() -> int;
   return result; 
 }
 
-#line 112 "pure2-regex_04_start_end.cpp2"
 [[nodiscard]] auto sanitize(std::string str) -> std::string
 {
   str = cpp2::string_util::replace_all(str, "\a", "\\a");
@@ -402,7 +339,6 @@ auto main() -> int;
   return cpp2::move(str); 
 }
 
-#line 124 "pure2-regex_04_start_end.cpp2"
 template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
            cpp2::impl::in<std::string> resultExpected) -> void{
 
@@ -440,7 +376,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   if (!(CPP2_UFCS(empty)(warning))) {
     warning += " ";
   }
-  std::cout << "" + cpp2::to_string(id) + "_" + cpp2::to_string(kind) + ": " + cpp2::to_string(cpp2::move(status)) + " " + cpp2::to_string(cpp2::move(warning)) + "regex: " + cpp2::to_string(regex_str) + " parsed_regex: " + cpp2::to_string(CPP2_UFCS(to_string)(regex)) + " str: " + cpp2::to_string(sanitize(str)) + " result_expr: " + cpp2::to_string(resultExpr) + " expected_results " + cpp2::to_string(sanitize(resultExpected)) + "" << std::endl;
+  std::cout << "" + cpp2::string_build(cpp2::interp(id), "_", cpp2::interp(kind), ": ", cpp2::interp(cpp2::move(status)), " ", cpp2::interp(cpp2::move(warning)), "regex: ", cpp2::interp(regex_str), " parsed_regex: ", cpp2::interp(CPP2_UFCS(to_string)(regex)), " str: ", cpp2::interp(sanitize(str)), " result_expr: ", cpp2::interp(resultExpr), " expected_results ", cpp2::interp(sanitize(resultExpected))) + "" << std::endl;
 }
 
 #line 175 "pure2-regex_04_start_end.cpp2"
@@ -508,60 +444,10 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_04_start_end::regex_01_matcher::to_string() -> std::string{return R"(^abc$)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_02_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::line_start_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  if (!(cpp2::regex::line_end_token_matcher<char,false,true>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_02_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_04_start_end::regex_01_matcher::to_string() -> std::string{return R"(^abc$)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_02_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_04_start_end::regex_02_matcher::to_string() -> std::string{return R"(^abc$)"; }
 
 
 
@@ -613,60 +499,10 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_04_start_end::regex_03_matcher::to_string() -> std::string{return R"(^abc)"; }
-
-
-
-
 
+  [[nodiscard]] auto test_tests_04_start_end::regex_03_matcher::to_string() -> std::string{return R"(^abc)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_04_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::line_start_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  if (!(cpp2::regex::line_end_token_matcher<char,false,true>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_04_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_04_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_04_start_end::regex_04_matcher::to_string() -> std::string{return R"(^abc$)"; }
 
 
 
@@ -718,59 +554,10 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_04_start_end::regex_05_matcher::to_string() -> std::string{return R"(abc$)"; }
-
-
-
 
+  [[nodiscard]] auto test_tests_04_start_end::regex_05_matcher::to_string() -> std::string{return R"(abc$)"; }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_06_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,3 + 1> str_tmp_0 {"abc"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  if (!(cpp2::regex::line_end_token_matcher<char,false,true>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_06_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_04_start_end::regex_06_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_04_start_end::regex_06_matcher::to_string() -> std::string{return R"(abc$)"; }
 
 
 
@@ -808,6 +595,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_04_start_end::regex_07_matcher::to_string() -> std::string{return R"(^)"; }
 
 
@@ -846,6 +634,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_04_start_end::regex_08_matcher::to_string() -> std::string{return R"($)"; }
 
 
@@ -898,6 +687,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_04_start_end::regex_09_matcher::to_string() -> std::string{return R"($b)"; }
 
 
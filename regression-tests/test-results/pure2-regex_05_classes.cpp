@@ -5,7 +5,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-regex_05_classes.cpp2"
 
@@ -48,6 +50,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_01_matcher() = default;
@@ -56,7 +60,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: class regex_02_matcher {
+  public: cpp2::regex::regular_expression<char,regex_01_matcher> regex_01 {}; public: using regex_02_matcher = regex_01_matcher;
+public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: class regex_03_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_0 {
@@ -74,31 +79,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_02_matcher() = default;
-        public: regex_02_matcher(regex_02_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_02_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_02_matcher> regex_02 {}; public: class regex_03_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -126,6 +107,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_04_matcher() = default;
@@ -152,6 +135,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_05_matcher() = default;
@@ -160,7 +145,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: class regex_06_matcher {
+  public: cpp2::regex::regular_expression<char,regex_05_matcher> regex_05 {}; public: using regex_06_matcher = regex_05_matcher;
+public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_0 {
@@ -178,31 +164,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_06_matcher() = default;
-        public: regex_06_matcher(regex_06_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_06_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -212,7 +174,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: class regex_08_matcher {
+  public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: using regex_08_matcher = regex_07_matcher;
+public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: class regex_09_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_0 {
@@ -230,31 +193,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_08_matcher() = default;
-        public: regex_08_matcher(regex_08_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_08_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: class regex_09_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -282,6 +221,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_10_matcher() = default;
@@ -308,6 +249,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_11_matcher() = default;
@@ -334,6 +277,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141\135",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_12_matcher() = default;
@@ -360,6 +305,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_13_matcher() = default;
@@ -386,6 +333,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_14_matcher() = default;
@@ -394,7 +343,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_14_matcher> regex_14 {}; public: class regex_15_matcher {
+  public: cpp2::regex::regular_expression<char,regex_14_matcher> regex_14 {}; public: using regex_15_matcher = regex_14_matcher;
+public: cpp2::regex::regular_expression<char,regex_15_matcher> regex_15 {}; public: class regex_16_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_0 {
@@ -412,31 +362,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_15_matcher() = default;
-        public: regex_15_matcher(regex_15_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_15_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_15_matcher> regex_15 {}; public: class regex_16_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -446,7 +372,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_16_matcher> regex_16 {}; public: class regex_17_matcher {
+  public: cpp2::regex::regular_expression<char,regex_16_matcher> regex_16 {}; public: using regex_17_matcher = regex_16_matcher;
+public: cpp2::regex::regular_expression<char,regex_17_matcher> regex_17 {}; public: class regex_18_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,1>;
 public: class func_0 {
@@ -464,31 +391,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_17_matcher() = default;
-        public: regex_17_matcher(regex_17_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_17_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_17_matcher> regex_17 {}; public: class regex_18_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -498,33 +401,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_18_matcher> regex_18 {}; public: class regex_19_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,1>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_19_matcher() = default;
-        public: regex_19_matcher(regex_19_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_19_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_19_matcher> regex_19 {}; 
+  public: cpp2::regex::regular_expression<char,regex_18_matcher> regex_18 {}; public: using regex_19_matcher = regex_18_matcher;
+public: cpp2::regex::regular_expression<char,regex_19_matcher> regex_19 {}; 
   public: test_tests_05_classes() = default;
   public: test_tests_05_classes(test_tests_05_classes const&) = delete; /* No 'that' constructor, suppress copy */
   public: auto operator=(test_tests_05_classes const&) -> void = delete;
@@ -538,7 +416,6 @@ auto main() -> int;
 
 #line 1 "pure2-regex_05_classes.cpp2"
 [[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
-#line 2 "pure2-regex_05_classes.cpp2"
   std::string result {""}; 
 
   auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
@@ -649,7 +526,6 @@ auto main() -> int;
   return result; 
 }
 
-#line 112 "pure2-regex_05_classes.cpp2"
 [[nodiscard]] auto sanitize(std::string str) -> std::string
 {
   str = cpp2::string_util::replace_all(str, "\a", "\\a");
@@ -662,7 +538,6 @@ auto main() -> int;
   return cpp2::move(str); 
 }
 
-#line 124 "pure2-regex_05_classes.cpp2"
 template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
            cpp2::impl::in<std::string> resultExpected) -> void{
 
@@ -700,7 +575,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   if (!(CPP2_UFCS(empty)(warning))) {
     warning += " ";
   }
-  std::cout << "" + cpp2::to_string(id) + "_" + cpp2::to_string(kind) + ": " + cpp2::to_string(cpp2::move(status)) + " " + cpp2::to_string(cpp2::move(warning)) + "regex: " + cpp2::to_string(regex_str) + " parsed_regex: " + cpp2::to_string(CPP2_UFCS(to_string)(regex)) + " str: " + cpp2::to_string(sanitize(str)) + " result_expr: " + cpp2::to_string(resultExpr) + " expected_results " + cpp2::to_string(sanitize(resultExpected)) + "" << std::endl;
+  std::cout << "" + cpp2::string_build(cpp2::interp(id), "_", cpp2::interp(kind), ": ", cpp2::interp(cpp2::move(status)), " ", cpp2::interp(cpp2::move(warning)), "regex: ", cpp2::interp(regex_str), " parsed_regex: ", cpp2::interp(CPP2_UFCS(to_string)(regex)), " str: ", cpp2::interp(sanitize(str)), " result_expr: ", cpp2::interp(resultExpr), " expected_results ", cpp2::interp(sanitize(resultExpected))) + "" << std::endl;
 }
 
 #line 185 "pure2-regex_05_classes.cpp2"
@@ -791,73 +666,10 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_01_matcher::to_string() -> std::string{return R"(a[bc]d)"; }
-
-
-
 
+  [[nodiscard]] auto test_tests_05_classes::regex_01_matcher::to_string() -> std::string{return R"(a[bc]d)"; }
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_02_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::class_token_matcher<char,false,false,::cpp2::regex::single_class_entry<char,'b'>,::cpp2::regex::single_class_entry<char,'c'>>::match(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,1 + 1> str_tmp_1 {"d"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_02_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_02_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_05_classes::regex_02_matcher::to_string() -> std::string{return R"(a[bc]d)"; }
 
 
 
@@ -923,6 +735,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_05_classes::regex_03_matcher::to_string() -> std::string{return R"(a[b]d)"; }
 
 
@@ -963,6 +776,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_05_classes::regex_04_matcher::to_string() -> std::string{return R"([a][b][d])"; }
 
 
@@ -1003,47 +817,10 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_05_matcher::to_string() -> std::string{return R"(.[b].)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_06_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  if (!(cpp2::regex::class_token_matcher<char,false,false,::cpp2::regex::single_class_entry<char,'b'>>::match(r.pos, ctx))) {r.matched = false;break;}
-  if (!(cpp2::regex::any_token_matcher<char,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_06_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_05_classes::regex_05_matcher::to_string() -> std::string{return R"(.[b].)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_06_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_06_matcher::to_string() -> std::string{return R"(.[b].)"; }
 
 
 
@@ -1109,73 +886,10 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_07_matcher::to_string() -> std::string{return R"(a[b-d]e)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_08_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::class_token_matcher<char,false,false,::cpp2::regex::range_class_entry<char,'b','d'>>::match(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,1 + 1> str_tmp_1 {"e"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_08_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_05_classes::regex_07_matcher::to_string() -> std::string{return R"(a[b-d]e)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_08_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_08_matcher::to_string() -> std::string{return R"(a[b-d]e)"; }
 
 
 
@@ -1227,6 +941,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_05_classes::regex_09_matcher::to_string() -> std::string{return R"(a[b-d])"; }
 
 
@@ -1279,6 +994,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_05_classes::regex_10_matcher::to_string() -> std::string{return R"(a[-b])"; }
 
 
@@ -1331,6 +1047,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_05_classes::regex_11_matcher::to_string() -> std::string{return R"(a[b-])"; }
 
 
@@ -1382,6 +1099,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_05_classes::regex_12_matcher::to_string() -> std::string{return R"(a])"; }
 
 
@@ -1448,6 +1166,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_05_classes::regex_13_matcher::to_string() -> std::string{return R"(a[]]b)"; }
 
 
@@ -1514,75 +1233,12 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_14_matcher::to_string() -> std::string{return R"(a[^bc]d)"; }
-
 
+  [[nodiscard]] auto test_tests_05_classes::regex_14_matcher::to_string() -> std::string{return R"(a[^bc]d)"; }
 
 
 
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_15_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::class_token_matcher<char,true,false,::cpp2::regex::single_class_entry<char,'b'>,::cpp2::regex::single_class_entry<char,'c'>>::match(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,1 + 1> str_tmp_1 {"d"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_15_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_15_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_05_classes::regex_15_matcher::to_string() -> std::string{return R"(a[^bc]d)"; }
-
-
 
 
 
@@ -1646,73 +1302,10 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_16_matcher::to_string() -> std::string{return R"(a[^-b]c)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_17_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::class_token_matcher<char,true,false,::cpp2::regex::single_class_entry<char,'-'>,::cpp2::regex::single_class_entry<char,'b'>>::match(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,1 + 1> str_tmp_1 {"c"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_17_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_05_classes::regex_16_matcher::to_string() -> std::string{return R"(a[^-b]c)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_17_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_17_matcher::to_string() -> std::string{return R"(a[^-b]c)"; }
 
 
 
@@ -1778,75 +1371,12 @@ int i{0};
   return -1; 
   }
 
-  [[nodiscard]] auto test_tests_05_classes::regex_18_matcher::to_string() -> std::string{return R"(a[^]b]c)"; }
 
+  [[nodiscard]] auto test_tests_05_classes::regex_18_matcher::to_string() -> std::string{return R"(a[^]b]c)"; }
 
 
 
 
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_19_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-
-  std::array<char,1 + 1> str_tmp_0 {"a"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::class_token_matcher<char,true,false,::cpp2::regex::single_class_entry<char,']'>,::cpp2::regex::single_class_entry<char,'b'>>::match(r.pos, ctx))) {r.matched = false;break;}
-
-  std::array<char,1 + 1> str_tmp_1 {"c"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_19_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
-
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_05_classes::regex_19_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  static_cast<void>(name);
-  return -1; 
-  }
-
-  [[nodiscard]] auto test_tests_05_classes::regex_19_matcher::to_string() -> std::string{return R"(a[^]b]c)"; }
-
-
 #line 209 "pure2-regex_05_classes.cpp2"
 auto main() -> int{
     CPP2_UFCS(run)(test_tests_05_classes());
@@ -5,7 +5,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-regex_11_group_references.cpp2"
 
@@ -48,6 +50,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_01_matcher() = default;
@@ -74,6 +78,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_02_matcher() = default;
@@ -120,6 +126,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_03_matcher() = default;
@@ -146,6 +154,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_04_matcher() = default;
@@ -172,6 +182,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_05_matcher() = default;
@@ -198,6 +210,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_06_matcher() = default;
@@ -206,7 +220,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: class regex_07_matcher {
+  public: cpp2::regex::regular_expression<char,regex_06_matcher> regex_06 {}; public: using regex_07_matcher = regex_05_matcher;
+public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: class regex_08_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,2>;
 public: class func_0 {
@@ -224,31 +239,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_07_matcher() = default;
-        public: regex_07_matcher(regex_07_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_07_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_07_matcher> regex_07 {}; public: class regex_08_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,2>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -258,33 +249,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: class regex_09_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,2>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
-
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_09_matcher() = default;
-        public: regex_09_matcher(regex_09_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_09_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_09_matcher> regex_09 {}; public: class regex_10_matcher {
+  public: cpp2::regex::regular_expression<char,regex_08_matcher> regex_08 {}; public: using regex_09_matcher = regex_08_matcher;
+public: cpp2::regex::regular_expression<char,regex_09_matcher> regex_09 {}; public: class regex_10_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,4>;
 public: class func_1 {
@@ -322,6 +288,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_10_matcher() = default;
@@ -348,6 +316,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_11_matcher() = default;
@@ -356,7 +326,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_11_matcher> regex_11 {}; public: class regex_12_matcher {
+  public: cpp2::regex::regular_expression<char,regex_11_matcher> regex_11 {}; public: using regex_12_matcher = regex_11_matcher;
+public: cpp2::regex::regular_expression<char,regex_12_matcher> regex_12 {}; public: class regex_13_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,2>;
 public: class func_0 {
@@ -374,31 +345,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_12_matcher() = default;
-        public: regex_12_matcher(regex_12_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_12_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_12_matcher> regex_12 {}; public: class regex_13_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,2>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -408,7 +355,8 @@ public: class func_0 {
 
   };
 
-  public: cpp2::regex::regular_expression<char,regex_13_matcher> regex_13 {}; public: class regex_14_matcher {
+  public: cpp2::regex::regular_expression<char,regex_13_matcher> regex_13 {}; public: using regex_14_matcher = regex_13_matcher;
+public: cpp2::regex::regular_expression<char,regex_14_matcher> regex_14 {}; public: class regex_15_matcher {
   public: template<typename Iter, typename CharT> class wrap {
   public: using context = cpp2::regex::match_context<CharT,Iter,2>;
 public: class func_0 {
@@ -426,31 +374,7 @@ public: class func_0 {
 
   };
 
-  public: [[nodiscard]] static auto to_string() -> std::string;
-
-        public: regex_14_matcher() = default;
-        public: regex_14_matcher(regex_14_matcher const&) = delete; /* No 'that' constructor, suppress copy */
-        public: auto operator=(regex_14_matcher const&) -> void = delete;
-
-  };
-
-  public: cpp2::regex::regular_expression<char,regex_14_matcher> regex_14 {}; public: class regex_15_matcher {
-  public: template<typename Iter, typename CharT> class wrap {
-  public: using context = cpp2::regex::match_context<CharT,Iter,2>;
-public: class func_0 {
-  public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
-
-  };
-
-  public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
-
-  public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
-
-  public: wrap() = default;
-  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
-  public: auto operator=(wrap const&) -> void = delete;
-
-  };
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
 
   public: [[nodiscard]] static auto to_string() -> std::string;
 
@@ -478,6 +402,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_16_matcher() = default;
@@ -504,6 +430,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_17_matcher() = default;
@@ -530,6 +458,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_18_matcher() = default;
@@ -556,6 +486,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_19_matcher() = default;
@@ -582,6 +514,8 @@ public: class func_0 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_20_matcher() = default;
@@ -628,6 +562,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_21_matcher() = default;
@@ -674,6 +610,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_22_matcher() = default;
@@ -720,6 +658,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_23_matcher() = default;
@@ -766,6 +706,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_24_matcher() = default;
@@ -788,7 +730,6 @@ auto main() -> int;
 
 #line 1 "pure2-regex_11_group_references.cpp2"
 [[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
-#line 2 "pure2-regex_11_group_references.cpp2"
   std::string result {""}; 
 
   auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
@@ -899,7 +840,6 @@ auto main() -> int;
   return result; 
 }
 
-#line 112 "pure2-regex_11_group_references.cpp2"
 [[nodiscard]] auto sanitize(std::string str) -> std::string
 {
   str = cpp2::string_util::replace_all(str, "\a", "\\a");
@@ -912,7 +852,6 @@ auto main() -> int;
   return cpp2::move(str); 
 }
 
-#line 124 "pure2-regex_11_group_references.cpp2"
 template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
            cpp2::impl::in<std::string> resultExpected) -> void{
 
@@ -950,7 +889,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   if (!(CPP2_UFCS(empty)(warning))) {
     warning += " ";
   }
-  std::cout << "" + cpp2::to_string(id) + "_" + cpp2::to_string(kind) + ": " + cpp2::to_string(cpp2::move(status)) + " " + cpp2::to_string(cpp2::move(warning)) + "regex: " + cpp2::to_string(regex_str) + " parsed_regex: " + cpp2::to_string(CPP2_UFCS(to_string)(regex)) + " str: " + cpp2::to_string(sanitize(str)) + " result_expr: " + cpp2::to_string(resultExpr) + " expected_results " + cpp2::to_string(sanitize(resultExpected)) + "" << std::endl;
+  std::cout << "" + cpp2::string_build(cpp2::interp(id), "_", cpp2::interp(kind), ": ", cpp2::interp(cpp2::move(status)), " ", cpp2::interp(cpp2::move(warning)), "regex: ", cpp2::interp(regex_str), " parsed_regex: ", cpp2::interp(CPP2_UFCS(to_string)(regex)), " str: ", cpp2::interp(sanitize(str)), " result_expr: ", cpp2::interp(resultExpr), " expected_results ", cpp2::interp(sanitize(resultExpected))) + "" << std::endl;
 }
 
 #line 190 "pure2-regex_11_group_references.cpp2"
@@ -1058,6 +997,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_01_matcher::to_string() -> std::string{return R"((foo)(\g-2))"; }
 
 
@@ -1177,6 +1117,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_02_matcher::to_string() -> std::string{return R"((foo)(\g-2)(foo)(\g-2))"; }
 
 
@@ -1370,6 +1311,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_03_matcher::to_string() -> std::string{return R"((([abc]+) \g-1)(([abc]+) \g{-1}))"; }
 
 
@@ -1491,6 +1433,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_04_matcher::to_string() -> std::string{return R"((a)(b)(c)\g1\g2\g3)"; }
 
 
@@ -1569,6 +1512,7 @@ int i{0};
   if (name == "n") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_05_matcher::to_string() -> std::string{return R"(/(?'n'foo) \g{n}/)"; }
 
 
@@ -1647,85 +1591,10 @@ int i{0};
   if (name == "n") {return 1; }else {return -1; }
   }
 
-  [[nodiscard]] auto test_tests_11_group_references::regex_06_matcher::to_string() -> std::string{return R"(/(?'n'foo) \g{ n }/)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_07_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  ctx.set_group_start(1, r.pos);
-
-  std::array<char,3 + 1> str_tmp_0 {"foo"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  ctx.set_group_end(1, r.pos);
-
-  auto tmp_1_func {
-[&, _1 = (&r), _2 = (&ctx)]() mutable -> void{
-  if (!((*cpp2::impl::assert_not_null(_1)).matched)) {
-  (*cpp2::impl::assert_not_null(_2)).set_group_invalid(1);
-  }
-  }
-  }; 
-
-  auto tmp_1 {cpp2::regex::make_on_return(cpp2::move(tmp_1_func))}; 
-  static_cast<void>(cpp2::move(tmp_1));
 
-  std::array<char,1 + 1> str_tmp_2 {" "}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::group_ref_token_matcher<char,1,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_11_group_references::regex_06_matcher::to_string() -> std::string{return R"(/(?'n'foo) \g{ n }/)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_07_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_07_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  if (name == "n") {return 1; }else {return -1; }
-  }
-
-  [[nodiscard]] auto test_tests_11_group_references::regex_07_matcher::to_string() -> std::string{return R"(/(?'n'foo) \g{n}/)"; }
 
 
 
@@ -1803,85 +1672,10 @@ int i{0};
   if (name == "n") {return 1; }else {return -1; }
   }
 
-  [[nodiscard]] auto test_tests_11_group_references::regex_08_matcher::to_string() -> std::string{return R"(/(?<n>foo) \g{n}/)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_09_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  ctx.set_group_start(1, r.pos);
-
-  std::array<char,3 + 1> str_tmp_0 {"foo"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  ctx.set_group_end(1, r.pos);
-
-  auto tmp_1_func {
-[&, _1 = (&r), _2 = (&ctx)]() mutable -> void{
-  if (!((*cpp2::impl::assert_not_null(_1)).matched)) {
-  (*cpp2::impl::assert_not_null(_2)).set_group_invalid(1);
-  }
-  }
-  }; 
-
-  auto tmp_1 {cpp2::regex::make_on_return(cpp2::move(tmp_1_func))}; 
-  static_cast<void>(cpp2::move(tmp_1));
-
-  std::array<char,1 + 1> str_tmp_2 {" "}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::group_ref_token_matcher<char,1,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_09_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_11_group_references::regex_08_matcher::to_string() -> std::string{return R"(/(?<n>foo) \g{n}/)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_09_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  if (name == "n") {return 1; }else {return -1; }
-  }
 
-  [[nodiscard]] auto test_tests_11_group_references::regex_09_matcher::to_string() -> std::string{return R"(/(?<n>foo) \g{n}/)"; }
 
 
 
@@ -2087,6 +1881,7 @@ int i{0};
   if (name == "as") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_10_matcher::to_string() -> std::string{return R"(/(?<as>as) (\w+) \g{as} (\w+)/)"; }
 
 
@@ -2165,85 +1960,10 @@ int i{0};
   if (name == "n") {return 1; }else {return -1; }
   }
 
-  [[nodiscard]] auto test_tests_11_group_references::regex_11_matcher::to_string() -> std::string{return R"(/(?'n'foo) \k<n>/)"; }
-
-
-
-
-
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_12_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  ctx.set_group_start(1, r.pos);
-
-  std::array<char,3 + 1> str_tmp_0 {"foo"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  ctx.set_group_end(1, r.pos);
-
-  auto tmp_1_func {
-[&, _1 = (&r), _2 = (&ctx)]() mutable -> void{
-  if (!((*cpp2::impl::assert_not_null(_1)).matched)) {
-  (*cpp2::impl::assert_not_null(_2)).set_group_invalid(1);
-  }
-  }
-  }; 
-
-  auto tmp_1 {cpp2::regex::make_on_return(cpp2::move(tmp_1_func))}; 
-  static_cast<void>(cpp2::move(tmp_1));
-
-  std::array<char,1 + 1> str_tmp_2 {" "}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::group_ref_token_matcher<char,1,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_12_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_11_group_references::regex_11_matcher::to_string() -> std::string{return R"(/(?'n'foo) \k<n>/)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_12_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  if (name == "n") {return 1; }else {return -1; }
-  }
 
-  [[nodiscard]] auto test_tests_11_group_references::regex_12_matcher::to_string() -> std::string{return R"(/(?'n'foo) \k<n>/)"; }
 
 
 
@@ -2321,85 +2041,10 @@ int i{0};
   if (name == "n") {return 1; }else {return -1; }
   }
 
-  [[nodiscard]] auto test_tests_11_group_references::regex_13_matcher::to_string() -> std::string{return R"(/(?<n>foo) \k'n'/)"; }
-
-
-
-
-
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_14_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
-
-  auto r {ctx.pass(cur)}; 
-  do {
-  ctx.set_group_start(1, r.pos);
-
-  std::array<char,3 + 1> str_tmp_0 {"foo"}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),3)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,3); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 3;}
-  else {break;}
-  ctx.set_group_end(1, r.pos);
-
-  auto tmp_1_func {
-[&, _1 = (&r), _2 = (&ctx)]() mutable -> void{
-  if (!((*cpp2::impl::assert_not_null(_1)).matched)) {
-  (*cpp2::impl::assert_not_null(_2)).set_group_invalid(1);
-  }
-  }
-  }; 
-
-  auto tmp_1 {cpp2::regex::make_on_return(cpp2::move(tmp_1_func))}; 
-  static_cast<void>(cpp2::move(tmp_1));
-
-  std::array<char,1 + 1> str_tmp_2 {" "}; 
-  if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
-  r.matched = false;
-  break;
-  }
-{
-int i{0};
-  for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
-  if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
-  }
-}
-  if (r.matched) {r.pos += 1;}
-  else {break;}
-  if (!(cpp2::regex::group_ref_token_matcher<char,1,false>(r.pos, ctx))) {r.matched = false;break;}
-  }
-   while ( 
-  false
-  );
-  if (r.matched) {
-  r = other(r.pos, ctx);
-  }
-  else {
-  r.pos = ctx.end;
-  }
-  return r; 
-  }
+  [[nodiscard]] auto test_tests_11_group_references::regex_13_matcher::to_string() -> std::string{return R"(/(?<n>foo) \k'n'/)"; }
 
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_14_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
-  ctx.set_group_start(0, cur);
 
-  auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
-  if (r.matched) {ctx.set_group_end(0, r.pos);}
-  return r; 
-  }
-
-  template <typename Iter, typename CharT> [[nodiscard]] auto test_tests_11_group_references::regex_14_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
-  if (name == "n") {return 1; }else {return -1; }
-  }
-
-  [[nodiscard]] auto test_tests_11_group_references::regex_14_matcher::to_string() -> std::string{return R"(/(?<n>foo) \k'n'/)"; }
 
 
 
@@ -2477,6 +2122,7 @@ int i{0};
   if (name == "a1") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_15_matcher::to_string() -> std::string{return R"(/(?'a1'foo) \k'a1'/)"; }
 
 
@@ -2555,6 +2201,7 @@ int i{0};
   if (name == "a1") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_16_matcher::to_string() -> std::string{return R"(/(?<a1>foo) \k<a1>/)"; }
 
 
@@ -2633,6 +2280,7 @@ int i{0};
   if (name == "_") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_17_matcher::to_string() -> std::string{return R"(/(?'_'foo) \k'_'/)"; }
 
 
@@ -2711,6 +2359,7 @@ int i{0};
   if (name == "_") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_18_matcher::to_string() -> std::string{return R"(/(?<_>foo) \k<_>/)"; }
 
 
@@ -2789,6 +2438,7 @@ int i{0};
   if (name == "_0_") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_19_matcher::to_string() -> std::string{return R"(/(?'_0_'foo) \k'_0_'/)"; }
 
 
@@ -2867,6 +2517,7 @@ int i{0};
   if (name == "_0_") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_20_matcher::to_string() -> std::string{return R"(/(?<_0_>foo) \k<_0_>/)"; }
 
 
@@ -3073,6 +2724,7 @@ int i{0};
   if (name == "as") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_21_matcher::to_string() -> std::string{return R"(/(?<as>as) (\w+) \k<as> (\w+)/)"; }
 
 
@@ -3279,6 +2931,7 @@ int i{0};
   if (name == "as") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_22_matcher::to_string() -> std::string{return R"(/(?<as>as) (\w+) \k{as} (\w+)/)"; }
 
 
@@ -3485,6 +3138,7 @@ int i{0};
   if (name == "as") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_23_matcher::to_string() -> std::string{return R"(/(?<as>as) (\w+) \k'as' (\w+)/)"; }
 
 
@@ -3691,6 +3345,7 @@ int i{0};
   if (name == "as") {return 1; }else {return -1; }
   }
 
+
   [[nodiscard]] auto test_tests_11_group_references::regex_24_matcher::to_string() -> std::string{return R"(/(?<as>as) (\w+) \k{ as } (\w+)/)"; }
 
 
@@ -5,7 +5,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-regex_13_possessive_modifier.cpp2"
 
@@ -58,6 +60,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_01_matcher() = default;
@@ -94,6 +98,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_02_matcher() = default;
@@ -130,6 +136,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_03_matcher() = default;
@@ -166,6 +174,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_04_matcher() = default;
@@ -202,6 +212,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_05_matcher() = default;
@@ -238,6 +250,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_06_matcher() = default;
@@ -274,6 +288,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_07_matcher() = default;
@@ -310,6 +326,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_08_matcher() = default;
@@ -346,6 +364,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_09_matcher() = default;
@@ -382,6 +402,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_10_matcher() = default;
@@ -418,6 +440,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_11_matcher() = default;
@@ -454,6 +478,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_12_matcher() = default;
@@ -490,6 +516,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157\141",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_13_matcher() = default;
@@ -526,6 +554,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_14_matcher() = default;
@@ -562,6 +592,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_15_matcher() = default;
@@ -598,6 +630,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_16_matcher() = default;
@@ -639,6 +673,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_17_matcher() = default;
@@ -710,6 +746,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_18_matcher() = default;
@@ -751,6 +789,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_19_matcher() = default;
@@ -822,6 +862,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_20_matcher() = default;
@@ -863,6 +905,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_21_matcher() = default;
@@ -934,6 +978,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_22_matcher() = default;
@@ -975,6 +1021,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_23_matcher() = default;
@@ -1046,6 +1094,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_24_matcher() = default;
@@ -1087,6 +1137,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_25_matcher() = default;
@@ -1143,6 +1195,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_26_matcher() = default;
@@ -1184,6 +1238,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_27_matcher() = default;
@@ -1240,6 +1296,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_28_matcher() = default;
@@ -1281,6 +1339,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_29_matcher() = default;
@@ -1337,6 +1397,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_30_matcher() = default;
@@ -1378,6 +1440,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_31_matcher() = default;
@@ -1434,6 +1498,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_32_matcher() = default;
@@ -1475,6 +1541,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_33_matcher() = default;
@@ -1546,6 +1614,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_34_matcher() = default;
@@ -1587,6 +1657,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_35_matcher() = default;
@@ -1658,6 +1730,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_36_matcher() = default;
@@ -1699,6 +1773,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_37_matcher() = default;
@@ -1770,6 +1846,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_38_matcher() = default;
@@ -1811,6 +1889,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_39_matcher() = default;
@@ -1882,6 +1962,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_40_matcher() = default;
@@ -1923,6 +2005,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_41_matcher() = default;
@@ -1979,6 +2063,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_42_matcher() = default;
@@ -2020,6 +2106,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_43_matcher() = default;
@@ -2076,6 +2164,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_44_matcher() = default;
@@ -2117,6 +2207,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_45_matcher() = default;
@@ -2173,6 +2265,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_46_matcher() = default;
@@ -2214,6 +2308,8 @@ public: class func_1 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_47_matcher() = default;
@@ -2270,6 +2366,8 @@ public: class func_2 {
 
   };
 
+  public: using prefilter = cpp2::regex::prefilter<"\146\157\157",false>;
+
   public: [[nodiscard]] static auto to_string() -> std::string;
 
         public: regex_48_matcher() = default;
@@ -2292,7 +2390,6 @@ auto main() -> int;
 
 #line 1 "pure2-regex_13_possessive_modifier.cpp2"
 [[nodiscard]] auto create_result(cpp2::impl::in<std::string> resultExpr, auto const& r) -> std::string{
-#line 2 "pure2-regex_13_possessive_modifier.cpp2"
   std::string result {""}; 
 
   auto get_next {[_0 = (&resultExpr)](auto const& iter) mutable -> auto{
@@ -2403,7 +2500,6 @@ auto main() -> int;
   return result; 
 }
 
-#line 112 "pure2-regex_13_possessive_modifier.cpp2"
 [[nodiscard]] auto sanitize(std::string str) -> std::string
 {
   str = cpp2::string_util::replace_all(str, "\a", "\\a");
@@ -2416,7 +2512,6 @@ auto main() -> int;
   return cpp2::move(str); 
 }
 
-#line 124 "pure2-regex_13_possessive_modifier.cpp2"
 template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, cpp2::impl::in<std::string> regex_str, cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> kind, cpp2::impl::in<std::string> resultExpr, 
            cpp2::impl::in<std::string> resultExpected) -> void{
 
@@ -2454,7 +2549,7 @@ template<typename M> auto test(M const& regex, cpp2::impl::in<std::string> id, c
   if (!(CPP2_UFCS(empty)(warning))) {
     warning += " ";
   }
-  std::cout << "" + cpp2::to_string(id) + "_" + cpp2::to_string(kind) + ": " + cpp2::to_string(cpp2::move(status)) + " " + cpp2::to_string(cpp2::move(warning)) + "regex: " + cpp2::to_string(regex_str) + " parsed_regex: " + cpp2::to_string(CPP2_UFCS(to_string)(regex)) + " str: " + cpp2::to_string(sanitize(str)) + " result_expr: " + cpp2::to_string(resultExpr) + " expected_results " + cpp2::to_string(sanitize(resultExpected)) + "" << std::endl;
+  std::cout << "" + cpp2::string_build(cpp2::interp(id), "_", cpp2::interp(kind), ": ", cpp2::interp(cpp2::move(status)), " ", cpp2::interp(cpp2::move(warning)), "regex: ", cpp2::interp(regex_str), " parsed_regex: ", cpp2::interp(CPP2_UFCS(to_string)(regex)), " str: ", cpp2::interp(sanitize(str)), " result_expr: ", cpp2::interp(resultExpr), " expected_results ", cpp2::interp(sanitize(resultExpected))) + "" << std::endl;
 }
 
 #line 214 "pure2-regex_13_possessive_modifier.cpp2"
@@ -2609,6 +2704,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_01_matcher::to_string() -> std::string{return R"(a++a)"; }
 
 
@@ -2710,6 +2806,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_02_matcher::to_string() -> std::string{return R"(a*+a)"; }
 
 
@@ -2811,6 +2908,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_03_matcher::to_string() -> std::string{return R"(a{1,5}+a)"; }
 
 
@@ -2912,6 +3010,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_04_matcher::to_string() -> std::string{return R"(a?+a)"; }
 
 
@@ -3013,6 +3112,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_05_matcher::to_string() -> std::string{return R"(a++b)"; }
 
 
@@ -3114,6 +3214,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_06_matcher::to_string() -> std::string{return R"(a*+b)"; }
 
 
@@ -3215,6 +3316,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_07_matcher::to_string() -> std::string{return R"(a{1,5}+b)"; }
 
 
@@ -3316,6 +3418,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_08_matcher::to_string() -> std::string{return R"(a?+b)"; }
 
 
@@ -3431,6 +3534,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_09_matcher::to_string() -> std::string{return R"(fooa++a)"; }
 
 
@@ -3546,6 +3650,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_10_matcher::to_string() -> std::string{return R"(fooa*+a)"; }
 
 
@@ -3661,6 +3766,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_11_matcher::to_string() -> std::string{return R"(fooa{1,5}+a)"; }
 
 
@@ -3776,6 +3882,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_12_matcher::to_string() -> std::string{return R"(fooa?+a)"; }
 
 
@@ -3891,6 +3998,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_13_matcher::to_string() -> std::string{return R"(fooa++b)"; }
 
 
@@ -4006,6 +4114,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_14_matcher::to_string() -> std::string{return R"(fooa*+b)"; }
 
 
@@ -4121,6 +4230,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_15_matcher::to_string() -> std::string{return R"(fooa{1,5}+b)"; }
 
 
@@ -4236,6 +4346,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_16_matcher::to_string() -> std::string{return R"(fooa?+b)"; }
 
 
@@ -4368,6 +4479,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_17_matcher::to_string() -> std::string{return R"((aA)++(aA))"; }
 
 
@@ -4636,6 +4748,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_18_matcher::to_string() -> std::string{return R"((aA|bB)++(aA|bB))"; }
 
 
@@ -4768,6 +4881,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_19_matcher::to_string() -> std::string{return R"((aA)*+(aA))"; }
 
 
@@ -5036,6 +5150,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_20_matcher::to_string() -> std::string{return R"((aA|bB)*+(aA|bB))"; }
 
 
@@ -5168,6 +5283,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_21_matcher::to_string() -> std::string{return R"((aA){1,5}+(aA))"; }
 
 
@@ -5436,6 +5552,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_22_matcher::to_string() -> std::string{return R"((aA|bB){1,5}+(aA|bB))"; }
 
 
@@ -5568,6 +5685,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_23_matcher::to_string() -> std::string{return R"((aA)?+(aA))"; }
 
 
@@ -5836,6 +5954,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_24_matcher::to_string() -> std::string{return R"((aA|bB)?+(aA|bB))"; }
 
 
@@ -5955,6 +6074,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_25_matcher::to_string() -> std::string{return R"((aA)++b)"; }
 
 
@@ -6142,6 +6262,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_26_matcher::to_string() -> std::string{return R"((aA|bB)++b)"; }
 
 
@@ -6261,6 +6382,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_27_matcher::to_string() -> std::string{return R"((aA)*+b)"; }
 
 
@@ -6448,6 +6570,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_28_matcher::to_string() -> std::string{return R"((aA|bB)*+b)"; }
 
 
@@ -6567,6 +6690,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_29_matcher::to_string() -> std::string{return R"((aA){1,5}+b)"; }
 
 
@@ -6754,6 +6878,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_30_matcher::to_string() -> std::string{return R"((aA|bB){1,5}+b)"; }
 
 
@@ -6873,6 +6998,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_31_matcher::to_string() -> std::string{return R"((aA)?+b)"; }
 
 
@@ -7060,6 +7186,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_32_matcher::to_string() -> std::string{return R"((aA|bB)?+b)"; }
 
 
@@ -7206,6 +7333,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_33_matcher::to_string() -> std::string{return R"(foo(aA)++(aA))"; }
 
 
@@ -7488,6 +7616,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_34_matcher::to_string() -> std::string{return R"(foo(aA|bB)++(aA|bB))"; }
 
 
@@ -7634,6 +7763,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_35_matcher::to_string() -> std::string{return R"(foo(aA)*+(aA))"; }
 
 
@@ -7916,6 +8046,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_36_matcher::to_string() -> std::string{return R"(foo(aA|bB)*+(aA|bB))"; }
 
 
@@ -8062,6 +8193,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_37_matcher::to_string() -> std::string{return R"(foo(aA){1,5}+(aA))"; }
 
 
@@ -8344,6 +8476,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_38_matcher::to_string() -> std::string{return R"(foo(aA|bB){1,5}+(aA|bB))"; }
 
 
@@ -8490,6 +8623,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_39_matcher::to_string() -> std::string{return R"(foo(aA)?+(aA))"; }
 
 
@@ -8772,6 +8906,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_40_matcher::to_string() -> std::string{return R"(foo(aA|bB)?+(aA|bB))"; }
 
 
@@ -8905,6 +9040,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_41_matcher::to_string() -> std::string{return R"(foo(aA)++b)"; }
 
 
@@ -9106,6 +9242,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_42_matcher::to_string() -> std::string{return R"(foo(aA|bB)++b)"; }
 
 
@@ -9239,6 +9376,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_43_matcher::to_string() -> std::string{return R"(foo(aA)*+b)"; }
 
 
@@ -9440,6 +9578,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_44_matcher::to_string() -> std::string{return R"(foo(aA|bB)*+b)"; }
 
 
@@ -9573,6 +9712,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_45_matcher::to_string() -> std::string{return R"(foo(aA){1,5}+b)"; }
 
 
@@ -9774,6 +9914,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_46_matcher::to_string() -> std::string{return R"(foo(aA|bB){1,5}+b)"; }
 
 
@@ -9907,6 +10048,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_47_matcher::to_string() -> std::string{return R"(foo(aA)?+b)"; }
 
 
@@ -10108,6 +10250,7 @@ int i{0};
   return -1; 
   }
 
+
   [[nodiscard]] auto test_tests_13_possessive_modifier::regex_48_matcher::to_string() -> std::string{return R"(foo(aA|bB)?+b)"; }
 
 
@@ -0,0 +1,69 @@
+
+#define CPP2_IMPORT_STD          Yes
+#include "cpp2regex.h"
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-regex_20_dfa_mode.cpp2"
+class lexer;
+    
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-regex_20_dfa_mode.cpp2"
+class lexer {
+public: using regex_any_matcher = cpp2::regex::dfa_table_matcher<4,4,"\141\056\143","\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000","\000\000\000\000\002\000\000\000\003\000\000\000\003\000\003\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000","\060\060\060\061",false,false>;
+public: using regex_any_stream = regex_any_matcher::stream_match;
+public: cpp2::regex::regular_expression<char,regex_any_matcher> regex_any {}; public: using regex_dup_matcher = cpp2::regex::dfa_table_matcher<4,3,"\133\060\055\071\135\053\050\077\072\134\056\133\060\055\071\135\053\051\077","\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\002\002\002\002\002\002\002\002\002\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000","\000\000\000\000\002\000\000\000\003\000\002\000\000\000\000\000\004\000\000\000\000\000\004\000","\060\061\060\061",false,false>;
+public: using regex_dup_stream = regex_dup_matcher::stream_match;
+public: cpp2::regex::regular_expression<char,regex_dup_matcher> regex_dup {}; public: using regex_ident_matcher = cpp2::regex::dfa_table_matcher<2,3,"\133\101\055\132\141\055\172\137\135\133\101\055\132\141\055\172\060\055\071\137\135\052","\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\001\001\001\001\001\001\001\001\001\000\000\000\000\000\000\000\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\000\000\000\000\002\000\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000","\000\000\000\000\002\000\000\000\002\000\002\000","\060\061",false,false>;
+public: using regex_ident_stream = regex_ident_matcher::stream_match;
+public: cpp2::regex::regular_expression<char,regex_ident_matcher> regex_ident {}; public: using regex_kw_matcher = cpp2::regex::dfa_table_matcher<10,8,"\136\050\077\072\151\146\174\145\154\163\145\174\167\150\151\154\145\051\044","\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\002\000\003\004\000\000\005\000\000\000\000\000\000\006\000\000\000\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000","\000\000\002\000\000\000\000\000\003\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\005\000\000\000\000\000\000\000\000\000\006\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\011\000\000\000\000\000\000\000\000\000\006\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\012\000\000\000\000\000\000\000\006\000\000\000\000\000\000\000\000\000\000\000\000\000","\060\060\060\060\060\061\060\060\060\060",true,true>;
+public: using regex_kw_stream = regex_kw_matcher::stream_match;
+public: cpp2::regex::regular_expression<char,regex_kw_matcher> regex_kw {}; public: using regex_num_matcher = regex_dup_matcher;
+public: cpp2::regex::regular_expression<char,regex_num_matcher> regex_num {}; public: using regex_num_stream = regex_num_matcher::stream_match;
+public: using regex_ws_matcher = cpp2::regex::dfa_table_matcher<2,2,"\134\163\053","\000\000\000\000\000\000\000\000\000\001\001\001\001\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000","\000\000\002\000\000\000\002\000","\060\061",false,false>;
+public: using regex_ws_stream = regex_ws_matcher::stream_match;
+public: cpp2::regex::regular_expression<char,regex_ws_matcher> regex_ws {}; 
+    public: lexer() = default;
+    public: lexer(lexer const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(lexer const&) -> void = delete;
+
+
+#line 8 "pure2-regex_20_dfa_mode.cpp2"
+};
+
+auto check(cpp2::impl::in<std::string> label, auto const& value) -> void;
+
+#line 14 "pure2-regex_20_dfa_mode.cpp2"
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-regex_20_dfa_mode.cpp2"
+
+#line 1 "pure2-regex_20_dfa_mode.cpp2"
+
+#line 10 "pure2-regex_20_dfa_mode.cpp2"
+auto check(cpp2::impl::in<std::string> label, auto const& value) -> void{
+    std::cout << label << ": " + cpp2::to_string(value) + "" << "\n";
+}
+
+auto main() -> int{
+    auto l {lexer()}; 
+    check("ident     ", CPP2_UFCS(group)(CPP2_UFCS(search)(l.regex_ident, "  foo_bar9+1"), 0));
+    check("number    ", CPP2_UFCS(group)(CPP2_UFCS(search)(l.regex_num, "x=31.25;"), 0));
+    check("kw y      ", CPP2_UFCS(match)(l.regex_kw, "while").matched);
+    check("kw trail n", CPP2_UFCS(match)(l.regex_kw, "whilex").matched);
+    check("kw lead n ", CPP2_UFCS(search)(l.regex_kw, "xwhile").matched);
+    check("ws len    ", CPP2_UFCS(group)(CPP2_UFCS(search)(l.regex_ws, "ab \t cd"), 0).size());
+    check("wildcard  ", CPP2_UFCS(group)(CPP2_UFCS(search)(l.regex_any, "zaXcz"), 0));
+    check("dup       ", CPP2_UFCS(group)(CPP2_UFCS(search)(l.regex_dup, "v=2.5"), 0));
+    check("to_string ", CPP2_UFCS(to_string)(cpp2::move(l).regex_num));
+}
+
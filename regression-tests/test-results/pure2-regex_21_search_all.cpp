@@ -0,0 +1,378 @@
+
+#define CPP2_IMPORT_STD          Yes
+#include "cpp2regex.h"
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-regex_21_search_all.cpp2"
+class scan;
+
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-regex_21_search_all.cpp2"
+class scan {
+public: class regex_pair_matcher {
+public: template<typename Iter, typename CharT> class wrap {
+public: using context = cpp2::regex::match_context<CharT,Iter,3>;
+public: class func_1 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_0 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_3 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_2 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_4 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+
+public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+
+  public: wrap() = default;
+  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
+  public: auto operator=(wrap const&) -> void = delete;
+
+};
+
+public: using prefilter = cpp2::regex::prefilter<"",false>;
+
+public: [[nodiscard]] static auto to_string() -> std::string;
+
+        public: regex_pair_matcher() = default;
+        public: regex_pair_matcher(regex_pair_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_pair_matcher const&) -> void = delete;
+
+};
+
+public: cpp2::regex::regular_expression<char,regex_pair_matcher> regex_pair {}; public: class regex_stars_matcher {
+public: template<typename Iter, typename CharT> class wrap {
+public: using context = cpp2::regex::match_context<CharT,Iter,1>;
+public: class func_1 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_0 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_2 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+
+public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+
+  public: wrap() = default;
+  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
+  public: auto operator=(wrap const&) -> void = delete;
+
+};
+
+public: using prefilter = cpp2::regex::prefilter<"",false>;
+
+public: [[nodiscard]] static auto to_string() -> std::string;
+
+        public: regex_stars_matcher() = default;
+        public: regex_stars_matcher(regex_stars_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_stars_matcher const&) -> void = delete;
+
+};
+
+public: cpp2::regex::regular_expression<char,regex_stars_matcher> regex_stars {}; 
+    public: scan() = default;
+    public: scan(scan const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(scan const&) -> void = delete;
+
+
+#line 4 "pure2-regex_21_search_all.cpp2"
+};
+
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_pair_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+if (!(cpp2::regex::named_class_word<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = other(r.pos, ctx);
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_pair_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+ctx.set_group_start(1, r.pos);
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_pair_matcher::wrap<Iter,CharT>::func_3::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+if (!(cpp2::regex::named_class_digits<char,false>::match(r.pos, ctx))) {r.matched = false;break;}
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = other(r.pos, ctx);
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_pair_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+ctx.set_group_end(1, r.pos);
+
+auto tmp_0_func {
+[&, _1 = (&r), _2 = (&ctx)]() mutable -> void{
+if (!((*cpp2::impl::assert_not_null(_1)).matched)) {
+(*cpp2::impl::assert_not_null(_2)).set_group_invalid(1);
+}
+}
+}; 
+
+auto tmp_0 {cpp2::regex::make_on_return(cpp2::move(tmp_0_func))}; 
+static_cast<void>(cpp2::move(tmp_0));
+
+std::array<char,1 + 1> str_tmp_1 {"="}; 
+if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
+r.matched = false;
+break;
+}
+{
+int i{0};
+for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
+if (CPP2_ASSERT_IN_BOUNDS(str_tmp_1, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
+}
+}
+if (r.matched) {r.pos += 1;}
+else {break;}
+ctx.set_group_start(2, r.pos);
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_3(), cpp2::regex::no_reset(), other, func_4());
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_pair_matcher::wrap<Iter,CharT>::func_4::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+ctx.set_group_end(2, r.pos);
+
+auto tmp_2_func {
+[&, _1 = (&r), _2 = (&ctx)]() mutable -> void{
+if (!((*cpp2::impl::assert_not_null(_1)).matched)) {
+(*cpp2::impl::assert_not_null(_2)).set_group_invalid(2);
+}
+}
+}; 
+
+auto tmp_2 {cpp2::regex::make_on_return(cpp2::move(tmp_2_func))}; 
+static_cast<void>(cpp2::move(tmp_2));
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = other(r.pos, ctx);
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_pair_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+ctx.set_group_start(0, cur);
+
+auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
+if (r.matched) {ctx.set_group_end(0, r.pos);}
+return r; 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_pair_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+if (name == "key") {return 1; }else {return -1; }
+}
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+[[nodiscard]] auto scan::regex_pair_matcher::to_string() -> std::string{return R"((?<key>\w+)=(\d+))"; }
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_stars_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+
+std::array<char,1 + 1> str_tmp_0 {"x"}; 
+if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
+r.matched = false;
+break;
+}
+{
+int i{0};
+for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
+if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
+}
+}
+if (r.matched) {r.pos += 1;}
+else {break;}
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = other(r.pos, ctx);
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_stars_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = cpp2::regex::range_token_matcher<char,0,-1,2>::match(r.pos, ctx, func_1(), cpp2::regex::no_reset(), other, func_2());
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_stars_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = other(r.pos, ctx);
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_stars_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+ctx.set_group_start(0, cur);
+
+auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
+if (r.matched) {ctx.set_group_end(0, r.pos);}
+return r; 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto scan::regex_stars_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+static_cast<void>(name);
+return -1; 
+}
+#line 1 "pure2-regex_21_search_all.cpp2"
+
+[[nodiscard]] auto scan::regex_stars_matcher::to_string() -> std::string{return R"(x*)"; }
+
+#line 6 "pure2-regex_21_search_all.cpp2"
+auto main() -> int{
+    auto s {scan()}; 
+
+    //  Iterate all matches, reading captures as zero-copy views.
+    auto it {CPP2_UFCS(search_all)(s.regex_pair, "a=1, bb=22, ccc=333")}; 
+    while( it.next() ) {
+        std::cout << it.group_view("key") << " -> " << it.group_view(2) << " [" << it.group_view(0) << "]\n";
+    }
+    auto exhausted {it.next()}; 
+    std::cout << "exhausted: " + cpp2::to_string(cpp2::move(exhausted)) + "\n";
+    static_cast<void>(cpp2::move(it));
+
+    //  Empty matches advance by one position and terminate at the end.
+    auto e {CPP2_UFCS(search_all)(s.regex_stars, "axxb")}; 
+    auto count {0}; 
+    while( e.next() ) {
+        ++count;
+    }
+    std::cout << "stars steps: " + cpp2::to_string(cpp2::move(count)) + "\n";
+
+    //  The single-shot API exposes the same zero-copy accessors.
+    auto r {CPP2_UFCS(search)(cpp2::move(s).regex_pair, "k=42")}; 
+    std::cout << "search view: " << r.group_view("key") << "/" << r.group_view(2) << "\n";
+}
+
@@ -0,0 +1,262 @@
+
+#define CPP2_IMPORT_STD          Yes
+#include "cpp2regex.h"
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-regex_22_step_limit.cpp2"
+class bombs;
+    
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-regex_22_step_limit.cpp2"
+class bombs {
+public: class regex_nested_matcher {
+public: template<typename Iter, typename CharT> class wrap {
+public: using context = cpp2::regex::match_context<CharT,Iter,2>;
+public: class func_2 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_1 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_3 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class reset_0 {
+public: auto operator()(auto& ctx) const& -> void;
+
+};
+
+public: class func_0 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: class func_4 {
+public: [[nodiscard]] auto operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>;
+
+};
+
+public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+
+public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+
+  public: wrap() = default;
+  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
+  public: auto operator=(wrap const&) -> void = delete;
+
+};
+
+public: using prefilter = cpp2::regex::prefilter<"",false>;
+
+public: [[nodiscard]] static auto to_string() -> std::string;
+
+        public: regex_nested_matcher() = default;
+        public: regex_nested_matcher(regex_nested_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_nested_matcher const&) -> void = delete;
+
+};
+
+public: cpp2::regex::regular_expression<char,regex_nested_matcher> regex_nested {}; 
+    public: bombs() = default;
+    public: bombs(bombs const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(bombs const&) -> void = delete;
+
+
+#line 3 "pure2-regex_22_step_limit.cpp2"
+};
+
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-regex_22_step_limit.cpp2"
+
+#line 1 "pure2-regex_22_step_limit.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto bombs::regex_nested_matcher::wrap<Iter,CharT>::func_2::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+
+std::array<char,1 + 1> str_tmp_0 {"a"}; 
+if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
+r.matched = false;
+break;
+}
+{
+int i{0};
+for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
+if (CPP2_ASSERT_IN_BOUNDS(str_tmp_0, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
+}
+}
+if (r.matched) {r.pos += 1;}
+else {break;}
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = other(r.pos, ctx);
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_22_step_limit.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto bombs::regex_nested_matcher::wrap<Iter,CharT>::func_1::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+ctx.set_group_start(1, r.pos);
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_2(), cpp2::regex::no_reset(), other, func_3());
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_22_step_limit.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto bombs::regex_nested_matcher::wrap<Iter,CharT>::func_3::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+ctx.set_group_end(1, r.pos);
+
+auto tmp_1_func {
+[&, _1 = (&r), _2 = (&ctx)]() mutable -> void{
+if (!((*cpp2::impl::assert_not_null(_1)).matched)) {
+(*cpp2::impl::assert_not_null(_2)).set_group_invalid(1);
+}
+}
+}; 
+
+auto tmp_1 {cpp2::regex::make_on_return(cpp2::move(tmp_1_func))}; 
+static_cast<void>(cpp2::move(tmp_1));
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = other(r.pos, ctx);
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_22_step_limit.cpp2"
+
+template <typename Iter, typename CharT> auto bombs::regex_nested_matcher::wrap<Iter,CharT>::reset_0::operator()(auto& ctx) const& -> void{
+ctx.set_group_invalid(1);
+}
+#line 1 "pure2-regex_22_step_limit.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto bombs::regex_nested_matcher::wrap<Iter,CharT>::func_0::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = cpp2::regex::range_token_matcher<char,1,-1,2>::match(r.pos, ctx, func_1(), reset_0(), other, func_4());
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+#line 1 "pure2-regex_22_step_limit.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto bombs::regex_nested_matcher::wrap<Iter,CharT>::func_4::operator()(cpp2::impl::in<Iter> cur, context& ctx, auto const& other) const& -> cpp2::regex::match_return<Iter>{
+
+auto r {ctx.pass(cur)}; 
+do {
+
+std::array<char,1 + 1> str_tmp_2 {"b"}; 
+if (cpp2::impl::cmp_less(std::distance(r.pos, ctx.end),1)) {
+r.matched = false;
+break;
+}
+{
+int i{0};
+for( ; cpp2::impl::cmp_less(i,1); (i += 1) ) {
+if (CPP2_ASSERT_IN_BOUNDS(str_tmp_2, i) != CPP2_ASSERT_IN_BOUNDS(r.pos, i)) {r.matched = false;}
+}
+}
+if (r.matched) {r.pos += 1;}
+else {break;}
+}
+ while ( 
+false
+);
+if (r.matched) {
+r = other(r.pos, ctx);
+}
+else {
+r.pos = ctx.end;
+}
+return r; 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto bombs::regex_nested_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+ctx.set_group_start(0, cur);
+
+auto r {func_0()(cur, ctx, cpp2::regex::true_end_func())}; 
+if (r.matched) {ctx.set_group_end(0, r.pos);}
+return r; 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto bombs::regex_nested_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+static_cast<void>(name);
+return -1; 
+}
+#line 1 "pure2-regex_22_step_limit.cpp2"
+
+[[nodiscard]] auto bombs::regex_nested_matcher::to_string() -> std::string{return R"((a+)+b)"; }
+
+#line 5 "pure2-regex_22_step_limit.cpp2"
+auto main() -> int{
+    auto b {bombs()}; 
+
+    //  A subject of all a's makes (a+)+b backtrack exponentially in the
+    //  unlimited engine - with a step budget it reports no-match quickly.
+    std::string subject {"aaaaaaaaaaaaaaaaaaaaaaaaaaaa"}; 
+    auto limited {CPP2_UFCS(with_step_limit)(b.regex_nested, 10000 * (cpp2::impl::as_<cpp2::i64>(subject.size())))}; 
+    auto r {CPP2_UFCS(search)(limited, cpp2::move(subject))}; 
+    std::cout << "limited matched: " + cpp2::to_string(cpp2::move(r).matched) + "\n";
+
+    //  A genuine match stays well inside the budget and still succeeds.
+    std::string positive {"aaab"}; 
+    auto hit {CPP2_UFCS(search)(cpp2::move(limited), cpp2::move(positive))}; 
+    std::cout << "positive matched: " + cpp2::to_string(hit.matched) + " [" << hit.group_view(0) << "]\n";
+
+    //  The default remains unlimited and matches as before.
+    std::string small {"aab"}; 
+    auto plain {CPP2_UFCS(search)(cpp2::move(b).regex_nested, cpp2::move(small))}; 
+    std::cout << "default matched: " + cpp2::to_string(cpp2::move(plain).matched) + "\n";
+}
+
@@ -0,0 +1,272 @@
+
+#define CPP2_IMPORT_STD          Yes
+#include "cpp2regex.h"
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-regex_23_onepass_mode.cpp2"
+class validator;
+    
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-regex_23_onepass_mode.cpp2"
+class validator {
+public: class regex_flags_matcher {
+public: template<typename Iter, typename CharT> class wrap {
+public: using context = cpp2::regex::match_context<CharT,Iter,1>;
+
+public: using cls_0 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_1 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_2 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_3 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+
+public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+
+  public: wrap() = default;
+  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
+  public: auto operator=(wrap const&) -> void = delete;
+
+};
+
+public: using prefilter = cpp2::regex::prefilter<"",true>;
+
+public: [[nodiscard]] static auto to_string() -> std::string;
+
+        public: regex_flags_matcher() = default;
+        public: regex_flags_matcher(regex_flags_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_flags_matcher const&) -> void = delete;
+
+};
+
+public: cpp2::regex::regular_expression<char,regex_flags_matcher> regex_flags {}; public: class regex_key_matcher {
+public: template<typename Iter, typename CharT> class wrap {
+public: using context = cpp2::regex::match_context<CharT,Iter,3>;
+
+public: using cls_0 = cpp2::regex::onepass_class<"0000000001111100000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_1 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000001111111111000000011111111111111111111111111000010111111111111111111111111110000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_2 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000000000000000000100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_3 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000001111111111000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_4 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+
+public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+
+  public: wrap() = default;
+  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
+  public: auto operator=(wrap const&) -> void = delete;
+
+};
+
+public: using prefilter = cpp2::regex::prefilter<"",true>;
+
+public: [[nodiscard]] static auto to_string() -> std::string;
+
+        public: regex_key_matcher() = default;
+        public: regex_key_matcher(regex_key_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_key_matcher const&) -> void = delete;
+
+};
+
+public: cpp2::regex::regular_expression<char,regex_key_matcher> regex_key {}; public: class regex_record_matcher {
+public: template<typename Iter, typename CharT> class wrap {
+public: using context = cpp2::regex::match_context<CharT,Iter,4>;
+
+public: using cls_0 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000001111111111000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_1 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: using cls_2 = cpp2::regex::onepass_class<"0000000000000000000000000000000000000000000000000000000000000000011111111111111111111111111000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000">;
+
+public: [[nodiscard]] static auto entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>;
+
+public: [[nodiscard]] static auto get_named_group_index(auto const& name) -> int;
+
+  public: wrap() = default;
+  public: wrap(wrap const&) = delete; /* No 'that' constructor, suppress copy */
+  public: auto operator=(wrap const&) -> void = delete;
+
+};
+
+public: using prefilter = cpp2::regex::prefilter<"",true>;
+
+public: [[nodiscard]] static auto to_string() -> std::string;
+
+        public: regex_record_matcher() = default;
+        public: regex_record_matcher(regex_record_matcher const&) = delete; /* No 'that' constructor, suppress copy */
+        public: auto operator=(regex_record_matcher const&) -> void = delete;
+
+};
+
+public: cpp2::regex::regular_expression<char,regex_record_matcher> regex_record {}; 
+    public: validator() = default;
+    public: validator(validator const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(validator const&) -> void = delete;
+
+
+#line 5 "pure2-regex_23_onepass_mode.cpp2"
+};
+
+auto check(cpp2::impl::in<std::string> label, auto const& value) -> void;
+
+#line 11 "pure2-regex_23_onepass_mode.cpp2"
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-regex_23_onepass_mode.cpp2"
+
+#line 1 "pure2-regex_23_onepass_mode.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto validator::regex_flags_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+if (cur != ctx.begin) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_start(0, cur);
+
+auto pos {cur}; 
+if (pos == ctx.end || !(cls_0::includes(*cpp2::impl::assert_not_null(pos)))) {return cpp2::regex::match_return<Iter>(false, cur); }
+++pos;
+
+auto n_0 {0}; 
+while( pos != ctx.end && cpp2::impl::cmp_less(n_0,1) && cls_1::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;++n_0;}
+if (pos == ctx.end || !(cls_0::includes(*cpp2::impl::assert_not_null(pos)))) {return cpp2::regex::match_return<Iter>(false, cur); }
+++pos;
+while( pos != ctx.end && cls_2::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;}
+
+auto n_1 {0}; 
+while( pos != ctx.end && cpp2::impl::cmp_less(n_1,2) && cls_3::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;++n_1;}
+if (pos != ctx.end) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_end(0, pos);
+return cpp2::regex::match_return<Iter>(true, cpp2::move(pos)); 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto validator::regex_flags_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+static_cast<void>(name);
+return -1; 
+}
+#line 1 "pure2-regex_23_onepass_mode.cpp2"
+
+[[nodiscard]] auto validator::regex_flags_matcher::to_string() -> std::string{return R"(^-v?-x*e{0,2}$)"; }
+#line 1 "pure2-regex_23_onepass_mode.cpp2"
+
+template <typename Iter, typename CharT> [[nodiscard]] auto validator::regex_key_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+if (cur != ctx.begin) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_start(0, cur);
+
+auto pos {cur}; 
+while( pos != ctx.end && cls_0::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;}
+ctx.set_group_start(1, pos);
+
+auto n_0 {0}; 
+while( pos != ctx.end && cls_1::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;++n_0;}
+if (cpp2::impl::cmp_less(cpp2::move(n_0),1)) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_end(1, pos);
+if (pos == ctx.end || !(cls_2::includes(*cpp2::impl::assert_not_null(pos)))) {return cpp2::regex::match_return<Iter>(false, cur); }
+++pos;
+ctx.set_group_start(2, pos);
+
+auto n_1 {0}; 
+while( pos != ctx.end && cls_3::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;++n_1;}
+if (cpp2::impl::cmp_less(cpp2::move(n_1),1)) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_end(2, pos);
+
+auto n_2 {0}; 
+while( pos != ctx.end && cpp2::impl::cmp_less(n_2,1) && cls_4::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;++n_2;}
+if (pos != ctx.end) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_end(0, pos);
+return cpp2::regex::match_return<Iter>(true, cpp2::move(pos)); 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto validator::regex_key_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+if (name == "name") {return 1; }else {if (name == "value") {return 2; }else {return -1; }}
+}
+
+
+[[nodiscard]] auto validator::regex_key_matcher::to_string() -> std::string{return R"(^\s*(?<name>\w+)=(?<value>[0-9]+);?$)"; }
+
+
+
+
+
+
+
+
+template <typename Iter, typename CharT> [[nodiscard]] auto validator::regex_record_matcher::wrap<Iter,CharT>::entry(cpp2::impl::in<Iter> cur, context& ctx) -> cpp2::regex::match_return<Iter>{
+if (cur != ctx.begin) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_start(0, cur);
+
+auto pos {cur}; 
+ctx.set_group_start(1, pos);
+
+auto n_0 {0}; 
+while( pos != ctx.end && cls_0::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;++n_0;}
+if (cpp2::impl::cmp_less(cpp2::move(n_0),1)) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_end(1, pos);
+if (pos == ctx.end || !(cls_1::includes(*cpp2::impl::assert_not_null(pos)))) {return cpp2::regex::match_return<Iter>(false, cur); }
+++pos;
+ctx.set_group_start(2, pos);
+
+auto n_1 {0}; 
+while( pos != ctx.end && cls_0::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;++n_1;}
+if (cpp2::impl::cmp_less(cpp2::move(n_1),1)) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_end(2, pos);
+if (pos == ctx.end || !(cls_1::includes(*cpp2::impl::assert_not_null(pos)))) {return cpp2::regex::match_return<Iter>(false, cur); }
+++pos;
+ctx.set_group_start(3, pos);
+
+auto n_2 {0}; 
+while( pos != ctx.end && cpp2::impl::cmp_less(n_2,3) && cls_2::includes(*cpp2::impl::assert_not_null(pos)) ) {++pos;++n_2;}
+if (cpp2::impl::cmp_less(cpp2::move(n_2),3)) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_end(3, pos);
+if (pos != ctx.end) {return cpp2::regex::match_return<Iter>(false, cur); }
+ctx.set_group_end(0, pos);
+return cpp2::regex::match_return<Iter>(true, cpp2::move(pos)); 
+}
+
+template <typename Iter, typename CharT> [[nodiscard]] auto validator::regex_record_matcher::wrap<Iter,CharT>::get_named_group_index(auto const& name) -> int{
+if (name == "code") {return 3; }else {return -1; }
+}
+
+
+[[nodiscard]] auto validator::regex_record_matcher::to_string() -> std::string{return R"(^(\d+),(\d+),(?<code>[A-Z]{3})$)"; }
+
+
+#line 7 "pure2-regex_23_onepass_mode.cpp2"
+auto check(cpp2::impl::in<std::string> label, auto const& value) -> void{
+    std::cout << label << ": " + cpp2::to_string(value) + "" << "\n";
+}
+
+auto main() -> int{
+    auto v {validator()}; 
+
+    auto rec {CPP2_UFCS(search)(v.regex_record, "12,345,USD")}; 
+    check("record    ", rec.matched);
+    check("fields    ", rec.group(1) + "|" + rec.group(2) + "|" + rec.group("code"));
+    check("lowercase ", CPP2_UFCS(search)(v.regex_record, "12,345,usd").matched);
+    check("unanchored", CPP2_UFCS(search)(v.regex_record, "x12,345,USD").matched);
+    check("short code", CPP2_UFCS(search)(v.regex_record, "12,345,US").matched);
+
+    auto kv {CPP2_UFCS(search)(v.regex_key, "  retries=3;")}; 
+    check("key       ", kv.group("name") + "=" + kv.group("value"));
+    check("bare      ", CPP2_UFCS(search)(v.regex_key, "depth=12").matched);
+
+    check("flags y   ", CPP2_UFCS(match)(v.regex_flags, "-v-xxee").matched);
+    check("flags min ", CPP2_UFCS(match)(v.regex_flags, "--").matched);
+    check("flags n   ", CPP2_UFCS(match)(v.regex_flags, "-v-q").matched);
+    check("to_string ", CPP2_UFCS(to_string)(cpp2::move(v).regex_record));
+}
+
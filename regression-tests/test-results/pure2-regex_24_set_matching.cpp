@@ -0,0 +1,65 @@
+
+#define CPP2_IMPORT_STD          Yes
+#include "cpp2regex.h"
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-regex_24_set_matching.cpp2"
+class router;
+
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-regex_24_set_matching.cpp2"
+class router {
+public: using table = cpp2::regex::regex_set_table<5,19,15,"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\002\002\002\002\002\002\002\002\002\000\000\000\000\000\000\000\000\000\000\000\003\000\004\000\000\000\000\000\000\000\000\005\000\000\000\006\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\011\000\012\000\013\000\000\000\000\014\015\016\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000","\002\000\002\000\003\000\002\000\004\000\005\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\007\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\010\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\011\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\012\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\013\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\014\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\015\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\016\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\017\000\002\000\002\000\002\000\020\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\021\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\022\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\023\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\003\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\002\000\002\000\002\000","\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\001\002\000\000","\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\020">;
+public: using scanner = table::scanner;
+public: [[nodiscard]] static auto match_all(cpp2::impl::in<std::string_view> subject) -> cpp2::regex::regex_set_result<5>;
+
+    public: router() = default;
+    public: router(router const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(router const&) -> void = delete;
+
+
+#line 7 "pure2-regex_24_set_matching.cpp2"
+};
+
+auto report(cpp2::impl::in<std::string> label, auto const& m) -> void;
+
+#line 20 "pure2-regex_24_set_matching.cpp2"
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-regex_24_set_matching.cpp2"
+
+#line 1 "pure2-regex_24_set_matching.cpp2"
+
+[[nodiscard]] auto router::match_all(cpp2::impl::in<std::string_view> subject) -> cpp2::regex::regex_set_result<5>{return table::scan(subject); }
+#line 9 "pure2-regex_24_set_matching.cpp2"
+auto report(cpp2::impl::in<std::string> label, auto const& m) -> void{
+    std::cout << label << ":";
+    auto p {0}; 
+    for( ; cpp2::impl::cmp_less(p,CPP2_UFCS(size)(m)); ++p ) {
+        if (CPP2_UFCS(matched)(m, p)) {
+            std::cout << " " << p;
+        }
+    }
+    std::cout << " (" + cpp2::to_string(CPP2_UFCS(count)(m)) + ")\n";
+}
+
+auto main() -> int{
+    auto r {router()}; 
+    report("get line ", CPP2_UFCS(match_all)(r, "GET /idx/42"));
+    report("put done ", CPP2_UFCS(match_all)(r, "PUT /x done"));
+    report("ping     ", CPP2_UFCS(match_all)(r, "ping"));
+    report("ping trail", CPP2_UFCS(match_all)(r, "ping!"));
+    report("digits mid", CPP2_UFCS(match_all)(r, "abc123def"));
+    report("no match ", CPP2_UFCS(match_all)(cpp2::move(r), "nothing here"));
+}
+
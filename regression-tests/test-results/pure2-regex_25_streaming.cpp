@@ -0,0 +1,83 @@
+
+#define CPP2_IMPORT_STD          Yes
+#include "cpp2regex.h"
+
+//=== Cpp2 type declarations ====================================================
+
+
+#define CPP2_NO_STRING_DISPATCH  Yes
+#include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
+
+#line 1 "pure2-regex_25_streaming.cpp2"
+class protocol;
+    
+
+#line 5 "pure2-regex_25_streaming.cpp2"
+class router;
+
+
+//=== Cpp2 type definitions and function declarations ===========================
+
+#line 1 "pure2-regex_25_streaming.cpp2"
+class protocol {
+public: using regex_frame_matcher = cpp2::regex::dfa_table_matcher<5,5,"\136\133\060\055\071\135\053\072\133\141\055\172\135\053\073\044","\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\001\001\001\001\001\001\001\001\001\002\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000","\000\000\002\000\000\000\000\000\000\000\000\000\002\000\003\000\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\005\000\004\000\000\000\000\000\000\000\000\000\000\000","\060\060\060\060\061",true,true>;
+public: using regex_frame_stream = regex_frame_matcher::stream_match;
+public: cpp2::regex::regular_expression<char,regex_frame_matcher> regex_frame {}; 
+    public: protocol() = default;
+    public: protocol(protocol const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(protocol const&) -> void = delete;
+
+
+#line 3 "pure2-regex_25_streaming.cpp2"
+};
+
+class router {
+public: using table = cpp2::regex::regex_set_table<3,18,14,"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\003\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\005\006\000\007\010\000\000\000\000\000\000\000\000\011\012\000\000\013\000\000\014\000\000\000\015\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000","\002\000\002\000\002\000\003\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\006\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\007\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\010\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\011\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\012\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\013\000\002\000\002\000\002\000\002\000\002\000\014\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\015\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\016\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\017\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\020\000\004\000\005\000\002\000\002\000\010\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\021\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\022\000\002\000\002\000\002\000\002\000\002\000\002\000\004\000\005\000\002\000\002\000\002\000\002\000\002\000\002\000","\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\004","\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\000">;
+public: using scanner = table::scanner;
+public: [[nodiscard]] static auto match_all(cpp2::impl::in<std::string_view> subject) -> cpp2::regex::regex_set_result<3>;
+
+    public: router() = default;
+    public: router(router const&) = delete; /* No 'that' constructor, suppress copy */
+    public: auto operator=(router const&) -> void = delete;
+
+
+#line 9 "pure2-regex_25_streaming.cpp2"
+};
+
+auto main() -> int;
+
+//=== Cpp2 function definitions =================================================
+
+#line 1 "pure2-regex_25_streaming.cpp2"
+
+#line 1 "pure2-regex_25_streaming.cpp2"
+
+[[nodiscard]] auto router::match_all(cpp2::impl::in<std::string_view> subject) -> cpp2::regex::regex_set_result<3>{return table::scan(subject); }
+#line 11 "pure2-regex_25_streaming.cpp2"
+auto main() -> int{
+    //  A frame arriving in three chunks still validates as one subject.
+    protocol::regex_frame_stream f {}; 
+    auto a1 {f.feed("123")}; 
+    auto a2 {f.feed(":ab")}; 
+    auto a3 {f.feed("c;")}; 
+    std::cout << "alive: " + cpp2::string_build(cpp2::interp(cpp2::move(a1)), " ", cpp2::interp(cpp2::move(a2)), " ", cpp2::interp(cpp2::move(a3))) + "\n";
+    std::cout << "frame: " + cpp2::to_string(CPP2_UFCS(matches)(cpp2::move(f))) + "\n";
+
+    //  A wrong byte kills the scan early, before the chunk even ends.
+    protocol::regex_frame_stream g {}; 
+    auto a4 {g.feed("12x999")}; 
+    std::cout << "dead:  " + cpp2::string_build(cpp2::interp(cpp2::move(a4)), " ", cpp2::interp(CPP2_UFCS(matches)(cpp2::move(g)))) + "\n";
+
+    //  Set scanning carries matches across chunk boundaries too.
+    router::scanner s {}; 
+    static_cast<void>(s.feed("GET /a/bou"));
+    static_cast<void>(s.feed("ndary/b "));
+    auto mid {s.finish()}; 
+    std::cout << "mid:   " + cpp2::string_build(cpp2::interp(CPP2_UFCS(matched)(mid, 0)), " ", cpp2::interp(CPP2_UFCS(matched)(mid, 1)), " ", cpp2::interp(CPP2_UFCS(matched)(cpp2::move(mid), 2))) + "\n";
+    static_cast<void>(s.feed("done"));
+    auto m {s.finish()}; 
+    std::cout << "set:   " + cpp2::string_build(cpp2::interp(CPP2_UFCS(matched)(m, 0)), " ", cpp2::interp(CPP2_UFCS(matched)(m, 1)), " ", cpp2::interp(CPP2_UFCS(matched)(m, 2)), " count=", cpp2::interp(CPP2_UFCS(count)(cpp2::move(m)))) + "\n";
+    static_cast<void>(cpp2::move(s));
+}
+
@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-requires-clauses.cpp2"
 
-#line 2 "pure2-requires-clauses.cpp2"
 template<typename T, typename U> 
 
     requires( std::is_same_v<T,int> 
@@ -18,7 +19,6 @@ template<typename T, typename U>
 
 #line 1 "pure2-requires-clauses.cpp2"
 
-#line 2 "pure2-requires-clauses.cpp2"
 template<typename T, typename U> 
 
     requires( std::is_same_v<T,int> 
@@ -56,17 +56,14 @@ auto main() -> int;
     template <typename T, typename U> requires( std::is_same_v<T,int> && std::is_same_v<U,int> )
 X<T,U>::X(){}
 
-#line 10 "pure2-requires-clauses.cpp2"
 template<typename T, typename U> [[nodiscard]] auto f
     (auto&& a, auto&& b) -> int
 requires (std::is_same_v<T,int> && std::is_same_v<U,int> && std::is_convertible_v<CPP2_TYPEOF(a), std::add_const_t<int>&> && std::is_convertible_v<CPP2_TYPEOF(b), std::add_const_t<int>&>) 
 
-#line 14 "pure2-requires-clauses.cpp2"
 {
     return CPP2_FORWARD(a) * CPP2_FORWARD(b); 
 }
 
-#line 18 "pure2-requires-clauses.cpp2"
 [[nodiscard]] constexpr auto f(auto const& x) -> int
 requires (true)  { return x;  }
 
@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-return-tuple-operator.cpp2"
 
-#line 2 "pure2-return-tuple-operator.cpp2"
 class A;
     
 
@@ -16,7 +17,6 @@ class A;
 
 #line 1 "pure2-return-tuple-operator.cpp2"
 
-#line 2 "pure2-return-tuple-operator.cpp2"
 class A {
 struct operator_call_ret { int x; int y; };
 
@@ -27,13 +27,11 @@ struct operator_dereference_ret { int x; int y; };
 
 
 
-#line 8 "pure2-return-tuple-operator.cpp2"
     public: [[nodiscard]] auto operator*() const& -> operator_dereference_ret;
 struct operator_subscript_ret { int x; int y; };
 
 
 
-#line 13 "pure2-return-tuple-operator.cpp2"
     public: [[nodiscard]] auto operator[](cpp2::impl::in<int> idx) const& -> operator_subscript_ret;
     public: A() = default;
     public: A(A const&) = delete; /* No 'that' constructor, suppress copy */
@@ -59,7 +57,6 @@ auto main() -> int;
         y.construct(34);
         return  { std::move(x.value()), std::move(y.value()) }; 
     }
-#line 8 "pure2-return-tuple-operator.cpp2"
     [[nodiscard]] auto A::operator*() const& -> operator_dereference_ret{
             cpp2::impl::deferred_init<int> x;
             cpp2::impl::deferred_init<int> y;
@@ -68,7 +65,6 @@ auto main() -> int;
         y.construct(45);
         return  { std::move(x.value()), std::move(y.value()) }; 
     }
-#line 13 "pure2-return-tuple-operator.cpp2"
     [[nodiscard]] auto A::operator[](cpp2::impl::in<int> idx) const& -> operator_subscript_ret{
             cpp2::impl::deferred_init<int> x;
             cpp2::impl::deferred_init<int> y;
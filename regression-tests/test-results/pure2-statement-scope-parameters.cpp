@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-statement-scope-parameters.cpp2"
 
@@ -13,14 +15,12 @@
 
 #line 1 "pure2-statement-scope-parameters.cpp2"
 
-#line 2 "pure2-statement-scope-parameters.cpp2"
 auto main(int const argc_, char** argv_) -> int;
 
 //=== Cpp2 function definitions =================================================
 
 #line 1 "pure2-statement-scope-parameters.cpp2"
 
-#line 2 "pure2-statement-scope-parameters.cpp2"
 auto main(int const argc_, char** argv_) -> int{
     auto const args = cpp2::make_args(argc_, argv_); 
 #line 3 "pure2-statement-scope-parameters.cpp2"
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-stdio-with-raii.cpp2"
 
@@ -15,7 +17,6 @@
 
 //  "A better C than C" ... ?
 //
-#line 4 "pure2-stdio-with-raii.cpp2"
 [[nodiscard]] auto main() -> int;
 
 //=== Cpp2 function definitions =================================================
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-synthesize-rightshift-and-rightshifteq.cpp2"
 
@@ -21,13 +23,11 @@
 
 #line 1 "pure2-synthesize-rightshift-and-rightshifteq.cpp2"
 [[nodiscard]] auto f(cpp2::impl::in<int> a, cpp2::impl::in<int> b) -> int{
-#line 2 "pure2-synthesize-rightshift-and-rightshifteq.cpp2"
     auto x {a}; 
     x >>= b * 2;
     return cpp2::move(x) >> 1; 
 }
 
-#line 7 "pure2-synthesize-rightshift-and-rightshifteq.cpp2"
 [[nodiscard]] auto main() -> int{
     std::cout << f(32, 1) << "\n";
 }
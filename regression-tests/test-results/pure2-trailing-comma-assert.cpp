@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-trailing-comma-assert.cpp2"
 
@@ -18,7 +20,6 @@ auto main() -> int;
 
 #line 1 "pure2-trailing-comma-assert.cpp2"
 auto main() -> int{
-#line 2 "pure2-trailing-comma-assert.cpp2"
     if (cpp2::cpp2_default.is_active() && !(true) ) { cpp2::cpp2_default.report_violation(CPP2_CONTRACT_MSG("some_potentially_long_string")); }
 }
 
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-trailing-commas.cpp2"
 
@@ -17,7 +19,6 @@ class vals;
 #line 1 "pure2-trailing-commas.cpp2"
 [[nodiscard]] auto f(auto const& a, auto const& b) -> decltype(auto);
 
-#line 3 "pure2-trailing-commas.cpp2"
 template<typename T, typename U> [[nodiscard]] auto g(T const& a, U const& b) -> decltype(auto);
 using doubler_ret = int;
 
@@ -43,15 +44,11 @@ auto main() -> int;
 #line 1 "pure2-trailing-commas.cpp2"
 [[nodiscard]] auto f(auto const& a, auto const& b) -> decltype(auto) { return a + b;  }
 
-#line 3 "pure2-trailing-commas.cpp2"
 template<typename T, typename U> [[nodiscard]] auto g(T const& a, U const& b) -> decltype(auto) { return a + b;  }
 
-#line 5 "pure2-trailing-commas.cpp2"
 [[nodiscard]] auto doubler(cpp2::impl::in<int> a) -> doubler_ret{
-        cpp2::impl::deferred_init<int> i;
-#line 6 "pure2-trailing-commas.cpp2"
-    i.construct(a * 2);
-return std::move(i.value()); }
+    int i {a * 2};
+return i; }
 
 vals::vals(auto&& i_)
 requires (std::is_convertible_v<CPP2_TYPEOF(i_), std::add_const_t<int>&>) 
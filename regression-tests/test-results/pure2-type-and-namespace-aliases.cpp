@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-type-and-namespace-aliases.cpp2"
 
-#line 2 "pure2-type-and-namespace-aliases.cpp2"
 namespace N {
 
 }
@@ -25,7 +26,6 @@ template<typename T> class myclass2;
 
 #line 1 "pure2-type-and-namespace-aliases.cpp2"
 
-#line 2 "pure2-type-and-namespace-aliases.cpp2"
 namespace N {
     template<typename T> using pmr_vec = std::vector<T,std::pmr::polymorphic_allocator<T>>;
 }
@@ -64,7 +64,6 @@ auto main() -> int;
 
 #line 1 "pure2-type-and-namespace-aliases.cpp2"
 
-#line 2 "pure2-type-and-namespace-aliases.cpp2"
 namespace N {
 
 }
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-type-constraints.cpp2"
 
@@ -16,7 +18,6 @@ class irregular;
 
 #line 1 "pure2-type-constraints.cpp2"
 
-#line 2 "pure2-type-constraints.cpp2"
 auto print(auto const& r) -> void
 CPP2_REQUIRES (std::regular<CPP2_TYPEOF(r)>) ;
 
@@ -37,14 +38,12 @@ auto main() -> int;
 
 #line 1 "pure2-type-constraints.cpp2"
 
-#line 2 "pure2-type-constraints.cpp2"
 auto print(auto const& r) -> void
 requires (std::regular<CPP2_TYPEOF(r)>) {
 #line 3 "pure2-type-constraints.cpp2"
     std::cout << "satisfies std::regular\n";
 }
 
-#line 6 "pure2-type-constraints.cpp2"
 auto print([[maybe_unused]] auto const& unnamed_param_1) -> void{
     std::cout << "fallback\n";
 }
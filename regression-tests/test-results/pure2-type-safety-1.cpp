@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-type-safety-1.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-type-safety-1.cpp2"
 
-#line 2 "pure2-type-safety-1.cpp2"
 [[nodiscard]] auto main() -> int;
 
 #line 24 "pure2-type-safety-1.cpp2"
@@ -29,7 +30,6 @@ auto print(cpp2::impl::in<std::string> msg, cpp2::impl::in<bool> b) -> void;
 
 #line 1 "pure2-type-safety-1.cpp2"
 
-#line 2 "pure2-type-safety-1.cpp2"
 [[nodiscard]] auto main() -> int
 {
     std::variant<int,int,double> v {42.0}; 
@@ -52,7 +52,6 @@ auto print(cpp2::impl::in<std::string> msg, cpp2::impl::in<bool> b) -> void;
     test_generic(cpp2::move(o), "optional<int>");
 }
 
-#line 24 "pure2-type-safety-1.cpp2"
 auto test_generic(auto const& x, auto const& msg) -> void{
     std::string msgx {msg}; 
     // Full qualification is necessary to avoid ambiguity in C++23
@@ -60,7 +59,6 @@ auto test_generic(auto const& x, auto const& msg) -> void{
     ::print(cpp2::move(msgx) + " is int? ", cpp2::impl::is<int>(x));
 }
 
-#line 31 "pure2-type-safety-1.cpp2"
 auto print(cpp2::impl::in<std::string> msg, cpp2::impl::in<bool> b) -> void{
     cpp2::impl::deferred_init<char const*> bmsg; 
     if (b) { bmsg.construct("true");}
@@ -21,7 +21,6 @@ auto test_generic(auto const& x, auto const& msg) -> void;
 
 #line 1 "pure2-type-safety-2-with-inspect-expression.cpp2"
 [[nodiscard]] auto main() -> int{
-#line 2 "pure2-type-safety-2-with-inspect-expression.cpp2"
     std::variant<int,double,int> v {42.0}; 
     std::any a {"xyzzy"}; 
     std::optional<int> o {}; 
@@ -40,14 +39,13 @@ auto test_generic(auto const& x, auto const& msg) -> void;
     test_generic(cpp2::move(o), "optional<int>");
 }
 
-#line 20 "pure2-type-safety-2-with-inspect-expression.cpp2"
 auto test_generic(auto const& x, auto const& msg) -> void{
     std::cout 
         << std::setw(30) << msg 
         << " value is " 
         << [&] () -> std::string { auto&& _expr = x;
             if (cpp2::impl::is<int>(_expr)) { if constexpr( requires{std::to_string(cpp2::impl::as<int>(x));} ) if constexpr( std::is_convertible_v<CPP2_TYPEOF((std::to_string(cpp2::impl::as<int>(x)))),std::string> ) return std::to_string(cpp2::impl::as<int>(x)); else return std::string{}; else return std::string{}; }
-            else return "not an int"; }
+            else return [&] () CPP2_COLD_LAMBDA -> std::string { return "not an int"; } (); }
         () 
         << "\n";
 }
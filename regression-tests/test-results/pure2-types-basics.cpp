@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-types-basics.cpp2"
 
-#line 2 "pure2-types-basics.cpp2"
 namespace N {
 
 class myclass;
@@ -21,7 +22,6 @@ class myclass;
 
 #line 1 "pure2-types-basics.cpp2"
 
-#line 2 "pure2-types-basics.cpp2"
 namespace N {
 
 class myclass {
@@ -85,7 +85,6 @@ auto main() -> int;
 
 #line 1 "pure2-types-basics.cpp2"
 
-#line 2 "pure2-types-basics.cpp2"
 namespace N {
 
 #line 6 "pure2-types-basics.cpp2"
@@ -109,7 +108,6 @@ namespace N {
 #line 11 "pure2-types-basics.cpp2"
     }
 
-#line 13 "pure2-types-basics.cpp2"
     myclass::myclass(cpp2::impl::in<std::string> s)
         : data{ 99 }
         , more{ s }{
@@ -130,7 +128,6 @@ namespace N {
 #line 18 "pure2-types-basics.cpp2"
     }
 
-#line 20 "pure2-types-basics.cpp2"
     myclass::myclass(cpp2::impl::in<int> x, cpp2::impl::in<std::string> s)
         : data{ 77 }
         , more{ s + std::to_string(x) + " plugh" }{
@@ -140,7 +137,6 @@ namespace N {
         print();
     }
 
-#line 27 "pure2-types-basics.cpp2"
     myclass::myclass()
         : more{ std::to_string(3.14159) }{
         // use default initializer for this.data
@@ -150,22 +146,18 @@ namespace N {
         print();
     }
 
-#line 34 "pure2-types-basics.cpp2"
     auto myclass::print() const& -> void{
-        std::cout << "    data: " + cpp2::to_string(data) + ", more: " + cpp2::to_string(more) + "\n";
+        std::cout << "    data: " + cpp2::string_build(cpp2::interp(data), ", more: ", cpp2::interp(more)) + "\n";
     }
 
-#line 38 "pure2-types-basics.cpp2"
     auto myclass::print() && -> void{
-        std::cout << "    (move print) data: " + cpp2::to_string(data) + ", more: " + cpp2::to_string(cpp2::move(*this).more) + "\n";
+        std::cout << "    (move print) data: " + cpp2::string_build(cpp2::interp(data), ", more: ", cpp2::interp(cpp2::move(*this).more)) + "\n";
     }
 
-#line 42 "pure2-types-basics.cpp2"
     myclass::~myclass() noexcept{
         std::cout << "myclass: destructor\n";
     }
 
-#line 46 "pure2-types-basics.cpp2"
     auto myclass::f(cpp2::impl::in<int> x) const& -> void{
         std::cout << "N::myclass::f with " + cpp2::to_string(x) + "\n";
     }
@@ -175,17 +167,13 @@ namespace N {
 
 #line 57 "pure2-types-basics.cpp2"
     template<typename T, typename U> [[nodiscard]] auto myclass::f1(T const& t, U const& u) -> decltype(auto) { return t + u; }
-#line 58 "pure2-types-basics.cpp2"
     template<typename T, typename U> [[nodiscard]] auto myclass::f2(T const& t, U const& u) -> decltype(auto) { return t + u;  }
-#line 59 "pure2-types-basics.cpp2"
     template<auto T, auto U> [[nodiscard]] auto myclass::f3() -> decltype(auto) { return T + U; }
-#line 60 "pure2-types-basics.cpp2"
     template<cpp2::i8 T, cpp2::i16 U> [[nodiscard]] auto myclass::f4() -> decltype(auto) { return T + U; }
 
 #line 64 "pure2-types-basics.cpp2"
 }
 
-#line 66 "pure2-types-basics.cpp2"
 auto main() -> int{
     N::myclass x {1}; 
     CPP2_UFCS(f)(x, 53);
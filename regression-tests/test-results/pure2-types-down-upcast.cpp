@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-types-down-upcast.cpp2"
 class A;
-#line 2 "pure2-types-down-upcast.cpp2"
   
 
 #line 8 "pure2-types-down-upcast.cpp2"
@@ -19,7 +20,6 @@ class B;
 
 #line 1 "pure2-types-down-upcast.cpp2"
 class A {
-#line 2 "pure2-types-down-upcast.cpp2"
   public: int i {0}; 
 
  public: virtual auto const_foo() const -> void;
@@ -66,23 +66,18 @@ auto test_down() -> void;
 
 #line 4 "pure2-types-down-upcast.cpp2"
  auto A::const_foo() const -> void{std::cout << "const foo \n"; }
-#line 5 "pure2-types-down-upcast.cpp2"
  auto A::mut_foo() & -> void{std::cout << "foo \n"; }
 
 #line 13 "pure2-types-down-upcast.cpp2"
 auto func_mut(A& a) -> void     {std::cout << "Call A mut: " + cpp2::to_string(a.i) + "" << std::endl;}
-#line 14 "pure2-types-down-upcast.cpp2"
 auto func_mut(B& b) -> void     {std::cout << "Call B mut: " + cpp2::to_string(b.d) + "" << std::endl;}
-#line 15 "pure2-types-down-upcast.cpp2"
 auto func_const(cpp2::impl::in<A> a) -> void{std::cout << "Call A const: " + cpp2::to_string(a.i) + "" << std::endl;}
-#line 16 "pure2-types-down-upcast.cpp2"
 auto func_const(cpp2::impl::in<B> b) -> void{std::cout << "Call B const: " + cpp2::to_string(b.d) + "" << std::endl;}
 
-#line 18 "pure2-types-down-upcast.cpp2"
 auto test_const_foo() -> void{
  A s {}; 
   A const* sC {&s}; 
-  CPP2_UFCS(const_foo)(s);
+  s.const_foo();
   CPP2_UFCS(const_foo)((*cpp2::impl::assert_not_null(sC)));
  CPP2_UFCS(const_foo)((cpp2::impl::as_<A>(s)));
   CPP2_UFCS(const_foo)((cpp2::impl::as_<A>(*cpp2::impl::assert_not_null(sC))));
@@ -90,15 +85,13 @@ auto test_const_foo() -> void{
   static_cast<void>(cpp2::move(sC));
 }
 
-#line 29 "pure2-types-down-upcast.cpp2"
 auto test_mut_foo() -> void{
  A s {}; 
-  CPP2_UFCS(mut_foo)(s);
+  s.mut_foo();
  CPP2_UFCS(mut_foo)((cpp2::impl::as_<A>(s)));
   static_cast<void>(cpp2::move(s));
 }
 
-#line 36 "pure2-types-down-upcast.cpp2"
 auto test_up() -> void{
   B b {}; 
   B const* bC {&b}; 
@@ -118,7 +111,6 @@ auto test_up() -> void{
   static_cast<void>(cpp2::move(bC));
 }
 
-#line 55 "pure2-types-down-upcast.cpp2"
 auto test_down() -> void{
   B b {}; 
   B const* bC {&b}; 
@@ -141,7 +133,6 @@ auto test_down() -> void{
   static_cast<void>(cpp2::move(aC));
 }
 
-#line 77 "pure2-types-down-upcast.cpp2"
 [[nodiscard]] auto main() -> int{
 
   test_const_foo();
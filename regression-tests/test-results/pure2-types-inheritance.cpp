@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-types-inheritance.cpp2"
 
-#line 2 "pure2-types-inheritance.cpp2"
 class Human;
     
 
@@ -27,7 +28,6 @@ class Cyborg;
 
 #line 1 "pure2-types-inheritance.cpp2"
 
-#line 2 "pure2-types-inheritance.cpp2"
 class Human {
     public: virtual auto speak() const -> void = 0;
     public: virtual ~Human() noexcept;
@@ -95,7 +95,6 @@ Human::~Human() noexcept{}
 #line 6 "pure2-types-inheritance.cpp2"
 namespace N {
 
-#line 8 "pure2-types-inheritance.cpp2"
         template <int I> Machine<I>::Machine([[maybe_unused]] cpp2::impl::in<std::string> unnamed_param_2){}
 
         template <int I> Machine<I>::~Machine() noexcept{}
@@ -114,38 +113,32 @@ namespace N {
         std::cout << "" + cpp2::to_string(name) + " checks in for the day's shift\n";
     }
 
-#line 25 "pure2-types-inheritance.cpp2"
     auto Cyborg::speak() const -> void{
         std::cout << "" + cpp2::to_string(name) + " cracks a few jokes with a coworker\n";
     }
 
-#line 29 "pure2-types-inheritance.cpp2"
     auto Cyborg::work() const -> void{
         std::cout << "" + cpp2::to_string(name) + " carries some half-tonne crates of Fe2O3 to cold storage\n";
     }
 
-#line 33 "pure2-types-inheritance.cpp2"
     auto Cyborg::print() const& -> void{
-        std::cout << "printing: " + cpp2::to_string(name) + " lives at " + cpp2::to_string(address) + "\n";
+        std::cout << "printing: " + cpp2::string_build(cpp2::interp(name), " lives at ", cpp2::interp(address)) + "\n";
     }
 
-#line 37 "pure2-types-inheritance.cpp2"
     Cyborg::~Cyborg() noexcept { 
         std::cout << "Tired but satisfied after another successful day, " + cpp2::to_string(cpp2::move(*this).name) + " checks out and goes home to their family\n";  }
 
 #line 41 "pure2-types-inheritance.cpp2"
 auto make_speak(cpp2::impl::in<Human> h) -> void{
     std::cout << "-> [vcall: make_speak] ";
-    CPP2_UFCS(speak)(h);
+    h.speak();
 }
 
-#line 46 "pure2-types-inheritance.cpp2"
 auto do_work(cpp2::impl::in<N::Machine<99>> m) -> void{
     std::cout << "-> [vcall: do_work] ";
     CPP2_UFCS(work)(m);
 }
 
-#line 51 "pure2-types-inheritance.cpp2"
 auto main() -> int{
     Cyborg c {"Parsnip"}; 
     CPP2_UFCS(print)(c);
@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-types-order-independence-and-nesting.cpp2"
 
-#line 2 "pure2-types-order-independence-and-nesting.cpp2"
 namespace N {
 
 #line 6 "pure2-types-order-independence-and-nesting.cpp2"
@@ -36,7 +37,6 @@ template<typename T, typename U> class A;
 
 #line 1 "pure2-types-order-independence-and-nesting.cpp2"
 
-#line 2 "pure2-types-order-independence-and-nesting.cpp2"
 namespace N {
 
 //  A type X, that uses Y (defined later)
@@ -107,7 +107,6 @@ auto main() -> int;
 
 #line 1 "pure2-types-order-independence-and-nesting.cpp2"
 
-#line 2 "pure2-types-order-independence-and-nesting.cpp2"
 namespace N {
 
 #line 10 "pure2-types-order-independence-and-nesting.cpp2"
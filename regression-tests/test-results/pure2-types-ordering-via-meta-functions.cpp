@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-types-ordering-via-meta-functions.cpp2"
 
-#line 2 "pure2-types-ordering-via-meta-functions.cpp2"
 class my_integer;
     
 
@@ -28,7 +29,6 @@ class mystruct;
 
 #line 1 "pure2-types-ordering-via-meta-functions.cpp2"
 
-#line 2 "pure2-types-ordering-via-meta-functions.cpp2"
 class my_integer {
     private: int v; 
     public: my_integer(cpp2::impl::in<int> val);
@@ -95,7 +95,6 @@ auto main() -> int;
                                         return *this; }
 
 
-#line 9 "pure2-types-ordering-via-meta-functions.cpp2"
     case_insensitive_string::case_insensitive_string(cpp2::impl::in<std::string> val)
                                                 : v{ val }{}
 #line 9 "pure2-types-ordering-via-meta-functions.cpp2"
@@ -104,7 +103,6 @@ auto main() -> int;
                                                 return *this; }
 
 
-#line 14 "pure2-types-ordering-via-meta-functions.cpp2"
     person_in_family_tree::person_in_family_tree(cpp2::impl::in<int> parents)
                                             : dummy_data{ parents }{}
 #line 14 "pure2-types-ordering-via-meta-functions.cpp2"
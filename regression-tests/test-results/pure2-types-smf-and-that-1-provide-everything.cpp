@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-types-smf-and-that-1-provide-everything.cpp2"
 
-#line 2 "pure2-types-smf-and-that-1-provide-everything.cpp2"
 class myclass;
 
 
@@ -16,7 +17,6 @@ class myclass;
 
 #line 1 "pure2-types-smf-and-that-1-provide-everything.cpp2"
 
-#line 2 "pure2-types-smf-and-that-1-provide-everything.cpp2"
 class myclass {
 
     public: myclass(myclass const& that);
@@ -62,7 +62,6 @@ auto main() -> int;
         std::cout << "ctor - copy (GENERAL)";
     }
 
-#line 8 "pure2-types-smf-and-that-1-provide-everything.cpp2"
     myclass::myclass(myclass&& that) noexcept
         : name{ cpp2::move(that).name + "(CM)" }
         , addr{ std::move(that).addr }{
@@ -71,7 +70,6 @@ auto main() -> int;
         std::cout << "ctor - move          ";
     }
 
-#line 13 "pure2-types-smf-and-that-1-provide-everything.cpp2"
     auto myclass::operator=(myclass const& that) -> myclass& {
         name = that.name;
         addr = that.addr + "(AC)";
@@ -82,7 +80,6 @@ auto main() -> int;
 #line 16 "pure2-types-smf-and-that-1-provide-everything.cpp2"
     }
 
-#line 18 "pure2-types-smf-and-that-1-provide-everything.cpp2"
     auto myclass::operator=(myclass&& that) noexcept -> myclass& {
         name = std::move(that).name;
         addr = std::move(that).addr;
@@ -92,7 +89,6 @@ auto main() -> int;
 #line 20 "pure2-types-smf-and-that-1-provide-everything.cpp2"
     }
 
-#line 22 "pure2-types-smf-and-that-1-provide-everything.cpp2"
     myclass::myclass(cpp2::impl::in<std::string> x)
         : name{ x }{
 
@@ -117,7 +113,7 @@ auto main() -> int;
         cpp2::impl::in<std::string_view> suffix
         ) const& -> void
     {
-        std::cout << prefix << "[ " + cpp2::to_string(name) + " | " + cpp2::to_string(addr) + " ]" << suffix;
+        std::cout << prefix << "[ " + cpp2::string_build(cpp2::interp(name), " | ", cpp2::interp(addr)) + " ]" << suffix;
     }
 
 #line 41 "pure2-types-smf-and-that-1-provide-everything.cpp2"
@@ -126,17 +122,17 @@ auto main() -> int{
     std::cout << "----------------------  ------------  ------------------------------------------------------\n";
 
     myclass x {"Henry"}; 
-    CPP2_UFCS(print)(x, "   construct     ", "\n");
+    x.print("   construct     ", "\n");
     x = "Clara";
-    CPP2_UFCS(print)(x, "   assign        ", "\n");
+    x.print("   assign        ", "\n");
 
     auto y {x}; 
     CPP2_UFCS(print)(y, "   cp-construct  ", " <- ");
-    CPP2_UFCS(print)(x, "", "\n");
+    x.print("", "\n");
 
     auto z {std::move(x)}; 
     CPP2_UFCS(print)(z, "   mv-construct  ", " <- ");
-    CPP2_UFCS(print)(cpp2::move(x), "", "\n");
+    cpp2::move(x).print("", "\n");
 
     z = y;
     CPP2_UFCS(print)(z, "   cp-assign     ", " <- ");
@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-types-that-parameters.cpp2"
 
-#line 2 "pure2-types-that-parameters.cpp2"
 class myclass;
 
 
@@ -16,7 +17,6 @@ class myclass;
 
 #line 1 "pure2-types-that-parameters.cpp2"
 
-#line 2 "pure2-types-that-parameters.cpp2"
 class myclass {
 
     public: explicit myclass();
@@ -48,7 +48,6 @@ auto main() -> int;
 #line 4 "pure2-types-that-parameters.cpp2"
     myclass::myclass(){}
 
-#line 6 "pure2-types-that-parameters.cpp2"
     myclass::myclass(myclass const& that)
         : name{ that.name }
         , addr{ that.addr }{
@@ -64,7 +63,6 @@ auto main() -> int;
 #line 9 "pure2-types-that-parameters.cpp2"
     }
 
-#line 11 "pure2-types-that-parameters.cpp2"
     myclass::myclass(myclass&& that) noexcept
         : name{ cpp2::move(that).name }
         , addr{ cpp2::move(that).addr }{
@@ -80,24 +78,23 @@ auto main() -> int;
 #line 14 "pure2-types-that-parameters.cpp2"
     }
 
-#line 16 "pure2-types-that-parameters.cpp2"
     auto myclass::print() const& -> void{
-        std::cout << "name '" + cpp2::to_string(name) + "', addr '" + cpp2::to_string(addr) + "'\n";
+        std::cout << "name '" + cpp2::string_build(cpp2::interp(name), "', addr '", cpp2::interp(addr)) + "'\n";
     }
 
 #line 25 "pure2-types-that-parameters.cpp2"
 auto main() -> int{
     myclass x {}; 
-    CPP2_UFCS(print)(x);
+    x.print();
 
     std::cout << "-----\n";
     auto y {x}; 
-    CPP2_UFCS(print)(x);
+    x.print();
     CPP2_UFCS(print)(cpp2::move(y));
 
     std::cout << "-----\n";
     auto z {std::move(x)}; 
-    CPP2_UFCS(print)(cpp2::move(x));
+    cpp2::move(x).print();
     CPP2_UFCS(print)(cpp2::move(z));
 }
 
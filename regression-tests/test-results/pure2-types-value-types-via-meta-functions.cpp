@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-types-value-types-via-meta-functions.cpp2"
 
-#line 2 "pure2-types-value-types-via-meta-functions.cpp2"
 class widget;
     
 
@@ -24,7 +25,6 @@ class p_widget;
 
 #line 1 "pure2-types-value-types-via-meta-functions.cpp2"
 
-#line 2 "pure2-types-value-types-via-meta-functions.cpp2"
 class widget {
     private: int val {0}; 
     public: widget(cpp2::impl::in<int> i);
@@ -152,7 +152,6 @@ auto main() -> int{
     test<p_widget>();
 }
 
-#line 23 "pure2-types-value-types-via-meta-functions.cpp2"
 template<typename T> auto test() -> void{
     //  should be default constructible
     T a {}; 
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-ufcs-member-access-and-chaining.cpp2"
 
@@ -24,7 +26,6 @@ auto no_return([[maybe_unused]] auto const& unnamed_param_1) -> void;
 using fun_ret = int;
 
 
-#line 35 "pure2-ufcs-member-access-and-chaining.cpp2"
 [[nodiscard]] auto fun() -> fun_ret;
 
 #line 40 "pure2-ufcs-member-access-and-chaining.cpp2"
@@ -49,7 +50,6 @@ class mytype {
 
 #line 1 "pure2-ufcs-member-access-and-chaining.cpp2"
 [[nodiscard]] auto main() -> int{
-#line 2 "pure2-ufcs-member-access-and-chaining.cpp2"
     auto i {42}; 
     static_cast<void>(CPP2_UFCS(ufcs)(cpp2::move(i)));
 
@@ -77,23 +77,17 @@ class mytype {
     cpp2::move(obj).hun(42);// explicit non-UFCS
 }
 
-#line 29 "pure2-ufcs-member-access-and-chaining.cpp2"
 auto no_return([[maybe_unused]] auto const& unnamed_param_1) -> void{}
 
-#line 31 "pure2-ufcs-member-access-and-chaining.cpp2"
 [[nodiscard]] auto ufcs(cpp2::impl::in<int> i) -> int{
     return i + 2; 
 }
 
-#line 35 "pure2-ufcs-member-access-and-chaining.cpp2"
 [[nodiscard]] auto fun() -> fun_ret{
-        cpp2::impl::deferred_init<int> i;
-#line 36 "pure2-ufcs-member-access-and-chaining.cpp2"
-    i.construct(42);
-    return std::move(i.value()); 
+    int i {42};
+    return i; 
 }
 
-#line 40 "pure2-ufcs-member-access-and-chaining.cpp2"
 [[nodiscard]] auto get_i(auto const& r) -> int{
     return r; 
 }
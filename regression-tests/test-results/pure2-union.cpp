@@ -4,11 +4,12 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-union.cpp2"
 
-#line 2 "pure2-union.cpp2"
 class name_or_number;
     
 
@@ -20,7 +21,6 @@ template<typename T> class name_or_other;
 
 #line 1 "pure2-union.cpp2"
 
-#line 2 "pure2-union.cpp2"
 class name_or_number {
 private: cpp2::aligned_storage<cpp2::max(sizeof(std::string), sizeof(cpp2::i32)),cpp2::max(alignof(std::string), alignof(cpp2::i32))> _storage {}; private: cpp2::i8 _discriminator {-1}; public: [[nodiscard]] auto is_name() const& -> bool;
 public: [[nodiscard]] auto name() const& -> std::string const&;
@@ -188,25 +188,24 @@ template <typename T> name_or_other<T>::name_or_other(name_or_other const& that)
     }
 #line 19 "pure2-union.cpp2"
 auto print_name(cpp2::impl::in<name_or_number> non) -> void{
-    if (CPP2_UFCS(is_name)(non)) {
-        std::cout << CPP2_UFCS(name)(non) << "\n";
+    if (non.is_name()) {
+        std::cout << non.name() << "\n";
     }
     else {
         std::cout << "(not a name)\n";
     }
 }
 
-#line 28 "pure2-union.cpp2"
 auto main() -> int{
     name_or_number x {}; 
     std::cout << "sizeof(x) - alignof(x) == max(sizeof(fields))" 
               << " is " + cpp2::to_string(sizeof(x) - alignof(name_or_number) == std::max(sizeof(cpp2::i32), sizeof(std::string))) + "\n";
 
-    CPP2_UFCS(print_name)(x);
+    print_name(x);
 
-    CPP2_UFCS(set_name)(x, "xyzzy", cpp2::impl::as_<cpp2::u8, 3>());
+    x.set_name("xyzzy", cpp2::impl::as_<cpp2::u8, 3>());
 
-    CPP2_UFCS(print_name)(cpp2::move(x));
+    print_name(cpp2::move(x));
 
     {
         name_or_other<int> val {}; 
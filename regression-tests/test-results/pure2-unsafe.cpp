@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-unsafe.cpp2"
 
@@ -13,7 +15,6 @@
 
 #line 1 "pure2-unsafe.cpp2"
 
-#line 2 "pure2-unsafe.cpp2"
 auto f(cpp2::impl::in<cpp2::i32> i, std::string& s) -> void;
 
 #line 12 "pure2-unsafe.cpp2"
@@ -23,7 +24,6 @@ auto main() -> int;
 
 #line 1 "pure2-unsafe.cpp2"
 
-#line 2 "pure2-unsafe.cpp2"
 auto f(cpp2::impl::in<cpp2::i32> i, std::string& s) -> void{
     // j := i as i16;                     // error, maybe-lossy narrowing
     auto j {cpp2::unchecked_narrow<cpp2::i16>(i)}; // ok, 'unchecked' is explicit
@@ -34,7 +34,6 @@ auto f(cpp2::impl::in<cpp2::i32> i, std::string& s) -> void{
     *cpp2::impl::assert_not_null(ps) = "plugh";
 }
 
-#line 12 "pure2-unsafe.cpp2"
 auto main() -> int{
     std::string str {"xyzzy"}; 
     f(42, str);
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-variadics.cpp2"
 
@@ -32,7 +34,6 @@ template<auto ...UnnamedTypeParam1_2> class t2;
 #line 1 "pure2-variadics.cpp2"
 
 //  Type pack expansion
-#line 3 "pure2-variadics.cpp2"
 template<typename ...Ts> class x {
     private: std::tuple<Ts...> tup {}; 
 
@@ -107,18 +108,14 @@ template<typename ...Args> auto left_fold_print(std::ostream& out, Args const& .
     (out << ... << args);
 }
 
-#line 35 "pure2-variadics.cpp2"
 template<typename ...Args> [[nodiscard]] auto all(Args const& ...args) -> bool { 
     //  Unary left fold expression
     return (... && args);  }
 
-#line 39 "pure2-variadics.cpp2"
 template<typename ...Args> [[nodiscard]] auto make_string(Args&& ...args) -> decltype(auto) { return std::string{CPP2_FORWARD(args)...};  }
 
-#line 41 "pure2-variadics.cpp2"
 template  <typename T, typename ...Args> [[nodiscard]] auto make(Args&& ...args) -> decltype(auto) { return T{CPP2_FORWARD(args)...}; }
 
-#line 43 "pure2-variadics.cpp2"
 auto main() -> int
 {
     x<int,long,std::string> auto_1 {}; 
@@ -4,7 +4,9 @@
 //=== Cpp2 type declarations ====================================================
 
 
+#define CPP2_NO_STRING_DISPATCH  Yes
 #include "cpp2util.h"
+#undef  CPP2_NO_STRING_DISPATCH
 
 #line 1 "pure2-various-string-literals.cpp2"
 
@@ -18,7 +20,6 @@ auto main() -> int;
 
 #line 1 "pure2-various-string-literals.cpp2"
 auto main() -> int{
-#line 2 "pure2-various-string-literals.cpp2"
     auto s1 {u"u\""}; 
     auto s2 {U"U\""}; 
     auto s3 {u8"u8\""}; 
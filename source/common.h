@@ -42,12 +42,37 @@
 #ifndef CPP2_COMMON_H
 #define CPP2_COMMON_H
 
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <cctype>
 #include <chrono>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 
+#if defined(__SSE2__) || (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define CPP2_USE_SSE2
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON)
+    #define CPP2_USE_NEON
+    #include <arm_neon.h>
+#endif
+
+#if defined(__linux__)
+    #define CPP2_USE_PERF_COUNTERS
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
 namespace cpp2 {
 
 //-----------------------------------------------------------------------
@@ -58,13 +83,27 @@ namespace cpp2 {
 //
 struct source_line
 {
-    std::string text;
+    //  The line's text - normally a zero-copy view into the source file's
+    //  contiguous buffer (or other stable storage); a line that is edited
+    //  in place, such as by string interpolation expansion, is copied
+    //  into owned storage on first write
+    std::string_view text;
 
     enum class category : u8 { empty, preprocessor, comment, import, cpp1, cpp2, rawstring };
     category cat;
 
     bool all_tokens_are_densely_spaced = true; // to be overridden in lexing if they're not
 
+private:
+    std::string owned;          // set by the first in-place edit
+    bool        is_owned = false;
+
+    //  The emitter re-asks for a line's indentation for every token it
+    //  aligns, so compute it once per line - 'mutable' because it's a
+    //  cache of a property of 'text', filled in by the const query
+    mutable int indent_cached = -1;
+
+public:
     source_line(
         std::string_view t = {},
         category         c = category::empty
@@ -73,12 +112,68 @@ struct source_line
         , cat{c}
     { }
 
+    //  replace: edit the line in place, copying it into owned storage
+    //  first since the shared source buffer is read-only
+    //
+    auto replace(
+        size_t           pos,
+        size_t           count,
+        std::string_view with
+    )
+        -> void
+    {
+        if (!is_owned) {
+            owned    = std::string{text};
+            is_owned = true;
+        }
+        owned.replace( pos, count, with.data(), with.size() );
+        text          = owned;
+        indent_cached = -1;     // the edit may have changed the leading whitespace
+    }
+
+    //  The special members keep 'text' pointing at this object's own
+    //  storage when an edited line is copied or moved
+    //
+    source_line(source_line const& that)
+    {
+        *this = that;
+    }
+    auto operator=(source_line const& that)
+        -> source_line&
+    {
+        cat                           = that.cat;
+        all_tokens_are_densely_spaced = that.all_tokens_are_densely_spaced;
+        owned                         = that.owned;
+        is_owned                      = that.is_owned;
+        text                          = is_owned ? std::string_view{owned} : that.text;
+        indent_cached                 = that.indent_cached;
+        return *this;
+    }
+    source_line(source_line&& that) noexcept
+    {
+        *this = std::move(that);
+    }
+    auto operator=(source_line&& that) noexcept
+        -> source_line&
+    {
+        cat                           = that.cat;
+        all_tokens_are_densely_spaced = that.all_tokens_are_densely_spaced;
+        owned                         = std::move(that.owned);
+        is_owned                      = that.is_owned;
+        text                          = is_owned ? std::string_view{owned} : that.text;
+        indent_cached                 = that.indent_cached;
+        return *this;
+    }
+
     auto indent() const
         -> int
     {
-        return
-            unchecked_narrow<int>(std::find_if_not( text.begin(), text.end(), &isspace )
-                               - text.begin());
+        if (indent_cached < 0) {
+            indent_cached =
+                unchecked_narrow<int>(std::find_if_not( text.begin(), text.end(), &isspace )
+                                   - text.begin());
+        }
+        return indent_cached;
     }
 
     auto prefix() const
@@ -128,14 +223,16 @@ struct comment
     comment_kind    kind;
     source_position start;
     source_position end;
-    std::string     text;
+
+    //  A view, not an owned string: a line comment views the source
+    //  line it was lexed from (text we already have in the source
+    //  buffer), and a stream comment views the lexer's comment pool
+    std::string_view text;
 
     mutable bool    dbg_was_printed = false;
 };
 
 struct string_parts {
-    struct cpp_code   { std::string text; };
-    struct raw_string { std::string text; };
     enum adds_sequences : u8 { no_ends = 0, on_the_beginning = 1, on_the_end = 2, on_both_ends = 3 };
 
     string_parts(const std::string& beginseq,
@@ -145,16 +242,28 @@ struct string_parts {
      , end_seq{endseq}
      , strategy{strateg}
     {
+        //  Interpolated strings typically split into a handful of parts,
+        //  so reserve enough up front to avoid regrowing for each one
+        parts.reserve(8);
+        storage.reserve(64);
         if (!(strategy & on_the_beginning)) {
-            parts.push_back(raw_string{""});
+            add_part("", part::raw);
         }
     }
 
-    void add_code  (const std::string&      text) { parts.push_back(cpp_code{text}); }
-    void add_string(const std::string&      text) { parts.push_back(raw_string{text}); }
-    void add_string(const std::string_view& text) { parts.push_back(raw_string{std::string(text)}); }
+    void add_code  (std::string_view text) { add_part(text, part::code); }
+    void add_string(std::string_view text) { add_part(text, part::raw); }
+
+    //  An interpolated argument, stored as just its parenthesized
+    //  argument chunk "(expr)" or "(expr,\"{:fmt}\")" so that generate
+    //  can choose the runtime entry point per assembly form: the
+    //  operator+ chain needs a std::string per part (cpp2::to_string),
+    //  while a string_build call takes the argument as a typed slot
+    //  (cpp2::interp) and formats it directly into its one sized
+    //  allocation
+    void add_interp(std::string_view chunk) { add_part(chunk, part::interp); }
 
-    void clear() { parts.clear(); }
+    void clear() { parts.clear(); storage.clear(); }
 
     auto empty() const { return parts.empty(); }
 
@@ -165,31 +274,140 @@ struct string_parts {
                  + (strategy & on_the_end ? end_seq : std::string{});
         }
 
-        auto result = std::visit(begin_visit{begin_seq, strategy},
-                                 parts.front());
-
-        if (std::ssize(parts) > 1) {
-            auto it1 = parts.cbegin();
-            auto it2 = parts.cbegin()+1;
-            for(;it2 != parts.cend(); ++it1, ++it2) {
-                result += std::visit(generator_visit{begin_seq, end_seq}, *it1, *it2);
+        //  Both forms below are assembled in two passes: the first adds
+        //  up the exact length of every piece, so the second can append
+        //  everything into a single reservation - the assembly of an
+        //  expanded literal is then one allocation no matter how many
+        //  parts it has
+        auto sized_assembly = [](auto const& emit) {
+            auto length = std::size_t{0};
+            emit([&](std::string_view piece) { length += piece.size(); });
+            auto result = std::string{};
+            result.reserve(length);
+            emit([&](std::string_view piece) { result += piece; });
+            return result;
+        };
+
+        //  When a complete expanded literal has several interpolated
+        //  parts, emit the interior through a single cpp2::string_build
+        //  call so the run time can size the result once and append in
+        //  place, instead of an operator+ chain that allocates a
+        //  temporary per part. The first and last raw chunks stay
+        //  outside the call as real string literal tokens, because
+        //  adjacent string literals merge in the grammar and must keep
+        //  doing so across an expansion. Partial pieces (multiline raw
+        //  strings) always take the chain form below, which stays
+        //  textually concatenatable across lines
+        if (
+            strategy == on_both_ends
+            && is_expanded()
+            )
+        {
+            auto first_is_raw = parts.front().kind == part::raw;
+            auto last_is_raw  =
+                std::ssize(parts) > 1
+                && parts.back().kind == part::raw
+                ;
+
+            //  Only worthwhile when more than one part remains inside -
+            //  for a lone to_string the chain form is already minimal
+            if (std::ssize(parts) - first_is_raw - last_is_raw > 1)
+            {
+                return sized_assembly([&](auto const& put) {
+                    auto quote = [&](part const& p) {
+                        put(begin_seq);
+                        put(text_of(p));
+                        put(end_seq);
+                    };
+                    if (first_is_raw) {
+                        quote(parts.front());
+                        put(" + ");
+                    }
+                    put("cpp2::string_build(");
+                    auto first = true;
+                    for (auto i = std::ptrdiff_t{first_is_raw}; i < std::ssize(parts) - last_is_raw; ++i) {
+                        if (!std::exchange(first, false)) {
+                            put(", ");
+                        }
+                        if (parts[i].kind == part::raw) {
+                            quote(parts[i]);
+                        }
+                        else {
+                            if (parts[i].kind == part::interp) {
+                                put("cpp2::interp");
+                            }
+                            put(text_of(parts[i]));
+                        }
+                    }
+                    put(")");
+                    if (last_is_raw) {
+                        put(" + ");
+                        quote(parts.back());
+                    }
+                });
             }
         }
 
-        if (!(strategy & on_the_end)) {
-            result += std::visit([this](const auto& lhs) {
-                return generator_visit{begin_seq, end_seq}(lhs, raw_string{""});
-            }, parts.back());
-        }
-
-        result += std::visit(end_visit{end_seq, strategy}, parts.back());
+        return sized_assembly([&](auto const& put) {
+            //  In the chain form every non-raw part must be a
+            //  std::string, so interp parts take the to_string spelling
+            auto put_part = [&](part const& p) {
+                if (p.kind == part::interp) {
+                    put("cpp2::to_string");
+                }
+                put(text_of(p));
+            };
+
+            if (
+                parts.front().kind == part::raw
+                && (strategy & on_the_beginning)
+                )
+            {
+                put(begin_seq);
+            }
+            put_part(parts.front());
+
+            for (auto i = std::ptrdiff_t{1}; i < std::ssize(parts); ++i) {
+                auto prev_raw = parts[i-1].kind == part::raw;
+                auto curr_raw = parts[i].kind   == part::raw;
+                if (prev_raw && !curr_raw) {
+                    put(end_seq);
+                    put(" + ");
+                }
+                else if (!prev_raw && curr_raw) {
+                    put(" + ");
+                    put(begin_seq);
+                }
+                else if (!prev_raw && !curr_raw) {
+                    put(" + ");
+                }
+                put_part(parts[i]);
+            }
 
-        return result;
+            //  An incomplete piece reopens after a trailing code part so
+            //  the next piece can concatenate textually, and a complete
+            //  one closes a trailing raw part
+            if (
+                !(strategy & on_the_end)
+                && parts.back().kind != part::raw
+                )
+            {
+                put(" + ");
+                put(begin_seq);
+            }
+            if (
+                (strategy & on_the_end)
+                && parts.back().kind == part::raw
+                )
+            {
+                put(end_seq);
+            }
+        });
     }
 
     auto is_expanded() const -> bool {
         for (const auto& p : parts) {
-            if (std::holds_alternative<cpp_code>(p)) {
+            if (p.kind != part::raw) {
                 return true;
             }
         }
@@ -197,51 +415,31 @@ struct string_parts {
     }
 
 private:
-    std::string     begin_seq;
-    std::string     end_seq;
-    adds_sequences  strategy;
-    std::vector<std::variant<raw_string, cpp_code>> parts;
-
-    struct begin_visit {
-        std::string begin_seq;
-        adds_sequences strategy;
-
-        auto operator()(const raw_string& part) const -> std::string {
-            return (strategy & on_the_beginning ? begin_seq : "") + part.text;
-        }
-        auto operator()(const cpp_code& part) const -> std::string {
-            return part.text;
-        }
+    //  Parts are stored as offsets into one owned text buffer, so each
+    //  added part is an append to that buffer instead of a string
+    //  allocation of its own - offsets stay valid as the buffer grows,
+    //  where views would not
+    struct part {
+        enum kinds : u8 { raw = 0, code, interp };
+        std::size_t start;
+        std::size_t size;
+        kinds       kind;
     };
 
-    struct end_visit {
-        std::string end_seq;
-        adds_sequences strategy;
-        auto operator()(const raw_string&) const -> std::string {
-            return strategy & on_the_end ? end_seq : "";
-        }
-        auto operator()(const cpp_code&) const -> std::string {
-            return {};
-        }
-    };
+    void add_part(std::string_view text, part::kinds kind) {
+        parts.push_back(part{ storage.size(), text.size(), kind });
+        storage += text;
+    }
 
-    struct generator_visit {
-        std::string begin_seq;
-        std::string end_seq;
+    auto text_of(part const& p) const -> std::string_view {
+        return std::string_view{storage}.substr(p.start, p.size);
+    }
 
-        auto operator()(const raw_string&, const cpp_code& part ) const -> std::string {
-            return end_seq + " + " + part.text;
-        }
-        auto operator()(const cpp_code&, const raw_string& part ) const -> std::string  {
-            return " + " + begin_seq + part.text;
-        }
-        auto operator()(const raw_string&, const raw_string& part ) const -> std::string  {
-            return part.text;
-        }
-        auto operator()(const cpp_code&, const cpp_code& part ) const -> std::string  {
-            return " + " + part.text;
-        }
-    };
+    std::string       begin_seq;
+    std::string       end_seq;
+    adds_sequences    strategy;
+    std::string       storage;
+    std::vector<part> parts;
 };
 
 struct raw_string
@@ -335,6 +533,172 @@ auto is_identifier_continue(char c)
         ;
 }
 
+//  scan_identifier_continue: returns the first position >= j in s that is
+//  not an identifier-continue character (or ssize(s) if there is none)
+//
+//  This is the hottest scanning loop in the lexer, so where we have SSE2
+//  or NEON we classify 16 bytes per step and skip whole runs of identifier
+//  characters, falling back to the portable byte-at-a-time loop otherwise
+//
+auto scan_identifier_continue(
+    std::string_view s,
+    int              j
+    )
+    -> int
+{
+#if defined(CPP2_USE_SSE2)
+    while (j + 16 <= std::ssize(s))
+    {
+        auto chunk = _mm_loadu_si128( reinterpret_cast<__m128i const*>(s.data() + j) );
+
+        //  A byte continues an identifier if it is '0'..'9', 'A'..'Z',
+        //  'a'..'z', or '_' - note the signed compares also classify
+        //  bytes >= 0x80 as non-identifier, same as the scalar loop
+        auto lower  = _mm_or_si128( chunk, _mm_set1_epi8( 0x20 ) );
+        auto alpha  = _mm_and_si128(
+            _mm_cmpgt_epi8( lower, _mm_set1_epi8( 'a'-1 ) ),
+            _mm_cmpgt_epi8( _mm_set1_epi8( 'z'+1 ), lower )
+        );
+        auto digit  = _mm_and_si128(
+            _mm_cmpgt_epi8( chunk, _mm_set1_epi8( '0'-1 ) ),
+            _mm_cmpgt_epi8( _mm_set1_epi8( '9'+1 ), chunk )
+        );
+        auto under  = _mm_cmpeq_epi8( chunk, _mm_set1_epi8( '_' ) );
+        auto ident  = _mm_or_si128( _mm_or_si128( alpha, digit ), under );
+
+        auto mask   = _mm_movemask_epi8( ident );
+        if (mask != 0xFFFF) {
+            return j + std::countr_zero( static_cast<unsigned>(~mask) );
+        }
+        j += 16;
+    }
+#elif defined(CPP2_USE_NEON)
+    while (j + 16 <= std::ssize(s))
+    {
+        auto chunk = vld1q_u8( reinterpret_cast<uint8_t const*>(s.data() + j) );
+
+        auto lower = vorrq_u8( chunk, vdupq_n_u8( 0x20 ) );
+        auto alpha = vandq_u8(
+            vcgeq_u8( lower, vdupq_n_u8( 'a' ) ),
+            vcleq_u8( lower, vdupq_n_u8( 'z' ) )
+        );
+        auto digit = vandq_u8(
+            vcgeq_u8( chunk, vdupq_n_u8( '0' ) ),
+            vcleq_u8( chunk, vdupq_n_u8( '9' ) )
+        );
+        auto under = vceqq_u8( chunk, vdupq_n_u8( '_' ) );
+        auto ident = vorrq_u8( vorrq_u8( alpha, digit ), under );
+
+        //  If every lane matched, skip the whole chunk - otherwise find
+        //  the first non-matching byte with the scalar loop below
+        if (vminvq_u8( ident ) == 0xFF) {
+            j += 16;
+            continue;
+        }
+        break;
+    }
+#endif
+    while (
+        j < std::ssize(s)
+        && is_identifier_continue(s[j])
+        )
+    {
+        ++j;
+    }
+    return j;
+}
+
+
+//  validate_utf8: returns the offset of the first byte in 's' that does
+//  not begin a well-formed UTF-8 sequence (RFC 3629 - no overlongs, no
+//  surrogates, nothing past U+10FFFF), or -1 if the whole text is valid
+//
+//  Source text is overwhelmingly ASCII even in files with non-ASCII
+//  comments and strings, so where we have SSE2 or NEON we skip whole
+//  16-byte all-ASCII chunks and run the scalar sequence check only
+//  around the multi-byte regions
+//
+auto validate_utf8(std::string_view s)
+    -> ptrdiff_t
+{
+    auto i    = ptrdiff_t{0};
+    auto size = std::ssize(s);
+
+    while (i < size)
+    {
+#if defined(CPP2_USE_SSE2)
+        while (i + 16 <= size)
+        {
+            auto chunk = _mm_loadu_si128( reinterpret_cast<__m128i const*>(s.data() + i) );
+            if (_mm_movemask_epi8( chunk ) != 0) {
+                break;
+            }
+            i += 16;
+        }
+#elif defined(CPP2_USE_NEON)
+        while (i + 16 <= size)
+        {
+            auto chunk = vld1q_u8( reinterpret_cast<uint8_t const*>(s.data() + i) );
+            if (vmaxvq_u8( chunk ) >= 0x80) {
+                break;
+            }
+            i += 16;
+        }
+#endif
+        if (i >= size) {
+            break;
+        }
+
+        auto c = static_cast<unsigned char>(s[i]);
+        if (c < 0x80) {
+            ++i;
+            continue;
+        }
+
+        //  Multi-byte head: its value determines the sequence length and
+        //  the legal range of the second byte (the tightened second-byte
+        //  bounds are what reject overlongs, surrogates, and > U+10FFFF)
+        auto len = 0;
+        auto lo  = 0x80;
+        auto hi  = 0xBF;
+        if      (0xC2 <= c && c <= 0xDF) { len = 2; }
+        else if (c == 0xE0)              { len = 3; lo = 0xA0; }
+        else if (0xE1 <= c && c <= 0xEC) { len = 3; }
+        else if (c == 0xED)              { len = 3; hi = 0x9F; }
+        else if (0xEE <= c && c <= 0xEF) { len = 3; }
+        else if (c == 0xF0)              { len = 4; lo = 0x90; }
+        else if (0xF1 <= c && c <= 0xF3) { len = 4; }
+        else if (c == 0xF4)              { len = 4; hi = 0x8F; }
+        else {
+            //  0x80..0xC1 (stray continuation or overlong head) or 0xF5..0xFF
+            return i;
+        }
+
+        if (i + len > size) {
+            return i;    // truncated sequence at end of text
+        }
+        if (auto b = static_cast<unsigned char>(s[i+1]);
+            b < lo
+            || hi < b
+            )
+        {
+            return i;
+        }
+        for (auto k = 2; k < len; ++k) {
+            if (auto b = static_cast<unsigned char>(s[i+k]);
+                b < 0x80
+                || 0xBF < b
+                )
+            {
+                return i;
+            }
+        }
+        i += len;
+    }
+    return -1;
+}
+
+
 //G identifier:
 //G     '__identifier__' keyword    [Note: without whitespace before the keyword]
 //G     identifier-start
@@ -345,15 +709,7 @@ auto starts_with_identifier(std::string_view s)
     -> int
 {
     if (is_identifier_start(s[0])) {
-        auto j = 1;
-        while (
-            j < std::ssize(s)
-            && is_identifier_continue(s[j])
-            )
-        {
-            ++j;
-        }
-        return j;
+        return scan_identifier_continue(s, 1);
     }
     return 0;
 }
@@ -451,25 +807,9 @@ auto strip_path(std::string const& file)
 }
 
 
-//-----------------------------------------------------------------------
-//
-//  String: A helper workaround for passing a string literal as a
-//  template argument
-//
-//-----------------------------------------------------------------------
-//
-template<std::size_t N>
-struct String
-{
-    constexpr String(const char (&str)[N])
-    {
-        std::copy_n(str, N, value);
-    }
-
-    auto operator<=>(String const&) const = default;
-
-    char value[N] = {};
-};
+//  Note: for passing a string literal as a template argument, use
+//  string_util::fixed_string (cpp2util.h) - the one compile-time
+//  string facility, shared with generated code
 
 
 //-----------------------------------------------------------------------
@@ -540,6 +880,68 @@ auto starts_with(
 }
 
 
+//  short_equal: equality for the short strings the lexer and parser
+//  test constantly - token spellings against keywords, prefixes, and
+//  suffixes. Dispatches on length first (most mismatches end there),
+//  then compares up to 16 bytes with one or two pairs of word-sized
+//  loads instead of a library memcmp call; longer strings fall back to
+//  the standard compare. The overlapping loads read only within
+//  [0, size) of both strings
+//
+inline auto short_equal(
+    std::string_view a,
+    std::string_view b
+)
+    -> bool
+{
+    auto load = []<typename T>(char const* p, T) -> uint64_t {
+        T v;
+        std::memcpy( &v, p, sizeof(T) );
+        return v;
+    };
+
+    auto n = a.size();
+    if (n != b.size()) {
+        return false;
+    }
+    if (n > 16) {
+        return a == b;
+    }
+    if (n >= 8) {
+        return
+            load( a.data()    , uint64_t{} ) == load( b.data()    , uint64_t{} )
+            && load( a.data()+n-8, uint64_t{} ) == load( b.data()+n-8, uint64_t{} );
+    }
+    if (n >= 4) {
+        return
+            load( a.data()    , uint32_t{} ) == load( b.data()    , uint32_t{} )
+            && load( a.data()+n-4, uint32_t{} ) == load( b.data()+n-4, uint32_t{} );
+    }
+    if (n >= 2) {
+        return
+            load( a.data()    , uint16_t{} ) == load( b.data()    , uint16_t{} )
+            && load( a.data()+n-2, uint16_t{} ) == load( b.data()+n-2, uint16_t{} );
+    }
+    return
+        n == 0
+        || a[0] == b[0];
+}
+
+
+//  And the prefix form, for starts_with tests against short literals
+//
+inline auto short_starts_with(
+    std::string_view s,
+    std::string_view prefix
+)
+    -> bool
+{
+    return
+        s.size() >= prefix.size()
+        && short_equal( s.substr(0, prefix.size()), prefix );
+}
+
+
 auto contains(
     auto const& range,
     auto const& value
@@ -629,23 +1031,29 @@ class cmdline_processor
 
     using callback0 = void (*)();
     using callback1 = void (*)(std::string const&);
+
+    //  The name/description/synonym fields are views over the string
+    //  literals passed at registration, so the ~50 static register_flag
+    //  objects cost no allocations or string copies at program startup -
+    //  the help text is only materialized if -help is actually requested
     struct flag
     {
-        int         group = 0;
-        std::string name;
-        int         unique_prefix = 0;
-        std::string description;
-        callback0   handler0;
-        callback1   handler1;
-        std::string synonym;
-        bool        opt_out;
-
-        flag(int g, std::string_view n, std::string_view d, callback0 h0, callback1 h1, std::string_view s, bool o)
-            : group{g}, name{n}, description{d}, handler0{h0}, handler1{h1}, synonym{s}, opt_out{o}
+        int              group = 0;
+        std::string_view name;
+        int              unique_prefix = 0;
+        std::string_view description;
+        callback0        handler0;
+        callback1        handler1;
+        std::string_view synonym;
+        std::string_view synonym2;
+        bool             opt_out;
+
+        flag(int g, std::string_view n, std::string_view d, callback0 h0, callback1 h1, std::string_view s, std::string_view s2, bool o)
+            : group{g}, name{n}, description{d}, handler0{h0}, handler1{h1}, synonym{s}, synonym2{s2}, opt_out{o}
         { }
 
         auto get_name(bool indicate_short_name = false) const {
-            auto n = name.substr(0, unique_prefix);
+            auto n = std::string{name.substr(0, unique_prefix)};
             if (unique_prefix < std::ssize(name)) {
                 auto name_length = _as<int>(std::min(name.find(' '), name.size()));
                 if (indicate_short_name) {
@@ -663,12 +1071,17 @@ class cmdline_processor
     std::vector<flag> flags;
     int max_flag_length = 0;
 
-    std::unordered_map<int, std::string> labels = {
-        { 2, "Additional dynamic safety check controls" },
-        { 4, "Support for constrained target environments" },
-        { 8, "Cpp1 file content options" },
-        { 9, "Cppfront output options" }
-    };
+    static auto group_label(int group)
+        -> std::string_view
+    {
+        switch (group) {
+        break;case 2: return "Additional dynamic safety check controls";
+        break;case 4: return "Support for constrained target environments";
+        break;case 8: return "Cpp1 file content options";
+        break;case 9: return "Cppfront output options";
+        break;default: return {};
+        }
+    }
 
     static auto print(std::string_view s, int width = 0)
         -> void
@@ -747,10 +1160,21 @@ public:
                 }
 
                 //  Allow a switch to start with either - or /
-                if (arg->text.starts_with("-" + flag.name.substr(0, length_to_match))
-                    || arg->text.starts_with("/" + flag.name.substr(0, length_to_match))
-                    || arg->text == "-" + flag.synonym
-                    || arg->text == "/" + flag.synonym
+                auto text = std::string_view{arg->text};
+                if (
+                    (
+                        (text.starts_with('-') || text.starts_with('/'))
+                        && text.substr(1).starts_with(flag.name.substr(0, _as<std::size_t>(length_to_match)))
+                    )
+                    || arg->text == "-" + std::string{flag.synonym}
+                    || arg->text == "/" + std::string{flag.synonym}
+                    || (
+                        !flag.synonym2.empty()
+                        && (
+                            arg->text == "-" + std::string{flag.synonym2}
+                            || arg->text == "/" + std::string{flag.synonym2}
+                            )
+                        )
                     )
                 {
                     assert(flag.handler0 || flag.handler1);
@@ -812,8 +1236,8 @@ public:
             if (last_group != flag.group) {
                 print("\n");
                 last_group = flag.group;
-                if (!labels[flag.group].empty()) {
-                    print( labels[flag.group] + "\n");
+                if (auto label = group_label(flag.group); !label.empty()) {
+                    print( std::string{label} + "\n");
                 }
             }
             print("  -");
@@ -822,7 +1246,12 @@ public:
                 n += "[-]";
             }
             if (!flag.synonym.empty()) {
-                n += ", -" + flag.synonym;
+                n += ", -";
+                n += flag.synonym;
+            }
+            if (!flag.synonym2.empty()) {
+                n += ", -";
+                n += flag.synonym2;
             }
             print(n, max_flag_length + 3);
             print(flag.description);
@@ -837,11 +1266,12 @@ public:
         callback0        handler0,
         callback1        handler1,
         std::string_view synonym,
+        std::string_view synonym2,
         bool             opt_out
     )
         -> void
     {
-        flags.emplace_back( group, name, description, handler0, handler1, synonym, opt_out );
+        flags.emplace_back( group, name, description, handler0, handler1, synonym, synonym2, opt_out );
         auto length = std::ssize(name);
         if (opt_out) { length += 3; }   // space to print "[-]"
         if (max_flag_length < length) {
@@ -856,6 +1286,7 @@ public:
             callback0        handler0,
             callback1        handler1 = {},
             std::string_view synonym  = {},
+            std::string_view synonym2 = {},
             bool             opt_out  = false
         );
     };
@@ -925,10 +1356,11 @@ cmdline_processor::register_flag::register_flag(
     callback0        handler0,
     callback1        handler1,
     std::string_view synonym,
+    std::string_view synonym2,
     bool             opt_out
 )
 {
-    cmdline.add_flag( group, name, description, handler0, handler1, synonym, opt_out );
+    cmdline.add_flag( group, name, description, handler0, handler1, synonym, synonym2, opt_out );
 }
 
 static cmdline_processor::register_flag cmd_help   (
@@ -937,7 +1369,9 @@ static cmdline_processor::register_flag cmd_help   (
     "Print help",
     []{ cmdline.print_help(); },
     nullptr,
-    "?"
+    "?",
+    "h"     //  keep the familiar -h spelling exact, now that other
+            //  flags starting with 'h' make the prefix ambiguous
 );
 
 static cmdline_processor::register_flag cmd_version(
@@ -970,12 +1404,40 @@ static cmdline_processor::register_flag cmd_internal_debug(
     []{ flag_internal_debug = true; flag_verbose = true; }
 );
 
+static auto flag_max_regex_expansion = 0LL;    // in KB, 0 == no limit
+static cmdline_processor::register_flag cmd_max_regex_expansion(
+    9,
+    "max-regex-expansion KB",
+    "Fail a @regex/@regex_set pattern whose generated matcher exceeds this many KB, instead of expanding it in full (default: no limit)",
+    nullptr,
+    [](std::string const& arg) { flag_max_regex_expansion = std::atoll(arg.c_str()); }
+);
+
+static auto flag_stable_names = false;
+static cmdline_processor::register_flag cmd_stable_names(
+    9,
+    "stable-names",
+    "Derive generated global names from a short hash of file and position instead of sequential ordinals, so edits don't renumber the names after them",
+    []{ flag_stable_names = true; }
+);
+
 static auto flag_print_colon_errors = false;
 static cmdline_processor::register_flag cmd_print_colon_errors(
     9,
     "format-colon-errors",
     "Emit ':line:col:' format for messages - lights up some tools",
-    []{ flag_print_colon_errors = true; }
+    []{ flag_print_colon_errors = true; },
+    nullptr,
+    "fo"    //  -fold-* (and -function-heat, -fsync-output) made the
+            //  'fo' prefix ambiguous, so keep that spelling exact
+);
+
+static auto flag_json_errors = false;
+static cmdline_processor::register_flag cmd_json_errors(
+    9,
+    "format-json-errors",
+    "Emit messages as JSON lines, one object per diagnostic, for tool consumption",
+    []{ flag_json_errors = true; }
 );
 
 
@@ -989,17 +1451,39 @@ struct error_entry
 {
     source_position where;
     std::string     msg;
+    std::string_view at = {};           // optional "(at 'token')" suffix - a view into
+                                        // token text, materialized only when printed
     bool            internal = false;
     bool            fallback = false;   // only emit this message if there was nothing better
+    bool            suppressed = false; // a position-only note recorded past the
+                                        // -diagnostic-budget, printed only as a count
+
+    error_entry(
+        source_position  w,
+        std::string_view m,
+        bool             i = false,
+        bool             f = false
+    )
+        : where{w}
+        , msg{m}
+        , internal{i}
+        , fallback{f}
+    { }
 
+    //  Deferred-suffix form: instead of eagerly concatenating the offending
+    //  token's text into msg, remember a view of it - messages that are never
+    //  printed (e.g., suppressed fallbacks) then never build the suffix
+    //
     error_entry(
         source_position  w,
         std::string_view m,
+        std::string_view at_token,
         bool             i = false,
         bool             f = false
     )
         : where{w}
         , msg{m}
+        , at{at_token}
         , internal{i}
         , fallback{f}
     { }
@@ -1010,12 +1494,17 @@ struct error_entry
         return
             where == that.where
             && msg == that.msg
+            && at == that.at
             ;
     }
 
     auto print(auto& o, std::string const& file) const
         -> void
     {
+        if (flag_json_errors) {
+            print_json(o, file);
+            return;
+        }
         o << file ;
         if (where.lineno > 0) {
             if (flag_print_colon_errors) {
@@ -1036,7 +1525,52 @@ struct error_entry
         if (internal) {
             o << " internal compiler";
         }
-        o << " error: " << msg << "\n";
+        o << " error: " << msg;
+        if (!at.empty()) {
+            o << " (at '" << at << "')";
+        }
+        o << "\n";
+    }
+
+    //  One JSON object per line, for -format-json-errors: the message
+    //  text is the same as the human format, 'at' is the offending
+    //  token when one was recorded, and readers should ignore keys
+    //  they don't know so we can add some later
+    auto print_json(auto& o, std::string const& file) const
+        -> void
+    {
+        auto escape = [](std::string_view s) {
+            auto ret = std::string{};
+            for (auto c : s) {
+                switch (c) {
+                break;case '"':  ret += "\\\"";
+                break;case '\\': ret += "\\\\";
+                break;case '\n': ret += "\\n";
+                break;case '\t': ret += "\\t";
+                break;default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        constexpr auto hex = "0123456789abcdef";
+                        ret += "\\u00";
+                        ret += hex[(c >> 4) & 0xf];
+                        ret += hex[c & 0xf];
+                    }
+                    else {
+                        ret += c;
+                    }
+                }
+            }
+            return ret;
+        };
+
+        o   << "{\"file\":\""   << escape(file) << "\""
+            << ",\"line\":"     << where.lineno
+            << ",\"col\":"      << where.colno
+            << ",\"internal\":" << (internal ? "true" : "false")
+            << ",\"msg\":\""    << escape(msg) << "\"";
+        if (!at.empty()) {
+            o << ",\"at\":\"" << escape(at) << "\"";
+        }
+        o << "}\n";
     }
 
 };
@@ -1044,170 +1578,1334 @@ struct error_entry
 
 //-----------------------------------------------------------------------
 //
-//  stable_vector: a simple segmented vector with limited interface
-//                 that doesn't invalidate by moving memory
+//  diagnostics_pool: reusable backing storage for a compile's diagnostics
+//
+//  A resident process (-daemon, -watch) builds one errors vector per
+//  request, and letting each request grow a fresh vector from zero
+//  churns the heap for hours on end. Recycling the one warmed allocation
+//  instead keeps the steady state allocation-stable: after the largest
+//  request seen so far, later requests allocate nothing here. The
+//  high-water numbers are reported by -stats
 //
 //-----------------------------------------------------------------------
 //
-template <typename T>
-class stable_vector
+class diagnostics_pool
 {
-    static constexpr size_t PageSize = 1'000;
-
-    std::vector< std::vector<T> > data;
-
-    auto add_segment( std::initializer_list<T> init = {} ) -> void {
-        data.push_back( init );
-        data.back().reserve(PageSize);
-    }
+    std::vector<error_entry> spare;
+    size_t high_water_count    = 0;
+    size_t high_water_capacity = 0;
 
 public:
-    stable_vector( std::initializer_list<T> init = {}) {
-        add_segment( init);
+    //  Empty, but carrying the capacity of the largest release()d
+    //  vector - so only the first request (and any record-setting
+    //  one after it) pays for growth
+    //
+    auto acquire()
+        -> std::vector<error_entry>
+    {
+        return std::move(spare);
     }
 
-    auto empty() const -> bool {
-        return data.size() == 1 && data.back().empty();
+    auto release(std::vector<error_entry>&& v)
+        -> void
+    {
+        high_water_count    = std::max( high_water_count,    v.size()     );
+        high_water_capacity = std::max( high_water_capacity, v.capacity() );
+        spare = std::move(v);
+        spare.clear();
     }
 
-    auto size() const -> size_t {
-        testing.enforce(!data.empty());
-        return (data.size() - 1) * PageSize + data.back().size();
+    auto get_high_water_count() const
+        -> size_t
+    {
+        return high_water_count;
     }
 
-    auto ssize() const -> ptrdiff_t {
-        return unchecked_narrow<ptrdiff_t>(size());
+    auto get_high_water_capacity() const
+        -> size_t
+    {
+        return high_water_capacity;
     }
+};
 
-    auto operator[](size_t idx) -> T& {
-        bounds_safety.enforce(idx < size());
-        return data[idx / PageSize][idx % PageSize];
-    }
+static thread_local auto the_diagnostics_pool = diagnostics_pool{};     // thread_local: see -jobs
 
-    auto operator[](size_t idx) const -> T const& {
-        bounds_safety.enforce(idx < size());
-        return data[idx / PageSize][idx % PageSize];
-    }
 
-    auto back() -> T& {
-        return data.back().back();
-    }
+//-----------------------------------------------------------------------
+//
+//  diagnostics_sink: a thread-safe collector of error_entry for the
+//  phases that run work items on worker threads (see -parallel-sema)
+//
+//  Producers report entries stamped with a sequencing token - the work
+//  item's position in the sequential processing order. Each entry
+//  already carries its source position, so after all producers finish,
+//  seal() re-sorts canonically by token (keeping each work item's own
+//  emission order) and the single consumer takes the entries back out
+//  in exactly the order the sequential analysis would have produced.
+//
+//  Producers land on a shard by thread id, so concurrent reporters
+//  rarely share a lock, and a shard's buffer keeps its capacity across
+//  reports - reporting allocates nothing once a shard is warm
+//
+//-----------------------------------------------------------------------
+//
+class diagnostics_sink
+{
+    struct sequenced_entry {
+        long long   seq;
+        error_entry e;
+    };
 
-    auto push_back(T const& t) -> void {
+    static constexpr auto shard_count = size_t{8};
+    struct shard {
+        std::mutex                   m;
+        std::vector<sequenced_entry> entries;
+    };
+    std::array<shard, shard_count>   shards;
+
+    std::vector<sequenced_entry>     sealed;
+    size_t                           next_take = 0;
+
+public:
+    //  Thread-safe: report one diagnostic under sequencing token 'seq'
+    //
+    auto report(long long seq, error_entry e)
+        -> void
+    {
+        auto& s =
+            shards[ std::hash<std::thread::id>{}(std::this_thread::get_id()) % shard_count ];
+        auto lock = std::lock_guard{s.m};
+        s.entries.push_back({ seq, std::move(e) });
+    }
+
+    //  Single-consumer, after all producers have finished: gather the
+    //  shards and fix the canonical order. A work item's entries all come
+    //  from one thread in emission order, so the stable sort by token
+    //  reproduces the sequential processing order exactly
+    //
+    auto seal()
+        -> void
+    {
+        sealed.clear();
+        next_take = 0;
+        for (auto& s : shards) {
+            sealed.insert(
+                sealed.end(),
+                std::make_move_iterator(s.entries.begin()),
+                std::make_move_iterator(s.entries.end())
+            );
+            s.entries.clear();
+        }
+        std::stable_sort(
+            sealed.begin(), sealed.end(),
+            [](auto const& a, auto const& b) { return a.seq < b.seq; }
+        );
+    }
+
+    //  Append the sealed entries for token 'seq' to 'out' - the consumer
+    //  asks for tokens in nondecreasing order, interleaving them with its
+    //  own sequential diagnostics
+    //
+    auto take(long long seq, std::vector<error_entry>& out)
+        -> void
+    {
+        while (
+            next_take < sealed.size()
+            && sealed[next_take].seq <= seq
+            )
+        {
+            assert(
+                sealed[next_take].seq == seq
+                && "ICE: diagnostics_sink tokens must be taken in nondecreasing order"
+            );
+            out.push_back( std::move(sealed[next_take].e) );
+            ++next_take;
+        }
+    }
+
+    //  Append everything sealed and not yet taken
+    //
+    auto drain(std::vector<error_entry>& out)
+        -> void
+    {
+        while (next_take < sealed.size()) {
+            out.push_back( std::move(sealed[next_take].e) );
+            ++next_take;
+        }
+    }
+};
+
+
+//-----------------------------------------------------------------------
+//
+//  heapinstr: heap instrumentation, a sibling of stackinstr
+//
+//  The arena allocators report their traffic here so that -verbose can
+//  show per-category allocation counts and bytes, per-node-size totals
+//  (a close proxy for per-node-type, since node types differ in size),
+//  and the arenas' live high-water mark - the numbers we otherwise have
+//  to run under an external heap profiler to get
+//
+//-----------------------------------------------------------------------
+//
+class heapinstr
+{
+    struct totals {
+        long long count = 0;
+        long long bytes = 0;
+    };
+
+    static thread_local std::map<std::string_view, totals> categories;      // thread_local: see -jobs
+    static thread_local std::map<size_t, long long>        node_sizes;      // thread_local: see -jobs
+    static thread_local long long                          live_bytes;      // thread_local: see -jobs
+    static thread_local long long                          high_water;      // thread_local: see -jobs
+
+public:
+    //  Record one allocation in the named category
+    //
+    static auto record(
+        std::string_view category,
+        size_t           bytes
+    )
+        -> void
+    {
+        auto& t = categories[category];
+        ++t.count;
+        t.bytes += static_cast<long long>(bytes);
+    }
+
+    //  Record one AST node allocation, bucketed by size
+    //
+    static auto record_node(size_t bytes)
+        -> void
+    {
+        record( "AST nodes", bytes );
+        ++node_sizes[bytes];
+    }
+
+    //  Record a backing chunk coming or going, for the high-water mark
+    //
+    static auto record_chunk(
+        std::string_view category,
+        size_t           bytes
+    )
+        -> void
+    {
+        record( category, bytes );
+        live_bytes += static_cast<long long>(bytes);
+        high_water  = std::max( high_water, live_bytes );
+    }
+
+    static auto release_chunks(long long bytes)
+        -> void
+    {
+        live_bytes -= bytes;
+    }
+
+    //  Reset all counters - called at the start of each file's compile
+    //  so -verbose reports per-file numbers
+    //
+    static auto reset()
+        -> void
+    {
+        categories.clear();
+        node_sizes.clear();
+        live_bytes = 0;
+        high_water = 0;
+    }
+
+    static auto print(std::ostream& o)
+        -> void
+    {
+        o << "\n   Heap  " << print_with_thousands(high_water)
+          << " bytes arena high water";
+        for (auto const& [name, t] : categories) {
+            o << "\n         " << print_with_thousands(t.bytes)
+              << " bytes in " << print_with_thousands(t.count)
+              << " " << name;
+        }
+        for (auto const& [size, n] : node_sizes) {
+            o << "\n         " << print_with_thousands(n)
+              << " AST nodes of size " << size;
+        }
+    }
+};
+
+thread_local std::map<std::string_view, heapinstr::totals> heapinstr::categories;
+thread_local std::map<size_t, long long>                   heapinstr::node_sizes;
+thread_local long long                                     heapinstr::live_bytes = 0;
+thread_local long long                                     heapinstr::high_water = 0;
+
+
+//-----------------------------------------------------------------------
+//
+//  arena_registry: per-arena observability
+//
+//  heapinstr above aggregates allocation traffic by category for
+//  -verbose; this registry keeps one entry per arena with the numbers
+//  a CI benchmark watches across runs - the bytes and backing blocks
+//  the arena currently holds, how many times it has been reset, and
+//  the high-water marks of both - reported through the -stats channel.
+//  Entries live as long as their (thread_local) arenas and keep
+//  counting across the files a resident process compiles, so a held
+//  block that should have been released shows up as a bytes/blocks
+//  number that only ever grows
+//
+//-----------------------------------------------------------------------
+//
+
+//  Debug aid: on every arena reset, overwrite the arena's memory with
+//  a recognizable byte pattern before it is pooled or freed, so a
+//  stale pointer into the previous compile's nodes fails loudly
+//  instead of silently reading recycled memory
+static auto flag_poison_arenas = false;
+static cmdline_processor::register_flag cmd_poison_arenas(
+    9,
+    "poison-arenas",
+    "Debug: overwrite arena memory with 0xDD on every arena reset, so stale pointers into a previous compile fail loudly",
+    []{ flag_poison_arenas = true; }
+);
+
+//  On a catastrophically broken file (e.g., a bad merge) the detailed
+//  diagnostics stop being useful long before they stop being produced.
+//  Past the budget, errors are recorded as position-only notes without
+//  building messages, and phases that could only add more diagnostics
+//  are skipped, while parsing still resynchronizes the rest of the file
+static auto flag_diagnostic_budget = 0;
+static cmdline_processor::register_flag cmd_diagnostic_budget(
+    9,
+    "diagnostic-budget N",
+    "After N errors, record further errors as position-only notes reported only as a count, and skip the phases that could only add more (0 == no budget)",
+    nullptr,
+    [](std::string const& n) { flag_diagnostic_budget = std::max( 0, atoi(n.c_str()) ); }
+);
+
+//  For API extraction (docs, stubs, indexing): skip function bodies
+//  with fast brace matching instead of parsing them, and emit the
+//  type definitions and function declarations only
+static auto flag_interface_only = false;
+static cmdline_processor::register_flag cmd_interface_only(
+    9,
+    "interface-only",
+    "Emit type definitions and function declarations only, skipping function bodies unparsed - the output is an API surface, not a complete translation unit",
+    []{ flag_interface_only = true; }
+);
+
+//  Whether the diagnostic budget (if any) is spent
+inline auto diagnostic_budget_spent(std::vector<error_entry> const& errors)
+    -> bool
+{
+    return
+        flag_diagnostic_budget > 0
+        && std::ssize(errors) >= flag_diagnostic_budget
+        ;
+}
+
+class arena_registry
+{
+public:
+    struct entry {
+        std::string_view name;
+        long long        bytes       = 0;   // bytes currently held in backing blocks
+        long long        blocks      = 0;   // backing blocks currently held
+        long long        resets      = 0;   // times the arena was reset or destroyed
+        long long        bytes_high  = 0;
+        long long        blocks_high = 0;
+
+        auto add_block(long long b)
+            -> void
+        {
+            bytes      += b;
+            ++blocks;
+            bytes_high  = std::max( bytes_high, bytes );
+            blocks_high = std::max( blocks_high, blocks );
+        }
+
+        auto drop_block(long long b)
+            -> void
+        {
+            bytes -= b;
+            --blocks;
+        }
+
+        auto note_reset()
+            -> void
+        {
+            ++resets;
+        }
+    };
+
+    //  Register an arena - the returned reference stays valid for the
+    //  thread's lifetime (entries are stored in a list, not a vector)
+    //
+    static auto add(std::string_view name)
+        -> entry&
+    {
+        entries.push_back({ name });
+        return entries.back();
+    }
+
+    //  Write all entries as one JSON array - see emit_stats
+    //
+    static auto print_json(std::ostream& o)
+        -> void
+    {
+        o << "[";
+        for (auto first = true; auto const& e : entries) {
+            if (!first) { o << ","; }
+            first = false;
+            o << "{\"name\":\"" << e.name << "\""
+              << ",\"bytes\":"             << e.bytes
+              << ",\"blocks\":"            << e.blocks
+              << ",\"resets\":"            << e.resets
+              << ",\"bytes_high_water\":"  << e.bytes_high
+              << ",\"blocks_high_water\":" << e.blocks_high
+              << "}";
+        }
+        o << "]";
+    }
+
+private:
+    static thread_local std::list<entry> entries;   // thread_local: see -jobs
+};
+
+thread_local std::list<arena_registry::entry> arena_registry::entries;
+
+
+//-----------------------------------------------------------------------
+//
+//  stable_vector: a simple segmented vector with limited interface
+//                 that doesn't invalidate by moving memory
+//
+//  PageSize is the fixed per-segment element count - tune it down for
+//  containers that are usually small, so they don't reserve a full
+//  default-geometry page up front
+//
+//-----------------------------------------------------------------------
+//
+//  Defined after phase_profiler below - timestamps container page
+//  allocations in the profiling trace, so mid-compile allocation
+//  latency can be audited in phase context
+auto note_page_allocation(std::string_view category, long long bytes) -> void;
+
+//  Hint the CPU to start fetching an address we know we'll visit next,
+//  so the fetch overlaps with useful work instead of stalling a later
+//  dependent load - a no-op where no intrinsic is available
+//
+inline auto prefetch_hint(void const* p)
+    -> void
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+}
+
+template <typename T, size_t PageSize = 1'000>
+class stable_vector
+{
+    std::vector< std::vector<T> > data;
+
+    //  Warm pool of already-reserved pages, shared by all stable_vectors
+    //  of this T on the thread and refilled by ~stable_vector: a resident
+    //  process (-daemon, -watch) then reuses page capacity across
+    //  compiles instead of growing every container from zero
+    //
+    //  The 'alive' flag is a separate trivially-destructible thread_local:
+    //  thread_local stable_vectors (e.g. the generated-code lexers) can be
+    //  destroyed after the pool itself during TLS teardown, and their
+    //  destructors must not touch the dead pool
+    //
+    struct page_pool {
+        static constexpr size_t     cap = 64;
+        std::vector<std::vector<T>> pages;
+        inline static thread_local bool alive = true;
+        ~page_pool() { alive = false; }
+    };
+    inline static thread_local page_pool spare_pages = {};
+
+    auto add_segment( std::initializer_list<T> init = {} ) -> void {
+        if (
+            init.size() == 0              // pooled pages arrive empty, and 'assign'
+            && page_pool::alive           // would require copy-assignable elements
+            && !spare_pages.pages.empty()
+            )
+        {
+            data.push_back( std::move(spare_pages.pages.back()) );
+            spare_pages.pages.pop_back();
+        }
+        else {
+            data.emplace_back();
+            data.back().reserve(PageSize);
+            //  Only instantiate the element copies for copyable T, so
+            //  move-only element types still work (with empty inits)
+            if constexpr (std::is_copy_constructible_v<T>) {
+                data.back().insert( data.back().end(), init.begin(), init.end() );
+            }
+            else {
+                assert( init.size() == 0 );
+            }
+            heapinstr::record( "stable_vector pages", PageSize * sizeof(T) );
+            note_page_allocation( "stable_vector page", static_cast<long long>(PageSize * sizeof(T)) );
+        }
+    }
+
+public:
+    stable_vector( std::initializer_list<T> init = {}) {
+        add_segment( init);
+    }
+
+    ~stable_vector() {
+        if (!page_pool::alive) {
+            return;
+        }
+        for (auto& page : data) {
+            if (
+                page.capacity() == PageSize
+                && spare_pages.pages.size() < page_pool::cap
+                )
+            {
+                page.clear();
+                spare_pages.pages.push_back( std::move(page) );
+            }
+        }
+    }
+
+    auto empty() const -> bool {
+        return data.size() == 1 && data.back().empty();
+    }
+
+    auto size() const -> size_t {
+        testing.enforce(!data.empty());
+        return (data.size() - 1) * PageSize + data.back().size();
+    }
+
+    auto ssize() const -> ptrdiff_t {
+        return unchecked_narrow<ptrdiff_t>(size());
+    }
+
+    auto operator[](size_t idx) -> T& {
+        bounds_safety.enforce(idx < size());
+        return data[idx / PageSize][idx % PageSize];
+    }
+
+    auto operator[](size_t idx) const -> T const& {
+        bounds_safety.enforce(idx < size());
+        return data[idx / PageSize][idx % PageSize];
+    }
+
+    auto back() -> T& {
+        return data.back().back();
+    }
+
+    auto push_back(T const& t) -> void {
         if (data.back().size() == data.back().capacity()) {
             add_segment();
         }
-        data.back().push_back(t);
+        data.back().push_back(t);
+    }
+
+    template< class... Args >
+    auto emplace_back( Args&&... args ) -> T& {
+        if (data.back().size() == data.back().capacity()) {
+            add_segment();
+        }
+        return data.back().emplace_back(CPP2_FORWARD(args)...);
+    }
+
+    //  Pre-reserve the page spine for an expected element count, so bulk
+    //  fills don't regrow it - the pages themselves are already reserved
+    //  in full as they are added
+    //
+    auto reserve(size_t n) -> void {
+        data.reserve( n / PageSize + 1 );
+    }
+
+    //  Visit the elements one contiguous page at a time, so whole-container
+    //  passes can run over plain spans instead of bouncing through the
+    //  per-element segment indirection
+    //
+    //  The page transition is the only dependent load in a bulk pass,
+    //  so start fetching the next page's elements while this page is
+    //  still being visited
+    //
+    auto for_each_chunk(auto&& f) -> void {
+        for (auto i = size_t{0}; i < data.size(); ++i) {
+            if (i + 1 < data.size()) {
+                prefetch_hint( data[i + 1].data() );
+            }
+            if (!data[i].empty()) {
+                f( std::span<T>{data[i]} );
+            }
+        }
+    }
+
+    auto for_each_chunk(auto&& f) const -> void {
+        for (auto i = size_t{0}; i < data.size(); ++i) {
+            if (i + 1 < data.size()) {
+                prefetch_hint( data[i + 1].data() );
+            }
+            if (!data[i].empty()) {
+                f( std::span<T const>{data[i]} );
+            }
+        }
+    }
+
+    auto pop_back() -> void {
+        bounds_safety.enforce(size() > 0);
+        if (
+            data.back().empty()
+            && data.size() > 1
+            )
+        {
+            data.pop_back();
+        }
+        data.back().pop_back();
+    }
+
+    //-------------------------------------------------------------------
+    //  Debug interface
+    //
+    auto debug_print(std::ostream& o) const
+        -> void
+    {
+        o << "stable_vector:\n";
+        for (auto i = 0; auto& chunk : data) {
+            o << "  -- page " << i++ << " --\n    ";
+            for (auto e : chunk) {
+                o << e << ' ';
+            }
+            o << "\n";
+        }
+    }
+
+    //-------------------------------------------------------------------
+    //  Iterator interface
+    //
+    class iterator {
+        stable_vector* v;
+        size_t         pos = 0;
+    public:
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::random_access_iterator_tag;
+
+        iterator( stable_vector* v_ = nullptr, size_t pos_ = 0) : v{v_}, pos{pos_} { }
+        auto operator++ ()           -> iterator { if (pos < v->size()) { ++pos; } return *this; }
+        auto operator-- ()           -> iterator { if (pos > 0        ) { --pos; } return *this; }
+        auto operator+= (size_t off) -> iterator { if (pos + off < v->size()) { pos += off; } else { pos = v->size(); } return *this; }
+        auto operator-= (size_t off) -> iterator { if (pos - off > 0        ) { pos -= off; } else { pos = 0;         } return *this; }
+        auto operator*  () const     -> T&       { return  (*v)[pos      ]; }
+        auto operator-> () const     -> T*       { return &(*v)[pos      ]; }
+        auto operator[] (size_t off) -> T&       { return  (*v)[pos + off]; }
+        auto operator+  (size_t off) -> iterator { auto i = *this; i += off; return i; }
+        auto operator-  (size_t off) -> iterator { auto i = *this; i -= off; return i; }
+        auto operator-  (iterator const& that)   -> ptrdiff_t { return pos - that.pos; }
+        auto operator<=>(iterator const&) const  -> std::strong_ordering = default;
+    };
+
+    class const_iterator {
+        stable_vector const* v;
+        size_t               pos = 0;
+    public:
+        using value_type        = const T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T const*;
+        using reference         = T const&;
+        using iterator_category = std::random_access_iterator_tag;
+
+        const_iterator( stable_vector const* v_ = nullptr, size_t pos_ = 0) : v{v_}, pos{pos_} { }
+        auto operator++ ()           -> const_iterator { if (pos < v->size()) { ++pos; } return *this; }
+        auto operator-- ()           -> const_iterator { if (pos > 0        ) { --pos; } return *this; }
+        auto operator+= (size_t off) -> const_iterator { if (pos + off < v->size()) { pos += off; } else { pos = v->size(); } return *this; }
+        auto operator-= (size_t off) -> const_iterator { if (pos - off > 0        ) { pos -= off; } else { pos = 0;         } return *this; }
+        auto operator*  () const     -> T const&       { return  (*v)[pos      ]; }
+        auto operator-> () const     -> T const*       { return &(*v)[pos      ]; }
+        auto operator[] (size_t off) -> T const&       { return  (*v)[pos + off]; }
+        auto operator+  (size_t off) -> const_iterator { auto i = *this; i += off; return i; }
+        auto operator-  (size_t off) -> const_iterator { auto i = *this; i -= off; return i; }
+        auto operator-  (const_iterator const& that)   -> ptrdiff_t { return pos - that.pos; }
+        auto operator<=>(const_iterator const&) const  -> std::strong_ordering = default;
+    };
+
+    auto  begin()       -> iterator       { return {this, 0     }; }
+    auto  end  ()       -> iterator       { return {this, size()}; }
+    auto  begin() const -> const_iterator { return {this, 0     }; }
+    auto  end  () const -> const_iterator { return {this, size()}; }
+    auto cbegin() const -> const_iterator { return {this, 0     }; }
+    auto cend  () const -> const_iterator { return {this, size()}; }
+};
+
+template <typename T, size_t PageSize>
+auto operator+ (size_t off, typename stable_vector<T, PageSize>::iterator const& it) -> typename stable_vector<T, PageSize>::iterator { auto i = it; i += off; return i; }
+
+template <typename T, size_t PageSize>
+auto operator+ (size_t off, typename stable_vector<T, PageSize>::const_iterator const& it) -> typename stable_vector<T, PageSize>::const_iterator { auto i = it; i += off; return i; }
+
+
+//-----------------------------------------------------------------------
+//
+//  artifact_codec: dependency-free LZ compression for generated
+//  artifacts - the backend behind -emit-compressed and -decompress
+//
+//  Generated files open with the same runtime prolog and repeat the
+//  same lowering boilerplate, so matching against a fixed dictionary
+//  of that boilerplate plus a sliding window over the file itself
+//  recovers most of the redundancy without an external compression
+//  library. The dictionary ships inside the cppfront binary, so an
+//  artifact only round-trips through the same cppfront version - the
+//  right coupling for a remote cache keyed on the compiler version
+//
+//  Format: "CZA1" magic, the uncompressed size in decimal plus '\n',
+//  then control-byte groups of eight tokens - a set bit is a match
+//  (2-byte little-endian distance back into dictionary-plus-output,
+//  then 1-byte length minus 4), a clear bit is one literal byte
+//
+//-----------------------------------------------------------------------
+//
+class artifact_codec
+{
+    static constexpr auto min_match    = size_t{4};
+    static constexpr auto max_match    = size_t{259};
+    static constexpr auto max_distance = size_t{65535};
+    static constexpr auto table_size   = size_t{1} << 15;
+
+    static auto hash_at(std::string_view v, size_t pos)
+        -> size_t
+    {
+        auto key = uint32_t{0};
+        std::memcpy( &key, v.data() + pos, 4 );
+        return (key * 2654435761u) >> 17 & (table_size - 1);
+    }
+
+public:
+    //  The boilerplate common to all generated outputs: the phase
+    //  banners, the runtime prolog, and the most frequent lowered
+    //  spellings
+    static auto dictionary()
+        -> std::string_view
+    {
+        return
+            "\n//=== Cpp2 type declarations ====================================================\n\n"
+            "\n//=== Cpp2 type definitions and function declarations ===========================\n\n"
+            "\n//=== Cpp2 function definitions =================================================\n\n"
+            "#define CPP2_NO_ARGS             Yes\n"
+            "#define CPP2_NO_STRING_DISPATCH  Yes\n"
+            "#include \"cpp2util.h\"\n"
+            "#undef  CPP2_NO_ARGS\n"
+            "#undef  CPP2_NO_STRING_DISPATCH\n"
+            "#define CPP2_USE_MODULES         Yes\n"
+            "#include <iostream>\n"
+            "#include <string>\n"
+            "#include <vector>\n"
+            "cpp2::impl::in<std::string_view> "
+            "cpp2::impl::in<int> "
+            "cpp2::impl::out<"
+            "cpp2::impl::as_<"
+            "cpp2::impl::assert_in_bounds("
+            "cpp2::impl::assert_not_null("
+            "cpp2::interp("
+            "cpp2::to_string("
+            "cpp2::move("
+            "[[nodiscard]] auto "
+            "auto main() -> int"
+            "public: "
+            "private: "
+            "static_cast<"
+            "std::string"
+            " -> void"
+            " -> int"
+            "return "
+            "#line "
+            ;
+    }
+
+    static auto compress(std::string_view text)
+        -> std::string
+    {
+        auto dict = dictionary();
+        auto v    = std::string{dict};
+        v += text;
+
+        auto out = std::string{"CZA1"};
+        out += std::to_string( text.size() );
+        out += '\n';
+
+        //  Most recent position of each hashed 4-byte key, over the
+        //  virtual stream of dictionary + input
+        auto table = std::vector<size_t>( table_size, std::string::npos );
+        for (auto pos = size_t{0}; pos + min_match <= dict.size(); ++pos) {
+            table[ hash_at(v, pos) ] = pos;
+        }
+
+        auto ctrl  = std::string::npos;
+        auto nbits = 0;
+        auto begin_token = [&](bool is_match) {
+            if (
+                ctrl == std::string::npos
+                || nbits == 8
+                )
+            {
+                ctrl  = out.size();
+                nbits = 0;
+                out.push_back( '\0' );
+            }
+            if (is_match) {
+                out[ctrl] |= static_cast<char>( 1u << nbits );
+            }
+            ++nbits;
+        };
+
+        for (auto pos = dict.size(); pos < v.size(); )
+        {
+            auto match_pos = std::string::npos;
+            if (pos + min_match <= v.size()) {
+                auto slot = hash_at(v, pos);
+                auto cand = table[slot];
+                if (
+                    cand != std::string::npos
+                    && pos - cand <= max_distance
+                    && std::memcmp( v.data() + cand, v.data() + pos, min_match ) == 0
+                    )
+                {
+                    match_pos = cand;
+                }
+                table[slot] = pos;
+            }
+
+            if (match_pos == std::string::npos) {
+                begin_token( false );
+                out.push_back( v[pos] );
+                ++pos;
+                continue;
+            }
+
+            auto limit = std::min( max_match, v.size() - pos );
+            auto len   = min_match;
+            while (
+                len < limit
+                && v[match_pos + len] == v[pos + len]
+                )
+            {
+                ++len;
+            }
+
+            begin_token( true );
+            auto distance = pos - match_pos;
+            out.push_back( static_cast<char>(distance       & 0xFF) );
+            out.push_back( static_cast<char>(distance >>  8 & 0xFF) );
+            out.push_back( static_cast<char>(len - min_match) );
+
+            //  Keep the skipped positions findable for later matches
+            for (auto k = pos + 1; k < pos + len && k + min_match <= v.size(); ++k) {
+                table[ hash_at(v, k) ] = k;
+            }
+            pos += len;
+        }
+
+        return out;
+    }
+
+    //  Returns nothing if 'packed' is not a well-formed artifact from
+    //  this cppfront version's compress()
+    static auto decompress(std::string_view packed)
+        -> std::optional<std::string>
+    {
+        if (!packed.starts_with("CZA1")) {
+            return {};
+        }
+        auto size = size_t{0};
+        auto i    = size_t{4};
+        while (
+            i < packed.size()
+            && isdigit(packed[i])
+            )
+        {
+            size = size * 10 + unchecked_narrow<size_t>(packed[i] - '0');
+            ++i;
+        }
+        if (
+            i == size_t{4}
+            || i >= packed.size()
+            || packed[i] != '\n'
+            )
+        {
+            return {};
+        }
+        ++i;
+
+        auto v = std::string{dictionary()};
+        v.reserve( v.size() + size );
+        auto base = v.size();
+
+        while (v.size() - base < size)
+        {
+            if (i >= packed.size()) {
+                return {};
+            }
+            auto ctrl = static_cast<unsigned char>( packed[i++] );
+            for (
+                auto bit = 0;
+                bit < 8 && v.size() - base < size;
+                ++bit
+                )
+            {
+                if (ctrl & 1u << bit)
+                {
+                    if (i + 3 > packed.size()) {
+                        return {};
+                    }
+                    auto distance =
+                        static_cast<size_t>(static_cast<unsigned char>(packed[i]))
+                        | static_cast<size_t>(static_cast<unsigned char>(packed[i+1])) << 8;
+                    auto len = static_cast<size_t>(static_cast<unsigned char>(packed[i+2])) + min_match;
+                    i += 3;
+                    if (
+                        distance == 0
+                        || distance > v.size()
+                        )
+                    {
+                        return {};
+                    }
+                    //  Byte at a time - a match may overlap its own copy
+                    for (auto l = size_t{0}; l < len; ++l) {
+                        v.push_back( v[v.size() - distance] );
+                    }
+                }
+                else {
+                    if (i >= packed.size()) {
+                        return {};
+                    }
+                    v.push_back( packed[i++] );
+                }
+            }
+        }
+
+        if (v.size() - base != size) {
+            return {};
+        }
+        return v.substr( base );
+    }
+};
+
+
+constexpr auto is_prime(int n)
+    -> bool
+{
+    if (n < 2) { return false; }
+    for (auto d = 2; d*d <= n; ++d) {
+        if (n % d == 0) { return false; }
+    }
+    return true;
+}
+
+
+//-----------------------------------------------------------------------
+//
+//  extrinsic_storage: constant-time side table that nonintrusively
+//  attaches rare ("cold") data to objects, keyed by object address,
+//  so the hot object layout doesn't grow for fields most instances
+//  never set
+//
+//  Promoted from experimental/extrinsic_storage.h, minus the debug
+//  instrumentation. Lock-free for insertion when storage must grow,
+//  wait-free otherwise; a caller must have exclusive access to the
+//  keyed object itself, which holds for AST nodes
+//
+//  IMPORTANT: keys are addresses, and the node arena recycles node
+//  memory - an object type that can have data here must erase its
+//  entry in its destructor, or a later object at the same address
+//  would inherit the stale data
+//
+//-----------------------------------------------------------------------
+//
+
+//  Just enough of atomic<unique_ptr> for this use
+//
+template<typename T>
+class atomic_unique_ptr {
+    std::atomic<T*> p = {};
+public:
+    atomic_unique_ptr ()                         = default;
+    atomic_unique_ptr (atomic_unique_ptr const&) = delete;
+    ~atomic_unique_ptr()                         { delete p.load(); }
+
+    auto load(std::memory_order m_o = std::memory_order_seq_cst) const -> T* { return p.load(m_o); }
+
+    auto release() -> std::unique_ptr<T> {
+        auto ret = std::unique_ptr<T>(p.load());
+        p.store(nullptr);
+        return ret;
+    }
+
+    //  We only need c_e_weak(null, desired), so provide this simpler API
+    auto compare_exchange_weak_null(std::unique_ptr<T>& desired) noexcept -> bool {
+        T* null = nullptr;
+        if (p.compare_exchange_weak(null, desired.get())) {
+            desired.release();
+            return true;
+        }
+        return false;
+    }
+};
+
+template <typename Data, int Buckets = 211>
+    requires (is_prime(Buckets))
+class extrinsic_storage
+{
+    static inline constexpr std::size_t ChunkSize = 32;
+    struct chunk {
+        std::array<std::atomic<void const*>, ChunkSize> keys   = { };  // SOA for better key locality
+        std::array<Data,                     ChunkSize> values = { };
+        atomic_unique_ptr<chunk>                        next   = { };
+    };
+    std::array<chunk, Buckets> buckets = {};
+
+    static auto bucket_of(void const* pobj) -> std::size_t {
+        //  Dropping the alignment bits spreads arena-allocated nodes
+        //  across buckets far more evenly than std::hash<void*> does
+        return (reinterpret_cast<std::size_t>(pobj) >> 2) % Buckets;
+    }
+
+public:
+    ~extrinsic_storage() {
+        //  Explicitly iterate the cleanup so it can't recurse
+        //  proportionally to the largest bucket's chain
+        for (auto& bucket : buckets) {
+            auto pnext = bucket.next.release();
+            while (pnext) {
+                auto pdelete = std::move(pnext);
+                pnext = pdelete->next.release();
+            }
+        }
+    }
+
+    //  find( pobj ) - the data entry for pobj, or null if it has none
+    //
+    //  The relaxed loads are sound because equality means this thread
+    //  owns the slot, and a chunk's .next is immutable once non-null
+    //
+    auto find(void const* pobj) -> Data* {
+        for (auto pchunk = &buckets[bucket_of(pobj)];
+            pchunk;
+            pchunk = pchunk->next.load(std::memory_order_relaxed)
+            )
+        {
+            for (auto i = std::size_t{0}; i < ChunkSize; ++i) {
+                if (pchunk->keys[i].load(std::memory_order_relaxed) == pobj) {
+                    return &pchunk->values[i];
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    auto find(void const* pobj) const -> Data const* {
+        return const_cast<extrinsic_storage*>(this)->find(pobj);
+    }
+
+    //  operator[]( pobj ) - the data entry for pobj, created if absent
+    //
+    auto operator[](void const* pobj) -> Data& {
+        if (auto v = find(pobj)) {
+            return *v;
+        }
+
+        //  Insert: prefer claiming an existing null slot if one exists
+        auto pchunk = &buckets[bucket_of(pobj)];
+        while (true) {
+            for (auto i = std::size_t{0}; i < ChunkSize; ++i) {
+                void const* null = nullptr;
+                if (
+                    //  Relaxed is enough for this first load, it's just a
+                    //  best-effort filter before the (safely SC) c_e_weak
+                    pchunk->keys[i].load(std::memory_order_relaxed) == nullptr
+                    && pchunk->keys[i].compare_exchange_weak( null, pobj )
+                    )
+                {
+                    pchunk->values[i] = {};
+                    return pchunk->values[i];
+                }
+            }
+            //  Relaxed is enough: if another thread just added a chunk and
+            //  we miss it, we only add one extra chunk, which is harmless
+            if (pchunk->next.load(std::memory_order_relaxed) == nullptr) {
+                break;
+            }
+            pchunk = pchunk->next.load();
+        }
+
+        //  Otherwise allocate a new chunk; pchunk is the bucket's last
+        auto pnew = std::make_unique<chunk>();
+        auto ret  = &pnew->values[0];
+
+        pnew->keys[0] = pobj;
+        while (!pchunk->next.compare_exchange_weak_null(pnew)) {
+            pchunk = pchunk->next.load();
+            assert (pchunk);
+        }
+        return *ret;
+    }
+
+    //  erase( pobj ) - remove the entry for pobj, if any
+    //
+    auto erase(void const* pobj) -> void {
+        for (auto pchunk = &buckets[bucket_of(pobj)];
+            pchunk;
+            pchunk = pchunk->next.load(std::memory_order_relaxed)
+            )
+        {
+            for (auto i = std::size_t{0}; i < ChunkSize; ++i) {
+                if (pchunk->keys[i].load(std::memory_order_relaxed) == pobj) {
+                    pchunk->keys[i].store(nullptr, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+    }
+};
+
+
+//-----------------------------------------------------------------------
+//
+//  text_pool: stable storage for generated text, pooled in large
+//             chunks instead of one heap node per string
+//
+//  Interpolation-heavy files synthesize thousands of small strings
+//  that must outlive the tokens and source lines that view into them.
+//  Backing them all with a few large chunks keeps them out of the
+//  allocation profile, the same way the source buffer holds all the
+//  real source text in one allocation
+//
+//-----------------------------------------------------------------------
+//
+class text_pool
+{
+    static constexpr size_t chunk_size = 64 * 1024;
+
+    struct chunk {
+        std::unique_ptr<char[]> bytes;
+        size_t                  size;
+    };
+    std::vector<chunk> chunks;
+    size_t             used     = 0;
+    size_t             capacity = 0;
+
+    //  The stored entries, in order - each views into a chunk
+    std::vector<std::string_view> entries;
+
+    //  One registry entry per thread, shared by the pool instances the
+    //  thread's compiles create and destroy
+    static auto stats()
+        -> arena_registry::entry&
+    {
+        static thread_local auto& e = arena_registry::add( "generated text pool" );
+        return e;
+    }
+
+public:
+    text_pool() = default;
+    text_pool(text_pool&&) noexcept = default;
+    auto operator=(text_pool&&) noexcept -> text_pool& = default;
+
+    //  A pool dies with its compile, which is its reset
+    ~text_pool()
+    {
+        if (chunks.empty()) {
+            return;
+        }
+        for (auto& c : chunks) {
+            if (flag_poison_arenas) {
+                std::memset( c.bytes.get(), 0xDD, c.size );
+            }
+            stats().drop_block( static_cast<long long>(c.size) );
+        }
+        stats().note_reset();
     }
 
-    template< class... Args >
-    auto emplace_back( Args&&... args ) -> T& {
-        if (data.back().size() == data.back().capacity()) {
-            add_segment();
+    auto push_back(std::string_view s)
+        -> void
+    {
+        heapinstr::record( "generated text strings", s.size() );
+        if (used + s.size() > capacity) {
+            capacity = std::max( chunk_size, s.size() );
+            chunks.push_back({ std::make_unique<char[]>(capacity), capacity });
+            used = 0;
+            heapinstr::record_chunk( "generated text chunks", capacity );
+            stats().add_block( static_cast<long long>(capacity) );
         }
-        return data.back().emplace_back(CPP2_FORWARD(args)...);
+        auto where = chunks.back().bytes.get() + used;
+        std::copy( s.begin(), s.end(), where );
+        entries.push_back( { where, s.size() } );
+        used += s.size();
     }
 
-    auto pop_back() -> void {
-        bounds_safety.enforce(size() > 0);
+    auto back() const
+        -> std::string_view
+    {
+        assert (!entries.empty());
+        return entries.back();
+    }
+
+    auto begin() const { return entries.begin(); }
+    auto end  () const { return entries.end  (); }
+};
+
+//-----------------------------------------------------------------------
+//
+//  generated_regex_memo: memo for the regex metafunction's generated
+//  matcher code, keyed on the pattern text
+//
+//  Lowering a pattern to matcher code is a pure function of the
+//  pattern text, so duplicate patterns - within one type, across
+//  types, or across the files of a -daemon/-jobs session - can reuse
+//  the first lowering instead of rerunning the regex compiler
+//
+//  Defined here rather than in reflect.h2 because namespace-scope
+//  objects in Cpp2 lower to 'inline constexpr', and this needs to be
+//  mutable
+//
+//-----------------------------------------------------------------------
+//
+static thread_local std::unordered_map<std::string, std::string> generated_regex_memo;  // thread_local: see -jobs
+
+
+//-----------------------------------------------------------------------
+//
+//  metafunction_cache: an on-disk home for the memo above, so the
+//  reuse survives across builds
+//
+//  With -cache-dir, every successful expansion is written back to
+//  '<cache-dir>/metafunctions.cache' and loaded again by the next run.
+//  An incremental rebuild then skips the regex compiler for every
+//  pattern that is unchanged since the last build, which is nearly all
+//  of them - the cached member text is just handed back to add_member
+//
+//  Records are length-prefixed because pattern text can contain any
+//  byte, including newlines from raw string literals. The header pins
+//  the compiler version: a file left behind by a different cppfront is
+//  ignored on load and replaced on the next write
+//
+//-----------------------------------------------------------------------
+//
+class metafunction_cache
+{
+    std::mutex                                   mutex;       // shared across -jobs workers
+    std::unordered_map<std::string, std::string> entries;
+    std::string                                  file;
+    std::string                                  header;
+    bool                                         dirty = false;
+
+public:
+    //  Attach to '<dir>/metafunctions.cache' and load the entries a
+    //  previous run of this same cppfront version left there
+    //
+    auto open(std::string const& dir, std::string const& version) -> void
+    {
+        auto lock = std::lock_guard{ mutex };
+        file   = dir + "/metafunctions.cache";
+        header = "cppfront-metafunction-cache 1 " + version;
+
+        auto in = std::ifstream{ file, std::ios::binary };
+        if (!in.is_open()) {
+            return;
+        }
+
+        auto line = std::string{};
         if (
-            data.back().empty()
-            && data.size() > 1
+            !std::getline(in, line)
+            || line != header
             )
         {
-            data.pop_back();
+            return;
         }
-        data.back().pop_back();
-    }
 
-    //-------------------------------------------------------------------
-    //  Debug interface
-    //
-    auto debug_print(std::ostream& o) const
-        -> void
-    {
-        o << "stable_vector:\n";
-        for (auto i = 0; auto& chunk : data) {
-            o << "  -- page " << i++ << " --\n    ";
-            for (auto e : chunk) {
-                o << e << ' ';
+        auto key_size = std::size_t{};
+        auto val_size = std::size_t{};
+        while (
+            in >> key_size >> val_size
+            && in.get() == '\n'
+            )
+        {
+            auto key = std::string( key_size, '\0' );
+            auto val = std::string( val_size, '\0' );
+            if (
+                !in.read( key.data(), unchecked_narrow<std::streamsize>(key_size) )
+                || !in.read( val.data(), unchecked_narrow<std::streamsize>(val_size) )
+                )
+            {
+                break;
             }
-            o << "\n";
+            entries[ std::move(key) ] = std::move(val);
         }
     }
 
-    //-------------------------------------------------------------------
-    //  Iterator interface
-    //
-    class iterator {
-        stable_vector* v;
-        size_t         pos = 0;
-    public:
-        using value_type        = T;
-        using difference_type   = std::ptrdiff_t;
-        using pointer           = T*;
-        using reference         = T&;
-        using iterator_category = std::random_access_iterator_tag;
-
-        iterator( stable_vector* v_ = nullptr, size_t pos_ = 0) : v{v_}, pos{pos_} { }
-        auto operator++ ()           -> iterator { if (pos < v->size()) { ++pos; } return *this; }
-        auto operator-- ()           -> iterator { if (pos > 0        ) { --pos; } return *this; }
-        auto operator+= (size_t off) -> iterator { if (pos + off < v->size()) { pos += off; } else { pos = v->size(); } return *this; }
-        auto operator-= (size_t off) -> iterator { if (pos - off > 0        ) { pos -= off; } else { pos = 0;         } return *this; }
-        auto operator*  () const     -> T&       { return  (*v)[pos      ]; }
-        auto operator-> () const     -> T*       { return &(*v)[pos      ]; }
-        auto operator[] (size_t off) -> T&       { return  (*v)[pos + off]; }
-        auto operator+  (size_t off) -> iterator { auto i = *this; i += off; return i; }
-        auto operator-  (size_t off) -> iterator { auto i = *this; i -= off; return i; }
-        auto operator-  (iterator const& that)   -> ptrdiff_t { return pos - that.pos; }
-        auto operator<=>(iterator const&) const  -> std::strong_ordering = default;
-    };
+    auto lookup(std::string const& key) -> std::optional<std::string>
+    {
+        auto lock = std::lock_guard{ mutex };
+        if (auto iter = entries.find(key);
+            iter != entries.end()
+            )
+        {
+            return iter->second;
+        }
+        return {};
+    }
 
-    class const_iterator {
-        stable_vector const* v;
-        size_t               pos = 0;
-    public:
-        using value_type        = const T;
-        using difference_type   = std::ptrdiff_t;
-        using pointer           = T const*;
-        using reference         = T const&;
-        using iterator_category = std::random_access_iterator_tag;
+    auto store(std::string const& key, std::string const& value) -> void
+    {
+        auto lock = std::lock_guard{ mutex };
+        if (file.empty()) {
+            return;
+        }
+        auto& slot = entries[key];
+        if (slot != value) {
+            slot  = value;
+            dirty = true;
+        }
+    }
 
-        const_iterator( stable_vector const* v_ = nullptr, size_t pos_ = 0) : v{v_}, pos{pos_} { }
-        auto operator++ ()           -> const_iterator { if (pos < v->size()) { ++pos; } return *this; }
-        auto operator-- ()           -> const_iterator { if (pos > 0        ) { --pos; } return *this; }
-        auto operator+= (size_t off) -> const_iterator { if (pos + off < v->size()) { pos += off; } else { pos = v->size(); } return *this; }
-        auto operator-= (size_t off) -> const_iterator { if (pos - off > 0        ) { pos -= off; } else { pos = 0;         } return *this; }
-        auto operator*  () const     -> T const&       { return  (*v)[pos      ]; }
-        auto operator-> () const     -> T const*       { return &(*v)[pos      ]; }
-        auto operator[] (size_t off) -> T const&       { return  (*v)[pos + off]; }
-        auto operator+  (size_t off) -> const_iterator { auto i = *this; i += off; return i; }
-        auto operator-  (size_t off) -> const_iterator { auto i = *this; i -= off; return i; }
-        auto operator-  (const_iterator const& that)   -> ptrdiff_t { return pos - that.pos; }
-        auto operator<=>(const_iterator const&) const  -> std::strong_ordering = default;
-    };
+    //  Write everything back if anything new came in - runs from the
+    //  destructor so every exit path (including -daemon and -watch
+    //  sessions) persists what it learned
+    //
+    auto close() -> void
+    {
+        auto lock = std::lock_guard{ mutex };
+        if (
+            !dirty
+            || file.empty()
+            )
+        {
+            return;
+        }
+        auto out = std::ofstream{ file, std::ios::binary };
+        if (!out.is_open()) {
+            return;
+        }
+        out << header << "\n";
+        for (auto const& [key, val] : entries) {
+            out << key.size() << " " << val.size() << "\n" << key << val;
+        }
+        dirty = false;
+    }
 
-    auto  begin()       -> iterator       { return {this, 0     }; }
-    auto  end  ()       -> iterator       { return {this, size()}; }
-    auto  begin() const -> const_iterator { return {this, 0     }; }
-    auto  end  () const -> const_iterator { return {this, size()}; }
-    auto cbegin() const -> const_iterator { return {this, 0     }; }
-    auto cend  () const -> const_iterator { return {this, size()}; }
+    ~metafunction_cache() { close(); }
 };
 
-template <typename T>
-auto operator+ (size_t off, typename stable_vector<T>::iterator const& it) -> typename stable_vector<T>::iterator { auto i = it; i += off; return i; }
+static metafunction_cache the_metafunction_cache;
 
-template <typename T>
-auto operator+ (size_t off, typename stable_vector<T>::const_iterator const& it) -> typename stable_vector<T>::const_iterator { auto i = it; i += off; return i; }
 
 //  And now jump over to std:: to drop in the size/ssize overloads
 }
 namespace std {
-    template <typename T>
-    auto  size(cpp2::stable_vector<T> const& v) -> ptrdiff_t { return v. size();  }
-    template <typename T>
-    auto ssize(cpp2::stable_vector<T> const& v) -> ptrdiff_t { return v.ssize();  }
+    template <typename T, size_t PageSize>
+    auto  size(cpp2::stable_vector<T, PageSize> const& v) -> ptrdiff_t { return v. size();  }
+    template <typename T, size_t PageSize>
+    auto ssize(cpp2::stable_vector<T, PageSize> const& v) -> ptrdiff_t { return v.ssize();  }
 }
 namespace cpp2 {
 
@@ -1350,6 +3048,307 @@ auto scope_timer(std::string_view name) {
     return finally( std::move(stop) );
 }
 
+
+//-----------------------------------------------------------------------
+//
+//  hw_counters: optional per-thread hardware counters
+//
+//  On Linux, reads instructions retired, cache misses, and branch
+//  mispredicts for the calling thread via perf_event_open, so a
+//  regression can be attributed to a phase without re-running under
+//  external tooling. Elsewhere (or when the kernel denies access,
+//  e.g. restrictive perf_event_paranoid) every reading is -1 and the
+//  callers print nothing.
+//
+//-----------------------------------------------------------------------
+//
+class hw_counters
+{
+public:
+    struct sample {
+        long long instructions  = -1;
+        long long cache_misses  = -1;
+        long long branch_misses = -1;
+
+        auto is_valid() const
+            -> bool
+        {
+            return instructions >= 0;
+        }
+
+        auto operator-(sample const& that) const
+            -> sample
+        {
+            auto minus = [](long long a, long long b) {
+                return a >= 0 && b >= 0 ? a - b : -1;
+            };
+            return {
+                minus(instructions , that.instructions ),
+                minus(cache_misses , that.cache_misses ),
+                minus(branch_misses, that.branch_misses)
+            };
+        }
+    };
+
+#if defined(CPP2_USE_PERF_COUNTERS)
+
+private:
+    int  fds[3] = { -1, -1, -1 };
+    bool opened = false;
+
+    static auto open_counter(uint64_t config)
+        -> int
+    {
+        auto attr = perf_event_attr{};
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(attr);
+        attr.config         = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        return unchecked_narrow<int>(
+            syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 )
+        );
+    }
+
+public:
+    //  Read the current counter values for this thread, opening the
+    //  counters on first use - deltas between two reads bracket a phase
+    //
+    auto read()
+        -> sample
+    {
+        if (!opened) {
+            fds[0] = open_counter( PERF_COUNT_HW_INSTRUCTIONS );
+            fds[1] = open_counter( PERF_COUNT_HW_CACHE_MISSES );
+            fds[2] = open_counter( PERF_COUNT_HW_BRANCH_MISSES );
+            opened = true;
+        }
+
+        auto read_one = [](int fd) -> long long {
+            auto value = (long long)(-1);
+            if (
+                fd < 0
+                || ::read( fd, &value, sizeof(value) ) != sizeof(value)
+                )
+            {
+                return -1;
+            }
+            return value;
+        };
+        return { read_one(fds[0]), read_one(fds[1]), read_one(fds[2]) };
+    }
+
+    ~hw_counters() {
+        for (auto fd : fds) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+#else
+
+public:
+    auto read()
+        -> sample
+    {
+        return {};
+    }
+
+#endif
+};
+
+static thread_local hw_counters this_thread_counters;   // thread_local: see -jobs
+
+
+//-----------------------------------------------------------------------
+//
+//  phase_profiler: a hierarchical phase profiler
+//
+//  Where timer gives one flat number per name, this records nested
+//  begin/end scopes (per file, per phase) with optional counters
+//  (tokens lexed, nodes allocated, symbols scanned, ...) and can write
+//  the whole session in chrome://tracing JSON format, so a multi-file
+//  build's wall time can be inspected without external tooling
+//
+//-----------------------------------------------------------------------
+//
+class phase_profiler
+{
+    using clock = std::chrono::steady_clock;
+
+    struct event {
+        std::string                                       name;
+        size_t                                            tid;
+        long long                                         start_us;
+        long long                                         dur_us = -1;    // -1 == still open
+        hw_counters::sample                               hw_start = {};
+        std::vector<std::pair<std::string, long long>>    counts;
+    };
+
+    bool                           active = false;
+    std::chrono::time_point<clock> origin = clock::now();
+
+    //  All threads' events interleave here, distinguished by tid
+    std::mutex          mutex;
+    std::vector<event>  events;
+
+    auto now_us() const
+        -> long long
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>( clock::now() - origin ).count();
+    }
+
+    static auto this_tid()
+        -> size_t
+    {
+        return std::hash<std::thread::id>{}( std::this_thread::get_id() );
+    }
+
+    //  The innermost still-open event on this thread, if any
+    auto innermost_open()
+        -> event*
+    {
+        for (auto i = std::ssize(events)-1; i >= 0; --i) {
+            if (
+                events[i].dur_us == -1
+                && events[i].tid == this_tid()
+                )
+            {
+                return &events[i];
+            }
+        }
+        return {};
+    }
+
+public:
+    auto enable()
+        -> void
+    {
+        active = true;
+        origin = clock::now();
+    }
+
+    auto is_active() const
+        -> bool
+    {
+        return active;
+    }
+
+    auto begin(std::string_view name)
+        -> void
+    {
+        if (!active) { return; }
+        auto hw   = this_thread_counters.read();
+        auto lock = std::lock_guard{ mutex };
+        events.push_back({ std::string{name}, this_tid(), now_us(), -1, hw, {} });
+    }
+
+    auto end()
+        -> void
+    {
+        if (!active) { return; }
+        auto hw   = this_thread_counters.read();
+        auto lock = std::lock_guard{ mutex };
+        if (auto e = innermost_open()) {
+            e->dur_us = now_us() - e->start_us;
+
+            //  If hardware counters are available, attach this scope's
+            //  deltas alongside its duration
+            if (auto delta = hw - e->hw_start;
+                delta.is_valid()
+                )
+            {
+                e->counts.emplace_back( "instructions" , delta.instructions  );
+                e->counts.emplace_back( "cache-misses" , delta.cache_misses  );
+                e->counts.emplace_back( "branch-misses", delta.branch_misses );
+            }
+        }
+    }
+
+    //  Attach a named counter to the innermost open scope
+    //
+    auto count(
+        std::string_view name,
+        long long        value
+    )
+        -> void
+    {
+        if (!active) { return; }
+        auto lock = std::lock_guard{ mutex };
+        if (auto e = innermost_open()) {
+            e->counts.emplace_back( std::string{name}, value );
+        }
+    }
+
+    //  RAII helper for balanced scopes
+    //
+    auto scope(std::string_view name)
+    {
+        begin(name);
+        return finally( [this]{ end(); } );
+    }
+
+    //  Write all events in chrome://tracing "traceEvents" format
+    //
+    auto save(std::string const& filename)
+        -> bool
+    {
+        auto lock = std::lock_guard{ mutex };
+
+        auto out = std::ofstream{ filename };
+        if (!out.is_open()) {
+            return false;
+        }
+
+        auto close_of = now_us();
+
+        out << "{\"traceEvents\":[";
+        for (auto first = true; auto const& e : events)
+        {
+            if (!first) { out << ","; }
+            first = false;
+
+            out << "\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << e.tid % 10'000
+                << ",\"name\":\"";
+            for (auto c : e.name) {
+                if (c == '"' || c == '\\') { out << '\\'; }
+                out << c;
+            }
+            out << "\",\"ts\":" << e.start_us
+                << ",\"dur\":"  << (e.dur_us == -1 ? close_of - e.start_us : e.dur_us);
+
+            if (!e.counts.empty()) {
+                out << ",\"args\":{";
+                for (auto first_count = true; auto const& [cname, cvalue] : e.counts) {
+                    if (!first_count) { out << ","; }
+                    first_count = false;
+                    out << "\"" << cname << "\":" << cvalue;
+                }
+                out << "}";
+            }
+            out << "}";
+        }
+        out << "\n]}\n";
+        return true;
+    }
+};
+
+static phase_profiler profiler;     // global - safe for -jobs, see tid handling above
+
+//  Emit a zero-length timestamped event for a container page allocation,
+//  carrying the page size in bytes, so -profile traces show when paged
+//  containers grow relative to the compile phases (declared before
+//  stable_vector, which predates the profiler in this header)
+//
+auto note_page_allocation(std::string_view category, long long bytes) -> void
+{
+    if (!profiler.is_active()) { return; }
+    profiler.begin(category);
+    profiler.count("bytes", bytes);
+    profiler.end();
+}
+
 #ifdef CPP2_DEBUG_BUILD
 #define CPP2_CONCAT(x,y)       x##y
 #define CPP2_UNIQUE_NAME(x,y)  CPP2_CONCAT(x,y)
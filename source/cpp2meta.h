@@ -0,0 +1 @@
+#include "../include/cpp2meta.h"
@@ -1,7 +1,7 @@
 
 //  Copyright 2022-2024 Herb Sutter
 //  SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
-//  
+//
 //  Part of the Cppfront Project, under the Apache License v2.0 with LLVM Exceptions.
 //  See https://github.com/hsutter/cppfront/blob/main/LICENSE for license information.
 
@@ -11,13 +11,142 @@
 //===========================================================================
 
 #include "to_cpp1.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <sstream>
+#include <thread>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+
+//===========================================================================
+//  Small-block recycler
+//
+//  Metafunction execution and Cpp1 emission build large numbers of
+//  short-lived strings and vectors, and most of those allocations are
+//  small and of a handful of repeating sizes. A per-type "reset" arena
+//  can't serve them - generated member text escapes the metafunction
+//  scope into the AST - but recycling is safe: once the steady state is
+//  reached, freed blocks are handed straight back out and the churn
+//  never reaches malloc.
+//
+//  Each block is an ordinary malloc block; the caches just hold on to
+//  freed ones, as intrusive singly-linked lists threaded through the
+//  freed memory itself (same scheme as the AST arena's free lists in
+//  parse.h). That keeps every invariant trivial: any cached block can
+//  be handed to any thread or released with free(), and the unsized
+//  operator delete - which can't tell us the bin - just frees directly.
+//
+//  The caches are thread_local for -jobs, and deliberately hold no
+//  dynamically allocated state of their own so that a stray deletion
+//  during thread teardown can't allocate: after the destructor flushes
+//  a cache, 'dead' routes everything to plain malloc/free.
+//===========================================================================
+
+namespace smallblock {
+
+constexpr auto granule       = sizeof(void*) * 2;   // >= sizeof(void*), keeps malloc's alignment classes
+constexpr auto max_small     = size_t{ 512 };
+constexpr auto num_bins      = max_small / granule;
+constexpr auto max_per_bin   = size_t{ 4096 };      // bounds idle memory per thread
+
+struct block_cache
+{
+    void*  bins [num_bins] = {};
+    size_t counts[num_bins] = {};
+    bool   dead = false;
+
+    ~block_cache() {
+        dead = true;
+        for (auto head : bins) {
+            while (head) {
+                auto next = *static_cast<void**>(head);
+                std::free(head);
+                head = next;
+            }
+        }
+    }
+};
+
+thread_local block_cache cache = {};
+
+constexpr auto bin_of(size_t size) -> size_t {
+    return (size - 1) / granule;
+}
+
+inline auto allocate(size_t size) -> void*
+{
+    if (
+        0 < size
+        && size <= max_small
+        && !cache.dead
+        )
+    {
+        auto i = bin_of(size);
+        if (auto p = cache.bins[i]) {
+            cache.bins[i] = *static_cast<void**>(p);
+            --cache.counts[i];
+            return p;
+        }
+        //  Allocate the whole bin width so the block is reusable for
+        //  every size that maps to this bin
+        size = (i+1) * granule;
+    }
+    if (auto p = std::malloc(size > 0 ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+inline auto deallocate(void* p, size_t size) -> void
+{
+    if (!p) {
+        return;
+    }
+    if (
+        0 < size
+        && size <= max_small
+        && !cache.dead
+        )
+    {
+        auto i = bin_of(size);
+        if (cache.counts[i] < max_per_bin) {
+            *static_cast<void**>(p) = cache.bins[i];
+            cache.bins[i] = p;
+            ++cache.counts[i];
+            return;
+        }
+    }
+    std::free(p);
+}
+
+}
+
+[[nodiscard]] auto operator new  (std::size_t size) -> void*          { return smallblock::allocate(size); }
+[[nodiscard]] auto operator new[](std::size_t size) -> void*          { return smallblock::allocate(size); }
+auto operator delete  (void* p)                     noexcept -> void  { if (p) { std::free(p); } }
+auto operator delete[](void* p)                     noexcept -> void  { if (p) { std::free(p); } }
+auto operator delete  (void* p, std::size_t size)   noexcept -> void  { smallblock::deallocate(p, size); }
+auto operator delete[](void* p, std::size_t size)   noexcept -> void  { smallblock::deallocate(p, size); }
+
 
 static auto flag_debug_output = false;
 static cpp2::cmdline_processor::register_flag cmd_debug(
     9,
     "debug",
     "Emit compiler debug output",
-    []{ flag_debug_output = true; }
+    []{ flag_debug_output = true; },
+    nullptr,
+    "d"     //  -daemon/-dedupe-*/-demote-* and friends made the 'd'
+            //  prefix ambiguous, so keep the one-letter spelling exact
 );
 
 static auto flag_quiet = false;
@@ -28,6 +157,531 @@ static cpp2::cmdline_processor::register_flag cmd_quiet(
     []{ flag_quiet = true; }
 );
 
+static auto flag_daemon = false;
+static cpp2::cmdline_processor::register_flag cmd_daemon(
+    9,
+    "daemon",
+    "Stay resident and compile files read from stdin, one request per line",
+    []{ flag_daemon = true; }
+);
+
+static auto flag_jobs = 1;
+static cpp2::cmdline_processor::register_flag cmd_jobs(
+    9,
+    "jobs N",
+    "Compile up to N source files in parallel",
+    nullptr,
+    [](std::string const& njobs) { flag_jobs = std::max( 1, atoi(njobs.c_str()) ); }
+);
+
+static auto flag_stats = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_stats(
+    9,
+    "stats file.json",
+    "Write per-file token/AST/symbol counts and phase timings to 'file.json'",
+    nullptr,
+    [](std::string const& name) { flag_stats = name; }
+);
+
+//  The per-file stats JSON objects, collected under a lock because
+//  -jobs workers can finish concurrently, written once at exit
+static std::mutex               stats_mutex;
+static std::vector<std::string> stats_entries;
+
+static auto flag_budget = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_budget(
+    9,
+    "budget file.txt",
+    "Write a per-file template instantiation budget report, ranked by estimated downstream compile cost, to 'file.txt'",
+    nullptr,
+    [](std::string const& name) { flag_budget = name; }
+);
+
+//  The per-file budget entries, same collection discipline as -stats
+static std::mutex                              budget_mutex;
+static std::vector<cpp2::instantiation_budget> budget_entries;
+
+static auto flag_numa = false;
+static cpp2::cmdline_processor::register_flag cmd_numa(
+    9,
+    "numa",
+    "Pin each -jobs worker to one CPU to keep its memory on its own node (Linux)",
+    []{ flag_numa = true; }
+);
+
+static auto flag_cache_dir = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_cache_dir(
+    9,
+    "cache-dir path",
+    "Reuse outputs cached in 'path' when source + flags are unchanged",
+    nullptr,
+    [](std::string const& path) { flag_cache_dir = path; }
+);
+
+static auto flag_metafunction_libs = std::vector<std::string>{};
+static cpp2::cmdline_processor::register_flag cmd_metafunction_lib(
+    9,
+    "metafunction-lib path",
+    "Load metafunction plugins from the shared library at 'path'",
+    nullptr,
+    [](std::string const& path) { flag_metafunction_libs.push_back(path); }
+);
+
+static auto flag_watch_dir = std::string{};
+static cpp2::cmdline_processor::register_flag cmd_watch(
+    9,
+    "watch dir",
+    "Stay resident and recompile .cpp2/.h2 files under 'dir' when they change",
+    nullptr,
+    [](std::string const& dir) { flag_watch_dir = dir; }
+);
+
+static auto flag_scan_deps = false;
+static cpp2::cmdline_processor::register_flag cmd_scan_deps(
+    9,
+    "scan-deps",
+    "Print a Make/ninja-compatible dependency line per input file, without compiling",
+    []{ flag_scan_deps = true; }
+);
+
+
+//  collect_quoted_deps: pull the quoted #include / import targets out
+//  of a loaded source's classified lines - the shared scanning behind
+//  -scan-deps and the -jobs import-aware scheduler. `#include <...>`
+//  and named-module imports are skipped, the same convention as
+//  compilers' -MMD user-header dependency output: only quoted targets
+//  name local files a build (or this batch) can contain
+//
+static auto collect_quoted_deps(cpp2::source const& src)
+    -> std::vector<std::string>
+{
+    auto ret = std::vector<std::string>{};
+    for (auto const& line : src.get_lines())
+    {
+        auto text = std::string_view{ line.text };
+
+        //  Of the preprocessor lines, only #include names a dependency
+        if (line.cat == cpp2::source_line::category::preprocessor) {
+            auto i = text.find('#');
+            if (i == std::string_view::npos) {
+                continue;
+            }
+            ++i;
+            while (i < text.size() && isspace(text[i])) { ++i; }
+            if (!text.substr(i).starts_with("include")) {
+                continue;
+            }
+        }
+        else if (line.cat != cpp2::source_line::category::import) {
+            continue;
+        }
+
+        auto open = text.find('"');
+        if (open == std::string_view::npos) {
+            continue;
+        }
+        auto close = text.find('"', open+1);
+        if (close == std::string_view::npos) {
+            continue;
+        }
+        ret.emplace_back( text.substr( open+1, close-open-1 ) );
+    }
+    return ret;
+}
+
+
+//  scan_one_deps: the cheap path behind -scan-deps - load 'name' and run
+//  only the loader's line classifier (no lexing, parsing, or lowering),
+//  pull its quoted #include / import targets, and print one
+//  Make/ninja-compatible "output: inputs" line, so a build system can
+//  learn each file's dependencies without paying for a full compile
+//
+static auto scan_one_deps(
+    std::string const& name,
+    std::ostream&      out,
+    std::ostream&      err
+)
+    -> bool
+{
+    auto errors = std::vector<cpp2::error_entry>{};
+    auto src    = cpp2::source{ errors };
+    if (!src.load(name)) {
+        err << name << ": error: could not open file\n";
+        return false;
+    }
+
+    //  Make syntax requires escaping spaces in paths
+    auto escaped = [](std::string_view s) {
+        auto ret = std::string{};
+        for (auto c : s) {
+            if (c == ' ') { ret += '\\'; }
+            ret += c;
+        }
+        return ret;
+    };
+
+    //  The target mirrors the compiler's output naming: -o when given,
+    //  otherwise the source name minus its trailing '2'
+    auto target = name;
+    if (
+        !cpp2::flag_cpp1_filename.empty()
+        && cpp2::flag_cpp1_filename != "stdout"
+        )
+    {
+        target = cpp2::flag_cpp1_filename;
+    }
+    else if (target.ends_with("2")) {
+        target.pop_back();
+    }
+
+    out << escaped(target) << ": " << escaped(name);
+    if (!cpp2::flag_include_prelude.empty()) {
+        out << " " << escaped(cpp2::flag_include_prelude);
+    }
+
+    for (auto const& dep : collect_quoted_deps(src)) {
+        out << " " << escaped(dep);
+    }
+    out << "\n";
+    return true;
+}
+
+
+static auto flag_compare = false;
+static cpp2::cmdline_processor::register_flag cmd_compare(
+    9,
+    "compare",
+    "Compare two generated Cpp1 files token by token, ignoring formatting",
+    []{ flag_compare = true; }
+);
+
+static auto flag_decompress = false;
+static cpp2::cmdline_processor::register_flag cmd_decompress(
+    9,
+    "decompress",
+    "Materialize -emit-compressed .cz artifacts back into the files they were made from",
+    []{ flag_decompress = true; }
+);
+
+
+//  The cheap path behind -compare: lex both files into Cpp1 token
+//  streams and compare those, so whitespace-only printer drift (the
+//  noise in rebasing hundreds of test-results outputs) compares equal
+//  and a real divergence is reported as two tokens with positions,
+//  not as a megabyte of textual diff
+//
+struct cpp1_token {
+    std::string text;
+    int         lineno;
+    int         colno;
+};
+
+static auto lex_cpp1_tokens(
+    std::string const&       text,
+    std::vector<cpp1_token>& out
+)
+    -> void
+{
+    auto i      = size_t{0};
+    auto lineno = 1;
+    auto line_start = size_t{0};
+
+    auto advance = [&](size_t n) {
+        for (; n > 0 && i < text.size(); --n, ++i) {
+            if (text[i] == '\n') {
+                ++lineno;
+                line_start = i+1;
+            }
+        }
+    };
+    auto peek = [&](size_t k) -> char {
+        return i+k < text.size() ? text[i+k] : '\0';
+    };
+    auto is_ident_char = [](char c) {
+        return isalnum(static_cast<unsigned char>(c)) || c == '_';
+    };
+
+    //  Longest-munch operator table, so that '+ +' and '++' stay distinct
+    static constexpr std::string_view operators[] = {
+        "<<=", ">>=", "<=>", "->*", "...",
+        "::", "->", "++", "--", "<<", ">>", "<=", ">=", "==", "!=",
+        "&&", "||", "+=", "-=", "*=", "/=", "%=", "^=", "&=", "|=", "##", ".*",
+    };
+
+    while (i < text.size())
+    {
+        auto c = text[i];
+
+        //  Whitespace and comments aren't tokens
+        if (isspace(static_cast<unsigned char>(c))) {
+            advance(1);
+            continue;
+        }
+        if (c == '/' && peek(1) == '/') {
+            while (i < text.size() && text[i] != '\n') { advance(1); }
+            continue;
+        }
+        if (c == '/' && peek(1) == '*') {
+            advance(2);
+            while (i < text.size() && !(text[i] == '*' && peek(1) == '/')) { advance(1); }
+            advance(2);
+            continue;
+        }
+
+        auto start     = i;
+        auto tok_line  = lineno;
+        auto tok_col   = static_cast<int>(i - line_start) + 1;
+
+        auto skip_quoted = [&](char quote) {
+            advance(1);
+            while (
+                i < text.size()
+                && text[i] != quote
+                )
+            {
+                advance( text[i] == '\\' ? 2 : 1 );
+            }
+            advance(1);
+        };
+        auto skip_raw_string = [&] {
+            //  R"delim( ... )delim"
+            advance(1);
+            auto delim = std::string{")"};
+            while (i < text.size() && text[i] != '(') {
+                delim += text[i];
+                advance(1);
+            }
+            delim += '"';
+            auto close = text.find(delim, i);
+            advance( (close == std::string::npos ? text.size() : close + delim.size()) - i );
+        };
+
+        if (
+            is_ident_char(c)
+            && !isdigit(static_cast<unsigned char>(c))
+            )
+        {
+            while (i < text.size() && is_ident_char(text[i])) { advance(1); }
+
+            //  A u8/u/U/L/R-prefixed literal is one token with its prefix
+            auto ident = std::string_view{ text }.substr(start, i - start);
+            if (
+                (peek(0) == '"' || peek(0) == '\'')
+                && (   ident == "R"  || ident == "u8" || ident == "u" || ident == "U" || ident == "L"
+                    || ident == "u8R" || ident == "uR" || ident == "UR" || ident == "LR" )
+                )
+            {
+                if (ident.back() == 'R' && peek(0) == '"') {
+                    skip_raw_string();
+                }
+                else {
+                    skip_quoted( peek(0) );
+                }
+            }
+        }
+        else if (
+            isdigit(static_cast<unsigned char>(c))
+            || (c == '.' && isdigit(static_cast<unsigned char>(peek(1))))
+            )
+        {
+            //  pp-number: digits, identifier chars, dots, quotes as
+            //  separators, and signs after an exponent
+            advance(1);
+            while (i < text.size()) {
+                auto d = text[i];
+                auto prev = text[i-1];
+                if (
+                    (d == '+' || d == '-')
+                    && (prev == 'e' || prev == 'E' || prev == 'p' || prev == 'P')
+                    )
+                {
+                    advance(1);
+                }
+                else if (
+                    is_ident_char(d)
+                    || d == '.'
+                    || (d == '\'' && is_ident_char(peek(1)))
+                    )
+                {
+                    advance(1);
+                }
+                else {
+                    break;
+                }
+            }
+        }
+        else if (c == '"') {
+            skip_quoted('"');
+        }
+        else if (c == '\'') {
+            skip_quoted('\'');
+        }
+        else {
+            auto rest    = std::string_view{ text }.substr(i);
+            auto matched = size_t{1};
+            for (auto op : operators) {
+                if (
+                    rest.starts_with(op)
+                    && op.size() > matched
+                    )
+                {
+                    matched = op.size();
+                }
+            }
+            advance(matched);
+        }
+
+        out.push_back({ text.substr(start, i - start), tok_line, tok_col });
+    }
+}
+
+static auto compare_one_pair(
+    std::string const& name1,
+    std::string const& name2,
+    std::ostream&      out,
+    std::ostream&      err
+)
+    -> bool
+{
+    auto load = [&](std::string const& name, std::string& contents) {
+        auto in = std::ifstream{ name, std::ios::binary };
+        if (!in.is_open()) {
+            err << name << ": error: could not open file\n";
+            return false;
+        }
+        contents.assign(
+            std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>()
+        );
+        return true;
+    };
+
+    auto text1 = std::string{};
+    auto text2 = std::string{};
+    if (
+        !load(name1, text1)
+        || !load(name2, text2)
+        )
+    {
+        return false;
+    }
+
+    auto tokens1 = std::vector<cpp1_token>{};
+    auto tokens2 = std::vector<cpp1_token>{};
+    lex_cpp1_tokens( text1, tokens1 );
+    lex_cpp1_tokens( text2, tokens2 );
+
+    auto n = std::min(tokens1.size(), tokens2.size());
+    for (auto k = size_t{0}; k < n; ++k)
+    {
+        if (tokens1[k].text != tokens2[k].text)
+        {
+            out << "files differ at token " << k+1 << ":\n"
+                << "  " << name1 << ":" << tokens1[k].lineno << ":" << tokens1[k].colno
+                << ": '" << tokens1[k].text << "'\n"
+                << "  " << name2 << ":" << tokens2[k].lineno << ":" << tokens2[k].colno
+                << ": '" << tokens2[k].text << "'\n";
+            return false;
+        }
+    }
+    if (tokens1.size() != tokens2.size())
+    {
+        auto const& longer = tokens1.size() > tokens2.size() ? tokens1 : tokens2;
+        out << "files differ: " << (tokens1.size() > tokens2.size() ? name1 : name2)
+            << " has " << longer.size() - n << " extra trailing token"
+            << (longer.size() - n == 1 ? "" : "s")
+            << " starting at " << longer[n].lineno << ":" << longer[n].colno
+            << ": '" << longer[n].text << "'\n";
+        return false;
+    }
+
+    out << "files are token-identical (" << tokens1.size() << " tokens)\n";
+    return true;
+}
+
+
+//  hash_string: FNV-1a, to fingerprint source text + flag state for -cache-dir
+//
+static auto hash_string(std::string_view s)
+    -> std::string
+{
+    auto h = 0xcbf29ce484222325ULL;
+    for (auto c : s) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x00000100000001b3ULL;
+    }
+    auto ret = std::string{};
+    constexpr auto digits = std::string_view{"0123456789abcdef"};
+    for (auto i = 0; i < 16; ++i) {
+        ret += digits[(h >> (60 - 4*i)) & 0xF];
+    }
+    return ret;
+}
+
+
+//  flags_fingerprint: the flag state that can change the generated output
+//
+static auto flags_fingerprint()
+    -> std::string
+{
+    auto ret = std::string{
+        "cppfront "
+        #include "version.info"
+        " "
+        #include "build.info"
+        " "
+    };
+    using namespace cpp2;
+    for (auto f : {
+        flag_emit_cppfront_info, flag_clean_cpp1, flag_no_align, flag_line_paths,
+        flag_import_std, flag_include_std, flag_cpp2_only,
+        flag_safe_null_pointers, flag_safe_zero_division,
+        flag_safe_subscripts, flag_safe_comparisons,
+        flag_no_exceptions, flag_no_rtti
+        })
+    {
+        ret += f ? '1' : '0';
+    }
+
+    //  A shared prolog changes every output's include lines
+    //
+    if (!flag_shared_prolog.empty()) {
+        ret += ' ';
+        ret += flag_shared_prolog;
+    }
+
+    //  A prelude changes every output's include lines, and its content
+    //  can change how names it declares are emitted, so identify it by
+    //  path plus its current write time
+    //
+    if (!cpp2::flag_include_prelude.empty()) {
+        ret += ' ';
+        ret += flag_include_prelude;
+        auto ec = std::error_code{};
+        auto t  = std::filesystem::last_write_time(flag_include_prelude, ec);
+        if (!ec) {
+            ret += ':';
+            ret += std::to_string(t.time_since_epoch().count());
+        }
+    }
+
+    //  Plugins can change the generated output too, so identify each
+    //  loaded library by path plus its current write time
+    //
+    for (auto const& lib : flag_metafunction_libs) {
+        ret += ' ';
+        ret += lib;
+        auto ec = std::error_code{};
+        auto t  = std::filesystem::last_write_time(lib, ec);
+        if (!ec) {
+            ret += ':';
+            ret += std::to_string(t.time_since_epoch().count());
+        }
+    }
+    return ret;
+}
+
+
 auto main(
     int   argc,
     char* argv[]
@@ -43,7 +697,12 @@ auto main(
         return EXIT_SUCCESS;
     }
 
-    if (cmdline.arguments().empty()) {
+    if (
+        cmdline.arguments().empty()
+        && !flag_daemon
+        && flag_watch_dir.empty()
+        )
+    {
         std::cerr << "cppfront: error: no input files (try -help)\n";
         return EXIT_FAILURE;
     }
@@ -52,8 +711,19 @@ auto main(
         std::filesystem::current_path(flag_cwd);
     }
 
-    //  For each Cpp2 source file
-    int exit_status = EXIT_SUCCESS;
+    //  A cache directory also gives the deterministic metafunction
+    //  expansions a cross-build home (see metafunction_cache) - version
+    //  goes into the file header so a compiler upgrade invalidates it
+    //
+    if (!flag_cache_dir.empty()) {
+        auto version = std::string{
+            #include "version.info"
+        };
+        the_metafunction_cache.open( flag_cache_dir, version );
+    }
+
+    //  First reject anything that looks like a misspelled flag,
+    //  before we start compiling anything
     for (auto const& arg : cmdline.arguments())
     {
         if (
@@ -73,36 +743,323 @@ auto main(
             }
             return EXIT_FAILURE;
         }
+    }
+
+    //  Comparison mode doesn't compile anything - it lexes its two
+    //  arguments and diffs the token streams
+    //
+    if (flag_compare)
+    {
+        if (cmdline.arguments().size() != 2) {
+            std::cerr << "cppfront: error: -compare takes exactly two files\n";
+            return EXIT_FAILURE;
+        }
+        return
+            compare_one_pair(
+                cmdline.arguments()[0].text,
+                cmdline.arguments()[1].text,
+                std::cout,
+                std::cerr
+            )
+            ? EXIT_SUCCESS
+            : EXIT_FAILURE
+            ;
+    }
+
+    //  Decompression doesn't compile anything - it materializes each
+    //  .cz argument back into the file it was made from
+    //
+    if (flag_decompress)
+    {
+        auto ok = true;
+        for (auto const& arg : cmdline.arguments())
+        {
+            if (!arg.text.ends_with(".cz")) {
+                std::cerr << "cppfront: error: -decompress takes .cz artifacts, and " << arg.text << " isn't one\n";
+                ok = false;
+                continue;
+            }
+            auto in     = std::ifstream{ arg.text, std::ios::binary };
+            auto packed = std::string{
+                std::istreambuf_iterator<char>{in},
+                std::istreambuf_iterator<char>{}
+            };
+            if (!in.good() && !in.eof()) {
+                std::cerr << "cppfront: error: could not read " << arg.text << "\n";
+                ok = false;
+                continue;
+            }
+            auto text = artifact_codec::decompress( packed );
+            if (!text) {
+                std::cerr << "cppfront: error: " << arg.text << " is not a compressed artifact from this cppfront version\n";
+                ok = false;
+                continue;
+            }
+            auto filename = arg.text.substr( 0, arg.text.size() - 3 );
+            if (!output_batcher::write_file( filename, *text )) {
+                std::cerr << "cppfront: error: could not write " << filename << "\n";
+                ok = false;
+            }
+        }
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    //  Dependency scanning stops after the loader's line classifier -
+    //  no plugin loading, prelude compile, or lowering happens
+    //
+    if (flag_scan_deps)
+    {
+        auto ok = true;
+        for (auto const& arg : cmdline.arguments()) {
+            if (!scan_one_deps( arg.text, std::cout, std::cerr )) {
+                ok = false;
+            }
+        }
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    //  Load metafunction plugin libraries up front, before any compile
+    //  threads exist - see plugin_registry in reflect.h2
+    //
+    for (auto const& lib : flag_metafunction_libs) {
+        auto error = std::string{};
+        if (!meta::plugin_registry.load(lib, error)) {
+            std::cerr << "cppfront: error: -metafunction-lib " << lib << ": " << error << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    //  Write the shared prolog header once per invocation: the defines +
+    //  runtime include that would otherwise be repeated into every output.
+    //  Each generated file then includes just this one header, which a
+    //  downstream build can also precompile once for the whole file set
+    //
+    if (
+        !flag_shared_prolog.empty()
+        && !flag_emit_module
+        )
+    {
+        auto out = std::ofstream{ flag_shared_prolog, std::ios::binary };
+        if (!out.is_open()) {
+            std::cerr << "cppfront: error: could not write -shared-prolog file '" << flag_shared_prolog << "'\n";
+            return EXIT_FAILURE;
+        }
+        out << "//  Shared prolog generated by cppfront -shared-prolog -\n"
+               "//  included first by every output of the same invocation\n\n";
+        if (flag_include_std) {
+            out << "#define CPP2_INCLUDE_STD         Yes\n";
+        }
+        else if (flag_import_std) {
+            out << "#define CPP2_IMPORT_STD          Yes\n";
+        }
+        if (flag_no_exceptions) {
+            out << "#define CPP2_NO_EXCEPTIONS       Yes\n";
+        }
+        if (flag_no_rtti) {
+            out << "#define CPP2_NO_RTTI             Yes\n";
+        }
+        out << "\n#include \"cpp2util.h\"\n";
+    }
+
+    //  Compile the shared prelude once per invocation, before any
+    //  per-file compiles or worker threads exist: every output includes
+    //  its generated header, and every compile's name lookup can fall
+    //  back to its global declarations - see sema::share_globals_as_prelude.
+    //  It stays alive for the whole invocation (and is destroyed on this
+    //  thread) because the shared index points into its tokens and symbols
+    //
+    //  In daemon mode with a cache directory, reload the identifier
+    //  spellings a previous daemon process interned, so a restarted
+    //  daemon (crash, deploy) starts with a warm interner instead of
+    //  rebuilding it over its first dozen requests. The snapshot header
+    //  carries the cppfront version and build, so a snapshot written by
+    //  a different build is ignored and rewritten
+    //
+    auto interner_snapshot = std::string{};
+    auto interner_header   = std::string{
+        "cppfront "
+        #include "version.info"
+        " "
+        #include "build.info"
+    };
+    if (
+        flag_daemon
+        && !flag_cache_dir.empty()
+        )
+    {
+        interner_snapshot =
+            (std::filesystem::path{flag_cache_dir} / "interner.snapshot").string();
+        interned_identifiers.load_snapshot( interner_snapshot, interner_header );
+    }
+
+    auto prelude = std::unique_ptr<cppfront>{};
+    if (!flag_include_prelude.empty())
+    {
+        if (!flag_include_prelude.ends_with(".h2")) {
+            std::cerr << "cppfront: error: -include-prelude file must be a .h2 file\n";
+            return EXIT_FAILURE;
+        }
+
+        //  The prelude compiles like any other file, except without a
+        //  prelude of its own and never to an -o output name
+        auto name        = std::exchange( flag_include_prelude, {} );
+        auto output_name = std::exchange( flag_cpp1_filename,   {} );
+
+        prelude = std::make_unique<cppfront>( name );
+        prelude->lower_to_cpp1();
+        if (!prelude->had_no_errors()) {
+            prelude->print_errors( std::cerr );
+            return EXIT_FAILURE;
+        }
+        prelude->share_globals_as_prelude();
+
+        //  Everything the prelude interned - which is most of the common
+        //  identifier spellings - becomes the shared read-only base of
+        //  every thread's interner, instead of being re-interned per worker
+        interned_identifiers.freeze_as_shared_base();
+
+        flag_include_prelude = name;
+        flag_cpp1_filename   = output_name;
+    }
+
+    //  compile_one: compile a single named source file, reporting progress
+    //  and results on 'out' and error messages on 'err' - returns whether
+    //  the compile succeeded
+    //
+    //  'preloaded' optionally carries the file's bytes if a read-ahead
+    //  already fetched them - see the sequential driver loop below
+    //
+    auto compile_one = [](
+        std::string const&         name,
+        std::ostream&              cout,
+        std::ostream&              cerr,
+        std::optional<std::string> preloaded = {}
+    )
+        -> bool
+    {
+        auto ok = true;
+
+        auto prof = profiler.scope(name);
+
+        //  Start this file's allocation counters from zero, so -verbose
+        //  reports per-file numbers
+        heapinstr::reset();
+
+        //  And its generated-name labels, so the output is byte-identical
+        //  no matter what this thread compiled before it
+        reset_labelized_positions(name);
+
+        auto hw_start = cpp2::this_thread_counters.read();
 
         cpp2::timer t;
         t.start();
 
-        auto& out = flag_cpp1_filename != "stdout" ? std::cout : std::cerr;
+        auto& out = flag_cpp1_filename != "stdout" ? cout : cerr;
+
+        //  If we have a cache directory, see whether we already have the
+        //  generated output for this exact source content + flag state,
+        //  and if so just copy it into place instead of recompiling
+        //
+        auto cache_file   = std::filesystem::path{};
+        auto cache_target = std::string{};
+        if (
+            !flag_cache_dir.empty()
+            && name != "stdin"
+            && cpp2::flag_cpp1_filename != "stdout"
+            )
+        {
+            //  Mirror the output naming done in lower_to_cpp1
+            cache_target = name.substr(0, std::max(std::ssize(name)-1, ptrdiff_t{0}));
+            if (!flag_cpp1_filename.empty()) {
+                cache_target = cpp2::flag_cpp1_filename;
+            }
+            else {
+                cache_target = std::filesystem::path(cache_target).filename().string();
+            }
+
+            auto contents = std::optional<std::string>{};
+            if (preloaded) {
+                contents = *preloaded;
+            }
+            else if (auto source_text = std::ifstream{ name, std::ios::binary };
+                source_text.is_open()
+                )
+            {
+                contents = std::string{
+                    std::istreambuf_iterator<char>(source_text),
+                    std::istreambuf_iterator<char>()
+                };
+            }
+            if (contents)
+            {
+                cache_file =
+                    std::filesystem::path{ flag_cache_dir }
+                    / (hash_string( *contents + '\0' + flags_fingerprint() ) + ".cpp");
+
+                auto ec = std::error_code{};
+                if (std::filesystem::copy_file(
+                        cache_file,
+                        cache_target,
+                        std::filesystem::copy_options::overwrite_existing,
+                        ec
+                    ))
+                {
+                    if (!flag_quiet) {
+                        out << name << "... ok (cached)\n";
+                    }
+                    return true;
+                }
+            }
+        }
 
         if (
             !flag_quiet
-            && arg.text != "stdin"
-            && flag_cpp1_filename != "stdout"
-            ) 
+            && name != "stdin"
+            && cpp2::flag_cpp1_filename != "stdout"
+            )
         {
-            out << arg.text << "...";
+            out << name << "...";
         }
 
-        //  Load + lex + parse + sema
-        cppfront c(arg.text);
+        //  Load + lex + parse + sema (skipping the file read if the
+        //  driver's read-ahead already has the bytes in hand)
+        auto c =
+            preloaded
+            ? cppfront{ name, std::move(*preloaded) }
+            : cppfront{ name }
+            ;
 
         //  Generate Cpp1 (this may catch additional late errors)
         auto count = c.lower_to_cpp1();
 
+        if (!flag_stats.empty()) {
+            auto entry = std::ostringstream{};
+            c.emit_stats( entry );
+            auto lock = std::lock_guard{ stats_mutex };
+            stats_entries.push_back( entry.str() );
+        }
+
+        if (!flag_budget.empty()) {
+            auto entry = c.get_instantiation_budget();
+            auto lock = std::lock_guard{ budget_mutex };
+            budget_entries.push_back( std::move(entry) );
+        }
+
         //  If there were no errors, say so and generate Cpp1
         if (c.had_no_errors())
         {
             if (
                 !flag_quiet
-                && flag_cpp1_filename != "stdout"
+                && cpp2::flag_cpp1_filename != "stdout"
                 )
             {
-                if (!c.has_cpp1()) {
+                if (flag_parse_only) {
+                    out << " ok (parse only, no output)\n";
+                }
+                else if (flag_check_only) {
+                    out << " ok (passes safety checks, no output)\n";
+                }
+                else if (!c.has_cpp1()) {
                     out << " ok (all Cpp2, passes safety checks)\n";
                 }
                 else if (c.has_cpp2()) {
@@ -138,19 +1095,32 @@ auto main(
 
                     t.stop();
                     auto total_time = print_with_thousands(t.elapsed().count());
-                    std::cout << "\n   Time  " << total_time << " ms";
+                    out << "\n   Time  " << total_time << " ms";
+
+                    //  Hardware counters, where the platform + kernel allow it
+                    if (auto hw = cpp2::this_thread_counters.read() - hw_start;
+                        hw.is_valid()
+                        )
+                    {
+                        out << "\n   HW    "
+                            << print_with_thousands(hw.instructions)  << " instructions, "
+                            << print_with_thousands(hw.cache_misses)  << " cache misses, "
+                            << print_with_thousands(hw.branch_misses) << " branch mispredicts";
+                    }
 
                     std::multimap< long long, std::string_view, std::greater<> > sorted_timers;
-                    for (auto [name, t] : timers) {
-                        sorted_timers.insert({t.elapsed().count(), name});
+                    for (auto [name_, t_] : timers) {
+                        sorted_timers.insert({t_.elapsed().count(), name_});
                     }
 
-                    for (auto [elapsed, name] : sorted_timers) {
-                        std::cout
+                    for (auto [elapsed, name_] : sorted_timers) {
+                        out
                             << "\n         "
                             << std::right << std::setw(unchecked_narrow<int>(total_time.size()))
-                            << print_with_thousands(elapsed) << " ms" << " in " << name;
+                            << print_with_thousands(elapsed) << " ms" << " in " << name_;
                     }
+
+                    heapinstr::print(out);
                 }
 
                 out << "\n";
@@ -159,22 +1129,654 @@ auto main(
         //  Otherwise, print the errors
         else
         {
-            std::cerr << "\n";
-            c.print_errors();
-            std::cerr << "\n";
-            exit_status = EXIT_FAILURE;
+            cerr << "\n";
+            c.print_errors(cerr);
+            cerr << "\n";
+            ok = false;
         }
 
         //  And, if requested, the debug information
         if (flag_debug_output) {
             c.debug_print();
         }
+
+        //  And, if requested, the compact symbol-table export for tooling
+        if (
+            ok
+            && !flag_emit_symbols.empty()
+            && !c.emit_symbols( flag_emit_symbols )
+            )
+        {
+            cerr << "cppfront: error: could not write " << flag_emit_symbols << "\n";
+            ok = false;
+        }
+
+        //  On a successful compile, populate the cache for next time -
+        //  closing the output first, so we copy the complete file and
+        //  not a snapshot of a still-buffered one
+        //
+        if (
+            ok
+            && !cache_file.empty()
+            )
+        {
+            c.close_output();
+            auto ec = std::error_code{};
+            std::filesystem::create_directories( cache_file.parent_path(), ec );
+            std::filesystem::copy_file(
+                cache_target,
+                cache_file,
+                std::filesystem::copy_options::overwrite_existing,
+                ec
+            );
+        }
+
+        return ok;
+    };
+
+    //  compile_one_isolated: the per-file firewall around compile_one.
+    //  A hard failure in one file - an exception escaping a phase
+    //  rather than a diagnosed source error - shouldn't take down the
+    //  rest of a batch, and under -jobs an escaping exception would
+    //  terminate the whole process with it. Contain it here, report it
+    //  against the file it happened in, and let the driver (or the
+    //  worker's loop) move on to the next file
+    //
+    auto compile_one_isolated = [&](
+        std::string const&         name,
+        std::ostream&              cout,
+        std::ostream&              cerr,
+        std::optional<std::string> preloaded = {}
+    )
+        -> bool
+    {
+        try {
+            return compile_one( name, cout, cerr, std::move(preloaded) );
+        }
+        catch (std::exception const& e) {
+            cerr << name << ": error: internal compiler error - " << e.what() << "\n";
+        }
+        catch (...) {
+            cerr << name << ": error: internal compiler error - unknown exception\n";
+        }
+        return false;
+    };
+
+    //  In daemon mode, stay resident in a warm process (static-init and
+    //  flag setup already paid for) and accept one compile request per
+    //  stdin line: "file" or "file outfile". An empty line, "exit", or
+    //  EOF ends the session. Every reply is terminated by a
+    //  "cppfront: done <0|1>" line so build tools can frame responses.
+    //
+    //  In watch mode, stay resident like the daemon but drive compiles
+    //  from the filesystem: recompile a watched .cpp2/.h2 file as soon
+    //  as its modification time changes. Polling by mtime keeps this
+    //  portable across every platform cppfront builds on; the warm
+    //  process means a save pays only for the compile itself
+    //
+    if (!flag_watch_dir.empty())
+    {
+        auto dir = std::filesystem::path{ flag_watch_dir };
+        auto ec  = std::error_code{};
+        if (!std::filesystem::is_directory(dir, ec)) {
+            std::cerr << "cppfront: error: -watch argument '" << flag_watch_dir << "' is not a directory\n";
+            return EXIT_FAILURE;
+        }
+
+        auto is_cpp2_source = [](std::filesystem::path const& p) {
+            auto ext = p.extension().string();
+            return
+                ext == ".cpp2"
+                || ext == ".h2"
+                ;
+        };
+
+        std::cout << "cppfront: watching " << dir.string() << " (Ctrl-C to stop)\n";
+
+        auto mtimes       = std::map<std::string, std::filesystem::file_time_type>{};
+        auto exit_status  = EXIT_SUCCESS;
+        for (;;)
+        {
+            //  Collect the files whose mtime changed since the last scan -
+            //  on the first scan, that's every watched file
+            //
+            auto changed = std::vector<std::string>{};
+            for (auto const& entry : std::filesystem::recursive_directory_iterator{ dir, ec })
+            {
+                if (
+                    !entry.is_regular_file(ec)
+                    || !is_cpp2_source(entry.path())
+                    )
+                {
+                    continue;
+                }
+                auto time = entry.last_write_time(ec);
+                if (ec) {
+                    continue;
+                }
+                auto [iter, inserted] = mtimes.try_emplace(entry.path().string(), time);
+                if (
+                    inserted
+                    || iter->second != time
+                    )
+                {
+                    iter->second = time;
+                    changed.push_back(iter->first);
+                }
+            }
+
+            for (auto const& file : changed) {
+                exit_status =
+                    compile_one_isolated( file, std::cout, std::cerr )
+                    ? exit_status
+                    : EXIT_FAILURE
+                    ;
+                std::cerr.flush();
+                std::cout.flush();
+            }
+
+            //  Write anything -batched-output queued for this scan's files
+            for (auto const& file : cpp2::the_output_batcher.write_all( flag_jobs )) {
+                std::cerr << "cppfront: error: could not write output file " << file << "\n";
+                exit_status = EXIT_FAILURE;
+            }
+
+            std::this_thread::sleep_for( std::chrono::milliseconds{250} );
+        }
+
+        //  Not reached - watch mode runs until the process is interrupted
+        return exit_status;
+    }
+
+    if (flag_daemon)
+    {
+        //  The warm process also remembers, per file, the source
+        //  fingerprint and generated output of its last successful
+        //  compile, and replays that output when a request names a file
+        //  whose content hasn't changed since - the common case when a
+        //  build tool re-submits its whole file list after a small edit
+        //
+        struct daemon_memo {
+            std::string fingerprint;
+            std::string target;
+            std::string output;
+        };
+        auto memos = std::unordered_map<std::string, daemon_memo>{};
+
+        auto interner_saved_size = size_t{0};
+
+        auto request = std::string{};
+        while (std::getline(std::cin, request))
+        {
+            if (
+                request.empty()
+                || request == "exit"
+                )
+            {
+                break;
+            }
+
+            auto file         = request;
+            auto saved_output = flag_cpp1_filename;
+            if (auto space = request.find(' ');
+                space != request.npos
+                )
+            {
+                file               = request.substr(0, space);
+                flag_cpp1_filename = request.substr(space+1);
+            }
+
+            //  Mirror the output naming done in lower_to_cpp1
+            auto target = cpp2::flag_cpp1_filename;
+            if (target.empty()) {
+                target = std::filesystem::path(
+                    file.substr(0, std::max(std::ssize(file)-1, ptrdiff_t{0}))
+                ).filename().string();
+            }
+
+            auto fingerprint = std::string{};
+            if (
+                file != "stdin"
+                && cpp2::flag_cpp1_filename != "stdout"
+                )
+            {
+                if (auto source_text = std::ifstream{ file, std::ios::binary };
+                    source_text.is_open()
+                    )
+                {
+                    auto contents = std::string{
+                        std::istreambuf_iterator<char>(source_text),
+                        std::istreambuf_iterator<char>()
+                    };
+                    fingerprint = hash_string( contents + '\0' + flags_fingerprint() );
+                }
+            }
+
+            auto ok = false;
+            if (auto memo = memos.find(file);
+                !fingerprint.empty()
+                && memo != memos.end()
+                && memo->second.fingerprint == fingerprint
+                && memo->second.target      == target
+                )
+            {
+                //  Unchanged since the last successful compile -
+                //  just rewrite the remembered output
+                auto out_file = std::ofstream{ target, std::ios::binary };
+                ok = out_file.is_open();
+                if (ok) {
+                    out_file << memo->second.output;
+                    if (!flag_quiet) {
+                        std::cout << file << "... ok (unchanged)\n";
+                    }
+                }
+            }
+
+            if (!ok)
+            {
+                ok = compile_one_isolated( file, std::cout, std::cerr );
+
+                //  Under -batched-output the output is still queued - write
+                //  it now, so the read-back below and the reply both mean
+                //  the file is on disk
+                for (auto const& f : cpp2::the_output_batcher.write_all( flag_jobs )) {
+                    std::cerr << "cppfront: error: could not write output file " << f << "\n";
+                    ok = false;
+                }
+
+                //  On success, remember the output for next time
+                if (
+                    ok
+                    && !fingerprint.empty()
+                    )
+                {
+                    if (auto out_text = std::ifstream{ target, std::ios::binary };
+                        out_text.is_open()
+                        )
+                    {
+                        memos[file] = {
+                            fingerprint,
+                            target,
+                            std::string{
+                                std::istreambuf_iterator<char>(out_text),
+                                std::istreambuf_iterator<char>()
+                            }
+                        };
+                    }
+                }
+                else {
+                    memos.erase(file);
+                }
+            }
+
+            flag_cpp1_filename = saved_output;
+            std::cerr.flush();
+            std::cout << "cppfront: done " << (ok ? 0 : 1) << std::endl;
+
+            //  Keep the on-disk snapshot current whenever this request
+            //  interned new spellings, so even a daemon that is killed
+            //  mid-day leaves a warm table behind for its replacement
+            if (
+                !interner_snapshot.empty()
+                && interned_identifiers.size() > interner_saved_size
+                )
+            {
+                interned_identifiers.save_snapshot( interner_snapshot, interner_header );
+                interner_saved_size = interned_identifiers.size();
+            }
+        }
+
+        if (profiler.is_active()) {
+            profiler.save(flag_profile_filename);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    //  For each Cpp2 source file
+    int exit_status = EXIT_SUCCESS;
+
+    auto const& args = cmdline.arguments();
+
+    //  If -jobs asked for more than one worker and we have more than one
+    //  file, compile the files on a small thread pool with per-file output
+    //  buffers that are merged in command line order at the end
+    //
+    if (
+        flag_jobs > 1
+        && std::ssize(args) > 1
+        )
+    {
+        struct file_result {
+            std::ostringstream out;
+            std::ostringstream err;
+            bool               ok = true;
+        };
+        auto results = std::vector<file_result>( args.size() );
+
+        //  An idle worker takes the next ready file the moment it
+        //  finishes one. Which file is "ready," and which of the ready
+        //  ones it should take, comes from the batch's import graph:
+        //
+        //  - If batch files import each other (quoted imports/#includes
+        //    naming another file of this batch, found by the -scan-deps
+        //    scanner), a file only becomes ready once the files it
+        //    imports are done, so a dependent never runs ahead of the
+        //    outputs it consumes.
+        //
+        //  - Among the ready files, take the one heading the heaviest
+        //    remaining dependency chain, with file sizes as the cost
+        //    model. Plain FIFO can leave a deep chain for last and then
+        //    walk it alone while every other worker idles; starting the
+        //    critical path first bounds the batch near that chain. With
+        //    no intra-batch imports this degenerates to the largest-
+        //    first handout used before.
+        //
+        auto sizes = std::vector<uintmax_t>( args.size() );
+        for (auto i = size_t{0}; i < args.size(); ++i) {
+            auto ec  = std::error_code{};
+            auto s   = std::filesystem::file_size( args[i].text, ec );
+            sizes[i] = ec ? 0 : s;
+        }
+
+        //  Build the intra-batch edges: each argument is known by its
+        //  own name and by its name minus the trailing '2' - the
+        //  generated output an importer would actually name
+        //
+        auto index_of = std::unordered_map<std::string, size_t>{};
+        auto norm     = [](std::string const& s) {
+            return std::filesystem::path{ s }.lexically_normal().string();
+        };
+        for (auto i = size_t{0}; i < args.size(); ++i) {
+            index_of.try_emplace( norm(args[i].text), i );
+            if (args[i].text.ends_with("2")) {
+                index_of.try_emplace( norm(args[i].text.substr(0, args[i].text.size()-1)), i );
+            }
+        }
+
+        auto deps       = std::vector<std::vector<size_t>>( args.size() );
+        auto dependents = std::vector<std::vector<size_t>>( args.size() );
+        for (auto i = size_t{0}; i < args.size(); ++i) {
+            auto errors = std::vector<cpp2::error_entry>{};
+            auto src    = cpp2::source{ errors };
+            if (!src.load(args[i].text)) {
+                continue;   //  compile_one will report the failure
+            }
+            for (auto const& dep : collect_quoted_deps(src)) {
+                if (auto it = index_of.find(norm(dep));
+                    it != index_of.end()
+                    && it->second != i
+                    )
+                {
+                    deps[i].push_back(it->second);
+                    dependents[it->second].push_back(i);
+                }
+            }
+        }
+
+        //  Critical-path priorities, computed dependents-first: a
+        //  file's priority is its own cost plus the heaviest chain
+        //  hanging off it. Kahn's sweep doubles as the cycle check -
+        //  if an import cycle keeps it from covering every file, drop
+        //  the edges and fall back to plain largest-first rather than
+        //  deadlock the pool on a graph that can't be ordered
+        //
+        auto priority = sizes;
+        {
+            auto remaining = std::vector<size_t>( args.size() );
+            auto leaves    = std::vector<size_t>{};
+            for (auto i = size_t{0}; i < args.size(); ++i) {
+                remaining[i] = dependents[i].size();
+                if (remaining[i] == 0) {
+                    leaves.push_back(i);
+                }
+            }
+            auto covered = size_t{0};
+            while (!leaves.empty()) {
+                auto i = leaves.back();
+                leaves.pop_back();
+                ++covered;
+                for (auto d : dependents[i]) {
+                    priority[i] = std::max( priority[i], sizes[i] + priority[d] );
+                }
+                for (auto j : deps[i]) {
+                    if (--remaining[j] == 0) {
+                        leaves.push_back(j);
+                    }
+                }
+            }
+            if (covered < args.size()) {
+                for (auto i = size_t{0}; i < args.size(); ++i) {
+                    deps[i].clear();
+                    dependents[i].clear();
+                }
+                priority = sizes;
+            }
+        }
+
+        //  The shared ready heap: highest critical-path priority first,
+        //  lowest index on ties so the schedule is deterministic
+        //
+        auto by_priority = [&](size_t a, size_t b) {
+            return
+                priority[a] != priority[b]
+                ? priority[a] < priority[b]
+                : a > b
+                ;
+        };
+        auto mutex     = std::mutex{};
+        auto work_cv   = std::condition_variable{};
+        auto ready     = std::priority_queue<size_t, std::vector<size_t>, decltype(by_priority)>{ by_priority };
+        auto pending   = std::vector<size_t>( args.size() );
+        auto scheduled = size_t{0};
+        for (auto i = size_t{0}; i < args.size(); ++i) {
+            pending[i] = deps[i].size();
+            if (pending[i] == 0) {
+                ready.push(i);
+            }
+        }
+
+        auto work = [&](int worker) {
+            //  With -profile, record each worker's span with its busy time
+            //  and file count attached, so per-worker utilization (busy
+            //  time over span) is visible in the trace
+            auto prof    = profiler.scope( "worker " + std::to_string(worker) );
+            auto busy_ms = (long long){0};
+            auto files   = (long long){0};
+
+            for (;;)
+            {
+                auto lock = std::unique_lock{ mutex };
+                work_cv.wait(
+                    lock,
+                    [&]{ return !ready.empty() || scheduled == args.size(); }
+                );
+                if (ready.empty()) {
+                    break;
+                }
+                auto i = ready.top();
+                ready.pop();
+                ++scheduled;
+                lock.unlock();
+
+                cpp2::timer t;
+                t.start();
+                results[i].ok = compile_one_isolated( args[i].text, results[i].out, results[i].err );
+                t.stop();
+                busy_ms += t.elapsed().count();
+                ++files;
+
+                lock.lock();
+                for (auto d : dependents[i]) {
+                    if (--pending[d] == 0) {
+                        ready.push(d);
+                    }
+                }
+                lock.unlock();
+                work_cv.notify_all();
+            }
+
+            profiler.count( "files"  , files   );
+            profiler.count( "busy-ms", busy_ms );
+        };
+
+        auto workers = std::vector<std::thread>{};
+        for (auto n = 0; n < std::min(flag_jobs, _as<int>(std::ssize(args))); ++n) {
+            workers.emplace_back( work, n );
+
+            //  With -numa, pin each worker to one CPU so the scheduler
+            //  can't migrate it across sockets mid-compile. Everything a
+            //  compile allocates - token buffer, AST arena, sema symbols -
+            //  is allocated and first-touched on its worker's thread, so
+            //  a worker that stays put keeps all of it on its own node's
+            //  memory; migration is the only thing that breaks that
+            //
+            #if defined(__linux__)
+            if (flag_numa) {
+                auto cpus = std::max( 1u, std::thread::hardware_concurrency() );
+                cpu_set_t set;
+                CPU_ZERO( &set );
+                CPU_SET( _as<unsigned>(n) % cpus, &set );
+                pthread_setaffinity_np( workers.back().native_handle(), sizeof(set), &set );
+            }
+            #endif
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+
+        for (auto& r : results) {
+            std::cout << r.out.str();
+            std::cerr << r.err.str();
+            if (!r.ok) {
+                exit_status = EXIT_FAILURE;
+            }
+        }
+    }
+
+    //  Else compile them one at a time, streaming output as we go, and
+    //  overlapping I/O with compute: while one file compiles, a reader
+    //  thread fetches the next file's bytes, so a cold-cache or networked
+    //  filesystem read is hidden behind the previous compile instead of
+    //  serialized after it. Only raw bytes cross the thread boundary -
+    //  lex/parse/sema stay on this thread, whose thread-local arenas and
+    //  interner they use
+    //
+    else
+    {
+        auto next_text = std::optional<std::string>{};
+        auto reader    = std::thread{};
+
+        auto start_read = [&](std::string const& name) {
+            reader = std::thread{ [&next_text, name] {
+                if (auto f = std::ifstream{ name, std::ios::binary };
+                    f.is_open()
+                    )
+                {
+                    next_text = std::string{
+                        std::istreambuf_iterator<char>(f),
+                        std::istreambuf_iterator<char>()
+                    };
+                }
+            } };
+        };
+
+        for (auto i = size_t{0}; i < args.size(); ++i)
+        {
+            //  Take what the previous iteration's read-ahead fetched
+            //  (nothing on the first iteration, or if the read failed -
+            //  then compile_one reads the file itself and reports any
+            //  error the usual way), and start fetching the next file
+            auto text = std::exchange( next_text, {} );
+            if (i+1 < args.size()) {
+                start_read( args[i+1].text );
+            }
+
+            if (!compile_one_isolated( args[i].text, std::cout, std::cerr, std::move(text) )) {
+                exit_status = EXIT_FAILURE;
+            }
+
+            if (reader.joinable()) {
+                reader.join();
+            }
+        }
+    }
+
+    //  Under -batched-output everything the printers produced is still
+    //  queued in memory - write the whole batch now with grouped writes
+    for (auto const& file : cpp2::the_output_batcher.write_all( flag_jobs )) {
+        std::cerr << "cppfront: error: could not write output file " << file << "\n";
+        exit_status = EXIT_FAILURE;
     }
 
     //if (flag_internal_debug) {
+    #ifdef CPP2_RULE_INSTR
+    ruleinstr::print_table();
+    #endif
+
     //    stackinstr::print_deepest();
     //    stackinstr::print_largest();
     //}
 
+    if (!flag_stats.empty())
+    {
+        auto out = std::ofstream{ flag_stats };
+        if (!out.is_open()) {
+            std::cerr << "cppfront: error: could not write -stats file '" << flag_stats << "'\n";
+            exit_status = EXIT_FAILURE;
+        }
+        else {
+            out << "[";
+            for (auto first = true; auto const& e : stats_entries) {
+                out << (first ? "\n" : ",\n") << e;
+                first = false;
+            }
+            out << "\n]\n";
+        }
+    }
+
+    if (!flag_budget.empty())
+    {
+        auto out = std::ofstream{ flag_budget };
+        if (!out.is_open()) {
+            std::cerr << "cppfront: error: could not write -budget file '" << flag_budget << "'\n";
+            exit_status = EXIT_FAILURE;
+        }
+        else {
+            std::sort(
+                budget_entries.begin(), budget_entries.end(),
+                [](auto const& a, auto const& b) { return a.estimated_cost() > b.estimated_cost(); }
+            );
+            auto total = 0LL;
+            for (auto const& e : budget_entries) {
+                total += e.estimated_cost();
+            }
+
+            //  The cum% column answers "which few files cost half our
+            //  downstream compile time" at a glance
+            out << "Estimated template instantiation cost per file, highest first\n\n"
+                << "   cost   cum%   ufcs  is/as  inspect  interp  file\n";
+            auto running = 0LL;
+            for (auto const& e : budget_entries) {
+                running += e.estimated_cost();
+                out << std::setw(7) << e.estimated_cost()
+                    << std::setw(6) << (total > 0 ? 100*running/total : 0) << "%"
+                    << std::setw(7) << e.ufcs_calls
+                    << std::setw(7) << e.is_as_tests
+                    << std::setw(9) << e.inspect_arms
+                    << std::setw(8) << e.interpolations
+                    << "  " << e.file << "\n";
+            }
+        }
+    }
+
+    if (
+        profiler.is_active()
+        && !profiler.save(flag_profile_filename)
+        )
+    {
+        std::cerr << "cppfront: error: could not write profile to " << flag_profile_filename << "\n";
+        exit_status = EXIT_FAILURE;
+    }
+
     return exit_status;
 }
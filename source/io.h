@@ -28,9 +28,9 @@ namespace cpp2 {
 //  p       predicate to apply
 //
 auto move_next(
-    std::string const& line,
-    int&               i,
-    auto               p
+    std::string_view line,
+    int&             i,
+    auto             p
 )
     -> bool
 {
@@ -54,7 +54,7 @@ auto move_next(
 //
 //  line    current line being processed
 //
-auto peek_first_non_whitespace(std::string const& line)
+auto peek_first_non_whitespace(std::string_view line)
     -> char
 {
     auto i = 0;
@@ -80,8 +80,8 @@ struct is_preprocessor_ret {
     bool has_continuation;
 };
 auto is_preprocessor(
-    std::string const& line,
-    bool               first_line
+    std::string_view line,
+    bool             first_line
 )
     -> is_preprocessor_ret
 {
@@ -104,7 +104,7 @@ auto is_preprocessor(
 //
 //  line    current line being processed
 //
-auto starts_with_import(std::string const& line)
+auto starts_with_import(std::string_view line)
     -> bool
 {
     auto i = 0;
@@ -117,7 +117,7 @@ auto starts_with_import(std::string const& line)
     static constexpr auto import_keyword = std::string_view{"import"};
 
     // the first token must begin with 'import'
-    if (!std::string_view(line).substr(i).starts_with(import_keyword)) {
+    if (!line.substr(i).starts_with(import_keyword)) {
         return false;
     }
 
@@ -131,7 +131,7 @@ auto starts_with_import(std::string const& line)
 //
 //  line    current line being processed
 //
-auto starts_with_whitespace_slash_slash(std::string const& line)
+auto starts_with_whitespace_slash_slash(std::string_view line)
     -> bool
 {
     auto i = 0;
@@ -154,7 +154,7 @@ auto starts_with_whitespace_slash_slash(std::string const& line)
 //
 //  line    current line being processed
 //
-auto starts_with_whitespace_slash_star_and_no_star_slash(std::string const& line)
+auto starts_with_whitespace_slash_star_and_no_star_slash(std::string_view line)
     -> bool
 {
     auto i = 0;
@@ -271,7 +271,7 @@ auto starts_with_operator(std::string_view s)
 //
 //  line    current line being processed
 //
-auto starts_with_identifier_colon(std::string const& line)
+auto starts_with_identifier_colon(std::string_view line)
     -> bool
 {
     auto i = 0;
@@ -503,7 +503,7 @@ enum class preprocessor_conditional : u8 {
     none = 0, pre_if, pre_else, pre_endif
 };
 auto starts_with_preprocessor_if_else_endif(
-    std::string const& line
+    std::string_view line
 )
     -> preprocessor_conditional
 {
@@ -553,7 +553,7 @@ struct process_line_ret {
     bool all_rawstring_line;
 };
 auto process_cpp_line(
-    std::string const&  line,
+    std::string_view    line,
     bool&               in_comment,
     bool&               in_string_literal,
     bool&               in_raw_string_literal,
@@ -634,7 +634,7 @@ auto process_cpp_line(
                                 paren_pos != line.npos
                                 )
                             {
-                                raw_string_closing_seq = ")"+line.substr(i, paren_pos-i)+"\"";
+                                raw_string_closing_seq = std::string{")"} + line.substr(i, paren_pos-i) + "\"";
                                 in_raw_string_literal = true;
                             }
                         }
@@ -708,7 +708,7 @@ auto process_cpp_line(
 //  Returns:    whether additional lines should be inspected
 //
 auto process_cpp2_line(
-    std::string const&        line,
+    std::string_view          line,
     bool&                     in_comment,
     braces_tracker&           braces,
     lineno_t                  lineno,
@@ -833,10 +833,7 @@ class source
     bool                      cpp1_found = false;
     bool                      cpp2_found = false;
 
-    static const int max_line_len = 90'000;
-        //  do not reduce this - I encountered an 80,556-char
-        //  line in real world code during testing
-    char buf[max_line_len] {0};
+    std::string buffer;             // the whole file, read with one read
 
 public:
     //-----------------------------------------------------------------------
@@ -882,17 +879,103 @@ public:
     )
         -> bool
     {
-        //  If filename is stdin, we read from stdin, otherwise we try to read the file
+        auto prof = profiler.scope("load");
+
+        //  Read the whole input (stdin too) into one contiguous buffer with
+        //  a single read, and process lines as zero-copy views into that
+        //  buffer - much faster than getline'ing large generated files,
+        //  and all source_line entries stay views into this one allocation
         //
-        auto is_stdin = filename == "stdin";
-        std::ifstream fss;
-        if (!is_stdin) 
+        if (filename == "stdin")
+        {
+            buffer.assign(
+                std::istreambuf_iterator<char>(std::cin),
+                std::istreambuf_iterator<char>()
+            );
+        }
+        else
         {
-            fss.open(filename);
+            std::ifstream fss( filename, std::ios::binary );
             if( !fss.is_open()) { return false; }
+            fss.seekg( 0, std::ios::end );
+            buffer.resize( _as<size_t>(std::streamoff(fss.tellg())) );
+            fss.seekg( 0, std::ios::beg );
+            fss.read( buffer.data(), std::ssize(buffer) );
+            if (
+                !fss.good()
+                && !fss.eof()
+                )
+            {
+                return false;
+            }
         }
-        std::istream& in = is_stdin ? std::cin : fss;
-    
+
+        return process_buffer();
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  load_text: like load, but from an in-memory source text instead of
+    //             a file - see cpp2::compile
+    //
+    //  text                    program textual representation
+    //
+    auto load_text(
+        std::string text
+    )
+        -> bool
+    {
+        auto prof = profiler.scope("load");
+        buffer = std::move(text);
+        return process_buffer();
+    }
+
+private:
+    //-----------------------------------------------------------------------
+    //  process_buffer: categorize 'buffer' into source lines
+    //
+    auto process_buffer()
+        -> bool
+    {
+        //  Validate the whole buffer as UTF-8 once up front, so the lexer
+        //  can treat bytes >= 0x80 as opaque without rechecking structure
+        //  (and so a bad byte is reported with a clear message instead of
+        //  surfacing later as a confusing token error)
+        //
+        if (auto bad = validate_utf8(buffer);
+            bad >= 0
+            )
+        {
+            auto lineno = lineno_t{1};
+            auto last   = decltype(bad){-1};
+            for (auto i = decltype(bad){0}; i < bad; ++i) {
+                if (buffer[i] == '\n') {
+                    ++lineno;
+                    last = i;
+                }
+            }
+            errors.emplace_back(
+                source_position( lineno, unchecked_narrow<colno_t>(bad - last) ),
+                "file is not valid UTF-8 - malformed byte sequence here"
+            );
+            return false;
+        }
+
+        //  get_line: makes 'line' refer to the next source line, if there is one
+        //
+        auto next_offset = size_t{0};
+        auto line        = std::string_view{};
+        auto get_line = [&]() -> bool {
+            if (next_offset >= buffer.size()) { return false; }
+            auto end = buffer.find('\n', next_offset);
+            if (end == buffer.npos) { end = buffer.size(); }
+            line = std::string_view{ buffer }.substr( next_offset, end - next_offset );
+            //  Tolerate Windows line endings
+            if (line.ends_with('\r')) { line.remove_suffix(1); }
+            next_offset = end + 1;
+            return true;
+        };
+
         auto in_comment            = false;
         auto in_string_literal     = false;
         auto in_raw_string_literal = false;
@@ -901,7 +984,7 @@ public:
         auto braces = braces_tracker(errors);
 
         auto add_preprocessor_line = [&] {
-            lines.push_back({ &buf[0], source_line::category::preprocessor });
+            lines.push_back({ line, source_line::category::preprocessor });
             if (auto pre = starts_with_preprocessor_if_else_endif(lines.back().text);
                 pre != preprocessor_conditional::none
                 )
@@ -919,11 +1002,11 @@ public:
             }
         };
 
-        while (in.getline(&buf[0], max_line_len)) {
+        while (get_line()) {
 
             //  Handle preprocessor source separately, they're outside the language
             //
-            if (auto pre = is_preprocessor(buf, true);
+            if (auto pre = is_preprocessor(line, true);
                 pre.is_preprocessor
                 && !in_comment
                 && !in_raw_string_literal
@@ -933,17 +1016,17 @@ public:
                 add_preprocessor_line();
                 while (
                     pre.has_continuation
-                    && in.getline(&buf[0], max_line_len)
+                    && get_line()
                     )
                 {
                     add_preprocessor_line();
-                    pre = is_preprocessor(buf, false);
+                    pre = is_preprocessor(line, false);
                 }
             }
 
             else
             {
-                lines.push_back({ &buf[0], source_line::category::cpp1 });
+                lines.push_back({ line, source_line::category::cpp1 });
 
                 //  Switch to cpp2 mode if we're not in a comment, not inside nested { },
                 //  and the line starts with "nonwhitespace :" but not "::"
@@ -979,10 +1062,10 @@ public:
                             unchecked_narrow<lineno_t>(std::ssize(lines)-1),
                             errors
                         )
-                        && in.getline(&buf[0], max_line_len)
+                        && get_line()
                         )
                     {
-                        lines.push_back({ &buf[0], source_line::category::cpp2 });
+                        lines.push_back({ line, source_line::category::cpp2 });
                     }
                 }
 
@@ -1015,43 +1098,44 @@ public:
                         else {
                             cpp1_found = true;
                         }
+
+                        //  Fast path: while a raw string literal stays open past
+                        //  this line, its continuation lines can't contain
+                        //  anything the per-line scan needs to react to, so
+                        //  find the closing delimiter with one search over the
+                        //  contiguous buffer and swallow every whole line
+                        //  before it in one step. The line holding the
+                        //  delimiter itself goes back through the per-line
+                        //  scan, which closes the literal and processes the
+                        //  rest of that line as usual
+                        //
+                        if (in_raw_string_literal) {
+                            auto close = buffer.find(raw_string_closing_seq, next_offset);
+                            auto stop  = close == buffer.npos ? buffer.size() : close;
+                            while (next_offset < buffer.size()) {
+                                auto end = buffer.find('\n', next_offset);
+                                if (end == buffer.npos) { end = buffer.size(); }
+                                if (end >= stop) {
+                                    break;
+                                }
+                                auto raw_line = std::string_view{ buffer }.substr( next_offset, end - next_offset );
+                                if (raw_line.ends_with('\r')) { raw_line.remove_suffix(1); }
+                                lines.push_back({ raw_line, source_line::category::rawstring });
+                                next_offset = end + 1;
+                            }
+                        }
                     }
                 }
 
             }
         }
 
-        //  Because I encountered very long lines in real-world code during testing
-        //
-        if (in.gcount() >= max_line_len-1)
-        {
-            errors.emplace_back(
-                source_position(lineno_t(std::ssize(lines)), 0),
-                std::string("source line too long - length must be less than ")
-                    + std::to_string(max_line_len)
-            );
-            return false;
-        }
-
-        //  This shouldn't be possible, so check it anyway
-        //
-        if (!in.eof())
-        {
-            errors.emplace_back(
-                source_position(lineno_t(std::ssize(lines)), 0),
-                std::string("unexpected error reading source lines - did not reach EOF"),
-                false,
-                true    // a noisy fallback error
-            );
-            return false;
-        }
-
         braces.found_eof( source_position(lineno_t(std::ssize(lines)), 0) );
 
         return true;
     }
 
-
+public:
     //-----------------------------------------------------------------------
     //  get_lines: Access the source lines
     //
@@ -15,6 +15,7 @@
 
 #include "io.h"
 #include <map>
+#include <unordered_set>
 #include <climits>
 #include <cstring>
 
@@ -99,16 +100,52 @@ enum class lexeme : i8 {
     None = 127
 };
 
-auto is_literal(lexeme l) -> bool {
-    switch (l) {
-    break;case lexeme::FloatLiteral:
-          case lexeme::BinaryLiteral:
-          case lexeme::DecimalLiteral:
-          case lexeme::HexadecimalLiteral:
-          case lexeme::StringLiteral:
-          case lexeme::CharacterLiteral:    return true;
-    break;default:                          return false;
+//  lexeme_set: a constexpr bitset over the lexeme values, so the token
+//  classification predicates (is_literal here, the operator
+//  categorizations in parse.h) compile to a single bit test instead of
+//  a switch over the token type - they run per token at the parser's
+//  hottest decision points
+//
+class lexeme_set
+{
+    u64 bits[2] = {};
+
+public:
+    constexpr lexeme_set(std::initializer_list<lexeme> ls) {
+        for (auto l : ls) {
+            auto i = static_cast<unsigned>(l);
+            bits[i >> 6] |= u64{1} << (i & 63);
+        }
+    }
+
+    constexpr auto contains(lexeme l) const
+        -> bool
+    {
+        auto i = static_cast<unsigned>(l);
+        return (bits[i >> 6] >> (i & 63)) & 1;
     }
+
+    constexpr auto operator|(lexeme_set const& that) const
+        -> lexeme_set
+    {
+        auto ret = *this;
+        ret.bits[0] |= that.bits[0];
+        ret.bits[1] |= that.bits[1];
+        return ret;
+    }
+};
+
+
+auto is_literal(lexeme l) -> bool {
+    constexpr auto literals = lexeme_set{
+        lexeme::FloatLiteral,
+        lexeme::BinaryLiteral,
+        lexeme::DecimalLiteral,
+        lexeme::HexadecimalLiteral,
+        lexeme::StringLiteral,
+        lexeme::CharacterLiteral
+    };
+    return literals.contains(l);
 }
 
 auto close_paren_type(lexeme l)
@@ -123,6 +160,255 @@ auto close_paren_type(lexeme l)
 }
 
 
+//  op_munch_table: maximal-munch operator and punctuator recognition as
+//  a table lookup. The table is built at compile time from the lexeme
+//  spellings below, grouped by first byte with the longest spellings
+//  first, so lex_line's hottest branch - operator-dense expression text -
+//  is a first-byte load plus a scan of at most a handful of candidates
+//  instead of a cascade of per-character comparisons.
+//
+//  '/', '>', and '$' are deliberately absent: '/' has to check for
+//  comment starts first, '$' for captured raw string literals, and '>'
+//  only ever matches alone ('>=' '>>' '>>=' are synthesized from
+//  single '>' tokens in the parser where legal)
+//
+class op_munch_table
+{
+    struct entry {
+        char   c1  = '\0';
+        char   c2  = '\0';
+        u8     len = 0;
+        lexeme lex = lexeme::None;
+    };
+
+    u8    first[256] = {};   // index into entries
+    u8    count[256] = {};
+    entry entries[64] = {};
+
+public:
+    constexpr op_munch_table()
+    {
+        struct spec { std::string_view text; lexeme lex; };
+        spec const specs[] = {
+            { "<<=", lexeme::LeftShiftEq        },
+            { "<=>", lexeme::Spaceship          },
+            { "<<" , lexeme::LeftShift          },
+            { "<=" , lexeme::LessEq             },
+            { "<"  , lexeme::Less               },
+            { ">"  , lexeme::Greater            },
+            { "++" , lexeme::PlusPlus           },
+            { "+=" , lexeme::PlusEq             },
+            { "+"  , lexeme::Plus               },
+            { "--" , lexeme::MinusMinus         },
+            { "-=" , lexeme::MinusEq            },
+            { "->" , lexeme::Arrow              },
+            { "-"  , lexeme::Minus              },
+            { "||=", lexeme::LogicalOrEq        },
+            { "||" , lexeme::LogicalOr          },
+            { "|=" , lexeme::PipeEq             },
+            { "|"  , lexeme::Pipe               },
+            { "&&=", lexeme::LogicalAndEq       },
+            { "&&" , lexeme::LogicalAnd         },
+            { "&=" , lexeme::AmpersandEq        },
+            { "&"  , lexeme::Ampersand          },
+            { "*=" , lexeme::MultiplyEq         },
+            { "*"  , lexeme::Multiply           },
+            { "%=" , lexeme::ModuloEq           },
+            { "%"  , lexeme::Modulo             },
+            { "^=" , lexeme::CaretEq            },
+            { "^"  , lexeme::Caret              },
+            { "~=" , lexeme::TildeEq            },
+            { "~"  , lexeme::Tilde              },
+            { "==" , lexeme::EqualComparison    },
+            { "="  , lexeme::Assignment         },
+            { "!=" , lexeme::NotEqualComparison },
+            { "!"  , lexeme::Not                },
+            { "...", lexeme::Ellipsis           },
+            { "..<", lexeme::EllipsisLess       },
+            { "..=", lexeme::EllipsisEqual      },
+            { ".." , lexeme::DotDot             },
+            { "."  , lexeme::Dot                },
+            { "::" , lexeme::Scope              },
+            { ":"  , lexeme::Colon              },
+            { "{"  , lexeme::LeftBrace          },
+            { "}"  , lexeme::RightBrace         },
+            { "("  , lexeme::LeftParen          },
+            { ")"  , lexeme::RightParen         },
+            { "["  , lexeme::LeftBracket        },
+            { "]"  , lexeme::RightBracket       },
+            { ";"  , lexeme::Semicolon          },
+            { ","  , lexeme::Comma              },
+            { "?"  , lexeme::QuestionMark       },
+            { "@"  , lexeme::At                 }
+        };
+
+        auto next = u8{ 0 };
+        for (auto b = 0; b < 256; ++b)
+        {
+            first[b] = next;
+            for (auto len = size_t{ 3 }; len > 0; --len) {
+                for (auto const& s : specs) {
+                    if (
+                        s.text.size() == len
+                        && s.text[0] == static_cast<char>(b)
+                        )
+                    {
+                        entries[next] = {
+                            len > 1 ? s.text[1] : '\0',
+                            len > 2 ? s.text[2] : '\0',
+                            static_cast<u8>(len),
+                            s.lex
+                        };
+                        ++next;
+                        ++count[b];
+                    }
+                }
+            }
+        }
+    }
+
+    struct munch { int len = 0; lexeme lex = lexeme::None; };
+
+    constexpr auto match(char c0, char c1, char c2) const
+        -> munch
+    {
+        auto b = static_cast<unsigned char>(c0);
+        auto k = first[b];
+        for (auto n = count[b]; n > 0; ++k, --n) {
+            auto const& e = entries[k];
+            if (
+                e.len < 2
+                || (c1 == e.c1 && (e.len < 3 || c2 == e.c2))
+                )
+            {
+                return { e.len, e.lex };
+            }
+        }
+        return {};
+    }
+};
+
+inline constexpr auto op_table = op_munch_table{};
+
+
+//-----------------------------------------------------------------------
+//  keyword_table: length-bucketed keyword recognition
+//
+//  Keyword/identifier discrimination runs once per candidate
+//  identifier - roughly 40% of the tokens in a big file - and a linear
+//  starts_with scan over each keyword list was the cost. Here each
+//  candidate does one bucket probe by (first char, length) - for these
+//  key sets almost every bucket holds one or two entries - and a
+//  word-sized verify. Same table shape as op_munch_table above
+//
+template <std::size_t N>
+class keyword_table
+{
+    //  Buckets are (first char a-z or '_', length 2..16)
+    static constexpr auto num_buckets = 27 * 15;
+
+    std::array<std::string_view, N> keys;
+    std::array<u8, num_buckets>     first   = {};
+    std::array<u8, num_buckets>     count   = {};
+    std::array<u8, N>               entries = {};
+
+    static constexpr auto bucket_of(char c0, std::size_t len)
+        -> int
+    {
+        auto c = c0 == '_' ? 26 : c0 - 'a';
+        return static_cast<int>( c*15 + (static_cast<int>(len) - 2) );
+    }
+
+public:
+    constexpr keyword_table(std::array<std::string_view, N> const& keys_)
+        : keys{ keys_ }
+    {
+        auto next = u8{ 0 };
+        for (auto b = 0; b < num_buckets; ++b)
+        {
+            first[b] = next;
+            for (auto k = std::size_t{ 0 }; k < N; ++k) {
+                if (bucket_of( keys[k][0], keys[k].size() ) == b) {
+                    entries[next] = static_cast<u8>(k);
+                    ++next;
+                    ++count[b];
+                }
+            }
+        }
+    }
+
+    //  Return the matched length if 'ident' - a maximal identifier
+    //  run, so no boundary check is needed here - is in the set, else 0
+    auto match(std::string_view ident) const
+        -> int
+    {
+        if (
+            ident.size() < 2
+            || ident.size() > 16
+            || (
+                (ident[0] < 'a' || ident[0] > 'z')
+                && ident[0] != '_'
+                )
+            )
+        {
+            return 0;
+        }
+        auto b = bucket_of( ident[0], ident.size() );
+        auto k = first[b];
+        for (auto n = count[b]; n > 0; ++k, --n) {
+            if (short_equal( ident, keys[entries[k]] )) {
+                return unchecked_narrow<int>(ident.size());
+            }
+        }
+        return 0;
+    }
+};
+
+
+//  Cpp2 has a smaller set of the Cpp1 globally reserved keywords, but we continue to
+//  reserve all the ones Cpp1 has both for compatibility and to not give up a keyword
+//  Some keywords like "delete" and "union" are not in this list because we reject them elsewhere
+//  Cpp2 also adds a couple, notably "is" and "as"
+//  constexpr: the tables live in read-only storage, one copy shared by
+//  however many -jobs workers are lexing
+//
+inline constexpr auto cpp2_keywords = keyword_table{ std::to_array<std::string_view>({
+    "alignas", "alignof", "asm", "as", "auto",
+    "bool", "break",
+    "case", "catch", "char16_t", "char32_t", "char8_t", "char", "co_await", "co_return",
+    "co_yield", "concept", "const_cast", "consteval", "constexpr", "constinit", "const", "continue",
+    "decltype", "default", "double", "do", "dynamic_cast",
+    "else", "enum", "explicit", "export", "extern",
+    "float", "for", "friend",
+    "goto",
+    "if", "import", "inline", "int", "is",
+    "long",
+    "module", "mutable",
+    "namespace", "noexcept",
+    "operator",
+    "private", "protected", "public",
+    "register", "reinterpret_cast", "requires", "return",
+    "short", "signed", "sizeof", "static_assert", "static_cast", "static", "switch",
+    "template", "this", "thread_local", "throws", "throw", "try", "typedef", "typeid", "typename",
+    "unsigned", "using",
+    "virtual", "void", "volatile",
+    "wchar_t", "while"
+}) };
+
+inline constexpr auto cpp2_fixed_type_keywords = keyword_table{ std::to_array<std::string_view>({
+    "i8", "i16", "i32", "i64", "longdouble", "longlong",
+    "u8", "u16", "u32", "u64", "ulonglong", "ulong", "ushort",
+    "_schar", "_uchar"
+}) };
+
+inline constexpr auto cpp1_multi_token_fundamental_keywords = keyword_table{ std::to_array<std::string_view>({
+    "char16_t", "char32_t", "char8_t", "char",
+    "double", "float",
+    "int", "long", "short",
+    "signed", "unsigned"
+}) };
+
+
 template<typename T>
     requires std::is_same_v<T, std::string>
 auto _as(lexeme l)
@@ -209,6 +495,135 @@ auto is_operator(lexeme l)
 }
 
 
+//-----------------------------------------------------------------------
+//
+//  Identifier interning: maps each distinct identifier spelling to a
+//  small nonzero id, so identifier equality tests are an integer
+//  compare instead of a memcmp of the names
+//
+//-----------------------------------------------------------------------
+//
+class identifier_interner
+{
+    struct hash {
+        using is_transparent = void;
+        auto operator()(std::string_view s) const -> size_t { return std::hash<std::string_view>{}(s); }
+    };
+    using map = std::unordered_map<std::string, int32_t, hash, std::equal_to<>>;
+
+    map ids;
+
+    //  Optional shared read-only base, consulted before this thread's own
+    //  table: frozen once on the main thread before any worker threads
+    //  exist, then never modified, so reading it from many threads needs
+    //  no lock. Every thread resolves a base spelling to the same id, and
+    //  worker-local ids start above the base so ids stay distinct
+    //
+    inline static map     base      = {};
+    inline static bool    has_base  = false;
+    inline static int32_t base_size = 0;
+
+public:
+    //  get_id: the nonzero id of this spelling, interning it if new
+    //
+    auto get_id(std::string_view s)
+        -> int32_t
+    {
+        if (has_base) {
+            if (auto b = base.find(s); b != base.end()) {
+                return b->second;
+            }
+        }
+        auto i = ids.find(s);
+        if (i != ids.end()) {
+            return i->second;
+        }
+        heapinstr::record( "interned identifiers", s.size() );
+        return ids.emplace( std::string{s}, unchecked_narrow<int32_t>(base_size + std::ssize(ids)+1) ).first->second;
+    }
+
+    //  freeze_as_shared_base: move everything interned so far (e.g., by
+    //  the -include-prelude compile) into the shared base, so workers
+    //  don't each re-intern their own copies of the common spellings.
+    //  Call only on the main thread, before worker threads start
+    //
+    auto freeze_as_shared_base()
+        -> void
+    {
+        assert( !has_base && "freeze_as_shared_base must be called at most once" );
+        base      = std::move(ids);
+        base_size = unchecked_narrow<int32_t>(std::ssize(base));
+        has_base  = true;
+        ids.clear();
+    }
+
+    //  The number of distinct spellings interned so far, shared base included
+    //
+    auto size() const
+        -> size_t
+    {
+        return base.size() + ids.size();
+    }
+
+    //  save_snapshot / load_snapshot: persist this interner's spellings in
+    //  id order, so a restarted -daemon (crash, deploy) recovers a warm
+    //  interner instead of rebuilding it over its first requests. The
+    //  header line carries the cppfront version and build, so a snapshot
+    //  written by a different cppfront build is ignored
+    //
+    auto save_snapshot(
+        std::string const& path,
+        std::string const& header
+    ) const
+        -> void
+    {
+        auto out = std::ofstream{ path, std::ios::binary };
+        if (!out.is_open()) {
+            return;
+        }
+        auto spellings = std::vector<std::string_view>( size() );
+        for (auto const& [s, id] : base) {
+            spellings[unchecked_narrow<size_t>(id) - 1] = s;
+        }
+        for (auto const& [s, id] : ids) {
+            spellings[unchecked_narrow<size_t>(id) - 1] = s;
+        }
+        out << header << '\n';
+        for (auto s : spellings) {
+            out << s << '\n';
+        }
+    }
+
+    auto load_snapshot(
+        std::string const& path,
+        std::string const& header
+    )
+        -> bool
+    {
+        auto in = std::ifstream{ path, std::ios::binary };
+        if (!in.is_open()) {
+            return false;
+        }
+        auto line = std::string{};
+        if (
+            !std::getline(in, line)
+            || line != header
+            )
+        {
+            return false;
+        }
+        while (std::getline(in, line)) {
+            if (!line.empty()) {
+                get_id(line);
+            }
+        }
+        return true;
+    }
+};
+
+static thread_local auto interned_identifiers = identifier_interner{};  // thread_local: see -jobs
+
+
 //-----------------------------------------------------------------------
 //
 //  token: represents a single token
@@ -226,10 +641,14 @@ public:
         source_position pos,
         lexeme          type
     )
-      : sv      {start, unchecked_narrow<ulong>(count)}
+      : lex_type{type}
       , pos     {pos}
-      , lex_type{type}
+      , start   {start}
+      , count   {unchecked_narrow<uint32_t>(count)}
     {
+        if (lex_type == lexeme::Identifier) {
+            id = interned_identifiers.get_id(as_string_view());
+        }
     }
 
     token(
@@ -237,17 +656,21 @@ public:
         source_position pos,
         lexeme          type
     )
-      : sv      {sz}
+      : lex_type{type}
       , pos     {pos}
-      , lex_type{type}
+      , start   {sz}
+      , count   {unchecked_narrow<uint32_t>(std::string_view{sz}.size())}
     {
+        if (lex_type == lexeme::Identifier) {
+            id = interned_identifiers.get_id(as_string_view());
+        }
     }
 
     auto as_string_view() const
         -> std::string_view
     {
-        assert (sv.data());
-        return sv;
+        assert (start);
+        return {start, count};
     }
 
     operator std::string_view() const
@@ -258,19 +681,37 @@ public:
     auto operator== (token const& t) const
         -> bool
     {
+        //  Two interned identifiers compare by id, no memcmp needed
+        if (
+            id != 0
+            && t.id != 0
+            )
+        {
+            return id == t.id;
+        }
         return operator std::string_view() == t.operator std::string_view();
     }
 
+    //  The interned identifier id - nonzero iff this is an identifier
+    //
+    auto intern_id() const
+        -> int32_t
+    {
+        return id;
+    }
+
     auto operator== (std::string_view s) const
         -> bool
     {
-        return s == this->operator std::string_view();
+        //  Nearly every caller tests against a short fixed spelling, so
+        //  the length-first word compare pays off here
+        return short_equal( s, as_string_view() );
     }
 
     auto to_string() const
         -> std::string
     {
-        return std::string{sv};
+        return std::string{as_string_view()};
     }
 
     friend auto operator<< (auto& o, token const& t)
@@ -288,7 +729,7 @@ public:
 
     auto position() const -> source_position { return pos;                           }
 
-    auto length  () const -> int             { return unchecked_narrow<int>(sv.size()); }
+    auto length  () const -> int             { return unchecked_narrow<int>(count);    }
 
     auto type    () const -> lexeme          { return lex_type;                      }
 
@@ -304,54 +745,221 @@ public:
         -> void
     {
         if (
-            sv.size() > prefix.size()
-            && sv.starts_with(prefix)
+            count > prefix.size()
+            && short_starts_with( as_string_view(), prefix )
             )
         {
-            sv.remove_prefix(prefix.size());
+            start += prefix.size();
+            count -= unchecked_narrow<uint32_t>(prefix.size());
             pos.colno += unchecked_narrow<colno_t>(prefix.size());
+            //  The spelling changed, so refresh the interned id
+            if (id != 0) {
+                id = interned_identifiers.get_id(as_string_view());
+            }
         }
     }
 
-    auto set_global_token_order(index_t& counter) const
+private:
+    //  Ordered to pack the whole token into 32 bytes - two per cache
+    //  line, and ~1M-token files are common - with the hot fields
+    //  first: the passes that sweep a token stream ask for type() and
+    //  position() far more often than they touch the text, so the
+    //  kind and the compact 8-byte lineno/colno pair lead and the
+    //  text (a pointer plus 32-bit length rather than a string_view)
+    //  trails
+    lexeme           lex_type;
+    source_position  pos;
+    int32_t          id = 0;
+    char const*      start;
+    uint32_t         count;
+};
+
+static_assert (sizeof(token) == 32);
+
+static_assert (CHAR_BIT == 8);
+
+
+//-----------------------------------------------------------------------
+//
+//  token_soa: a structure-of-arrays view of a token stream
+//
+//  Whole-stream scans usually touch just one or two token fields, so
+//  keeping the kinds, positions, and text views in parallel arrays
+//  lets such scans stay in cache on large files (~1M tokens). The
+//  parse tree keeps pointing at the token objects themselves, which
+//  stay where they are - this is a read-only sidecar, with the familiar
+//  token API available through a lightweight accessor
+//
+//-----------------------------------------------------------------------
+//
+class token_soa
+{
+    std::vector<lexeme>           kinds;
+    std::vector<source_position>  positions;
+    std::vector<std::string_view> texts;
+
+public:
+    auto push_back(token const& t)
         -> void
     {
-        //  In a well-formed program we only expect to set this once
-        if (global_token_order == 0) {
-            global_token_order = ++counter;
-        }
+        kinds    .push_back( t.type() );
+        positions.push_back( t.position() );
+        texts    .push_back( t );
     }
 
-    auto get_global_token_order() const
-        -> index_t
+    auto size() const
+        -> auto
     {
-        return global_token_order;
+        return std::ssize(kinds);
     }
 
-private:
-    std::string_view sv;
-    source_position  pos;
-    lexeme           lex_type;
-    mutable index_t  global_token_order = 0;
+    auto reserve(size_t n)
+        -> void
+    {
+        kinds    .reserve(n);
+        positions.reserve(n);
+        texts    .reserve(n);
+    }
+
+    auto clear()
+        -> void
+    {
+        kinds    .clear();
+        positions.clear();
+        texts    .clear();
+    }
+
+    //  Direct access to a single field's array, for scans that
+    //  iterate just that field
+    //
+    auto get_kinds    () const -> auto const& { return kinds;     }
+    auto get_positions() const -> auto const& { return positions; }
+    auto get_texts    () const -> auto const& { return texts;     }
+
+    //  accessor: a cheap index into the parallel arrays that reads
+    //  like a token
+    //
+    class accessor
+    {
+        token_soa const* stream;
+        ptrdiff_t        index;
+
+    public:
+        accessor(
+            token_soa const* stream_,
+            ptrdiff_t        index_
+        )
+            : stream{ stream_ }
+            , index { index_  }
+        {
+            assert (stream);
+            assert (0 <= index && index < stream->size());
+        }
+
+        auto type          () const -> lexeme           { return stream->kinds    [index]; }
+        auto position      () const -> source_position  { return stream->positions[index]; }
+        auto as_string_view() const -> std::string_view { return stream->texts    [index]; }
+
+        operator std::string_view() const
+        {
+            return as_string_view();
+        }
+
+        auto length() const
+            -> int
+        {
+            return unchecked_narrow<int>(stream->texts[index].size());
+        }
+    };
+
+    auto operator[](ptrdiff_t index) const
+        -> accessor
+    {
+        return { this, index };
+    }
 };
 
-static_assert (CHAR_BIT == 8);
 
+//  Deterministic output matters: the content-hash caches only hit when
+//  recompiling a file reproduces it byte for byte. The label ordinals
+//  below restart at every compile (see reset_labelized_positions), so a
+//  file's labels depend only on its own fixed single-threaded emit
+//  order - never on which files a resident process or -jobs worker
+//  thread happened to compile earlier. Resetting also drops the stale
+//  token pointers a previous file left behind, which a recycled arena
+//  could otherwise alias
+//
+struct labelized_position_state {
+    std::unordered_map<token const*, std::string> labels;
+    int                                           ordinal = 0;
+    uint32_t                                      file_seed = 0;
+    std::unordered_set<std::string>               used;      // only populated with -stable-names
+};
+static thread_local auto labelized_positions = labelized_position_state{};  // thread_local: see -jobs
+
+auto fnv1a_32(std::string_view s, uint32_t h = 0x811c9dc5)
+    -> uint32_t
+{
+    for (auto c : s) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619;
+    }
+    return h;
+}
+
+auto reset_labelized_positions(std::string_view source_name = {})
+    -> void
+{
+    labelized_positions.labels.clear();
+    labelized_positions.ordinal = 0;
+    labelized_positions.file_seed = fnv1a_32(source_name);
+    labelized_positions.used.clear();
+}
 
 auto labelized_position(token const* t)
     -> std::string
 {
-    struct label {
-        std::string text;
-        label() {
-            static auto ordinal = 0;                                        // TODO: static
-            text = std::to_string(++ordinal);
-        }
-    };
-    static auto labels = std::unordered_map<token const*, label const>{};   // TODO: static
-
     assert (t);
-    return labels[t].text;
+    auto& text = labelized_positions.labels[t];
+    if (text.empty()) {
+        //  With -stable-names, label from a short hash of the file name
+        //  and the token's position: the sequential ordinals renumber
+        //  every later label when code is added earlier in the file,
+        //  while a position hash only changes for names whose entity
+        //  itself moved - friendlier to downstream build caches and
+        //  linker maps, at the cost of a few characters per name
+        //
+        if (flag_stable_names) {
+            auto pos = t->position();
+            auto h   = fnv1a_32(
+                std::to_string(pos.lineno) + ":" + std::to_string(pos.colno),
+                labelized_positions.file_seed
+            );
+            for (;;) {
+                //  Base-36 keeps the label to at most 7 characters
+                constexpr auto digits = "0123456789abcdefghijklmnopqrstuvwxyz";
+                auto label = std::string{};
+                auto v     = h;
+                do {
+                    label += digits[v % 36];
+                    v /= 36;
+                } while (v != 0);
+
+                if (labelized_positions.used.insert(label).second) {
+                    text = std::move(label);
+                    break;
+                }
+                //  Collision with another position's label - rehash; the
+                //  outcome stays deterministic because labels are handed
+                //  out in the file's fixed single-threaded emit order
+                h = fnv1a_32("#", h);
+            }
+        }
+        else {
+            text = std::to_string(++labelized_positions.ordinal);
+        }
+    }
+    return text;
 }
 
 auto unnamed_type_param_name(int ordinal, token const* t)
@@ -506,7 +1114,7 @@ auto expand_string_literal(
                 chunk.insert(chunk.size()-1, "}\"");
             }
 
-            parts.add_code("cpp2::to_string" + chunk);
+            parts.add_interp(chunk);
 
             current_start = pos+1;
         }
@@ -578,7 +1186,7 @@ auto expand_raw_string_literal(
                 parts.add_string(text.substr(current_start, open - current_start));
             }
             //  Then put interpolated chunk into ret
-            parts.add_code("cpp2::to_string" + std::string{text.substr(open, pos - open)});
+            parts.add_interp(text.substr(open, pos - open));
 
             current_start = pos+1;
         }
@@ -602,6 +1210,7 @@ auto expand_raw_string_literal(
 //  current_comment_start   the current comment's start position
 //  tokens                  the token list to add to
 //  comments                the comment token list to add to
+//  comment_texts           stable storage for stream comment text
 //  errors                  the error message list to use for reporting problems
 //  raw_string_multiline    the current optional raw_string state
 //
@@ -609,26 +1218,27 @@ auto expand_raw_string_literal(
 //  A stable place to store additional text for source tokens that are merged
 //  into a whitespace-containing token (to merge the Cpp1 multi-token keywords)
 //  -- this isn't about tokens generated later, that's tokens::generated_tokens
-static auto generated_text  = stable_vector<std::string>{};                // TODO: static
-static auto generated_lines = stable_vector<std::vector<source_line>>{};   // TODO: static
+static thread_local auto generated_text  = text_pool{};                                 // thread_local: see -jobs
+static thread_local auto generated_lines = stable_vector<std::vector<source_line>>{};   // thread_local: see -jobs
 
 
-static auto multiline_raw_strings = stable_vector<multiline_raw_string>{}; // TODO: static
+static thread_local auto multiline_raw_strings = stable_vector<multiline_raw_string>{}; // thread_local: see -jobs
 
 auto lex_line(
-    std::string&               mutable_line,
+    source_line&               mutable_line,
     int const                  lineno,
     bool&                      in_comment,
     std::string&               current_comment,
     source_position&           current_comment_start,
     std::vector<token>&        tokens,
     std::vector<comment>&      comments,
+    text_pool&                 comment_texts,
     std::vector<error_entry>&  errors,
     std::optional<raw_string>& raw_string_multiline
 )
     -> bool
 {
-    auto const& line = mutable_line;    // most accesses will be const, so give that the nice name
+    auto const& line = mutable_line.text;   // most accesses will be const, so give that the nice name
 
     auto original_size = std::ssize(tokens);
 
@@ -690,7 +1300,7 @@ auto lex_line(
         auto is_double         = 0;
         auto is_signed         = 0;
         auto is_unsigned       = 0;
-        generated_text.push_back( "" );
+        auto merged_text = std::string{};
         while(
             !tokens.empty()
             && tokens.back().type() == lexeme::Cpp1MultiKeyword
@@ -706,16 +1316,17 @@ auto lex_line(
             if (text == "unsigned") { ++is_unsigned; }
 
             if (num_merged_tokens > 0) {
-                generated_text.back() = " " + generated_text.back();
+                merged_text = " " + merged_text;
             }
-            generated_text.back() = text + generated_text.back();
+            merged_text = text + merged_text;
             pos = tokens.back().position();
             tokens.pop_back();
             ++num_merged_tokens;
         }
+        generated_text.push_back( merged_text );
 
         tokens.push_back({
-            &generated_text.back()[0],
+            generated_text.back().data(),
             std::ssize(generated_text.back()),
             pos,
             lexeme::Keyword
@@ -782,7 +1393,7 @@ auto lex_line(
                 auto pos = tokens.back().position();
                 tokens.pop_back();
                 tokens.push_back({
-                    &generated_text.back()[0],
+                    generated_text.back().data(),
                     std::ssize(generated_text.back()),
                     pos,
                     lexeme::Identifier
@@ -802,7 +1413,7 @@ auto lex_line(
                 auto pos = tokens.back().position();
                 tokens.pop_back();
                 tokens.push_back({
-                    &generated_text.back()[0],
+                    generated_text.back().data(),
                     std::ssize(generated_text.back()),
                     pos,
                     lexeme::Identifier
@@ -824,7 +1435,7 @@ auto lex_line(
                 auto pos = tokens.back().position();
                 tokens.pop_back();
                 tokens.push_back({
-                    &generated_text.back()[0],
+                    generated_text.back().data(),
                     std::ssize(generated_text.back()),
                     pos,
                     lexeme::Identifier
@@ -855,7 +1466,7 @@ auto lex_line(
             tokens.insert(
                 tokens.end()-3,
                 token{
-                    &generated_text.back()[0],
+                    generated_text.back().data(),
                     std::ssize(generated_text.back()),
                     pos,
                     lexeme::Identifier
@@ -866,7 +1477,7 @@ auto lex_line(
             tokens.insert(
                 tokens.end()-3,
                 token{
-                    &generated_text.back()[0],
+                    generated_text.back().data(),
                     std::ssize(generated_text.back()),
                     pos,
                     lexeme::Scope
@@ -1110,76 +1721,33 @@ auto lex_line(
     //G     any Cpp1-and-Cpp2 keyword
     //G     one of: 'import' 'module' 'export' 'is' 'as'
     //G
-    auto do_is_keyword = [&](std::vector<std::string_view> const& r) {
+    //  One bucketed probe over the maximal identifier run replaces the
+    //  former linear starts_with scan over each key list, and matching
+    //  the whole run means no separate boundary check - see
+    //  keyword_table
+    //
+    auto do_is_keyword = [&](auto const& table) {
         auto remaining_line = std::string_view(line).substr(i);
-        auto m = std::find_if(r.begin(), r.end(), [&](std::string_view s) {
-            return remaining_line.starts_with(s);
-        });
-        if (m != r.end()) {
-            //  If we matched and what's next is EOL or a non-identifier char, we matched!
-            if (
-                i+std::ssize(*m) == std::ssize(line)                // EOL
-                || !is_identifier_continue(line[i+std::size(*m)])   // non-identifier char
-                )
-            {
-                return static_cast<int>(std::ssize(*m));
-            }
+        if (remaining_line.empty()) {
+            return 0;
         }
-        return 0;
+        auto len = starts_with_identifier(remaining_line);
+        return table.match( remaining_line.substr(0, unchecked_narrow<std::size_t>(len)) );
     };
 
     auto peek_is_keyword = [&]
     {
-        //  Cpp2 has a smaller set of the Cpp1 globally reserved keywords, but we continue to
-        //  reserve all the ones Cpp1 has both for compatibility and to not give up a keyword
-        //  Some keywords like "delete" and "union" are not in this list because we reject them elsewhere
-        //  Cpp2 also adds a couple, notably "is" and "as"
-        static const auto keys = std::vector<std::string_view>{
-            "alignas", "alignof", "asm", "as", "auto",
-            "bool", "break",
-            "case", "catch", "char16_t", "char32_t", "char8_t", "char", "co_await", "co_return",
-            "co_yield", "concept", "const_cast", "consteval", "constexpr", "constinit", "const", "continue",
-            "decltype", "default", "double", "do", "dynamic_cast",
-            "else", "enum", "explicit", "export", "extern",
-            "float", "for", "friend",
-            "goto",
-            "if", "import", "inline", "int", "is",
-            "long",
-            "module", "mutable",
-            "namespace", "noexcept",
-            "operator",
-            "private", "protected", "public",
-            "register", "reinterpret_cast", "requires", "return",
-            "short", "signed", "sizeof", "static_assert", "static_cast", "static", "switch",
-            "template", "this", "thread_local", "throws", "throw", "try", "typedef", "typeid", "typename",
-            "unsigned", "using",
-            "virtual", "void", "volatile",
-            "wchar_t", "while"
-        };
-
-        return do_is_keyword(keys);
+        return do_is_keyword(cpp2_keywords);
     };
 
     auto peek_is_cpp2_fundamental_type_keyword = [&]
     {
-        static const auto keys = std::vector<std::string_view>{
-            "i8", "i16", "i32", "i64", "longdouble", "longlong",
-            "u8", "u16", "u32", "u64", "ulonglong", "ulong", "ushort",
-            "_schar", "_uchar"
-        };
-
-        return do_is_keyword(keys);
+        return do_is_keyword(cpp2_fixed_type_keywords);
     };
 
     auto peek_is_cpp1_multi_token_fundamental_keyword = [&]
     {
-        static const auto multi_keys = std::vector<std::string_view>{
-            "char16_t", "char32_t", "char8_t", "char",
-            "double", "float",
-            "int", "long", "short",
-            "signed", "unsigned"
-        };
-        return do_is_keyword(multi_keys);
+        return do_is_keyword(cpp1_multi_token_fundamental_keywords);
     };
 
     auto reset_processing_of_the_line = [&]() {
@@ -1230,6 +1798,27 @@ auto lex_line(
 
     for ( ; i < ssize(line); ++i)
     {
+        //  Fast-forward over runs of plain whitespace - the most common
+        //  character class in indented code - before doing any
+        //  speculative peeking. Outside comments and raw strings these
+        //  characters can't start or extend any token
+        if (
+            !in_comment
+            && !raw_string_multiline
+            && (
+                line[i] == ' '
+                || line[i] == '\t'
+                )
+            )
+        {
+            auto next = line.find_first_not_of(" \t", i);
+            if (next == line.npos) {
+                next = line.size();
+            }
+            i = unchecked_narrow<colno_t>(next) - 1;    // the loop increment lands on the token
+            continue;
+        }
+
         auto peek1 = peek(1);
         auto peek2 = peek(2);
         auto peek3 = peek(3);
@@ -1243,11 +1832,12 @@ auto lex_line(
             break;case '*':
                 if (peek1 == '/') {
                     current_comment += "*/";
+                    comment_texts.push_back( current_comment );
                     comments.push_back({
                         comment::comment_kind::stream_comment,
                         current_comment_start,
                         source_position(lineno, i + 2),
-                        current_comment
+                        comment_texts.back()
                         });
                     in_comment = false;
                     ++i;
@@ -1312,15 +1902,43 @@ auto lex_line(
             //G
             //G operator: one of
 
-            switch (line[i]) {
-
             //  .* ->* ? aren't currently used in Cpp2, and aren't needed
 
             //  (we do need all the overloadable operators for Cpp1 compat,
             //  even if we may not keep their meanings for built-in types)
 
-            //      /* and // comment starts
             //G     '/=' '/'
+            //G     '<<=' '<<' '<=>' '<=' '<'
+            //  Note: >= and >> and >>= synthesized from > = and > > and > >= where legal
+            //G     '>>=' '>>' '>=' '>'
+            //G     '++' '+=' '+'
+            //G     '--' '-=' '->' '-'
+            //G     '||=' '||' '|=' '|'
+            //G     '&&=' '&&' '&=' '&'
+            //G     '*=' '*'
+            //G     '%=' '%'
+            //G     '^=' '^'
+            //G     '~=' '~'
+            //G     '==' '='
+            //G     '!=' '!'
+            //G
+            //G punctuator: one of
+            //G     '.' '..' '...' '..<' '..='
+            //G     '::' ':'
+            //G     '{' '}' '(' ')' '[' ']' ';' ',' '?' '$'
+            //G
+
+            //  Operators and punctuators munch via op_table; '/' and '$'
+            //  aren't in it, so they fall through to their context
+            //  checks in the switch below
+            //
+            if (auto m = op_table.match(line[i], peek1, peek2); m.len > 0) {
+                store(m.len, m.lex);
+            }
+
+            else switch (line[i]) {
+
+            //      /* and // comment starts
             break;case '/':
                 if (peek1 == '*') {
                     current_comment = "/*";
@@ -1329,6 +1947,9 @@ auto lex_line(
                     ++i;
                 }
                 else if (peek1 == '/') {
+                    //  A zero-copy view is safe here: a line comment
+                    //  runs to the end of its line, so no later in-place
+                    //  edit of this line can follow it
                     comments.push_back({
                         comment::comment_kind::line_comment,
                         {lineno, i},
@@ -1345,146 +1966,6 @@ auto lex_line(
                     store(1, lexeme::Slash);
                 }
 
-            //G     '<<=' '<<' '<=>' '<=' '<'
-            break;case '<':
-                if (peek1 == '<') {
-                    if (peek2 == '=') { store(3, lexeme::LeftShiftEq); }
-                    else { store(2, lexeme::LeftShift); }
-                }
-                else if (peek1 == '=') {
-                    if (peek2 == '>') { store(3, lexeme::Spaceship); }
-                    else { store(2, lexeme::LessEq); }
-                }
-                else { store(1, lexeme::Less); }
-
-            //  Note: >= and >> and >>= synthesized from > = and > > and > >= where legal
-            //G     '>>=' '>>' '>=' '>'
-            break;case '>':
-                //---------------------------------------------------------
-                //  Do not uncomment, see above Note
-                //
-                //if (peek1 == '>') {
-                //    if (peek2 == '=') { store(3, lexeme::RightShiftEq); }
-                //    else { store(2, lexeme::RightShift); }
-                //}
-                //else if (peek1 == '=') { store(2, lexeme::GreaterEq); }
-                //else
-                //---------------------------------------------------------
-                { store(1, lexeme::Greater); }
-
-            //G     '++' '+=' '+'
-            break;case '+':
-                if (peek1 == '+') { store(2, lexeme::PlusPlus); }
-                else if (peek1 == '=') { store(2, lexeme::PlusEq); }
-                else { store(1, lexeme::Plus); }
-
-            //G     '--' '-=' '->' '-'
-            break;case '-':
-                if (peek1 == '-') { store(2, lexeme::MinusMinus); }
-                else if (peek1 == '=') { store(2, lexeme::MinusEq); }
-                else if (peek1 == '>') { store(2, lexeme::Arrow); }
-                else { store(1, lexeme::Minus); }
-
-            //G     '||=' '||' '|=' '|'
-            break;case '|':
-                if (peek1 == '|') {
-                    if (peek2 == '=') { store(3, lexeme::LogicalOrEq); }
-                    else { store(2, lexeme::LogicalOr); }
-                }
-                else if (peek1 == '=') { store(2, lexeme::PipeEq); }
-                else { store(1, lexeme::Pipe); }
-
-            //G     '&&=' '&&' '&=' '&'
-            break;case '&':
-                if (peek1 == '&') {
-                    if (peek2 == '=') { store(3, lexeme::LogicalAndEq); }
-                    else { store(2, lexeme::LogicalAnd); }
-                }
-                else if (peek1 == '=') { store(2, lexeme::AmpersandEq); }
-                else { store(1, lexeme::Ampersand); }
-
-            //  Next, all the other operators that have a compound assignment form
-
-            //G     '*=' '*'
-            break;case '*':
-                if (peek1 == '=') { store(2, lexeme::MultiplyEq); }
-                else { store(1, lexeme::Multiply); }
-
-            //G     '%=' '%'
-            break;case '%':
-                if (peek1 == '=') { store(2, lexeme::ModuloEq); }
-                else { store(1, lexeme::Modulo); }
-
-            //G     '^=' '^'
-            break;case '^':
-                if (peek1 == '=') { store(2, lexeme::CaretEq); }
-                else { store(1, lexeme::Caret); }
-
-            //G     '~=' '~'
-            break;case '~':
-                if (peek1 == '=') { store(2, lexeme::TildeEq); }
-                else { store(1, lexeme::Tilde); }
-
-            //G     '==' '='
-            break;case '=':
-                if (peek1 == '=') { store(2, lexeme::EqualComparison); }
-                else { store(1, lexeme::Assignment); }
-
-            //G     '!=' '!'
-            break;case '!':
-                if (peek1 == '=') { store(2, lexeme::NotEqualComparison); }
-                else { store(1, lexeme::Not); }
-
-            //G
-            //G punctuator: one of
-            //G     '.' '..' '...' '..<' '..='
-            break;case '.':
-                if      (peek1 == '.' && peek2 == '.') { store(3, lexeme::Ellipsis); }
-                else if (peek1 == '.' && peek2 == '<') { store(3, lexeme::EllipsisLess); }
-                else if (peek1 == '.' && peek2 == '=') { store(3, lexeme::EllipsisEqual); }
-                else if (peek1 == '.')                 { store(2, lexeme::DotDot); }
-                else                                   { store(1, lexeme::Dot); }
-
-            //G     '::' ':'
-            break;case ':':
-                if (peek1 == ':') { store(2, lexeme::Scope); }
-                else { store(1, lexeme::Colon); }
-
-            //  All the other single-character tokens
-
-            //G     '{' '}' '(' ')' '[' ']' ';' ',' '?' '$'
-            //G
-
-            break;case '{':
-                store(1, lexeme::LeftBrace);
-
-            break;case '}':
-                store(1, lexeme::RightBrace);
-
-            break;case '(':
-                store(1, lexeme::LeftParen);
-
-            break;case ')':
-                store(1, lexeme::RightParen);
-
-            break;case '[':
-                store(1, lexeme::LeftBracket);
-
-            break;case ']':
-                store(1, lexeme::RightBracket);
-
-            break;case ';':
-                store(1, lexeme::Semicolon);
-
-            break;case ',':
-                store(1, lexeme::Comma);
-
-            break; case '?':
-                store(1, lexeme::QuestionMark);
-
-            break; case '@':
-                store(1, lexeme::At);
-
             break;case '$':
                 if (peek1 == 'R' && peek2 == '"') {
                     // if peek(j-2) is 'R' it means that we deal with raw-string literal
@@ -1492,8 +1973,8 @@ auto lex_line(
                     auto seq_pos = i + 3;
 
                     if (auto paren_pos = line.find('(', seq_pos); paren_pos != line.npos) {
-                        auto opening_seq = line.substr(i, paren_pos - i + 1);
-                        auto closing_seq = ")"+line.substr(seq_pos, paren_pos-seq_pos)+"\"";
+                        auto opening_seq = std::string{line.substr(i, paren_pos - i + 1)};
+                        auto closing_seq = std::string{")"} + line.substr(seq_pos, paren_pos-seq_pos) + "\"";
 
                         if (auto closing_pos = line.find(closing_seq, paren_pos+1); closing_pos != line.npos) {
                             if (interpolate_raw_string(
@@ -1539,7 +2020,7 @@ auto lex_line(
                     else {
                         errors.emplace_back(
                             source_position(lineno, i + 1),
-                            "invalid new-line in raw string delimiter \"" + line.substr(i, 3)
+                            "invalid new-line in raw string delimiter \"" + std::string{line.substr(i, 3)}
                                 + "\" - stray 'R' in program \""
                         );
                         return {};
@@ -1713,8 +2194,8 @@ auto lex_line(
                         auto seq_pos = i + j;
 
                         if (auto paren_pos = line.find('(', seq_pos); paren_pos != line.npos) {
-                            auto opening_seq = line.substr(i, paren_pos - i + 1);
-                            auto closing_seq = ")"+line.substr(seq_pos, paren_pos-seq_pos)+"\"";
+                            auto opening_seq = std::string{line.substr(i, paren_pos - i + 1)};
+                            auto closing_seq = std::string{")"} + line.substr(seq_pos, paren_pos-seq_pos) + "\"";
 
                             if (auto closing_pos = line.find(closing_seq, paren_pos+1); closing_pos != line.npos) {
                                 store(closing_pos+std::ssize(closing_seq)-i, lexeme::StringLiteral);
@@ -1733,7 +2214,7 @@ auto lex_line(
                         else {
                             errors.emplace_back(
                                 source_position(lineno, i + j - 2),
-                                "invalid new-line in raw string delimiter \"" + line.substr(i, j)
+                                "invalid new-line in raw string delimiter \"" + std::string{line.substr(i, j)}
                                     + "\" - stray 'R' in program \""
                             );
                             return {};
@@ -1744,7 +2225,7 @@ auto lex_line(
                         if (peek(j) != '\"') {
                             errors.emplace_back(
                                 source_position(lineno, i),
-                                "string literal \"" + line.substr(i+1, j)
+                                "string literal \"" + std::string{line.substr(i+1, j)}
                                     + "\" is missing its closing \""
                             );
                             return {};
@@ -1792,7 +2273,7 @@ auto lex_line(
                             assert (j > 1);
                             errors.emplace_back(
                                 source_position(lineno, i),
-                                "character literal '" + line.substr(i+1, j-1)
+                                "character literal '" + std::string{line.substr(i+1, j-1)}
                                     + "' is missing its closing '"
                             );
                             return {};
@@ -1936,9 +2417,22 @@ class tokens
     //  a second token stream when lowering to Cpp1 to re-interleave comments
     std::vector<comment> comments;
 
+    //  The one owned copy of each stream comment's text - comments view
+    //  this (or their source line, for line comments) instead of each
+    //  holding an owned string
+    text_pool comment_texts;
+
     //  A stable place to store additional tokens that are synthesized later
     stable_vector<token> generated_tokens;
 
+    //  A lazily built structure-of-arrays mirror of grammar_map, for
+    //  cache-friendly whole-stream scans - see get_soa()
+    token_soa soa;
+
+    //  Sum of the per-section reserve estimates, kept so -stats can
+    //  report how well the bytes-per-token model predicted reality
+    size_t predicted_tokens = 0;
+
 public:
     //-----------------------------------------------------------------------
     //  Constructor
@@ -1994,6 +2488,24 @@ public:
             auto current_comment = std::string{};
             auto current_comment_start = source_position{};
 
+            //  Size the section's token vector from its source bytes up
+            //  front (Cpp2 averages a token per ~3 bytes; over-estimating
+            //  a little is cheaper than regrowing and copying the tokens
+            //  already lexed), so appending during lexing doesn't allocate
+            {
+                auto section_bytes = size_t{0};
+                for (
+                    auto peek_ahead = line;
+                    peek_ahead != std::end(lines) && peek_ahead->cat == source_line::category::cpp2;
+                    ++peek_ahead
+                    )
+                {
+                    section_bytes += peek_ahead->text.size();
+                }
+                entry.reserve( section_bytes / 3 + 1 );
+                predicted_tokens += section_bytes / 3 + 1;
+            }
+
             for (
                 ;
                 line != std::end(lines) && line->cat == source_line::category::cpp2;
@@ -2001,9 +2513,9 @@ public:
                 )
             {
                 lex_line(
-                    line->text, lineno,
+                    *line, lineno,
                     in_comment, current_comment, current_comment_start,
-                    entry, comments, errors,
+                    entry, comments, comment_texts, errors,
                     raw_string_multiline
                 );
 
@@ -2045,6 +2557,16 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  get_predicted_tokens: The summed reserve estimates - see -stats
+    //
+    auto get_predicted_tokens() const
+        -> size_t
+    {
+        return predicted_tokens;
+    }
+
+
     //-----------------------------------------------------------------------
     //  get_comments: Access the comment list
     //
@@ -2065,6 +2587,35 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  get_soa: Access the token stream as parallel arrays
+    //
+    //  Built on first use and refreshed if tokens were added since, so
+    //  call it after lexing (and after any metafunctions have run) -
+    //  passes that walk every token but read only its kind or position
+    //  should prefer this view over get_map()
+    //
+    auto get_soa()
+        -> token_soa const&
+    {
+        auto total = ptrdiff_t{0};
+        for (auto const& [lineno, entry] : grammar_map) {
+            total += std::ssize(entry);
+        }
+
+        if (soa.size() != total) {
+            soa.clear();
+            soa.reserve(total);
+            for (auto const& [lineno, entry] : grammar_map) {
+                for (auto const& t : entry) {
+                    soa.push_back(t);
+                }
+            }
+        }
+        return soa;
+    }
+
+
     //-----------------------------------------------------------------------
     //  num_unprinted_comments: The number of not-yet-printed comments
     //
@@ -2122,7 +2673,7 @@ public:
 
 };
 
-static auto generated_lexers = stable_vector<tokens>{};    // TODO: static
+static thread_local auto generated_lexers = stable_vector<tokens>{};    // thread_local: see -jobs
 
 }
 
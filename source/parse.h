@@ -14,11 +14,17 @@
 #define CPP2_PARSE_H
 
 #include "lex.h"
+#include <set>
+#include <unordered_set>
 
 
 namespace cpp2 {
 
-auto violates_lifetime_safety = false;
+//  thread_local, and reset at the start of each compile: a resident
+//  process (-jobs, -watch, -daemon, cpp2::compile) must not report one
+//  file's lifetime violation against the next file it compiles
+//
+thread_local auto violates_lifetime_safety = false;
 
 //-----------------------------------------------------------------------
 //  Operator categorization
@@ -28,65 +34,62 @@ auto violates_lifetime_safety = false;
 //G     one of  '!' '-' '+'
 //GT     parameter-direction
 //G
+inline constexpr auto prefix_operators = lexeme_set{
+    lexeme::Not,
+    lexeme::Minus,
+    lexeme::Plus
+};
+
 auto is_prefix_operator(token const& tok)
     -> bool
 {
-    switch (tok.type()) {
-    break;case lexeme::Not:
-          case lexeme::Minus:
-          case lexeme::Plus:
-        return true;
-    break;default:
-        return false;
-    }
+    return prefix_operators.contains(tok.type());
 }
 
 
 //G postfix-operator:
 //G     one of  '++' '--' '*' '&' '~' '$' '...'
 //G
+inline constexpr auto postfix_operators = lexeme_set{
+    lexeme::PlusPlus,
+    lexeme::MinusMinus,
+    lexeme::Multiply,
+    lexeme::Ampersand,
+    lexeme::Tilde,
+    lexeme::Dollar,
+    lexeme::Ellipsis,
+    lexeme::EllipsisLess,
+    lexeme::EllipsisEqual
+};
+
 auto is_postfix_operator(lexeme l)
     -> bool
 {
-    switch (l) {
-    break;case lexeme::PlusPlus:
-          case lexeme::MinusMinus:
-          case lexeme::Multiply:
-          case lexeme::Ampersand:
-          case lexeme::Tilde:
-          case lexeme::Dollar:
-          case lexeme::Ellipsis:
-          case lexeme::EllipsisLess:
-          case lexeme::EllipsisEqual:
-              return true;
-    break;default:
-        return false;
-    }
+    return postfix_operators.contains(l);
 }
 
 
 //G assignment-operator:
 //G     one of  '=' '*=' '/=' '%=' '+=' '-=' '>>=' '<<=' '&=' '^=' '|='
 //G
+inline constexpr auto assignment_operators = lexeme_set{
+    lexeme::Assignment,
+    lexeme::MultiplyEq,
+    lexeme::SlashEq,
+    lexeme::ModuloEq,
+    lexeme::PlusEq,
+    lexeme::MinusEq,
+    lexeme::RightShiftEq,
+    lexeme::LeftShiftEq,
+    lexeme::AmpersandEq,
+    lexeme::CaretEq,
+    lexeme::PipeEq
+};
+
 auto is_assignment_operator(lexeme l)
     -> bool
 {
-    switch (l) {
-    break;case lexeme::Assignment:
-          case lexeme::MultiplyEq:
-          case lexeme::SlashEq:
-          case lexeme::ModuloEq:
-          case lexeme::PlusEq:
-          case lexeme::MinusEq:
-          case lexeme::RightShiftEq:
-          case lexeme::LeftShiftEq:
-          case lexeme::AmpersandEq:
-          case lexeme::CaretEq:
-          case lexeme::PipeEq:
-        return true;
-    break;default:
-        return false;
-    }
+    return assignment_operators.contains(l);
 }
 
 
@@ -115,6 +118,61 @@ auto try_visit(auto& variant, auto& visitor, int depth)
 }
 
 
+//-----------------------------------------------------------------------
+//  visit_variant
+//
+//  Table-driven companion to try_visit, for visit functions that walk
+//  every alternative: dispatches on the variant's index with a single
+//  indirect call through a per-visitor jump table, instead of testing
+//  each alternative in turn. Alternatives that aren't pointers to
+//  visitable nodes (i.e., std::monostate) get a no-op entry
+//
+template <typename Variant, typename Visitor>
+struct variant_visit_table
+{
+    using entry = void (*)(Variant const&, Visitor&, int);
+
+    template <size_t I>
+    static constexpr auto make_entry()
+        -> entry
+    {
+        if constexpr (
+            requires (std::variant_alternative_t<I, Variant> const& s, Visitor& v, int depth)
+                { s->visit(v, depth); }
+            )
+        {
+            return [](Variant const& variant, Visitor& visitor, int depth) {
+                auto const& s = std::get<I>(variant);
+                assert (s);
+                s->visit(visitor, depth+1);
+            };
+        }
+        else {
+            return [](Variant const&, Visitor&, int) {};
+        }
+    }
+
+    template <size_t... Is>
+    static constexpr auto make_entries(std::index_sequence<Is...>)
+        -> std::array<entry, sizeof...(Is)>
+    {
+        return { make_entry<Is>()... };
+    }
+
+    static constexpr auto entries =
+        make_entries(std::make_index_sequence<std::variant_size_v<Variant>>());
+};
+
+auto visit_variant(auto const& variant, auto& visitor, int depth)
+    -> void
+{
+    variant_visit_table<
+        std::remove_cvref_t<decltype(variant)>,
+        std::remove_cvref_t<decltype(visitor)>
+    >::entries[variant.index()](variant, visitor, depth);
+}
+
+
 struct expression_list_node;
 struct id_expression_node;
 struct declaration_node;
@@ -123,7 +181,363 @@ struct literal_node;
 struct template_argument;
 
 
+
+//-----------------------------------------------------------------------
+//
+//  ruleinstr: optional per-grammar-rule markers for the parser
+//
+//  The recursive-descent functions inline into each other, so an
+//  external profiler can't attribute parse time to grammar productions.
+//  Build with -DCPP2_RULE_INSTR to compile in entry markers: each rule
+//  records its entry count, inclusive wall time, and deepest recursion
+//  level, and main() prints the table at exit. (Inclusive means a rule
+//  that recurses through itself counts the nested time again - read the
+//  numbers as "time below this production", not as a partition.)
+//  Off by default: enabled it costs a clock read per rule entry,
+//  disabled it compiles to nothing
+//
+//-----------------------------------------------------------------------
+//
+//#define CPP2_RULE_INSTR
+
+#ifdef CPP2_RULE_INSTR
+class ruleinstr
+{
+    struct slot {
+        long long entries   = 0;
+        long long ns        = 0;
+        int       max_depth = 0;
+    };
+    using table = std::map<std::string_view, slot>;
+
+    //  Each thread tallies into its own table without locking, and folds
+    //  it into the merged table when the thread goes away
+    //
+    static inline table      merged      = {};
+    static inline std::mutex merged_mutex;
+
+    struct thread_table {
+        table slots;
+        int   depth = 0;
+        ~thread_table() { merge(*this); }
+    };
+    static thread_local thread_table mine;  // defined after the class - see below
+
+    static auto merge(thread_table const& t)
+        -> void
+    {
+        auto lock = std::lock_guard{ merged_mutex };
+        for (auto const& [name, s] : t.slots) {
+            auto& m = merged[name];
+            m.entries  += s.entries;
+            m.ns       += s.ns;
+            m.max_depth = std::max( m.max_depth, s.max_depth );
+        }
+    }
+
+public:
+    struct guard
+    {
+        std::string_view                      name;
+        std::chrono::steady_clock::time_point start;
+
+        guard(std::string_view n)
+            : name { n }
+            , start{ std::chrono::steady_clock::now() }
+        {
+            ++mine.depth;
+        }
+
+        ~guard()
+        {
+            auto& s = mine.slots[name];
+            ++s.entries;
+            s.ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start
+            ).count();
+            s.max_depth = std::max( s.max_depth, mine.depth );
+            --mine.depth;
+        }
+    };
+
+    static auto print_table(std::ostream& o = std::cerr)
+        -> void
+    {
+        //  Fold in this thread's own numbers - its destructor-time merge
+        //  would come too late to print
+        auto all = table{};
+        {
+            merge(mine);
+            mine.slots.clear();
+            auto lock = std::lock_guard{ merged_mutex };
+            all = merged;
+        }
+
+        auto rows = std::vector<std::pair<std::string_view, slot>>{ all.begin(), all.end() };
+        std::sort(
+            rows.begin(),
+            rows.end(),
+            [](auto const& a, auto const& b) { return a.second.ns > b.second.ns; }
+        );
+
+        o << "\n=== Grammar rule counters (inclusive) ===\n";
+        for (auto const& [name, s] : rows) {
+            o
+                << "  " << std::setw(12) << s.entries
+                << " x  " << std::setw(10) << s.ns/1000 << " us"
+                << "  depth " << std::setw(4) << s.max_depth
+                << "  " << name << "\n";
+        }
+    }
+};
+inline thread_local ruleinstr::thread_table ruleinstr::mine = {};
+
+#define RULEINSTR ruleinstr::guard _r_guard{ __func__ };
+#else
+#define RULEINSTR
+#endif
+
+
+//-----------------------------------------------------------------------
+//
+//  ast_node_arena: a bump allocator all AST node types draw from
+//
+//  Node allocation is a pointer bump into large chunks, individual nodes
+//  are never freed, and the memory is released all at once when the last
+//  node (normally via the translation_unit_node) goes away
+//
+//-----------------------------------------------------------------------
+//
+class ast_node_arena
+{
+    static constexpr size_t chunk_size   = 64 * 1024;
+    static constexpr size_t granule      = alignof(std::max_align_t);
+    static constexpr size_t retain_bytes = 16 * 1024 * 1024;    // warm-pool cap, see below
+
+    struct chunk {
+        std::unique_ptr<std::byte[]> bytes;
+        size_t                       size;
+    };
+    std::vector<chunk> chunks;
+    std::byte* next      = nullptr;
+    size_t     remaining = 0;
+    ptrdiff_t  live        = 0;
+    ptrdiff_t  total       = 0;
+    long long  chunk_bytes = 0;
+
+    //  Per-arena numbers for the -stats channel: the warm pool's
+    //  chunks stay counted as held across a reset, so a block that
+    //  escapes both the pool and the frees shows up as growth
+    arena_registry::entry& stats = arena_registry::add( "AST node arena" );
+
+    //  Warm pool: standard-size chunks kept (not freed) from previous
+    //  compiles on this thread, up to retain_bytes total, so a resident
+    //  process (-daemon, -watch) doesn't rebuild its arena from zero on
+    //  every request
+    //
+    std::vector<chunk> spares;
+
+    //  Freed nodes by size class, as intrusive singly-linked lists
+    //  threaded through the freed memory itself: parse speculation
+    //  allocates nodes and then discards them when a grammar alternative
+    //  doesn't match, and on expression-heavy files letting that memory
+    //  lie dead in the chunks adds up - so hand it out again first
+    //
+    std::vector<void*> free_list;   // index = size / granule
+
+    //  32-bit handles (see node_handle in sema.h): every chunk is carved
+    //  into 64K windows, a handle is window-index : granule-offset, and
+    //  windows[] maps a window index back to its base address. ranges[]
+    //  is the reverse map, kept sorted by base for the binary search in
+    //  to_handle. Handle 0 is reserved for null, so windows[0] is unused
+    //
+    static constexpr size_t   window_bits = 12;
+    static_assert( chunk_size / granule == (size_t{1} << window_bits),
+                   "a window must hold exactly 2^window_bits granules" );
+    std::vector<std::byte*>   windows     = { nullptr };
+
+    struct chunk_range {
+        std::byte const* base;
+        size_t           size;
+        u32              first_window;
+    };
+    std::vector<chunk_range>  ranges;
+
+    auto register_chunk(chunk const& c)
+        -> void
+    {
+        auto first = unchecked_narrow<u32>(windows.size());
+        for (size_t k = 0; k < c.size; k += chunk_size) {
+            windows.push_back( c.bytes.get() + k );
+        }
+        assert(
+            windows.size() <= (size_t{1} << 20)
+            && "ICE: AST arena exceeded the 64GB addressable by 32-bit node handles"
+        );
+        auto range = chunk_range{ c.bytes.get(), c.size, first };
+        ranges.insert(
+            std::lower_bound(
+                ranges.begin(), ranges.end(), range,
+                [](chunk_range const& a, chunk_range const& b) { return a.base < b.base; }
+            ),
+            range
+        );
+    }
+
+public:
+    //  Compress a pointer to a node in this arena into a 32-bit handle,
+    //  and back - see node_handle in sema.h for the why
+    //
+    auto to_handle(void const* p) const
+        -> u32
+    {
+        if (!p) {
+            return 0;
+        }
+        auto byte_p = static_cast<std::byte const*>(p);
+        auto iter   = std::upper_bound(
+            ranges.begin(), ranges.end(), byte_p,
+            [](std::byte const* v, chunk_range const& r) { return v < r.base; }
+        );
+        assert(
+            iter != ranges.begin()
+            && "ICE: to_handle called on a pointer outside the AST arena"
+        );
+        --iter;
+        auto offset = static_cast<size_t>(byte_p - iter->base);
+        assert (offset < iter->size);
+        return unchecked_narrow<u32>(
+              ((iter->first_window + offset / chunk_size) << window_bits)
+            | (offset % chunk_size) / granule
+        );
+    }
+
+    auto to_pointer(u32 h) const
+        -> void*
+    {
+        if (!h) {
+            return nullptr;
+        }
+        return windows[h >> window_bits] + (h & ((u32{1} << window_bits) - 1)) * granule;
+    }
+
+    auto allocate(size_t n)
+        -> void*
+    {
+        n = (n + granule-1) & ~(granule-1);
+        heapinstr::record_node( n );
+        ++live;
+        ++total;
+
+        if (auto i = n / granule;
+            i < free_list.size()
+            && free_list[i]
+            )
+        {
+            auto p = free_list[i];
+            free_list[i] = *static_cast<void**>(p);
+            return p;
+        }
+
+        if (n > remaining) {
+            if (
+                !spares.empty()
+                && n <= chunk_size
+                )
+            {
+                chunks.push_back( std::move(spares.back()) );
+                spares.pop_back();
+            }
+            else {
+                auto size = std::max(n, chunk_size);
+                chunks.push_back({ std::make_unique<std::byte[]>(size), size });
+                stats.add_block( static_cast<long long>(size) );
+            }
+            next      = chunks.back().bytes.get();
+            remaining = chunks.back().size;
+            register_chunk( chunks.back() );
+            heapinstr::record_chunk( "AST arena chunks", chunks.back().size );
+            chunk_bytes += static_cast<long long>(chunks.back().size);
+        }
+        auto p = next;
+        next      += n;
+        remaining -= n;
+        return p;
+    }
+
+    //  The number of nodes ever allocated - for profiling
+    auto total_allocated() const
+        -> ptrdiff_t
+    {
+        return total;
+    }
+
+    auto deallocate(
+        void*  p,
+        size_t n
+    )
+        -> void
+    {
+        if (--live == 0) {
+            //  Move standard-size chunks into the warm pool, up to the
+            //  retention cap, and free the rest - retained memory is
+            //  handed out again by the next compile on this thread
+            auto pooled = spares.size() * chunk_size;
+            for (auto& c : chunks) {
+                if (flag_poison_arenas) {
+                    //  Poison pooled and freed chunks alike - the pooled
+                    //  ones are the memory the next compile hands out
+                    std::memset( c.bytes.get(), 0xDD, c.size );
+                }
+                if (
+                    c.size == chunk_size
+                    && pooled + chunk_size <= retain_bytes
+                    )
+                {
+                    spares.push_back( std::move(c) );
+                    pooled += chunk_size;
+                }
+                else {
+                    stats.drop_block( static_cast<long long>(c.size) );
+                }
+            }
+            chunks.clear();
+            stats.note_reset();
+            next      = nullptr;
+            remaining = 0;
+            free_list.clear();
+            windows.assign( 1, nullptr );
+            ranges.clear();
+            heapinstr::release_chunks( chunk_bytes );
+            chunk_bytes = 0;
+            return;
+        }
+
+        n = (n + granule-1) & ~(granule-1);
+        auto i = n / granule;
+        if (i >= free_list.size()) {
+            free_list.resize( i+1 );
+        }
+        *static_cast<void**>(p) = free_list[i];
+        free_list[i] = p;
+    }
+};
+
+static thread_local ast_node_arena node_arena = {};  // thread_local: see -jobs
+
+//  Inheriting from this puts a node type into the arena - the node's
+//  destructor still runs normally via unique_ptr, but its memory is a
+//  pointer bump to allocate and free to deallocate
+//
+struct arena_allocated
+{
+    auto operator new(std::size_t n) -> void*                    { return node_arena.allocate(n); }
+    auto operator delete(void* p, std::size_t n) noexcept -> void { node_arena.deallocate(p, n); }
+};
+
+
 struct primary_expression_node
+    : arena_allocated
 {
     enum active : u8 { empty=0, identifier, expression_list, id_expression, declaration, inspect, literal };
     std::variant<
@@ -182,7 +596,9 @@ struct primary_expression_node
 };
 
 
-struct literal_node {
+struct literal_node
+    : arena_allocated
+{
     //  A literal is represented as a sequence of tokens:
     //      - length 1: a literal (most common)
     //      - length 2: a literal and a user-defined suffix
@@ -255,10 +671,39 @@ struct literal_node {
 
 struct postfix_expression_node;
 
+
+//-----------------------------------------------------------------------
+//  string_memo: a lazily filled cache for a node's to_string()
+//
+//  An expression's spelling doesn't change once its node is fully built,
+//  but the same subexpression gets stringified repeatedly - for
+//  diagnostics, for emission, for metafunction inspection - so the
+//  first result can be handed back as a reference ever after
+//
+class string_memo
+{
+    mutable std::string cached;
+    mutable bool        have = false;
+
+public:
+    auto get(auto&& compute) const
+        -> std::string const&
+    {
+        if (!have) {
+            cached = compute();
+            have   = true;
+        }
+        return cached;
+    }
+};
+
+
 struct prefix_expression_node
+    : arena_allocated
 {
     std::vector<token const*>                ops;
     std::unique_ptr<postfix_expression_node> expr;
+    string_memo                              memo;
 
     // Out-of-line definition of the dtor is necessary due to the forward-declared
     // type(s) used in a std::unique_ptr as a member
@@ -310,7 +755,7 @@ struct prefix_expression_node
     auto is_result_a_temporary_variable() const -> bool;
 
     auto to_string() const
-        -> std::string;
+        -> std::string const&;
 
     //  Internals
     //
@@ -323,10 +768,11 @@ struct expression_node;
 
 
 template<
-    String   Name,
+    string_util::fixed_string Name,
     typename Term
 >
 struct binary_expression_node
+    : arena_allocated
 {
     std::unique_ptr<Term>  expr;
     expression_node const* my_expression = {};
@@ -476,7 +922,7 @@ struct binary_expression_node
     }
 
     auto is_result_a_temporary_variable() const -> bool {
-        if constexpr (std::string_view(Name.value) == "assignment") {
+        if constexpr (Name.view() == "assignment") {
             assert(expr);
             return expr->is_result_a_temporary_variable();
         } else {
@@ -555,12 +1001,14 @@ struct assignment_expression_lhs_rhs {
 struct expression_statement_node;
 
 struct expression_node
+    : arena_allocated
 {
-    static inline std::vector<expression_node*> current_expressions = {};   // TODO: static ?
+    static inline thread_local std::vector<expression_node*> current_expressions = {};   // thread_local: see -jobs
 
     std::unique_ptr<assignment_expression_node> expr;
     int num_subexpressions = 0;
     expression_statement_node const* my_statement = {};
+    string_memo memo;
 
     expression_node();
 
@@ -635,10 +1083,10 @@ struct expression_node
         -> assignment_expression_lhs_rhs;
 
     auto to_string() const
-        -> std::string
+        -> std::string const&
     {
         assert (expr);
-        return expr->to_string();
+        return memo.get( [&]{ return expr->to_string(); } );
     }
 
     //  Internals
@@ -660,7 +1108,7 @@ struct expression_node
 
 
 template<
-    String   Name,
+    string_util::fixed_string Name,
     typename Term
 >
 binary_expression_node<Name, Term>::binary_expression_node() {
@@ -671,7 +1119,7 @@ binary_expression_node<Name, Term>::binary_expression_node() {
 
 
 template<
-    String   Name,
+    string_util::fixed_string Name,
     typename Term
 >
 auto binary_expression_node<Name, Term>::is_standalone_expression() const
@@ -714,6 +1162,7 @@ auto to_string_view(passing_style pass) -> std::string_view {
 
 
 struct expression_list_node
+    : arena_allocated
 {
     token const* open_paren  = {};
     token const* close_paren = {};
@@ -842,8 +1291,9 @@ auto primary_expression_node::get_literal() const
 
 
 struct expression_statement_node
+    : arena_allocated
 {
-    static inline std::vector<expression_statement_node*> current_expression_statements = {};   // TODO: static ?
+    static inline thread_local std::vector<expression_statement_node*> current_expression_statements = {};   // thread_local: see -jobs
 
     std::unique_ptr<expression_node> expr;
     bool has_semicolon = false;
@@ -920,8 +1370,71 @@ struct capture {
     auto operator==(postfix_expression_node* p) { return capture_expr == p; }
 };
 
+//  The members of a capture group: nearly every capture group holds just a
+//  few captures, so keep them in an inline buffer and spill to the heap only
+//  for the rare larger group - this avoids a vector allocation per anonymous
+//  function / postcondition / interpolated string literal
+//
+struct capture_list {
+    static constexpr std::size_t inline_capacity = 4;
+
+    auto size () const -> std::size_t { return num; }
+    auto empty() const -> bool        { return num == 0; }
+
+    auto data ()       ->       capture* { return is_spilled ? spill.data() : buf.data(); }
+    auto data () const -> capture const* { return is_spilled ? spill.data() : buf.data(); }
+
+    auto begin ()       { return data(); }
+    auto end   ()       { return data() + num; }
+    auto begin () const { return data(); }
+    auto end   () const { return data() + num; }
+    auto cbegin() const { return data(); }
+    auto cend  () const { return data() + num; }
+    auto rbegin()       { return std::reverse_iterator( end () ); }
+    auto rend  ()       { return std::reverse_iterator( begin() ); }
+
+    auto push_back(capture cap)
+        -> void
+    {
+        if (!is_spilled && num == inline_capacity) {
+            spill.reserve( 2*inline_capacity );
+            spill.assign( std::move_iterator(buf.begin()), std::move_iterator(buf.end()) );
+            is_spilled = true;
+        }
+        if (is_spilled) {
+            spill.push_back( std::move(cap) );
+        }
+        else {
+            buf[num] = std::move(cap);
+        }
+        ++num;
+    }
+
+    //  Note: Order-preserving, because member order determines the numbering
+    //  of the generated lambda capture symbols
+    auto erase_at(std::size_t idx)
+        -> void
+    {
+        assert (idx < num);
+        if (is_spilled) {
+            spill.erase( spill.begin() + idx );
+        }
+        else {
+            std::move( buf.begin()+idx+1, buf.begin()+num, buf.begin()+idx );
+            buf[num-1] = {};
+        }
+        --num;
+    }
+
+private:
+    std::array<capture, inline_capacity> buf        = {};
+    std::vector<capture>                 spill;
+    std::size_t                          num        = 0;
+    bool                                 is_spilled = false;
+};
+
 struct capture_group {
-    std::vector<capture> members;
+    capture_list members;
 
     auto add(postfix_expression_node* p)
         -> void
@@ -937,6 +1450,7 @@ struct capture_group {
 
 
 struct postfix_expression_node
+    : arena_allocated
 {
     std::unique_ptr<primary_expression_node> expr;
 
@@ -956,6 +1470,7 @@ struct postfix_expression_node
     };
     std::vector<term> ops;
     capture_group* cap_grp = {};
+    string_memo    memo;
 
     ~postfix_expression_node();
 
@@ -1042,7 +1557,7 @@ struct postfix_expression_node
     }
 
     auto to_string() const
-        -> std::string;
+        -> std::string const&;
 
     //  Internals
     //
@@ -1133,9 +1648,19 @@ auto capture_group::remove(postfix_expression_node* p)
     -> void
 {
     p->cap_grp = {};
-    auto old_size = members.size();
-    std::erase(members, p);
-    assert (members.size() == old_size-1);
+    //  Deregistration happens when a speculative parse is discarded, which
+    //  destroys nodes newest-first, so search from the back: the match is
+    //  nearly always the last member and erasing it is then trivial
+    auto idx = members.size();
+    while (
+        idx > 0
+        && members.data()[idx-1].capture_expr != p
+        )
+    {
+        --idx;
+    }
+    assert (idx > 0 && "ICE: postfix-expression not found in its capture group");
+    members.erase_at(idx-1);
 }
 
 
@@ -1154,17 +1679,19 @@ capture_group::~capture_group()
 
 
 auto prefix_expression_node::to_string() const
-    -> std::string
+    -> std::string const&
 {
-    auto ret = std::string{};
+    return memo.get( [&]{
+        auto ret = std::string{};
 
-    for (auto const& x : ops) {
-        assert (x);
-        ret += x->as_string_view();
-    }
+        for (auto const& x : ops) {
+            assert (x);
+            ret += x->as_string_view();
+        }
 
-    assert (expr);
-    return ret + expr->to_string();
+        assert (expr);
+        return ret + expr->to_string();
+    });
 }
 
 
@@ -1226,6 +1753,7 @@ struct template_argument
 inline std::vector<template_argument> const no_template_args;
 
 struct unqualified_id_node
+    : arena_allocated
 {
     token const* identifier      = {};  // required
 
@@ -1235,12 +1763,21 @@ struct unqualified_id_node
 
     std::vector<template_argument> template_args;
 
+    //  Hash-consed canonical spelling of the template-argument list:
+    //  occurrences that spell the same arguments share one interned copy
+    //  (see parser::intern_template_args), so comparing two lists for
+    //  equality is a pointer comparison of the keys' .data()
+    std::string_view template_args_key = {};
+
     auto template_arguments() const
         -> std::vector<template_argument> const&
     {
         return template_args;
     }
 
+    auto template_arguments_to_string() const
+        -> std::string;
+
     auto get_token() const
         -> token const*
     {
@@ -1277,8 +1814,7 @@ struct unqualified_id_node
             assert(template_args.empty()
                    || template_args.front().comma == source_position{});
             for (auto& a : template_args) {
-                try_visit<template_argument::expression>(a.arg, v, depth+1);
-                try_visit<template_argument::type_id   >(a.arg, v, depth+1);
+                visit_variant(a.arg, v, depth+1);
             }
             v.end(template_args_tag{}, depth);
         }
@@ -1289,6 +1825,7 @@ struct unqualified_id_node
 
 
 struct qualified_id_node
+    : arena_allocated
 {
     struct term {
         token const* scope_op;
@@ -1375,6 +1912,7 @@ struct qualified_id_node
 struct function_type_node;
 
 struct type_id_node
+    : arena_allocated
 {
     source_position pos;
 
@@ -1396,6 +1934,9 @@ struct type_id_node
 
     std::unique_ptr<type_id_node> constraint = {};
 
+    //  The memoized interned handle of the canonical spelling - see intern_id
+    mutable int32_t canonical = 0;
+
     // Out-of-line definition of the dtor is necessary due to the forward-declared
     // type(s) used in a std::unique_ptr as a member
     ~type_id_node();
@@ -1449,6 +1990,14 @@ struct type_id_node
     auto to_string() const
         -> std::string;
 
+    //  intern_id: canonicalize this type-id into an interned handle, so
+    //  repeated equality tests against another name are an integer compare
+    //  instead of comparing (possibly very long, deeply templated) text -
+    //  memoized, because the spelling doesn't change after parse
+    //
+    auto intern_id() const
+        -> int32_t;
+
     auto get_token() const
         -> token const*
     {
@@ -1485,11 +2034,7 @@ struct type_id_node
         for (auto q : pc_qualifiers) {
             v.start(*q, depth+1);
         }
-        try_visit<postfix    >(id, v, depth);
-        try_visit<qualified  >(id, v, depth);
-        try_visit<unqualified>(id, v, depth);
-        try_visit<function   >(id, v, depth);
-        try_visit<keyword    >(id, v, depth);
+        visit_variant(id, v, depth);
         if (constraint) {
             constraint->visit(v, depth + 1);
         }
@@ -1503,21 +2048,29 @@ auto unqualified_id_node::to_string() const
     assert(identifier);
     auto ret = identifier->to_string();
     if (open_angle != source_position{}) {
-        auto separator = std::string{"<"};
-        for (auto& t : template_args) {
-            ret += separator;
-            assert(t.arg.index() != template_argument::empty);
-            if (t.arg.index() == template_argument::expression) {
-                ret += std::get<template_argument::expression>(t.arg)->to_string();
-            }
-            else if (t.arg.index() == template_argument::type_id) {
-                ret += std::get<template_argument::type_id>(t.arg)->to_string();
-            }
-            separator = ",";
+        ret += template_arguments_to_string();
+    }
+    return ret;
+}
+
+auto unqualified_id_node::template_arguments_to_string() const
+    -> std::string
+{
+    auto ret       = std::string{};
+    auto separator = std::string{"<"};
+    for (auto& t : template_args) {
+        ret += separator;
+        assert(t.arg.index() != template_argument::empty);
+        if (t.arg.index() == template_argument::expression) {
+            ret += std::get<template_argument::expression>(t.arg)->to_string();
         }
-        if (std::ssize(template_args) > 0) {
-            ret += ">";
+        else if (t.arg.index() == template_argument::type_id) {
+            ret += std::get<template_argument::type_id>(t.arg)->to_string();
         }
+        separator = ",";
+    }
+    if (std::ssize(template_args) > 0) {
+        ret += ">";
     }
     return ret;
 }
@@ -1541,6 +2094,7 @@ auto template_argument::to_string() const
 
 
 struct is_as_expression_node
+    : arena_allocated
 {
     std::unique_ptr<prefix_expression_node> expr;
 
@@ -1699,6 +2253,7 @@ expression_node::expression_node()
 
 
 struct id_expression_node
+    : arena_allocated
 {
     source_position pos;
 
@@ -1779,8 +2334,7 @@ struct id_expression_node
         -> void
     {
         v.start(*this, depth);
-        try_visit<qualified  >(id, v, depth);
-        try_visit<unqualified>(id, v, depth);
+        visit_variant(id, v, depth);
         v.end(*this, depth);
     }
 };
@@ -1842,23 +2396,25 @@ auto postfix_expression_node::get_first_token_ignoring_this() const
 
 
 auto postfix_expression_node::to_string() const
-    -> std::string
+    -> std::string const&
 {
-    assert (expr);
-    auto ret = expr->to_string();
+    return memo.get( [&]{
+        assert (expr);
+        auto ret = expr->to_string();
 
-    for (auto const& x : ops) {
-        assert (x.op);
-        ret += x.op->as_string_view();
-        if (x.id_expr) {
-            ret += x.id_expr->to_string();
-        }
-        if (x.expr_list) {
-            ret += x.expr_list->to_string();
+        for (auto const& x : ops) {
+            assert (x.op);
+            ret += x.op->as_string_view();
+            if (x.id_expr) {
+                ret += x.id_expr->to_string();
+            }
+            if (x.expr_list) {
+                ret += x.expr_list->to_string();
+            }
         }
-    }
 
-    return ret;
+        return ret;
+    });
 }
 
 
@@ -1888,6 +2444,7 @@ auto postfix_expression_node::visit(auto& v, int depth)
 struct statement_node;
 
 struct compound_statement_node
+    : arena_allocated
 {
     source_position open_brace;
     source_position close_brace;
@@ -1933,6 +2490,7 @@ struct compound_statement_node
 
 
 struct selection_statement_node
+    : arena_allocated
 {
     bool                                        is_constexpr = false;
     token const*                                identifier   = {};
@@ -1970,6 +2528,7 @@ struct selection_statement_node
 struct parameter_declaration_node;
 
 struct iteration_statement_node
+    : arena_allocated
 {
     token const*                                label      = {};
     token const*                                identifier = {};
@@ -2000,6 +2559,7 @@ struct iteration_statement_node
 
 
 struct return_statement_node
+    : arena_allocated
 {
     token const*                     identifier = {};
     std::unique_ptr<expression_node> expression;
@@ -2024,6 +2584,7 @@ struct return_statement_node
 
 
 struct alternative_node
+    : arena_allocated
 {
     std::unique_ptr<unqualified_id_node>     name;
     token const*                             is_as_keyword = {};
@@ -2052,6 +2613,7 @@ struct alternative_node
 
 
 struct inspect_expression_node
+    : arena_allocated
 {
     bool                             is_constexpr = false;
     token const*                     identifier   = {};
@@ -2093,6 +2655,7 @@ struct inspect_expression_node
 
 
 struct contract_node
+    : arena_allocated
 {
     //  Declared first, because it should outlive any owned
     //  postfix_expressions that could refer to it
@@ -2144,6 +2707,7 @@ struct contract_node
 
 
 struct jump_statement_node
+    : arena_allocated
 {
     token const* keyword;
     token const* label;
@@ -2171,6 +2735,7 @@ struct jump_statement_node
 
 
 struct using_statement_node
+    : arena_allocated
 {
     token const*                        keyword = {};
     std::unique_ptr<id_expression_node> id;
@@ -2203,6 +2768,7 @@ struct using_statement_node
 struct parameter_declaration_list_node;
 
 struct statement_node
+    : arena_allocated
 {
     std::unique_ptr<parameter_declaration_list_node> parameters;
     compound_statement_node* compound_parent = nullptr;
@@ -2334,6 +2900,7 @@ auto compound_statement_node::visit(auto& v, int depth)
 
 
 struct parameter_declaration_node
+    : arena_allocated
 {
     parameter_declaration_list_node const* my_list;
 
@@ -2439,6 +3006,7 @@ struct parameter_declaration_node
 
 
 struct parameter_declaration_list_node
+    : arena_allocated
 {
     token const* open_paren              = {};
     token const* close_paren             = {};
@@ -2527,16 +3095,7 @@ auto statement_node::visit(auto& v, int depth)
     if (parameters) {
         parameters->visit(v, depth+1);
     }
-    try_visit<expression >(statement, v, depth);
-    try_visit<compound   >(statement, v, depth);
-    try_visit<selection  >(statement, v, depth);
-    try_visit<declaration>(statement, v, depth);
-    try_visit<return_    >(statement, v, depth);
-    try_visit<iteration  >(statement, v, depth);
-    try_visit<using_     >(statement, v, depth);
-    try_visit<contract   >(statement, v, depth);
-    try_visit<inspect    >(statement, v, depth);
-    try_visit<jump       >(statement, v, depth);
+    visit_variant(statement, v, depth);
     v.end(*this, depth);
 }
 
@@ -2544,6 +3103,7 @@ auto statement_node::visit(auto& v, int depth)
 struct function_returns_tag { };
 
 struct function_type_node
+    : arena_allocated
 {
     declaration_node* my_decl;
 
@@ -2887,8 +3447,31 @@ auto type_id_node::to_string() const
     return ret;
 }
 
+auto type_id_node::intern_id() const
+    -> int32_t
+{
+    if (canonical == 0) {
+        //  A plain single-identifier type already carries its token's
+        //  interned id - reuse it so it unifies with identifier compares
+        if (auto tok = get_token();
+            tok
+            && tok->intern_id() != 0
+            && pc_qualifiers.empty()
+            && !constraint
+            )
+        {
+            canonical = tok->intern_id();
+        }
+        else {
+            canonical = interned_identifiers.get_id( to_string() );
+        }
+    }
+    return canonical;
+}
+
 
 struct type_node
+    : arena_allocated
 {
     token const* type;
     bool         final = false;
@@ -2934,6 +3517,7 @@ struct type_node
 
 
 struct namespace_node
+    : arena_allocated
 {
     token const* namespace_;
 
@@ -2956,6 +3540,7 @@ struct namespace_node
 
 
 struct alias_node
+    : arena_allocated
 {
     token const* type = {};
     std::unique_ptr<type_id_node> type_id;   // for objects
@@ -2992,9 +3577,7 @@ struct alias_node
     {
         v.start(*this, depth);
 
-        try_visit<a_type     >(initializer, v, depth+1);
-        try_visit<a_namespace>(initializer, v, depth+1);
-        try_visit<an_object  >(initializer, v, depth+1);
+        visit_variant(initializer, v, depth+1);
 
         v.end(*this, depth);
     }
@@ -3018,7 +3601,20 @@ auto to_string(accessibility a)
 
 struct declaration_identifier_tag { };
 
+//  Cold declaration fields that most declarations never set, stored in
+//  a side table (see extrinsic_storage) so the hot node layout stays
+//  dense for the tree walks. Entries are erased by ~declaration_node,
+//  since the arena recycles node addresses
+//
+struct declaration_node_extras
+{
+    source_position requires_pos                   = {};
+    bool            member_function_generation_off = false;
+};
+static thread_local extrinsic_storage<declaration_node_extras> declaration_extras;
+
 struct declaration_node
+    : arena_allocated
 {
     //  The capture_group is declared first, because it should outlive
     //  any owned postfix_expressions that could refer to it
@@ -3040,7 +3636,6 @@ struct declaration_node
 
     std::vector<std::unique_ptr<id_expression_node>> metafunctions;
     std::unique_ptr<parameter_declaration_list_node> template_parameters;
-    source_position                                  requires_pos = {};
     std::unique_ptr<logical_or_expression_node>      requires_clause_expression;
 
     source_position                 equal_sign = {};
@@ -3049,9 +3644,32 @@ struct declaration_node
     declaration_node*               parent_declaration = {};
     statement_node*                 my_statement = {};
 
-    //  Attributes currently configurable only via metafunction API,
+    //  requires_pos and the member_function_generation attribute live
+    //  in the declaration_extras side table - see declaration_node_extras
+    //
+    auto set_requires_pos(source_position p)
+        -> void
+    {
+        declaration_extras[this].requires_pos = p;
+    }
+
+    auto requires_pos() const
+        -> source_position
+    {
+        if (auto e = declaration_extras.find(this)) {
+            return e->requires_pos;
+        }
+        return {};
+    }
+
+    //  Attribute currently configurable only via metafunction API,
     //  not directly in the base language grammar
-    bool member_function_generation = true;
+    auto member_function_generation() const
+        -> bool
+    {
+        auto e = declaration_extras.find(this);
+        return !e || !e->member_function_generation_off;
+    }
 
     //  Cache some context
     bool is_a_template_parameter  = false;
@@ -3126,6 +3744,7 @@ struct declaration_node
                 ++i;                                    // ... must stay together
             }
         }
+        member_index.reset();
     }
 
     auto type_remove_all_members()
@@ -3138,13 +3757,14 @@ struct declaration_node
         //  Drop all statements in the body, which should self-deregister all our 'captures'
         //  - (only) statements in the body should have been able to refer to 'captures'
         body->statements.clear();
+        member_index.reset();
         assert(captures.members.empty());
     }
 
     auto type_disable_member_function_generation()
         -> void
     {
-        member_function_generation = false;
+        declaration_extras[this].member_function_generation_off = true;
     }
 
     auto object_type() const
@@ -3419,7 +4039,7 @@ public:
         }
 
         //  Else if we're letting Cpp1 generate SMFs, we're likely copyable
-        if (!member_function_generation) {
+        if (!member_function_generation()) {
             return false;
         }
 
@@ -3473,6 +4093,103 @@ public:
     };
 
 private:
+    //  Single-walk index of a type's members. The per-member queries below
+    //  used to rescan the whole member statement list on every call, which
+    //  made type lowering quadratic on large (e.g. generated) types - so
+    //  materialize the member records once and answer all the queries from
+    //  them. Built lazily on first query; the member-mutating functions
+    //  below invalidate it, and a statement-count mismatch (members added
+    //  behind our back, e.g. by a metafunction going through the compound
+    //  statement directly) forces a rebuild too
+    //
+    struct member_index_t {
+        std::vector<declaration_node*>                          members;
+        std::vector<declaration_node*>                          members_functions;
+        std::vector<declaration_node*>                          members_objects;
+        std::vector<declaration_node*>                          members_types;
+        std::vector<declaration_node*>                          members_aliases;
+        std::unordered_map<
+            std::string_view,
+            std::vector<declaration_node*>>                     members_by_name;
+        std::unordered_map<std::string_view, declaration_node*> object_before_base;
+        std::size_t                                             statements_size = 0;
+    };
+    mutable std::optional<member_index_t> member_index = {};
+
+    auto get_member_index() const
+        -> member_index_t const&
+    {
+        assert (is_type() && initializer && initializer->is_compound());
+        auto compound_stmt = initializer->get_if<compound_statement_node>();
+        assert (compound_stmt);
+
+        if (
+            member_index
+            && member_index->statements_size == compound_stmt->statements.size()
+            )
+        {
+            return *member_index;
+        }
+
+        auto idx = member_index_t{};
+        idx.statements_size = compound_stmt->statements.size();
+
+        //  Names whose most recent declaration hasn't (yet) been followed
+        //  by a base type - when we pass a base, they become resolved as
+        //  "object name declared before a base type"
+        auto pending = std::unordered_map<std::string_view, declaration_node*>{};
+
+        for (auto& o : compound_stmt->statements)
+        {
+            auto decl = o->get_if<declaration_node>();
+            if (!decl) {
+                continue;
+            }
+            assert(
+                !decl->is_namespace()
+                && "ICE: a type shouldn't be able to contain a namespace"
+            );
+            idx.members.push_back(decl);
+
+            //  The same walk also populates the per-kind and by-name
+            //  sub-indexes, so a stack of metafunctions applied to one
+            //  type answers each kind/name query without refiltering
+            //  the full member list
+            if      (decl->is_function()) { idx.members_functions.push_back(decl); }
+            else if (decl->is_object())   { idx.members_objects  .push_back(decl); }
+            else if (decl->is_type())     { idx.members_types    .push_back(decl); }
+            else if (decl->is_alias())    { idx.members_aliases  .push_back(decl); }
+
+            if (decl->has_name()) {
+                idx.members_by_name[decl->name()->as_string_view()].push_back(decl);
+            }
+
+            if (
+                decl->is_alias()
+                || !decl->has_name()
+                )
+            {
+                continue;
+            }
+
+            if (decl->has_name("this")) {
+                for (auto& [name, d] : pending) {
+                    idx.object_before_base.try_emplace(name, d);
+                }
+                pending.clear();
+            }
+            else if (auto name = decl->name()->as_string_view();
+                !idx.object_before_base.contains(name)
+                )
+            {
+                pending[name] = decl;
+            }
+        }
+
+        member_index = std::move(idx);
+        return *member_index;
+    }
+
     //  This helper is a const function that delivers pointers
     //  to non-const... because this is the best way I can
     //  think of right now to write the following two get_
@@ -3490,34 +4207,57 @@ private:
             return {};
         }
 
-        auto compound_stmt = initializer->get_if<compound_statement_node>();
-        assert (compound_stmt);
+        auto& idx = get_member_index();
+
+        //  The common queries are pre-filtered - only a mixed kind set
+        //  (other than 'all') still scans the member list
+        switch (w) {
+        break;case all:       return idx.members;
+        break;case functions: return idx.members_functions;
+        break;case objects:   return idx.members_objects;
+        break;case types:     return idx.members_types;
+        break;case aliases:   return idx.members_aliases;
+        break;default:        ;
+        }
 
         auto ret = std::vector<declaration_node*>{};
-        for (auto& o : compound_stmt->statements)
+        for (auto decl : idx.members)
         {
-            auto decl = o->get_if<declaration_node>();
-            if (decl)
+            if (
+                (w & functions  && decl->is_function())
+                || (w & objects && decl->is_object()  )
+                || (w & types   && decl->is_type()    )
+                || (w & aliases && decl->is_alias()   )
+                )
             {
-                assert(
-                    !decl->is_namespace()
-                    && "ICE: a type shouldn't be able to contain a namespace"
-                );
-                if (
-                    (w & functions  && decl->is_function())
-                    || (w & objects && decl->is_object()  )
-                    || (w & types   && decl->is_type()    )
-                    || (w & aliases && decl->is_alias()   )
-                    )
-                {
-                    ret.push_back(decl);
-                }
+                ret.push_back(decl);
             }
         }
 
         return ret;
     }
 
+    //  Like gather_type_scope_declarations, but restricted to members
+    //  with the given name - answered from the by-name sub-index
+    auto gather_type_scope_declarations_named(std::string_view name) const
+        -> std::vector<declaration_node*>
+    {
+        if (
+            !is_type()
+            || !initializer
+            || !initializer->is_compound()
+            )
+        {
+            return {};
+        }
+
+        auto& by_name = get_member_index().members_by_name;
+        if (auto i = by_name.find(name); i != by_name.end()) {
+            return i->second;
+        }
+        return {};
+    }
+
 public:
     auto get_type_scope_declarations(which w = all)
         -> std::vector<declaration_node*>
@@ -3535,6 +4275,19 @@ public:
         return {tmp.begin(), tmp.end()};
     }
 
+    auto get_type_scope_declarations_named(std::string_view name)
+        -> std::vector<declaration_node*>
+    {
+        return gather_type_scope_declarations_named(name);
+    }
+
+    auto get_type_scope_declarations_named(std::string_view name) const
+        -> std::vector<declaration_node const*>
+    {
+        auto tmp = gather_type_scope_declarations_named(name);
+        return {tmp.begin(), tmp.end()};
+    }
+
 
     auto add_type_member( std::unique_ptr<statement_node>&& statement )
         -> bool
@@ -3564,6 +4317,7 @@ public:
         auto compound_stmt = initializer->get_if<compound_statement_node>();
         assert (compound_stmt);
         compound_stmt->statements.push_back(std::move(statement));
+        member_index.reset();
         return true;
     }
 
@@ -3605,35 +4359,23 @@ public:
             decl = decl->parent_declaration;
         }
 
-        if (!decl->is_type()) {
+        if (
+            !decl->is_type()
+            || !decl->initializer
+            || !decl->initializer->is_compound()
+            )
+        {
             return {};
         }
 
-        //  Look for a name match and if so remember the type,
-        //  and look for a base type after that match
-        auto objects               = decl->get_type_scope_declarations();
-        auto found_name            = false;
-        auto found_later_base_type = false;
-
-        for (auto& o : objects) {
-            if (o->is_alias()) {
-                continue;
-            }
-            if (o->has_name(s)) {
-                found_name = true;
-                ret        = o;
-            }
-            if (o->has_name("this")) {
-                if (found_name) {
-                    found_later_base_type = true;
-                    break;
-                }
-            }
-        }
-
-        //  If we didn't find a later base type, discard any name match
-        if (!found_later_base_type) {
-            ret = {};
+        //  Look for a name match that has a base type after it, which the
+        //  type's member index has already worked out in a single walk
+        auto& names = decl->get_member_index().object_before_base;
+        if (auto it = names.find(s);
+            it != names.end()
+            )
+        {
+            ret = it->second;
         }
 
         return ret;
@@ -4114,11 +4856,7 @@ public:
             template_parameters->visit(v, depth+1);
         }
 
-        try_visit<a_function >(type, v, depth+1);
-        try_visit<an_object  >(type, v, depth+1);
-        try_visit<a_type     >(type, v, depth+1);
-        try_visit<a_namespace>(type, v, depth+1);
-        try_visit<an_alias   >(type, v, depth+1);
+        visit_variant(type, v, depth+1);
 
         for (auto& m : metafunctions) {
             assert(m);
@@ -4666,12 +5404,7 @@ auto primary_expression_node::visit(auto& v, int depth)
     -> void
 {
     v.start(*this, depth);
-    try_visit<identifier     >(expr, v, depth);
-    try_visit<expression_list>(expr, v, depth);
-    try_visit<id_expression  >(expr, v, depth);
-    try_visit<declaration    >(expr, v, depth);
-    try_visit<inspect        >(expr, v, depth);
-    try_visit<literal        >(expr, v, depth);
+    visit_variant(expr, v, depth);
     v.end(*this, depth);
 }
 
@@ -4804,6 +5537,7 @@ auto parameter_declaration_node::visit(auto& v, int depth)
 
 
 struct translation_unit_node
+    : arena_allocated
 {
     std::vector< std::unique_ptr<declaration_node> > declarations;
 
@@ -4841,7 +5575,7 @@ primary_expression_node::~primary_expression_node() = default;
 prefix_expression_node::~prefix_expression_node() = default;
 
 template<
-    String   Name,
+    string_util::fixed_string Name,
     typename Term
 >
 binary_expression_node<Name, Term>::~binary_expression_node() = default;
@@ -4856,7 +5590,10 @@ inspect_expression_node::~inspect_expression_node() = default;
 
 statement_node::~statement_node() = default;
 
-declaration_node::~declaration_node() = default;
+declaration_node::~declaration_node()
+{
+    declaration_extras.erase(this);
+}
 
 
 //-----------------------------------------------------------------------
@@ -4874,7 +5611,7 @@ auto pretty_print_visualize(literal_node const& n, int indent)
 auto pretty_print_visualize(prefix_expression_node const& n, int indent)
     -> std::string;
 template<
-    String   Name,
+    string_util::fixed_string Name,
     typename Term
 >
 auto pretty_print_visualize(binary_expression_node<Name,Term> const& n, int indent)
@@ -5093,7 +5830,7 @@ auto pretty_print_visualize(prefix_expression_node const& n, int indent)
 
 
 template<
-    String   Name,
+    string_util::fixed_string Name,
     typename Term
 >
 auto pretty_print_visualize(binary_expression_node<Name,Term> const& n, int indent)
@@ -5738,7 +6475,7 @@ auto pretty_print_visualize(
         && !n.is_parameter()
         )
     {
-        static declaration_node const* last_parent_type = {};
+        static thread_local declaration_node const* last_parent_type = {};
         if (n.parent_is_type()) {
             if (last_parent_type != n.get_parent()) {
                 last_parent_type = n.get_parent();
@@ -5928,6 +6665,140 @@ class parser
     int                       pos              = 0;
     std::string               parse_kind       = {};
 
+    //  Packrat-style memoization of failed parse attempts for the
+    //  backtracking-heavy alternatives: if one of these failed at a given
+    //  token position once, it will fail there again, so later retries
+    //  from outer backtracking paths don't re-parse the same range -
+    //  this keeps worst-case parsing of ambiguous '<' and '(' near-linear
+    //
+    enum class memoized_rule : u8 { template_argument_list, parenthesized_expression_list };
+
+    std::unordered_set<uint64_t> failed_parses;
+
+    auto memo_key(memoized_rule rule, int at) const
+        -> uint64_t
+    {
+        return (static_cast<uint64_t>(rule) << 32) | static_cast<uint32_t>(at);
+    }
+
+    auto known_to_fail(memoized_rule rule, int at) const
+        -> bool
+    {
+        return failed_parses.contains( memo_key(rule, at) );
+    }
+
+    auto remember_failure(memoized_rule rule, int at)
+        -> void
+    {
+        failed_parses.insert( memo_key(rule, at) );
+    }
+
+    //  Hash-consing table for template-argument lists: the same list
+    //  ('<int, std::string>' etc.) typically recurs many times in one file,
+    //  so each successfully parsed list interns its canonical spelling here
+    //  and all occurrences share the one stored copy - two lists are then
+    //  structurally equal iff their keys' .data() pointers are equal
+    std::unordered_set<std::string> template_args_keys;
+
+    auto intern_template_args(std::string key)
+        -> std::string_view
+    {
+        return *template_args_keys.insert( std::move(key) ).first;
+    }
+
+    //  speculation: a parse transaction for the backtracking alternatives
+    //
+    //  Construction marks the current token position and diagnostic count.
+    //  rollback() rewinds the position and flags the diagnostics recorded
+    //  since the mark as speculative. Destruction without rollback()
+    //  commits - the grammar functions' hard-error paths (error() then
+    //  return null) keep their position and diagnostics as before.
+    //
+    //  Speculative diagnostics are resolved once per section, at the end
+    //  of parse(): if the section parsed cleanly they were garbage from
+    //  grammar alternatives that didn't match and are dropped, and if it
+    //  didn't they are kept, because the message from inside the failed
+    //  alternative ("prefix '&var' address-of is not valid Cpp2...") is
+    //  usually the one that names the actual mistake.
+    //
+    //  The AST nodes a failed speculation allocated need no rewinding: they
+    //  are owned by unique_ptrs the failing grammar function drops on its
+    //  exit path, and arena_allocated's operator delete threads each one
+    //  onto the arena's size-class free lists for the next allocation
+    //
+    class speculation
+    {
+        parser* pars;
+        int     saved_pos;
+        size_t  saved_errors;
+
+    public:
+        speculation(parser& p)
+            : pars{ &p }
+            , saved_pos{ p.pos }
+            , saved_errors{ p.errors.size() }
+        { }
+
+        speculation(speculation const&)            = delete;
+        speculation& operator=(speculation const&) = delete;
+
+        //  The token position at the mark, for the few callers that also
+        //  use it as a value (not just as a place to rewind to)
+        auto mark() const
+            -> int
+        {
+            return saved_pos;
+        }
+
+        auto rollback()
+            -> void
+        {
+            pars->pos = saved_pos;
+            for (auto i = saved_errors; i < pars->errors.size(); ++i) {
+                pars->speculative_error_indexes.push_back(i);
+            }
+        }
+    };
+
+    //  Diagnostic indexes flagged by speculation::rollback, resolved at
+    //  the end of each section's parse - note nested speculations can
+    //  flag the same index twice
+    std::vector<size_t> speculative_error_indexes;
+
+    //  Called once per parse entry point: drop the speculative diagnostics
+    //  if every diagnostic this parse recorded was speculative and the
+    //  parse succeeded, keep everything otherwise
+    auto resolve_speculative_diagnostics(
+        bool   parse_succeeded,
+        size_t errors_at_entry
+    )
+        -> void
+    {
+        if (speculative_error_indexes.empty()) {
+            return;
+        }
+
+        std::sort( speculative_error_indexes.begin(), speculative_error_indexes.end() );
+        speculative_error_indexes.erase(
+            std::unique( speculative_error_indexes.begin(), speculative_error_indexes.end() ),
+            speculative_error_indexes.end()
+        );
+
+        if (
+            parse_succeeded
+            && speculative_error_indexes.size() == errors.size() - errors_at_entry
+            && speculative_error_indexes.front() == errors_at_entry
+            )
+        {
+            errors.erase(
+                errors.begin() + unchecked_narrow<ptrdiff_t>(errors_at_entry),
+                errors.end()
+            );
+        }
+
+        speculative_error_indexes.clear();
+    }
+
     //  Keep track of the function bodies' locations - used to emit comments
     //  in the right pass (decide whether it's a comment that belongs with
     //  the declaration or is part of the definition)
@@ -5940,6 +6811,7 @@ class parser
         function_body_extent( lineno_t f, lineno_t l ): first{f}, last{l} { }
     };
     mutable std::vector<function_body_extent> function_body_extents;
+    mutable std::vector<lineno_t>             function_body_extent_max_last;  // prefix max of .last, built when sorted
     mutable bool                              is_function_body_extents_sorted = false;
     bool                                      is_inside_call_expr = false;
 
@@ -5952,12 +6824,20 @@ public:
             return false;
         }
 
-        //  Ensure we are sorted
+        //  Ensure we are sorted, and build the running maximum of .last
+        //  that lets the backwards scan below stop as soon as no earlier
+        //  extent can still reach the queried line
         if (!is_function_body_extents_sorted) {
             std::sort(
                 function_body_extents.begin(),
                 function_body_extents.end()
             );
+            function_body_extent_max_last.resize( function_body_extents.size() );
+            auto running = lineno_t{};
+            for (auto i = 0; i < std::ssize(function_body_extents); ++i) {
+                running = std::max( running, function_body_extents[i].last );
+                function_body_extent_max_last[i] = running;
+            }
             is_function_body_extents_sorted = true;
         }
 
@@ -5973,23 +6853,24 @@ public:
             --iter;
         }
 
-        //  Now go backwards through the preceding entries until
-        //  one includes pos or we move before pos
-        while (
-            iter->first <= p.lineno
+        //  Now go backwards through the preceding entries until one
+        //  includes pos - extents nest, so the match isn't necessarily
+        //  the nearest .first - or until the prefix maximum of .last
+        //  proves no earlier extent can reach pos, which bounds the walk
+        //  by the nesting depth instead of the number of functions
+        for (
+            auto i = iter - function_body_extents.begin();
+            i >= 0 && function_body_extent_max_last[i] >= p.lineno;
+            --i
             )
         {
             if (
-                iter->first <= p.lineno
-                && p.lineno <= iter->last
+                function_body_extents[i].first <= p.lineno
+                && p.lineno <= function_body_extents[i].last
                 )
             {
                 return true;
             }
-            if (iter == function_body_extents.begin()) {
-                break;
-            }
-            --iter;
         }
         return false;
     }
@@ -6039,6 +6920,9 @@ public:
         //  Set per-parse state for the duration of this call
         tokens           = &tokens_;
         generated_tokens = &generated_tokens_;
+        failed_parses.clear();
+        speculative_error_indexes.clear();
+        auto errors_at_entry = errors.size();
 
         //  Generate parse tree for this section as if a standalone TU
         pos     = 0;
@@ -6051,9 +6935,11 @@ public:
             std::make_move_iterator(tu->declarations.end())
         );
         if (!done()) {
+            resolve_speculative_diagnostics( false, errors_at_entry );
             error("unexpected text at end of Cpp2 code section", true, {}, true);
             return false;
         }
+        resolve_speculative_diagnostics( true, errors_at_entry );
         return true;
     }
 
@@ -6077,6 +6963,9 @@ public:
         //  Set per-parse state for the duration of this call
         tokens           = &tokens_;
         generated_tokens = &generated_tokens_;
+        failed_parses.clear();
+        speculative_error_indexes.clear();  // here any new diagnostic, speculative
+                                            // or not, already rejects the result
 
         try {
             //  Parse one declaration - we succeed if the parse succeeded,
@@ -6161,18 +7050,32 @@ private:
     ) const
         -> void
     {
-        auto m = std::string{msg};
         auto i = done() ? -1 : 0;
         assert (peek(i));
-        if (include_curr_token) {
-            m += std::string(" (at '") + peek(i)->to_string() + "')";
-        }
         if (
             err_pos == source_position{}
         ) {
             err_pos = peek(i)->position();
         }
-        errors.emplace_back( err_pos, m, false, fallback );
+        //  Past the -diagnostic-budget, record only the position - the
+        //  entry still participates in error counting (speculative
+        //  parse rejection depends on the count), but skips the message
+        //  and is reported only as part of a suppressed total
+        if (diagnostic_budget_spent(errors)) {
+            errors.emplace_back( err_pos, std::string_view{}, false, fallback );
+            errors.back().suppressed = true;
+            return;
+        }
+        //  Defer building the "(at 'token')" suffix - the token text outlives
+        //  the error list, so store a view and let print materialize it, which
+        //  keeps throwaway messages (e.g., beaten fallbacks) from concatenating
+        errors.emplace_back(
+            err_pos,
+            std::string_view{msg},
+            include_curr_token ? peek(i)->as_string_view() : std::string_view{},
+            false,
+            fallback
+        );
     }
 
     auto error(
@@ -6247,7 +7150,7 @@ private:
     //G
     auto primary_expression()
         -> std::unique_ptr<primary_expression_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<primary_expression_node>();
 
         if (auto inspect = inspect_expression(true))
@@ -6271,8 +7174,14 @@ private:
             //      || curr().type() == lexeme::LeftBrace
             )
         {
-            //  Remember current position, because we may need to backtrack
-            auto start_pos = pos;
+            //  If we already tried and failed to parse a parenthesized
+            //  expression-list at this '(', don't re-parse it
+            if (known_to_fail(memoized_rule::parenthesized_expression_list, pos)) {
+                return {};
+            }
+
+            //  Mark current position, because we may need to backtrack
+            auto txn = speculation{*this};
 
             const bool inside_initializer = (
                 peek(-1) && peek(-1)->type() == lexeme::Assignment
@@ -6285,13 +7194,15 @@ private:
             auto expr_list = expression_list(open_paren, lexeme::RightParen, inside_initializer);
             if (!expr_list) {
                 //error("unexpected text - ( is not followed by an expression-list");
-                pos = start_pos;    // backtrack
+                txn.rollback();
+                remember_failure(memoized_rule::parenthesized_expression_list, pos);
                 return {};
             }
 
             if (curr().type() != close_paren_type(open_paren->type())) {
                 //error("unexpected text - expression-list is not terminated by " + close_text);
-                pos = start_pos;    // backtrack
+                txn.rollback();
+                remember_failure(memoized_rule::parenthesized_expression_list, pos);
                 return {};
             }
 
@@ -6386,24 +7297,26 @@ private:
     //G
     auto postfix_expression()
         -> std::unique_ptr<postfix_expression_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<postfix_expression_node>();
         n->expr = primary_expression();
         if (!(n->expr)) {
             return {};
         }
 
+        //  The postfix operators plus [ ( . and .. all continue a
+        //  postfix-expression
+        constexpr auto continues_postfix_expression =
+            postfix_operators
+            | lexeme_set{
+                lexeme::LeftBracket,
+                lexeme::LeftParen,
+                lexeme::Dot,
+                lexeme::DotDot
+              };
         while (
             !done()
-            && (
-                is_postfix_operator(curr().type())
-                || curr().type() == lexeme::LeftBracket
-                || curr().type() == lexeme::LeftParen
-                || curr().type() == lexeme::Dot
-                || curr().type() == lexeme::DotDot
-                || curr().type() == lexeme::EllipsisLess
-                || curr().type() == lexeme::EllipsisEqual
-                )
+            && continues_postfix_expression.contains(curr().type())
             )
         {
             //  * and & can't be unary operators if followed by a (, identifier, or literal
@@ -6542,7 +7455,7 @@ private:
     //G
     auto prefix_expression()
         -> std::unique_ptr<prefix_expression_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<prefix_expression_node>();
         for ( ;
             is_prefix_operator(curr());
@@ -6679,7 +7592,7 @@ private:
     //G
     auto multiplicative_expression()
         -> auto
-    {
+    {   RULEINSTR
         return binary_expression<multiplicative_expression_node> (
             [](token const& t){ return t.type() == lexeme::Multiply || t.type() == lexeme::Slash || t.type() == lexeme::Modulo; },
             [this]{ return is_as_expression(); }
@@ -6693,7 +7606,7 @@ private:
     //G
     auto additive_expression()
         -> auto
-    {
+    {   RULEINSTR
         return binary_expression<additive_expression_node> (
             [](token const& t){ return t.type() == lexeme::Plus || t.type() == lexeme::Minus; },
             [this]{ return multiplicative_expression(); }
@@ -6707,7 +7620,7 @@ private:
     //G
     auto shift_expression(bool allow_angle_operators = true)
         -> auto
-    {
+    {   RULEINSTR
         if (allow_angle_operators) {
             return binary_expression<shift_expression_node> (
                 [this](token const& t, token const& next) -> token const* {
@@ -6742,7 +7655,7 @@ private:
     //G
     auto compare_expression(bool allow_angle_operators = true)
         -> auto
-    {
+    {   RULEINSTR
         return binary_expression<compare_expression_node> (
             [](token const& t){ return t.type() == lexeme::Spaceship; },
             [=,this]{ return shift_expression(allow_angle_operators); }
@@ -6758,7 +7671,7 @@ private:
     //G
     auto relational_expression(bool allow_angle_operators = true)
         -> auto
-    {
+    {   RULEINSTR
         if (allow_angle_operators) {
             return binary_expression<relational_expression_node> (
                 [this](token const& t, token const& next) -> token const* {
@@ -6798,7 +7711,7 @@ private:
     //G
     auto equality_expression(bool allow_angle_operators = true, bool allow_equality = true)
         -> auto
-    {
+    {   RULEINSTR
         if (allow_equality) {
             return binary_expression<equality_expression_node> (
                 [](token const& t){ return t.type() == lexeme::EqualComparison || t.type() == lexeme::NotEqualComparison; },
@@ -6819,7 +7732,7 @@ private:
     //G
     auto bit_and_expression(bool allow_angle_operators = true, bool allow_equality = true)
         -> auto
-    {
+    {   RULEINSTR
         return binary_expression<bit_and_expression_node> (
             [](token const& t){ return t.type() == lexeme::Ampersand; },
             [=,this]{ return equality_expression(allow_angle_operators, allow_equality); }
@@ -6832,7 +7745,7 @@ private:
     //G
     auto bit_xor_expression(bool allow_angle_operators = true, bool allow_equality = true)
         -> auto
-    {
+    {   RULEINSTR
         return binary_expression<bit_xor_expression_node> (
             [](token const& t){ return t.type() == lexeme::Caret; },
             [=,this]{ return bit_and_expression(allow_angle_operators, allow_equality); }
@@ -6845,7 +7758,7 @@ private:
     //G
     auto bit_or_expression(bool allow_angle_operators = true, bool allow_equality = true)
         -> auto
-    {
+    {   RULEINSTR
         return binary_expression<bit_or_expression_node> (
             [](token const& t){ return t.type() == lexeme::Pipe; },
             [=,this]{ return bit_xor_expression(allow_angle_operators, allow_equality); }
@@ -6858,7 +7771,7 @@ private:
     //G
     auto logical_and_expression(bool allow_angle_operators = true, bool allow_equality = true)
         -> auto
-    {
+    {   RULEINSTR
         return binary_expression<logical_and_expression_node> (
             [](token const& t){ return t.type() == lexeme::LogicalAnd; },
             [=,this]{ return bit_or_expression(allow_angle_operators, allow_equality); }
@@ -6873,7 +7786,7 @@ private:
     //G
     auto logical_or_expression(bool allow_angle_operators = true, bool allow_equality = true)
         -> auto
-    {
+    {   RULEINSTR
         return binary_expression<logical_or_expression_node> (
             [](token const& t){ return t.type() == lexeme::LogicalOr; },
             [=,this]{ return logical_and_expression(allow_angle_operators, allow_equality); }
@@ -6888,7 +7801,7 @@ private:
         bool allow_angle_operators = true
     )
         -> std::unique_ptr<assignment_expression_node>
-    {
+    {   RULEINSTR
         auto ret = std::unique_ptr<assignment_expression_node>{};
 
         if (allow_angle_operators)
@@ -6942,7 +7855,7 @@ private:
         bool check_arrow           = true
     )
         -> std::unique_ptr<expression_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<expression_node>();
 
         {
@@ -6980,7 +7893,7 @@ private:
         bool         inside_initializer = false
     )
         -> std::unique_ptr<expression_list_node>
-    {
+    {   RULEINSTR
         auto pass = passing_style::in;
         auto n = std::make_unique<expression_list_node>();
         n->open_paren = open_paren;
@@ -7056,11 +7969,11 @@ private:
         bool allow_function_type      = false
     )
         -> std::unique_ptr<type_id_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<type_id_node>();
 
-        //  Remember current position, because we need to look ahead
-        auto start_pos = pos;
+        //  Mark current position, because we need to look ahead
+        auto txn = speculation{*this};
 
         while (
             (curr().type() == lexeme::Keyword && curr() == "const")
@@ -7145,7 +8058,7 @@ private:
         {
             next();
             if (!(n->constraint = type_id())) {
-                pos = start_pos;    // backtrack
+                txn.rollback();
                 return {};
             }
         }
@@ -7172,7 +8085,7 @@ private:
     //G
     auto is_as_expression()
         -> std::unique_ptr<is_as_expression_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<is_as_expression_node>();
         n->expr = prefix_expression();
         if (!(n->expr)) {
@@ -7264,7 +8177,7 @@ private:
     //G
     auto unqualified_id()
         -> std::unique_ptr<unqualified_id_node>
-    {
+    {   RULEINSTR
         //  Handle the identifier
         if (
             curr().type() != lexeme::Identifier
@@ -7289,8 +8202,15 @@ private:
             && curr().position() == one_past_identifier_end_pos
             )
         {
-            //  Remember current position, in case this < is isn't a template argument list
-            auto start_pos = pos;
+            //  If we already tried and failed to parse a template argument
+            //  list at this '<', don't re-parse it - just return the plain
+            //  identifier again
+            if (known_to_fail(memoized_rule::template_argument_list, pos)) {
+                return n;
+            }
+
+            //  Mark current position, in case this < is isn't a template argument list
+            auto txn = speculation{*this};
 
             n->open_angle = curr().position();
             next();
@@ -7353,10 +8273,12 @@ private:
                 //  so back out just that part and return the identifier
                 n->open_angle = source_position{};
                 n->template_args.clear();
-                pos = start_pos;
+                txn.rollback();
+                remember_failure(memoized_rule::template_argument_list, pos);
                 return n;
             }
             n->close_angle = curr().position();
+            n->template_args_key = intern_template_args( n->template_arguments_to_string() );
             next();
         }
 
@@ -7384,7 +8306,7 @@ private:
     //G
     auto qualified_id()
         -> std::unique_ptr<qualified_id_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<qualified_id_node>();
 
         auto term = qualified_id_node::term{nullptr};
@@ -7395,8 +8317,8 @@ private:
             next();
         }
 
-        //  Remember current position, because we need to look ahead to the next ::
-        auto start_pos = pos;
+        //  Mark current position, because we need to look ahead to the next ::
+        auto txn = speculation{*this};
 
         //  If we don't get a first id, or if we didn't have a leading :: and
         //  the next thing isn't :: or ., back out and report unsuccessful
@@ -7406,7 +8328,7 @@ private:
             || (!term.scope_op && curr().type() != lexeme::Scope)
             )
         {
-            pos = start_pos;    // backtrack
+            txn.rollback();
             return {};
         }
 
@@ -7453,7 +8375,7 @@ private:
     //G
     auto id_expression()
         -> std::unique_ptr<id_expression_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<id_expression_node>();
         if (auto id = qualified_id()) {
             n->pos = id->position();
@@ -7481,7 +8403,7 @@ private:
     //G
     auto literal()
         -> std::unique_ptr<literal_node>
-    {
+    {   RULEINSTR
         if (is_literal(curr().type())) {
             auto n = std::make_unique<literal_node>();
             n->pieces.push_back( &curr() );
@@ -7518,14 +8440,14 @@ private:
         bool allow_angle_operators = true
     )
         -> std::unique_ptr<expression_statement_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<expression_statement_node>();
 
         expression_statement_node::current_expression_statements.push_back(n.get());
         auto guard = finally([&]{ expression_statement_node::current_expression_statements.pop_back(); });
 
-        //  Remember current position, in case this isn't a valid expression-statement
-        auto start_pos = pos;
+        //  Mark current position, in case this isn't a valid expression-statement
+        auto txn = speculation{*this};
 
         if (!(n->expr = expression(allow_angle_operators, true))) {
             return {};
@@ -7545,7 +8467,7 @@ private:
                 //  it doesn't destabilize any regression tests
             )
         {
-            pos = start_pos;    // backtrack
+            txn.rollback();
             return {};
         }
         if (
@@ -7566,7 +8488,7 @@ private:
     //G
     auto selection_statement()
         -> std::unique_ptr<selection_statement_node>
-    {
+    {   RULEINSTR
         if (
             curr().type() != lexeme::Keyword
             || curr() != "if"
@@ -7650,7 +8572,7 @@ private:
     //G
     auto return_statement()
         -> std::unique_ptr<return_statement_node>
-    {
+    {   RULEINSTR
         if (
             curr().type() != lexeme::Keyword
             || curr() != "return"
@@ -7701,7 +8623,7 @@ private:
     //G
     auto iteration_statement()
         -> std::unique_ptr<iteration_statement_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<iteration_statement_node>();
 
         //  If the next three tokens are:
@@ -7879,7 +8801,7 @@ private:
     //G
     auto alternative()
         -> std::unique_ptr<alternative_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<alternative_node>();
 
         if (
@@ -7945,7 +8867,7 @@ private:
     //G
     auto inspect_expression(bool is_expression)
         -> std::unique_ptr<inspect_expression_node>
-    {
+    {   RULEINSTR
         if (curr() != "inspect") {
             return {};
         }
@@ -8045,7 +8967,7 @@ private:
     //G
     auto jump_statement()
         -> std::unique_ptr<jump_statement_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<jump_statement_node>();
 
         if (
@@ -8080,7 +9002,7 @@ private:
     //G
     auto using_statement()
         -> std::unique_ptr<using_statement_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<using_statement_node>();
 
         if (curr() != "using") {
@@ -8146,7 +9068,7 @@ private:
         bool                     allow_angle_operators = true
     )
         -> std::unique_ptr<statement_node>
-    {
+    {   RULEINSTR
         if (!done() && curr().type() == lexeme::Semicolon) {
             error("empty statement is not allowed - remove extra semicolon");
             return {};
@@ -8269,7 +9191,7 @@ private:
         bool            allow_single_unbraced_statement = false
     )
         -> std::unique_ptr<compound_statement_node>
-    {
+    {   RULEINSTR
         const bool is_braced = curr().type() == lexeme::LeftBrace;
         if (
             !is_braced
@@ -8353,10 +9275,10 @@ private:
         bool                                   is_statement = false
     )
         -> std::unique_ptr<parameter_declaration_node>
-    {
-        //  Remember current position, because we may need to backtrack if this is just
+    {   RULEINSTR
+        //  Mark current position, because we may need to backtrack if this is just
         //  a parenthesized expression statement, not a statement parameter list
-        auto start_pos = pos;
+        auto txn = speculation{*this};
 
         auto n = std::make_unique<parameter_declaration_node>(my_list);
         n->pass =
@@ -8439,7 +9361,7 @@ private:
         //  Now the main declaration
         //
         if (!(n->declaration = declaration(false, true, is_template, {}, false))) {
-            pos = start_pos;    // backtrack
+            txn.rollback();
             return {};
         }
         n->declaration->is_a_statement_parameter = is_statement;
@@ -8549,12 +9471,12 @@ private:
         bool is_function_typeid = false
     )
         -> std::unique_ptr<parameter_declaration_list_node>
-    {
-        //  Remember current position, because we need to look ahead in
+    {   RULEINSTR
+        //  Mark current position, because we need to look ahead in
         //  the case of seeing whether a local statement starts with a
         //  parameter list, since finding that it doesn't (it's some other
         //  parenthesized expression) is not an error, just backtrack
-        auto start_pos = pos;
+        auto txn = speculation{*this};
 
         auto opener = lexeme::LeftParen;
         auto closer = lexeme::RightParen;
@@ -8608,7 +9530,7 @@ private:
 
             else if (curr().type() != lexeme::Comma) {
                 if (is_statement) {
-                    pos = start_pos;    // backtrack
+                    txn.rollback();
                 }
                 else {
                     error("expected ',' in parameter list", true, {}, true);
@@ -8621,7 +9543,7 @@ private:
 
         if (curr().type() != closer) {
             if (is_statement) {
-                pos = start_pos;    // backtrack
+                txn.rollback();
             }
             else {
                 error("invalid parameter list", true, {}, true);
@@ -8650,7 +9572,7 @@ private:
     //G
     auto contract()
         -> std::unique_ptr<contract_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<contract_node>(curr().position());
         auto guard = capture_groups_stack_guard(this, &n->captures);
 
@@ -8753,7 +9675,7 @@ private:
         bool              is_named = true
         )
         -> std::unique_ptr<function_type_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<function_type_node>( my_decl );
 
         //  Parameters
@@ -8794,9 +9716,9 @@ private:
             && (curr() != "pre" && curr() != "post")
             )
         {
-            auto start_pos = pos;
+            auto txn = speculation{*this};
             auto at_an_expression = expression() != nullptr;
-            pos = start_pos;    // backtrack no matter what, we're just peeking here
+            txn.rollback();     // backtrack no matter what, we're just peeking here
 
             if (at_an_expression) {
                 error("an '=' is now required before every function body, including when the body is an individual expression - for example, change 'f: () expr;' to 'f: () = expr;'");
@@ -8937,6 +9859,40 @@ private:
     //G template-parameters:
     //G     '<' parameter-declaration-seq '>'
     //G
+    //  -interface-only: consume a balanced { } function body without
+    //  parsing it, and put an empty compound statement in its place -
+    //  the signature was already parsed, and for the interface surface
+    //  that's all there is
+    //
+    auto skip_function_body()
+        -> std::unique_ptr<statement_node>
+    {
+        assert (curr().type() == lexeme::LeftBrace);
+        auto body  = std::make_unique<compound_statement_node>( curr().position() );
+        auto depth = 0;
+        while (!done())
+        {
+            if (curr().type() == lexeme::LeftBrace) {
+                ++depth;
+            }
+            else if (
+                curr().type() == lexeme::RightBrace
+                && --depth == 0
+                )
+            {
+                body->close_brace = curr().position();
+                next();
+                auto stmt = std::make_unique<statement_node>();
+                stmt->statement = std::move(body);
+                return stmt;
+            }
+            next();
+        }
+        //  Unbalanced - the lexer's brace matching will have complained
+        return {};
+    }
+
+
     auto unnamed_declaration(
         source_position                      start,
         bool                                 semicolon_required    = true,
@@ -8951,7 +9907,7 @@ private:
         bool                                 semicolon_allowed     = true
     )
         -> std::unique_ptr<declaration_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<declaration_node>( current_declarations.back() );
         n->pos = start;
 
@@ -8986,7 +9942,7 @@ private:
             //  So invent the "type" token
             generated_text.push_back("type");
             generated_tokens->push_back({
-                generated_text.back().c_str(),
+                generated_text.back().data(),
                 std::ssize(generated_text.back()),
                 start,
                 lexeme::Identifier
@@ -9028,7 +9984,7 @@ private:
             //  So invent the "_" token
             generated_text.push_back("_");
             generated_tokens->push_back({
-                generated_text.back().c_str(),
+                generated_text.back().data(),
                 std::ssize(generated_text.back()),
                 start,
                 lexeme::Identifier
@@ -9216,7 +10172,7 @@ private:
                     return {};
                 }
 
-                n->requires_pos = curr().position();
+                n->set_requires_pos(curr().position());
                 next();
                 auto e = logical_or_expression(true, false);
                 if (!e) {
@@ -9336,7 +10292,27 @@ private:
                     }
                 }
 
-                if (!(n->initializer = statement(
+                //  -interface-only: a compound function body contributes
+                //  nothing to the interface surface, so skip its tokens
+                //  unparsed. Expression bodies still parse - a single-
+                //  expression function's return type is inferred from
+                //  its body, so skipping one would change the signature
+                if (
+                    flag_interface_only
+                    && n->is_function()
+                    && curr().type() == lexeme::LeftBrace
+                    )
+                {
+                    if (!(n->initializer = skip_function_body())) {
+                        error(
+                            "ill-formed function body",
+                            true, {}, true
+                        );
+                        return {};
+                    }
+                }
+
+                else if (!(n->initializer = statement(
                     semicolon_required,
                     n->equal_sign,
                     false,
@@ -9379,10 +10355,10 @@ private:
             && !n->initializer->is_compound()
             )
         {
-            auto start_pos = pos;
+            auto txn = speculation{*this};
             auto stmt = statement();
             auto at_a_statement = stmt != nullptr && !stmt->is_declaration();
-            pos = start_pos;    // backtrack no matter what, we're just peeking here
+            txn.rollback();     // backtrack no matter what, we're just peeking here
 
             if (at_a_statement) {
                 error("in this scope, a single-expression function body cannot be immediately followed by a statement - did you forget to put { } braces around a multi-statement function body?", false);
@@ -9511,9 +10487,9 @@ private:
     //
     auto alias()
         -> std::unique_ptr<declaration_node>
-    {
-        //  Remember current position, because we need to look ahead
-        auto start_pos = pos;
+    {   RULEINSTR
+        //  Mark current position, because we need to look ahead
+        auto txn = speculation{*this};
 
         auto n = std::make_unique<declaration_node>( current_declarations.back() );
 
@@ -9526,7 +10502,7 @@ private:
         if (curr().type() == lexeme::Less) {
             auto template_parameters = parameter_declaration_list(false, false, true);
             if (!template_parameters) {
-                pos = start_pos;    // backtrack
+                txn.rollback();
                 return {};
             }
             n->template_parameters = std::move(template_parameters);
@@ -9554,7 +10530,7 @@ private:
         {
             a->type_id = type_id();
             if (!a->type_id) {
-                pos = start_pos;    // backtrack
+                txn.rollback();
                 return {};
             }
         }
@@ -9577,7 +10553,7 @@ private:
                 return {};
             }
 
-            n->requires_pos = curr().position();
+            n->set_requires_pos(curr().position());
             next();
             auto e = logical_or_expression(true, false);
             if (!e) {
@@ -9594,7 +10570,7 @@ private:
         }
         else {
             if (a->type->type() != lexeme::EqualComparison) {
-                pos = start_pos;    // backtrack
+                txn.rollback();
                 return {};
             }
         }
@@ -9709,11 +10685,11 @@ private:
         bool            semicolon_allowed     = true
     )
         -> std::unique_ptr<declaration_node>
-    {
+    {   RULEINSTR
         if (done()) { return {}; }
 
-        //  Remember current position, because we need to look ahead
-        auto start_pos = pos;
+        //  Mark current position, because we need to look ahead
+        auto txn = speculation{*this};
 
         auto n = std::unique_ptr<declaration_node>{};
 
@@ -9846,7 +10822,7 @@ private:
                     return {};
                 }
 
-                n->pos        = start_pos;
+                n->pos        = txn.mark();
                 n->identifier = std::move(id);
                 n->access     = access;
                 return n;
@@ -9854,7 +10830,7 @@ private:
 
             //  Otherwise, this is a normal declaration
             n = unnamed_declaration(
-                start_pos,
+                txn.mark(),
                 semicolon_required,
                 false,
                 true,
@@ -9867,7 +10843,7 @@ private:
                 semicolon_allowed
             );
             if (!n) {
-                pos = start_pos;    // backtrack
+                txn.rollback();
                 return {};
             }
         }
@@ -9906,7 +10882,7 @@ private:
     //
     auto translation_unit()
         -> std::unique_ptr<translation_unit_node>
-    {
+    {   RULEINSTR
         auto n = std::make_unique<translation_unit_node>();
         for (auto d = declaration(); d; d = declaration()) {
             n->declarations.push_back( std::move(d) );
@@ -9996,10 +10972,10 @@ public:
         o << pre(indent) << "is-as-expression\n";
     }
 
-    template<String Name, typename Term>
+    template<string_util::fixed_string Name, typename Term>
     auto start(binary_expression_node<Name, Term> const&, int indent) -> void
     {
-        o << pre(indent) << Name.value << "-expression\n";
+        o << pre(indent) << Name.data() << "-expression\n";
     }
 
     auto start(expression_statement_node const& n, int indent) -> void
@@ -10,109 +10,109 @@
 
 #line 1 "reflect.h2"
 
-#line 17 "reflect.h2"
+#line 1211 "reflect.h2"
 namespace cpp2 {
 
 namespace meta {
 
-#line 29 "reflect.h2"
+#line 1223 "reflect.h2"
 class compiler_services;
 
-#line 189 "reflect.h2"
+#line 1389 "reflect.h2"
 template<typename T> class reflection_base;
 
-#line 222 "reflect.h2"
+#line 1422 "reflect.h2"
 class declaration;
 
-#line 304 "reflect.h2"
+#line 1504 "reflect.h2"
 class function_declaration;
 
-#line 396 "reflect.h2"
+#line 1596 "reflect.h2"
 class object_declaration;
 
-#line 432 "reflect.h2"
+#line 1632 "reflect.h2"
+class value_member_info;
+
+#line 1638 "reflect.h2"
 class type_declaration;
 
-#line 570 "reflect.h2"
+#line 1809 "reflect.h2"
 class alias_declaration;
 
-#line 596 "reflect.h2"
+#line 1835 "reflect.h2"
 class statement;
 
-#line 638 "reflect.h2"
+#line 1877 "reflect.h2"
 class compound_statement;
 
-#line 1108 "reflect.h2"
-class value_member_info;
-
-#line 1648 "reflect.h2"
+#line 2965 "reflect.h2"
 class expression_flags;
 
-#line 1664 "reflect.h2"
+#line 2981 "reflect.h2"
 class regex_token;
 
-#line 1690 "reflect.h2"
+#line 3007 "reflect.h2"
 class regex_token_check;
 
-#line 1709 "reflect.h2"
+#line 3026 "reflect.h2"
 class regex_token_code;
 
-#line 1728 "reflect.h2"
+#line 3045 "reflect.h2"
 class regex_token_empty;
 
-#line 1744 "reflect.h2"
+#line 3061 "reflect.h2"
 class regex_token_list;
 
-#line 1783 "reflect.h2"
+#line 3100 "reflect.h2"
 class parse_context_group_state;
 
-#line 1844 "reflect.h2"
+#line 3161 "reflect.h2"
 class parse_context_branch_reset_state;
 
-#line 1887 "reflect.h2"
+#line 3204 "reflect.h2"
 class parse_context;
 
-#line 2285 "reflect.h2"
+#line 3602 "reflect.h2"
 class generation_function_context;
     
 
-#line 2303 "reflect.h2"
+#line 3620 "reflect.h2"
 class generation_context;
 
-#line 2501 "reflect.h2"
+#line 3818 "reflect.h2"
 class alternative_token;
 
-#line 2516 "reflect.h2"
+#line 3833 "reflect.h2"
 class alternative_token_gen;
 
-#line 2568 "reflect.h2"
+#line 3885 "reflect.h2"
 class any_token;
 
-#line 2586 "reflect.h2"
+#line 3903 "reflect.h2"
 class char_token;
 
-#line 2689 "reflect.h2"
+#line 4006 "reflect.h2"
 class class_token;
 
-#line 2904 "reflect.h2"
+#line 4221 "reflect.h2"
 class group_ref_token;
 
-#line 3035 "reflect.h2"
+#line 4352 "reflect.h2"
 class group_token;
 
-#line 3322 "reflect.h2"
+#line 4639 "reflect.h2"
 class lookahead_token;
 
-#line 3403 "reflect.h2"
+#line 4720 "reflect.h2"
 class range_token;
 
-#line 3551 "reflect.h2"
+#line 4868 "reflect.h2"
 class special_range_token;
 
-#line 3618 "reflect.h2"
+#line 4935 "reflect.h2"
 template<typename Error_out> class regex_generator;
 
-#line 3866 "reflect.h2"
+#line 5505 "reflect.h2"
 }
 
 }
@@ -137,16 +137,1209 @@ template<typename Error_out> class regex_generator;
 #include "cpp2regex.h"
 using namespace cpp2::regex;
 
-#line 17 "reflect.h2"
+#include "cpp2meta.h"
+#if defined(__unix__) || defined(__APPLE__)
+    #define CPP2_USE_METAFUNCTION_PLUGINS
+    #include <dlfcn.h>
+#endif
+
+namespace cpp2::meta {
+
+//-----------------------------------------------------------------------
+//
+//  Metafunction plugins: -metafunction-lib loads a shared library that
+//  exports the cpp2_apply_metafunction entry point described in
+//  cpp2meta.h, so site-local metafunctions run at native speed without
+//  forking the compiler. The plugin sees only the C services table -
+//  all compiler code executes on this side of it, which is what makes
+//  the ABI stable across toolchains and cppfront rebuilds
+//
+//  This section is Cpp1 because the registry must be a mutable
+//  namespace-scope object, and Cpp2 namespace-scope objects lower to
+//  'inline constexpr'
+//
+//-----------------------------------------------------------------------
+//
+using plugin_apply_func = int (*)(char const*, cpp2_meta_services const*);
+
+class metafunction_plugins
+{
+    std::vector<plugin_apply_func> entries;
+    std::set<std::string>          loaded;
+
+public:
+    //  Load 'path' unless it was already loaded - the load-once set
+    //  keeps repeated mentions (and a long -daemon session) from
+    //  reloading the same library
+    //
+    auto load(std::string const& path, std::string& error)
+        -> bool
+    {
+#ifdef CPP2_USE_METAFUNCTION_PLUGINS
+        if (loaded.contains(path)) {
+            return true;
+        }
+        auto handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if (!handle) {
+            auto msg = dlerror();
+            error = msg ? msg : "dlopen failed";
+            return false;
+        }
+        auto entry = reinterpret_cast<plugin_apply_func>(
+            dlsym(handle, "cpp2_apply_metafunction")
+        );
+        if (!entry) {
+            error = path + " does not export cpp2_apply_metafunction";
+            dlclose(handle);
+            return false;
+        }
+        loaded .insert   (path);
+        entries.push_back(entry);
+        return true;
+#else
+        error = "metafunction plugin libraries are not supported on this platform";
+        (void)path;
+        return false;
+#endif
+    }
+
+    //  Offer 'name' to each loaded plugin in load order - returns
+    //  whether one of them applied it
+    //
+    auto apply(std::string const& name, cpp2_meta_services const& services) const
+        -> bool
+    {
+        for (auto entry : entries) {
+            if (entry(name.c_str(), &services) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+//  Loaded once at startup, before any compile threads exist, and
+//  read-only afterwards - so no per-thread copy is needed
+//
+static metafunction_plugins plugin_registry;
+
+//  Wire the C services table to type_declaration - a template so the
+//  callback bodies instantiate below, where type_declaration is a
+//  complete type
+//
+template <typename TypeDecl>
+auto apply_plugin_metafunctions(std::string const& name, TypeDecl& rtype)
+    -> bool
+{
+    auto services = cpp2_meta_services{
+        &rtype,
+        [](void* type, char const* source) -> void {
+            static_cast<TypeDecl*>(type)->add_member(source);
+        },
+        [](void* type, char const* message) -> void {
+            static_cast<TypeDecl*>(type)->error(message);
+        },
+        [](void* type) -> char const* {
+            static thread_local std::string buf;   // thread_local: see -jobs
+            buf = static_cast<TypeDecl*>(type)->name();
+            return buf.c_str();
+        }
+    };
+    return plugin_registry.apply(name, services);
+}
+
+
+//-----------------------------------------------------------------------
+//
+//  dfa_regex: compile a restricted pattern to a constexpr
+//  state-transition table, for @regex<dfa> - see regex_gen
+//
+//  The table-driven matcher runs in O(n) with no backtracking, which
+//  is the point of opting in; the price is a restricted dialect (no
+//  captures, backreferences, lookaround, modifiers, or counted
+//  repetition) and leftmost-longest rather than leftmost-first match
+//  semantics. This is Cpp1 rather than Cpp2 like the backtracking
+//  generator below, because it is one self-contained index-crunching
+//  algorithm with no reflection API surface: syntax tree -> Glushkov
+//  position automaton -> subset construction -> table
+//
+//-----------------------------------------------------------------------
+//
+//  Pattern-scanning helpers shared by the table-driven regex builders
+//  below (dfa_regex and onepass_regex)
+//
+namespace regex_util {
+
+//  The \d \w \s shorthand classes and their \D \W \S complements
+//
+inline auto shorthand_class(char c, std::array<bool, 256>& cls)
+    -> bool
+{
+    auto base = std::array<bool, 256>{};
+    switch (std::tolower(static_cast<unsigned char>(c))) {
+    break;case 'd':
+        for (auto x = '0'; x <= '9'; ++x) { base[static_cast<unsigned char>(x)] = true; }
+    break;case 'w':
+        for (auto x = '0'; x <= '9'; ++x) { base[static_cast<unsigned char>(x)] = true; }
+        for (auto x = 'a'; x <= 'z'; ++x) { base[static_cast<unsigned char>(x)] = true; }
+        for (auto x = 'A'; x <= 'Z'; ++x) { base[static_cast<unsigned char>(x)] = true; }
+        base[static_cast<unsigned char>('_')] = true;
+    break;case 's':
+        for (auto x : {' ', '\t', '\n', '\r', '\f', '\v'}) { base[static_cast<unsigned char>(x)] = true; }
+    break;default:
+        return false;
+    }
+    if (std::isupper(static_cast<unsigned char>(c))) {
+        for (auto x = 0; x < 256; ++x) { base[x] = !base[x]; }
+    }
+    for (auto x = 0; x < 256; ++x) { cls[x] = cls[x] || base[x]; }
+    return true;
+}
+
+//  Literal escapes: control-character names, and any escaped
+//  punctuation stands for itself
+//
+inline auto escape_char(char c, char& out)
+    -> bool
+{
+    switch (c) {
+    break;case 'n': out = '\n';
+    break;case 't': out = '\t';
+    break;case 'r': out = '\r';
+    break;case 'f': out = '\f';
+    break;case 'a': out = '\a';
+    break;case 'e': out = '\x1B';
+    break;default:
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            return false;
+        }
+        out = c;
+    }
+    return true;
+}
+
+//  Parse a '[...]' character class - on entry 'i' points one past the
+//  '[', on success it is left one past the ']' and the accepted
+//  characters are set in 'cls'. Returns an error message, or "" on
+//  success
+//
+inline auto parse_class(std::string const& pat, size_t& i, std::array<bool, 256>& cls)
+    -> std::string
+{
+    auto negate = false;
+    if (i < pat.size() && pat[i] == '^') {
+        negate = true;
+        ++i;
+    }
+    auto first_item = true;
+    while (i < pat.size() && (pat[i] != ']' || first_item)) {
+        first_item = false;
+        auto lo = '\0';
+        if (pat[i] == '\\') {
+            ++i;
+            if (i >= pat.size()) {
+                return "pattern ends in a trailing backslash";
+            }
+            auto c = pat[i++];
+            if (shorthand_class(c, cls)) {
+                continue;
+            }
+            if (!escape_char(c, lo)) {
+                return "escape '\\" + std::string(1, c) + "' is not supported in a character class here";
+            }
+        }
+        else {
+            lo = pat[i++];
+        }
+        auto hi = lo;
+        if (
+            i < pat.size()
+            && pat[i] == '-'
+            && i + 1 < pat.size()
+            && pat[i + 1] != ']'
+            )
+        {
+            ++i;
+            if (pat[i] == '\\') {
+                ++i;
+                if (i >= pat.size() || !escape_char(pat[i], hi)) {
+                    return "unsupported escape in a character-class range";
+                }
+                ++i;
+            }
+            else {
+                hi = pat[i++];
+            }
+            if (static_cast<unsigned char>(hi) < static_cast<unsigned char>(lo)) {
+                return "invalid character-class range";
+            }
+        }
+        for (auto x = static_cast<int>(static_cast<unsigned char>(lo)); x <= static_cast<int>(static_cast<unsigned char>(hi)); ++x) {
+            cls[x] = true;
+        }
+    }
+    if (i >= pat.size()) {
+        return "unterminated character class";
+    }
+    ++i;
+    if (negate) {
+        for (auto x = 0; x < 256; ++x) { cls[x] = !cls[x]; }
+    }
+    return "";
+}
+
+//  Escape every byte as exactly three octal digits, which keeps a
+//  string literal carrying arbitrary bytes unambiguous
+//
+inline auto escape_bytes(std::string const& bytes)
+    -> std::string
+{
+    auto ret = std::string{"\""};
+    for (auto b : bytes) {
+        auto v = static_cast<int>(static_cast<unsigned char>(b));
+        ret += '\\';
+        ret += static_cast<char>('0' +  v / 64);
+        ret += static_cast<char>('0' + (v / 8) % 8);
+        ret += static_cast<char>('0' +  v % 8);
+    }
+    return ret + "\"";
+}
+
+}
+
+namespace dfa_regex {
+
+struct node {
+    enum kind_t { leaf, cat, alt, star, plus, opt, empty };
+    kind_t kind;
+    int    lhs = -1;
+    int    rhs = -1;
+    int    pos = -1;                    //  leaf: position id
+    std::array<bool, 256> cls = {};     //  leaf: character set
+};
+
+//  The subset-construction result: states are position sets, edges are
+//  per-character-class successor indices with -1 for no transition
+//
+struct automaton {
+    int                           nclasses  = 0;
+    std::array<int, 256>          charclass = {};
+    std::vector<std::vector<int>> states;
+    std::vector<std::vector<int>> edges;
+};
+
+class builder
+{
+    std::string       pat;
+    size_t            i = 0;
+    std::vector<node> nodes;
+    std::vector<int>  leaves;           //  node index per position id
+    std::vector<char> endmarks;         //  per position: is it an end marker
+    std::string       err;
+
+    //  Syntax tree construction
+    //
+    auto fail(std::string const& msg)
+        -> int
+    {
+        if (err.empty()) {
+            err = msg;
+        }
+        return -1;
+    }
+
+    auto make(node::kind_t kind, int lhs = -1, int rhs = -1)
+        -> int
+    {
+        nodes.push_back({ kind, lhs, rhs });
+        return static_cast<int>(nodes.size()) - 1;
+    }
+
+    auto make_leaf(std::array<bool, 256> const& cls)
+        -> int
+    {
+        auto id = make(node::leaf);
+        nodes[id].cls = cls;
+        nodes[id].pos = static_cast<int>(leaves.size());
+        leaves.push_back(id);
+        endmarks.push_back(false);
+        return id;
+    }
+
+    //  An end-marker position: consumes nothing, and the states that
+    //  contain it are exactly the accepting ones
+    //
+    auto make_endmark()
+        -> int
+    {
+        auto id = make_leaf({});
+        endmarks.back() = true;
+        return id;
+    }
+
+    auto more() const -> bool { return i < pat.size(); }
+    auto peek() const -> char { return more() ? pat[i] : '\0'; }
+
+    //  Recursive-descent parse of the restricted dialect
+    //
+    auto parse_class()
+        -> int
+    {
+        auto cls = std::array<bool, 256>{};
+        if (auto e = regex_util::parse_class(pat, i, cls); !e.empty()) {
+            return fail(e);
+        }
+        return make_leaf(cls);
+    }
+
+    auto parse_atom()
+        -> int
+    {
+        auto c = pat[i];
+        if (c == '(') {
+            ++i;
+            if (peek() != '?' || i + 1 >= pat.size() || pat[i + 1] != ':') {
+                return fail("capture groups are not supported in this regex mode - use (?: )");
+            }
+            i += 2;
+            auto e = parse_alt();
+            if (e < 0) {
+                return e;
+            }
+            if (peek() != ')') {
+                return fail("unterminated group");
+            }
+            ++i;
+            return e;
+        }
+        if (c == '[') {
+            ++i;
+            return parse_class();
+        }
+        if (c == '.') {
+            ++i;
+            auto cls = std::array<bool, 256>{};
+            for (auto x = 0; x < 256; ++x) { cls[x] = x != '\n'; }
+            return make_leaf(cls);
+        }
+        if (c == '\\') {
+            ++i;
+            if (!more()) {
+                return fail("pattern ends in a trailing backslash");
+            }
+            auto e   = pat[i++];
+            auto cls = std::array<bool, 256>{};
+            if (regex_util::shorthand_class(e, cls)) {
+                return make_leaf(cls);
+            }
+            auto lit = '\0';
+            if (regex_util::escape_char(e, lit)) {
+                cls[static_cast<unsigned char>(lit)] = true;
+                return make_leaf(cls);
+            }
+            return fail("escape '\\" + std::string(1, e) + "' is not supported in this regex mode");
+        }
+        if (c == '^' || c == '$') {
+            return fail("'^' and '$' are only supported at the pattern boundaries in this regex mode");
+        }
+        ++i;
+        auto cls = std::array<bool, 256>{};
+        cls[static_cast<unsigned char>(c)] = true;
+        return make_leaf(cls);
+    }
+
+    auto parse_rep()
+        -> int
+    {
+        auto e = parse_atom();
+        while (e >= 0 && more()) {
+            auto c = pat[i];
+            if      (c == '*') { ++i; e = make(node::star, e); }
+            else if (c == '+') { ++i; e = make(node::plus, e); }
+            else if (c == '?') { ++i; e = make(node::opt,  e); }
+            else if (c == '{') { return fail("counted repetition '{ }' is not supported in this regex mode"); }
+            else               { break; }
+        }
+        return e;
+    }
+
+    auto parse_cat()
+        -> int
+    {
+        if (!more() || pat[i] == '|' || pat[i] == ')') {
+            return make(node::empty);
+        }
+        auto e = parse_rep();
+        while (
+            e >= 0
+            && more()
+            && pat[i] != '|'
+            && pat[i] != ')'
+            )
+        {
+            auto r = parse_rep();
+            if (r < 0) {
+                return r;
+            }
+            e = make(node::cat, e, r);
+        }
+        return e;
+    }
+
+    auto parse_alt()
+        -> int
+    {
+        auto e = parse_cat();
+        while (e >= 0 && more() && pat[i] == '|') {
+            ++i;
+            auto r = parse_cat();
+            if (r < 0) {
+                return r;
+            }
+            e = make(node::alt, e, r);
+        }
+        return e;
+    }
+
+    //  Glushkov position sets: nullable/first/last per node, follow
+    //  per position
+    //
+    std::vector<char>             nullable;
+    std::vector<std::vector<int>> first;
+    std::vector<std::vector<int>> last;
+    std::vector<std::vector<int>> follow;
+
+    static auto merge(std::vector<int> const& a, std::vector<int> const& b)
+        -> std::vector<int>
+    {
+        auto ret = std::vector<int>{};
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ret));
+        return ret;
+    }
+
+    auto add_follow(std::vector<int> const& from, std::vector<int> const& to)
+        -> void
+    {
+        for (auto p : from) {
+            follow[p] = merge(follow[p], to);
+        }
+    }
+
+    auto analyze(int n)
+        -> void
+    {
+        auto lhs = nodes[n].lhs;
+        auto rhs = nodes[n].rhs;
+        if (lhs >= 0) { analyze(lhs); }
+        if (rhs >= 0) { analyze(rhs); }
+        switch (nodes[n].kind) {
+        break;case node::leaf:
+            nullable[n] = false;
+            first[n] = last[n] = { nodes[n].pos };
+        break;case node::empty:
+            nullable[n] = true;
+        break;case node::cat:
+            nullable[n] = nullable[lhs] && nullable[rhs];
+            first[n] = nullable[lhs] ? merge(first[lhs], first[rhs]) : first[lhs];
+            last [n] = nullable[rhs] ? merge(last [lhs], last [rhs]) : last [rhs];
+            add_follow(last[lhs], first[rhs]);
+        break;case node::alt:
+            nullable[n] = nullable[lhs] || nullable[rhs];
+            first[n] = merge(first[lhs], first[rhs]);
+            last [n] = merge(last [lhs], last [rhs]);
+        break;default:    //  star / plus / opt
+            nullable[n] = nodes[n].kind != node::plus || nullable[lhs];
+            first[n] = first[lhs];
+            last [n] = last [lhs];
+            if (nodes[n].kind != node::opt) {
+                add_follow(last[lhs], first[lhs]);
+            }
+        }
+    }
+
+    //  Parse one pattern, with its boundary anchors stripped into the
+    //  two flags, into the shared node arena - returns its root or -1
+    //
+    auto parse_pattern(
+        std::string_view pattern,
+        bool&            anchored_start,
+        bool&            anchored_end
+        )
+        -> int
+    {
+        pat = std::string{pattern};
+        i   = 0;
+
+        if (
+            !pat.empty()
+            && (pat.front() == '\'' || pat.front() == '/')
+            && pat.rfind(pat.front()) > 0
+            )
+        {
+            return fail("modifiers are not supported in this regex mode");
+        }
+
+        if (!pat.empty() && pat.front() == '^') {
+            anchored_start = true;
+            pat.erase(0, 1);
+        }
+        if (!pat.empty() && pat.back() == '$') {
+            auto backslashes = 0;
+            while (
+                backslashes + 1 < std::ssize(pat)
+                && pat[pat.size() - 2 - backslashes] == '\\'
+                )
+            {
+                ++backslashes;
+            }
+            if (backslashes % 2 == 0) {
+                anchored_end = true;
+                pat.pop_back();
+            }
+        }
+
+        auto root = parse_alt();
+        if (root >= 0 && more()) {
+            root = fail("unbalanced ')'");
+        }
+        return root;
+    }
+
+    //  The shared back end: Glushkov analysis over the node arena,
+    //  character-class partition - characters no leaf distinguishes
+    //  share a column - and subset construction
+    //
+    auto build_automaton(int root, automaton& a)
+        -> bool
+    {
+        nullable.assign(nodes.size(), false);
+        first   .assign(nodes.size(), {});
+        last    .assign(nodes.size(), {});
+        follow  .assign(leaves.size(), {});
+        analyze(root);
+
+        auto npos = static_cast<int>(leaves.size());
+        {
+            auto keys = std::map<std::vector<bool>, int>{};
+            for (auto c = 0; c < 256; ++c) {
+                auto key = std::vector<bool>{};
+                for (auto p = 0; p < npos; ++p) {
+                    if (!endmarks[p]) {
+                        key.push_back(nodes[leaves[p]].cls[c]);
+                    }
+                }
+                a.charclass[c] = keys.try_emplace(key, static_cast<int>(keys.size())).first->second;
+            }
+            a.nclasses = static_cast<int>(keys.size());
+        }
+        auto representative = std::vector<int>(a.nclasses, 0);
+        for (auto c = 255; c >= 0; --c) {
+            representative[a.charclass[c]] = c;
+        }
+
+        auto ids = std::map<std::vector<int>, int>{};
+
+        auto intern = [&](std::vector<int> const& s) -> int {
+            auto [iter, added] = ids.try_emplace(s, static_cast<int>(a.states.size()));
+            if (added) {
+                a.states.push_back(s);
+            }
+            return iter->second;
+        };
+
+        intern(first[root]);
+
+        for (auto si = 0; si < std::ssize(a.states); ++si) {
+            if (std::ssize(a.states) * a.nclasses > 60'000) {
+                fail("the pattern compiles to too large a state table");
+                return false;
+            }
+            a.edges.emplace_back(a.nclasses, -1);
+            for (auto cc = 0; cc < a.nclasses; ++cc) {
+                auto c      = representative[cc];
+                auto target = std::vector<int>{};
+                for (auto p : a.states[si]) {
+                    if (!endmarks[p] && nodes[leaves[p]].cls[c]) {
+                        target = merge(target, follow[p]);
+                    }
+                }
+                if (!target.empty()) {
+                    a.edges[si][cc] = intern(target);
+                }
+            }
+        }
+        return true;
+    }
+
+    //  Serialize the class map and transition table - see the matcher
+    //  types in cpp2regex.h2 for the byte encoding
+    //
+    static auto serialize_tables(
+        automaton const& a,
+        std::string&     classes_bytes,
+        std::string&     edge_bytes
+        )
+        -> void
+    {
+        for (auto c = 0; c < 256; ++c) {
+            classes_bytes += static_cast<char>(a.charclass[c]);
+        }
+        for (auto si = 0; si < std::ssize(a.states); ++si) {
+            for (auto cc = 0; cc < a.nclasses; ++cc) {
+                auto v = a.edges[si][cc] + 1;
+                edge_bytes += static_cast<char>(v % 256);
+                edge_bytes += static_cast<char>(v / 256);
+            }
+        }
+    }
+
+public:
+    auto error() const
+        -> std::string const&
+    {
+        return err;
+    }
+
+    //  Compile 'pattern' and return the matcher type body as Cpp2
+    //  source text, or "" with error() set
+    //
+    auto compile(std::string_view pattern)
+        -> std::string
+    {
+        auto anchored_start = false;
+        auto anchored_end   = false;
+        auto root = parse_pattern(pattern, anchored_start, anchored_end);
+        if (root < 0) {
+            return {};
+        }
+
+        //  Augment with an end marker, so the accepting states are
+        //  exactly the ones that contain its position
+        auto endmark = make_endmark();
+        root = make(node::cat, root, endmark);
+        auto endpos = nodes[endmark].pos;
+
+        auto a = automaton{};
+        if (!build_automaton(root, a)) {
+            return {};
+        }
+
+        auto nstates       = static_cast<int>(a.states.size());
+        auto classes_bytes = std::string{};
+        auto edge_bytes    = std::string{};
+        serialize_tables(a, classes_bytes, edge_bytes);
+        auto accept_bytes = std::string{};
+        for (auto const& s : a.states) {
+            accept_bytes += std::find(s.begin(), s.end(), endpos) != s.end() ? '1' : '0';
+        }
+
+        return "cpp2::regex::dfa_table_matcher<"
+             + std::to_string(nstates) + ", "
+             + std::to_string(a.nclasses) + ", "
+             + regex_util::escape_bytes(std::string{pattern}) + ", "
+             + regex_util::escape_bytes(classes_bytes) + ", "
+             + regex_util::escape_bytes(edge_bytes) + ", "
+             + regex_util::escape_bytes(accept_bytes) + ", "
+             + (anchored_start ? "true" : "false") + ", "
+             + (anchored_end   ? "true" : "false")
+             + ">";
+    }
+
+    //  Compile a whole pattern set into one combined automaton that
+    //  reports, in a single left-to-right scan, which patterns have a
+    //  match in the subject - for @regex_set. Each pattern gets its own
+    //  end marker so accepting states know which patterns they accept;
+    //  unanchored patterns get a leading any-character loop so matches
+    //  starting anywhere surface in the same scan
+    //
+    auto compile_set(std::vector<std::string> const& patterns)
+        -> std::string
+    {
+        auto endpos_of    = std::vector<int>{};
+        auto end_anchored = std::vector<char>{};
+        auto root         = -1;
+
+        for (auto const& p : patterns) {
+            auto anchored_start = false;
+            auto anchored_end   = false;
+            auto r = parse_pattern(p, anchored_start, anchored_end);
+            if (r < 0) {
+                err = "pattern '" + p + "': " + err;
+                return {};
+            }
+            if (!anchored_start) {
+                auto any = std::array<bool, 256>{};
+                for (auto c = 0; c < 256; ++c) { any[c] = true; }
+                r = make(node::cat, make(node::star, make_leaf(any)), r);
+            }
+            auto endmark = make_endmark();
+            endpos_of   .push_back(nodes[endmark].pos);
+            end_anchored.push_back(anchored_end);
+            r    = make(node::cat, r, endmark);
+            root = root < 0 ? r : make(node::alt, root, r);
+        }
+
+        auto a = automaton{};
+        if (!build_automaton(root, a)) {
+            return {};
+        }
+
+        //  Per-state accept masks over the pattern indices, split into
+        //  matches that count anywhere and matches that additionally
+        //  need end-of-subject
+        //
+        auto nset             = static_cast<int>(patterns.size());
+        auto nbytes           = (nset + 7) / 8;
+        auto accept_any_bytes = std::string{};
+        auto accept_end_bytes = std::string{};
+        for (auto const& s : a.states) {
+            auto any = std::string(nbytes, '\0');
+            auto end = std::string(nbytes, '\0');
+            for (auto p : s) {
+                for (auto k = 0; k < nset; ++k) {
+                    if (endpos_of[k] == p) {
+                        auto& m = end_anchored[k] ? end : any;
+                        m[k / 8] = static_cast<char>(m[k / 8] | (1 << (k % 8)));
+                    }
+                }
+            }
+            accept_any_bytes += any;
+            accept_end_bytes += end;
+        }
+
+        auto classes_bytes = std::string{};
+        auto edge_bytes    = std::string{};
+        serialize_tables(a, classes_bytes, edge_bytes);
+
+        return "cpp2::regex::regex_set_table<"
+             + std::to_string(nset) + ", "
+             + std::to_string(static_cast<int>(a.states.size())) + ", "
+             + std::to_string(a.nclasses) + ", "
+             + regex_util::escape_bytes(classes_bytes) + ", "
+             + regex_util::escape_bytes(edge_bytes) + ", "
+             + regex_util::escape_bytes(accept_any_bytes) + ", "
+             + regex_util::escape_bytes(accept_end_bytes)
+             + ">";
+    }
+};
+
+}
+
+
+//-----------------------------------------------------------------------
+//
+//  onepass_regex: compile a fully anchored unambiguous pattern to a
+//  straight-line matcher, for @regex<onepass> - see regex_gen
+//
+//  A pattern qualifies when matching never has an alternative to
+//  explore: it is anchored at both ends, contains no alternation, and
+//  at every variable repetition the repeated character set is disjoint
+//  from everything that can follow it, so how far to scan is decided by
+//  the next input byte alone. For such patterns - common for record
+//  validators like '^\d+,\d+,[A-Z]{3}$' - the generated matcher is a
+//  fixed sequence of class-scan loops with no matcher objects and no
+//  backtracking state. Unlike dfa mode this keeps capture groups:
+//  without alternatives every group boundary lands at one known spot
+//  in the scan, so captures are plain stores at fixed points.
+//
+//-----------------------------------------------------------------------
+//
+namespace onepass_regex {
+
+struct op {
+    enum kind_t { atom, group_start, group_end };
+    kind_t                kind;
+    std::array<bool, 256> cls   = {};   //  atom: character set
+    long long             min   = 1;    //  atom: repetition bounds,
+    long long             max   = 1;    //  with -1 for unbounded
+    int                   group = 0;    //  group_start/end: group index
+    std::string           text  = {};   //  atom: source text, for errors
+};
+
+class builder
+{
+    std::string                pat;
+    size_t                     i = 0;
+    std::vector<op>            ops;
+    std::map<std::string, int> named_groups;
+    int                        ngroups = 1;     //  group 0 is the whole match
+    std::string                err;
+
+    auto fail(std::string const& msg)
+        -> bool
+    {
+        if (err.empty()) {
+            err = msg;
+        }
+        return false;
+    }
+
+    auto more() const -> bool { return i < pat.size(); }
+    auto peek() const -> char { return more() ? pat[i] : '\0'; }
+
+    //  Parse one atom's character set: a literal, an escape, a '[...]'
+    //  class, or '.'
+    //
+    auto parse_atom_class(std::array<bool, 256>& cls)
+        -> bool
+    {
+        auto c = pat[i];
+        if (c == '[') {
+            ++i;
+            if (auto e = regex_util::parse_class(pat, i, cls); !e.empty()) {
+                return fail(e);
+            }
+            return true;
+        }
+        if (c == '.') {
+            ++i;
+            for (auto x = 0; x < 256; ++x) { cls[x] = x != '\n'; }
+            return true;
+        }
+        if (c == '\\') {
+            ++i;
+            if (!more()) {
+                return fail("pattern ends in a trailing backslash");
+            }
+            auto e = pat[i++];
+            if (regex_util::shorthand_class(e, cls)) {
+                return true;
+            }
+            if (std::isdigit(static_cast<unsigned char>(e))) {
+                return fail("backreferences are not supported in onepass mode");
+            }
+            auto lit = '\0';
+            if (regex_util::escape_char(e, lit)) {
+                cls[static_cast<unsigned char>(lit)] = true;
+                return true;
+            }
+            return fail("escape '\\" + std::string(1, e) + "' is not supported in onepass mode");
+        }
+        ++i;
+        cls[static_cast<unsigned char>(c)] = true;
+        return true;
+    }
+
+    //  Parse the quantifier after an atom, if any, into [min, max]
+    //
+    auto parse_quantifier(op& o)
+        -> bool
+    {
+        auto quantified = true;
+        switch (peek()) {
+        break;case '*': { ++i; o.min = 0; o.max = -1; }
+        break;case '+': { ++i; o.min = 1; o.max = -1; }
+        break;case '?': { ++i; o.min = 0; o.max =  1; }
+        break;case '{': {
+            ++i;
+            auto number = [&]() -> long long {
+                auto v = static_cast<long long>(-1);
+                while (more() && std::isdigit(static_cast<unsigned char>(pat[i])) && v < 1'000'000'000) {
+                    v = std::max(v, static_cast<long long>(0)) * 10 + (pat[i++] - '0');
+                }
+                return v;
+            };
+            auto lo = number();
+            if (lo < 0) {
+                return fail("counted repetition '{ }' needs a count");
+            }
+            o.min = o.max = lo;
+            if (peek() == ',') {
+                ++i;
+                o.max = number();    //  '{n,}' parses as unbounded -1
+                if (o.max >= 0 && o.max < o.min) {
+                    return fail("invalid counted-repetition range");
+                }
+            }
+            if (peek() != '}') {
+                return fail("unterminated counted repetition '{ }'");
+            }
+            ++i;
+        }
+        break;default: {
+            quantified = false;
+        }
+        }
+        if (quantified && peek() == '?') {
+            return fail("lazy quantifiers are redundant in onepass mode - matching is already deterministic");
+        }
+        return true;
+    }
+
+    //  Parse the anchor-stripped pattern into the flat op list
+    //
+    auto parse()
+        -> bool
+    {
+        auto open = std::vector<int>{};
+        while (more()) {
+            auto c = pat[i];
+            if (c == '(') {
+                ++i;
+                auto g = -1;
+                if (peek() == '?') {
+                    if (i + 1 < pat.size() && pat[i + 1] == ':') {
+                        i += 2;
+                    }
+                    else if (i + 1 < pat.size() && pat[i + 1] == '<') {
+                        i += 2;
+                        auto name = std::string{};
+                        while (more() && pat[i] != '>') {
+                            name += pat[i++];
+                        }
+                        if (!more()) {
+                            return fail("unterminated group name");
+                        }
+                        ++i;
+                        g = ngroups++;
+                        named_groups[name] = g;
+                    }
+                    else {
+                        return fail("'(?' groups other than '(?:' and '(?<name>' are not supported in onepass mode");
+                    }
+                }
+                else {
+                    g = ngroups++;
+                }
+                if (g >= 0) {
+                    ops.push_back({ op::group_start, {}, 0, 0, g, {} });
+                }
+                open.push_back(g);
+            }
+            else if (c == ')') {
+                if (open.empty()) {
+                    return fail("unbalanced ')'");
+                }
+                ++i;
+                auto g = open.back();
+                open.pop_back();
+                if (g >= 0) {
+                    ops.push_back({ op::group_end, {}, 0, 0, g, {} });
+                }
+                if (peek() == '*' || peek() == '+' || peek() == '?' || peek() == '{') {
+                    return fail("a quantified group is not one-pass - capture writes must land at fixed points");
+                }
+            }
+            else if (c == '|') {
+                return fail("alternation is not supported in onepass mode");
+            }
+            else if (c == '^' || c == '$') {
+                return fail("'^' and '$' are only supported at the pattern boundaries in onepass mode");
+            }
+            else {
+                auto start = i;
+                auto o     = op{ op::atom };
+                if (
+                    !parse_atom_class(o.cls)
+                    || !parse_quantifier(o)
+                    )
+                {
+                    return false;
+                }
+                o.text = pat.substr(start, i - start);
+                ops.push_back(o);
+            }
+        }
+        if (!open.empty()) {
+            return fail("unterminated group");
+        }
+        return true;
+    }
+
+    //  The one-pass check: every variable repetition must be disjoint
+    //  from everything that can follow it, up to and including the
+    //  first mandatory atom
+    //
+    auto check_one_pass()
+        -> bool
+    {
+        for (auto a = 0u; a < ops.size(); ++a) {
+            if (
+                ops[a].kind != op::atom
+                || ops[a].min == ops[a].max
+                )
+            {
+                continue;
+            }
+            for (auto b = a + 1; b < ops.size(); ++b) {
+                if (ops[b].kind != op::atom) {
+                    continue;
+                }
+                for (auto c = 0; c < 256; ++c) {
+                    if (ops[a].cls[c] && ops[b].cls[c]) {
+                        return fail(
+                            "pattern is not one-pass: '" + ops[a].text
+                            + "' and the following '" + ops[b].text
+                            + "' can both match the same character"
+                        );
+                    }
+                }
+                if (ops[b].min > 0) {
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+public:
+    auto error() const
+        -> std::string const&
+    {
+        return err;
+    }
+
+    //  Compile 'pattern' and return the matcher type body as Cpp2
+    //  source text, or "" with error() set
+    //
+    auto compile(std::string_view pattern)
+        -> std::string
+    {
+        pat = std::string{pattern};
+
+        if (
+            !pat.empty()
+            && (pat.front() == '\'' || pat.front() == '/')
+            && pat.rfind(pat.front()) > 0
+            )
+        {
+            fail("modifiers are not supported in onepass mode");
+            return {};
+        }
+
+        //  One-pass execution needs both ends pinned - the whole point
+        //  is that there is never a second start offset to try
+        auto anchored_end = false;
+        if (pat.size() >= 2 && pat.back() == '$') {
+            auto backslashes = 0;
+            while (
+                backslashes + 1 < std::ssize(pat)
+                && pat[pat.size() - 2 - backslashes] == '\\'
+                )
+            {
+                ++backslashes;
+            }
+            anchored_end = backslashes % 2 == 0;
+        }
+        if (
+            pat.size() < 2
+            || pat.front() != '^'
+            || !anchored_end
+            )
+        {
+            fail("onepass mode requires a pattern anchored at both ends - write '^...$'");
+            return {};
+        }
+        pat = pat.substr(1, pat.size() - 2);
+
+        if (
+            !parse()
+            || !check_one_pass()
+            )
+        {
+            return {};
+        }
+
+        //  Emit the matcher type body: one class-test alias per
+        //  distinct character set, and a straight-line entry function
+        //
+        auto aliases = std::map<std::string, std::string>{};
+        auto decls   = std::string{};
+        auto alias_of = [&](std::array<bool, 256> const& cls) -> std::string {
+            auto table = std::string{};
+            for (auto c = 0; c < 256; ++c) {
+                table += cls[c] ? '1' : '0';
+            }
+            auto [iter, added] = aliases.try_emplace(table, "cls_" + std::to_string(aliases.size()));
+            if (added) {
+                decls += "  " + iter->second + ": type == cpp2::regex::onepass_class<\"" + table + "\">;\n";
+            }
+            return iter->second;
+        };
+
+        auto no_match = std::string{"return cpp2::regex::match_return<Iter>(false, cur);"};
+        auto body     = std::string{};
+        auto counters = 0;
+        for (auto const& o : ops) {
+            if (o.kind == op::group_start) {
+                body += "    ctx..set_group_start(" + std::to_string(o.group) + ", pos);\n";
+                continue;
+            }
+            if (o.kind == op::group_end) {
+                body += "    ctx..set_group_end(" + std::to_string(o.group) + ", pos);\n";
+                continue;
+            }
+            auto test = alias_of(o.cls) + "::includes(pos*)";
+            if (o.min == 1 && o.max == 1) {
+                body += "    if pos == ctx.end || !" + test + " { " + no_match + " }\n";
+                body += "    pos++;\n";
+            }
+            else if (o.min == 0 && o.max == -1) {
+                body += "    while pos != ctx.end && " + test + " { pos++; }\n";
+            }
+            else {
+                auto n = "n_" + std::to_string(counters++);
+                body += "    " + n + " := 0;\n";
+                body += "    while pos != ctx.end && " + (
+                    o.max >= 0
+                    ? n + " < " + std::to_string(o.max) + " && "
+                    : std::string{}
+                    ) + test + " { pos++; " + n + "++; }\n";
+                if (o.min > 0) {
+                    body += "    if " + n + " < " + std::to_string(o.min) + " { " + no_match + " }\n";
+                }
+            }
+        }
+
+        auto ret = std::string{};
+        ret += "{\n";
+        ret += " wrap: <Iter, CharT> type = {\n";
+        ret += "  context: type == cpp2::regex::match_context<CharT, Iter, " + std::to_string(ngroups) + ">;\n";
+        ret += decls;
+        ret += "  entry: (cur: Iter, inout ctx: context) -> cpp2::regex::match_return<Iter> = {\n";
+        ret += "    if cur != ctx.begin { " + no_match + " }\n";
+        ret += "    ctx..set_group_start(0, cur);\n";
+        ret += "    pos := cur;\n";
+        ret += body;
+        ret += "    if pos != ctx.end { " + no_match + " }\n";
+        ret += "    ctx..set_group_end(0, pos);\n";
+        ret += "    return cpp2::regex::match_return<Iter>(true, pos);\n";
+        ret += "  }\n";
+        ret += "  get_named_group_index: (name) -> int = {\n";
+        auto sep = std::string{};
+        for (auto const& g : named_groups) {
+            ret += sep + "if name == \"" + g.first + "\" { return " + std::to_string(g.second) + "; }";
+            sep = "else ";
+        }
+        if (named_groups.empty()) {
+            ret += "  _ = name;\n";
+            ret += "  return -1;\n";
+        }
+        else {
+            ret += "  else { return -1; }\n";
+        }
+        ret += "}\n";
+        ret += " }\n";
+        ret += "  prefilter: type == cpp2::regex::prefilter<\"\", true>;\n";
+        ret += "  to_string: () -> std::string = { return R\"(" + std::string{pattern} + ")\"; }\n";
+        ret += "}\n";
+        return ret;
+    }
+};
+
+}
+
+}
+
 namespace cpp2 {
 
 namespace meta {
 
-#line 29 "reflect.h2"
+#line 1223 "reflect.h2"
 class compiler_services
  {
 
-#line 33 "reflect.h2"
+#line 1227 "reflect.h2"
     private: std::vector<error_entry>* errors; 
     private: std::set<std::string>* includes; 
     private: int errors_original_size; 
@@ -156,7 +1349,7 @@ class compiler_services
     private: std::vector<std::string> metafunction_args {}; 
     private: bool metafunctions_used {false}; 
 
-#line 44 "reflect.h2"
+#line 1238 "reflect.h2"
     public: compiler_services(
 
         std::vector<error_entry>* errors_, 
@@ -164,59 +1357,59 @@ class compiler_services
         stable_vector<token>* generated_tokens_
     );
 
-#line 60 "reflect.h2"
+#line 1254 "reflect.h2"
     public: auto set_metafunction_name(cpp2::impl::in<std::string_view> name, cpp2::impl::in<std::vector<std::string>> args) & -> void;
 
-#line 66 "reflect.h2"
+#line 1260 "reflect.h2"
     public: [[nodiscard]] auto get_metafunction_name() const& -> std::string_view;
 
     public: [[nodiscard]] auto get_argument(cpp2::impl::in<int> index) & -> std::string;
 
-#line 76 "reflect.h2"
+#line 1270 "reflect.h2"
     public: [[nodiscard]] auto get_arguments() & -> std::vector<std::string>;
 
-#line 81 "reflect.h2"
+#line 1275 "reflect.h2"
     public: [[nodiscard]] auto arguments_were_used() const& -> bool;
 using parse_statement_ret = std::unique_ptr<statement_node>;
 
 
-#line 83 "reflect.h2"
+#line 1277 "reflect.h2"
     protected: [[nodiscard]] auto parse_statement(
 
         std::string_view source
     ) & -> parse_statement_ret;
 
-#line 136 "reflect.h2"
+#line 1336 "reflect.h2"
     public: [[nodiscard]] auto add_runtime_support_include(cpp2::impl::in<std::string_view> s) & -> decltype(auto);
 
     public: [[nodiscard]] virtual auto position() const -> source_position;
 
-#line 147 "reflect.h2"
+#line 1347 "reflect.h2"
     public: auto require(
 
         cpp2::impl::in<bool> b, 
         cpp2::impl::in<std::string_view> msg
     ) const& -> void;
 
-#line 158 "reflect.h2"
+#line 1358 "reflect.h2"
     public: auto error(cpp2::impl::in<std::string_view> msg) const& -> void;
 
-#line 170 "reflect.h2"
+#line 1370 "reflect.h2"
     public: auto report_violation(auto const& msg) const& -> void;
 
-#line 178 "reflect.h2"
+#line 1378 "reflect.h2"
     public: [[nodiscard]] auto is_active() const& -> decltype(auto);
     public: virtual ~compiler_services() noexcept;
 public: compiler_services(compiler_services const& that);
 
-#line 179 "reflect.h2"
+#line 1379 "reflect.h2"
 };
 
-#line 189 "reflect.h2"
+#line 1389 "reflect.h2"
 template<typename T> class reflection_base
 : public compiler_services {
 
-#line 193 "reflect.h2"
+#line 1393 "reflect.h2"
     protected: T* n; 
 
     protected: reflection_base(
@@ -225,28 +1418,28 @@ template<typename T> class reflection_base
         cpp2::impl::in<compiler_services> s
     );
 
-#line 206 "reflect.h2"
+#line 1406 "reflect.h2"
     public: [[nodiscard]] auto position() const -> source_position override;
 
     public: [[nodiscard]] auto print() const& -> std::string;
     public: virtual ~reflection_base() noexcept;
 public: reflection_base(reflection_base const& that);
 
-#line 209 "reflect.h2"
+#line 1409 "reflect.h2"
 };
 
-#line 222 "reflect.h2"
+#line 1422 "reflect.h2"
 class declaration
 : public reflection_base<declaration_node> {
 
-#line 226 "reflect.h2"
+#line 1426 "reflect.h2"
     public: declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 235 "reflect.h2"
+#line 1435 "reflect.h2"
     public: [[nodiscard]] auto is_public() const& -> bool;
     public: [[nodiscard]] auto is_protected() const& -> bool;
     public: [[nodiscard]] auto is_private() const& -> bool;
@@ -265,7 +1458,7 @@ class declaration
 
     public: [[nodiscard]] auto name() const& -> std::string_view;
 
-#line 256 "reflect.h2"
+#line 1456 "reflect.h2"
     public: [[nodiscard]] auto has_initializer() const& -> bool;
 
     public: [[nodiscard]] auto is_global() const& -> bool;
@@ -307,21 +1500,21 @@ class declaration
 public: declaration(declaration const& that);
 
 
-#line 298 "reflect.h2"
+#line 1498 "reflect.h2"
 };
 
-#line 304 "reflect.h2"
+#line 1504 "reflect.h2"
 class function_declaration
 : public declaration {
 
-#line 308 "reflect.h2"
+#line 1508 "reflect.h2"
     public: function_declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 318 "reflect.h2"
+#line 1518 "reflect.h2"
     public: [[nodiscard]] auto index_of_parameter_named(cpp2::impl::in<std::string_view> s) const& -> int;
     public: [[nodiscard]] auto has_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool;
     public: [[nodiscard]] auto has_in_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool;
@@ -368,7 +1561,7 @@ class function_declaration
 
     public: [[nodiscard]] auto get_parameters() const& -> std::vector<object_declaration>;
 
-#line 374 "reflect.h2"
+#line 1574 "reflect.h2"
     public: [[nodiscard]] auto default_to_virtual() & -> decltype(auto);
 
     public: [[nodiscard]] auto make_virtual() & -> bool;
@@ -377,94 +1570,109 @@ class function_declaration
     public: function_declaration(function_declaration const& that);
 
 
-#line 390 "reflect.h2"
+#line 1590 "reflect.h2"
 };
 
-#line 396 "reflect.h2"
+#line 1596 "reflect.h2"
 class object_declaration
 : public declaration {
 
-#line 400 "reflect.h2"
+#line 1600 "reflect.h2"
     public: object_declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 410 "reflect.h2"
+#line 1610 "reflect.h2"
     public: [[nodiscard]] auto is_const() const& -> bool;
     public: [[nodiscard]] auto has_wildcard_type() const& -> bool;
 
     public: [[nodiscard]] auto type() const& -> std::string;
 
-#line 420 "reflect.h2"
+#line 1620 "reflect.h2"
     public: [[nodiscard]] auto initializer() const& -> std::string;
     public: object_declaration(object_declaration const& that);
 
 
-#line 426 "reflect.h2"
+#line 1626 "reflect.h2"
+};
+
+#line 1632 "reflect.h2"
+class value_member_info {
+    public: std::string name; 
+    public: std::string type; 
+    public: std::string value; 
+    public: value_member_info(auto const& name_, auto const& type_, auto const& value_);
+
+#line 1636 "reflect.h2"
 };
 
-#line 432 "reflect.h2"
 class type_declaration
 : public declaration {
 
-#line 436 "reflect.h2"
+#line 1642 "reflect.h2"
     public: type_declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 446 "reflect.h2"
+#line 1652 "reflect.h2"
     public: auto reserve_names(cpp2::impl::in<std::string_view> name, auto&& ...etc) const& -> void;
 
-#line 460 "reflect.h2"
+#line 1666 "reflect.h2"
     public: [[nodiscard]] auto is_polymorphic() const& -> bool;
     public: [[nodiscard]] auto is_final() const& -> bool;
     public: [[nodiscard]] auto make_final() & -> bool;
 
     public: [[nodiscard]] auto get_member_functions() const& -> std::vector<function_declaration>;
 
-#line 475 "reflect.h2"
+#line 1681 "reflect.h2"
     public: [[nodiscard]] auto get_member_functions_needing_initializer() const& -> std::vector<function_declaration>;
 
-#line 490 "reflect.h2"
+#line 1696 "reflect.h2"
     public: [[nodiscard]] auto get_member_objects() const& -> std::vector<object_declaration>;
 
-#line 500 "reflect.h2"
+#line 1712 "reflect.h2"
+    public: [[nodiscard]] auto get_member_object_infos() const& -> std::vector<value_member_info>;
+
+#line 1724 "reflect.h2"
     public: [[nodiscard]] auto get_member_types() const& -> std::vector<type_declaration>;
 
-#line 510 "reflect.h2"
+#line 1734 "reflect.h2"
     public: [[nodiscard]] auto get_member_aliases() const& -> std::vector<alias_declaration>;
 
-#line 520 "reflect.h2"
+#line 1744 "reflect.h2"
     public: [[nodiscard]] auto get_members() const& -> std::vector<declaration>;
+
+#line 1759 "reflect.h2"
+    public: [[nodiscard]] auto get_members_named(cpp2::impl::in<std::string_view> name) const& -> std::vector<declaration>;
 struct query_declared_value_set_functions_ret { bool out_this_in_that; bool out_this_move_that; bool inout_this_in_that; bool inout_this_move_that; };
 
 
 
-#line 530 "reflect.h2"
+#line 1769 "reflect.h2"
     public: [[nodiscard]] auto query_declared_value_set_functions() const& -> query_declared_value_set_functions_ret;
 
-#line 546 "reflect.h2"
+#line 1785 "reflect.h2"
     public: auto add_member(cpp2::impl::in<std::string_view> source) & -> void;
 
-#line 560 "reflect.h2"
+#line 1799 "reflect.h2"
     public: [[nodiscard]] auto remove_marked_members() & -> decltype(auto);
     public: [[nodiscard]] auto remove_all_members() & -> decltype(auto);
 
     public: [[nodiscard]] auto disable_member_function_generation() & -> decltype(auto);
     public: type_declaration(type_declaration const& that);
 
-#line 564 "reflect.h2"
+#line 1803 "reflect.h2"
 };
 
-#line 570 "reflect.h2"
+#line 1809 "reflect.h2"
 class alias_declaration
 : public declaration {
 
-#line 574 "reflect.h2"
+#line 1813 "reflect.h2"
     public: alias_declaration(
 
         declaration_node* n_, 
@@ -473,21 +1681,21 @@ class alias_declaration
     public: alias_declaration(alias_declaration const& that);
 
 
-#line 583 "reflect.h2"
+#line 1822 "reflect.h2"
 };
 
-#line 596 "reflect.h2"
+#line 1835 "reflect.h2"
 class statement
 : public reflection_base<statement_node> {
 
-#line 600 "reflect.h2"
+#line 1839 "reflect.h2"
     public: statement(
 
         statement_node* n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 609 "reflect.h2"
+#line 1848 "reflect.h2"
     public: [[nodiscard]] auto is_expression_statement() const& -> bool;
     public: [[nodiscard]] auto is_compound_statement() const& -> bool;
     public: [[nodiscard]] auto is_selection_statement() const& -> bool;
@@ -499,122 +1707,116 @@ class statement
     public: [[nodiscard]] auto is_inspect_expression() const& -> bool;
     public: [[nodiscard]] auto is_jump_statement() const& -> bool;
 
-#line 621 "reflect.h2"
+#line 1860 "reflect.h2"
     public: [[nodiscard]] auto as_compound_statement() const& -> compound_statement;
 
-#line 631 "reflect.h2"
+#line 1870 "reflect.h2"
     public: [[nodiscard]] auto to_string() const& -> std::string;
     public: virtual ~statement() noexcept;
 public: statement(statement const& that);
 
-#line 632 "reflect.h2"
+#line 1871 "reflect.h2"
 };
 
-#line 638 "reflect.h2"
+#line 1877 "reflect.h2"
 class compound_statement
 : public reflection_base<compound_statement_node> {
 
-#line 642 "reflect.h2"
+#line 1881 "reflect.h2"
     public: compound_statement(
 
         compound_statement_node* n_, 
         cpp2::impl::in<compiler_services> s
     );
 
-#line 651 "reflect.h2"
+#line 1890 "reflect.h2"
     public: [[nodiscard]] auto get_statements() const& -> std::vector<statement>;
 
-#line 661 "reflect.h2"
+#line 1900 "reflect.h2"
     public: auto add_statement(cpp2::impl::in<std::string_view> source, cpp2::impl::in<int> before_position = 0) & -> void;
     public: compound_statement(compound_statement const& that);
 
 
-#line 671 "reflect.h2"
+#line 1910 "reflect.h2"
 };
 
-#line 686 "reflect.h2"
+#line 1925 "reflect.h2"
 auto add_virtual_destructor(meta::type_declaration& t) -> void;
 
-#line 704 "reflect.h2"
+#line 1953 "reflect.h2"
 auto interface(meta::type_declaration& t) -> void;
 
-#line 750 "reflect.h2"
+#line 2026 "reflect.h2"
 auto polymorphic_base(meta::type_declaration& t) -> void;
 
-#line 795 "reflect.h2"
+#line 2064 "reflect.h2"
+auto fast_rtti(meta::type_declaration& t) -> void;
+
+#line 2106 "reflect.h2"
 auto ordered_impl(
     meta::type_declaration& t, 
     cpp2::impl::in<std::string_view> ordering
 ) -> void;
 
-#line 824 "reflect.h2"
+#line 2135 "reflect.h2"
 auto ordered(meta::type_declaration& t) -> void;
 
-#line 832 "reflect.h2"
+#line 2143 "reflect.h2"
 auto weakly_ordered(meta::type_declaration& t) -> void;
 
-#line 840 "reflect.h2"
+#line 2151 "reflect.h2"
 auto partially_ordered(meta::type_declaration& t) -> void;
 
-#line 862 "reflect.h2"
+#line 2173 "reflect.h2"
 auto copyable(meta::type_declaration& t) -> void;
 
-#line 895 "reflect.h2"
+#line 2213 "reflect.h2"
 auto hashable(meta::type_declaration& t) -> void;
 
-#line 928 "reflect.h2"
+#line 2251 "reflect.h2"
 auto basic_value(meta::type_declaration& t) -> void;
 
-#line 956 "reflect.h2"
+#line 2279 "reflect.h2"
 auto value(meta::type_declaration& t) -> void;
 
-#line 962 "reflect.h2"
+#line 2285 "reflect.h2"
 auto weakly_ordered_value(meta::type_declaration& t) -> void;
 
-#line 968 "reflect.h2"
+#line 2291 "reflect.h2"
 auto partially_ordered_value(meta::type_declaration& t) -> void;
 
-#line 997 "reflect.h2"
+#line 2320 "reflect.h2"
 auto cpp1_rule_of_zero(meta::type_declaration& t) -> void;
 
-#line 1039 "reflect.h2"
+#line 2362 "reflect.h2"
 auto cpp2_struct(meta::type_declaration& t) -> void;
 
-#line 1108 "reflect.h2"
-class value_member_info {
-    public: std::string name; 
-    public: std::string type; 
-    public: std::string value; 
-    public: value_member_info(auto const& name_, auto const& type_, auto const& value_);
-
-#line 1112 "reflect.h2"
-};
-
+#line 2431 "reflect.h2"
 auto basic_enum(
     meta::type_declaration& t, 
     auto const& nextval, 
     cpp2::impl::in<bool> bitwise
     ) -> void;
 
-#line 1378 "reflect.h2"
+#line 2695 "reflect.h2"
 auto cpp2_enum(meta::type_declaration& t) -> void;
 
-#line 1405 "reflect.h2"
+#line 2722 "reflect.h2"
 auto flag_enum(meta::type_declaration& t) -> void;
 
-#line 1451 "reflect.h2"
+#line 2768 "reflect.h2"
 auto cpp2_union(meta::type_declaration& t) -> void;
 
-#line 1602 "reflect.h2"
+#line 2919 "reflect.h2"
 auto print(cpp2::impl::in<meta::type_declaration> t) -> void;
 
-#line 1613 "reflect.h2"
+#line 2930 "reflect.h2"
 auto noisy(cpp2::impl::in<meta::type_declaration> t) -> void;
 
-#line 1644 "reflect.h2"
+#line 2961 "reflect.h2"
 using error_func = std::function<void(cpp2::impl::in<std::string> x)>;
 
-#line 1648 "reflect.h2"
+#line 2965 "reflect.h2"
 class expression_flags
  {
 private: cpp2::u8 _value; private: constexpr expression_flags(cpp2::impl::in<cpp2::i64> _val);
@@ -649,20 +1851,20 @@ public: [[nodiscard]] auto to_code() const& -> std::string;
 public: [[nodiscard]] static auto from_string(cpp2::impl::in<std::string_view> s) -> expression_flags;
 public: [[nodiscard]] static auto from_code(cpp2::impl::in<std::string_view> s) -> expression_flags;
 
-#line 1656 "reflect.h2"
+#line 2973 "reflect.h2"
 };
 
-#line 1664 "reflect.h2"
+#line 2981 "reflect.h2"
 class regex_token
  {
     public: std::string string_rep; 
 
     public: regex_token(cpp2::impl::in<std::string> str);
 
-#line 1672 "reflect.h2"
+#line 2989 "reflect.h2"
     public: explicit regex_token();
 
-#line 1677 "reflect.h2"
+#line 2994 "reflect.h2"
     public: virtual auto generate_code([[maybe_unused]] generation_context& unnamed_param_2) const -> void = 0;
 
     public: virtual auto add_groups([[maybe_unused]] std::set<int>& unnamed_param_2) const -> void;
@@ -673,24 +1875,24 @@ class regex_token
     public: regex_token(regex_token const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(regex_token const&) -> void = delete;
 
-#line 1682 "reflect.h2"
+#line 2999 "reflect.h2"
 };
 
 using token_ptr = std::shared_ptr<regex_token>;
 using token_vec = std::vector<token_ptr>;
 
-#line 1688 "reflect.h2"
+#line 3005 "reflect.h2"
 //  Adds a check in code generation.
 //
 class regex_token_check
 : public regex_token {
 
-#line 1694 "reflect.h2"
+#line 3011 "reflect.h2"
     private: std::string check; 
 
     public: regex_token_check(cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> check_);
 
-#line 1701 "reflect.h2"
+#line 3018 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
     public: virtual ~regex_token_check() noexcept;
 
@@ -698,21 +1900,21 @@ class regex_token_check
     public: auto operator=(regex_token_check const&) -> void = delete;
 
 
-#line 1704 "reflect.h2"
+#line 3021 "reflect.h2"
 };
 
-#line 1707 "reflect.h2"
+#line 3024 "reflect.h2"
 //  Adds code in code generation.
 //
 class regex_token_code
 : public regex_token {
 
-#line 1713 "reflect.h2"
+#line 3030 "reflect.h2"
     private: std::string code; 
 
     public: regex_token_code(cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> code_);
 
-#line 1720 "reflect.h2"
+#line 3037 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
     public: virtual ~regex_token_code() noexcept;
 
@@ -720,19 +1922,19 @@ class regex_token_code
     public: auto operator=(regex_token_code const&) -> void = delete;
 
 
-#line 1723 "reflect.h2"
+#line 3040 "reflect.h2"
 };
 
-#line 1726 "reflect.h2"
+#line 3043 "reflect.h2"
 //  Token that does not influence the matching. E.g. comment.
 //
 class regex_token_empty
 : public regex_token {
 
-#line 1732 "reflect.h2"
+#line 3049 "reflect.h2"
     public: regex_token_empty(cpp2::impl::in<std::string> str);
 
-#line 1736 "reflect.h2"
+#line 3053 "reflect.h2"
     public: auto generate_code([[maybe_unused]] generation_context& unnamed_param_2) const -> void override;
     public: virtual ~regex_token_empty() noexcept;
 
@@ -740,27 +1942,27 @@ class regex_token_empty
     public: auto operator=(regex_token_empty const&) -> void = delete;
 
 
-#line 1739 "reflect.h2"
+#line 3056 "reflect.h2"
 };
 
-#line 1742 "reflect.h2"
+#line 3059 "reflect.h2"
 //  Represents a list of regex tokens as one token.
 //
 class regex_token_list
 : public regex_token {
 
-#line 1748 "reflect.h2"
+#line 3065 "reflect.h2"
     public: token_vec tokens; 
 
     public: regex_token_list(cpp2::impl::in<token_vec> t);
 
-#line 1755 "reflect.h2"
+#line 3072 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 1761 "reflect.h2"
+#line 3078 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
 
-#line 1767 "reflect.h2"
+#line 3084 "reflect.h2"
     public: [[nodiscard]] static auto gen_string(cpp2::impl::in<token_vec> vec) -> std::string;
     public: virtual ~regex_token_list() noexcept;
 
@@ -768,10 +1970,9 @@ class regex_token_list
     public: auto operator=(regex_token_list const&) -> void = delete;
 
 
-#line 1774 "reflect.h2"
 };
 
-#line 1777 "reflect.h2"
+#line 3094 "reflect.h2"
 //
 //  Parse and generation context.
 //
@@ -787,33 +1988,33 @@ class parse_context_group_state
     //  Start a new alternative.
     public: auto next_alternative() & -> void;
 
-#line 1797 "reflect.h2"
+#line 3114 "reflect.h2"
     //  Swap this state with the other one. NOLINTNEXTLINE(performance-noexcept-swap)
     public: auto swap(parse_context_group_state& t) & -> void;
 
-#line 1804 "reflect.h2"
+#line 3121 "reflect.h2"
     //  Convert this state into a regex token.
     public: [[nodiscard]] auto get_as_token() & -> token_ptr;
 
-#line 1816 "reflect.h2"
+#line 3133 "reflect.h2"
     //  Add a token to the current matcher list.
     public: auto add(cpp2::impl::in<token_ptr> token) & -> void;
 
-#line 1821 "reflect.h2"
+#line 3138 "reflect.h2"
     //  True if current matcher list is empty.
     public: [[nodiscard]] auto empty() const& -> bool;
 
-#line 1825 "reflect.h2"
+#line 3142 "reflect.h2"
     //  Apply optimizations to the matcher list.
     public: static auto post_process_list(token_vec& list) -> void;
     public: parse_context_group_state(auto const& cur_match_list_, auto const& alternate_match_lists_, auto const& modifiers_);
 public: parse_context_group_state();
 
 
-#line 1839 "reflect.h2"
+#line 3156 "reflect.h2"
 };
 
-#line 1842 "reflect.h2"
+#line 3159 "reflect.h2"
 //  State for the branch reset. Takes care of the group numbering. See '(|<pattern>)'.
 //
 class parse_context_branch_reset_state
@@ -826,25 +2027,25 @@ class parse_context_branch_reset_state
     //  Next group identifier.
     public: [[nodiscard]] auto next() & -> int;
 
-#line 1860 "reflect.h2"
+#line 3177 "reflect.h2"
     //  Set next group identifier.
     public: auto set_next(cpp2::impl::in<int> g) & -> void;
 
-#line 1866 "reflect.h2"
+#line 3183 "reflect.h2"
     //  Start a new alternative branch.
     public: auto next_alternative() & -> void;
 
-#line 1873 "reflect.h2"
+#line 3190 "reflect.h2"
     //  Initialize for a branch reset group.
     public: auto set_active_reset(cpp2::impl::in<int> restart) & -> void;
     public: parse_context_branch_reset_state(auto const& is_active_, auto const& cur_group_, auto const& max_group_, auto const& from_);
 public: parse_context_branch_reset_state();
 
 
-#line 1880 "reflect.h2"
+#line 3197 "reflect.h2"
 };
 
-#line 1883 "reflect.h2"
+#line 3200 "reflect.h2"
 //  Context during parsing of the regular expressions.
 // 
 //  Keeps track of the distributed group identifiers, current parsed group and branch resets.
@@ -858,7 +2059,7 @@ class parse_context
     private: parse_context_group_state cur_group_state {}; 
     private: parse_context_branch_reset_state cur_branch_reset_state {}; 
 
-#line 1897 "reflect.h2"
+#line 3214 "reflect.h2"
            public: std::map<std::string,int> named_groups {}; 
 
     private: error_func error_out; // TODO: Declaring std::function<void(std::string)> fails for cpp2.
@@ -866,64 +2067,64 @@ class parse_context
 
     public: parse_context(cpp2::impl::in<std::string_view> r, auto const& e);
 
-#line 1908 "reflect.h2"
+#line 3225 "reflect.h2"
     //  State management functions
     //
 
     //  Returned group state needs to be stored and provided in `end_group`.
     public: [[nodiscard]] auto start_group() & -> parse_context_group_state;
 
-#line 1921 "reflect.h2"
+#line 3238 "reflect.h2"
     //  `old_state` argument needs to be from start group.
     public: [[nodiscard]] auto end_group(cpp2::impl::in<parse_context_group_state> old_state) & -> token_ptr;
 
-#line 1929 "reflect.h2"
+#line 3246 "reflect.h2"
     public: [[nodiscard]] auto get_modifiers() const& -> expression_flags;
 
-#line 1933 "reflect.h2"
+#line 3250 "reflect.h2"
     public: auto set_modifiers(cpp2::impl::in<expression_flags> mod) & -> void;
 
-#line 1937 "reflect.h2"
+#line 3254 "reflect.h2"
     //  Branch reset management functions
     //
 
     public: [[nodiscard]] auto branch_reset_new_state() & -> parse_context_branch_reset_state;
 
-#line 1949 "reflect.h2"
+#line 3266 "reflect.h2"
     public: auto branch_reset_restore_state(cpp2::impl::in<parse_context_branch_reset_state> old_state) & -> void;
 
-#line 1956 "reflect.h2"
+#line 3273 "reflect.h2"
     public: auto next_alternative() & -> void;
 
-#line 1962 "reflect.h2"
+#line 3279 "reflect.h2"
     //  Regex token management
     //
     public: auto add_token(cpp2::impl::in<token_ptr> token) & -> void;
 
-#line 1968 "reflect.h2"
+#line 3285 "reflect.h2"
     public: [[nodiscard]] auto has_token() const& -> bool;
 
-#line 1972 "reflect.h2"
+#line 3289 "reflect.h2"
     public: [[nodiscard]] auto pop_token() & -> token_ptr;
 
-#line 1983 "reflect.h2"
+#line 3300 "reflect.h2"
     public: [[nodiscard]] auto get_as_token() & -> token_ptr;
 
-#line 1987 "reflect.h2"
+#line 3304 "reflect.h2"
     //  Group management
     //
     public: [[nodiscard]] auto get_cur_group() const& -> int;
 
-#line 1993 "reflect.h2"
+#line 3310 "reflect.h2"
     public: [[nodiscard]] auto next_group() & -> int;
 
-#line 1997 "reflect.h2"
+#line 3314 "reflect.h2"
     public: auto set_named_group(cpp2::impl::in<std::string> name, cpp2::impl::in<int> id) & -> void;
 
-#line 2004 "reflect.h2"
+#line 3321 "reflect.h2"
     public: [[nodiscard]] auto get_named_group(cpp2::impl::in<std::string> name) const& -> int;
 
-#line 2015 "reflect.h2"
+#line 3332 "reflect.h2"
     //  Position management functions
     //
     public: [[nodiscard]] auto current() const& -> char;
@@ -931,51 +2132,51 @@ class parse_context
     //  Get the next token in the regex, skipping spaces according to the parameters. See `x` and `xx` modifiers.
     private: [[nodiscard]] auto get_next_position(cpp2::impl::in<bool> in_class, cpp2::impl::in<bool> no_skip) const& -> size_t;
 
-#line 2059 "reflect.h2"
+#line 3376 "reflect.h2"
     //  Return true if next token is available.
     private: [[nodiscard]] auto next_impl(cpp2::impl::in<bool> in_class, cpp2::impl::in<bool> no_skip) & -> bool;
 
-#line 2071 "reflect.h2"
+#line 3388 "reflect.h2"
     public: [[nodiscard]] auto next() & -> decltype(auto);
     public: [[nodiscard]] auto next_in_class() & -> decltype(auto);
     public: [[nodiscard]] auto next_no_skip() & -> decltype(auto);
 
     public: [[nodiscard]] auto next_n(cpp2::impl::in<int> n) & -> bool;
 
-#line 2084 "reflect.h2"
+#line 3401 "reflect.h2"
     public: [[nodiscard]] auto has_next() const& -> bool;
 
     private: [[nodiscard]] auto grab_until_impl(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r, cpp2::impl::in<bool> any) & -> bool;
 
-#line 2107 "reflect.h2"
+#line 3424 "reflect.h2"
     public: [[nodiscard]] auto grab_until(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r) & -> decltype(auto);
     public: [[nodiscard]] auto grab_until(cpp2::impl::in<char> e, cpp2::impl::out<std::string> r) & -> decltype(auto);
     public: [[nodiscard]] auto grab_until_one_of(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r) & -> decltype(auto);
 
     public: [[nodiscard]] auto grab_n(cpp2::impl::in<int> n, cpp2::impl::out<std::string> r) & -> bool;
 
-#line 2124 "reflect.h2"
+#line 3441 "reflect.h2"
     public: [[nodiscard]] auto grab_number() & -> std::string;
 
-#line 2145 "reflect.h2"
+#line 3462 "reflect.h2"
     private: [[nodiscard]] auto peek_impl(cpp2::impl::in<bool> in_class) const& -> char;
 
-#line 2155 "reflect.h2"
+#line 3472 "reflect.h2"
     public: [[nodiscard]] auto peek() const& -> decltype(auto);
     public: [[nodiscard]] auto peek_in_class() const& -> decltype(auto);
 
-#line 2159 "reflect.h2"
+#line 3476 "reflect.h2"
     //  Parsing functions
     //
     public: [[nodiscard]] auto parser_group_modifiers(cpp2::impl::in<std::string> change_str, expression_flags& parser_modifiers) & -> bool;
 
-#line 2215 "reflect.h2"
+#line 3532 "reflect.h2"
     public: [[nodiscard]] auto parse_until(cpp2::impl::in<char> term) & -> bool;
 
-#line 2253 "reflect.h2"
+#line 3570 "reflect.h2"
     public: [[nodiscard]] auto parse(cpp2::impl::in<std::string> modifiers) & -> bool;
 
-#line 2268 "reflect.h2"
+#line 3585 "reflect.h2"
     //  Misc functions
 
     public: [[nodiscard]] auto get_pos() const& -> decltype(auto);
@@ -987,10 +2188,9 @@ class parse_context
     public: auto operator=(parse_context const&) -> void = delete;
 
 
-#line 2279 "reflect.h2"
 };
 
-#line 2282 "reflect.h2"
+#line 3599 "reflect.h2"
 //  Context for one function generation. Generation of functions can be interleaved,
 //  therefore we buffer the code for one function here.
 //
@@ -1000,16 +2200,16 @@ class generation_function_context {
 
     public: auto add_tabs(cpp2::impl::in<int> c) & -> void;
 
-#line 2296 "reflect.h2"
+#line 3613 "reflect.h2"
     public: auto remove_tabs(cpp2::impl::in<int> c) & -> void;
     public: generation_function_context(auto const& code_, auto const& tabs_);
 public: generation_function_context();
 
 
-#line 2299 "reflect.h2"
+#line 3616 "reflect.h2"
 };
 
-#line 2302 "reflect.h2"
+#line 3619 "reflect.h2"
 //  Context for generating the state machine.
 class generation_context
  {
@@ -1029,68 +2229,68 @@ class generation_context
     //  Add code line.
     public: auto add(cpp2::impl::in<std::string> s) & -> void;
 
-#line 2324 "reflect.h2"
+#line 3641 "reflect.h2"
     //  Add check for token. The check needs to be a function call that returns a boolean.
     public: auto add_check(cpp2::impl::in<std::string> check) & -> void;
 
-#line 2330 "reflect.h2"
+#line 3647 "reflect.h2"
     //  Add a stateful check. The check needs to return a `match_return`.
     public: auto add_statefull(cpp2::impl::in<std::string> next_func, cpp2::impl::in<std::string> check) & -> void;
 
-#line 2339 "reflect.h2"
+#line 3656 "reflect.h2"
     protected: auto start_func_named(cpp2::impl::in<std::string> name) & -> void;
 
-#line 2350 "reflect.h2"
+#line 3667 "reflect.h2"
     protected: [[nodiscard]] auto start_func() & -> std::string;
 
-#line 2357 "reflect.h2"
+#line 3674 "reflect.h2"
     protected: auto end_func_statefull(cpp2::impl::in<std::string> s) & -> void;
 
-#line 2376 "reflect.h2"
+#line 3693 "reflect.h2"
     //  Generate the function for a token.
     public: [[nodiscard]] auto generate_func(cpp2::impl::in<token_ptr> token) & -> std::string;
 
-#line 2386 "reflect.h2"
+#line 3703 "reflect.h2"
     //  Generate the reset for a list of group identifiers.
     public: [[nodiscard]] auto generate_reset(cpp2::impl::in<std::set<int>> groups) & -> std::string;
 
-#line 2409 "reflect.h2"
+#line 3726 "reflect.h2"
     //  Name generation
     //
     protected: [[nodiscard]] auto gen_func_name() & -> std::string;
 
-#line 2417 "reflect.h2"
+#line 3734 "reflect.h2"
     public: [[nodiscard]] auto next_func_name() & -> std::string;
 
-#line 2421 "reflect.h2"
+#line 3738 "reflect.h2"
     protected: [[nodiscard]] auto gen_reset_func_name() & -> std::string;
 
-#line 2427 "reflect.h2"
+#line 3744 "reflect.h2"
     public: [[nodiscard]] auto gen_temp() & -> std::string;
 
-#line 2433 "reflect.h2"
+#line 3750 "reflect.h2"
     //  Context management
     //
     public: [[nodiscard]] auto new_context() & -> generation_function_context*;
 
-#line 2443 "reflect.h2"
+#line 3760 "reflect.h2"
     public: auto finish_context() & -> void;
 
-#line 2451 "reflect.h2"
+#line 3768 "reflect.h2"
     //  Misc functions
     //
     private: [[nodiscard]] auto get_current() & -> generation_function_context*;
 
-#line 2457 "reflect.h2"
+#line 3774 "reflect.h2"
     private: [[nodiscard]] auto get_base() & -> generation_function_context*;
 
-#line 2461 "reflect.h2"
+#line 3778 "reflect.h2"
     public: [[nodiscard]] auto get_entry_func() const& -> std::string;
 
-#line 2465 "reflect.h2"
+#line 3782 "reflect.h2"
     public: [[nodiscard]] auto create_named_group_lookup(cpp2::impl::in<std::map<std::string,int>> named_groups) const& -> std::string;
 
-#line 2489 "reflect.h2"
+#line 3806 "reflect.h2"
     //  Run the generation for the token.
     public: [[nodiscard]] auto run(cpp2::impl::in<token_ptr> token) & -> std::string;
     public: generation_context() = default;
@@ -1098,7 +2298,7 @@ class generation_context
     public: auto operator=(generation_context const&) -> void = delete;
 
 
-#line 2495 "reflect.h2"
+#line 3812 "reflect.h2"
 };
 
 //  Regex syntax: |  Example: ab|ba
@@ -1118,24 +2318,23 @@ class alternative_token
     public: auto operator=(alternative_token const&) -> void = delete;
 
 
-#line 2514 "reflect.h2"
 };
 
 class alternative_token_gen
 : public regex_token {
 
-#line 2520 "reflect.h2"
+#line 3837 "reflect.h2"
     private: token_vec alternatives; 
 
     public: alternative_token_gen(cpp2::impl::in<token_vec> a);
 
-#line 2527 "reflect.h2"
+#line 3844 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 2544 "reflect.h2"
+#line 3861 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
 
-#line 2551 "reflect.h2"
+#line 3868 "reflect.h2"
     public: [[nodiscard]] static auto gen_string(cpp2::impl::in<token_vec> a) -> std::string;
     public: virtual ~alternative_token_gen() noexcept;
 
@@ -1143,19 +2342,19 @@ class alternative_token_gen
     public: auto operator=(alternative_token_gen const&) -> void = delete;
 
 
-#line 2563 "reflect.h2"
+#line 3880 "reflect.h2"
 };
 
-#line 2566 "reflect.h2"
+#line 3883 "reflect.h2"
 //  Regex syntax: .
 //
 class any_token
 : public regex_token_check {
 
-#line 2572 "reflect.h2"
+#line 3889 "reflect.h2"
     public: any_token(cpp2::impl::in<bool> single_line);
 
-#line 2576 "reflect.h2"
+#line 3893 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
     public: virtual ~any_token() noexcept;
 
@@ -1163,37 +2362,37 @@ class any_token
     public: auto operator=(any_token const&) -> void = delete;
 
 
-#line 2581 "reflect.h2"
+#line 3898 "reflect.h2"
 };
 
-#line 2584 "reflect.h2"
+#line 3901 "reflect.h2"
 //  Regex syntax: a
 //
 class char_token
 : public regex_token {
 
-#line 2590 "reflect.h2"
+#line 3907 "reflect.h2"
     private: std::string token; 
     private: bool ignore_case; 
 
     public: char_token(cpp2::impl::in<char> t, cpp2::impl::in<bool> ignore_case_);
 
-#line 2599 "reflect.h2"
+#line 3916 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 2603 "reflect.h2"
+#line 3920 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 2626 "reflect.h2"
+#line 3943 "reflect.h2"
     public: auto gen_case_insensitive(cpp2::impl::in<std::string> lower, cpp2::impl::in<std::string> upper, generation_context& ctx) const& -> void;
 
-#line 2647 "reflect.h2"
+#line 3964 "reflect.h2"
     public: auto gen_case_sensitive(generation_context& ctx) const& -> void;
 
-#line 2665 "reflect.h2"
+#line 3982 "reflect.h2"
     public: [[nodiscard]] auto add_escapes(std::string str) const& -> std::string;
 
-#line 2680 "reflect.h2"
+#line 3997 "reflect.h2"
     public: auto append(char_token const& that) & -> void;
     public: virtual ~char_token() noexcept;
 
@@ -1201,30 +2400,30 @@ class char_token
     public: auto operator=(char_token const&) -> void = delete;
 
 
-#line 2684 "reflect.h2"
+#line 4001 "reflect.h2"
 };
 
-#line 2687 "reflect.h2"
+#line 4004 "reflect.h2"
 //  Regex syntax: [<character classes>]  Example: [abcx-y[:digits:]]
 //
 class class_token
 : public regex_token {
 
-#line 2693 "reflect.h2"
+#line 4010 "reflect.h2"
     private: bool negate; 
     private: bool case_insensitive; 
     private: std::string class_str; 
 
     public: class_token(cpp2::impl::in<bool> negate_, cpp2::impl::in<bool> case_insensitive_, cpp2::impl::in<std::string> class_str_, cpp2::impl::in<std::string> str);
 
-#line 2705 "reflect.h2"
+#line 4022 "reflect.h2"
     //  TODO: Rework class generation: Generate check functions for classes.
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 2831 "reflect.h2"
+#line 4148 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 2836 "reflect.h2"
+#line 4153 "reflect.h2"
     private: [[nodiscard]] static auto create_matcher(cpp2::impl::in<std::string> name, cpp2::impl::in<std::string> template_arguments) -> std::string;
     public: virtual ~class_token() noexcept;
 
@@ -1232,20 +2431,19 @@ class class_token
     public: auto operator=(class_token const&) -> void = delete;
 
 
-#line 2843 "reflect.h2"
 };
 
-#line 2846 "reflect.h2"
+#line 4163 "reflect.h2"
 //  Regex syntax: \a or \n or \[
 //
 [[nodiscard]] auto escape_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 2887 "reflect.h2"
+#line 4204 "reflect.h2"
 //  Regex syntax: \K Example: ab\Kcd
 //
 [[nodiscard]] auto global_group_reset_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 2898 "reflect.h2"
+#line 4215 "reflect.h2"
 //  Regex syntax: \<number>  Example: \1
 //                \g{name_or_number}
 //                \k{name_or_number}
@@ -1255,16 +2453,16 @@ class class_token
 class group_ref_token
 : public regex_token {
 
-#line 2908 "reflect.h2"
+#line 4225 "reflect.h2"
     private: int id; 
     private: bool case_insensitive; 
 
     public: group_ref_token(cpp2::impl::in<int> id_, cpp2::impl::in<bool> case_insensitive_, cpp2::impl::in<std::string> str);
 
-#line 2918 "reflect.h2"
+#line 4235 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 3019 "reflect.h2"
+#line 4336 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
     public: virtual ~group_ref_token() noexcept;
 
@@ -1272,10 +2470,10 @@ class group_ref_token
     public: auto operator=(group_ref_token const&) -> void = delete;
 
 
-#line 3022 "reflect.h2"
+#line 4339 "reflect.h2"
 };
 
-#line 3025 "reflect.h2"
+#line 4342 "reflect.h2"
 //  Regex syntax: (<tokens>)      Example: (abc)
 //                (?<modifiers)            (?i)
 //                (?<modifiers>:<tokens>)  (?i:abc)
@@ -1289,22 +2487,22 @@ class group_ref_token
 class group_token
 : public regex_token {
 
-#line 3039 "reflect.h2"
+#line 4356 "reflect.h2"
     private: int number {-1}; 
     private: token_ptr inner {nullptr}; 
 
     public: [[nodiscard]] static auto parse_lookahead(parse_context& ctx, cpp2::impl::in<std::string> syntax, cpp2::impl::in<bool> positive) -> token_ptr;
 
-#line 3056 "reflect.h2"
+#line 4373 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 3193 "reflect.h2"
+#line 4510 "reflect.h2"
     public: [[nodiscard]] static auto gen_string(cpp2::impl::in<std::string> name, cpp2::impl::in<bool> name_brackets, cpp2::impl::in<bool> has_modifier, cpp2::impl::in<std::string> modifiers, cpp2::impl::in<token_ptr> inner_) -> std::string;
 
-#line 3211 "reflect.h2"
+#line 4528 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 3231 "reflect.h2"
+#line 4548 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
     public: virtual ~group_token() noexcept;
 
@@ -1313,25 +2511,25 @@ class group_token
     public: auto operator=(group_token const&) -> void = delete;
 
 
-#line 3238 "reflect.h2"
+#line 4555 "reflect.h2"
 };
 
-#line 3241 "reflect.h2"
+#line 4558 "reflect.h2"
 //  Regex syntax: \x<number> or \x{<number>}  Example: \x{62}
 //
 [[nodiscard]] auto hexadecimal_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 3282 "reflect.h2"
+#line 4599 "reflect.h2"
 //  Regex syntax: $  Example: aa$
 //
 [[nodiscard]] auto line_end_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 3302 "reflect.h2"
+#line 4619 "reflect.h2"
 //  Regex syntax: ^  Example: ^aa
 //
 [[nodiscard]] auto line_start_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 3318 "reflect.h2"
+#line 4635 "reflect.h2"
 //  Regex syntax: (?=) or (?!) or (*pla), etc.  Example: (?=AA)
 //
 //  Parsed in group_token.
@@ -1339,16 +2537,16 @@ class group_token
 class lookahead_token
 : public regex_token {
 
-#line 3326 "reflect.h2"
+#line 4643 "reflect.h2"
     protected: bool positive; 
     public:   token_ptr inner {nullptr}; 
 
     public: lookahead_token(cpp2::impl::in<bool> positive_);
 
-#line 3333 "reflect.h2"
+#line 4650 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 3339 "reflect.h2"
+#line 4656 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
     public: virtual ~lookahead_token() noexcept;
 
@@ -1356,26 +2554,26 @@ class lookahead_token
     public: auto operator=(lookahead_token const&) -> void = delete;
 
 
-#line 3342 "reflect.h2"
+#line 4659 "reflect.h2"
 };
 
-#line 3345 "reflect.h2"
+#line 4662 "reflect.h2"
 // Named character classes
 //
 [[nodiscard]] auto named_class_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 3373 "reflect.h2"
+#line 4690 "reflect.h2"
 //  Regex syntax: \o{<number>}  Example: \o{142}
 //
 [[nodiscard]] auto octal_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 3401 "reflect.h2"
+#line 4718 "reflect.h2"
 //  Regex syntax: <matcher>{min, max}  Example: a{2,4}
 //
 class range_token
 : public regex_token {
 
-#line 3407 "reflect.h2"
+#line 4724 "reflect.h2"
               protected: int min_count {-1}; 
               protected: int max_count {-1}; 
               protected: int kind {range_flags::greedy}; 
@@ -1385,19 +2583,19 @@ class range_token
 
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
 
-#line 3487 "reflect.h2"
+#line 4804 "reflect.h2"
     public: auto parse_modifier(parse_context& ctx) & -> void;
 
-#line 3499 "reflect.h2"
+#line 4816 "reflect.h2"
     public: [[nodiscard]] auto gen_mod_string() const& -> std::string;
 
-#line 3512 "reflect.h2"
+#line 4829 "reflect.h2"
     public: [[nodiscard]] auto gen_range_string() const& -> std::string;
 
-#line 3531 "reflect.h2"
+#line 4848 "reflect.h2"
     public: auto generate_code(generation_context& ctx) const -> void override;
 
-#line 3542 "reflect.h2"
+#line 4859 "reflect.h2"
     public: auto add_groups(std::set<int>& groups) const -> void override;
     public: virtual ~range_token() noexcept;
 
@@ -1405,16 +2603,16 @@ class range_token
     public: auto operator=(range_token const&) -> void = delete;
 
 
-#line 3546 "reflect.h2"
+#line 4863 "reflect.h2"
 };
 
-#line 3549 "reflect.h2"
+#line 4866 "reflect.h2"
 //  Regex syntax: *, +, or ?  Example: aa*
 //
 class special_range_token
 : public range_token {
 
-#line 3555 "reflect.h2"
+#line 4872 "reflect.h2"
     public: [[nodiscard]] static auto parse(parse_context& ctx) -> token_ptr;
     public: virtual ~special_range_token() noexcept;
 
@@ -1423,17 +2621,17 @@ class special_range_token
     public: auto operator=(special_range_token const&) -> void = delete;
 
 
-#line 3585 "reflect.h2"
+#line 4902 "reflect.h2"
 };
 
-#line 3588 "reflect.h2"
+#line 4905 "reflect.h2"
 //  Regex syntax: \b or \B  Example: \bword\b
 //
 //  Matches the start end end of word boundaries.
 //
 [[nodiscard]] auto word_boundary_token_parse(parse_context& ctx) -> token_ptr;
 
-#line 3610 "reflect.h2"
+#line 4927 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  Parser for regular expression.
@@ -1454,24 +2652,59 @@ template<typename Error_out> class regex_generator
 
     public: regex_generator(cpp2::impl::in<std::string_view> r, Error_out const& e);
 
-#line 3633 "reflect.h2"
+#line 4950 "reflect.h2"
     public: [[nodiscard]] auto parse() & -> std::string;
 
-#line 3668 "reflect.h2"
+#line 4987 "reflect.h2"
+    //  Facts about the pattern that search() can exploit without running
+    //  the matcher: a start anchor and a required literal prefix. The scan
+    //  is conservative - anything it does not understand ends the prefix,
+    //  and a top-level alternation or a modifier drops the filter entirely.
+    private: [[nodiscard]] auto extract_prefilter() const& -> std::string;
+
+#line 5069 "reflect.h2"
+    private: [[nodiscard]] static auto byte_of(cpp2::impl::in<char> c) -> int;
+
     private: auto extract_modifiers() & -> void;
     public: regex_generator(regex_generator const&) = delete; /* No 'that' constructor, suppress copy */
     public: auto operator=(regex_generator const&) -> void = delete;
 
 
-#line 3682 "reflect.h2"
+#line 5085 "reflect.h2"
 };
 
+//  With -max-regex-expansion, refuse a pattern whose generated matcher
+//  text exceeds the budget: a pathological pattern then fails right away
+//  with its numbers in hand, instead of silently handing add_member and
+//  every downstream compile megabytes of matcher text to chew through.
+//  States are counted as the matcher types in the generated text, which
+//  the classic generator emits one per automaton state
+//
+template<typename Err> [[nodiscard]] auto regex_expansion_in_budget(cpp2::impl::in<std::string_view> pattern, cpp2::impl::in<std::string_view> generated, Err err) -> bool;
+
+#line 5117 "reflect.h2"
 template<typename Err> [[nodiscard]] auto generate_regex(cpp2::impl::in<std::string_view> regex, Err const& err) -> std::string;
 
-#line 3694 "reflect.h2"
+#line 5153 "reflect.h2"
 auto regex_gen(meta::type_declaration& t) -> void;
 
-#line 3749 "reflect.h2"
+#line 5287 "reflect.h2"
+//-----------------------------------------------------------------------
+//
+//  regex_set - matches many patterns in one pass
+//
+//  Each 'regex_'-prefixed member contributes one pattern, in declaration
+//  order, to a single combined automaton; 'match_all(subject)' scans the
+//  subject once and returns which patterns have a match in it. That
+//  turns a dispatch loop that tries N patterns sequentially from
+//  O(N x length) into O(length). The patterns share the restricted
+//  dialect of @regex<dfa>, with '^' and '$' honored per pattern.
+//
+//-----------------------------------------------------------------------
+//
+auto regex_set_gen(meta::type_declaration& t) -> void;
+
+#line 5382 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  apply_metafunctions
@@ -1482,7 +2715,7 @@ auto regex_gen(meta::type_declaration& t) -> void;
     auto const& error
     ) -> bool;
 
-#line 3866 "reflect.h2"
+#line 5505 "reflect.h2"
 }
 
 }
@@ -1492,12 +2725,12 @@ auto regex_gen(meta::type_declaration& t) -> void;
 
 #line 1 "reflect.h2"
 
-#line 17 "reflect.h2"
+#line 1211 "reflect.h2"
 namespace cpp2 {
 
 namespace meta {
 
-#line 22 "reflect.h2"
+#line 1216 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  Compiler services
@@ -1505,14 +2738,13 @@ namespace meta {
 //-----------------------------------------------------------------------
 //
 
-#line 31 "reflect.h2"
+#line 1225 "reflect.h2"
     //  Common data members
     //
 
-#line 42 "reflect.h2"
+#line 1236 "reflect.h2"
     //  Constructor
     //
-#line 44 "reflect.h2"
     compiler_services::compiler_services(
 
         std::vector<error_entry>* errors_, 
@@ -1524,25 +2756,22 @@ namespace meta {
         , errors_original_size{ cpp2::unchecked_narrow<int>(std::ssize(*cpp2::impl::assert_not_null(errors))) }
         , generated_tokens{ generated_tokens_ }
         , parser{ *cpp2::impl::assert_not_null(errors), *cpp2::impl::assert_not_null(includes) }
-#line 50 "reflect.h2"
+#line 1244 "reflect.h2"
     {
 
-#line 56 "reflect.h2"
+#line 1250 "reflect.h2"
     }
 
     //  Common API
     //
-#line 60 "reflect.h2"
     auto compiler_services::set_metafunction_name(cpp2::impl::in<std::string_view> name, cpp2::impl::in<std::vector<std::string>> args) & -> void{
         metafunction_name  = name;
         metafunction_args  = args;
         metafunctions_used = CPP2_UFCS(empty)(args);
     }
 
-#line 66 "reflect.h2"
     [[nodiscard]] auto compiler_services::get_metafunction_name() const& -> std::string_view { return metafunction_name;  }
 
-#line 68 "reflect.h2"
     [[nodiscard]] auto compiler_services::get_argument(cpp2::impl::in<int> index) & -> std::string{
         metafunctions_used = true;
         if (([_0 = 0, _1 = index, _2 = CPP2_UFCS(ssize)(metafunction_args)]{ return cpp2::impl::cmp_less_eq(_0,_1) && cpp2::impl::cmp_less(_1,_2); }())) {
@@ -1551,26 +2780,27 @@ namespace meta {
         return ""; 
     }
 
-#line 76 "reflect.h2"
     [[nodiscard]] auto compiler_services::get_arguments() & -> std::vector<std::string>{
         metafunctions_used = true;
         return metafunction_args; 
     }
 
-#line 81 "reflect.h2"
     [[nodiscard]] auto compiler_services::arguments_were_used() const& -> bool { return metafunctions_used;  }
 
-#line 83 "reflect.h2"
     [[nodiscard]] auto compiler_services::parse_statement(
 
         std::string_view source
     ) & -> parse_statement_ret
 
     {
-            cpp2::impl::deferred_init<std::unique_ptr<statement_node>> ret;
-#line 89 "reflect.h2"
         auto original_source {source}; 
 
+        //  Anchor the text in stable storage first - the source_lines
+        //  and tokens we make below are zero-copy views into it, and
+        //  they outlive the caller's string
+        CPP2_UFCS(push_back)(generated_text, source);
+        source = CPP2_UFCS(back)(generated_text);
+
         CPP2_UFCS(push_back)(generated_lines, std::vector<source_line>());
         auto lines {&CPP2_UFCS(back)(generated_lines)}; 
 
@@ -1583,7 +2813,7 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         //  First split this string into source_lines
         //
 
-#line 101 "reflect.h2"
+#line 1301 "reflect.h2"
         if ( cpp2::impl::cmp_greater(CPP2_UFCS(ssize)(source),1) 
             && newline_pos != source.npos) 
         {
@@ -1596,7 +2826,7 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         }
 }
 
-#line 112 "reflect.h2"
+#line 1312 "reflect.h2"
         if (!(CPP2_UFCS(empty)(source))) {
             cpp2::move(add_line)(cpp2::move(source));
         }
@@ -1612,19 +2842,17 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
 
         //  Now parse this single declaration from
         //  the lexed tokens
-        ret.construct(CPP2_UFCS(parse_one_declaration)(parser, 
+        std::unique_ptr<statement_node> ret {CPP2_UFCS(parse_one_declaration)(parser, 
                 (*cpp2::impl::assert_not_null(CPP2_UFCS(begin)(CPP2_UFCS(get_map)(*cpp2::impl::assert_not_null(cpp2::move(tokens)))))).second, 
                 *cpp2::impl::assert_not_null(generated_tokens)
-              ));
-        if (!(ret.value())) {
+              )};
+        if (!(ret)) {
             error("parse failed - the source string is not a valid statement:\n" + cpp2::to_string(cpp2::move(original_source)) + "");
-        }return std::move(ret.value()); 
+        }return ret; 
     }
 
-#line 136 "reflect.h2"
     [[nodiscard]] auto compiler_services::add_runtime_support_include(cpp2::impl::in<std::string_view> s) & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(emplace)((*cpp2::impl::assert_not_null(includes)), s));  }
 
-#line 138 "reflect.h2"
     [[nodiscard]] auto compiler_services::position() const -> source_position
 
     {
@@ -1634,7 +2862,6 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
     //  Error diagnosis and handling, integrated with compiler output
     //  Unlike a contract violation, .requires continues further processing
     //
-#line 147 "reflect.h2"
     auto compiler_services::require(
 
         cpp2::impl::in<bool> b, 
@@ -1646,12 +2873,11 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         }
     }
 
-#line 158 "reflect.h2"
     auto compiler_services::error(cpp2::impl::in<std::string_view> msg) const& -> void
     {
         auto message {cpp2::impl::as_<std::string>(msg)}; 
         if (!(CPP2_UFCS(empty)(metafunction_name))) {
-            message = "while applying @" + cpp2::to_string(metafunction_name) + " - " + cpp2::to_string(message) + "";
+            message = "while applying @" + cpp2::string_build(cpp2::interp(metafunction_name), " - ", cpp2::interp(message)) + "";
         }
         static_cast<void>(CPP2_UFCS(emplace_back)((*cpp2::impl::assert_not_null(errors)), position(), cpp2::move(message)));
     }
@@ -1659,7 +2885,6 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
     //  Enable custom contracts on this object, integrated with compiler output
     //  Unlike .requires, a contract violation stops further processing
     //
-#line 170 "reflect.h2"
     auto compiler_services::report_violation(auto const& msg) const& -> void{
         error(msg);
         throw(std::runtime_error(
@@ -1668,7 +2893,6 @@ auto newline_pos{CPP2_UFCS(find)(source, '\n')};
         ));
     }
 
-#line 178 "reflect.h2"
     [[nodiscard]] auto compiler_services::is_active() const& -> decltype(auto) { return true;  }
 
     compiler_services::~compiler_services() noexcept{}
@@ -1682,7 +2906,7 @@ compiler_services::compiler_services(compiler_services const& that)
                                 , metafunction_args{ that.metafunction_args }
                                 , metafunctions_used{ that.metafunctions_used }{}
 
-#line 182 "reflect.h2"
+#line 1382 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  All reflection types are wrappers around a pointer to node
@@ -1690,7 +2914,7 @@ compiler_services::compiler_services(compiler_services const& that)
 //-----------------------------------------------------------------------
 //
 
-#line 195 "reflect.h2"
+#line 1395 "reflect.h2"
     template <typename T> reflection_base<T>::reflection_base(
 
         T* n_, 
@@ -1698,17 +2922,15 @@ compiler_services::compiler_services(compiler_services const& that)
     )
         : compiler_services{ s }
         , n{ n_ }
-#line 200 "reflect.h2"
+#line 1400 "reflect.h2"
     {
 
-#line 203 "reflect.h2"
+#line 1403 "reflect.h2"
         if (cpp2::cpp2_default.is_active() && !(n) ) { cpp2::cpp2_default.report_violation(CPP2_CONTRACT_MSG("a meta:: reflection must point to a valid node, not null")); }
     }
 
-#line 206 "reflect.h2"
     template <typename T> [[nodiscard]] auto reflection_base<T>::position() const -> source_position { return CPP2_UFCS(position)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 208 "reflect.h2"
     template <typename T> [[nodiscard]] auto reflection_base<T>::print() const& -> std::string { return CPP2_UFCS(pretty_print_visualize)((*cpp2::impl::assert_not_null(n)), 0);  }
 
     template <typename T> reflection_base<T>::~reflection_base() noexcept{}
@@ -1716,7 +2938,7 @@ template <typename T> reflection_base<T>::reflection_base(reflection_base const&
                                 : compiler_services{ static_cast<compiler_services const&>(that) }
                                 , n{ that.n }{}
 
-#line 212 "reflect.h2"
+#line 1412 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  Declarations
@@ -1728,121 +2950,80 @@ template <typename T> reflection_base<T>::reflection_base(reflection_base const&
 //  All declarations
 //
 
-#line 226 "reflect.h2"
+#line 1426 "reflect.h2"
     declaration::declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<declaration_node>{ n_, s }
-#line 231 "reflect.h2"
+#line 1431 "reflect.h2"
     {
 
     }
 
-#line 235 "reflect.h2"
     [[nodiscard]] auto declaration::is_public() const& -> bool { return CPP2_UFCS(is_public)((*cpp2::impl::assert_not_null(n))); }
-#line 236 "reflect.h2"
     [[nodiscard]] auto declaration::is_protected() const& -> bool { return CPP2_UFCS(is_protected)((*cpp2::impl::assert_not_null(n))); }
-#line 237 "reflect.h2"
     [[nodiscard]] auto declaration::is_private() const& -> bool { return CPP2_UFCS(is_private)((*cpp2::impl::assert_not_null(n))); }
-#line 238 "reflect.h2"
     [[nodiscard]] auto declaration::is_default_access() const& -> bool { return CPP2_UFCS(is_default_access)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 240 "reflect.h2"
     [[nodiscard]] auto declaration::default_to_public() & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(make_public)((*cpp2::impl::assert_not_null(n)))); }
-#line 241 "reflect.h2"
     [[nodiscard]] auto declaration::default_to_protected() & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(make_protected)((*cpp2::impl::assert_not_null(n))));  }
-#line 242 "reflect.h2"
     [[nodiscard]] auto declaration::default_to_private() & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(make_private)((*cpp2::impl::assert_not_null(n)))); }
 
-#line 244 "reflect.h2"
     [[nodiscard]] auto declaration::make_public() & -> bool { return CPP2_UFCS(make_public)((*cpp2::impl::assert_not_null(n))); }
-#line 245 "reflect.h2"
     [[nodiscard]] auto declaration::make_protected() & -> bool { return CPP2_UFCS(make_protected)((*cpp2::impl::assert_not_null(n))); }
-#line 246 "reflect.h2"
     [[nodiscard]] auto declaration::make_private() & -> bool { return CPP2_UFCS(make_private)((*cpp2::impl::assert_not_null(n))); }
 
-#line 248 "reflect.h2"
     [[nodiscard]] auto declaration::has_name() const& -> bool { return CPP2_UFCS(has_name)((*cpp2::impl::assert_not_null(n))); }
-#line 249 "reflect.h2"
     [[nodiscard]] auto declaration::has_name(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_name)((*cpp2::impl::assert_not_null(n)), s); }
 
-#line 251 "reflect.h2"
     [[nodiscard]] auto declaration::name() const& -> std::string_view{
         if (has_name()) {return CPP2_UFCS(as_string_view)((*cpp2::impl::assert_not_null(CPP2_UFCS(name)(*cpp2::impl::assert_not_null(n))))); }
         else          { return ""; }
     }
 
-#line 256 "reflect.h2"
     [[nodiscard]] auto declaration::has_initializer() const& -> bool { return CPP2_UFCS(has_initializer)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 258 "reflect.h2"
     [[nodiscard]] auto declaration::is_global() const& -> bool { return CPP2_UFCS(is_global)((*cpp2::impl::assert_not_null(n))); }
-#line 259 "reflect.h2"
     [[nodiscard]] auto declaration::is_function() const& -> bool { return CPP2_UFCS(is_function)((*cpp2::impl::assert_not_null(n))); }
-#line 260 "reflect.h2"
     [[nodiscard]] auto declaration::is_object() const& -> bool { return CPP2_UFCS(is_object)((*cpp2::impl::assert_not_null(n))); }
-#line 261 "reflect.h2"
     [[nodiscard]] auto declaration::is_base_object() const& -> bool { return CPP2_UFCS(is_base_object)((*cpp2::impl::assert_not_null(n))); }
-#line 262 "reflect.h2"
     [[nodiscard]] auto declaration::is_member_object() const& -> bool { return CPP2_UFCS(is_member_object)((*cpp2::impl::assert_not_null(n)));  }
-#line 263 "reflect.h2"
     [[nodiscard]] auto declaration::is_type() const& -> bool { return CPP2_UFCS(is_type)((*cpp2::impl::assert_not_null(n))); }
-#line 264 "reflect.h2"
     [[nodiscard]] auto declaration::is_namespace() const& -> bool { return CPP2_UFCS(is_namespace)((*cpp2::impl::assert_not_null(n))); }
-#line 265 "reflect.h2"
     [[nodiscard]] auto declaration::is_alias() const& -> bool { return CPP2_UFCS(is_alias)((*cpp2::impl::assert_not_null(n))); }
 
-#line 267 "reflect.h2"
     [[nodiscard]] auto declaration::is_type_alias() const& -> bool { return CPP2_UFCS(is_type_alias)((*cpp2::impl::assert_not_null(n))); }
-#line 268 "reflect.h2"
     [[nodiscard]] auto declaration::is_namespace_alias() const& -> bool { return CPP2_UFCS(is_namespace_alias)((*cpp2::impl::assert_not_null(n)));  }
-#line 269 "reflect.h2"
     [[nodiscard]] auto declaration::is_object_alias() const& -> bool { return CPP2_UFCS(is_object_alias)((*cpp2::impl::assert_not_null(n))); }
 
-#line 271 "reflect.h2"
     [[nodiscard]] auto declaration::is_function_expression() const& -> bool { return CPP2_UFCS(is_function_expression)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 273 "reflect.h2"
     [[nodiscard]] auto declaration::as_function() const& -> function_declaration { return { n, (*this) };  }
-#line 274 "reflect.h2"
     [[nodiscard]] auto declaration::as_object() const& -> object_declaration { return { n, (*this) }; }
-#line 275 "reflect.h2"
     [[nodiscard]] auto declaration::as_type() const& -> type_declaration { return { n, (*this) }; }
-#line 276 "reflect.h2"
     [[nodiscard]] auto declaration::as_alias() const& -> alias_declaration { return { n, (*this) }; }
 
-#line 278 "reflect.h2"
     [[nodiscard]] auto declaration::get_parent() const& -> declaration { return declaration((*cpp2::impl::assert_not_null(n)).parent_declaration, (*this)); }
 
-#line 280 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_function() const& -> bool { return CPP2_UFCS(parent_is_function)((*cpp2::impl::assert_not_null(n))); }
-#line 281 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_object() const& -> bool { return CPP2_UFCS(parent_is_object)((*cpp2::impl::assert_not_null(n))); }
-#line 282 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_type() const& -> bool { return CPP2_UFCS(parent_is_type)((*cpp2::impl::assert_not_null(n))); }
-#line 283 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_namespace() const& -> bool { return CPP2_UFCS(parent_is_namespace)((*cpp2::impl::assert_not_null(n))); }
-#line 284 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_alias() const& -> bool { return CPP2_UFCS(parent_is_alias)((*cpp2::impl::assert_not_null(n))); }
 
-#line 286 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_type_alias() const& -> bool { return CPP2_UFCS(parent_is_type_alias)((*cpp2::impl::assert_not_null(n))); }
-#line 287 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_namespace_alias() const& -> bool { return CPP2_UFCS(parent_is_namespace_alias)((*cpp2::impl::assert_not_null(n)));  }
-#line 288 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_object_alias() const& -> bool { return CPP2_UFCS(parent_is_object_alias)((*cpp2::impl::assert_not_null(n))); }
 
-#line 290 "reflect.h2"
     [[nodiscard]] auto declaration::parent_is_polymorphic() const& -> bool { return CPP2_UFCS(parent_is_polymorphic)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 292 "reflect.h2"
     auto declaration::mark_for_removal_from_enclosing_type() & -> void
                                                     // this precondition should be sufficient ...
     {
         if (cpp2::type_safety.is_active() && !(parent_is_type()) ) { cpp2::type_safety.report_violation(""); }
-#line 295 "reflect.h2"
+#line 1495 "reflect.h2"
         auto test {CPP2_UFCS(type_member_mark_for_removal)((*cpp2::impl::assert_not_null(n)))}; 
         if (cpp2::cpp2_default.is_active() && !(cpp2::move(test)) ) { cpp2::cpp2_default.report_violation(""); }// ... to ensure this assert is true
     }
@@ -1851,105 +3032,68 @@ template <typename T> reflection_base<T>::reflection_base(reflection_base const&
 declaration::declaration(declaration const& that)
                                 : reflection_base<declaration_node>{ static_cast<reflection_base<declaration_node> const&>(that) }{}
 
-#line 301 "reflect.h2"
+#line 1501 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Function declarations
 //
 
-#line 308 "reflect.h2"
+#line 1508 "reflect.h2"
     function_declaration::function_declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     )
         : declaration{ n_, s }
-#line 313 "reflect.h2"
+#line 1513 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_function)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
     }
 
-#line 318 "reflect.h2"
     [[nodiscard]] auto function_declaration::index_of_parameter_named(cpp2::impl::in<std::string_view> s) const& -> int { return CPP2_UFCS(index_of_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 319 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 320 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_in_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_in_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 321 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_in_ref_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_in_ref_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 322 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_copy_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_copy_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 323 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_inout_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_inout_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 324 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_out_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_out_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 325 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_move_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_move_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 326 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_forward_parameter_named(cpp2::impl::in<std::string_view> s) const& -> bool { return CPP2_UFCS(has_forward_parameter_named)((*cpp2::impl::assert_not_null(n)), s); }
-#line 327 "reflect.h2"
     [[nodiscard]] auto function_declaration::first_parameter_name() const& -> std::string { return CPP2_UFCS(first_parameter_name)((*cpp2::impl::assert_not_null(n))); }
 
-#line 329 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_parameter_with_name_and_pass(cpp2::impl::in<std::string_view> s, cpp2::impl::in<passing_style> pass) const& -> bool { 
                                                   return CPP2_UFCS(has_parameter_with_name_and_pass)((*cpp2::impl::assert_not_null(n)), s, pass);  }
-#line 331 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_function_with_this() const& -> bool { return CPP2_UFCS(is_function_with_this)((*cpp2::impl::assert_not_null(n))); }
-#line 332 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_virtual() const& -> bool { return CPP2_UFCS(is_virtual_function)((*cpp2::impl::assert_not_null(n))); }
-#line 333 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_defaultable() const& -> bool { return CPP2_UFCS(is_defaultable_function)((*cpp2::impl::assert_not_null(n))); }
-#line 334 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_constructor() const& -> bool { return CPP2_UFCS(is_constructor)((*cpp2::impl::assert_not_null(n))); }
-#line 335 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_default_constructor() const& -> bool { return CPP2_UFCS(is_default_constructor)((*cpp2::impl::assert_not_null(n))); }
-#line 336 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_move() const& -> bool { return CPP2_UFCS(is_move)((*cpp2::impl::assert_not_null(n))); }
-#line 337 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_swap() const& -> bool { return CPP2_UFCS(is_swap)((*cpp2::impl::assert_not_null(n))); }
-#line 338 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_constructor_with_that() const& -> bool { return CPP2_UFCS(is_constructor_with_that)((*cpp2::impl::assert_not_null(n))); }
-#line 339 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_constructor_with_in_that() const& -> bool { return CPP2_UFCS(is_constructor_with_in_that)((*cpp2::impl::assert_not_null(n))); }
-#line 340 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_constructor_with_move_that() const& -> bool { return CPP2_UFCS(is_constructor_with_move_that)((*cpp2::impl::assert_not_null(n)));  }
-#line 341 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_assignment() const& -> bool { return CPP2_UFCS(is_assignment)((*cpp2::impl::assert_not_null(n))); }
-#line 342 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_assignment_with_that() const& -> bool { return CPP2_UFCS(is_assignment_with_that)((*cpp2::impl::assert_not_null(n))); }
-#line 343 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_assignment_with_in_that() const& -> bool { return CPP2_UFCS(is_assignment_with_in_that)((*cpp2::impl::assert_not_null(n))); }
-#line 344 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_assignment_with_move_that() const& -> bool { return CPP2_UFCS(is_assignment_with_move_that)((*cpp2::impl::assert_not_null(n)));  }
-#line 345 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_destructor() const& -> bool { return CPP2_UFCS(is_destructor)((*cpp2::impl::assert_not_null(n))); }
 
-#line 347 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_copy_or_move() const& -> bool { return is_constructor_with_that() || is_assignment_with_that(); }
 
-#line 349 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_declared_return_type() const& -> bool { return CPP2_UFCS(has_declared_return_type)((*cpp2::impl::assert_not_null(n))); }
-#line 350 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_deduced_return_type() const& -> bool { return CPP2_UFCS(has_deduced_return_type)((*cpp2::impl::assert_not_null(n))); }
-#line 351 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_bool_return_type() const& -> bool { return CPP2_UFCS(has_bool_return_type)((*cpp2::impl::assert_not_null(n))); }
-#line 352 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_non_void_return_type() const& -> bool { return CPP2_UFCS(has_non_void_return_type)((*cpp2::impl::assert_not_null(n))); }
 
-#line 354 "reflect.h2"
     [[nodiscard]] auto function_declaration::has_compound_body() const& -> bool { return CPP2_UFCS(is_function_with_compound_body)((*cpp2::impl::assert_not_null(n))); }
-#line 355 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_compound_body() const& -> compound_statement { return { CPP2_UFCS(get_compound_initializer)((*cpp2::impl::assert_not_null(n))), (*this) }; }
 
-#line 357 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_unnamed_return_type() const& -> std::string { return CPP2_UFCS(unnamed_return_type_to_string)((*cpp2::impl::assert_not_null(n))); }
-#line 358 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_signature() const& -> std::string { return CPP2_UFCS(signature_to_string)((*cpp2::impl::assert_not_null(n))); }
 
-#line 360 "reflect.h2"
     [[nodiscard]] auto function_declaration::is_binary_comparison_function() const& -> bool { return CPP2_UFCS(is_binary_comparison_function)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 362 "reflect.h2"
     [[nodiscard]] auto function_declaration::get_parameters() const& -> std::vector<object_declaration>
 
     {
@@ -1962,20 +3106,17 @@ declaration::declaration(declaration const& that)
 
     //  Modifying operations
     //
-#line 374 "reflect.h2"
     [[nodiscard]] auto function_declaration::default_to_virtual() & -> decltype(auto) { return static_cast<void>(CPP2_UFCS(make_function_virtual)((*cpp2::impl::assert_not_null(n)))); }
 
-#line 376 "reflect.h2"
     [[nodiscard]] auto function_declaration::make_virtual() & -> bool { return CPP2_UFCS(make_function_virtual)((*cpp2::impl::assert_not_null(n))); }
 
-#line 378 "reflect.h2"
     auto function_declaration::add_initializer(cpp2::impl::in<std::string_view> source) & -> void
 
-#line 381 "reflect.h2"
+#line 1581 "reflect.h2"
     {
         if ((*this).is_active() && !(!(has_initializer())) ) { (*this).report_violation(CPP2_CONTRACT_MSG("cannot add an initializer to a function that already has one")); }
         if ((*this).is_active() && !(parent_is_type()) ) { (*this).report_violation(CPP2_CONTRACT_MSG("cannot add an initializer to a function that isn't in a type scope")); }
-#line 382 "reflect.h2"
+#line 1582 "reflect.h2"
         auto stmt {parse_statement(source)}; 
         if (!((cpp2::impl::as_<bool>(stmt)))) {
             error("cannot add an initializer that is not a valid statement");
@@ -1988,30 +3129,27 @@ declaration::declaration(declaration const& that)
     function_declaration::function_declaration(function_declaration const& that)
                                 : declaration{ static_cast<declaration const&>(that) }{}
 
-#line 393 "reflect.h2"
+#line 1593 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Object declarations
 //
 
-#line 400 "reflect.h2"
+#line 1600 "reflect.h2"
     object_declaration::object_declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     )
         : declaration{ n_, s }
-#line 405 "reflect.h2"
+#line 1605 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_object)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
     }
 
-#line 410 "reflect.h2"
     [[nodiscard]] auto object_declaration::is_const() const& -> bool { return CPP2_UFCS(is_const)((*cpp2::impl::assert_not_null(n))); }
-#line 411 "reflect.h2"
     [[nodiscard]] auto object_declaration::has_wildcard_type() const& -> bool { return CPP2_UFCS(has_wildcard_type)((*cpp2::impl::assert_not_null(n)));  }
 
-#line 413 "reflect.h2"
     [[nodiscard]] auto object_declaration::type() const& -> std::string{
         auto ret {CPP2_UFCS(object_type)((*cpp2::impl::assert_not_null(n)))}; 
         require(!(contains(ret, "(*ERROR*)")), 
@@ -2019,7 +3157,6 @@ declaration::declaration(declaration const& that)
         return ret; 
     }
 
-#line 420 "reflect.h2"
     [[nodiscard]] auto object_declaration::initializer() const& -> std::string{
         auto ret {CPP2_UFCS(object_initializer)((*cpp2::impl::assert_not_null(n)))}; 
         require(!(contains(ret, "(*ERROR*)")), 
@@ -2029,32 +3166,35 @@ declaration::declaration(declaration const& that)
 
     object_declaration::object_declaration(object_declaration const& that)
                                 : declaration{ static_cast<declaration const&>(that) }{}
+value_member_info::value_member_info(auto const& name_, auto const& type_, auto const& value_)
+                                                               : name{ name_ }
+                                                               , type{ type_ }
+                                                               , value{ value_ }{}
 
-#line 429 "reflect.h2"
+#line 1629 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Type declarations
 //
 
-#line 436 "reflect.h2"
+#line 1642 "reflect.h2"
     type_declaration::type_declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     )
         : declaration{ n_, s }
-#line 441 "reflect.h2"
+#line 1647 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_type)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
     }
 
-#line 446 "reflect.h2"
     auto type_declaration::reserve_names(cpp2::impl::in<std::string_view> name, auto&& ...etc) const& -> void
     {                           // etc is not declared ':string_view' for compatibility with GCC 10.x
         for ( 
-             auto const& m : get_members() ) {
-            CPP2_UFCS(require)(m, !(CPP2_UFCS(has_name)(m, name)), 
-                       "in a '" + cpp2::to_string(get_metafunction_name()) + "' type, the name '" + cpp2::to_string(name) + "' "
+             auto const& m : get_members_named(name) ) {
+            CPP2_UFCS(require)(m, false, 
+                       "in a '" + cpp2::string_build(cpp2::interp(get_metafunction_name()), "' type, the name '", cpp2::interp(name)) + "' "
                        "is reserved for use by the '" + cpp2::to_string(get_metafunction_name()) + "' implementation"
             );
         }
@@ -2063,14 +3203,10 @@ declaration::declaration(declaration const& that)
         }
     }
 
-#line 460 "reflect.h2"
     [[nodiscard]] auto type_declaration::is_polymorphic() const& -> bool { return CPP2_UFCS(is_polymorphic)((*cpp2::impl::assert_not_null(n))); }
-#line 461 "reflect.h2"
     [[nodiscard]] auto type_declaration::is_final() const& -> bool { return CPP2_UFCS(is_type_final)((*cpp2::impl::assert_not_null(n))); }
-#line 462 "reflect.h2"
     [[nodiscard]] auto type_declaration::make_final() & -> bool { return CPP2_UFCS(make_type_final)((*cpp2::impl::assert_not_null(n))); }
 
-#line 464 "reflect.h2"
     [[nodiscard]] auto type_declaration::get_member_functions() const& -> std::vector<function_declaration>
 
     {
@@ -2082,7 +3218,6 @@ declaration::declaration(declaration const& that)
         return ret; 
     }
 
-#line 475 "reflect.h2"
     [[nodiscard]] auto type_declaration::get_member_functions_needing_initializer() const& -> std::vector<function_declaration>
 
     {
@@ -2098,7 +3233,6 @@ declaration::declaration(declaration const& that)
         return ret; 
     }
 
-#line 490 "reflect.h2"
     [[nodiscard]] auto type_declaration::get_member_objects() const& -> std::vector<object_declaration>
 
     {
@@ -2109,7 +3243,24 @@ declaration::declaration(declaration const& that)
         return ret; 
     }
 
-#line 500 "reflect.h2"
+    //  get_member_object_infos: a batched snapshot of the member
+    //  objects with their name, type, and initializer text already
+    //  materialized (in value_member_info.name/type/value), so a
+    //  metafunction that needs those strings walks the type scope and
+    //  serializes each declaration once, instead of once per query
+    //
+    [[nodiscard]] auto type_declaration::get_member_object_infos() const& -> std::vector<value_member_info>
+
+    {
+        std::vector<value_member_info> ret {}; 
+        for ( auto const& mo : get_member_objects() ) {
+            //  Adding local variable 'e' to work around a Clang warning
+            value_member_info e {cpp2::impl::as_<std::string>(CPP2_UFCS(name)(mo)), CPP2_UFCS(type)(mo), CPP2_UFCS(initializer)(mo)}; 
+            CPP2_UFCS(push_back)(ret, cpp2::move(e));
+        }
+        return ret; 
+    }
+
     [[nodiscard]] auto type_declaration::get_member_types() const& -> std::vector<type_declaration>
 
     {
@@ -2120,7 +3271,6 @@ declaration::declaration(declaration const& that)
         return ret; 
     }
 
-#line 510 "reflect.h2"
     [[nodiscard]] auto type_declaration::get_member_aliases() const& -> std::vector<alias_declaration>
 
     {
@@ -2131,7 +3281,6 @@ declaration::declaration(declaration const& that)
         return ret; 
     }
 
-#line 520 "reflect.h2"
     [[nodiscard]] auto type_declaration::get_members() const& -> std::vector<declaration>
 
     {
@@ -2142,16 +3291,30 @@ declaration::declaration(declaration const& that)
         return ret; 
     }
 
-#line 530 "reflect.h2"
+    //  get_members_named: just the members with the given name, answered
+    //  from the type's by-name index instead of filtering get_members() -
+    //  several metafunctions stacked on one type each probe a handful of
+    //  reserved names, and those probes shouldn't rescan every member
+    //
+    [[nodiscard]] auto type_declaration::get_members_named(cpp2::impl::in<std::string_view> name) const& -> std::vector<declaration>
+
+    {
+        std::vector<declaration> ret {}; 
+        for ( auto const& d : CPP2_UFCS(get_type_scope_declarations_named)((*cpp2::impl::assert_not_null(n)), name) ) {
+            static_cast<void>(CPP2_UFCS(emplace_back)(ret, d, (*this)));
+        }
+        return ret; 
+    }
+
     [[nodiscard]] auto type_declaration::query_declared_value_set_functions() const& -> query_declared_value_set_functions_ret
 
-#line 537 "reflect.h2"
+#line 1776 "reflect.h2"
     {
             cpp2::impl::deferred_init<bool> out_this_in_that;
             cpp2::impl::deferred_init<bool> out_this_move_that;
             cpp2::impl::deferred_init<bool> inout_this_in_that;
             cpp2::impl::deferred_init<bool> inout_this_move_that;
-#line 538 "reflect.h2"
+#line 1777 "reflect.h2"
         auto declared {CPP2_UFCS(find_declared_value_set_functions)((*cpp2::impl::assert_not_null(n)))}; 
         out_this_in_that.construct(declared.out_this_in_that != nullptr);
         out_this_move_that.construct(declared.out_this_move_that != nullptr);
@@ -2160,7 +3323,6 @@ declaration::declaration(declaration const& that)
         return  { std::move(out_this_in_that.value()), std::move(out_this_move_that.value()), std::move(inout_this_in_that.value()), std::move(inout_this_move_that.value()) }; // NOLINT(performance-move-const-arg)
     }
 
-#line 546 "reflect.h2"
     auto type_declaration::add_member(cpp2::impl::in<std::string_view> source) & -> void
     {
         auto decl {parse_statement(source)}; 
@@ -2175,30 +3337,27 @@ declaration::declaration(declaration const& that)
                  std::string("unexpected error while attempting to add member:\n") + source);
     }
 
-#line 560 "reflect.h2"
     [[nodiscard]] auto type_declaration::remove_marked_members() & -> decltype(auto) { return CPP2_UFCS(type_remove_marked_members)((*cpp2::impl::assert_not_null(n)));  }
-#line 561 "reflect.h2"
     [[nodiscard]] auto type_declaration::remove_all_members() & -> decltype(auto) { return CPP2_UFCS(type_remove_all_members)((*cpp2::impl::assert_not_null(n))); }
 
-#line 563 "reflect.h2"
     [[nodiscard]] auto type_declaration::disable_member_function_generation() & -> decltype(auto) { return CPP2_UFCS(type_disable_member_function_generation)((*cpp2::impl::assert_not_null(n)));  }
 
     type_declaration::type_declaration(type_declaration const& that)
                                 : declaration{ static_cast<declaration const&>(that) }{}
 
-#line 567 "reflect.h2"
+#line 1806 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Alias declarations
 //
 
-#line 574 "reflect.h2"
+#line 1813 "reflect.h2"
     alias_declaration::alias_declaration(
 
         declaration_node* n_, 
         cpp2::impl::in<compiler_services> s
     )
         : declaration{ n_, s }
-#line 579 "reflect.h2"
+#line 1818 "reflect.h2"
     {
 
         if (cpp2::cpp2_default.is_active() && !(CPP2_UFCS(is_alias)((*cpp2::impl::assert_not_null(n)))) ) { cpp2::cpp2_default.report_violation(""); }
@@ -2207,7 +3366,7 @@ declaration::declaration(declaration const& that)
     alias_declaration::alias_declaration(alias_declaration const& that)
                                 : declaration{ static_cast<declaration const&>(that) }{}
 
-#line 586 "reflect.h2"
+#line 1825 "reflect.h2"
 //-----------------------------------------------------------------------
 // 
 //  Statements
@@ -2219,41 +3378,30 @@ declaration::declaration(declaration const& that)
 //  General statement
 //
 
-#line 600 "reflect.h2"
+#line 1839 "reflect.h2"
     statement::statement(
 
         statement_node* n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<statement_node>{ n_, s }
-#line 605 "reflect.h2"
+#line 1844 "reflect.h2"
     {
 
     }
 
-#line 609 "reflect.h2"
     [[nodiscard]] auto statement::is_expression_statement() const& -> bool { return CPP2_UFCS(is_expression)((*cpp2::impl::assert_not_null(n)));  }
-#line 610 "reflect.h2"
     [[nodiscard]] auto statement::is_compound_statement() const& -> bool { return CPP2_UFCS(is_compound)((*cpp2::impl::assert_not_null(n))); }
-#line 611 "reflect.h2"
     [[nodiscard]] auto statement::is_selection_statement() const& -> bool { return CPP2_UFCS(is_selection)((*cpp2::impl::assert_not_null(n))); }
-#line 612 "reflect.h2"
     [[nodiscard]] auto statement::is_declaration_statement() const& -> bool { return CPP2_UFCS(is_declaration)((*cpp2::impl::assert_not_null(n)));  }
-#line 613 "reflect.h2"
     [[nodiscard]] auto statement::is_return_statement() const& -> bool { return CPP2_UFCS(is_return)((*cpp2::impl::assert_not_null(n))); }
-#line 614 "reflect.h2"
     [[nodiscard]] auto statement::is_iteration_statement() const& -> bool { return CPP2_UFCS(is_iteration)((*cpp2::impl::assert_not_null(n))); }
-#line 615 "reflect.h2"
     [[nodiscard]] auto statement::is_using_statement() const& -> bool { return CPP2_UFCS(is_using)((*cpp2::impl::assert_not_null(n))); }
-#line 616 "reflect.h2"
     [[nodiscard]] auto statement::is_contract() const& -> bool { return CPP2_UFCS(is_contract)((*cpp2::impl::assert_not_null(n))); }
-#line 617 "reflect.h2"
     [[nodiscard]] auto statement::is_inspect_expression() const& -> bool { return CPP2_UFCS(is_inspect)((*cpp2::impl::assert_not_null(n))); }
-#line 618 "reflect.h2"
     [[nodiscard]] auto statement::is_jump_statement() const& -> bool { return CPP2_UFCS(is_jump)((*cpp2::impl::assert_not_null(n))); }
 
     //as_expression_statement : (this) -> expression_statement  = expression_statement (n*.get_if<expression_statement_node>(), this);
-#line 621 "reflect.h2"
     [[nodiscard]] auto statement::as_compound_statement() const& -> compound_statement { return { CPP2_UFCS_TEMPLATE(get_if<compound_statement_node>)((*cpp2::impl::assert_not_null(n))), (*this) }; }
     //as_selection_statement  : (this) -> selection_statement   = selection_statement  (n*.get_if<selection_statement_node>(), this);
     //as_declaration_statement: (this) -> declaration_statement = declaration_statement(n*.get_if<declaration_statement_node>(), this);
@@ -2264,31 +3412,29 @@ declaration::declaration(declaration const& that)
     //as_inspect_expression   : (this) -> inspect_expression    = inspect_expression   (n*.get_if<inspect_expression_node>(), this);
     //as_jump_statement       : (this) -> jump_statement        = jump_statement       (n*.get_if<jump_statement_node>(), this);
 
-#line 631 "reflect.h2"
     [[nodiscard]] auto statement::to_string() const& -> std::string { return CPP2_UFCS(to_string)((*cpp2::impl::assert_not_null(n))); }
 
     statement::~statement() noexcept{}
 statement::statement(statement const& that)
                                 : reflection_base<statement_node>{ static_cast<reflection_base<statement_node> const&>(that) }{}
 
-#line 635 "reflect.h2"
+#line 1874 "reflect.h2"
 //-----------------------------------------------------------------------
 //  Compound statements
 //
 
-#line 642 "reflect.h2"
+#line 1881 "reflect.h2"
     compound_statement::compound_statement(
 
         compound_statement_node* n_, 
         cpp2::impl::in<compiler_services> s
     )
         : reflection_base<compound_statement_node>{ n_, s }
-#line 647 "reflect.h2"
+#line 1886 "reflect.h2"
     {
 
     }
 
-#line 651 "reflect.h2"
     [[nodiscard]] auto compound_statement::get_statements() const& -> std::vector<statement>
 
     {
@@ -2299,7 +3445,6 @@ statement::statement(statement const& that)
         return ret; 
     }
 
-#line 661 "reflect.h2"
     auto compound_statement::add_statement(cpp2::impl::in<std::string_view> source, cpp2::impl::in<int> before_position) & -> void
     {
         auto stmt {parse_statement(source)}; 
@@ -2314,7 +3459,7 @@ statement::statement(statement const& that)
     compound_statement::compound_statement(compound_statement const& that)
                                 : reflection_base<compound_statement_node>{ static_cast<reflection_base<compound_statement_node> const&>(that) }{}
 
-#line 674 "reflect.h2"
+#line 1913 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  Metafunctions - these are hardwired for now until we get to the
@@ -2327,13 +3472,12 @@ statement::statement(statement const& that)
 //  Some common metafunction helpers (metafunctions are just functions,
 //  so they can be factored as usual)
 //
-#line 686 "reflect.h2"
 auto add_virtual_destructor(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(add_member)(t, "operator=: (virtual move this) = { }");
 }
 
-#line 692 "reflect.h2"
+#line 1931 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //      "... an abstract base class defines an interface ..."
@@ -2346,9 +3490,28 @@ auto add_virtual_destructor(meta::type_declaration& t) -> void
 //
 //  an abstract base class having only pure virtual functions
 //
-#line 704 "reflect.h2"
+//  @interface<sealed, impl1, impl2, ...> additionally records that the
+//  listed types are this interface's only implementors, and emits a
+//  static visit() that dispatches with a short 'is' chain and direct
+//  calls to the concrete type - calls the inliner can see through,
+//  which virtual dispatch defeats. The list can name types declared
+//  later in the file, thanks to the usual declaration/definition phase
+//  split. @fast_rtti on the hierarchy turns each 'is' test into two
+//  integer comparisons, and 'final' implementors make the visitor
+//  calls fully inlinable.
+//
 auto interface(meta::type_declaration& t) -> void
 {
+    auto args {CPP2_UFCS(get_arguments)(t)}; 
+
+    auto sealed {!(args.empty()) && CPP2_ASSERT_IN_BOUNDS_LITERAL(args, 0) == "sealed"}; 
+    if (!(sealed) && !(args.empty())) {
+        CPP2_UFCS(error)(t, "unknown interface metafunction argument '" + CPP2_ASSERT_IN_BOUNDS_LITERAL(args, 0) + "' - did you mean 'sealed'?");
+    }
+    if (sealed && cpp2::impl::cmp_less(CPP2_UFCS(ssize)(args),2)) {
+        CPP2_UFCS(error)(t, "@interface<sealed> must also list every implementor type, e.g. @interface<sealed, circle, square>");
+    }
+
     auto has_dtor {false}; 
 
     for ( auto& m : CPP2_UFCS(get_members)(t) ) 
@@ -2371,9 +3534,26 @@ auto interface(meta::type_declaration& t) -> void
     if (!(cpp2::move(has_dtor))) {
         CPP2_UFCS(add_virtual_destructor)(t);
     }
+
+    if (cpp2::move(sealed) && cpp2::impl::cmp_greater(CPP2_UFCS(ssize)(args),1)) 
+    {
+        //  The hierarchy is closed, so dispatch can test each implementor
+        //  in turn and hand the visitor the concrete type. The last one
+        //  is the unconditional fallback: in a sealed hierarchy some
+        //  listed implementor must match, and 'as' diagnoses it if a type
+        //  outside the list shows up anyway
+        //
+        std::string visit {"public visit: <Visitor> (inout obj: " + cpp2::to_string(CPP2_UFCS(name)(t)) + ", forward v: Visitor) -> _ = {\n"}; 
+        auto i {1}; 
+        for( ; cpp2::impl::cmp_less(i,CPP2_UFCS(ssize)(args) - 1); ++i ) {
+            visit += "    if obj is " + cpp2::string_build(cpp2::interp(CPP2_ASSERT_IN_BOUNDS(args, i)), " { return v(obj as ", cpp2::interp(CPP2_ASSERT_IN_BOUNDS(args, i))) + "); }\n";
+        }
+        visit += "    return v(obj as " + cpp2::to_string(CPP2_ASSERT_IN_BOUNDS(args, CPP2_UFCS(ssize)(cpp2::move(args)) - 1)) + ");\n}";
+        CPP2_UFCS(add_member)(t, cpp2::move(visit));
+    }
 }
 
-#line 731 "reflect.h2"
+#line 2007 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "C.35: A base class destructor should be either public and
@@ -2393,7 +3573,6 @@ auto interface(meta::type_declaration& t) -> void
 //
 //  Unlike an interface, it can have nonpublic and nonvirtual functions.
 //
-#line 750 "reflect.h2"
 auto polymorphic_base(meta::type_declaration& t) -> void
 {
     auto has_dtor {false}; 
@@ -2418,7 +3597,42 @@ auto polymorphic_base(meta::type_declaration& t) -> void
     }
 }
 
-#line 775 "reflect.h2"
+#line 2051 "reflect.h2"
+//-----------------------------------------------------------------------
+//
+//  fast_rtti
+//
+//  Opts the type into the cpp2::fast_rtti registry: it gets a dense
+//  preorder type id, registered under its (single) base on first use,
+//  and the is/as customizations in cpp2util.h then answer down-cast
+//  queries with two integer comparisons instead of a dynamic_cast.
+//  Apply it to every type in the hierarchy, starting at the root;
+//  types only work with single inheritance, which is checked here.
+//
+//-----------------------------------------------------------------------
+//
+auto fast_rtti(meta::type_declaration& t) -> void
+{
+    std::string base {"void"}; 
+    auto base_count {0}; 
+
+    for ( auto const& o : CPP2_UFCS(get_member_objects)(t) ) {
+        if (CPP2_UFCS(name)(o) == "this") {
+            ++base_count;
+            base = CPP2_UFCS(type)(o);
+        }
+    }
+
+    CPP2_UFCS(require)(t, cpp2::impl::cmp_less_eq(base_count,1), 
+               "fast_rtti requires single inheritance - this type has " + cpp2::to_string(base_count) + " base classes");
+
+    auto n {CPP2_UFCS(name)(t)}; 
+    CPP2_UFCS(add_member)(t, "public cpp2_fast_rtti_self: type == " + cpp2::to_string(n) + ";");
+    CPP2_UFCS(add_member)(t, "public cpp2_fast_rtti_static_node: () -> *cpp2::fast_rtti::type_node = cpp2::fast_rtti::node_of<" + cpp2::string_build(cpp2::interp(n), ", ", cpp2::interp(cpp2::move(base))) + ">();");
+    CPP2_UFCS(add_member)(t, "public cpp2_fast_rtti_node: (virtual this) -> *cpp2::fast_rtti::type_node = " + cpp2::to_string(cpp2::move(n)) + "::cpp2_fast_rtti_static_node();");
+}
+
+#line 2086 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "... A totally ordered type ... requires operator<=> that
@@ -2439,7 +3653,6 @@ auto polymorphic_base(meta::type_declaration& t) -> void
 //-----------------------------------------------------------------------
 //
 
-#line 795 "reflect.h2"
 auto ordered_impl(
     meta::type_declaration& t, 
     cpp2::impl::in<std::string_view> ordering// must be "strong_ordering" etc.
@@ -2469,7 +3682,6 @@ auto ordered_impl(
 //
 //  Note: the ordering that should be encouraged as default gets the nice name
 //
-#line 824 "reflect.h2"
 auto ordered(meta::type_declaration& t) -> void
 {
     ordered_impl(t, "strong_ordering");
@@ -2478,7 +3690,6 @@ auto ordered(meta::type_declaration& t) -> void
 //-----------------------------------------------------------------------
 //  weakly_ordered - a weakly ordered type
 //
-#line 832 "reflect.h2"
 auto weakly_ordered(meta::type_declaration& t) -> void
 {
     ordered_impl(t, "weak_ordering");
@@ -2487,13 +3698,12 @@ auto weakly_ordered(meta::type_declaration& t) -> void
 //-----------------------------------------------------------------------
 //  partially_ordered - a partially ordered type
 //
-#line 840 "reflect.h2"
 auto partially_ordered(meta::type_declaration& t) -> void
 {
     ordered_impl(t, "partial_ordering");
 }
 
-#line 846 "reflect.h2"
+#line 2157 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "A value is ... a regular type. It must have all public
@@ -2510,7 +3720,6 @@ auto partially_ordered(meta::type_declaration& t) -> void
 //
 //  A type with (copy and move) x (construction and assignment)
 //
-#line 862 "reflect.h2"
 auto copyable(meta::type_declaration& t) -> void
 {
     //  If the user explicitly wrote any of the copy/move functions,
@@ -2544,24 +3753,35 @@ auto copyable(meta::type_declaration& t) -> void
 //
 //  A memberwise hashable type
 //
-#line 895 "reflect.h2"
+//  When the type's equal values are guaranteed to have equal bytes
+//  (std::has_unique_object_representations_v - no padding, no floats,
+//  nothing polymorphic), the generated hash takes one pass over the
+//  object's representation instead of combining member by member, which
+//  the optimizer can vectorize. Selected with if constexpr, so the
+//  memberwise path still covers everything else
+//
 auto hashable(meta::type_declaration& t) -> void
 {
-    CPP2_UFCS(require)(t, !(CPP2_UFCS(empty)(CPP2_UFCS(get_member_objects)(t))), 
+    auto members {CPP2_UFCS(get_member_object_infos)(t)}; 
+
+    CPP2_UFCS(require)(t, !(CPP2_UFCS(empty)(members)), 
                "a hashable type must have at least one data member");
 
     std::string hash {"    hash: (this) -> size_t = {\n"
+                        "        if constexpr std::has_unique_object_representations_v<" + cpp2::to_string(CPP2_UFCS(name)(t)) + "> {\n"
+                        "            return cpp2::hash_bytes(this);\n"
+                        "        }\n"
                         "        ret: size_t = 0;"}; 
 
     for ( 
-          auto const& o : CPP2_UFCS(get_member_objects)(t) ) 
+          auto const& o : cpp2::move(members) ) 
     {
         cpp2::impl::deferred_init<std::string> o_hash; 
-        if (CPP2_UFCS(name)(o) == "this") {
-            o_hash.construct("" + cpp2::to_string(CPP2_UFCS(type)(o)) + "::hash()");
+        if (o.name == "this") {
+            o_hash.construct("" + cpp2::to_string(o.type) + "::hash()");
         }
         else {
-            o_hash.construct("std::hash<" + cpp2::to_string(CPP2_UFCS(type)(o)) + ">()(" + cpp2::to_string(CPP2_UFCS(name)(o)) + ")");
+            o_hash.construct("std::hash<" + cpp2::string_build(cpp2::interp(o.type), ">()(", cpp2::interp(o.name)) + ")");
         }
 
         hash += "\n        cpp2::hash_combine( ret, " + cpp2::to_string(cpp2::move(o_hash.value())) + " );";
@@ -2570,7 +3790,7 @@ auto hashable(meta::type_declaration& t) -> void
     CPP2_UFCS(add_member)(t, cpp2::move(hash) + "\n        return ret;\n    }");
 }
 
-#line 921 "reflect.h2"
+#line 2244 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  basic_value
@@ -2578,7 +3798,6 @@ auto hashable(meta::type_declaration& t) -> void
 //  A regular type: copyable, plus has public default construction
 //  and no protected or virtual functions
 //
-#line 928 "reflect.h2"
 auto basic_value(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(copyable)(t);
@@ -2607,28 +3826,25 @@ auto basic_value(meta::type_declaration& t) -> void
 //
 //  Note: the ordering that should be encouraged as default gets the nice name
 //
-#line 956 "reflect.h2"
 auto value(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(ordered)(t);
     CPP2_UFCS(basic_value)(t);
 }
 
-#line 962 "reflect.h2"
 auto weakly_ordered_value(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(weakly_ordered)(t);
     CPP2_UFCS(basic_value)(t);
 }
 
-#line 968 "reflect.h2"
 auto partially_ordered_value(meta::type_declaration& t) -> void
 {
     CPP2_UFCS(partially_ordered)(t);
     CPP2_UFCS(basic_value)(t);
 }
 
-#line 975 "reflect.h2"
+#line 2298 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     C.20: If you can avoid defining default operations, do
@@ -2651,7 +3867,6 @@ auto partially_ordered_value(meta::type_declaration& t) -> void
 //
 //  a type without declared copy/move/destructor functions
 //
-#line 997 "reflect.h2"
 auto cpp1_rule_of_zero(meta::type_declaration& t) -> void
 {
     for ( auto& mf : CPP2_UFCS(get_member_functions)(t) ) 
@@ -2694,7 +3909,6 @@ auto cpp1_rule_of_zero(meta::type_declaration& t) -> void
 //  parameters instead of concrete forwarding parameters (mainly used
 //  for cppfront internal use, so cppfront builds under GCC 10)
 //
-#line 1039 "reflect.h2"
 auto cpp2_struct(meta::type_declaration& t) -> void
 {
     std::string ctor_params {}; 
@@ -2720,12 +3934,12 @@ auto cpp2_struct(meta::type_declaration& t) -> void
                     ctor_params += "" + cpp2::to_string(CPP2_UFCS(name)(mo)) + "_, ";
                 }
                 else {
-                    ctor_params += "forward " + cpp2::to_string(CPP2_UFCS(name)(mo)) + "_ : " + cpp2::to_string(CPP2_UFCS(type)(mo)) + ", ";
+                    ctor_params += "forward " + cpp2::string_build(cpp2::interp(CPP2_UFCS(name)(mo)), "_ : ", cpp2::interp(CPP2_UFCS(type)(mo))) + ", ";
                 }
-                ctor_inits  += "" + cpp2::to_string(CPP2_UFCS(name)(mo)) + " = " + cpp2::to_string(CPP2_UFCS(name)(mo)) + "_; ";
+                ctor_inits  += "" + cpp2::string_build(cpp2::interp(CPP2_UFCS(name)(mo)), " = ", cpp2::interp(CPP2_UFCS(name)(mo))) + "_; ";
             }
             else {
-                ctor_inits += "" + cpp2::to_string(CPP2_UFCS(type)(mo)) + " = (" + cpp2::to_string(CPP2_UFCS(initializer)(mo)) + "); ";
+                ctor_inits += "" + cpp2::string_build(cpp2::interp(CPP2_UFCS(type)(mo)), " = (", cpp2::interp(CPP2_UFCS(initializer)(mo))) + "); ";
             }
             found_member_without_initializer |= !(CPP2_UFCS(has_initializer)(cpp2::move(mo)));
         }}
@@ -2737,7 +3951,7 @@ auto cpp2_struct(meta::type_declaration& t) -> void
     {
         //  Then to enable construction from corresponding values
         //  requires a constructor... an exception to the rule of zero
-        CPP2_UFCS(add_member)(t, "    operator=: (implicit out this, " + cpp2::to_string(cpp2::move(ctor_params)) + ") = { " + cpp2::to_string(cpp2::move(ctor_inits)) + " }");
+        CPP2_UFCS(add_member)(t, "    operator=: (implicit out this, " + cpp2::string_build(cpp2::interp(cpp2::move(ctor_params)), ") = { ", cpp2::interp(cpp2::move(ctor_inits))) + " }");
 
         //  And if all members had initializers, we need a default constructor
         if (!(cpp2::move(found_member_without_initializer))) {
@@ -2746,12 +3960,7 @@ auto cpp2_struct(meta::type_declaration& t) -> void
     }
 }
 
-value_member_info::value_member_info(auto const& name_, auto const& type_, auto const& value_)
-                                                               : name{ name_ }
-                                                               , type{ type_ }
-                                                               , value{ value_ }{}
-
-#line 1091 "reflect.h2"
+#line 2414 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "C enumerations constitute a curiously half-baked concept. ...
@@ -2769,8 +3978,6 @@ value_member_info::value_member_info(auto const& name_, auto const& type_, auto
 //
 //  a type together with named constants that are its possible values
 //
-
-#line 1114 "reflect.h2"
 auto basic_enum(
     meta::type_declaration& t, 
     auto const& nextval, 
@@ -2795,7 +4002,7 @@ auto basic_enum(
 {
 std::string value{"-1"};
 
-#line 1137 "reflect.h2"
+#line 2454 "reflect.h2"
     for ( 
           auto const& m : CPP2_UFCS(get_members)(t) ) 
     if (  CPP2_UFCS(is_member_object)(m)) 
@@ -2837,7 +4044,7 @@ std::string value{"-1"};
     }
 }
 
-#line 1177 "reflect.h2"
+#line 2494 "reflect.h2"
     if ((CPP2_UFCS(empty)(enumerators))) {
         CPP2_UFCS(error)(t, "an enumeration must contain at least one enumerator value");
         return ; 
@@ -2888,7 +4095,7 @@ std::string value{"-1"};
         }
     }
 
-#line 1228 "reflect.h2"
+#line 2545 "reflect.h2"
     //  2. Replace: Erase the contents and replace with modified contents
     //
     //  Note that most values and functions are declared as '==' compile-time values, i.e. Cpp1 'constexpr'
@@ -2924,7 +4131,7 @@ std::string value{"-1"};
 
     //  Add the enumerators
     for ( auto const& e : enumerators ) {
-        CPP2_UFCS(add_member)(t, "    " + cpp2::to_string(e.name) + " : " + cpp2::to_string(CPP2_UFCS(name)(t)) + " == " + cpp2::to_string(e.value) + ";");
+        CPP2_UFCS(add_member)(t, "    " + cpp2::string_build(cpp2::interp(e.name), " : ", cpp2::interp(CPP2_UFCS(name)(t)), " == ", cpp2::interp(e.value)) + ";");
     }
 
     //  Generate the common functions
@@ -2938,7 +4145,7 @@ std::string to_string_impl{"    to_string_impl: (this, prefix: std::string_view"
     //  Provide 'to_string' and 'to_code' functions to print enumerator
     //  name(s) as human-readable strings or as code expressions
 
-#line 1275 "reflect.h2"
+#line 2592 "reflect.h2"
     {
         if (bitwise) {
             to_string_impl += ", separator: std::string_view ) -> std::string = { \n"
@@ -2957,13 +4164,13 @@ std::string to_string_impl{"    to_string_impl: (this, prefix: std::string_view"
             if (e.name != "_") {// ignore unnamed values
                 if (bitwise) {
                     if (e.name != "none") {
-                        to_string_impl += "    if (this & " + cpp2::to_string(e.name) + ") == " + cpp2::to_string(e.name) + " { "
+                        to_string_impl += "    if (this & " + cpp2::string_build(cpp2::interp(e.name), ") == ", cpp2::interp(e.name)) + " { "
                                                   "ret += sep + pref + \"" + cpp2::to_string(e.name) + "\"; sep = separator; "
                                               "}\n";
                     }
                 }
                 else {
-                    to_string_impl += "    if this == " + cpp2::to_string(e.name) + " { return pref + \"" + cpp2::to_string(e.name) + "\"; }\n";
+                    to_string_impl += "    if this == " + cpp2::string_build(cpp2::interp(e.name), " { return pref + \"", cpp2::interp(e.name)) + "\"; }\n";
                 }
             }
         }
@@ -2979,7 +4186,7 @@ std::string to_string_impl{"    to_string_impl: (this, prefix: std::string_view"
     }
 }
 
-#line 1314 "reflect.h2"
+#line 2631 "reflect.h2"
     if (bitwise) {
         CPP2_UFCS(add_member)(t, "    to_string: (this) -> std::string = to_string_impl( \"\", \", \" );");
         CPP2_UFCS(add_member)(t, "    to_code  : (this) -> std::string = to_string_impl( \"" + cpp2::to_string(CPP2_UFCS(name)(t)) + "::\", \" | \" );");
@@ -2993,7 +4200,7 @@ std::string from_string{"    from_string: (s: std::string_view) -> " + cpp2::to_
 
     //  Provide a 'from_string' function to parse strings into enumerators    
 
-#line 1325 "reflect.h2"
+#line 2642 "reflect.h2"
     {
         std::string_view prefix {""}; 
         std::string_view combine_op {"return"}; 
@@ -3015,15 +4222,15 @@ std::string from_string{"    from_string: (s: std::string_view) -> " + cpp2::to_
 {
 std::string_view else_{""};
 
-#line 1345 "reflect.h2"
+#line 2662 "reflect.h2"
         for ( 
               auto const& e : cpp2::move(enumerators) ) {
-            from_string += "            " + cpp2::to_string(else_) + "if \"" + cpp2::to_string(e.name) + "\" == x { " + cpp2::to_string(combine_op) + " " + cpp2::to_string(e.name) + "; }\n";
+            from_string += "            " + cpp2::string_build(cpp2::interp(else_), "if \"", cpp2::interp(e.name), "\" == x { ", cpp2::interp(combine_op), " ", cpp2::interp(e.name)) + "; }\n";
             else_ = "else ";
         }
 }
 
-#line 1351 "reflect.h2"
+#line 2668 "reflect.h2"
         if (bitwise) {
             from_string += "            else { break outer; }\n"
                            "        }\n"
@@ -3031,7 +4238,7 @@ std::string_view else_{""};
                            "        } while false;\n";
         }
 
-        from_string += "        cpp2::type_safety.report_violation( (\"can't convert string '\" + cpp2::to_string(s) + \"' to " + cpp2::to_string(cpp2::move(prefix)) + "enum of type " + cpp2::to_string(CPP2_UFCS(name)(t)) + "\").c_str() );\n"
+        from_string += "        cpp2::type_safety.report_violation( (\"can't convert string '\" + cpp2::to_string(s) + \"' to " + cpp2::string_build(cpp2::interp(cpp2::move(prefix)), "enum of type ", cpp2::interp(CPP2_UFCS(name)(t))) + "\").c_str() );\n"
                        "        return " + cpp2::to_string(cpp2::move(default_value)) + ";\n"
                        "    }\n\n";
 
@@ -3039,11 +4246,11 @@ std::string_view else_{""};
     }
 }
 
-#line 1365 "reflect.h2"
-    CPP2_UFCS(add_member)(t, "    from_code: (s: std::string_view) -> " + cpp2::to_string(CPP2_UFCS(name)(t)) + " = { str: std::string = s; return from_string( cpp2::string_util::replace_all(str, \"" + cpp2::to_string(CPP2_UFCS(name)(t)) + "::\", \"\" ) ); }");
+#line 2682 "reflect.h2"
+    CPP2_UFCS(add_member)(t, "    from_code: (s: std::string_view) -> " + cpp2::string_build(cpp2::interp(CPP2_UFCS(name)(t)), " = { str: std::string = s; return from_string( cpp2::string_util::replace_all(str, \"", cpp2::interp(CPP2_UFCS(name)(t))) + "::\", \"\" ) ); }");
 }
 
-#line 1369 "reflect.h2"
+#line 2686 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //    "An enum[...] is a totally ordered value type that stores a
@@ -3053,7 +4260,6 @@ std::string_view else_{""};
 //
 //          -- P0707R4, section 3
 //
-#line 1378 "reflect.h2"
 auto cpp2_enum(meta::type_declaration& t) -> void
 {
     //  Let basic_enum do its thing, with an incrementing value generator
@@ -3070,7 +4276,7 @@ auto cpp2_enum(meta::type_declaration& t) -> void
     );
 }
 
-#line 1395 "reflect.h2"
+#line 2712 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "flag_enum expresses an enumeration that stores values
@@ -3081,7 +4287,6 @@ auto cpp2_enum(meta::type_declaration& t) -> void
 //
 //          -- P0707R4, section 3
 //
-#line 1405 "reflect.h2"
 auto flag_enum(meta::type_declaration& t) -> void
 {
     //  Let basic_enum do its thing, with a power-of-two value generator
@@ -3103,7 +4308,7 @@ auto flag_enum(meta::type_declaration& t) -> void
     );
 }
 
-#line 1427 "reflect.h2"
+#line 2744 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //     "As with void*, programmers should know that unions [...] are
@@ -3128,7 +4333,6 @@ auto flag_enum(meta::type_declaration& t) -> void
 //  a type that contains exactly one of a fixed set of values at a time
 //
 
-#line 1451 "reflect.h2"
 auto cpp2_union(meta::type_declaration& t) -> void
 {
     std::vector<value_member_info> alternatives {}; 
@@ -3137,7 +4341,7 @@ auto value{0};
 
     //  1. Gather: All the user-written members, and find/compute the max size
 
-#line 1458 "reflect.h2"
+#line 2775 "reflect.h2"
     for ( 
 
            auto const& m : CPP2_UFCS(get_members)(t) )  { do 
@@ -3167,7 +4371,7 @@ auto value{0};
     } while (false); ++value; }
 }
 
-#line 1486 "reflect.h2"
+#line 2803 "reflect.h2"
     std::string discriminator_type {}; 
     if (cpp2::impl::cmp_less(CPP2_UFCS(ssize)(alternatives),std::numeric_limits<cpp2::i8>::max())) {
         discriminator_type = "i8";
@@ -3182,7 +4386,7 @@ auto value{0};
         discriminator_type = "i64";
     }}}
 
-#line 1501 "reflect.h2"
+#line 2818 "reflect.h2"
     //  2. Replace: Erase the contents and replace with modified contents
 
     CPP2_UFCS(remove_marked_members)(t);
@@ -3191,7 +4395,7 @@ std::string storage{"    _storage: cpp2::aligned_storage<cpp2::max( "};
 
     //  Provide storage
 
-#line 1507 "reflect.h2"
+#line 2824 "reflect.h2"
     {
         for ( 
               auto const& e : alternatives ) {
@@ -3211,33 +4415,33 @@ std::string storage{"    _storage: cpp2::aligned_storage<cpp2::max( "};
 }
 
     //  Provide discriminator
-#line 1525 "reflect.h2"
+#line 2842 "reflect.h2"
     CPP2_UFCS(add_member)(t, "    _discriminator: " + cpp2::to_string(cpp2::move(discriminator_type)) + " = -1;\n");
 
     //  Add the alternatives: is_alternative, get_alternative, and set_alternative
     for ( 
          auto const& a : alternatives ) 
     {
-        CPP2_UFCS(add_member)(t, "    is_" + cpp2::to_string(a.name) + ": (this) -> bool = _discriminator == " + cpp2::to_string(a.value) + ";\n");
+        CPP2_UFCS(add_member)(t, "    is_" + cpp2::string_build(cpp2::interp(a.name), ": (this) -> bool = _discriminator == ", cpp2::interp(a.value)) + ";\n");
 
-        CPP2_UFCS(add_member)(t, "    " + cpp2::to_string(a.name) + ": (this) -> forward " + cpp2::to_string(a.type) + " pre(is_" + cpp2::to_string(a.name) + "()) = "
+        CPP2_UFCS(add_member)(t, "    " + cpp2::string_build(cpp2::interp(a.name), ": (this) -> forward ", cpp2::interp(a.type), " pre(is_", cpp2::interp(a.name)) + "()) = "
                             "reinterpret_cast<* const " + cpp2::to_string(a.type) + ">(_storage&)*;\n"
                     );
 
-        CPP2_UFCS(add_member)(t, "    " + cpp2::to_string(a.name) + ": (inout this) -> forward " + cpp2::to_string(a.type) + " pre(is_" + cpp2::to_string(a.name) + "()) = "
+        CPP2_UFCS(add_member)(t, "    " + cpp2::string_build(cpp2::interp(a.name), ": (inout this) -> forward ", cpp2::interp(a.type), " pre(is_", cpp2::interp(a.name)) + "()) = "
                             "reinterpret_cast<*" + cpp2::to_string(a.type) + ">(_storage&)*;\n"
                     );
 
-        CPP2_UFCS(add_member)(t, "    set_" + cpp2::to_string(a.name) + ": (inout this, _value: " + cpp2::to_string(a.type) + ") = { "
-                            "if !is_" + cpp2::to_string(a.name) + "() { _destroy(); std::construct_at( reinterpret_cast<*" + cpp2::to_string(a.type) + ">(_storage&), _value); } "
+        CPP2_UFCS(add_member)(t, "    set_" + cpp2::string_build(cpp2::interp(a.name), ": (inout this, _value: ", cpp2::interp(a.type)) + ") = { "
+                            "if !is_" + cpp2::string_build(cpp2::interp(a.name), "() { _destroy(); std::construct_at( reinterpret_cast<*", cpp2::interp(a.type)) + ">(_storage&), _value); } "
                             "else { reinterpret_cast<*" + cpp2::to_string(a.type) + ">(_storage&)* = _value; } "
                             "_discriminator = " + cpp2::to_string(a.value) + "; "
                             "}\n"
                     );
 
         CPP2_UFCS(add_member)(t, "    set_" + cpp2::to_string(a.name) + ": (inout this, forward _args...: _) = { "
-                            "if !is_" + cpp2::to_string(a.name) + "() { _destroy(); std::construct_at( reinterpret_cast<*" + cpp2::to_string(a.type) + ">(_storage&), _args...); } "
-                            " else { reinterpret_cast<*" + cpp2::to_string(a.type) + ">(_storage&)* = :" + cpp2::to_string(a.type) + " = (_args...); } "
+                            "if !is_" + cpp2::string_build(cpp2::interp(a.name), "() { _destroy(); std::construct_at( reinterpret_cast<*", cpp2::interp(a.type)) + ">(_storage&), _args...); } "
+                            " else { reinterpret_cast<*" + cpp2::string_build(cpp2::interp(a.type), ">(_storage&)* = :", cpp2::interp(a.type)) + " = (_args...); } "
                             "_discriminator = " + cpp2::to_string(a.value) + "; "
                             "}\n"
                     );
@@ -3247,11 +4451,11 @@ std::string destroy{"    private _destroy: (inout this) = {\n"};
 
     //  Add destroy
 
-#line 1558 "reflect.h2"
+#line 2875 "reflect.h2"
     {
         for ( 
               auto const& a : alternatives ) {
-            destroy += "        if _discriminator == " + cpp2::to_string(a.value) + " { std::destroy_at( reinterpret_cast<*" + cpp2::to_string(a.type) + ">(_storage&) ); }\n";
+            destroy += "        if _discriminator == " + cpp2::string_build(cpp2::interp(a.value), " { std::destroy_at( reinterpret_cast<*", cpp2::interp(a.type)) + ">(_storage&) ); }\n";
         }
 
         destroy += "        _discriminator = -1;\n"
@@ -3261,7 +4465,7 @@ std::string destroy{"    private _destroy: (inout this) = {\n"};
 }
 
     //  Add the destructor
-#line 1570 "reflect.h2"
+#line 2887 "reflect.h2"
     CPP2_UFCS(add_member)(t, "    operator=: (move this) = { _destroy(); _ = this; }");
 
     //  Add default constructor
@@ -3271,11 +4475,11 @@ std::string value_set{""};
 
     //  Add copy/move construction and assignment
 
-#line 1577 "reflect.h2"
+#line 2894 "reflect.h2"
     {
         for ( 
               auto const& a : cpp2::move(alternatives) ) {
-            value_set += "        if that.is_" + cpp2::to_string(a.name) + "() { set_" + cpp2::to_string(a.name) + "( that." + cpp2::to_string(a.name) + "() ); }\n";
+            value_set += "        if that.is_" + cpp2::string_build(cpp2::interp(a.name), "() { set_", cpp2::interp(a.name), "( that.", cpp2::interp(a.name)) + "() ); }\n";
         }
         value_set += "    }\n";
 
@@ -3291,27 +4495,25 @@ std::string value_set{""};
                     );
     }
 }
-#line 1595 "reflect.h2"
+#line 2912 "reflect.h2"
 }
 
-#line 1598 "reflect.h2"
+#line 2915 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  print - output a pretty-printed visualization of t
 //
-#line 1602 "reflect.h2"
 auto print(cpp2::impl::in<meta::type_declaration> t) -> void
 {
     std::cout << CPP2_UFCS(print)(t) << "\n";
 }
 
-#line 1608 "reflect.h2"
+#line 2925 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  noisy - make each function print its name and signature,
 //          so the programmer can see what's called
 //
-#line 1613 "reflect.h2"
 auto noisy(cpp2::impl::in<meta::type_declaration> t) -> void
 {
     for ( 
@@ -3419,7 +4621,7 @@ return none;
 [[nodiscard]] auto expression_flags::from_code(cpp2::impl::in<std::string_view> s) -> expression_flags{
 std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::move(str), "expression_flags::", "")); }
 
-#line 1630 "reflect.h2"
+#line 2947 "reflect.h2"
 //-----------------------------------------------------------------------
 //
 //  regex - creates regular expressions from members
@@ -3435,11 +4637,11 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
 //  ```
 //
 
-#line 1646 "reflect.h2"
+#line 2963 "reflect.h2"
 //  Possible modifiers for a regular expression.
 //
 
-#line 1650 "reflect.h2"
+#line 2967 "reflect.h2"
                                   // mod: i
                                   // mod: m
                                   // mod: s
@@ -3447,106 +4649,96 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
                                   // mod: x
                                   // mod: xx
 
-#line 1659 "reflect.h2"
+#line 2976 "reflect.h2"
 //  Tokens for regular expressions.
 //
 
 // Basic class for a regex token.
 //
 
-#line 1668 "reflect.h2"
+#line 2985 "reflect.h2"
     regex_token::regex_token(cpp2::impl::in<std::string> str)
         : string_rep{ str }{
 
-#line 1670 "reflect.h2"
+#line 2987 "reflect.h2"
     }
 
-#line 1672 "reflect.h2"
     regex_token::regex_token()
         : string_rep{ "" }{
 
-#line 1674 "reflect.h2"
+#line 2991 "reflect.h2"
     }
 
     //parse: (inout ctx: parse_context) -> token_ptr;
                                                                        // Generate the matching code.
 
-#line 1679 "reflect.h2"
     auto regex_token::add_groups([[maybe_unused]] std::set<int>& unnamed_param_2) const -> void{}// Adds all group indices to the set.
-#line 1680 "reflect.h2"
     [[nodiscard]] auto regex_token::to_string() const& -> std::string{return string_rep; }// Create a string representation.
-#line 1681 "reflect.h2"
     auto regex_token::set_string(cpp2::impl::in<std::string> s) & -> void{string_rep = s; }
 
     regex_token::~regex_token() noexcept{}// Set the string representation.
 
-#line 1696 "reflect.h2"
+#line 3013 "reflect.h2"
     regex_token_check::regex_token_check(cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> check_)
         : regex_token{ str }
         , check{ check_ }{
 
-#line 1699 "reflect.h2"
+#line 3016 "reflect.h2"
     }
 
-#line 1701 "reflect.h2"
     auto regex_token_check::generate_code(generation_context& ctx) const -> void{
         ctx.add_check(check + "(" + ctx.match_parameters() + ")");
     }
 
     regex_token_check::~regex_token_check() noexcept{}
 
-#line 1715 "reflect.h2"
+#line 3032 "reflect.h2"
     regex_token_code::regex_token_code(cpp2::impl::in<std::string> str, cpp2::impl::in<std::string> code_)
         : regex_token{ str }
         , code{ code_ }{
 
-#line 1718 "reflect.h2"
+#line 3035 "reflect.h2"
     }
 
-#line 1720 "reflect.h2"
     auto regex_token_code::generate_code(generation_context& ctx) const -> void{
         ctx.add(code);
     }
 
     regex_token_code::~regex_token_code() noexcept{}
 
-#line 1732 "reflect.h2"
+#line 3049 "reflect.h2"
     regex_token_empty::regex_token_empty(cpp2::impl::in<std::string> str)
         : regex_token{ str }{
 
-#line 1734 "reflect.h2"
+#line 3051 "reflect.h2"
     }
 
-#line 1736 "reflect.h2"
     auto regex_token_empty::generate_code([[maybe_unused]] generation_context& unnamed_param_2) const -> void{
         // Nothing.
     }
 
     regex_token_empty::~regex_token_empty() noexcept{}
 
-#line 1750 "reflect.h2"
+#line 3067 "reflect.h2"
     regex_token_list::regex_token_list(cpp2::impl::in<token_vec> t)
         : regex_token{ gen_string(t) }
         , tokens{ t }{
 
-#line 1753 "reflect.h2"
+#line 3070 "reflect.h2"
     }
 
-#line 1755 "reflect.h2"
     auto regex_token_list::generate_code(generation_context& ctx) const -> void{
         for ( auto const& token : tokens ) {
             (*cpp2::impl::assert_not_null(token)).generate_code(ctx);
         }
     }
 
-#line 1761 "reflect.h2"
     auto regex_token_list::add_groups(std::set<int>& groups) const -> void{
         for ( auto const& token : tokens ) {
             (*cpp2::impl::assert_not_null(token)).add_groups(groups);
         }
     }
 
-#line 1767 "reflect.h2"
     [[nodiscard]] auto regex_token_list::gen_string(cpp2::impl::in<token_vec> vec) -> std::string{
         std::string r {""}; 
         for ( auto const& token : vec ) {
@@ -3557,7 +4749,7 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
 
     regex_token_list::~regex_token_list() noexcept{}
 
-#line 1790 "reflect.h2"
+#line 3107 "reflect.h2"
     auto parse_context_group_state::next_alternative() & -> void{
         token_vec new_list {}; 
         std::swap(new_list, cur_match_list);
@@ -3565,14 +4757,14 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
         static_cast<void>(alternate_match_lists.insert(alternate_match_lists.end(), CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_list>)(cpp2::shared, cpp2::move(new_list))));
     }
 
-#line 1798 "reflect.h2"
+#line 3115 "reflect.h2"
     auto parse_context_group_state::swap(parse_context_group_state& t) & -> void{// NOLINT(performance-noexcept-swap)
         std::swap(cur_match_list, t.cur_match_list);
         std::swap(alternate_match_lists, t.alternate_match_lists);
         std::swap(modifiers, t.modifiers);
     }
 
-#line 1805 "reflect.h2"
+#line 3122 "reflect.h2"
     [[nodiscard]] auto parse_context_group_state::get_as_token() & -> token_ptr{
         if (alternate_match_lists.empty()) {
             post_process_list(cur_match_list);
@@ -3584,15 +4776,15 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
         }
     }
 
-#line 1817 "reflect.h2"
+#line 3134 "reflect.h2"
     auto parse_context_group_state::add(cpp2::impl::in<token_ptr> token) & -> void{
         cur_match_list.push_back(token);
     }
 
-#line 1822 "reflect.h2"
+#line 3139 "reflect.h2"
     [[nodiscard]] auto parse_context_group_state::empty() const& -> bool { return cur_match_list.empty();  }
 
-#line 1826 "reflect.h2"
+#line 3143 "reflect.h2"
     auto parse_context_group_state::post_process_list(token_vec& list) -> void{
         // Merge all characters
         auto merge_pos {list.begin()}; 
@@ -3613,7 +4805,7 @@ std::string str {s}; return from_string(cpp2::string_util::replace_all(cpp2::mov
                                                                                               , modifiers{ modifiers_ }{}
 parse_context_group_state::parse_context_group_state(){}
 
-#line 1852 "reflect.h2"
+#line 3169 "reflect.h2"
     [[nodiscard]] auto parse_context_branch_reset_state::next() & -> int{
         auto g {cur_group}; 
         cur_group += 1;
@@ -3622,20 +4814,20 @@ parse_context_group_state::parse_context_group_state(){}
         return g; 
     }
 
-#line 1861 "reflect.h2"
+#line 3178 "reflect.h2"
     auto parse_context_branch_reset_state::set_next(cpp2::impl::in<int> g) & -> void{
         cur_group = g;
         max_group = max(max_group, g);
     }
 
-#line 1867 "reflect.h2"
+#line 3184 "reflect.h2"
     auto parse_context_branch_reset_state::next_alternative() & -> void{
         if (is_active) {
             cur_group = from;
         }
     }
 
-#line 1874 "reflect.h2"
+#line 3191 "reflect.h2"
     auto parse_context_branch_reset_state::set_active_reset(cpp2::impl::in<int> restart) & -> void{
         is_active = true;
         cur_group = restart;
@@ -3650,16 +4842,16 @@ parse_context_group_state::parse_context_group_state(){}
                                                                                     , from{ from_ }{}
 parse_context_branch_reset_state::parse_context_branch_reset_state(){}
 
-#line 1902 "reflect.h2"
+#line 3219 "reflect.h2"
     parse_context::parse_context(cpp2::impl::in<std::string_view> r, auto const& e)
         : regex{ r }
         , root{ CPP2_UFCS_TEMPLATE_NONLOCAL(cpp2_new<regex_token_empty>)(cpp2::shared, "") }
         , error_out{ e }{
 
-#line 1906 "reflect.h2"
+#line 3223 "reflect.h2"
     }
 
-#line 1912 "reflect.h2"
+#line 3229 "reflect.h2"
     [[nodiscard]] auto parse_context::start_group() & -> parse_context_group_state
     {
         parse_context_group_state old_state {}; 
@@ -3669,7 +4861,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return old_state; 
     }
 
-#line 1922 "reflect.h2"
+#line 3239 "reflect.h2"
     [[nodiscard]] auto parse_context::end_group(cpp2::impl::in<parse_context_group_state> old_state) & -> token_ptr
     {
         auto inner {cur_group_state.get_as_token()}; 
@@ -3677,17 +4869,15 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return inner; 
     }
 
-#line 1929 "reflect.h2"
     [[nodiscard]] auto parse_context::get_modifiers() const& -> expression_flags{
         return cur_group_state.modifiers; 
     }
 
-#line 1933 "reflect.h2"
     auto parse_context::set_modifiers(cpp2::impl::in<expression_flags> mod) & -> void{
         cur_group_state.modifiers = mod;
     }
 
-#line 1940 "reflect.h2"
+#line 3257 "reflect.h2"
     [[nodiscard]] auto parse_context::branch_reset_new_state() & -> parse_context_branch_reset_state
     {
         parse_context_branch_reset_state old_state {}; 
@@ -3697,7 +4887,6 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return old_state; 
     }
 
-#line 1949 "reflect.h2"
     auto parse_context::branch_reset_restore_state(cpp2::impl::in<parse_context_branch_reset_state> old_state) & -> void
     {
         auto max_group {cur_branch_reset_state.max_group}; 
@@ -3705,24 +4894,21 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         cur_branch_reset_state.set_next(cpp2::move(max_group));
     }
 
-#line 1956 "reflect.h2"
     auto parse_context::next_alternative() & -> void
     {
         cur_group_state.next_alternative();
         cur_branch_reset_state.next_alternative();
     }
 
-#line 1964 "reflect.h2"
+#line 3281 "reflect.h2"
     auto parse_context::add_token(cpp2::impl::in<token_ptr> token) & -> void{
         cur_group_state.add(token);
     }
 
-#line 1968 "reflect.h2"
     [[nodiscard]] auto parse_context::has_token() const& -> bool{
         return !(cur_group_state.empty()); 
     }
 
-#line 1972 "reflect.h2"
     [[nodiscard]] auto parse_context::pop_token() & -> token_ptr
     {
         token_ptr r {nullptr}; 
@@ -3734,22 +4920,19 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return r; 
     }
 
-#line 1983 "reflect.h2"
     [[nodiscard]] auto parse_context::get_as_token() & -> token_ptr{
         return root; 
     }
 
-#line 1989 "reflect.h2"
+#line 3306 "reflect.h2"
     [[nodiscard]] auto parse_context::get_cur_group() const& -> int{
         return cur_branch_reset_state.cur_group; 
     }
 
-#line 1993 "reflect.h2"
     [[nodiscard]] auto parse_context::next_group() & -> int{
         return cur_branch_reset_state.next(); 
     }
 
-#line 1997 "reflect.h2"
     auto parse_context::set_named_group(cpp2::impl::in<std::string> name, cpp2::impl::in<int> id) & -> void
     {
         if (!(named_groups.contains(name))) {// Redefinition of group name is not an error. The left most one is retained.
@@ -3757,7 +4940,6 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 2004 "reflect.h2"
     [[nodiscard]] auto parse_context::get_named_group(cpp2::impl::in<std::string> name) const& -> int
     {
         auto iter {named_groups.find(name)}; 
@@ -3769,10 +4951,10 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 2017 "reflect.h2"
+#line 3334 "reflect.h2"
     [[nodiscard]] auto parse_context::current() const& -> char{return CPP2_ASSERT_IN_BOUNDS(regex, pos); }
 
-#line 2020 "reflect.h2"
+#line 3337 "reflect.h2"
     [[nodiscard]] auto parse_context::get_next_position(cpp2::impl::in<bool> in_class, cpp2::impl::in<bool> no_skip) const& -> size_t
     {
         auto perl_syntax {false}; 
@@ -3812,7 +4994,7 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return cur; 
     }
 
-#line 2060 "reflect.h2"
+#line 3377 "reflect.h2"
     [[nodiscard]] auto parse_context::next_impl(cpp2::impl::in<bool> in_class, cpp2::impl::in<bool> no_skip) & -> bool
     {
         pos = get_next_position(in_class, no_skip);
@@ -3824,14 +5006,10 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 2071 "reflect.h2"
     [[nodiscard]] auto parse_context::next() & -> decltype(auto) { return next_impl(false, false); }
-#line 2072 "reflect.h2"
     [[nodiscard]] auto parse_context::next_in_class() & -> decltype(auto) { return next_impl(true, false);  }
-#line 2073 "reflect.h2"
     [[nodiscard]] auto parse_context::next_no_skip() & -> decltype(auto) { return next_impl(false, true); }
 
-#line 2075 "reflect.h2"
     [[nodiscard]] auto parse_context::next_n(cpp2::impl::in<int> n) & -> bool{
         auto r {true}; 
         auto cur {0}; 
@@ -3841,10 +5019,8 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return r; 
     }
 
-#line 2084 "reflect.h2"
     [[nodiscard]] auto parse_context::has_next() const& -> bool{return cpp2::impl::cmp_less(pos,regex.size()); }
 
-#line 2086 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_until_impl(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r, cpp2::impl::in<bool> any) & -> bool
     {
         auto end {pos}; // NOLINT(clang-analyzer-deadcode.DeadStores)
@@ -3866,14 +5042,10 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 2107 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_until(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r) & -> decltype(auto) { return grab_until_impl(e, cpp2::impl::out(&r), false); }
-#line 2108 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_until(cpp2::impl::in<char> e, cpp2::impl::out<std::string> r) & -> decltype(auto) { return grab_until_impl(std::string(1, e), cpp2::impl::out(&r), false); }
-#line 2109 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_until_one_of(cpp2::impl::in<std::string> e, cpp2::impl::out<std::string> r) & -> decltype(auto) { return grab_until_impl(e, cpp2::impl::out(&r), true);  }
 
-#line 2111 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_n(cpp2::impl::in<int> n, cpp2::impl::out<std::string> r) & -> bool
     {
         if (cpp2::impl::cmp_less_eq(pos + cpp2::impl::as_<size_t>(n),regex.size())) {
@@ -3887,7 +5059,6 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 2124 "reflect.h2"
     [[nodiscard]] auto parse_context::grab_number() & -> std::string
     {
         auto start {pos}; 
@@ -3909,7 +5080,6 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return cpp2::move(r.value()); 
     }
 
-#line 2145 "reflect.h2"
     [[nodiscard]] auto parse_context::peek_impl(cpp2::impl::in<bool> in_class) const& -> char{
         auto next_pos {get_next_position(in_class, false)}; 
         if (cpp2::impl::cmp_less(next_pos,regex.size())) {
@@ -3920,12 +5090,10 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 2155 "reflect.h2"
     [[nodiscard]] auto parse_context::peek() const& -> decltype(auto) { return peek_impl(false); }
-#line 2156 "reflect.h2"
     [[nodiscard]] auto parse_context::peek_in_class() const& -> decltype(auto) { return peek_impl(true);  }
 
-#line 2161 "reflect.h2"
+#line 3478 "reflect.h2"
     [[nodiscard]] auto parse_context::parser_group_modifiers(cpp2::impl::in<std::string> change_str, expression_flags& parser_modifiers) & -> bool
     {
         auto is_negative {false}; 
@@ -3980,7 +5148,6 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return true; 
     }
 
-#line 2215 "reflect.h2"
     [[nodiscard]] auto parse_context::parse_until(cpp2::impl::in<char> term) & -> bool{
         token_ptr cur_token {}; 
 
@@ -4019,7 +5186,6 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return true; 
     }
 
-#line 2253 "reflect.h2"
     [[nodiscard]] auto parse_context::parse(cpp2::impl::in<std::string> modifiers) & -> bool
     {
 
@@ -4035,21 +5201,18 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         return r; 
     }
 
-#line 2270 "reflect.h2"
+#line 3587 "reflect.h2"
     [[nodiscard]] auto parse_context::get_pos() const& -> decltype(auto) { return pos; }
-#line 2271 "reflect.h2"
     [[nodiscard]] auto parse_context::get_range(cpp2::impl::in<size_t> start, cpp2::impl::in<size_t> end) const& -> decltype(auto) { return std::string(regex.substr(start, end - start + 1));  }
-#line 2272 "reflect.h2"
     [[nodiscard]] auto parse_context::valid() const& -> bool{return has_next() && !(has_error); }
 
-#line 2274 "reflect.h2"
     [[nodiscard]] auto parse_context::error(cpp2::impl::in<std::string> err) & -> token_ptr{
         has_error = true;
-        error_out("Error during parsing of regex '" + cpp2::to_string(regex) + "' at position '" + cpp2::to_string(pos) + "': " + cpp2::to_string(err) + "");
+        error_out("Error during parsing of regex '" + cpp2::string_build(cpp2::interp(regex), "' at position '", cpp2::interp(pos), "': ", cpp2::interp(err)) + "");
         return nullptr; 
     }
 
-#line 2289 "reflect.h2"
+#line 3606 "reflect.h2"
     auto generation_function_context::add_tabs(cpp2::impl::in<int> c) & -> void{
         int i {0}; 
         for( ; cpp2::impl::cmp_less(i,c); i += 1 ) {
@@ -4057,7 +5220,6 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
         }
     }
 
-#line 2296 "reflect.h2"
     auto generation_function_context::remove_tabs(cpp2::impl::in<int> c) & -> void{
         tabs = tabs.substr(0, (cpp2::impl::as_<size_t>(c)) * 2);
     }
@@ -4067,22 +5229,22 @@ parse_context_branch_reset_state::parse_context_branch_reset_state(){}
                                                        , tabs{ tabs_ }{}
 generation_function_context::generation_function_context(){}
 
-#line 2314 "reflect.h2"
+#line 3631 "reflect.h2"
     [[nodiscard]] auto generation_context::match_parameters() const& -> std::string{return "r.pos, ctx"; }
 
-#line 2319 "reflect.h2"
+#line 3636 "reflect.h2"
     auto generation_context::add(cpp2::impl::in<std::string> s) & -> void{
         auto cur {get_current()}; 
-        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + cpp2::to_string(s) + "\n";
+        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::string_build(cpp2::interp((*cpp2::impl::assert_not_null(cur)).tabs), cpp2::interp(s)) + "\n";
     }
 
-#line 2325 "reflect.h2"
+#line 3642 "reflect.h2"
     auto generation_context::add_check(cpp2::impl::in<std::string> check) & -> void{
         auto cur {get_current()}; 
-        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "if !cpp2::regex::" + cpp2::to_string(check) + " { r.matched = false; break; }\n";
+        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::string_build(cpp2::interp((*cpp2::impl::assert_not_null(cur)).tabs), "if !cpp2::regex::", cpp2::interp(check)) + " { r.matched = false; break; }\n";
     }
 
-#line 2331 "reflect.h2"
+#line 3648 "reflect.h2"
     auto generation_context::add_statefull(cpp2::impl::in<std::string> next_func, cpp2::impl::in<std::string> check) & -> void
     {
         end_func_statefull(check);
@@ -4091,19 +5253,17 @@ generation_function_context::generation_function_context(){}
         start_func_named(cpp2::move(name));
     }
 
-#line 2339 "reflect.h2"
     auto generation_context::start_func_named(cpp2::impl::in<std::string> name) & -> void
     {
         auto cur {new_context()}; 
 
-        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + cpp2::to_string(name) + ": @struct<noforward> type = {\n";
+        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::string_build(cpp2::interp((*cpp2::impl::assert_not_null(cur)).tabs), cpp2::interp(name)) + ": @struct<noforward> type = {\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "  operator(): (this, cur: Iter, inout ctx: context, other) -> cpp2::regex::match_return<Iter> = {\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "    r := ctx..pass(cur);\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "    do {\n";
         (*cpp2::impl::assert_not_null(cpp2::move(cur))).add_tabs(3);
     }
 
-#line 2350 "reflect.h2"
     [[nodiscard]] auto generation_context::start_func() & -> std::string
     {
         auto name {gen_func_name()}; 
@@ -4111,7 +5271,6 @@ generation_function_context::generation_function_context(){}
         return cpp2::move(name) + "()"; 
     }
 
-#line 2357 "reflect.h2"
     auto generation_context::end_func_statefull(cpp2::impl::in<std::string> s) & -> void
     {
         auto cur {get_current()}; 
@@ -4119,7 +5278,7 @@ generation_function_context::generation_function_context(){}
         (*cpp2::impl::assert_not_null(cur)).code += "\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "    } while false;\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "    if r.matched {\n";
-        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "      r = " + cpp2::to_string(s) + ";\n";
+        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::string_build(cpp2::interp((*cpp2::impl::assert_not_null(cur)).tabs), "      r = ", cpp2::interp(s)) + ";\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "    }\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "    else {\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "      r.pos = ctx.end;\n";
@@ -4131,7 +5290,7 @@ generation_function_context::generation_function_context(){}
         finish_context();
     }
 
-#line 2377 "reflect.h2"
+#line 3694 "reflect.h2"
     [[nodiscard]] auto generation_context::generate_func(cpp2::impl::in<token_ptr> token) & -> std::string
     {
         auto name {start_func()}; 
@@ -4141,7 +5300,7 @@ generation_function_context::generation_function_context(){}
         return name; 
     }
 
-#line 2387 "reflect.h2"
+#line 3704 "reflect.h2"
     [[nodiscard]] auto generation_context::generate_reset(cpp2::impl::in<std::set<int>> groups) & -> std::string
     {
         if (groups.empty()) {
@@ -4151,10 +5310,10 @@ generation_function_context::generation_function_context(){}
         auto name {gen_reset_func_name()}; 
         auto cur {new_context()}; 
 
-        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + cpp2::to_string(name) + ": @struct<noforward> type = {\n";
+        (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::string_build(cpp2::interp((*cpp2::impl::assert_not_null(cur)).tabs), cpp2::interp(name)) + ": @struct<noforward> type = {\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "  operator(): (this, inout ctx) = {\n";
         for ( auto const& g : groups ) {
-            (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "  ctx..set_group_invalid(" + cpp2::to_string(g) + ");\n";
+            (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::string_build(cpp2::interp((*cpp2::impl::assert_not_null(cur)).tabs), "  ctx..set_group_invalid(", cpp2::interp(g)) + ");\n";
         }
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "  }\n";
         (*cpp2::impl::assert_not_null(cur)).code += "" + cpp2::to_string((*cpp2::impl::assert_not_null(cur)).tabs) + "}\n";
@@ -4164,33 +5323,30 @@ generation_function_context::generation_function_context(){}
         return cpp2::move(name) + "()"; 
     }
 
-#line 2411 "reflect.h2"
+#line 3728 "reflect.h2"
     [[nodiscard]] auto generation_context::gen_func_name() & -> std::string{
         auto cur_id {matcher_func}; 
         matcher_func += 1;
         return "func_" + cpp2::to_string(cpp2::move(cur_id)) + ""; 
     }
 
-#line 2417 "reflect.h2"
     [[nodiscard]] auto generation_context::next_func_name() & -> std::string{
         return gen_func_name() + "()"; 
     }
 
-#line 2421 "reflect.h2"
     [[nodiscard]] auto generation_context::gen_reset_func_name() & -> std::string{
         auto cur_id {reset_func}; 
         reset_func += 1;
         return "reset_" + cpp2::to_string(cpp2::move(cur_id)) + ""; 
     }
 
-#line 2427 "reflect.h2"
     [[nodiscard]] auto generation_context::gen_temp() & -> std::string{
         auto cur_id {temp_name}; 
         temp_name += 1;
         return "tmp_" + cpp2::to_string(cpp2::move(cur_id)) + ""; 
     }
 
-#line 2435 "reflect.h2"
+#line 3752 "reflect.h2"
     [[nodiscard]] auto generation_context::new_context() & -> generation_function_context*{
         gen_stack.push_back(generation_function_context());
         auto cur {get_current()}; 
@@ -4199,7 +5355,6 @@ generation_function_context::generation_function_context(){}
         return cur; 
     }
 
-#line 2443 "reflect.h2"
     auto generation_context::finish_context() & -> void{
         auto cur {get_current()}; 
         auto base {get_base()}; 
@@ -4208,22 +5363,19 @@ generation_function_context::generation_function_context(){}
         gen_stack.pop_back();
     }
 
-#line 2453 "reflect.h2"
+#line 3770 "reflect.h2"
     [[nodiscard]] auto generation_context::get_current() & -> generation_function_context*{
         return &gen_stack.back(); 
     }
 
-#line 2457 "reflect.h2"
     [[nodiscard]] auto generation_context::get_base() & -> generation_function_context*{
         return &CPP2_ASSERT_IN_BOUNDS_LITERAL(gen_stack, 0); 
     }
 
-#line 2461 "reflect.h2"
     [[nodiscard]] auto generation_context::get_entry_func() const& -> std::string{
         return entry_func; 
     }
 
-#line 2465 "reflect.h2"
     [[nodiscard]] auto generation_context::create_named_group_lookup(cpp2::impl::in<std::map<std::string,int>> named_groups) const& -> std::string
     {
         std::string res {"get_named_group_index: (name) -> int = {\n"}; 
@@ -4231,7 +5383,7 @@ generation_function_context::generation_function_context(){}
         //  Generate if selection.
         std::string sep {""}; 
         for ( auto const& cur : named_groups ) {
-            res += "" + cpp2::to_string(sep) + "if name == \"" + cpp2::to_string(cur.first) + "\" { return " + cpp2::to_string(cur.second) + "; }";
+            res += "" + cpp2::string_build(cpp2::interp(sep), "if name == \"", cpp2::interp(cur.first), "\" { return ", cpp2::interp(cur.second)) + "; }";
             sep = "else ";
         }
 
@@ -4247,18 +5399,18 @@ generation_function_context::generation_function_context(){}
         return res; 
     }
 
-#line 2490 "reflect.h2"
+#line 3807 "reflect.h2"
     [[nodiscard]] auto generation_context::run(cpp2::impl::in<token_ptr> token) & -> std::string{
         entry_func = generate_func(token);
 
         return (*cpp2::impl::assert_not_null(get_base())).code; 
     }
 
-#line 2505 "reflect.h2"
+#line 3822 "reflect.h2"
     alternative_token::alternative_token()
                             : regex_token_empty{ "" }{}
 
-#line 2507 "reflect.h2"
+#line 3824 "reflect.h2"
     [[nodiscard]] auto alternative_token::parse(parse_context& ctx) -> token_ptr{
         if (ctx.current() != '|') {return nullptr; }
 
@@ -4269,15 +5421,14 @@ generation_function_context::generation_function_context(){}
 
     alternative_token::~alternative_token() noexcept{}
 
-#line 2522 "reflect.h2"
+#line 3839 "reflect.h2"
     alternative_token_gen::alternative_token_gen(cpp2::impl::in<token_vec> a)
         : regex_token{ gen_string(a) }
         , alternatives{ a }{
 
-#line 2525 "reflect.h2"
+#line 3842 "reflect.h2"
     }
 
-#line 2527 "reflect.h2"
     auto alternative_token_gen::generate_code(generation_context& ctx) const -> void
     {
         std::string functions {""}; 
@@ -4292,10 +5443,9 @@ generation_function_context::generation_function_context(){}
 
         auto next_name {ctx.next_func_name()}; 
 
-        ctx.add_statefull(next_name, "cpp2::regex::alternative_token_matcher<char>::match(" + cpp2::to_string(ctx.match_parameters()) + ", other, " + cpp2::to_string(next_name) + " " + cpp2::to_string(cpp2::move(functions)) + ")");
+        ctx.add_statefull(next_name, "cpp2::regex::alternative_token_matcher<char>::match(" + cpp2::string_build(cpp2::interp(ctx.match_parameters()), ", other, ", cpp2::interp(next_name), " ", cpp2::interp(cpp2::move(functions))) + ")");
     }
 
-#line 2544 "reflect.h2"
     auto alternative_token_gen::add_groups(std::set<int>& groups) const -> void
     {
         for ( auto const& cur : alternatives ) {
@@ -4303,7 +5453,6 @@ generation_function_context::generation_function_context(){}
         }
     }
 
-#line 2551 "reflect.h2"
     [[nodiscard]] auto alternative_token_gen::gen_string(cpp2::impl::in<token_vec> a) -> std::string
     {
         std::string r {""}; 
@@ -4319,14 +5468,13 @@ generation_function_context::generation_function_context(){}
 
     alternative_token_gen::~alternative_token_gen() noexcept{}
 
-#line 2572 "reflect.h2"
+#line 3889 "reflect.h2"
     any_token::any_token(cpp2::impl::in<bool> single_line)
         : regex_token_check{ ".", "any_token_matcher<char, " + cpp2::to_string(single_line) + ">" }{
 
-#line 2574 "reflect.h2"
+#line 3891 "reflect.h2"
     }
 
-#line 2576 "reflect.h2"
     [[nodiscard]] auto any_token::parse(parse_context& ctx) -> token_ptr{
         if ('.' != ctx.current()) {return nullptr; }
 
@@ -4335,21 +5483,19 @@ generation_function_context::generation_function_context(){}
 
     any_token::~any_token() noexcept{}
 
-#line 2593 "reflect.h2"
+#line 3910 "reflect.h2"
     char_token::char_token(cpp2::impl::in<char> t, cpp2::impl::in<bool> ignore_case_)
         : regex_token{ std::string(1, t) }
         , token{ t }
         , ignore_case{ ignore_case_ }{
 
-#line 2597 "reflect.h2"
+#line 3914 "reflect.h2"
     }
 
-#line 2599 "reflect.h2"
     [[nodiscard]] auto char_token::parse(parse_context& ctx) -> token_ptr{
         return CPP2_UFCS_TEMPLATE(cpp2_new<char_token>)(cpp2::shared, ctx.current(), ctx.get_modifiers().has(expression_flags::case_insensitive)); 
     }
 
-#line 2603 "reflect.h2"
     auto char_token::generate_code(generation_context& ctx) const -> void
     {
         if (ignore_case) {
@@ -4358,14 +5504,14 @@ generation_function_context::generation_function_context(){}
 {
 size_t i{0};
 
-#line 2609 "reflect.h2"
+#line 3926 "reflect.h2"
             for( ; cpp2::impl::cmp_less(i,token.size()); i += 1 ) {
                 CPP2_ASSERT_IN_BOUNDS(lower, i) = string_util::safe_tolower(CPP2_ASSERT_IN_BOUNDS(token, i));
                 CPP2_ASSERT_IN_BOUNDS(upper, i) = string_util::safe_toupper(CPP2_ASSERT_IN_BOUNDS(token, i));
             }
 }
 
-#line 2614 "reflect.h2"
+#line 3931 "reflect.h2"
             if (upper != lower) {
                 gen_case_insensitive(cpp2::move(lower), cpp2::move(upper), ctx);
             }
@@ -4378,34 +5524,32 @@ size_t i{0};
         }
     }
 
-#line 2626 "reflect.h2"
     auto char_token::gen_case_insensitive(cpp2::impl::in<std::string> lower, cpp2::impl::in<std::string> upper, generation_context& ctx) const& -> void
     {
         std::string name {"str_" + cpp2::to_string(ctx.gen_temp()) + ""}; 
         std::string lower_name {"lower_" + cpp2::to_string(name) + ""}; 
         std::string upper_name {"upper_" + cpp2::to_string(cpp2::move(name)) + ""}; 
         auto size {token.size()}; 
-        ctx.add("" + cpp2::to_string(lower_name) + " : std::array<char, " + cpp2::to_string(size) + " + 1> = \"" + cpp2::to_string(add_escapes(lower)) + "\";");  // TODO: Add constexpr when Issue https://github.com/hsutter/cppfront/issues/1104 is resolved.
-        ctx.add("" + cpp2::to_string(upper_name) + " : std::array<char, " + cpp2::to_string(size) + " + 1> = \"" + cpp2::to_string(add_escapes(upper)) + "\";");  // TODO: Add constexpr when Issue https://github.com/hsutter/cppfront/issues/1104 is resolved.
+        ctx.add("" + cpp2::string_build(cpp2::interp(lower_name), " : std::array<char, ", cpp2::interp(size), " + 1> = \"", cpp2::interp(add_escapes(lower))) + "\";");  // TODO: Add constexpr when Issue https://github.com/hsutter/cppfront/issues/1104 is resolved.
+        ctx.add("" + cpp2::string_build(cpp2::interp(upper_name), " : std::array<char, ", cpp2::interp(size), " + 1> = \"", cpp2::interp(add_escapes(upper))) + "\";");  // TODO: Add constexpr when Issue https://github.com/hsutter/cppfront/issues/1104 is resolved.
         ctx.add("if std::distance(r.pos, ctx.end) < " + cpp2::to_string(size) + " {");
         ctx.add("    r.matched = false;");
         ctx.add("    break;");
         ctx.add("}");
         ctx.add("");
         ctx.add("(copy i : int = 0) while i < " + cpp2::to_string(size) + " next (i += 1) {");
-        ctx.add("    if !(" + cpp2::to_string(cpp2::move(lower_name)) + "[i] == r.pos[i] || " + cpp2::to_string(cpp2::move(upper_name)) + "[i] == r.pos[i]) { r.matched = false; }");
+        ctx.add("    if !(" + cpp2::string_build(cpp2::interp(cpp2::move(lower_name)), "[i] == r.pos[i] || ", cpp2::interp(cpp2::move(upper_name))) + "[i] == r.pos[i]) { r.matched = false; }");
         ctx.add("}");
         ctx.add("");
         ctx.add("if r.matched { r.pos += " + cpp2::to_string(cpp2::move(size)) + "; }");
         ctx.add("else { break; }");
     }
 
-#line 2647 "reflect.h2"
     auto char_token::gen_case_sensitive(generation_context& ctx) const& -> void
     {
         std::string name {"str_" + cpp2::to_string(ctx.gen_temp()) + ""}; 
         auto size {token.size()}; 
-        ctx.add("" + cpp2::to_string(name) + " : std::array<char, " + cpp2::to_string(size) + " + 1> = \"" + cpp2::to_string(add_escapes(token)) + "\";");  // TODO: Add constexpr when Issue https://github.com/hsutter/cppfront/issues/1104 is resolved.
+        ctx.add("" + cpp2::string_build(cpp2::interp(name), " : std::array<char, ", cpp2::interp(size), " + 1> = \"", cpp2::interp(add_escapes(token))) + "\";");  // TODO: Add constexpr when Issue https://github.com/hsutter/cppfront/issues/1104 is resolved.
         ctx.add("if std::distance(r.pos, ctx.end) < " + cpp2::to_string(size) + " {");
         ctx.add("    r.matched = false;");
         ctx.add("    break;");
@@ -4419,7 +5563,6 @@ size_t i{0};
         ctx.add("else { break; }");
     }
 
-#line 2665 "reflect.h2"
     [[nodiscard]] auto char_token::add_escapes(std::string str) const& -> std::string
     {
         str = string_util::replace_all(str, "\\", "\\\\");
@@ -4435,7 +5578,6 @@ size_t i{0};
         return cpp2::move(str); 
     }
 
-#line 2680 "reflect.h2"
     auto char_token::append(char_token const& that) & -> void{
         (*this).token += that.token;
         (*this).string_rep += that.string_rep;
@@ -4443,19 +5585,19 @@ size_t i{0};
 
     char_token::~char_token() noexcept{}
 
-#line 2697 "reflect.h2"
+#line 4014 "reflect.h2"
     class_token::class_token(cpp2::impl::in<bool> negate_, cpp2::impl::in<bool> case_insensitive_, cpp2::impl::in<std::string> class_str_, cpp2::impl::in<std::string> str)
         : regex_token{ str }
         , negate{ negate_ }
         , case_insensitive{ case_insensitive_ }
         , class_str{ class_str_ }
-#line 2698 "reflect.h2"
+#line 4015 "reflect.h2"
     {
 
-#line 2703 "reflect.h2"
+#line 4020 "reflect.h2"
     }
 
-#line 2706 "reflect.h2"
+#line 4023 "reflect.h2"
     [[nodiscard]] auto class_token::parse(parse_context& ctx) -> token_ptr
     {
         if (ctx.current() != '[') {return nullptr; }
@@ -4564,7 +5706,7 @@ size_t i{0};
                 cur = create_matcher("" + cpp2::to_string(cpp2::move(name)) + "_class", "");
             }
             else {if (1 != cur.size()) {
-                cur = create_matcher("range_class_entry", "'" + cpp2::to_string(CPP2_ASSERT_IN_BOUNDS_LITERAL(cur, 0)) + "', '" + cpp2::to_string(CPP2_ASSERT_IN_BOUNDS_LITERAL(cur, 2)) + "'");
+                cur = create_matcher("range_class_entry", "'" + cpp2::string_build(cpp2::interp(CPP2_ASSERT_IN_BOUNDS_LITERAL(cur, 0)), "', '", cpp2::interp(CPP2_ASSERT_IN_BOUNDS_LITERAL(cur, 2))) + "'");
             }
             else {
                 cur = create_matcher("single_class_entry", "'" + cpp2::to_string(cur) + "'");
@@ -4581,29 +5723,27 @@ size_t i{0};
             ); 
     }
 
-#line 2831 "reflect.h2"
     auto class_token::generate_code(generation_context& ctx) const -> void
     {
-        ctx.add_check("class_token_matcher<char, " + cpp2::to_string(negate) + ", " + cpp2::to_string(case_insensitive) + ", " + cpp2::to_string(class_str) + ">::match(" + cpp2::to_string(ctx.match_parameters()) + ")");
+        ctx.add_check("class_token_matcher<char, " + cpp2::string_build(cpp2::interp(negate), ", ", cpp2::interp(case_insensitive), ", ", cpp2::interp(class_str), ">::match(", cpp2::interp(ctx.match_parameters())) + ")");
     }
 
-#line 2836 "reflect.h2"
     [[nodiscard]] auto class_token::create_matcher(cpp2::impl::in<std::string> name, cpp2::impl::in<std::string> template_arguments) -> std::string
     {
         auto sep {", "}; 
         if (template_arguments.empty()) {sep = ""; }
 
-        return "::cpp2::regex::" + cpp2::to_string(name) + "<char" + cpp2::to_string(cpp2::move(sep)) + cpp2::to_string(template_arguments) + ">"; 
+        return "::cpp2::regex::" + cpp2::string_build(cpp2::interp(name), "<char", cpp2::interp(cpp2::move(sep)), cpp2::interp(template_arguments)) + ">"; 
     }
 
     class_token::~class_token() noexcept{}
 
-#line 2848 "reflect.h2"
+#line 4165 "reflect.h2"
 [[nodiscard]] auto escape_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '\\') {return nullptr; }
 
-#line 2853 "reflect.h2"
+#line 4170 "reflect.h2"
     if (std::string::npos == std::string("afenrt^.[]()*{}?+|\\").find(ctx.peek())) {
         return nullptr; 
     }
@@ -4637,7 +5777,7 @@ size_t i{0};
 
 }
 
-#line 2889 "reflect.h2"
+#line 4206 "reflect.h2"
 [[nodiscard]] auto global_group_reset_token_parse(parse_context& ctx) -> token_ptr
 {
     if (!((ctx.current() == '\\' && ctx.peek() == 'K'))) {return nullptr; }
@@ -4646,18 +5786,17 @@ size_t i{0};
     return CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_code>)(cpp2::shared, "\\K", "ctx..set_group_start(0, r.pos);"); 
 }
 
-#line 2911 "reflect.h2"
+#line 4228 "reflect.h2"
     group_ref_token::group_ref_token(cpp2::impl::in<int> id_, cpp2::impl::in<bool> case_insensitive_, cpp2::impl::in<std::string> str)
         : regex_token{ str }
         , id{ id_ }
         , case_insensitive{ case_insensitive_ }
-#line 2912 "reflect.h2"
+#line 4229 "reflect.h2"
     {
 
-#line 2916 "reflect.h2"
+#line 4233 "reflect.h2"
     }
 
-#line 2918 "reflect.h2"
     [[nodiscard]] auto group_ref_token::parse(parse_context& ctx) -> token_ptr
     {
         if (ctx.current() != '\\') {return nullptr; }
@@ -4759,14 +5898,13 @@ size_t i{0};
         return CPP2_UFCS_TEMPLATE(cpp2_new<group_ref_token>)(cpp2::shared, cpp2::move(group_id), ctx.get_modifiers().has(expression_flags::case_insensitive), cpp2::move(str)); 
     }
 
-#line 3019 "reflect.h2"
     auto group_ref_token::generate_code(generation_context& ctx) const -> void{
-        ctx.add_check("group_ref_token_matcher<char, " + cpp2::to_string(id) + ", " + cpp2::to_string(case_insensitive) + ">(" + cpp2::to_string(ctx.match_parameters()) + ")");
+        ctx.add_check("group_ref_token_matcher<char, " + cpp2::string_build(cpp2::interp(id), ", ", cpp2::interp(case_insensitive), ">(", cpp2::interp(ctx.match_parameters())) + ")");
     }
 
     group_ref_token::~group_ref_token() noexcept{}
 
-#line 3042 "reflect.h2"
+#line 4359 "reflect.h2"
     [[nodiscard]] auto group_token::parse_lookahead(parse_context& ctx, cpp2::impl::in<std::string> syntax, cpp2::impl::in<bool> positive) -> token_ptr
     {
         static_cast<void>(ctx.next());// Skip last token defining the syntax
@@ -4776,12 +5914,11 @@ size_t i{0};
         auto old_state {ctx.start_group()}; 
         if (!(ctx.parse_until(')'))) {return ctx.error("Lookahead without a closing bracket."); }
         (*cpp2::impl::assert_not_null(r)).inner = ctx.end_group(cpp2::move(old_state));
-        (*cpp2::impl::assert_not_null(r)).set_string("(" + cpp2::to_string(syntax) + cpp2::to_string((*cpp2::impl::assert_not_null((*cpp2::impl::assert_not_null(r)).inner)).to_string()) + ")");
+        (*cpp2::impl::assert_not_null(r)).set_string("(" + cpp2::string_build(cpp2::interp(syntax), cpp2::interp((*cpp2::impl::assert_not_null((*cpp2::impl::assert_not_null(r)).inner)).to_string())) + ")");
 
         return r; 
     }
 
-#line 3056 "reflect.h2"
     [[nodiscard]] auto group_token::parse(parse_context& ctx) -> token_ptr
     {
         if (ctx.current() != '(') {return nullptr; }
@@ -4919,7 +6056,6 @@ size_t i{0};
         }
     }
 
-#line 3193 "reflect.h2"
     [[nodiscard]] auto group_token::gen_string(cpp2::impl::in<std::string> name, cpp2::impl::in<bool> name_brackets, cpp2::impl::in<bool> has_modifier, cpp2::impl::in<std::string> modifiers, cpp2::impl::in<token_ptr> inner_) -> std::string
     {
         std::string start {"("}; 
@@ -4938,7 +6074,6 @@ size_t i{0};
         return cpp2::move(start) + (*cpp2::impl::assert_not_null(inner_)).to_string() + ")"; 
     }
 
-#line 3211 "reflect.h2"
     auto group_token::generate_code(generation_context& ctx) const -> void
     {
         if (-1 != number) {
@@ -4954,12 +6089,11 @@ size_t i{0};
             ctx.add("    ctx&$*..set_group_invalid(" + cpp2::to_string(number) + ");");
             ctx.add("  }");
             ctx.add("};");
-            ctx.add("" + cpp2::to_string(tmp_name) + " :=  cpp2::regex::make_on_return(" + cpp2::to_string(tmp_name) + "_func);");
+            ctx.add("" + cpp2::string_build(cpp2::interp(tmp_name), " :=  cpp2::regex::make_on_return(", cpp2::interp(tmp_name)) + "_func);");
             ctx.add("_ = " + cpp2::to_string(cpp2::move(tmp_name)) + ";");// Logic is done in the destructor. Same behavior as for guard objects.
         }
     }
 
-#line 3231 "reflect.h2"
     auto group_token::add_groups(std::set<int>& groups) const -> void
     {
         (*cpp2::impl::assert_not_null(inner)).add_groups(groups);
@@ -4970,7 +6104,7 @@ size_t i{0};
 
     group_token::~group_token() noexcept{}
 
-#line 3243 "reflect.h2"
+#line 4560 "reflect.h2"
 [[nodiscard]] auto hexadecimal_token_parse(parse_context& ctx) -> token_ptr
 {
     if (!((ctx.current() == '\\' && ctx.peek() == 'x'))) {return nullptr; }
@@ -5009,7 +6143,7 @@ size_t i{0};
     return r; 
 }
 
-#line 3284 "reflect.h2"
+#line 4601 "reflect.h2"
 [[nodiscard]] auto line_end_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() == '$' || (ctx.current() == '\\' && ctx.peek() == '$')) {
@@ -5027,7 +6161,7 @@ size_t i{0};
     }}
 }
 
-#line 3304 "reflect.h2"
+#line 4621 "reflect.h2"
 [[nodiscard]] auto line_start_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '^' && !((ctx.current() == '\\' && ctx.peek() == 'A'))) {return nullptr; }
@@ -5041,29 +6175,27 @@ size_t i{0};
     }
 }
 
-#line 3329 "reflect.h2"
+#line 4646 "reflect.h2"
     lookahead_token::lookahead_token(cpp2::impl::in<bool> positive_)
         : regex_token{ "" }
         , positive{ positive_ }{
 
-#line 3331 "reflect.h2"
+#line 4648 "reflect.h2"
     }
 
-#line 3333 "reflect.h2"
     auto lookahead_token::generate_code(generation_context& ctx) const -> void{
         auto inner_name {ctx.generate_func(inner)}; 
 
-        ctx.add_check("lookahead_token_matcher<char, " + cpp2::to_string(positive) + ">(" + cpp2::to_string(ctx.match_parameters()) + ", " + cpp2::to_string(cpp2::move(inner_name)) + ")");
+        ctx.add_check("lookahead_token_matcher<char, " + cpp2::string_build(cpp2::interp(positive), ">(", cpp2::interp(ctx.match_parameters()), ", ", cpp2::interp(cpp2::move(inner_name))) + ")");
     }
 
-#line 3339 "reflect.h2"
     auto lookahead_token::add_groups(std::set<int>& groups) const -> void{
         (*cpp2::impl::assert_not_null(inner)).add_groups(groups);
     }
 
     lookahead_token::~lookahead_token() noexcept{}
 
-#line 3347 "reflect.h2"
+#line 4664 "reflect.h2"
 [[nodiscard]] auto named_class_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '\\') {return nullptr; }
@@ -5086,10 +6218,10 @@ size_t i{0};
 
     static_cast<void>(ctx.next());// Skip escape
 
-    return CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_check>)(cpp2::shared, "\\" + cpp2::to_string(ctx.current()) + "", "" + cpp2::to_string(cpp2::move(name)) + "<char, " + cpp2::to_string(ctx.get_modifiers().has(expression_flags::case_insensitive)) + ">::match"); 
+    return CPP2_UFCS_TEMPLATE(cpp2_new<regex_token_check>)(cpp2::shared, "\\" + cpp2::to_string(ctx.current()) + "", "" + cpp2::string_build(cpp2::interp(cpp2::move(name)), "<char, ", cpp2::interp(ctx.get_modifiers().has(expression_flags::case_insensitive))) + ">::match"); 
 }
 
-#line 3375 "reflect.h2"
+#line 4692 "reflect.h2"
 [[nodiscard]] auto octal_token_parse(parse_context& ctx) -> token_ptr
 {
     if (!((ctx.current() == '\\' && ctx.peek() == 'o'))) {return nullptr; }
@@ -5115,11 +6247,11 @@ size_t i{0};
     return r; 
 }
 
-#line 3412 "reflect.h2"
+#line 4729 "reflect.h2"
     range_token::range_token()
                              : regex_token{ "" }{}
 
-#line 3414 "reflect.h2"
+#line 4731 "reflect.h2"
     [[nodiscard]] auto range_token::parse(parse_context& ctx) -> token_ptr
     {
         auto r {CPP2_UFCS_TEMPLATE(cpp2_new<range_token>)(cpp2::shared)}; 
@@ -5179,7 +6311,7 @@ size_t i{0};
                 }
                 if (-1 != (*cpp2::impl::assert_not_null(r)).min_count) {
                     if (!((cpp2::impl::cmp_less_eq((*cpp2::impl::assert_not_null(r)).min_count,(*cpp2::impl::assert_not_null(r)).max_count)))) {
-                        return ctx.error("Min and max values in range are wrong it should hold 0 <= min <= max. Have 0 <= " + cpp2::to_string((*cpp2::impl::assert_not_null(r)).min_count) + " <= " + cpp2::to_string((*cpp2::impl::assert_not_null(r)).max_count) + ""); 
+                        return ctx.error("Min and max values in range are wrong it should hold 0 <= min <= max. Have 0 <= " + cpp2::string_build(cpp2::interp((*cpp2::impl::assert_not_null(r)).min_count), " <= ", cpp2::interp((*cpp2::impl::assert_not_null(r)).max_count)) + ""); 
                     }
                 }
             }
@@ -5193,7 +6325,6 @@ size_t i{0};
         return nullptr; 
     }
 
-#line 3487 "reflect.h2"
     auto range_token::parse_modifier(parse_context& ctx) & -> void
     {
         if (ctx.peek() == '?') {
@@ -5206,7 +6337,6 @@ size_t i{0};
         }}
     }
 
-#line 3499 "reflect.h2"
     [[nodiscard]] auto range_token::gen_mod_string() const& -> std::string
     {
         if (kind == range_flags::not_greedy) {
@@ -5220,7 +6350,6 @@ size_t i{0};
         }}
     }
 
-#line 3512 "reflect.h2"
     [[nodiscard]] auto range_token::gen_range_string() const& -> std::string
     {
         std::string r {""}; 
@@ -5234,13 +6363,12 @@ size_t i{0};
             r += "{" + cpp2::to_string(min_count) + ",}";
         }
         else {
-            r += "{" + cpp2::to_string(min_count) + "," + cpp2::to_string(max_count) + "}";
+            r += "{" + cpp2::string_build(cpp2::interp(min_count), ",", cpp2::interp(max_count)) + "}";
         }}}
 
         return r; 
     }
 
-#line 3531 "reflect.h2"
     auto range_token::generate_code(generation_context& ctx) const -> void
     {
         auto inner_name {ctx.generate_func(inner_token)}; 
@@ -5249,17 +6377,16 @@ size_t i{0};
         auto reset_name {ctx.generate_reset(cpp2::move(groups))}; 
 
         auto next_name {ctx.next_func_name()}; 
-        ctx.add_statefull(next_name, "cpp2::regex::range_token_matcher<char, " + cpp2::to_string(min_count) + ", " + cpp2::to_string(max_count) + ", " + cpp2::to_string(kind) + ">::match(" + cpp2::to_string(ctx.match_parameters()) + ", " + cpp2::to_string(cpp2::move(inner_name)) + ", " + cpp2::to_string(cpp2::move(reset_name)) + ", other, " + cpp2::to_string(next_name) + ")");
+        ctx.add_statefull(next_name, "cpp2::regex::range_token_matcher<char, " + cpp2::string_build(cpp2::interp(min_count), ", ", cpp2::interp(max_count), ", ", cpp2::interp(kind), ">::match(", cpp2::interp(ctx.match_parameters()), ", ", cpp2::interp(cpp2::move(inner_name)), ", ", cpp2::interp(cpp2::move(reset_name)), ", other, ", cpp2::interp(next_name)) + ")");
     }
 
-#line 3542 "reflect.h2"
     auto range_token::add_groups(std::set<int>& groups) const -> void{
         (*cpp2::impl::assert_not_null(inner_token)).add_groups(groups);
     }
 
     range_token::~range_token() noexcept{}
 
-#line 3555 "reflect.h2"
+#line 4872 "reflect.h2"
     [[nodiscard]] auto special_range_token::parse(parse_context& ctx) -> token_ptr
     {
         auto r {CPP2_UFCS_TEMPLATE(cpp2_new<special_range_token>)(cpp2::shared)}; 
@@ -5283,7 +6410,7 @@ size_t i{0};
 
         if (!(ctx.has_token())) {return ctx.error("'" + cpp2::to_string(ctx.current()) + "' without previous element."); }
 
-#line 3579 "reflect.h2"
+#line 4896 "reflect.h2"
         (*cpp2::impl::assert_not_null(r)).parse_modifier(ctx);
 
         (*cpp2::impl::assert_not_null(r)).inner_token = ctx.pop_token();
@@ -5293,7 +6420,7 @@ size_t i{0};
 
     special_range_token::~special_range_token() noexcept{}
 
-#line 3592 "reflect.h2"
+#line 4909 "reflect.h2"
 [[nodiscard]] auto word_boundary_token_parse(parse_context& ctx) -> token_ptr
 {
     if (ctx.current() != '\\') {return nullptr; }
@@ -5311,15 +6438,14 @@ size_t i{0};
     }}
 }
 
-#line 3628 "reflect.h2"
+#line 4945 "reflect.h2"
     template <typename Error_out> regex_generator<Error_out>::regex_generator(cpp2::impl::in<std::string_view> r, Error_out const& e)
         : regex{ r }
         , error_out{ e }{
 
-#line 3631 "reflect.h2"
+#line 4948 "reflect.h2"
     }
 
-#line 3633 "reflect.h2"
     template <typename Error_out> [[nodiscard]] auto regex_generator<Error_out>::parse() & -> std::string
     {
         // Extract modifiers and adapt regex.
@@ -5346,8 +6472,10 @@ size_t i{0};
         source += cpp2::move(gen_ctx).create_named_group_lookup(parse_ctx.named_groups);
         source += "}\n";
 
+        source += extract_prefilter();
+
         auto string {(*cpp2::impl::assert_not_null(parse_ctx.get_as_token())).to_string()}; 
-        source += "  to_string: () -> std::string = { return R\"(" + cpp2::to_string(modifier_escape) + cpp2::to_string(cpp2::move(string)) + cpp2::to_string(modifier_escape) + cpp2::to_string(modifier) + ")\"; }\n";
+        source += "  to_string: () -> std::string = { return R\"(" + cpp2::string_build(cpp2::interp(modifier_escape), cpp2::interp(cpp2::move(string)), cpp2::interp(modifier_escape), cpp2::interp(modifier)) + ")\"; }\n";
         source += "}\n";
 
         static_cast<void>(cpp2::move(parse_ctx));
@@ -5355,7 +6483,87 @@ size_t i{0};
         return source; 
     }
 
-#line 3668 "reflect.h2"
+#line 4991 "reflect.h2"
+    template <typename Error_out> [[nodiscard]] auto regex_generator<Error_out>::extract_prefilter() const& -> std::string
+    {
+        std::string none {"  prefilter: type == cpp2::regex::prefilter<\"\", false>;\n"}; 
+
+        if (!(modifier.empty())) {
+            return none; // Modifiers can change anchoring and case rules.
+        }
+
+        auto n {cpp2::unchecked_narrow<int>(regex.size())}; 
+
+        //  A top-level alternative can start a match with anything.
+        auto i {0}; 
+        auto depth {0}; 
+        auto in_class {false}; 
+        for( ; cpp2::impl::cmp_less(i,n); (++i) ) {
+            auto c {CPP2_ASSERT_IN_BOUNDS(regex, i)}; 
+            if (c == '\\') {++i; }
+            else {if (in_class) {if (cpp2::move(c) == ']') {in_class = false; }}
+            else {if (c == '[') {in_class = true; }
+            else {if (c == '(') {++depth; }
+            else {if (c == ')') {--depth; }
+            else {if (cpp2::move(c) == '|' && depth == 0) {return none; }}}}}}
+        }
+
+        std::string_view metas {".[({*+?|$"}; 
+        std::string_view quantifiers {"*+?{"}; 
+
+        auto anchored {false}; 
+        std::string prefix {""}; 
+
+        auto pos {0}; 
+        if (cpp2::impl::cmp_less(0,n) && CPP2_ASSERT_IN_BOUNDS_LITERAL(regex, 0) == '^') {
+            anchored = true;
+            pos = 1;
+        }
+
+        while( cpp2::impl::cmp_less(pos,n) ) {
+            auto c {CPP2_ASSERT_IN_BOUNDS(regex, pos)}; 
+            auto lit {c}; 
+            auto width {1}; 
+            if (c == '\\') {
+                if (cpp2::impl::cmp_greater_eq(pos + 1,n)) {break; }
+                lit = CPP2_ASSERT_IN_BOUNDS(regex, pos + 1);
+                width = 2;
+                if (std::isalnum(byte_of(lit)) != 0) {break; }// \d, \b, \1, ... are not literals.
+            }
+            else {if (metas.find(cpp2::move(c)) != std::string_view::npos) {break; }}
+
+            //  A quantifier makes the character it governs unreliable...
+            if (cpp2::impl::cmp_less(pos + width,n) && quantifiers.find(CPP2_ASSERT_IN_BOUNDS(regex, pos + width)) != std::string_view::npos) {
+                if (CPP2_ASSERT_IN_BOUNDS(regex, pos + width) == '+') {
+                    prefix += lit; // ...except '+', which still requires one occurrence.
+                }
+                break;
+            }
+
+            prefix += cpp2::move(lit);
+            pos += cpp2::move(width);
+        }
+
+        if (prefix.empty() && !(anchored)) {
+            return none; 
+        }
+
+        //  Escape every prefix byte as three octal digits so that nothing
+        //  in it can collide with string interpolation or escape rules.
+        std::string escaped {""}; 
+        for ( cpp2::impl::in<char> c : cpp2::move(prefix) ) {
+            auto oct {string_util::int_to_string<8>(byte_of(c))}; 
+            while( cpp2::impl::cmp_less(oct.size(),3u) ) {
+                oct = "0" + oct;
+            }
+            escaped += "\\" + cpp2::move(oct);
+        }
+
+        return "  prefilter: type == cpp2::regex::prefilter<\"" + cpp2::string_build(cpp2::interp(cpp2::move(escaped)), "\", ", cpp2::interp(cpp2::move(anchored))) + ">;\n"; 
+    }
+
+    template <typename Error_out> [[nodiscard]] auto regex_generator<Error_out>::byte_of(cpp2::impl::in<char> c) -> int { return (cpp2::unchecked_narrow<int>(c) + 256) % 256;  }
+
     template <typename Error_out> auto regex_generator<Error_out>::extract_modifiers() & -> void
     {
         if (regex.find_first_of("'/") == 0) {
@@ -5371,16 +6579,65 @@ size_t i{0};
         }
     }
 
-#line 3684 "reflect.h2"
+#line 5094 "reflect.h2"
+template<typename Err> [[nodiscard]] auto regex_expansion_in_budget(cpp2::impl::in<std::string_view> pattern, cpp2::impl::in<std::string_view> generated, Err err) -> bool
+{
+    auto limit {cpp2::flag_max_regex_expansion * 1024}; 
+    if (cpp2::impl::cmp_less_eq(limit,0) || cpp2::impl::cmp_less_eq(std::ssize(generated),limit)) {
+        return true; 
+    }
+
+    auto states {0}; 
+    auto pos {CPP2_UFCS(find)(generated, "@struct<noforward> type")}; 
+    while( pos != std::string_view::npos ) {
+        ++states;
+        pos = CPP2_UFCS(find)(generated, "@struct<noforward> type", pos + 1);
+    }
+
+    std::string details {""}; 
+    if (cpp2::impl::cmp_greater(states,0)) {
+        details = " in " + cpp2::to_string(cpp2::move(states)) + " matcher states";
+    }
+    cpp2::move(err)("regular expression '" + cpp2::string_build(cpp2::interp(pattern), "' expanded to ", cpp2::interp(CPP2_UFCS(size)(generated)), " bytes", cpp2::interp(cpp2::move(details)), ", over the -max-regex-expansion budget of ", cpp2::interp(cpp2::flag_max_regex_expansion)) + " KB");
+    return false; 
+}
+
+#line 5117 "reflect.h2"
 template<typename Err> [[nodiscard]] auto generate_regex(cpp2::impl::in<std::string_view> regex, Err const& err) -> std::string
 {
+    //  Lowering a pattern is pure in its text, so reuse a previous
+    //  lowering of the same pattern when there is one
+    //
+    std::string key {regex}; 
+    auto iter {generated_regex_memo.find(key)}; 
+    if (iter != generated_regex_memo.end()) {
+        return (*cpp2::impl::assert_not_null(cpp2::move(iter))).second; 
+    }
+
+    //  ... including a lowering done by a previous build, when
+    //  -cache-dir gives the expansions a cross-build home
+    //
+    auto cached {the_metafunction_cache.lookup("regex:" + key)}; 
+    if (cached.has_value()) {
+        CPP2_ASSERT_IN_BOUNDS(generated_regex_memo, key) = cached.value();
+        return cpp2::move(cached).value(); 
+    }
+
     regex_generator<Err> parser {regex, err}; 
     auto r {parser.parse()}; 
     static_cast<void>(cpp2::move(parser));
+
+    //  Memoize successes only, so that a repeated bad pattern still
+    //  gets its diagnostic at every use site
+    //
+    if (!(r.empty())) {
+        CPP2_ASSERT_IN_BOUNDS(generated_regex_memo, key) = r;
+        the_metafunction_cache.store("regex:" + cpp2::move(key), r);
+    }
     return r; 
 }
 
-#line 3694 "reflect.h2"
+#line 5153 "reflect.h2"
 auto regex_gen(meta::type_declaration& t) -> void
 {
     auto has_default {false}; 
@@ -5388,6 +6645,17 @@ auto regex_gen(meta::type_declaration& t) -> void
     auto prefix {"regex_"}; 
     std::map<std::string,std::string> expressions {}; 
 
+    //  @regex<dfa> opts in to table-driven linear-time matchers for
+    //  the restricted dialect handled by dfa_regex::builder, and
+    //  @regex<onepass> to straight-line matchers for the anchored
+    //  unambiguous patterns accepted by onepass_regex::builder
+    //
+    auto dfa_mode {CPP2_UFCS(get_argument)(t, 0) == "dfa"}; 
+    auto onepass_mode {CPP2_UFCS(get_argument)(t, 0) == "onepass"}; 
+    if (!(cpp2::move(dfa_mode)) && !(cpp2::move(onepass_mode)) && !(CPP2_UFCS(empty)(CPP2_UFCS(get_argument)(t, 0)))) {
+        CPP2_UFCS(error)(t, "unknown regex metafunction argument '" + CPP2_UFCS(get_argument)(t, 0) + "' - supported modes are 'dfa' and 'onepass'");
+    }
+
     for ( auto& m : CPP2_UFCS(get_member_objects)(t) ) 
     {
         std::string name {CPP2_UFCS(name)(m)}; 
@@ -5423,19 +6691,169 @@ auto regex_gen(meta::type_declaration& t) -> void
 
     CPP2_UFCS(remove_marked_members)(t);
 
+    //  Identical pattern text lowers to an identical matcher, so emit
+    //  the full matcher type once per distinct pattern and alias any
+    //  further members to it - one line for add_member to re-parse
+    //  instead of the whole matcher again
+    //
+    std::map<std::string,std::string> matcher_of {}; 
+
     for ( auto const& expr : cpp2::move(expressions) ) {
-        auto regular_expression {generate_regex(expr.second, [_0 = t](auto const& message) mutable -> decltype(auto) { return CPP2_UFCS(error)(_0, message);  })}; 
+        if (CPP2_UFCS(contains)(matcher_of, expr.second)) {
+            CPP2_UFCS(add_member)(t, "public " + cpp2::string_build(cpp2::interp(expr.first), "_matcher: type == ", cpp2::interp(CPP2_ASSERT_IN_BOUNDS(cpp2::move(matcher_of), expr.second))) + "_matcher;");
+            CPP2_UFCS(add_member)(t, "public " + cpp2::string_build(cpp2::interp(expr.first), ": cpp2::regex::regular_expression<char, ", cpp2::interp(expr.first)) + "_matcher> = ();");
+            if (dfa_mode) {
+                CPP2_UFCS(add_member)(t, "public " + cpp2::string_build(cpp2::interp(expr.first), "_stream: type == ", cpp2::interp(expr.first)) + "_matcher::stream_match;");
+            }
+            continue;
+        }
+
+        //  These lowerings are pure in the pattern text too, so a hit in
+        //  the cross-build cache skips the builder entirely
+        //
+        std::string cache_key {}; 
+        if (dfa_mode) {
+            cache_key = "regex<dfa>:" + expr.second;
+        }
+        else {if (onepass_mode) {
+            cache_key = "regex<onepass>:" + expr.second;
+        }}
+
+        std::string regular_expression {}; 
+        auto cached {the_metafunction_cache.lookup(cache_key)}; 
+        if (!(cache_key.empty()) && cached.has_value()) {
+            regular_expression = cpp2::move(cached).value();
+        }
+        else {if (cpp2::move(dfa_mode)) {
+            dfa_regex::builder gen {}; 
+            regular_expression = CPP2_UFCS(compile)(gen, expr.second);
+            if (!(CPP2_UFCS(empty)(CPP2_UFCS(error)(gen)))) {
+                CPP2_UFCS(error)(t, "regular expression '" + expr.second + "': " + CPP2_UFCS(error)(gen));
+            }
+            static_cast<void>(cpp2::move(gen));
+        }
+        else {if (cpp2::move(onepass_mode)) {
+            onepass_regex::builder gen {}; 
+            regular_expression = CPP2_UFCS(compile)(gen, expr.second);
+            if (!(CPP2_UFCS(empty)(CPP2_UFCS(error)(gen)))) {
+                CPP2_UFCS(error)(t, "regular expression '" + expr.second + "': " + CPP2_UFCS(error)(gen));
+            }
+            static_cast<void>(cpp2::move(gen));
+        }
+        else {
+            regular_expression = generate_regex(expr.second, [_0 = t](auto const& message) mutable -> decltype(auto) { return CPP2_UFCS(error)(_0, message);  });
+        }}}
+
+        //  The budget check also covers cache hits, so a -cache-dir
+        //  populated by a build that ran without the budget cannot
+        //  smuggle an over-budget expansion past it
+        //
+        if (!(regex_expansion_in_budget(expr.second, regular_expression, [_0 = t](auto const& message) mutable -> decltype(auto) { return CPP2_UFCS(error)(_0, message);  }))) {
+            regular_expression = "";
+        }
 
         if (!(regular_expression.empty())) {
-            CPP2_UFCS(add_member)(t, "public " + cpp2::to_string(expr.first) + "_matcher: type = " + cpp2::to_string(cpp2::move(regular_expression)) + "");
-            CPP2_UFCS(add_member)(t, "public " + cpp2::to_string(expr.first) + ": cpp2::regex::regular_expression<char, " + cpp2::to_string(expr.first) + "_matcher> = ();");
+            if (!(cache_key.empty())) {
+                the_metafunction_cache.store(cpp2::move(cache_key), regular_expression);
+            }
+            if (dfa_mode) {
+                CPP2_UFCS(add_member)(t, "public " + cpp2::string_build(cpp2::interp(expr.first), "_matcher: type == ", cpp2::interp(cpp2::move(regular_expression))) + ";");
+                CPP2_UFCS(add_member)(t, "public " + cpp2::string_build(cpp2::interp(expr.first), "_stream: type == ", cpp2::interp(expr.first)) + "_matcher::stream_match;");
+            }
+            else {
+                CPP2_UFCS(add_member)(t, "public " + cpp2::string_build(cpp2::interp(expr.first), "_matcher: type = ", cpp2::interp(cpp2::move(regular_expression))) + "");
+            }
+            CPP2_UFCS(add_member)(t, "public " + cpp2::string_build(cpp2::interp(expr.first), ": cpp2::regex::regular_expression<char, ", cpp2::interp(expr.first)) + "_matcher> = ();");
+            CPP2_ASSERT_IN_BOUNDS(matcher_of, expr.second) = expr.first;
+        }
+    }
+
+    CPP2_UFCS(add_runtime_support_include)(t, "cpp2regex.h");
+}
+
+#line 5300 "reflect.h2"
+auto regex_set_gen(meta::type_declaration& t) -> void
+{
+    auto prefix {"regex_"}; 
+    std::vector<std::string> patterns {}; 
+
+    if (!(CPP2_UFCS(empty)(CPP2_UFCS(get_argument)(t, 0)))) {
+        CPP2_UFCS(error)(t, "@regex_set does not take arguments");
+    }
+
+    for ( auto& m : CPP2_UFCS(get_member_objects)(t) ) 
+    {
+        std::string name {CPP2_UFCS(name)(m)}; 
+
+        if (CPP2_UFCS(starts_with)(cpp2::move(name), prefix)) 
+        {
+            if (!(CPP2_UFCS(has_initializer)(m))) {
+                CPP2_UFCS(error)(t, "Regular expression must have an initializer.");
+            }
+            CPP2_UFCS(mark_for_removal_from_enclosing_type)(m);
+
+            std::string expr {CPP2_UFCS(initializer)(m)}; 
+            if (CPP2_UFCS(starts_with)(expr, "R\"(") && CPP2_UFCS(ends_with)(expr, ")\"")) {
+                expr = CPP2_UFCS(substr)(expr, 3, CPP2_UFCS(size)(expr) - 5);
+            }
+            else {if (string_util::is_escaped(expr)) {
+                expr = CPP2_UFCS(substr)(expr, 1, CPP2_UFCS(size)(expr) - 2);
+            }
+            else {
+                CPP2_UFCS(error)(t, "Unknown string format '" + cpp2::to_string(expr) + "'");
+            }}
+
+            CPP2_UFCS(push_back)(patterns, cpp2::move(expr));
+        }
+    }
+
+    CPP2_UFCS(remove_marked_members)(t);
+
+    if (CPP2_UFCS(empty)(patterns)) {
+        CPP2_UFCS(error)(t, "@regex_set needs at least one member whose name starts with 'regex_'");
+        return ; 
+    }
+
+    //  Key the cross-build cache on all the patterns, length-prefixed
+    //  so that pattern text containing the separator cannot collide
+    //
+    std::string cache_key {"regex-set"}; 
+    for ( auto const& p : patterns ) {
+        cache_key += ":" + std::to_string(p.size()) + ":" + p;
+    }
+
+    std::string table {}; 
+    auto cached {the_metafunction_cache.lookup(cache_key)}; 
+    if (cached.has_value()) {
+        table = cpp2::move(cached).value();
+    }
+    else {
+        dfa_regex::builder gen {}; 
+        table = CPP2_UFCS(compile_set)(gen, patterns);
+        if (!(CPP2_UFCS(empty)(CPP2_UFCS(error)(gen)))) {
+            CPP2_UFCS(error)(t, "regex set: " + CPP2_UFCS(error)(gen));
         }
+        static_cast<void>(cpp2::move(gen));
+        if (!(table.empty())) {
+            the_metafunction_cache.store(cpp2::move(cache_key), table);
+        }
+    }
+
+    std::string set_label {"(set of " + cpp2::to_string(CPP2_UFCS(ssize)(patterns)) + " patterns)"}; 
+    if (!(regex_expansion_in_budget(cpp2::move(set_label), table, [_0 = t](auto const& message) mutable -> decltype(auto) { return CPP2_UFCS(error)(_0, message);  }))) {
+        table = "";
+    }
+
+    if (!(table.empty())) {
+        CPP2_UFCS(add_member)(t, "public table: type == " + cpp2::to_string(cpp2::move(table)) + ";");
+        CPP2_UFCS(add_member)(t, "public scanner: type == table::scanner;");
+        CPP2_UFCS(add_member)(t, "public match_all: (subject: std::string_view) -> cpp2::regex::regex_set_result<" + cpp2::to_string(CPP2_UFCS(ssize)(cpp2::move(patterns))) + "> = { return table::scan(subject); }");
     }
 
     CPP2_UFCS(add_runtime_support_include)(t, "cpp2regex.h");
 }
 
-#line 3753 "reflect.h2"
+#line 5386 "reflect.h2"
 [[nodiscard]] auto apply_metafunctions(
     declaration_node& n, 
     type_declaration& rtype, 
@@ -5484,6 +6902,9 @@ auto regex_gen(meta::type_declaration& t) -> void
         else {if (name == "polymorphic_base") {
             polymorphic_base(rtype);
         }
+        else {if (name == "fast_rtti") {
+            fast_rtti(rtype);
+        }
         else {if (name == "ordered") {
             ordered(rtype);
         }
@@ -5535,20 +6956,23 @@ auto regex_gen(meta::type_declaration& t) -> void
         else {if (name == "regex") {
             regex_gen(rtype);
         }
-        else {
+        else {if (name == "regex_set") {
+            regex_set_gen(rtype);
+        }
+        else {if (!(apply_plugin_metafunctions(name, rtype))) {
             error("unrecognized metafunction name: " + cpp2::move(name));
             error(
                 "the current supported names are listed at "
                 "https://hsutter.github.io/cppfront/cpp2/metafunctions/#built-in-metafunctions"
             );
             return false; 
-        }}}}}}}}}}}}}}}}}}}
+        }}}}}}}}}}}}}}}}}}}}}}
     }
 
     return true; 
 }
 
-#line 3866 "reflect.h2"
+#line 5505 "reflect.h2"
 }
 
 }
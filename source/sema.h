@@ -14,6 +14,8 @@
 #define CPP2_SEMA_H
 
 #include "reflect.h"
+#include <atomic>
+#include <unordered_set>
 
 
 namespace cpp2 {
@@ -41,14 +43,49 @@ auto parser::apply_type_metafunctions( declaration_node& n )
 //
 //-----------------------------------------------------------------------
 //
+
+//  node_handle: a 32-bit arena offset standing in for a node pointer
+//
+//  Symbol records are the most numerous objects in a large compile
+//  after tokens, and the linear passes over the symbol table are cache
+//  bound - storing each AST reference in 4 bytes instead of 8 packs
+//  about twice as many records per cache line. The handle converts
+//  implicitly from and to the pointer type, so use sites read the same
+//  as before; translation is one indexed load (see ast_node_arena)
+//
+template <typename Node>
+class node_handle
+{
+    u32 h = 0;
+
+public:
+    node_handle() = default;
+    node_handle(Node const* p) : h{ node_arena.to_handle(p) } { }
+
+    auto get() const
+        -> Node const*
+    {
+        return static_cast<Node const*>(node_arena.to_pointer(h));
+    }
+
+    operator Node const*() const { return get(); }
+
+    auto operator->() const
+        -> Node const*
+    {
+        assert (h != 0);
+        return get();
+    }
+};
+
 struct declaration_sym {
-    bool                              start        = false;
-    declaration_node const*           declaration  = {};
-    token const*                      identifier   = {};
-    statement_node const*             initializer  = {};
-    parameter_declaration_node const* parameter    = {};
-    bool                              member       = false;
-    bool                              return_param = false;
+    token const*                            identifier   = {};
+    node_handle<declaration_node>           declaration  = {};
+    node_handle<statement_node>             initializer  = {};
+    node_handle<parameter_declaration_node> parameter    = {};
+    bool                                    start        = false;
+    bool                                    member       = false;
+    bool                                    return_param = false;
 
     declaration_sym(
         bool                              s     = false,
@@ -59,11 +96,11 @@ struct declaration_sym {
         bool                              mem   = false,
         bool                              ret   = false
     )
-        : start{s}
+        : identifier{id}
         , declaration{decl}
-        , identifier{id}
         , initializer{init}
         , parameter{param}
+        , start{s}
         , member{mem}
         , return_param{ret}
     { }
@@ -141,7 +178,7 @@ struct identifier_sym {
 
 struct selection_sym {
     bool start = false;
-    selection_statement_node const* selection = {};
+    node_handle<selection_statement_node> selection = {};
 
     selection_sym(
         bool                            s,
@@ -168,7 +205,7 @@ struct selection_sym {
 
 struct compound_sym {
     bool start = false;
-    compound_statement_node const* compound = {};
+    node_handle<compound_statement_node> compound = {};
     enum kind : u8 { is_scope, is_true, is_false, is_loop } kind_ = is_scope;
 
     compound_sym(
@@ -284,39 +321,12 @@ struct symbol {
         }
     }
 
-    auto get_global_token_order() const
-        -> index_t
-    {
-        if (auto t = get_token()) {
-            return t->get_global_token_order();
-        }
-        return 0;
-    }
 };
 
 
-//  Keep a list of all token*'s found that are definite first uses
-//  of the form "x = expr;" for an uninitialized local variable x,
-//  which we will rewrite to construct the local variable.
-//
-std::vector<token const*> definite_initializations;
-
-auto is_definite_initialization(token const* t)
-    -> bool
-{
-    return
-        std::find(
-            definite_initializations.begin(),
-            definite_initializations.end(),
-            t
-            )
-        != definite_initializations.end();
-}
-
-
-//  Keep a list of all token*'s found that are definite last uses
-//  for a local variable or copy or forward parameter x, which we
-//   will rewrite to move or forward from the variable.
+//  A definite last use found for a local variable or copy or forward
+//  parameter x, which we will rewrite to move or forward from the
+//  variable - see sema::definite_last_uses
 //
 struct last_use {
     token const* t;
@@ -335,23 +345,42 @@ struct last_use {
 
     bool operator==(last_use const& that) { return t == that.t; }
 };
-std::vector<last_use> definite_last_uses;
 
-auto is_definite_last_use(token const* t)
-    -> last_use const*
-{
-    auto iter = std::find(
-            definite_last_uses.begin(),
-            definite_last_uses.end(),
-            t
-            );
-    if (iter != definite_last_uses.end()) {
-        return &*iter;
-    }
-    else {
-        return {};
-    }
-}
+static auto flag_parallel_sema = false;
+static cmdline_processor::register_flag cmd_parallel_sema(
+    9,
+    "parallel-sema",
+    "Run independent sema analyses on worker threads",
+    []{ flag_parallel_sema = true; }
+);
+
+static auto flag_demote_nonescaping_new = false;
+static cmdline_processor::register_flag cmd_demote_nonescaping_new(
+    9,
+    "demote-nonescaping-new",
+    "Lower unique.new/shared.new locals that provably never escape their function to stack storage / unique_ptr",
+    []{ flag_demote_nonescaping_new = true; }
+);
+
+static auto flag_emit_symbols = std::string{};
+static cmdline_processor::register_flag cmd_emit_symbols(
+    9,
+    "emit-symbols file.cpsym",
+    "Also write the symbol table to this file in a compact binary format for external tooling",
+    nullptr,
+    [](std::string const& file) { flag_emit_symbols = file; }
+);
+
+
+//  Optional read-only index of a compiled prelude's namespace-scope
+//  declarations, shared across the per-file compiles of one invocation
+//  (see -include-prelude). Filled once on the main thread before any
+//  per-file compile starts, then only read - including from -jobs
+//  worker threads. It is keyed by identifier text, not token address,
+//  because each compile's tokens are distinct objects from the
+//  prelude's
+//
+static std::unordered_map<std::string_view, declaration_sym const*> prelude_global_declarations = {};
 
 
 //-----------------------------------------------------------------------
@@ -365,7 +394,34 @@ class sema
 public:
     std::vector<error_entry>& errors;
     stable_vector<symbol>     symbols;
-    index_t                   global_token_counter = 1;
+
+    //  Dense (kind, start, depth) records in the same order as 'symbols'.
+    //  The last-use scans test kind and depth far more often than they
+    //  touch the rest of a symbol record, so iterating this contiguous
+    //  8-byte sidecar keeps those scans in cache on large functions
+    //
+    struct symbol_brief {
+        u8   kind;
+        bool start;
+        int  depth;
+    };
+    std::vector<symbol_brief> symbol_briefs;
+
+    //  Scope-tree parent pointers: for each symbol, the position of the
+    //  next symbol at a shallower depth - i.e., the first symbol past
+    //  every scope this one is nested in. Lets the analyses jump over a
+    //  whole enclosed scope in one step instead of scanning through it
+    //
+    std::vector<int>          next_shallower;
+
+    //  Name-use index: for each interned identifier id, the ascending
+    //  positions of the identifier symbols that are uses of that name.
+    //  Built in the same bulk sweep as symbol_briefs, it clamps each
+    //  last-use scan to the name's final use - for a flat function with
+    //  many locals that turns whole-scope scans per variable into scans
+    //  of each variable's own live range
+    //
+    std::unordered_map<int32_t, std::vector<int>> use_positions_by_name;
 
     std::vector<selection_statement_node const*> active_selections;
     std::vector<iteration_statement_node const*> active_iterations;
@@ -379,6 +435,20 @@ public:
     };
     std::unordered_map< token const*, declaration_of_t > declaration_of;
 
+    //  The token*'s found to be definite first uses "x = expr;" of an
+    //  uninitialized local x (rewritten to construct the variable), and
+    //  the definite last uses of locals and copy/forward parameters
+    //  (rewritten to move or forward from them). Keyed by token, so the
+    //  per-identifier queries during emission are O(1) hash lookups -
+    //  a linear scan here went quadratic on files with many functions.
+    //  As members they also can't carry entries across compiles the way
+    //  the former globals did
+    //
+    //  mutable: filled from ensure_definitely_initialized, which is
+    //  const like the rest of the read-only analysis passes
+    mutable std::unordered_set<token const*>   definite_initializations;
+    std::unordered_map<token const*, last_use> definite_last_uses;
+
 public:
     //-----------------------------------------------------------------------
     //  Constructor
@@ -392,6 +462,40 @@ public:
     {
     }
 
+    //  Pre-size 'symbols' before the visit pass fills it, from the
+    //  caller's token count and the empirically-fit symbols-per-token
+    //  density (about 0.45 on symbol-dense code, so half the token
+    //  count over-estimates a little - that's the cheap direction).
+    //  The estimate is kept so -stats can report how well it predicted
+    //
+    size_t predicted_symbols = 0;
+
+    auto reserve_symbols(size_t num_tokens)
+        -> void
+    {
+        predicted_symbols = num_tokens / 2 + 1;
+        symbols.reserve( predicted_symbols );
+    }
+
+    auto is_definite_initialization(token const* t) const
+        -> bool
+    {
+        return definite_initializations.contains(t);
+    }
+
+    auto is_definite_last_use(token const* t) const
+        -> last_use const*
+    {
+        if (auto i = definite_last_uses.find(t);
+            i != definite_last_uses.end()
+            )
+        {
+            return &i->second;
+        }
+        // else
+        return {};
+    }
+
     //  Get the declaration of t within the same named function or beyond it
     //  For a this parameter, optionally include uses of implicit this
     //
@@ -471,24 +575,94 @@ public:
 
         }
 
+        //  If local lookup failed and a compiled prelude's globals are
+        //  available, fall back to those by name - they are namespace-scope
+        //  declarations, so only usable when the caller is willing to
+        //  look beyond the current function
+        if (
+            !result
+            && look_beyond_current_function
+            && !prelude_global_declarations.empty()
+            && this != prelude_sema
+            )
+        {
+            if (auto p = prelude_global_declarations.find(t.as_string_view());
+                p != prelude_global_declarations.cend()
+                )
+            {
+                result = p->second;
+            }
+        }
+
         return result;
     }
 
 
+    //  Record this compile's namespace-scope declarations as the shared
+    //  prelude index that later compiles' lookups fall back to - call
+    //  once, after this compile succeeded, while nothing else is
+    //  compiling, and keep this sema (and its compile) alive for as long
+    //  as the index is in use
+    //
+    inline static sema const* prelude_sema = nullptr;
+
+    auto share_globals_as_prelude() const
+        -> void
+    {
+        symbols.for_each_chunk( [&](std::span<symbol const> chunk) {
+            for (auto& s : chunk) {
+                if (!s.is_declaration()) {
+                    continue;
+                }
+                auto& decl = s.as_declaration();
+                if (
+                    decl.start
+                    && decl.identifier
+                    && decl.declaration
+                    && decl.declaration->parent_is_namespace()
+                    )
+                {
+                    //  On duplicate names (e.g., the same name in two
+                    //  namespaces) keep the first, which is the one
+                    //  declared earliest in the prelude
+                    prelude_global_declarations.emplace( decl.identifier->as_string_view(), &decl );
+                }
+            }
+        });
+        prelude_sema = this;
+    }
+
+
+    //  Side index for is_captured: the first symbol per token, built
+    //  once the symbol table is complete so each query is a hash lookup
+    //  instead of a scan of the whole symbols vector. Tokens are stable
+    //  in memory, so their addresses are usable as keys directly - no
+    //  stored per-token ordinal needed
+    //
+    mutable std::unordered_map<token const*, symbol const*> symbol_of_token;
+    mutable size_t                                          symbol_of_token_size = 0;
+
     auto is_captured(token const& t) const
         -> bool
     {
-        //  TODO Use 'std::lower_bound' by filtering final positions of 0.
-        auto it = std::find_if(
-            symbols.begin(),
-            symbols.end(),
-            [&](symbol const& s) -> bool {
-                return s.get_global_token_order() == t.get_global_token_order();
+        //  (Re)build the index if symbols were added since last time
+        if (symbol_of_token_size != symbols.size()) {
+            symbol_of_token.clear();
+            symbols.for_each_chunk( [&](std::span<symbol const> chunk) {
+                for (auto const& s : chunk) {
+                    if (auto st = s.get_token()) {
+                        symbol_of_token.try_emplace( st, &s );
+                    }
+                }
             });
+            symbol_of_token_size = symbols.size();
+        }
+
+        auto it = symbol_of_token.find( &t );
 
         if (identifier_sym const* sym = nullptr;
-            it != symbols.end()
-            && (sym = std::get_if<symbol::active::identifier>(&it->sym))
+            it != symbol_of_token.end()
+            && (sym = std::get_if<symbol::active::identifier>(&it->second->sym))
             && sym->is_use()
             )
         {
@@ -518,14 +692,24 @@ public:
     {
         o << "---------------------------------------------------------------------------\n";
         o << "declaration_of: size " << declaration_of.size() << "\n";
-        o << "   & tok            #tok    & sym            identifier      #tok  in_curr_fn prev_was_this & this_param_sym\n";
+        //  Tokens no longer carry a stored ordinal, so identify them in
+        //  the dump by their source position, which orders them just as
+        //  well and is derived on demand
+        auto tok_pos = [](token const* t) -> std::string {
+            if (!t) {
+                return "(null)";
+            }
+            return std::to_string(t->position().lineno) + ":" + std::to_string(t->position().colno);
+        };
+
+        o << "   & tok            pos     & sym            identifier      pos   in_curr_fn prev_was_this & this_param_sym\n";
 
         for (auto& e : declaration_of) {
             o   << "   " << static_cast<void const*>(e.first)
-                << " " << std::setw(4) << std::right << e.first->get_global_token_order()
+                << " " << std::setw(7) << std::right << tok_pos(e.first)
                 << " -> " << static_cast<void const*>(e.second.sym)
                 << " " << std::setw(16) << (e.second.sym && e.second.sym->identifier ? e.second.sym->identifier->as_string_view() : "(null)")
-                << std::setw(4) << std::right << (e.second.sym && e.second.sym->identifier ? e.second.sym->identifier->get_global_token_order() : 0)
+                << std::setw(7) << std::right << tok_pos(e.second.sym ? e.second.sym->identifier : nullptr)
                 << "  " << std::setw(10) << std::left << e.second.in_current_function
                 << " " << std::setw(13) << e.second.prev_token_was_this
                 << " " << static_cast<void const*>(e.second.this_param_sym)
@@ -535,12 +719,12 @@ public:
         o << "\n---------------------------------------------------------------------------\n";
 
         o << "symbols: size " << symbols.size() << "\n";
-        o << "   idx     tok#       & symbol       dep\n";
+        o << "   idx    tok pos      & symbol       dep\n";
 
         for (auto i = 0; auto const& s : symbols)
         {
             o << std::setw( 6) << std::right << i++                          << " | ";
-            o << std::setw( 6) << std::right << s.get_global_token_order()   << " | ";
+            o << std::setw( 8) << std::right << tok_pos(s.get_token())       << " | ";
             o << std::setw(16) << std::right << static_cast<void const*>(&s) << " | ";
             o << std::setw( 3) << std::right << s.depth                      << " | ";
 
@@ -661,6 +845,163 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  emit_symbols: serialize the symbol table in the compact .cpsym
+    //  binary format, so external tooling (e.g., a code-intelligence
+    //  indexer) can consume this analysis instead of re-parsing
+    //
+    //  Layout, all integers little-endian:
+    //
+    //      8 bytes   magic "cpsym01\n"
+    //      u32       record count
+    //      u32       name count
+    //      u32       name blob size in bytes
+    //      records   16 bytes each, in symbol-table order:
+    //                    u8  kind    symbol::active (declaration=0,
+    //                                identifier, selection, compound)
+    //                    u8  flags   bit 0: start
+    //                                declaration: bit 1 member, bit 2
+    //                                  return param, bits 3-4 category
+    //                                  (0 object, 1 function, 2 type,
+    //                                  3 namespace or alias)
+    //                                identifier: bits 1-2 the
+    //                                  identifier_sym kind, bit 3
+    //                                  standalone assignment target
+    //                                compound: bits 1-2 the
+    //                                  compound_sym kind
+    //                    i16 depth
+    //                    i32 lineno
+    //                    i32 colno
+    //                    i32 name    index into the name table, -1 none
+    //      u32 x (name count + 1)  ascending offsets into the name blob,
+    //                so name i is the bytes [offset[i], offset[i+1])
+    //      name blob
+    //
+    //  The records are fixed-stride at an offset computable from the
+    //  header alone, so a reader can mmap the file and walk them in
+    //  place. The scope tree is the same depth + start/deactivation
+    //  encoding the analyses here walk, so it needs no separate section
+    //
+    auto emit_symbols(std::ostream& o) const
+        -> void
+    {
+        struct record {
+            u8      kind;
+            u8      flags;
+            int16_t depth;
+            int32_t lineno;
+            int32_t colno;
+            int32_t name;
+        };
+        auto records  = std::vector<record>{};
+        auto name_ids = std::unordered_map<std::string_view, int32_t>{};
+        auto names    = std::vector<std::string_view>{};
+
+        //  Intern each distinct spelling once, in first-appearance order
+        auto name_of = [&](token const* t)
+            -> int32_t
+        {
+            if (!t) {
+                return -1;
+            }
+            auto [it, added] = name_ids.try_emplace(
+                t->as_string_view(),
+                unchecked_narrow<int32_t>(std::ssize(names))
+            );
+            if (added) {
+                names.push_back( it->first );
+            }
+            return it->second;
+        };
+
+        records.reserve( symbols.size() );
+        symbols.for_each_chunk( [&](std::span<symbol const> chunk) {
+            for (auto const& s : chunk)
+            {
+                auto flags = static_cast<u8>( s.start ? 0x01 : 0x00 );
+                switch (s.sym.index())
+                {
+                break;case symbol::active::declaration: {
+                    auto const& sym = s.as_declaration();
+                    flags |= sym.member       ? 0x02 : 0x00;
+                    flags |= sym.return_param ? 0x04 : 0x00;
+                    auto category = 0;
+                    if (sym.declaration) {
+                        if      (sym.declaration->is_function())  { category = 1; }
+                        else if (sym.declaration->is_type())      { category = 2; }
+                        else if (
+                            sym.declaration->is_namespace()
+                            || sym.declaration->is_alias()
+                            )                                     { category = 3; }
+                    }
+                    flags |= static_cast<u8>(category << 3);
+                }
+
+                break;case symbol::active::identifier: {
+                    auto const& sym = s.as_identifier();
+                    flags |= static_cast<u8>(sym.kind_ << 1);
+                    flags |= sym.standalone_assignment_to ? 0x08 : 0x00;
+                }
+
+                break;case symbol::active::compound: {
+                    auto const& sym = s.as_compound();
+                    flags |= static_cast<u8>(sym.kind_ << 1);
+                }
+
+                break;default:
+                    ;
+                }
+
+                auto pos = s.position();
+                records.push_back({
+                    static_cast<u8>(s.sym.index()),
+                    flags,
+                    static_cast<int16_t>(s.depth),
+                    pos.lineno,
+                    pos.colno,
+                    name_of( s.get_token() )
+                });
+            }
+        });
+
+        auto put = [&](uint64_t v, int bytes) {
+            for (auto b = 0; b < bytes; ++b) {
+                o.put( static_cast<char>(v & 0xff) );
+                v >>= 8;
+            }
+        };
+
+        auto name_bytes = std::size_t{0};
+        for (auto n : names) {
+            name_bytes += n.size();
+        }
+
+        o.write( "cpsym01\n", 8 );
+        put( records.size(), 4 );
+        put( names  .size(), 4 );
+        put( name_bytes    , 4 );
+
+        for (auto const& r : records) {
+            put( r.kind                          , 1 );
+            put( r.flags                         , 1 );
+            put( static_cast<uint16_t>(r.depth)  , 2 );
+            put( static_cast<uint32_t>(r.lineno) , 4 );
+            put( static_cast<uint32_t>(r.colno)  , 4 );
+            put( static_cast<uint32_t>(r.name)   , 4 );
+        }
+
+        auto offset = std::size_t{0};
+        for (auto n : names) {
+            put( offset, 4 );
+            offset += n.size();
+        }
+        put( offset, 4 );
+        for (auto n : names) {
+            o.write( n.data(), unchecked_narrow<std::streamsize>(n.size()) );
+        }
+    }
+
+
     //-----------------------------------------------------------------------
     //  Apply local first- and last-use rules
     //
@@ -719,9 +1060,92 @@ public:
             return {};
         };
 
+        //-----------------------------------------------------------------------
+        //  The last-use analyses are independent of each other and each one
+        //  only reads the symbol table, so first collect them as work items
+        //  with per-declaration result and error buffers...
+        //
+        struct last_use_work {
+            declaration_sym const* decl;
+            int                    sympos;
+            std::vector<last_use>  uses;
+        };
+        auto worklist    = std::vector<last_use_work>{};
+
+        //  Their diagnostics go through a shared thread-safe sink, keyed
+        //  by worklist index so the canonical order survives concurrency
+        auto diagnostics = diagnostics_sink{};
+
+        //  The scans read kinds and depths through the dense sidecar,
+        //  which also makes it safe to share across -parallel-sema workers
+        build_symbol_briefs();
+
+        for (auto sympos = unchecked_narrow<int>(std::ssize(symbols) - 1); sympos >= 0; --sympos)
+        {
+            //  If this is a copy, move, or forward parameter or a local variable,
+            //  identify and tag its definite last uses to `std::move` from them
+            //  If it's some other parameter, just check that it is used
+            //
+            if (auto decl = is_local_declaration(symbols[sympos])) {
+                assert (decl->identifier);
+                worklist.push_back({ decl, sympos, {} });
+            }
+        }
+
+        //  ... then run them, on worker threads when -parallel-sema is on
+        //  and there's enough work to be worth it
+        //
+        auto run_one = [&](size_t i) {
+            auto& w = worklist[i];
+            find_definite_last_uses(
+                w.decl->identifier,
+                w.sympos,
+                w.decl->parameter ? std::optional{w.decl->parameter->pass} : std::optional<passing_style>{},
+                w.decl->parameter,
+                w.uses,
+                diagnostics,
+                unchecked_narrow<long long>(i)
+            );
+        };
+
+        if (
+            flag_parallel_sema
+            && std::ssize(worklist) > 16
+            && std::thread::hardware_concurrency() > 1
+            )
+        {
+            auto next = std::atomic<size_t>{ 0 };
+            auto work = [&]{
+                for (
+                    auto i = next.fetch_add(1);
+                    i < worklist.size();
+                    i = next.fetch_add(1)
+                    )
+                {
+                    run_one( i );
+                }
+            };
+
+            auto workers = std::vector<std::thread>{};
+            for (auto n = 0u; n < std::min( std::thread::hardware_concurrency(), 8u ); ++n) {
+                workers.emplace_back(work);
+            }
+            for (auto& w : workers) {
+                w.join();
+            }
+        }
+        else {
+            for (auto i = size_t{0}; i < worklist.size(); ++i) {
+                run_one(i);
+            }
+        }
+
+        diagnostics.seal();
+
         //-----------------------------------------------------------------------
         //  Function logic: For each entry in the table...
         //
+        auto next_work = worklist.begin();
         for (auto sympos = unchecked_narrow<int>(std::ssize(symbols) - 1); sympos >= 0; --sympos)
         {
             //  If this is an uninitialized local variable,
@@ -737,33 +1161,285 @@ public:
                     ;
             }
 
-            //  If this is a copy, move, or forward parameter or a local variable,
-            //  identify and tag its definite last uses to `std::move` from them
-            //  If it's some other parameter, just check that it is used
+            //  Merge this position's last-use results and diagnostics, in
+            //  the same order the sequential analysis produced them
             //
-            if (auto decl = is_local_declaration(symbols[sympos])) {
-                assert (decl->identifier);
-                find_definite_last_uses(
-                    decl->identifier,
-                    sympos,
-                    decl->parameter ? std::optional{decl->parameter->pass} : std::optional<passing_style>{},
-                    decl->parameter
-                );
+            if (
+                next_work != worklist.end()
+                && next_work->sympos == sympos
+                )
+            {
+                for (auto const& use : next_work->uses) {
+                    definite_last_uses.emplace( use.t, use );
+                }
+                diagnostics.take( next_work - worklist.begin(), errors );
+                ++next_work;
             }
         }
 
         return ret;
     }
 
+    //  -demote-nonescaping-new: find function-local objects of deduced type
+    //  initialized from unique.new/shared.new whose every use immediately
+    //  dereferences, and demote their arena. A shared.new result that never
+    //  escapes its function can't be aliased, so unique_ptr's non-atomic
+    //  ownership is observably equivalent and drops the refcount traffic;
+    //  a unique.new result that never escapes can live directly on the
+    //  stack (cpp2::stacked.new), dropping the allocation too
+    //
+    //  "Every use immediately dereferences" is deliberately conservative:
+    //  any use of the name that isn't postfix-* - copying it, returning
+    //  it, reassigning it, capturing it, calling a smart pointer member
+    //  on it - keeps the declaration exactly as written
+    //
+    auto demote_nonescaping_new_locals()
+        -> void
+    {
+        //  Find the candidates: local `x := unique.new<T>(...)` or
+        //  `x := shared.new<T>(...)` declarations
+        //
+        auto candidates      = std::unordered_map<declaration_node const*, token const*>{};
+        auto candidate_names = std::unordered_set<std::string_view>{};
+
+        for (auto const& s : symbols)
+        {
+            auto sym = std::get_if<symbol::active::declaration>(&s.sym);
+            if (
+                !sym
+                || !sym->start
+                || !sym->identifier
+                || !sym->declaration
+                || !sym->declaration->is_object()
+                || !sym->declaration->parent_is_function()
+                || !sym->declaration->has_wildcard_type()
+                )
+            {
+                continue;
+            }
+
+            if (auto arena = get_new_expression_arena(*sym->declaration)) {
+                candidates     [sym->declaration] = arena;
+                candidate_names.insert( sym->identifier->as_string_view() );
+            }
+        }
+
+        if (candidates.empty()) {
+            return;
+        }
+
+        //  Then knock out every candidate one of whose uses isn't an
+        //  immediate dereference
+        //
+        for (auto const& use : postfix_uses)
+        {
+            if (
+                use.dereferenced
+                || !candidate_names.contains( use.t->as_string_view() )
+                )
+            {
+                continue;
+            }
+            if (auto decl = get_declaration_of(use.t)) {
+                candidates.erase( decl->declaration );
+            }
+        }
+
+        for (auto const& [decl, arena] : candidates) {
+            demoted_new_arenas.emplace(
+                arena,
+                *arena == "shared" ? "unique" : "stacked"
+            );
+        }
+    }
+
+    //  If this declaration's initializer is exactly a unique.new/shared.new
+    //  call, return its 'unique'/'shared' token (the lexer already
+    //  qualified it to 'cpp2::unique.new' etc. - see lex.h)
+    //
+    static auto get_new_expression_arena(declaration_node const& n)
+        -> token const*
+    {
+        if (
+            !n.initializer
+            || !n.initializer->is_expression()
+            )
+        {
+            return {};
+        }
+        auto& expr_stmt = std::get<statement_node::expression>(n.initializer->statement);
+        assert (expr_stmt && expr_stmt->expr);
+
+        assert (expr_stmt->expr->expr);
+        auto pfx = expr_stmt->expr->expr->get_if_only_a_postfix_expression_node();
+        if (
+            !pfx
+            || std::ssize(pfx->ops) != 2
+            || pfx->ops[0].op->type() != lexeme::Dot
+            || !pfx->ops[0].id_expr
+            || !pfx->ops[0].id_expr->is_unqualified()
+            || pfx->ops[1].op->type() != lexeme::LeftParen
+            )
+        {
+            return {};
+        }
+        //  The member is 'new<T>' - a template-id, so reach for its raw
+        //  identifier (get_token() answers null for template-ids)
+        auto& member = std::get<id_expression_node::unqualified>(pfx->ops[0].id_expr->id);
+        if (
+            !member->identifier
+            || *member->identifier != "new"
+            )
+        {
+            return {};
+        }
+
+        auto id = std::get_if<primary_expression_node::id_expression>(&pfx->expr->expr);
+        if (
+            !id
+            || !(*id)->is_qualified()
+            )
+        {
+            return {};
+        }
+        auto& qid = std::get<id_expression_node::qualified>((*id)->id);
+        if (
+            std::ssize(qid->ids) != 2
+            || qid->ids.front().scope_op
+            || !qid->ids.front().id
+            || *qid->ids.front().id->get_token() != "cpp2"
+            || !qid->ids.back().id
+            )
+        {
+            return {};
+        }
+
+        auto arena = qid->ids.back().id->get_token();
+        if (
+            arena
+            && (*arena == "unique" || *arena == "shared")
+            )
+        {
+            return arena;
+        }
+        return {};
+    }
+
+    //  For the emitter: the demoted arena name to print in place of this
+    //  'unique'/'shared' token, or null to print it as written
+    //
+    auto get_demoted_new_arena(token const* t) const
+        -> char const*
+    {
+        if (auto i = demoted_new_arenas.find(t); i != demoted_new_arenas.end()) {
+            return i->second;
+        }
+        return {};
+    }
+
 private:
+    //  Every unqualified-id postfix-expression in the file, tagged with
+    //  whether its first postfix operator is '*' - the raw material for
+    //  demote_nonescaping_new_locals' escape check
+    //
+    struct postfix_use {
+        token const* t;
+        bool         dereferenced;
+    };
+    std::vector<postfix_use>                      postfix_uses       = {};
+    std::unordered_map<token const*, char const*> demoted_new_arenas = {};
+
     //  Find the definite last uses for local variable *id starting at the
     //  given position and depth in the symbol/scope table
     //
+    //  This analysis only reads the symbol table, so independent calls can
+    //  run concurrently - results and diagnostics go to the given buffers
+    //
+    //  (Re)build the symbol_briefs sidecar from the current symbol table
+    //
+    auto build_symbol_briefs()
+        -> void
+    {
+        symbol_briefs.clear();
+        symbol_briefs.reserve(symbols.size());
+        use_positions_by_name.clear();
+        symbols.for_each_chunk([&](std::span<symbol const> chunk) {
+            for (auto const& s : chunk) {
+                if (auto sym = std::get_if<identifier_sym>(&s.sym);
+                    sym
+                    && sym->is_use()
+                    && sym->identifier
+                    && sym->identifier->intern_id() != 0
+                    )
+                {
+                    use_positions_by_name[sym->identifier->intern_id()]
+                        .push_back(unchecked_narrow<int>(std::ssize(symbol_briefs)));
+                }
+                symbol_briefs.push_back({
+                    unchecked_narrow<u8>(s.sym.index()),
+                    s.start,
+                    s.depth
+                });
+            }
+        });
+
+        //  And the scope-tree parent pointers, with the classic
+        //  next-smaller-element stack scan
+        auto size = unchecked_narrow<int>(std::ssize(symbol_briefs));
+        next_shallower.assign(symbol_briefs.size(), size);
+        auto pending = std::vector<int>{};
+        for (auto i = size - 1; i >= 0; --i)
+        {
+            while (
+                !pending.empty()
+                && symbol_briefs[pending.back()].depth >= symbol_briefs[i].depth
+                )
+            {
+                pending.pop_back();
+            }
+            if (!pending.empty()) {
+                next_shallower[i] = pending.back();
+            }
+            pending.push_back(i);
+        }
+    }
+
+    //  The first position at or after 'pos' whose depth is below 'depth',
+    //  reached by jumping whole enclosed scopes via next_shallower
+    //
+    auto skip_to_shallower(int pos, int depth) const
+        -> int
+    {
+        while (
+            pos < std::ssize(symbol_briefs)
+            && symbol_briefs[pos].depth >= depth
+            )
+        {
+            pos = next_shallower[pos];
+        }
+        return pos;
+    }
+
+    //  Like std::get_if on symbols[i].sym, but tests the kind via the
+    //  dense symbol_briefs sidecar so a mismatch never loads the symbol
+    //
+    template <symbol::active K>
+    auto brief_get_if(int i) const
+    {
+        return
+            symbol_briefs[i].kind == K
+            ? &std::get<K>(symbols[i].sym)
+            : nullptr;
+    }
+
     auto find_definite_last_uses(
         token const*                 id,
         int                          pos,
         std::optional<passing_style> pass,
-        bool                         is_parameter
+        bool                         is_parameter,
+        std::vector<last_use>&       out_uses,
+        diagnostics_sink&            out_diags,
+        long long                    seq
     ) const
         -> void
     {
@@ -784,6 +1460,29 @@ private:
                        );
         };
 
+        //  The bulk sweep in build_symbol_briefs indexed every use by
+        //  interned name, so clamp this scan at our name's final use:
+        //  positions past it can't contain a use of id, and a name never
+        //  used after its declaration needs no scan at all. 'this' keeps
+        //  the full scan, since its uses can be spelled as member names
+        //
+        auto limit = unchecked_narrow<int>(std::ssize(symbols));
+        if (
+            *id != "this"
+            && id->intern_id() != 0
+            )
+        {
+            auto entry = use_positions_by_name.find(id->intern_id());
+            if (
+                entry == use_positions_by_name.end()
+                || entry->second.back() <= pos
+                )
+            {
+                return;
+            }
+            limit = entry->second.back();
+        }
+
         auto i = pos + 1;
 
         struct pos_range
@@ -822,7 +1521,7 @@ private:
                 while (
                     i < std::ssize(symbols)
                     && (
-                        !(sym = std::get_if<symbol::active::identifier>(&symbols[i].sym))
+                        !(sym = brief_get_if<symbol::active::identifier>(i))
                         || sym->identifier != identifier_end
                         )
                     )
@@ -835,7 +1534,7 @@ private:
                 }
             };
 
-            if (auto decl = std::get_if<symbol::active::declaration>(&symbols[i].sym);
+            if (auto decl = brief_get_if<symbol::active::declaration>(i);
                 decl
                 && decl->start
                 && decl->identifier
@@ -846,7 +1545,7 @@ private:
                 skip_to(decl->identifier);
                 return true;
             }
-            else if (auto sym = std::get_if<symbol::active::identifier>(&symbols[i].sym);
+            else if (auto sym = brief_get_if<symbol::active::identifier>(i);
                      sym
                      && sym->is_using_declaration()
                      && sym->identifier
@@ -860,7 +1559,7 @@ private:
         };
 
         auto skip_function_expression = [&]() -> bool {
-            if (auto decl = std::get_if<symbol::active::declaration>(&symbols[i].sym);
+            if (auto decl = brief_get_if<symbol::active::declaration>(i);
                 decl
                 && decl->start
                 && decl->declaration->is_function_expression()
@@ -873,7 +1572,7 @@ private:
                 while (
                     i < std::ssize(symbols)
                     && (
-                        !(decl = std::get_if<symbol::active::declaration>(&symbols[i].sym))
+                        !(decl = brief_get_if<symbol::active::declaration>(i))
                         || decl->declaration != function_expression_end
                         )
                     )
@@ -882,7 +1581,7 @@ private:
                         continue;
                     }
                     else if (
-                        auto sym = std::get_if<symbol::active::identifier>(&symbols[i].sym);
+                        auto sym = brief_get_if<symbol::active::identifier>(i);
                         is_a_use(sym)
                         && sym->is_captured
                         )
@@ -901,9 +1600,10 @@ private:
 
         //  Scan forward to the end of this scope
         auto found_end_of_our_initialization = false;
-        for (auto start_depth = symbols[pos].depth;
+        for (auto start_depth = symbol_briefs[pos].depth;
             i < std::ssize(symbols)
-            && symbols[i].depth >= start_depth;
+            && i <= limit
+            && symbol_briefs[i].depth >= start_depth;
             ++i
             )
         {
@@ -914,9 +1614,9 @@ private:
                 && !found_end_of_our_initialization
                 )
             {
-                if (symbols[i].depth == start_depth)
+                if (symbol_briefs[i].depth == start_depth)
                 {
-                    if (auto decl = std::get_if<symbol::active::declaration>(&symbols[i].sym);
+                    if (auto decl = brief_get_if<symbol::active::declaration>(i);
                         decl
                         && decl->declaration->is_object()
                         && decl->declaration->has_name(*id)
@@ -927,17 +1627,20 @@ private:
                     }
                 }
 
-                if (auto sym = std::get_if<symbol::active::identifier>(&symbols[i].sym);
+                if (auto sym = brief_get_if<symbol::active::identifier>(i);
                     sym
                     && !sym->is_after_dot
                     && is_a_use(sym)
                     )
                 {
                     assert(sym->identifier);
-                    errors.emplace_back(
-                        sym->identifier->position(),
-                        "local variable " + sym->identifier->to_string()
-                            + " cannot be used in its own initializer");
+                    out_diags.report(
+                        seq,
+                        {   sym->identifier->position(),
+                            "local variable " + sym->identifier->to_string()
+                                + " cannot be used in its own initializer"
+                        }
+                    );
                 }
             }
 
@@ -950,7 +1653,7 @@ private:
             }
 
             //  Record the loops
-            else if (auto sym = std::get_if<symbol::active::identifier>(&symbols[i].sym);
+            else if (auto sym = brief_get_if<symbol::active::identifier>(i);
                 sym
                 && sym->identifier
                 && (
@@ -960,7 +1663,7 @@ private:
                     )
                 )
             {
-                auto loop_depth = symbols[i].depth;
+                auto loop_depth = symbol_briefs[i].depth;
                 auto loop_id = sym->identifier;
 
                 //  If id is the loop parameter, this is its end
@@ -969,11 +1672,11 @@ private:
                     && sym->is_deactivation()
                     )
                 {
-                    assert(symbols[i].depth == start_depth && "Messed up in a nested loop");
+                    assert(symbol_briefs[i].depth == start_depth && "Messed up in a nested loop");
                     ++i;
                     break;
                 }
-                assert(symbols[i].start);
+                assert(symbol_briefs[i].start);
 
                 pos_ranges.emplace_back(true, i);
 
@@ -982,8 +1685,8 @@ private:
                 while (
                     i < std::ssize(symbols)
                     && (
-                        symbols[i].depth > loop_depth
-                        || !(sym = std::get_if<symbol::active::identifier>(&symbols[i].sym))
+                        symbol_briefs[i].depth > loop_depth
+                        || !(sym = brief_get_if<symbol::active::identifier>(i))
                         || sym->identifier != loop_id
                         )
                     )
@@ -1027,16 +1730,16 @@ private:
             //  pop out of any containing scope of the branch
             if (compound_sym const* comp = nullptr;
                 branch_depth != 0
-                && (comp = std::get_if<symbol::active::compound>(&symbols[i].sym))
+                && (comp = brief_get_if<symbol::active::compound>(i))
                 && comp->kind_ == compound_sym::is_true
-                && branch_depth + 1 == symbols[i].depth
+                && branch_depth + 1 == symbol_briefs[i].depth
                 )
             {
                 while (
                     i > pos
                     && (
-                        !(comp = std::get_if<symbol::active::compound>(&symbols[i].sym))
-                        || branch_depth <= symbols[i].depth
+                        !(comp = brief_get_if<symbol::active::compound>(i))
+                        || branch_depth <= symbol_briefs[i].depth
                         )
                     )
                 {
@@ -1055,7 +1758,7 @@ private:
                         )
                     )
                 {
-                    branch_depth = symbols[i].depth - 1;
+                    branch_depth = symbol_briefs[i].depth - 1;
                 }
                 else
                 {
@@ -1064,7 +1767,7 @@ private:
                 continue;
             }
 
-            auto sym = std::get_if<symbol::active::identifier>(&symbols[i].sym);
+            auto sym = brief_get_if<symbol::active::identifier>(i);
 
             if (!is_a_use(sym))
             {
@@ -1082,7 +1785,7 @@ private:
             }
             else
             {
-                definite_last_uses.emplace_back(
+                out_uses.emplace_back(
                     sym->identifier,
                     pass == passing_style::forward,
                     sym->safe_to_move
@@ -1099,18 +1802,18 @@ private:
             compound_sym const* comp = nullptr;
 
             //  Pop out of any containing scope of the last use
-            for (auto found_depth = symbols[i--].depth;
+            for (auto found_depth = symbol_briefs[i--].depth;
                 i > pos
                 && (
-                    !(comp = std::get_if<symbol::active::compound>(&symbols[i].sym))
+                    !(comp = brief_get_if<symbol::active::compound>(i))
                     || comp->kind_ == compound_sym::is_scope
-                    || found_depth <= symbols[i].depth
+                    || found_depth <= symbol_briefs[i].depth
                     );
                 --i
                 )
             {
             }
-            assert(!comp || symbols[i].start);
+            assert(!comp || symbol_briefs[i].start);
 
             //  If found in a branch, record its depth
             if (
@@ -1119,7 +1822,7 @@ private:
                 && comp->kind_ != compound_sym::is_scope
                 )
             {
-                branch_depth = symbols[i].depth - 1;
+                branch_depth = symbol_briefs[i].depth - 1;
             }
         }
 
@@ -1197,18 +1900,20 @@ private:
                     );
                     return false;
                 }
-                definite_initializations.push_back(t);
+                definite_initializations.insert(t);
                 return true;
             };
 
 
+        //  The walk reads kinds and depths through the dense sidecar, so
+        //  only the symbols a case actually inspects are pulled into cache
         for (
             ;
-            pos < std::ssize(symbols) && symbols[pos].depth >= depth;
+            pos < std::ssize(symbol_briefs) && symbol_briefs[pos].depth >= depth;
             ++pos
             )
         {
-            switch (symbols[pos].sym.index()) {
+            switch (symbol_briefs[pos].kind) {
 
             break;case symbol::active::declaration: {
                 auto const& sym = std::get<symbol::active::declaration>(symbols[pos].sym);
@@ -1290,10 +1995,8 @@ private:
                             assert (std::ssize(selection_stack.back().branches) > 0);
                             selection_stack.back().branches.back().result = sym.standalone_assignment_to;
 
-                            const int this_depth = symbols[pos].depth;
-                            while (symbols[pos + 1].depth >= this_depth) {
-                                ++pos;
-                            }
+                            const int this_depth = symbol_briefs[pos].depth;
+                            pos = skip_to_shallower(pos + 1, this_depth) - 1;
                         }
                     }
 
@@ -1315,10 +2018,8 @@ private:
 
                         //  The depth of this branch should always be the depth of
                         //  the current selection statement + 1
-                        const int branch_depth = symbols[selection_stack.back().pos].depth + 1;
-                        while (symbols[pos + 1].depth > branch_depth) {
-                            ++pos;
-                        }
+                        const int branch_depth = symbol_briefs[selection_stack.back().pos].depth + 1;
+                        pos = skip_to_shallower(pos + 1, branch_depth + 1) - 1;
                     }
 
                 }
@@ -1338,31 +2039,23 @@ private:
                 else {
                     assert (std::ssize(selection_stack) > 0);
 
-                    auto true_branches  = std::string{};
-                    auto false_branches = std::string{};
-                    for (auto const& b : selection_stack.back().branches)
-                    {
-                        //  If this is not an implicit 'else' branch (i.e., if lineno > 0)
-                        if (symbols[b.start].position().lineno > 0) {
-                            (b.result ? true_branches : false_branches)
-                                += "\n  branch starting at line "
-                                    + std::to_string(symbols[b.start].position().lineno);
-                        }
-                        else {
-                            (b.result ? true_branches : false_branches)
-                                += "\n  implicit else branch";
-                        }
+                    //  Merge the branch results first - most joins are
+                    //  all-false or all-true, and those must not pay for
+                    //  formatting the per-branch diagnostic lists below
+                    auto true_count = size_t{0};
+                    for (auto const& b : selection_stack.back().branches) {
+                        true_count += b.result;
                     }
 
                     //  If none of the branches was true
-                    if (true_branches.length() == 0)
+                    if (true_count == 0)
                     {
                         selection_stack.pop_back();
                         //  Nothing else to do, just continue
                     }
 
                     //  Else if all of the branches were true
-                    else if (false_branches.length() == 0)
+                    else if (true_count == selection_stack.back().branches.size())
                     {
                         //  If this is a top-level selection statement, handle it the same as
                         //  if we weren't an a selection statement
@@ -1377,16 +2070,30 @@ private:
                             selection_stack.back().branches.back().result = true;
 
                             //  And skip the rest of this branch
-                            auto skip_depth = symbols[pos].depth - 1;
-                            while (symbols[pos + 1].depth >= skip_depth) {
-                                ++pos;
-                            }
+                            auto skip_depth = symbol_briefs[pos].depth - 1;
+                            pos = skip_to_shallower(pos + 1, skip_depth) - 1;
                         }
                     }
 
                     //  Else we found a missing initializion, report it and return false
                     else
                     {
+                        auto true_branches  = std::string{};
+                        auto false_branches = std::string{};
+                        for (auto const& b : selection_stack.back().branches)
+                        {
+                            //  If this is not an implicit 'else' branch (i.e., if lineno > 0)
+                            if (symbols[b.start].position().lineno > 0) {
+                                (b.result ? true_branches : false_branches)
+                                    += "\n  branch starting at line "
+                                        + std::to_string(symbols[b.start].position().lineno);
+                            }
+                            else {
+                                (b.result ? true_branches : false_branches)
+                                    += "\n  implicit else branch";
+                            }
+                        }
+
                         errors.emplace_back(
                             decl->identifier->position(),
                             "local variable " + name
@@ -1429,7 +2136,7 @@ private:
                     //  plus one, it's the start of one of the branches of that selection
                     if (
                         sym.start
-                        && symbols[pos].depth == symbols[selection_stack.back().pos].depth+1
+                        && symbol_briefs[pos].depth == symbol_briefs[selection_stack.back().pos].depth+1
                         )
                     {
                         selection_stack.back().branches.emplace_back( pos, false );
@@ -1506,9 +2213,12 @@ public:
             }
         }
 
+        //  The structural check is cheap, so run it before materializing
+        //  the expression's text - most postfix-expressions aren't
+        //  one-argument calls, and to_string allocates
         if (
-            n.expr->to_string() == "std::move"
-            && n.starts_with_function_call_with_n_parameters(1)
+            n.starts_with_function_call_with_n_parameters(1)
+            && n.expr->to_string() == "std::move"
             )
         {
             errors.emplace_back(
@@ -1527,28 +2237,31 @@ public:
     {
         assert(n.declaration);
 
-        auto type_name = std::string{};
-        if (n.declaration->has_declared_return_type()) {
-            auto object_type = n.declaration->get_object_type();
-            assert(object_type);
-            type_name = object_type->to_string();
-        }
-
+        //  Check the cheap structural conditions first, and compare the
+        //  parameter's type against the enclosing type's name by interned
+        //  handle - materialize the type's text only to build the message
         if (
             n.ordinal == 2
             && !n.has_name("that")
+            && n.declaration->has_declared_return_type()
             && n.declaration->parent_declaration
             && n.declaration->parent_declaration->has_name("operator=")
             && n.declaration->parent_declaration->parent_declaration
             && n.declaration->parent_declaration->parent_declaration->name()
-            && type_name == *n.declaration->parent_declaration->parent_declaration->name()
             )
         {
-            errors.emplace_back(
-                n.position(),
-                "if an 'operator=' second parameter is of the same type (here '" + type_name + "'), it must be named 'that'"
-            );
-            return false;
+            auto object_type = n.declaration->get_object_type();
+            assert(object_type);
+            if (object_type->intern_id()
+                == n.declaration->parent_declaration->parent_declaration->name()->intern_id()
+                )
+            {
+                errors.emplace_back(
+                    n.position(),
+                    "if an 'operator=' second parameter is of the same type (here '" + object_type->to_string() + "'), it must be named 'that'"
+                );
+                return false;
+            }
         }
 
         return true;
@@ -2496,10 +3209,6 @@ public:
 
     auto start(token const& t, int) -> void
     {
-        //  By giving tokens an order during sema
-        //  generated code can be equally checked
-        t.set_global_token_order( global_token_counter );
-
         auto guard = finally([&]() {
             prev2_token = prev_token;
             prev_token = &t;
@@ -2600,10 +3309,13 @@ public:
                             n->my_statement->compound_parent->statements.begin(),
                             n->my_statement->compound_parent->statements.end(),
                             [&t, n](std::unique_ptr<statement_node> const& s) mutable {
+                                //  Compare name tokens - for interned
+                                //  identifiers that's an integer compare,
+                                //  not a to_string allocation per member
                                 return s
                                         && s->statement.index() == statement_node::declaration
-                                        && (n = &*std::get<statement_node::declaration>(s->statement))->identifier
-                                        && n->identifier->to_string() == t;
+                                        && (n = &*std::get<statement_node::declaration>(s->statement))->has_name()
+                                        && *n->name() == t;
                             })
                     )
                 {
@@ -2845,6 +3557,18 @@ public:
         started_postfix_operators_.push_back(true);
         if (auto id = std::get_if<primary_expression_node::id_expression>(&n.expr->expr)) {
             started_postfix_expression = (*id)->is_unqualified();
+
+            //  Record how this name is used, for the escape check in
+            //  demote_nonescaping_new_locals
+            if (flag_demote_nonescaping_new) {
+                if (auto t = (*id)->get_token()) {
+                    postfix_uses.push_back({
+                        t,
+                        !n.ops.empty()
+                        && n.ops.front().op->type() == lexeme::Multiply
+                    });
+                }
+            }
         }
         push(uses_at_postfix_expression);
     }
@@ -14,7 +14,13 @@
 #define CPP2_TO_CPP1_H
 
 #include "sema.h"
+#include <cstdio>
 #include <filesystem>
+#if defined(_MSC_VER)
+    #include <io.h>         // _commit, for -fsync-output
+#elif defined(__APPLE__)
+    #include <unistd.h>     // fsync, for -fsync-output (Linux gets it via common.h)
+#endif
 
 namespace cpp2 {
 
@@ -75,7 +81,10 @@ static cmdline_processor::register_flag cmd_emit_cppfront_info(
     8,
     "emit-cppfront-info",
     "Emit cppfront version/build in Cpp1 file",
-    []{ flag_emit_cppfront_info = true; }
+    []{ flag_emit_cppfront_info = true; },
+    nullptr,
+    "e"     //  this was the only 'e' flag before the -emit-* family
+            //  grew, so -e is established usage - keep it exact
 );
 
 static auto flag_clean_cpp1 = false;
@@ -86,6 +95,31 @@ static cmdline_processor::register_flag cmd_clean_cpp1(
     []{ flag_clean_cpp1 = true; }
 );
 
+static auto flag_no_align = false;
+static cmdline_processor::register_flag cmd_no_align(
+    8,
+    "no-align",
+    "Emit Cpp1 without source-column alignment, for machine-consumed output",
+    []{ flag_no_align = true; }
+);
+
+static auto flag_compact_cpp1 = false;
+static cmdline_processor::register_flag cmd_compact_cpp1(
+    8,
+    "compact-cpp1",
+    "Emit Cpp1 with indentation and trailing blanks stripped, for smaller output",
+    []{ flag_compact_cpp1 = true; }
+);
+
+static auto flag_function_heat = std::string{};
+static cmdline_processor::register_flag cmd_function_heat(
+    8,
+    "function-heat file",
+    "Annotate generated function definitions hot/cold from 'file' (lines of '[source-file] line hot|cold'), for profile-guided layout",
+    nullptr,
+    [](std::string const& name) { flag_function_heat = name; }
+);
+
 static auto flag_line_paths = false;
 static cmdline_processor::register_flag cmd_line_paths(
     8,
@@ -94,6 +128,14 @@ static cmdline_processor::register_flag cmd_line_paths(
     [] { flag_line_paths = true; }
 );
 
+static auto flag_sparse_line_directives = false;
+static cmdline_processor::register_flag cmd_sparse_line_directives(
+    8,
+    "sparse-line-directives",
+    "Emit #line directives at statement granularity only, for smaller output",
+    [] { flag_sparse_line_directives = true; }
+);
+
 static auto flag_import_std = false;
 static cmdline_processor::register_flag cmd_import_std(
     0,
@@ -107,7 +149,52 @@ static cmdline_processor::register_flag cmd_include_std(
     0,
     "include-std",
     "#include all std:: headers",
-    []{ flag_include_std = true; }
+    []{ flag_include_std = true; },
+    nullptr,
+    "in"    //  keep the established -in spelling exact, now that the
+            //  -incremental-*/-interp-* flags make the prefix ambiguous
+);
+
+static auto flag_emit_module = false;
+static cmdline_processor::register_flag cmd_emit_module(
+    0,
+    "emit-module",
+    "Emit 'import cpp2;' instead of including the runtime - build include/cpp2.cppm as the 'cpp2' module",
+    []{ flag_emit_module = true; }
+);
+
+static auto flag_inline_small_functions = false;
+static cmdline_processor::register_flag cmd_inline_small_functions(
+    0,
+    "inline-small-functions",
+    "Mark one-statement function definitions 'inline' - lets a generated header be included from several translation units, with inlining and no LTO",
+    []{ flag_inline_small_functions = true; }
+);
+
+static auto flag_drop_unused_includes = false;
+static cmdline_processor::register_flag cmd_drop_unused_includes(
+    0,
+    "drop-unused-includes",
+    "Drop a '#include' of a .h2 file when this file mentions none of the names it declares (kept whenever in doubt; can break a file that relies only on the header's own transitive includes)",
+    []{ flag_drop_unused_includes = true; }
+);
+
+static auto flag_shared_prolog = std::string{};
+static cmdline_processor::register_flag cmd_shared_prolog(
+    0,
+    "shared-prolog filename",
+    "Write the common generated prolog to 'filename' once and #include it from every output - precompile it to speed up multi-file builds",
+    nullptr,
+    [](std::string const& name) { flag_shared_prolog = name; }
+);
+
+static auto flag_include_prelude = std::string{};
+static cmdline_processor::register_flag cmd_include_prelude(
+    0,
+    "include-prelude file.h2",
+    "Compile 'file.h2' once, share its global declarations with every file compiled in this invocation, and #include its output from every generated file",
+    nullptr,
+    [](std::string const& name) { flag_include_prelude = name; }
 );
 
 static auto flag_cpp2_only = false;
@@ -115,7 +202,10 @@ static cmdline_processor::register_flag cmd_cpp2_only(
     0,
     "pure-cpp2",
     "Allow Cpp2 syntax only - also sets -import-std",
-    []{ flag_cpp2_only = true; flag_import_std = true; }
+    []{ flag_cpp2_only = true; flag_import_std = true; },
+    nullptr,
+    "p"     //  keep the documented -p spelling exact, now that other
+            //  flags starting with 'p' make the prefix ambiguous
 );
 
 static auto flag_safe_null_pointers = true;
@@ -184,6 +274,258 @@ static cmdline_processor::register_flag cmd_no_rtti(
     []{ flag_no_rtti = true; }
 );
 
+static auto flag_parse_only = false;
+static cmdline_processor::register_flag cmd_parse_only(
+    9,
+    "parse-only",
+    "Stop after parsing - report syntax errors only, emit nothing",
+    []{ flag_parse_only = true; }
+);
+
+static auto flag_check_only = false;
+static cmdline_processor::register_flag cmd_check_only(
+    9,
+    "check-only",
+    "Stop after semantic checks - report diagnostics, emit nothing",
+    []{ flag_check_only = true; }
+);
+
+static auto flag_stream_errors = false;
+static cmdline_processor::register_flag cmd_stream_errors(
+    9,
+    "stream-errors",
+    "Print errors as soon as each compile phase finds them",
+    []{ flag_stream_errors = true; }
+);
+
+static auto flag_max_errors = 0;
+static cmdline_processor::register_flag cmd_max_errors(
+    9,
+    "max-errors N",
+    "Stop compiling after N errors (0 == no limit)",
+    nullptr,
+    [](std::string const& n) { flag_max_errors = std::max( 0, atoi(n.c_str()) ); }
+);
+
+static auto flag_profile_filename = std::string{};
+static cmdline_processor::register_flag cmd_profile(
+    9,
+    "profile filename.json",
+    "Write a per-phase profile of this run in chrome://tracing format",
+    nullptr,
+    [](std::string const& name) {
+        flag_profile_filename = name;
+        profiler.enable();
+    }
+);
+
+static auto flag_batched_output = false;
+static cmdline_processor::register_flag cmd_batched_output(
+    9,
+    "batched-output",
+    "Buffer each generated file in memory and write the whole batch with grouped writes at the end of the run",
+    []{ flag_batched_output = true; }
+);
+
+static auto flag_write_if_changed = false;
+static cmdline_processor::register_flag cmd_write_if_changed(
+    9,
+    "write-if-changed",
+    "Leave an output file untouched when its regenerated bytes are identical, so its unchanged mtime stops make/ninja rebuilding dependents (implies -batched-output)",
+    []{ flag_write_if_changed = true; flag_batched_output = true; }
+);
+
+static auto flag_fsync_output = false;
+static cmdline_processor::register_flag cmd_fsync_output(
+    9,
+    "fsync-output",
+    "fsync each file written by -batched-output after writing it",
+    []{ flag_fsync_output = true; }
+);
+
+static auto flag_hot_reload_chunks = false;
+static cmdline_processor::register_flag cmd_hot_reload_chunks(
+    9,
+    "hot-reload-chunks",
+    "Also write filename.chunks, a manifest of each generated function's byte ranges and content hashes so live-reload tooling can recompile only the functions that changed (implies -batched-output)",
+    []{ flag_hot_reload_chunks = true; flag_batched_output = true; }
+);
+
+static auto flag_hoist_loop_narrowing = false;
+static cmdline_processor::register_flag cmd_hoist_loop_narrowing(
+    9,
+    "hoist-loop-narrowing",
+    "Run 'as' narrowing conversions of loop-invariant names once before the loop instead of every iteration (note: a conversion's safety check then fires before the loop body's first side effects)",
+    []{ flag_hoist_loop_narrowing = true; }
+);
+
+static auto flag_reorder_definitions = false;
+static cmdline_processor::register_flag cmd_reorder_definitions(
+    9,
+    "reorder-definitions",
+    "Emit function definitions callees-first and elide the forward declarations that ordering makes redundant, for less text to reparse downstream (implies -no-align)",
+    []{ flag_reorder_definitions = true; flag_no_align = true; }
+);
+
+static auto flag_emit_compressed = false;
+static cmdline_processor::register_flag cmd_emit_compressed(
+    9,
+    "emit-compressed",
+    "Write each output as a compressed .cz artifact for remote caching - materialize it with -decompress from the same cppfront version (implies -batched-output)",
+    []{ flag_emit_compressed = true; flag_batched_output = true; }
+);
+
+
+//-----------------------------------------------------------------------
+//
+//  output_batcher: the grouped-write backend behind -batched-output
+//
+//  Writing hundreds of generated files one ofstream open/write/close
+//  at a time tails a large batch with serial I/O. Instead, each printer
+//  hands its finished file here, and the driver writes the whole batch
+//  at the end with a few writer threads, each doing one large write
+//  (plus an fsync, under -fsync-output) per file
+//
+//-----------------------------------------------------------------------
+//
+class output_batcher
+{
+    struct pending_file {
+        std::string filename;
+        std::string contents;
+    };
+    std::mutex                m;
+    std::vector<pending_file> pending;
+
+public:
+    auto add(std::string filename, std::string&& contents)
+        -> void
+    {
+        //  Compress here rather than in write_all, so a -jobs batch
+        //  compresses on the compile threads in parallel
+        if (flag_emit_compressed) {
+            filename += ".cz";
+            contents  = artifact_codec::compress( contents );
+        }
+        auto lock = std::lock_guard{m};
+        pending.push_back({ std::move(filename), std::move(contents) });
+    }
+
+    //  Whether the file already holds exactly these bytes - a size
+    //  check first, then a chunked compare against the in-memory copy
+    static auto file_matches(std::string const& filename, std::string const& contents)
+        -> bool
+    {
+        auto ec = std::error_code{};
+        if (
+            std::filesystem::file_size( filename, ec ) != contents.size()
+            || ec
+            )
+        {
+            return false;
+        }
+        auto f = std::ifstream{ filename, std::ios::binary };
+        auto buf = std::array<char, 65536>{};
+        for (auto pos = std::size_t{0}; pos < contents.size(); )
+        {
+            auto want = std::min( buf.size(), contents.size() - pos );
+            if (
+                !f.read( buf.data(), unchecked_narrow<std::streamsize>(want) )
+                || std::memcmp( buf.data(), contents.data() + pos, want ) != 0
+                )
+            {
+                return false;
+            }
+            pos += want;
+        }
+        return true;
+    }
+
+    //  Write one file with a single large write, returning false on failure
+    static auto write_file(std::string const& filename, std::string const& contents)
+        -> bool
+    {
+        //  Under -write-if-changed, leave an already-identical file
+        //  alone - its untouched mtime is what stops a build system
+        //  from rebuilding everything downstream of a regenerated but
+        //  unchanged output
+        if (
+            flag_write_if_changed
+            && file_matches( filename, contents )
+            )
+        {
+            return true;
+        }
+
+        auto f = std::fopen( filename.c_str(), "wb" );
+        if (!f) {
+            return false;
+        }
+        auto ok =
+            std::fwrite( contents.data(), 1, contents.size(), f ) == contents.size();
+        if (flag_fsync_output) {
+            ok = std::fflush(f) == 0 && ok;
+            #if defined(_MSC_VER)
+                ok = _commit( _fileno(f) ) == 0 && ok;
+            #elif defined(__linux__) || defined(__APPLE__)
+                ok = fsync( fileno(f) ) == 0 && ok;
+            #endif
+        }
+        ok = std::fclose(f) == 0 && ok;
+        return ok;
+    }
+
+    //  Write everything queued, with up to 'jobs' writer threads, and
+    //  return the names of any files that could not be written
+    auto write_all(int jobs)
+        -> std::vector<std::string>
+    {
+        auto lock = std::lock_guard{m};
+        if (pending.empty()) {
+            return {};
+        }
+
+        auto failed   = std::vector<std::string>{};
+        auto failed_m = std::mutex{};
+        auto next     = std::atomic<std::size_t>{0};
+
+        auto writer = [&]{
+            for (;;) {
+                auto i = next.fetch_add(1, std::memory_order_relaxed);
+                if (i >= pending.size()) {
+                    return;
+                }
+                if (!write_file( pending[i].filename, pending[i].contents )) {
+                    auto flock = std::lock_guard{failed_m};
+                    failed.push_back( pending[i].filename );
+                }
+            }
+        };
+
+        auto nthreads =
+            std::max( 1, std::min( jobs, unchecked_narrow<int>(std::ssize(pending)) ) );
+        if (nthreads == 1) {
+            writer();
+        }
+        else {
+            auto writers = std::vector<std::thread>{};
+            for (auto n = 0; n < nthreads-1; ++n) {
+                writers.emplace_back( writer );
+            }
+            writer();   // this thread participates too
+            for (auto& w : writers) {
+                w.join();
+            }
+        }
+
+        pending.clear();
+        return failed;
+    }
+};
+
+static output_batcher the_output_batcher = {};
+
+
 struct text_with_pos{
     std::string     text;
     source_position pos;
@@ -194,6 +536,11 @@ class positional_printer
 {
 public:
     positional_printer()                          = default;
+    ~positional_printer() {
+        //  finalize() is idempotent, and makes sure a -batched-output
+        //  file that wasn't explicitly finalized still gets queued
+        finalize();
+    }
 private:
     positional_printer(positional_printer const&) = delete;
     void operator=(positional_printer const&)     = delete;
@@ -201,6 +548,18 @@ private:
     //  Core information
     std::ofstream               out_file        = {}; // Cpp1 syntax output file
     std::ostream*               out             = {}; // will point to out_file or cout
+    std::string*                out_string      = {}; // in-memory output target, if capturing instead
+    std::string                 out_buffer      = {}; // accumulates the output, streamed out chunkwise
+
+    //  With -batched-output the whole file accumulates here instead of
+    //  an ofstream, and finalize queues it with the output batcher
+    std::string                 batched_contents = {};
+    std::string                 batch_filename   = {};
+    bool                        batching         = false;
+
+    //  Chunk size for streaming the buffer: large enough that writes stay
+    //  few and big, small enough to bound peak memory on huge outputs
+    static constexpr auto       flush_chunk_size = ptrdiff_t{ 1 << 20 };
     std::string                 cpp2_filename   = {};
     std::string                 cpp1_filename   = {};
     std::vector<comment> const* pcomments       = {}; // Cpp2 comments data
@@ -216,6 +575,8 @@ private:
     bool            just_printed_line_directive = false;
     bool            printed_extra               = false;
     char            last_printed_char           = {};
+    lineno_t        directive_mapped_line       = -1;   // source line the next output line maps to, -1 until the first directive
+    bool            sparse_sync_point           = true; // in sparse mode, whether a statement boundary has been reached
 
     struct req_act_info {
         colno_t requested;
@@ -260,6 +621,7 @@ private:
 
     std::vector<std::string*>                emit_string_targets;       // option to emit to string instead of out file
     std::vector<std::vector<text_with_pos>*> emit_text_chunks_targets;  // similar for vector<text_pos>
+    std::vector<ptrdiff_t>                   emit_text_chunk_marks;     // size of each chunks target when pushed
 
     enum class target_type : u8 { string, chunks };
     std::vector<target_type>                 emit_target_stack;         // to interleave them sensibly
@@ -289,10 +651,13 @@ private:
                 *emit_string_targets.back() += s;
             }
 
-            //  If capturing to a vector of chunks, emit to that
+            //  If capturing to a vector of chunks, emit to that. The
+            //  chunks are kept in reverse emission order, but appending
+            //  and reversing once on pop is O(1) per chunk where
+            //  inserting at the front would be O(n)
             else {
                 assert(!emit_text_chunks_targets.empty());
-                emit_text_chunks_targets.back()->insert( emit_text_chunks_targets.back()->begin(), text_with_pos(std::string(s), pos) );
+                emit_text_chunks_targets.back()->emplace_back( std::string(s), pos );
             }
 
             return;
@@ -332,7 +697,7 @@ private:
             //  And if we did suppress any empties, emit a #line to resync
             if (empty_lines_suppressed > 0) {
                 if (!line_directive_already_done) {
-                    print_line_directive(curr_pos.lineno);
+                    print_line_directive(curr_pos.lineno, true);
                 }
                 empty_lines_suppressed = 0;
             }
@@ -340,7 +705,17 @@ private:
 
         //  Output the string
         assert (out);
-        *out << s;
+        out_buffer += s;
+        note_emitted_lines( unchecked_narrow<lineno_t>(std::count(s.begin(), s.end(), '\n')) );
+
+        //  The buffer is append-only - emitted text is never edited after
+        //  the fact - so once it reaches a chunk it can stream to disk now:
+        //  that bounds peak memory by the chunk size however large the
+        //  generated file gets, while each write stays large enough that
+        //  network file systems still see few, big writes
+        if (std::ssize(out_buffer) >= flush_chunk_size) {
+            flush_buffer();
+        }
 
         //  Update curr_pos by finding how many line breaks s contained,
         //  and where the last one was which determines our current colno
@@ -373,6 +748,17 @@ private:
     //-----------------------------------------------------------------------
     //  Internal helpers
 
+    //  Advance the running #line mapping for newlines written to the
+    //  output, so a directive that would just restate it can be skipped
+    //
+    auto note_emitted_lines( lineno_t n )
+        -> void
+    {
+        if (directive_mapped_line > 0) {
+            directive_mapped_line += n;
+        }
+    }
+
     //  Start a new line if we're not in col 1 already
     //
     auto ensure_at_start_of_new_line()
@@ -388,7 +774,14 @@ private:
 
     //  Print a #line directive
     //
-    auto print_line_directive( lineno_t line )
+    //  'fine_grained' marks intra-statement re-sync requests (from column
+    //  alignment), which -sparse-line-directives drops: the mapping then
+    //  refreshes at the next statement boundary instead
+    //
+    auto print_line_directive(
+        lineno_t line,
+        bool     fine_grained = false
+    )
         -> void
     {
         //  Ignore requests from generated code (negative line numbers)
@@ -396,16 +789,42 @@ private:
             return;
         }
 
+        if (
+            fine_grained
+            && flag_sparse_line_directives
+            && !sparse_sync_point
+            )
+        {
+            return;
+        }
+
         //  Otherwise, implement the request
         prev_line_info = { curr_pos.lineno, { } };
         ensure_at_start_of_new_line();
 
+        //  If the running mapping already puts the next output line at
+        //  'line', the directive would just restate it - skip it
+        if (line == directive_mapped_line) {
+            just_printed_line_directive = true;
+            return;
+        }
+
         //  Not using print() here because this is transparent to the curr_pos
         if (!flag_clean_cpp1) {
             assert (out);
-            *out << "#line " << line << " " << std::quoted(cpp2_filename) << "\n";
+            out_buffer += "#line " + std::to_string(line) + " \"";
+            for (auto c : cpp2_filename) {
+                //  Quote the filename the way std::quoted would
+                if (c == '\\' || c == '"') {
+                    out_buffer += '\\';
+                }
+                out_buffer += c;
+            }
+            out_buffer += "\"\n";
+            directive_mapped_line = line;
         }
         just_printed_line_directive = true;
+        sparse_sync_point           = false;
     }
 
     //  Catch up with comment/blank lines
@@ -435,6 +854,11 @@ private:
     auto flush_comments( source_position pos )
         -> void
     {
+        //  Comment replay exists only for human-readable fidelity
+        if (flag_no_align) {
+            return;
+        }
+
         if (!pcomments) {
             return;
         }
@@ -483,6 +907,9 @@ private:
 
     auto print_unprinted_comments()
     {
+        if (flag_no_align) {
+            return;
+        }
         for (auto const& c : *pcomments) {
             if (!c.dbg_was_printed) {
                 print_comment(c);
@@ -496,6 +923,33 @@ private:
     auto align_to( source_position pos )
         -> void
     {
+        //  In -no-align mode, skip the source-position fidelity work:
+        //  all the generated code needs for correctness is token
+        //  separation and line sync, so emit just that
+        if (flag_no_align) {
+            if (curr_pos.lineno != pos.lineno) {
+                //  Terminate the current output line directly - curr_pos
+                //  can be stale here after untracked print_extra output,
+                //  and print("\n") could be eaten by empty-line suppression
+                if (last_printed_char != '\n') {
+                    out_buffer += '\n';
+                    note_emitted_lines( 1 );
+                    last_printed_char = '\n';
+                }
+                curr_pos.colno = 1;
+                print_line_directive(pos.lineno, true);
+                curr_pos.lineno = pos.lineno;
+            }
+            else if (
+                curr_pos.colno > 1
+                && last_printed_char != ' '
+                )
+            {
+                print( " " );
+            }
+            return;
+        }
+
         auto on_same_line = curr_pos.lineno == pos.lineno;
 
         //  Ignoring this logic is used when we're generating new code sections,
@@ -516,7 +970,7 @@ private:
             && !on_same_line
             )
         {
-            print_line_directive(pos.lineno);
+            print_line_directive(pos.lineno, true);
             curr_pos.lineno = pos.lineno;
             printed_extra = false;
         }
@@ -526,7 +980,7 @@ private:
             //  (this might get ignored and we'll get the line directive)
             print( "\n" );
             if (curr_pos.lineno != pos.lineno) {
-                print_line_directive(pos.lineno);
+                print_line_directive(pos.lineno, true);
             }
             curr_pos.lineno = pos.lineno;
         }
@@ -543,18 +997,20 @@ private:
             && curr_pos.lineno < std::ssize(psource->get_lines())
             )
         {
+            auto const& line = psource->get_lines()[curr_pos.lineno];
+
             //  Record this line's indentation as the 'last' line for next time
-            last_line_indentation = psource->get_lines()[curr_pos.lineno].indent();
+            last_line_indentation = line.indent();
 
             //  If this line was originally densely spaced (had <2 whitespace
             //  between all tokens), then the programmer likely wasn't doing a lot
             //  of special formatting...
-            if (psource->get_lines()[curr_pos.lineno].all_tokens_are_densely_spaced)
+            if (line.all_tokens_are_densely_spaced)
             {
                 //  For the first token in a line, use the line's original indentation
                 if (curr_pos.colno <= 1)
                 {
-                    print( pad( psource->get_lines()[curr_pos.lineno].indent() ) );
+                    print( pad( line.indent() ) );
                 }
                 //  For later tokens, don't try to add padding
                 else {
@@ -631,6 +1087,12 @@ public:
         if (cpp1_filename == "stdout") {
             out = &std::cout;
         }
+        else if (flag_batched_output) {
+            batching       = true;
+            batch_filename = cpp1_filename;
+            out_string     = &batched_contents;
+            out            = &std::cout;    // never written to - flush_buffer diverts to 'target'
+        }
         else {
             out_file.open(cpp1_filename);
             out = &out_file;
@@ -640,6 +1102,33 @@ public:
         pparser   = &parser;
     }
 
+    //  Open for in-memory output: the generated Cpp1 accumulates in
+    //  'target' instead of a file - see cpp2::compile
+    //
+    auto open_string_capture(
+        std::string const&          cpp2_filename_,
+        std::string const&          cpp1_filename_,
+        std::string&                target,
+        std::vector<comment> const& comments,
+        cpp2::source const&         source,
+        cpp2::parser const&         parser
+    )
+        -> void
+    {
+        cpp2_filename = cpp2_filename_;
+        assert(
+            !is_open()
+            && !pcomments
+            && "ICE: tried to call .open twice"
+        );
+        cpp1_filename = cpp1_filename_;
+        out_string    = &target;
+        out           = &std::cout;    // never written to - flush_buffer diverts to 'target'
+        pcomments     = &comments;
+        psource       = &source;
+        pparser       = &parser;
+    }
+
     auto reopen()
         -> void
     {
@@ -648,8 +1137,169 @@ public:
             && "ICE: tried to call .reopen without first calling .open"
         );
         assert(cpp1_filename.ends_with(".h"));
-        out_file.close();
-        out_file.open(cpp1_filename + "pp");
+        flush_buffer();
+        if (batching) {
+            the_output_batcher.add( batch_filename, std::move(batched_contents) );
+            batched_contents = {};
+            batch_filename   = cpp1_filename + "pp";
+        }
+        else {
+            out_file.close();
+            out_file.open(cpp1_filename + "pp");
+        }
+    }
+
+    //  Whitespace-level minifier for -compact-cpp1: strips each output
+    //  line's indentation and trailing blanks. Only whitespace outside
+    //  raw string literals is touched - the amount of whitespace never
+    //  matters to the Cpp1 compiler anywhere else - and every newline
+    //  is kept, so #line mapping is unaffected. The lexing state lives
+    //  across calls because the buffer streams out in arbitrary chunks
+    //
+    struct compactor
+    {
+        bool        at_line_start    = true;
+        bool        in_line_comment  = false;
+        bool        in_block_comment = false;
+        bool        in_string        = false;
+        bool        in_char          = false;
+        bool        escaped          = false;
+        bool        reading_raw_intro= false;
+        bool        in_raw_string    = false;
+        std::string raw_close        = {};    // the )delim" that ends the raw string
+        std::size_t raw_match        = 0;     // how much of raw_close we've seen
+        std::string pending_blanks   = {};    // blanks held until we know they're interior
+        char        prev             = {};
+
+        auto filter(std::string const& in)
+            -> std::string
+        {
+            auto ret = std::string{};
+            ret.reserve(in.size());
+
+            for (auto c : in)
+            {
+                //  Raw string contents (and the R"delim( intro) go
+                //  through verbatim - their whitespace is data
+                if (in_raw_string) {
+                    ret += c;
+                    if (c == raw_close[raw_match]) {
+                        if (++raw_match == raw_close.size()) { in_raw_string = false; }
+                    }
+                    else {
+                        raw_match = c == raw_close[0] ? 1 : 0;
+                    }
+                    prev = c;
+                    continue;
+                }
+                if (reading_raw_intro) {
+                    ret += c;
+                    if (c == '(') {
+                        raw_close += '"';
+                        raw_match         = 0;
+                        reading_raw_intro = false;
+                        in_raw_string     = true;
+                    }
+                    else {
+                        raw_close += c;
+                    }
+                    prev = c;
+                    continue;
+                }
+
+                if (c == '\n') {
+                    //  Dropping the held blanks here is the trailing strip;
+                    //  the newline itself always survives
+                    pending_blanks.clear();
+                    ret += c;
+                    at_line_start   = true;
+                    in_line_comment = false;
+                    in_string       = false;    // ordinary literals can't span lines
+                    in_char         = false;
+                    escaped         = false;
+                    prev            = c;
+                    continue;
+                }
+                if (c == ' ' || c == '\t') {
+                    pending_blanks += c;
+                    prev = ' ';
+                    continue;
+                }
+
+                //  A non-blank: leading blanks are dropped, interior
+                //  blanks are kept exactly as emitted
+                if (at_line_start) {
+                    pending_blanks.clear();
+                    at_line_start = false;
+                }
+                else {
+                    ret += pending_blanks;
+                    pending_blanks.clear();
+                }
+
+                if (in_line_comment)       { }
+                else if (in_block_comment) { if (c == '/' && prev == '*') { in_block_comment = false; } }
+                else if (in_string)        { if (c == '"'  && !escaped) { in_string = false; } }
+                else if (in_char)          { if (c == '\'' && !escaped) { in_char   = false; } }
+                else if (c == '"') {
+                    //  R immediately before the quote (no blanks between)
+                    //  makes this a raw string literal
+                    if (prev == 'R') { reading_raw_intro = true; raw_close = ")"; }
+                    else             { in_string = true; }
+                }
+                else if (c == '\'') {
+                    //  A ' right after an alphanumeric is a digit separator
+                    //  (or u8/u/U/L prefix - either way interior blanks are
+                    //  preserved, so misreading those is harmless)
+                    if (!isalnum(prev)) { in_char = true; }
+                }
+                else if (c == '/' && prev == '/') { in_line_comment  = true; }
+                else if (c == '*' && prev == '/') {
+                    //  Neutralize prev so "/*/" doesn't read as open+close
+                    in_block_comment = true;
+                    ret  += c;
+                    prev  = {};
+                    continue;
+                }
+
+                escaped = (in_string || in_char) && c == '\\' && !escaped;
+                ret  += c;
+                prev  = c;
+            }
+            return ret;
+        }
+    };
+    compactor compact = {};
+
+    //  Write the accumulated output with one large write - doing
+    //  thousands of small stream writes per file costs real time on
+    //  network file systems
+    //
+    auto flush_buffer()
+        -> void
+    {
+        if (
+            out
+            && !out_buffer.empty()
+            )
+        {
+            if (flag_compact_cpp1) {
+                auto compacted = compact.filter(out_buffer);
+                if (out_string) {
+                    *out_string += compacted;
+                }
+                else {
+                    out->write( compacted.data(), std::ssize(compacted) );
+                }
+            }
+            else if (out_string) {
+                *out_string += out_buffer;
+            }
+            else {
+                out->write( out_buffer.data(), std::ssize(out_buffer) );
+            }
+            out_buffer.clear();
+        }
     }
 
     auto is_open()
@@ -666,29 +1316,99 @@ public:
 
 
     //-----------------------------------------------------------------------
-    //  Abandon: close and delete
+    //  Finalize: flush buffered text and close the output file, so the
+    //  on-disk file is complete for anyone who reads it before this
+    //  printer is destroyed (see -cache-dir, which copies it)
     //
-    auto abandon()
+    auto finalize()
         -> void
     {
-        if (!is_open()) {
-            return;
+        flush_buffer();
+        if (batching) {
+            the_output_batcher.add( batch_filename, std::move(batched_contents) );
+            batched_contents = {};
+            batching         = false;
         }
         if (out_file.is_open()) {
             out_file.close();
-            std::remove(cpp1_filename.c_str());
         }
     }
 
 
     //-----------------------------------------------------------------------
-    //  Print extra text and don't track positions
-    //  Used for Cpp2 boundary comment and prelude and final newline
+    //  Byte-offset queries for -hot-reload-chunks: only meaningful in
+    //  -batched-output mode, where the whole file is in memory and the
+    //  offset of every byte is final once it has been flushed (including
+    //  any -compact-cpp1 rewriting, which happens during the flush)
     //
-    auto print_extra( std::string_view s )
-        -> void
+    auto is_batching() const
+        -> bool
     {
-        assert(
+        return batching;
+    }
+
+    auto is_capturing() const
+        -> bool
+    {
+        return !emit_target_stack.empty();
+    }
+
+    //  The offset the next byte of output will land at
+    auto get_batched_offset()
+        -> ptrdiff_t
+    {
+        assert(
+            batching
+            && "ICE: byte offsets are only stable in -batched-output mode"
+        );
+        flush_buffer();
+        return std::ssize(batched_contents);
+    }
+
+    //  The batched file contents accumulated so far (valid until the
+    //  next print, finalize, or reopen)
+    auto peek_batched_contents()
+        -> std::string_view
+    {
+        assert(
+            batching
+            && "ICE: only a -batched-output file can be peeked at"
+        );
+        flush_buffer();
+        return batched_contents;
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  Abandon: close and delete
+    //
+    auto abandon()
+        -> void
+    {
+        if (!is_open()) {
+            return;
+        }
+        out_buffer.clear();
+        if (batching) {
+            //  Nothing queued yet for this file, so just drop the contents
+            batched_contents.clear();
+            batching = false;
+        }
+        if (out_file.is_open()) {
+            out_file.close();
+            std::remove(cpp1_filename.c_str());
+        }
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  Print extra text and don't track positions
+    //  Used for Cpp2 boundary comment and prelude and final newline
+    //
+    auto print_extra( std::string_view s )
+        -> void
+    {
+        assert(
             is_open()
             && "ICE: printer must be open before printing"
         );
@@ -726,6 +1446,67 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  Print a run of consecutive Cpp1 lines starting at first_line
+    //
+    //  Mixed files are often mostly Cpp1, and passthrough lines don't
+    //  need the general print() positioning work - sync the line number
+    //  once, then block-copy the text, and leave the printer state
+    //  exactly as the equivalent print_cpp1 calls would have
+    //
+    auto print_cpp1_block(
+        std::vector<std::string_view> const& lines,
+        lineno_t                             first_line
+    )
+        -> void
+    {
+        assert(
+            is_open()
+            && !lines.empty()
+            && first_line >= 0
+            && "ICE: printer must be open before printing, and line number must not be negative (Cpp1 code is never generated)"
+        );
+
+        //  Always start a Cpp1 line on its own new line
+        ensure_at_start_of_new_line();
+
+        //  If we are out of sync with the current logical line number,
+        //  emit a #line directive to re-sync
+        auto line_directive_already_done = std::exchange(just_printed_line_directive, false);
+        if (curr_pos.lineno != first_line) {
+            print_line_directive( first_line );
+            curr_pos.lineno = first_line;
+            line_directive_already_done = true;
+        }
+
+        //  And if we did suppress any empties, emit a #line to resync
+        if (
+            empty_lines_suppressed > 0
+            && !line_directive_already_done
+            )
+        {
+            print_line_directive( curr_pos.lineno );
+        }
+        empty_lines_suppressed      = 0;
+        just_printed_line_directive = false;
+
+        //  Copy the whole run through, and update our position to just
+        //  past its final newline
+        assert (curr_pos.colno == 1);
+        for (auto line : lines) {
+            out_buffer += line;
+            out_buffer += '\n';
+        }
+        note_emitted_lines( unchecked_narrow<lineno_t>(std::ssize(lines)) );
+
+        curr_pos.lineno  += unchecked_narrow<lineno_t>(std::ssize(lines));
+        curr_pos.colno    = 1;
+        pad_for_this_line = 0;
+        last_printed_char = '\n';
+        last_was_empty    = lines.back().empty();
+    }
+
+
     //-----------------------------------------------------------------------
     //  Used when we start a new Cpp2 section, or when we emit the same item
     //  more than once (notably when we emit operator= more than once)
@@ -751,6 +1532,17 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  The emitter notes each statement start here, so that in
+    //  -sparse-line-directives mode the next re-sync request is honored
+    //
+    auto note_statement_boundary()
+        -> void
+    {
+        sparse_sync_point = true;
+    }
+
+
     //-----------------------------------------------------------------------
     //  Print a Cpp2 item, which should be at pos
     //
@@ -770,7 +1562,8 @@ public:
             //  line numbers), then shunt this call to print_extra instead
             if (pos.lineno < 1) {
                 if (generated_pos_line != pos.lineno) {
-                    *out << "\n" + std::string(last_line_indentation, ' ');
+                    out_buffer += "\n" + std::string(last_line_indentation, ' ');
+                    note_emitted_lines( 1 );
                     generated_pos_line = pos.lineno;
                 }
                 print_extra(s);
@@ -787,6 +1580,28 @@ public:
             && "ICE: printer must be open before printing"
         );
 
+        //  Fast path for the hottest codegen case: a plain piece of text
+        //  on the line we're already on, with no newlines to split and no
+        //  pending position overrides. The vertical catch-up, preemption,
+        //  and indent-heuristic adjustments are all no-ops then, so go
+        //  straight to column alignment and output
+        //
+        if (
+            emit_target_stack.empty()
+            && preempt_pos.empty()
+            && pos.lineno == curr_pos.lineno
+            && !s.empty()
+            && !is_known_empty
+            && s.find('\n') == s.npos
+            )
+        {
+            enable_indent_heuristic = true;
+            align_to(pos);
+            prev_line_info.requests.push_back( req_act_info( pos.colno /*requested*/ , curr_pos.colno /*actual*/ - pos.colno ) );
+            print(s, pos);
+            return;
+        }
+
         //  If there are any embedded newlines, split this string into
         //  separate print_cpp2 calls
         if (auto newline_pos = s.find('\n');
@@ -983,10 +1798,17 @@ public:
     {
         if (target) {
             emit_text_chunks_targets.push_back( target );
+            emit_text_chunk_marks  .push_back( std::ssize(*target) );
             emit_target_stack.push_back(target_type::chunks);
         }
         else {
+            //  The chunks were appended in emission order - reverse what
+            //  this capture added, to keep presenting them in the reverse
+            //  order the consumers expect
+            auto& chunks = *emit_text_chunks_targets.back();
+            std::reverse( chunks.begin() + emit_text_chunk_marks.back(), chunks.end() );
             emit_text_chunks_targets.pop_back();
+            emit_text_chunk_marks  .pop_back();
             emit_target_stack.pop_back();
         }
     }
@@ -1005,6 +1827,216 @@ struct function_prolog {
     std::vector<std::string> statements = {};
 };
 
+
+//  phase_timer: adds the enclosing scope's elapsed wall time, in
+//  microseconds, into the given accumulator when the scope exits -
+//  microseconds because a single regression test compiles in well
+//  under a millisecond, and the per-test ledgers need nonzero numbers
+//
+auto phase_timer(long long& into)
+{
+    return finally( [&into, start = std::chrono::steady_clock::now()] {
+        into += std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+    });
+}
+
+
+//  stats_visitor: walks the parse tree counting the shapes that -stats
+//  reports - see cppfront::emit_stats
+//
+struct stats_visitor
+{
+    static constexpr std::string_view pass_name = "stats";
+
+    long long nodes         = 0;
+    long long declarations  = 0;
+    long long functions     = 0;
+    long long types         = 0;
+    long long namespaces    = 0;
+    long long ufcs_calls    = 0;
+    long long inspects      = 0;
+    long long metafunctions = 0;
+
+    auto start(declaration_node const& n, int) -> void
+    {
+        ++nodes;
+        ++declarations;
+        functions     += n.is_function();
+        types         += n.is_type();
+        namespaces    += n.is_namespace();
+        metafunctions += std::ssize(n.metafunctions);
+    }
+
+    auto start(postfix_expression_node const& n, int) -> void
+    {
+        ++nodes;
+        //  A '.' term immediately followed by a '(' term is a UFCS-style
+        //  call site (whether it ends up lowered as member or non-member)
+        for (auto i = 0; i+1 < std::ssize(n.ops); ++i) {
+            ufcs_calls +=
+                n.ops[i  ].op->type() == lexeme::Dot
+                && n.ops[i+1].op->type() == lexeme::LeftParen
+                ;
+        }
+    }
+
+    auto start(inspect_expression_node const&, int) -> void
+    {
+        ++nodes;
+        ++inspects;
+    }
+
+    auto start(auto const&, int) -> void { ++nodes; }
+    auto end  (auto const&, int) -> void { }
+};
+
+
+//  instantiation_budget: one file's counts of the constructs that expand
+//  into distinct template instantiations in the generated Cpp1, plus a
+//  rough relative cost estimate - see -budget in main()
+//
+struct instantiation_budget
+{
+    std::string file;
+    long long   ufcs_calls     = 0;
+    long long   is_as_tests    = 0;
+    long long   inspect_arms   = 0;
+    long long   interpolations = 0;
+
+    //  Rough relative weights: a UFCS call site instantiates a distinct
+    //  cpp2::ufcs specialization (the member name is an NTTP), an is/as
+    //  test or inspect arm instantiates cpp2::is / cpp2::as over the
+    //  operand types, and each interpolated segment instantiates
+    //  cpp2::to_string. The absolute numbers mean nothing - the ranking
+    //  across files is the point
+    auto estimated_cost() const
+        -> long long
+    {
+        return
+            10 * ufcs_calls
+            + 6 * inspect_arms
+            + 4 * is_as_tests
+            + 3 * interpolations
+            ;
+    }
+};
+
+
+//  budget_visitor: walks the parse tree counting the instantiation-
+//  generating constructs that -budget reports - see
+//  cppfront::get_instantiation_budget
+//
+struct budget_visitor
+{
+    static constexpr std::string_view pass_name = "budget";
+
+    long long ufcs_calls   = 0;
+    long long is_as_tests  = 0;
+    long long inspect_arms = 0;
+
+    auto start(postfix_expression_node const& n, int) -> void
+    {
+        //  Same UFCS call site detection as stats_visitor
+        for (auto i = 0; i+1 < std::ssize(n.ops); ++i) {
+            ufcs_calls +=
+                n.ops[i  ].op->type() == lexeme::Dot
+                && n.ops[i+1].op->type() == lexeme::LeftParen
+                ;
+        }
+    }
+
+    auto start(is_as_expression_node const& n, int) -> void
+    {
+        is_as_tests += std::ssize(n.ops);
+    }
+
+    auto start(inspect_expression_node const& n, int) -> void
+    {
+        inspect_arms += std::ssize(n.alternatives);
+    }
+
+    auto start(auto const&, int) -> void { }
+    auto end  (auto const&, int) -> void { }
+};
+
+
+//-----------------------------------------------------------------------
+//
+//  fused_passes: run several node-local analyses in one tree walk
+//
+//  Each additional full-tree visit re-pays the traversal overhead -
+//  variant dispatch and pointer chasing per node - even when the
+//  per-node work is a handful of adds, as in stats_visitor and
+//  budget_visitor. Any pass with the start/end visitor shape and no
+//  ordering dependency on another pass can ride along here, and the
+//  whole set costs one walk. When -profile is active, the per-node
+//  callbacks are timed individually so the trace attributes the fused
+//  walk's time to each pass by its pass_name
+//
+//-----------------------------------------------------------------------
+//
+template <typename... Passes>
+class fused_passes
+{
+    std::tuple<Passes...>                    passes;
+    std::array<long long, sizeof...(Passes)> pass_ns = {};
+    bool                                     timed   = profiler.is_active();
+
+    auto each(auto&& f)
+        -> void
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (f( std::get<Is>(passes), Is ), ...);
+        }( std::index_sequence_for<Passes...>{} );
+    }
+
+    auto dispatch(auto&& call)
+        -> void
+    {
+        if (!timed) {
+            each( [&](auto& pass, auto) { call(pass); } );
+        }
+        else {
+            each( [&](auto& pass, auto i) {
+                auto t0 = std::chrono::steady_clock::now();
+                call(pass);
+                pass_ns[i] += (std::chrono::steady_clock::now() - t0).count();
+            } );
+        }
+    }
+
+public:
+    auto start(auto const& n, int depth) -> void
+        { dispatch( [&](auto& pass) { pass.start(n, depth); } ); }
+
+    auto end(auto const& n, int depth) -> void
+        { dispatch( [&](auto& pass) { pass.end(n, depth); } ); }
+
+    //  Attach each pass's accumulated time to the innermost open
+    //  profiler scope - call right after the visit, inside the scope
+    //  that timed the fused walk
+    auto report_timings()
+        -> void
+    {
+        if (!timed) {
+            return;
+        }
+        each( [&](auto& pass, auto i) {
+            profiler.count( std::string{pass.pass_name} + " ns", pass_ns[i] );
+        } );
+    }
+
+    template <typename Pass>
+    auto get()
+        -> Pass&
+    {
+        return std::get<Pass>(passes);
+    }
+};
+
+
 class cppfront
 {
     std::string              sourcefile;
@@ -1023,6 +2055,322 @@ class cppfront
     bool violates_initialization_safety = false;
     bool suppress_move_from_last_use    = false;
 
+    //  Per-compile snapshot of the safety-check flags. The emit paths
+    //  test these per construct, and the globals are mutable so the
+    //  compiler has to reload them across every opaque call; a const
+    //  member is loaded once per function and the flags can't change
+    //  mid-compile anyway (full specialization of the emitter over a
+    //  compile-time flag bundle isn't worth it here - the emit
+    //  functions are one big mutually recursive family, so every
+    //  combination would instantiate all of it)
+    //
+    struct {
+        bool const null_pointers = flag_safe_null_pointers;
+        bool const zero_division = flag_safe_zero_division;
+        bool const subscripts    = flag_safe_subscripts;
+        bool const comparisons   = flag_safe_comparisons;
+    } safe;
+
+    //  The number of errors already printed in -stream-errors mode
+    ptrdiff_t streamed_errors = 0;
+
+    //  Per-phase wall times, reported by -stats - cheap enough to
+    //  always record
+    struct {
+        long long lex   = 0;
+        long long parse = 0;
+        long long sema  = 0;
+        long long emit  = 0;
+    } phase_us;
+
+    //  The node-local micro-passes, fused into one tree walk on first
+    //  demand - -stats and -budget in the same invocation share it
+    std::optional<fused_passes<stats_visitor, budget_visitor>> micro_passes = {};
+
+    //  -function-heat data, loaded on first use: declaration line -> is-hot
+    std::unordered_map<lineno_t, bool> function_heat        = {};
+    bool                               function_heat_loaded = false;
+
+    //  -hot-reload-chunks bookkeeping: for each named function, the byte
+    //  ranges its generated Cpp1 occupies in the output - its phase 1
+    //  declaration (the interface other chunks compile against) and its
+    //  phase 2 definition (the chunk a live-reload pipeline recompiles)
+    //  - see emit_chunk_manifest
+    struct function_chunk {
+        declaration_node const* decl;
+        ptrdiff_t decl_begin = -1;
+        ptrdiff_t decl_end   = -1;
+        ptrdiff_t defn_begin = -1;
+        ptrdiff_t defn_end   = -1;
+    };
+    std::vector<function_chunk>                              function_chunks      = {};
+    std::unordered_map<declaration_node const*, std::size_t> function_chunk_index = {};
+
+    //  RAII helper: emit(declaration_node) opens one of these around a
+    //  function's emission, so every exit path records the end offset
+    struct chunk_recorder
+    {
+        cppfront*               c          = {};
+        declaration_node const* decl       = {};
+        bool                    definition = false;
+
+        chunk_recorder() = default;
+
+        auto open(cppfront& c_, declaration_node const& n)
+            -> void
+        {
+            c          = &c_;
+            decl       = &n;
+            definition = c->printer.get_phase() == c->printer.phase2_func_defs;
+            auto [it, added] = c->function_chunk_index.try_emplace( decl, c->function_chunks.size() );
+            if (added) {
+                c->function_chunks.push_back({ decl });
+            }
+            auto& entry = c->function_chunks[it->second];
+            (definition ? entry.defn_begin : entry.decl_begin) = c->printer.get_batched_offset();
+        }
+
+        ~chunk_recorder() {
+            if (c) {
+                auto& entry = c->function_chunks[c->function_chunk_index[decl]];
+                (definition ? entry.defn_end : entry.decl_end) = c->printer.get_batched_offset();
+            }
+        }
+    };
+
+    //  The name a function chunk is reported under: its declared name,
+    //  qualified with the enclosing namespace/type names
+    static auto chunk_name_of(declaration_node const& n)
+        -> std::string
+    {
+        assert(n.name());
+        auto ret = n.name()->to_string();
+        for (
+            auto parent = n.parent_declaration;
+            parent && parent->name();
+            parent = parent->parent_declaration
+            )
+        {
+            ret = parent->name()->to_string() + "::" + ret;
+        }
+        return ret;
+    }
+
+    //  -reorder-definitions planning state: the final phase 2 emission
+    //  order, and the declarations whose phase 1 forward declaration
+    //  that order makes redundant
+    //  - see plan_definition_order
+    std::vector<declaration_node const*>        definition_emit_order = {};
+    std::unordered_set<declaration_node const*> elided_fwd_decls      = {};
+
+    //  The declaration-subtree walk behind plan_definition_order,
+    //  below: collect every name a declaration mentions
+    struct reference_collector
+    {
+        std::unordered_set<std::string_view> names = {};
+
+        auto start(token const& t, int) -> void
+        {
+            if (t.type() == lexeme::Identifier) {
+                names.insert( t.as_string_view() );
+            }
+        }
+        auto start(auto const&, int) -> void { }
+        auto end  (auto const&, int) -> void { }
+    };
+
+    //  -reorder-definitions: plan a callees-before-callers order for
+    //  the phase 2 definitions of the top-level functions, so that most
+    //  of their phase 1 forward declarations become redundant and can
+    //  be elided. The analysis is by name, so a forward declaration
+    //  stays whenever that can't prove every use will follow the
+    //  definition: overload sets, mutual recursion (broken in source
+    //  order), names also mentioned by a Cpp1 line or by a non-function
+    //  declaration, defaulted parameters (the default argument is
+    //  emitted on the declaration only), and 'main'
+    //
+    auto plan_definition_order(
+        std::vector<declaration_node const*> const& decls
+    )
+        -> void
+    {
+        struct func_plan {
+            std::size_t                     slot;
+            std::string_view                name;
+            std::unordered_set<std::size_t> deps      = {};
+            bool                            needs_fwd = false;
+        };
+        auto funcs      = std::vector<func_plan>{};
+        auto func_index = std::unordered_map<declaration_node const*, std::size_t>{};
+
+        //  The reorderable declarations are the named non-operator
+        //  functions - an operator's call sites don't mention its name,
+        //  so they can't be found by name
+        for (auto slot = std::size_t{0}; slot < decls.size(); ++slot)
+        {
+            auto decl = decls[slot];
+            if (
+                decl->is_function()
+                && decl->has_name()
+                && decl->name()->type() == lexeme::Identifier
+                )
+            {
+                func_index[decl] = funcs.size();
+                funcs.push_back({ slot, decl->name()->as_string_view() });
+            }
+        }
+
+        //  Resolve names to functions - an overloaded name is left
+        //  unresolved, and every function it names keeps its forward
+        //  declaration so the call sites stay order-independent
+        auto func_of = std::unordered_map<std::string_view, std::size_t>{};
+        for (auto i = std::size_t{0}; i < funcs.size(); ++i)
+        {
+            auto [iter, added] = func_of.try_emplace( funcs[i].name, i );
+            if (!added) {
+                funcs[i].needs_fwd             = true;
+                funcs[iter->second].needs_fwd  = true;
+                iter->second                   = funcs.size();  // sentinel: ambiguous
+            }
+        }
+        std::erase_if(
+            func_of,
+            [&](auto const& entry) { return entry.second == funcs.size(); }
+        );
+
+        for (auto& f : funcs)
+        {
+            if (f.name == "main") {
+                f.needs_fwd = true;
+            }
+
+            //  A default argument is emitted on the phase 1 declaration
+            //  only, so a caller relying on it needs that declaration
+            auto& func = std::get<declaration_node::a_function>(decls[f.slot]->type);
+            for (auto& param : func->parameters->parameters) {
+                if (
+                    param->declaration
+                    && param->declaration->initializer
+                    )
+                {
+                    f.needs_fwd = true;
+                }
+            }
+        }
+
+        //  Collect each declaration's name references: references
+        //  between reorderable functions become ordering edges, and a
+        //  reference from anything else pins the callee's forward
+        //  declaration (it could be evaluated as early as phase 1,
+        //  e.g. in a type's data member initializer)
+        for (auto slot = std::size_t{0}; slot < decls.size(); ++slot)
+        {
+            auto refs = reference_collector{};
+            //  visit() is a non-const walk for historical reasons; this
+            //  visitor only reads (see find() in extrinsic_storage)
+            const_cast<declaration_node&>(*decls[slot]).visit( refs, 0 );
+
+            auto self = func_index.find( decls[slot] );
+            for (auto name : refs.names)
+            {
+                auto callee = func_of.find( name );
+                if (callee == func_of.end()) {
+                    continue;
+                }
+                if (self == func_index.end()) {
+                    funcs[callee->second].needs_fwd = true;
+                }
+                else if (callee->second != self->second) {
+                    funcs[self->second].deps.insert( callee->second );
+                }
+            }
+        }
+
+        //  A name a Cpp1 line mentions may be used by code we don't
+        //  analyze - a substring scan is enough to be safe, and a false
+        //  positive just keeps a declaration (the same approach as
+        //  -drop-unused-includes)
+        for (auto& f : funcs)
+        {
+            if (f.needs_fwd) {
+                continue;
+            }
+            for (auto const& line : source.get_lines()) {
+                if (
+                    line.cat != source_line::category::cpp2
+                    && line.text.find(f.name) != std::string::npos
+                    )
+                {
+                    f.needs_fwd = true;
+                    break;
+                }
+            }
+        }
+
+        //  Order callees before callers, keeping source order among the
+        //  unconstrained. On a dependency cycle, emit the earliest
+        //  remaining function anyway - its not-yet-emitted callees keep
+        //  their forward declarations instead
+        auto order  = std::vector<std::size_t>{};
+        auto placed = std::vector<bool>( funcs.size(), false );
+        while (std::ssize(order) < std::ssize(funcs))
+        {
+            auto pick = funcs.size();
+            for (auto i = std::size_t{0}; i < funcs.size(); ++i)
+            {
+                if (placed[i]) {
+                    continue;
+                }
+                auto ready = true;
+                for (auto d : funcs[i].deps) {
+                    ready &= placed[d];
+                }
+                if (ready) {
+                    pick = i;
+                    break;
+                }
+            }
+            if (pick == funcs.size()) {
+                for (auto i = std::size_t{0}; i < funcs.size(); ++i) {
+                    if (!placed[i]) {
+                        pick = i;
+                        break;
+                    }
+                }
+                for (auto d : funcs[pick].deps) {
+                    if (!placed[d]) {
+                        funcs[d].needs_fwd = true;
+                    }
+                }
+            }
+            placed[pick] = true;
+            order.push_back( pick );
+        }
+
+        //  Fill the function-sized slots of the source order with the
+        //  planned order, leaving every other declaration (types,
+        //  namespaces, objects, operators) exactly where it was
+        definition_emit_order.reserve( decls.size() );
+        for (
+            auto next = std::size_t{0};
+            auto decl : decls
+            )
+        {
+            if (func_index.contains(decl)) {
+                definition_emit_order.push_back( decls[ funcs[ order[next++] ].slot ] );
+            }
+            else {
+                definition_emit_order.push_back( decl );
+            }
+        }
+
+        for (auto& f : funcs) {
+            if (!f.needs_fwd) {
+                elided_fwd_decls.insert( decls[f.slot] );
+            }
+        }
+    }
+
     declaration_node const* having_signature_emitted = {};
 
     declaration_node const*   generating_assignment_from      = {};
@@ -1080,6 +2428,18 @@ class cppfront
         std::vector<std::string>                   epilog                       = {};
         int                                        ordinal                      = {};
 
+        //  NRVO lowering for a single named return value: when sema
+        //  proves the return object has exactly one construction point
+        //  and it's a top-level statement of the function body, skip
+        //  the deferred_init<> wrapper and instead declare the object
+        //  right at that statement and 'return ret;' it by name, so
+        //  the Cpp1 compiler can construct it in the caller's return
+        //  slot instead of move-constructing out of the wrapper
+        //
+        declaration_node const* nrvo_decl = {};   // the return object's declaration
+        token const*            nrvo_init = {};   // its unique construction token
+        std::string             nrvo_type = {};   // its type, as emitted text
+
         function_info(
             declaration_node const*                    decl_,
             function_type_node const*                  func_,
@@ -1111,6 +2471,20 @@ class cppfront
             return list.back();
         }
 
+        //  Whether 'd' is the NRVO return object of any function we're
+        //  inside - a lambda in the body still names the object plainly
+        auto is_nrvo_decl(declaration_node const* d) -> bool {
+            if (!d) {
+                return false;
+            }
+            for (auto i = size_t{0}; i < list.size(); ++i) {
+                if (list[i].nrvo_decl == d) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         auto empty() -> bool {
             return list.empty();
         }
@@ -1121,6 +2495,7 @@ class cppfront
     //
     positional_printer printer;
     bool               in_definite_init  = false;
+    bool               in_nrvo_init      = false;
     bool               in_parameter_list = false;
 
     struct function_return {
@@ -1149,6 +2524,12 @@ class cppfront
     };
     std::vector<iter_info> iteration_statements;
 
+    //  -hoist-loop-narrowing bookkeeping: the 'x as T' conversions
+    //  hoisted out of the loops currently being emitted, each mapped to
+    //  the generated local that holds the hoisted conversion's result
+    std::unordered_map<is_as_expression_node const*, std::string> hoisted_narrows = {};
+    int hoisted_narrow_ordinal = 0;
+
     std::vector<bool>                             in_non_rvalue_context   = { false };
     std::vector<bool>                             in_single_unqualified_id_return  = { false };
     std::vector<bool>                             need_expression_list_parens = { true };
@@ -1168,6 +2549,7 @@ public:
     //
     cppfront(std::string const& filename)
         : sourcefile{ filename }
+        , errors    { the_diagnostics_pool.acquire() }
         , source    { errors }
         , tokens    { errors }
         , parser    { errors, includes }
@@ -1203,14 +2585,91 @@ public:
 
         else
         {
-            //  Tokenize
-            //
+            lex_parse_sema();
+        }
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  Constructor from an in-memory source text - see cpp2::compile
+    //
+    //  filename       pseudo-filename used in diagnostics and #line directives
+    //  source_text    the source program, in place of a file's contents
+    //
+    cppfront(
+        std::string const& filename,
+        std::string        source_text
+    )
+        : sourcefile{ filename }
+        , errors    { the_diagnostics_pool.acquire() }
+        , source    { errors }
+        , tokens    { errors }
+        , parser    { errors, includes }
+        , sema      { errors }
+    {
+        if (
+            !sourcefile.ends_with(".cpp2")
+            && !sourcefile.ends_with(".h2")
+            )
+        {
+            errors.emplace_back(
+                source_position(-1, -1),
+                "source filename must end with .cpp2 or .h2: " + sourcefile
+            );
+        }
+        else if (!source.load_text(std::move(source_text)))
+        {
+            source_loaded = false;
+        }
+        else
+        {
+            lex_parse_sema();
+        }
+    }
+
+    //  Return the diagnostics storage to this thread's pool, so the next
+    //  compile on this thread (the next -daemon/-watch request) reuses
+    //  the warmed capacity instead of growing a fresh vector from zero
+    //
+    ~cppfront()
+    {
+        the_diagnostics_pool.release( std::move(errors) );
+    }
+
+private:
+    //-----------------------------------------------------------------------
+    //  The shared lex + parse + sema pipeline run by both constructors
+    //  once the source lines are loaded
+    //
+    auto lex_parse_sema()
+        -> void
+    {
+        //  This flag is set from deep inside parse/lower, so it lives at
+        //  namespace scope - restart it for this compile (see parse.h)
+        violates_lifetime_safety = false;
+
+        //  Tokenize
+        //
+        auto num_tokens = 0LL;
+        {
+            auto prof = profiler.scope("lex");
+            auto t    = phase_timer( phase_us.lex );
             tokens.lex(source.get_lines());
 
-            //  Parse
-            //
-            try
+            for (auto const& [line, entry] : tokens.get_map()) {
+                num_tokens += std::ssize(entry);
+            }
+            profiler.count("tokens", num_tokens);
+        }
+        stream_new_errors();
+
+        //  Parse
+        //
+        try
+        {
             {
+                auto prof = profiler.scope("parse");
+                auto t    = phase_timer( phase_us.parse );
                 for (auto const& [line, entry] : tokens.get_map()) {
                     if (!parser.parse(entry, tokens.get_generated())) {
                         errors.emplace_back(
@@ -1220,24 +2679,142 @@ public:
                             true    // a noisy fallback error message
                         );
                     }
+                    stream_new_errors();
+                    if (reached_max_errors()) {
+                        break;
+                    }
                 }
+                profiler.count("nodes", node_arena.total_allocated());
+            }
 
-                //  Sema
+            //  Sema - skipped in -parse-only mode, where syntax
+            //  diagnostics are all the caller wants, once the
+            //  -max-errors cap has been reached, and once the
+            //  -diagnostic-budget is spent (it could only add
+            //  diagnostics past the budget)
+            if (
+                !flag_parse_only
+                && !reached_max_errors()
+                && !diagnostic_budget_spent(errors)
+                )
+            {
+                auto prof = profiler.scope("sema");
+                auto t    = phase_timer( phase_us.sema );
+                sema.reserve_symbols( unchecked_narrow<size_t>(num_tokens) );
                 parser.visit(sema);
-                if (!sema.apply_local_rules()) {
+                //  The local rules analyze function bodies, which
+                //  -interface-only deliberately left empty
+                if (
+                    !flag_interface_only
+                    && !sema.apply_local_rules()
+                    )
+                {
                     violates_initialization_safety = true;
                 }
+                if (flag_demote_nonescaping_new) {
+                    sema.demote_nonescaping_new_locals();
+                }
+                profiler.count("symbols", std::ssize(sema.symbols));
             }
-            catch (std::runtime_error& e) {
-                errors.emplace_back(
-                    source_position(-1, -1),
-                    e.what()
-                );
+            stream_new_errors();
+        }
+        catch (std::runtime_error& e) {
+            errors.emplace_back(
+                source_position(-1, -1),
+                e.what()
+            );
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    //  h2_include_is_unused: for -drop-unused-includes, whether this file
+    //  provably never mentions any name the included .h2 declares at its
+    //  top level
+    //
+    //  Only .h2 includes are candidates: they are Cpp2 source we can read,
+    //  and their generated headers define no macros, so the .h2's
+    //  top-level names are the complete list of names the include can
+    //  contribute directly. The check is deliberately conservative - a
+    //  mention of any declared name anywhere in this file (Cpp2 or
+    //  passthrough Cpp1) keeps the include, and so does a .h2 we cannot
+    //  read or one where we find no top-level names
+    //
+    auto h2_include_is_unused(std::string_view include_line)
+        -> bool
+    {
+        //  Extract the quoted filename
+        auto open = include_line.find('"');
+        if (
+            open == include_line.npos
+            || !include_line.ends_with('"')
+            )
+        {
+            return false;
+        }
+        auto name = std::string{ include_line.substr(open+1, include_line.size() - open - 2) };
+
+        auto scratch  = std::vector<error_entry>{};
+        auto included = cpp2::source{ scratch };
+        if (!included.load(name)) {
+            return false;
+        }
+
+        //  Collect the .h2's top-level declared names: a Cpp2 line that
+        //  opens with an unindented identifier followed by ':' (and not
+        //  '::') declares that name at file scope
+        auto declared = std::set<std::string, std::less<>>{};
+        for (auto const& line : included.get_lines()) {
+            if (
+                line.cat != source_line::category::cpp2
+                || line.text.empty()
+                || !is_identifier_start(line.text[0])
+                )
+            {
+                continue;
+            }
+            auto i = size_t{1};
+            while (
+                i < line.text.size()
+                && is_identifier_continue(line.text[i])
+                )
+            {
+                ++i;
+            }
+            auto j = i;
+            while (
+                j < line.text.size()
+                && (line.text[j] == ' ' || line.text[j] == '\t')
+                )
+            {
+                ++j;
+            }
+            if (
+                j < line.text.size()
+                && line.text[j] == ':'
+                && (j+1 == line.text.size() || line.text[j+1] != ':')
+                )
+            {
+                declared.insert( std::string{line.text.substr(0, i)} );
+            }
+        }
+        if (declared.empty()) {
+            return false;
+        }
+
+        //  Keep the include on any mention - a plain substring scan, like
+        //  the optional-runtime-section scan in lower_to_cpp1, where a
+        //  false positive just keeps the include as before
+        for (auto const& line : source.get_lines()) {
+            for (auto const& d : declared) {
+                if (line.text.find(d) != line.text.npos) {
+                    return false;
+                }
             }
         }
+        return true;
     }
 
-
+public:
     //-----------------------------------------------------------------------
     //  lower_to_cpp1
     //
@@ -1247,11 +2824,109 @@ public:
         lineno_t cpp1_lines = 0;
         lineno_t cpp2_lines = 0;
     };
-    auto lower_to_cpp1()
+
+    //-----------------------------------------------------------------------
+    //  Build and queue the -hot-reload-chunks manifest: one line per
+    //  named function with the byte ranges of its generated declaration
+    //  and definition in cpp1_filename, plus an FNV-1a hash of each
+    //  range. #line directives are skipped while hashing, so editing one
+    //  function doesn't disturb the hashes of the functions emitted
+    //  after it. A reload pipeline diffs the hashes against the previous
+    //  build's manifest, then extracts and recompiles only the
+    //  definition ranges that changed - each definition range is
+    //  independently compilable against the declarations that precede
+    //  it in the file
+    //
+    auto emit_chunk_manifest(std::string const& cpp1_filename)
+        -> void
+    {
+        auto contents = printer.peek_batched_contents();
+
+        //  Hash a byte range line by line, skipping #line directives so
+        //  the hash is position-independent
+        auto hash_range = [&](ptrdiff_t begin_, ptrdiff_t end_) {
+            auto begin = static_cast<std::size_t>(begin_);
+            auto end   = static_cast<std::size_t>(end_);
+            auto h     = fnv1a_32({});
+            while (begin < end) {
+                auto eol  = contents.find('\n', begin);
+                auto stop = eol == contents.npos ? end : std::min(end, eol + 1);
+                auto line = contents.substr(begin, stop - begin);
+                if (!line.starts_with("#line")) {
+                    h = fnv1a_32(line, h);
+                }
+                begin = stop;
+            }
+            return h;
+        };
+
+        auto to_hex = [](uint32_t h) {
+            char buf[9];
+            std::snprintf(buf, sizeof(buf), "%08x", h);
+            return std::string{buf};
+        };
+
+        auto manifest = std::string{};
+        manifest += "# cppfront -hot-reload-chunks manifest for " + cpp1_filename + "\n";
+        manifest += "# function  decl-begin decl-end decl-hash  defn-begin defn-end defn-hash\n";
+
+        for (auto& chunk : function_chunks)
+        {
+            //  Skip anything whose definition never finished emitting
+            if (
+                chunk.defn_begin < 0
+                || chunk.defn_end < chunk.defn_begin
+                )
+            {
+                continue;
+            }
+
+            manifest += chunk_name_of(*chunk.decl);
+
+            //  A declaration range can be missing (e.g., a member
+            //  function declared while its type's body was being
+            //  captured) - tooling treats '-' as "assume the
+            //  interface changed"
+            if (
+                chunk.decl_begin >= 0
+                && chunk.decl_end >= chunk.decl_begin
+                )
+            {
+                manifest += "  " + std::to_string(chunk.decl_begin)
+                          + " "  + std::to_string(chunk.decl_end)
+                          + " "  + to_hex(hash_range(chunk.decl_begin, chunk.decl_end));
+            }
+            else {
+                manifest += "  - - -";
+            }
+
+            manifest += "  " + std::to_string(chunk.defn_begin)
+                      + " "  + std::to_string(chunk.defn_end)
+                      + " "  + to_hex(hash_range(chunk.defn_begin, chunk.defn_end))
+                      + "\n";
+        }
+
+        the_output_batcher.add( cpp1_filename + ".chunks", std::move(manifest) );
+    }
+
+    auto lower_to_cpp1( std::string* cpp1_output = nullptr )
         -> lower_to_cpp1_ret
     {
+        auto prof = profiler.scope("emit");
+        auto pt   = phase_timer( phase_us.emit );
+
         auto ret = lower_to_cpp1_ret{};
 
+        //  In the diagnostics-only modes we don't lower or touch the
+        //  output file at all
+        if (
+            flag_parse_only
+            || flag_check_only
+            )
+        {
+            return ret;
+        }
+
         //  Only lower to Cpp1 if we haven't already encountered errors
         if (!errors.empty()) {
             return {};
@@ -1273,13 +2948,25 @@ public:
             cpp1_filename = std::filesystem::path(cpp1_filename).filename().string();
         }
 
-        printer.open(
-            sourcefile,
-            cpp1_filename,
-            tokens.get_comments(),
-            source,
-            parser
-        );
+        if (cpp1_output) {
+            printer.open_string_capture(
+                sourcefile,
+                cpp1_filename,
+                *cpp1_output,
+                tokens.get_comments(),
+                source,
+                parser
+            );
+        }
+        else {
+            printer.open(
+                sourcefile,
+                cpp1_filename,
+                tokens.get_comments(),
+                source,
+                parser
+            );
+        }
         if (!printer.is_open()) {
             errors.emplace_back(
                 source_position{},
@@ -1318,29 +3005,96 @@ public:
                 printer.print_extra( "#define " + cpp1_FILENAME+"_CPP2" + "\n\n" );
             }
 
-            if (flag_include_std) {
-                printer.print_extra( "#define CPP2_INCLUDE_STD         Yes\n" );
-            }
-            else if (flag_import_std) {
-                printer.print_extra( "#define CPP2_IMPORT_STD          Yes\n" );
+            //  With a shared prolog, these common defines and the runtime
+            //  include live in the one header the driver wrote for this
+            //  invocation - see main(). It must come before the runtime
+            //  support includes below, which rely on the defines
+            if (
+                !flag_shared_prolog.empty()
+                && !flag_emit_module
+                )
+            {
+                printer.print_extra( "#include \"" + flag_shared_prolog + "\"\n" );
             }
+            else
+            {
+                if (flag_include_std) {
+                    printer.print_extra( "#define CPP2_INCLUDE_STD         Yes\n" );
+                }
+                else if (flag_import_std) {
+                    printer.print_extra( "#define CPP2_IMPORT_STD          Yes\n" );
+                }
 
-            if (flag_no_exceptions) {
-                printer.print_extra( "#define CPP2_NO_EXCEPTIONS       Yes\n" );
-            }
+                if (flag_no_exceptions) {
+                    printer.print_extra( "#define CPP2_NO_EXCEPTIONS       Yes\n" );
+                }
 
-            if (flag_no_rtti) {
-                printer.print_extra( "#define CPP2_NO_RTTI             Yes\n" );
+                if (flag_no_rtti) {
+                    printer.print_extra( "#define CPP2_NO_RTTI             Yes\n" );
+                }
             }
 
             for (auto& h: includes) {
+                //  In module mode the runtime support headers are part of
+                //  the 'cpp2' module, so don't also include them textually
+                if (
+                    flag_emit_module
+                    && h == "cpp2regex.h"
+                    )
+                {
+                    continue;
+                }
                 printer.print_extra( "#include \"" + h + "\"\n" );
             }
+
+            //  The prelude's generated header carries the declarations
+            //  that the driver's one-time prelude compile let this file
+            //  use without redeclaring them - see main(). (The flag is
+            //  cleared while the prelude itself is being compiled, so
+            //  the prelude's own output doesn't include itself)
+            if (!flag_include_prelude.empty()) {
+                printer.print_extra(
+                    "#include \""
+                    + flag_include_prelude.substr(0, flag_include_prelude.size()-1)
+                    + "\"\n"
+                );
+            }
         }
 
         auto map_iter = tokens.get_map().cbegin();
         auto hpp_includes = std::string{};
 
+        //  Materialize each Cpp2 section's top-level declarations once, and
+        //  drive all three lowering phases from the same records - finding
+        //  them per phase rescanned the whole parse tree for every section
+        auto section_decls = std::unordered_map<
+            lineno_t,
+            std::vector<declaration_node const*>
+        >{};
+        for (auto& section : tokens.get_map()) {
+            assert (!section.second.empty());
+            section_decls.emplace(
+                section.first,
+                parser.get_parse_tree_declarations_in_range(section.second)
+            );
+        }
+
+        //  -reorder-definitions: plan the phase 2 emission order, and
+        //  which phase 1 forward declarations it makes redundant, up
+        //  front from the same records
+        if (
+            flag_reorder_definitions
+            && source.has_cpp2()
+            )
+        {
+            auto all_decls = std::vector<declaration_node const*>{};
+            for (auto& section : tokens.get_map()) {
+                auto& decls = section_decls[section.first];
+                all_decls.insert( all_decls.end(), decls.begin(), decls.end() );
+            }
+            plan_definition_order( all_decls );
+        }
+
 
         //---------------------------------------------------------------------
         //  Do phase0_type_decls
@@ -1360,7 +3114,53 @@ public:
             || flag_include_std
             )
         {
-            printer.print_extra( "\n#include \"cpp2util.h\"\n\n" );
+            //  In module mode the runtime declarations come from the
+            //  prebuilt 'cpp2' module; only the macro layer (which also
+            //  carries the std dependencies) stays textual
+            if (flag_emit_module) {
+                printer.print_extra( "\n#include \"cpp2macros.h\"\nimport cpp2;\n\n" );
+            }
+            else if (!flag_shared_prolog.empty()) {
+                //  The runtime was already included via the shared prolog
+                printer.print_extra( "\n" );
+            }
+            else {
+                //  Optional runtime sections this file provably doesn't use
+                //  can be skipped for a faster downstream compile. A text
+                //  scan is enough to prove non-use: cpp2::args can only be
+                //  named via 'args' or reach the code via the main() wrapper,
+                //  and string_dispatch_table is only emitted for 'inspect'.
+                //  A false positive just includes the section as before
+                auto source_mentions = [&](std::string_view a, std::string_view b) {
+                    for (auto& line : source.get_lines()) {
+                        if (
+                            line.text.find(a) != std::string::npos
+                            || line.text.find(b) != std::string::npos
+                            )
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                };
+
+                //  #undef right after the include, so that a file that
+                //  includes this one and does use a facility still gets it
+                //  (the optional sections sit outside cpp2util.h's main
+                //  include guard for exactly that reason)
+                auto defines = std::string{};
+                auto undefs  = std::string{};
+                if (!source_mentions("args", "main")) {
+                    defines += "#define CPP2_NO_ARGS             Yes\n";
+                    undefs  += "#undef  CPP2_NO_ARGS\n";
+                }
+                if (!source_mentions("inspect", "string_dispatch_table")) {
+                    defines += "#define CPP2_NO_STRING_DISPATCH  Yes\n";
+                    undefs  += "#undef  CPP2_NO_STRING_DISPATCH\n";
+                }
+
+                printer.print_extra( "\n" + defines + "#include \"cpp2util.h\"\n" + undefs + "\n" );
+            }
         }
 
         if (
@@ -1375,9 +3175,8 @@ public:
         {
             assert (!section.second.empty());
 
-            //  Get the parse tree for this section and emit each forward declaration
-            auto decls = parser.get_parse_tree_declarations_in_range(section.second);
-            for (auto& decl : decls) {
+            //  Emit each of this section's forward declarations
+            for (auto decl : section_decls[section.first]) {
                 assert(decl);
                 emit(*decl);
             }
@@ -1400,6 +3199,19 @@ public:
         }
 
         assert (printer.get_phase() == positional_printer::phase1_type_defs_func_decls);
+
+        //  Accumulate runs of consecutive plain Cpp1 lines here, and emit
+        //  each run with a single block copy - mixed files are often
+        //  mostly Cpp1, so this keeps passthrough off the positioning path
+        auto cpp1_run       = std::vector<std::string_view>{};
+        auto cpp1_run_start = lineno_t{0};
+        auto flush_cpp1_run = [&]{
+            if (!cpp1_run.empty()) {
+                printer.print_cpp1_block( cpp1_run, cpp1_run_start );
+                cpp1_run.clear();
+            }
+        };
+
         for (
             lineno_t curr_lineno = 0;
             auto const& line : source.get_lines()
@@ -1453,18 +3265,41 @@ public:
                         && line.text.ends_with(".h2\"")
                         )
                     {
-                        //  Strip off the 2"
-                        auto h_include = line.text.substr(0, line.text.size()-2);
-                        printer.print_cpp1( h_include + "\"", curr_lineno );
-                        hpp_includes += h_include + "pp\"\n";
+                        flush_cpp1_run();
+
+                        //  With -drop-unused-includes, elide the include if
+                        //  this file provably mentions nothing it declares,
+                        //  leaving a comment where it was so the elision is
+                        //  auditable in the generated file
+                        if (
+                            flag_drop_unused_includes
+                            && h2_include_is_unused(line.text)
+                            )
+                        {
+                            printer.print_cpp1(
+                                "//  dropped by -drop-unused-includes: " + std::string{line.text},
+                                curr_lineno
+                            );
+                        }
+                        else {
+                            //  Strip off the 2"
+                            auto h_include = std::string{line.text.substr(0, line.text.size()-2)};
+                            printer.print_cpp1( h_include + "\"", curr_lineno );
+                            hpp_includes += h_include + "pp\"\n";
+                        }
                     }
                     else {
-                        printer.print_cpp1( line.text, curr_lineno );
+                        if (cpp1_run.empty()) {
+                            cpp1_run_start = curr_lineno;
+                        }
+                        cpp1_run.push_back( line.text );
                     }
                 }
 
                 //  If it's a Cpp2 line...
                 else {
+                    flush_cpp1_run();
+
                     ++ret.cpp2_lines;
 
                     //  We should be in a position to emit a set of Cpp2 declarations
@@ -1477,10 +3312,16 @@ public:
                         assert (map_iter->first == curr_lineno);
                         assert (!map_iter->second.empty());
 
-                        //  Get the parse tree for this section and emit each forward declaration
-                        auto decls = parser.get_parse_tree_declarations_in_range(map_iter->second);
-                        for (auto& decl : decls) {
+                        //  Emit each of this section's declarations
+                        for (auto decl : section_decls[map_iter->first]) {
                             assert(decl);
+                            if (
+                                flag_reorder_definitions
+                                && elided_fwd_decls.contains(decl)
+                                )
+                            {
+                                continue;
+                            }
                             emit(*decl);
                         }
                         ++map_iter;
@@ -1489,6 +3330,7 @@ public:
             }
             ++curr_lineno;
         }
+        flush_cpp1_run();
 
         //  We can stop here if there's no Cpp2 code -- a file with no Cpp2
         //  should have perfect passthrough verifiable with diff, including
@@ -1502,6 +3344,21 @@ public:
 
         //  If there is Cpp2 code, we have more to do...
 
+        //  -interface-only: the phase 0/1 text is the whole interface
+        //  surface, so we're done - don't switch to a second file for
+        //  a .h2, and don't emit phase 2 (there are no bodies in the
+        //  parse tree to define anyway)
+        if (flag_interface_only) {
+            if (cpp1_filename.back() == 'h') {
+                printer.print_extra( "\n#endif" );
+            }
+            printer.finalize_phase( true );
+            if (cpp1_output) {
+                printer.flush_buffer();
+            }
+            return ret;
+        }
+
         //  First, if this is a .h2 and in a -pure-cpp2 compilation,
         //  we need to switch filenames
         if (
@@ -1512,6 +3369,13 @@ public:
             printer.print_extra( "\n#endif\n" );
 
             printer.reopen();
+
+            //  The first file's contents were just handed off, so any
+            //  chunk offsets recorded so far no longer point into the
+            //  live buffer - the manifest covers the second file only
+            function_chunks.clear();
+            function_chunk_index.clear();
+
             if (!printer.is_open()) {
                 errors.emplace_back(
                     source_position{},
@@ -1547,13 +3411,27 @@ public:
             printer.reset_line_to(1, true);
         }
 
-        for (auto& section : tokens.get_map())
+        //  In -reorder-definitions mode, emit the planned
+        //  callees-before-callers order instead of source order - each
+        //  definition re-syncs its own #line directive, so the debug
+        //  mapping is order-independent
+        if (
+            flag_reorder_definitions
+            && !definition_emit_order.empty()
+            )
+        {
+            for (auto decl : definition_emit_order) {
+                assert(decl);
+                emit(*decl);
+            }
+        }
+
+        else for (auto& section : tokens.get_map())
         {
             assert (!section.second.empty());
 
-            //  Get the parse tree for this section and emit each forward declaration
-            auto decls = parser.get_parse_tree_declarations_in_range(section.second);
-            for (auto& decl : decls) {
+            //  Emit each of this section's function definitions
+            for (auto decl : section_decls[section.first]) {
                 assert(decl);
                 emit(*decl);
             }
@@ -1566,11 +3444,28 @@ public:
         printer.finalize_phase( true );
 
         //  Finally, some debug checks
+        //  (in -no-align mode comments are intentionally not replayed)
         assert(
-            (!errors.empty() || tokens.num_unprinted_comments() == 0)
+            (!errors.empty() || flag_no_align || tokens.num_unprinted_comments() == 0)
             && "ICE: not all comments were printed"
         );
 
+        if (cpp1_output) {
+            printer.flush_buffer();
+        }
+
+        //  -hot-reload-chunks: queue the chunk manifest next to the
+        //  output - but not if this compile had errors, since the
+        //  driver is about to abandon the output file itself
+        if (
+            flag_hot_reload_chunks
+            && printer.is_batching()
+            && errors.empty()
+            )
+        {
+            emit_chunk_manifest(cpp1_filename);
+        }
+
         return ret;
     }
 
@@ -1634,6 +3529,23 @@ public:
         }
     }
 
+    //  Companion for call sites that already dispatched on the variant's
+    //  index with a switch, so the wide alternative sets (statements,
+    //  primary expressions) resolve with one jump instead of testing
+    //  every alternative in turn
+    //
+    template <int I>
+    auto emit_alt(
+        auto&     v,
+        auto&&... more
+    )
+        -> void
+    {
+        auto const& alt = std::get<I>(v);
+        assert (alt);
+        emit (*alt, CPP2_FORWARD(more)...);
+    }
+
 
     //-----------------------------------------------------------------------
     //
@@ -1706,11 +3618,21 @@ public:
         {
             printer.print_cpp2("CPP2_TYPEOF", pos);
         }
+        //  -demote-nonescaping-new: print the cheaper arena sema chose
+        //  for this 'unique'/'shared' new-expression (see sema.h)
+        else if (
+            flag_demote_nonescaping_new
+            && (n == "unique" || n == "shared")
+            && sema.get_demoted_new_arena(&n)
+            )
+        {
+            printer.print_cpp2(sema.get_demoted_new_arena(&n), pos);
+        }
         else {
             printer.print_cpp2(n, pos, true);
         }
 
-        in_definite_init = is_definite_initialization(&n);
+        in_definite_init = sema.is_definite_initialization(&n);
     }
 
 
@@ -1728,7 +3650,20 @@ public:
 
         for (auto p : n.pieces) {
             assert(p);
-            emit(*p);
+            //  A literal-kind token can't be any of the names emit(token)
+            //  rewrites (keywords, alternative operator names, implicitly
+            //  qualified utilities) and is never a definite first use, so
+            //  print it directly - literals are a large share of all
+            //  tokens in table-initializer-heavy files, and the name
+            //  checks added up. User-defined suffixes are identifiers,
+            //  so they keep the general path
+            if (is_literal(p->type())) {
+                printer.print_cpp2(*p, p->position(), true);
+                in_definite_init = false;
+            }
+            else {
+                emit(*p);
+            }
         }
     }
 
@@ -1745,7 +3680,7 @@ public:
         -> void
     {   STACKINSTR
         assert( n.identifier );
-        auto last_use = is_definite_last_use(n.identifier);
+        auto last_use = sema.is_definite_last_use(n.identifier);
 
         auto decl = sema.get_declaration_of(*n.identifier, false, true);
 
@@ -1756,14 +3691,25 @@ public:
             && !in_non_rvalue_context.back()
             && !is_class_member_access;
 
+        //  A named return object on the NRVO lowering (see function_info)
+        //  is an ordinary local: no deferred_init wrapper to .value()
+        //  through, and returned by name so the Cpp1 compiler can elide
+        const bool is_nrvo_object =
+            decl
+            && current_functions.is_nrvo_decl( decl->declaration )
+            ;
+
         //  We always want to std::move from named return values,
         //  regardless of their types, so use std::move for that
         const bool add_std_move =
-            synthesized_multi_return_size > 1
-            || (
-                synthesized_multi_return_size == 1
-                && decl
-                && !decl->initializer
+            !is_nrvo_object
+            && (
+                synthesized_multi_return_size > 1
+                || (
+                    synthesized_multi_return_size == 1
+                    && decl
+                    && !decl->initializer
+                    )
                 );
 
         //  Otherwise we'll use cpp2::move
@@ -1833,6 +3779,21 @@ public:
         }
 
         assert(n.identifier);
+
+        //  The NRVO return object's single construction statement is
+        //  where the object gets declared - emit its type first, and
+        //  note the state so the assignment becomes an initializer
+        in_nrvo_init =
+            !current_functions.empty()
+            && n.identifier == current_functions.back().nrvo_init
+            ;
+        if (in_nrvo_init) {
+            printer.print_cpp2(
+                current_functions.back().nrvo_type + " ",
+                n.position()
+            );
+        }
+
         emit(*n.identifier, is_qualified);  // inform the identifier if we know this is qualified
 
         if (n.open_angle != source_position{}) {
@@ -1849,7 +3810,7 @@ public:
             printer.print_cpp2(">", n.close_angle);
         }
 
-        in_definite_init = is_definite_initialization(n.identifier);
+        in_definite_init = sema.is_definite_initialization(n.identifier);
         if (
             !in_definite_init
             && !in_parameter_list
@@ -1857,6 +3818,7 @@ public:
         {
             if (
                 is_local_name
+                && !is_nrvo_object
                 && !(*n.identifier == "this")
                 && !(*n.identifier == "that")
                 && decl
@@ -1880,7 +3842,11 @@ public:
                 printer.print_cpp2(".value()", n.position());
             }
         }
-        else if (synthesized_multi_return_size != 0) {
+        else if (
+            synthesized_multi_return_size != 0
+            && !is_nrvo_object
+            )
+        {
             printer.print_cpp2(".value()", n.position());
         }
 
@@ -1959,10 +3925,13 @@ public:
             printer.print_cpp2("auto", pos);
         }
         else {
-            try_emit<type_id_node::postfix    >(n.id);
-            try_emit<type_id_node::unqualified>(n.id, 0, false);
-            try_emit<type_id_node::qualified  >(n.id);
-            try_emit<type_id_node::keyword    >(n.id);
+            switch (n.id.index()) {
+            break;case type_id_node::postfix    : emit_alt<type_id_node::postfix    >(n.id);
+            break;case type_id_node::unqualified: emit_alt<type_id_node::unqualified>(n.id, 0, false);
+            break;case type_id_node::qualified  : emit_alt<type_id_node::qualified  >(n.id);
+            break;case type_id_node::keyword    : emit_alt<type_id_node::keyword    >(n.id);
+            break;default: ;
+            }
         }
 
         for (auto i = n.pc_qualifiers.rbegin(); i != n.pc_qualifiers.rend(); ++i) {
@@ -2088,6 +4057,56 @@ public:
         assert(!n.alternatives.empty());
         auto found_wildcard = false;
 
+        //  If all the non-wildcard alternatives are plain string literals,
+        //  dispatch through a table sorted at compile time instead of
+        //  comparing sequentially - a large string dispatcher then costs one
+        //  binary search plus an integer compare per alternative. Small
+        //  inspects keep the straightforward sequential form
+        auto string_alternatives = std::vector<token const*>{};
+        if (!n.is_constexpr)
+        {
+            for (auto&& alt : n.alternatives)
+            {
+                if (
+                    alt->type_id
+                    && alt->type_id->is_wildcard()
+                    )
+                {
+                    continue;
+                }
+                auto lit = alt->value ? alt->value->get_literal() : nullptr;
+                if (
+                    lit
+                    && std::ssize(lit->pieces) == 1
+                    && lit->pieces.front()->type() == lexeme::StringLiteral
+                    && lit->pieces.front()->as_string_view().starts_with("\"")
+                    )
+                {
+                    string_alternatives.push_back(lit->pieces.front());
+                    continue;
+                }
+                string_alternatives.clear();
+                break;
+            }
+        }
+        if (std::ssize(string_alternatives) > 3)
+        {
+            auto table = std::string{"static constexpr auto _alts = cpp2::impl::string_dispatch_table<"}
+                + std::to_string(string_alternatives.size()) + ">({";
+            for (auto first = true; auto l : string_alternatives) {
+                if (!std::exchange(first, false)) {
+                    table += ", ";
+                }
+                table += l->to_string();
+            }
+            table += "}); auto _match = _alts.find(_expr); ";
+            printer.print_cpp2(table, n.position());
+        }
+        else {
+            string_alternatives.clear();
+        }
+        auto match_ordinal = 0;
+
         for (auto first = true; auto&& alt : n.alternatives)
         {
             assert(alt && alt->is_as_keyword);
@@ -2148,7 +4167,17 @@ public:
                 if (id == "auto") {
                     found_wildcard = true;
                     if (is_expression) {
-                        printer.print_cpp2("return ", alt->position());
+                        if (n.is_constexpr) {
+                            printer.print_cpp2("return ", alt->position());
+                        }
+                        else {
+                            //  Outline the fallback arm through a cold
+                            //  non-inlined lambda, so the matched arms stay
+                            //  compact in the instruction cache and the
+                            //  no-match machinery lands in a cold section
+                            printer.print_cpp2("return [&] () CPP2_COLD_LAMBDA -> " + result_type + " { return ", alt->position());
+                            return_suffix = "; } (); }";
+                        }
                     }
                 }
                 else {
@@ -2156,6 +4185,10 @@ public:
                     if (alt->type_id) {
                         printer.print_cpp2("(cpp2::impl::is<" + id + ">(_expr)) ", alt->position());
                     }
+                    else if (!string_alternatives.empty()) {
+                        assert (alt->value);
+                        printer.print_cpp2("(_match == " + std::to_string(match_ordinal++) + ") ", alt->position());
+                    }
                     else {
                         assert (alt->value);
                         printer.print_cpp2("(cpp2::impl::is(_expr, " + id + ")) ", alt->position());
@@ -2230,15 +4263,152 @@ public:
         assert(n.true_branch);
         emit(*n.true_branch);
 
-        if (n.has_source_false_branch) {
-            printer.print_cpp2("else ", n.else_pos);
-            emit(*n.false_branch);
+        if (n.has_source_false_branch) {
+            printer.print_cpp2("else ", n.else_pos);
+            emit(*n.false_branch);
+        }
+    }
+
+
+    //-----------------------------------------------------------------------
+    //
+    //-----------------------------------------------------------------------
+    //  -hoist-loop-narrowing: find the 'x as T' conversions in this
+    //  loop that are safe to run once before it, emit one generated
+    //  local per distinct (name, type) holding the converted value, and
+    //  map each hoisted node to its local so emit(is_as_expression_node)
+    //  prints the local instead of re-running the conversion. Returns
+    //  the hoisted nodes so the loop emitter can close the scope and
+    //  unmap them afterwards.
+    //
+    //  The rule is conservative: the operand must be a single
+    //  unqualified name that names a function-local declared outside
+    //  the loop, and every appearance of that name anywhere in the loop
+    //  must be one of these conversions - an assignment, call argument,
+    //  or any other mention disqualifies it. (Mutation through a
+    //  pointer or reference bound before the loop is not detected;
+    //  the flag is opt-in for that reason.)
+    //
+    //  The loop-subtree walk behind hoist_loop_narrows, below
+    struct narrow_visitor
+    {
+        struct candidate {
+            is_as_expression_node const* node;
+            token const*                 id;
+            type_id_node const*          type;
+        };
+        std::vector<candidate>                          candidates      = {};
+        std::unordered_map<std::string_view, long long> name_uses       = {};
+        std::unordered_set<std::string_view>            declared_inside = {};
+
+        auto start(is_as_expression_node const& n, int) -> void
+        {
+            if (
+                std::ssize(n.ops) != 1
+                || !n.ops[0].op
+                || *n.ops[0].op != "as"
+                || !n.ops[0].type
+                || n.ops[0].type->is_wildcard()
+                || !n.expr->ops.empty()
+                || !n.expr->expr->ops.empty()
+                )
+            {
+                return;
+            }
+            auto t = n.expr->expr->expr->get_token();
+            if (
+                t
+                && t->type() == lexeme::Identifier
+                )
+            {
+                candidates.push_back({ &n, t, n.ops[0].type.get() });
+            }
+        }
+        auto start(declaration_node const& n, int) -> void
+        {
+            if (n.has_name()) {
+                declared_inside.insert( n.name()->as_string_view() );
+            }
+        }
+        auto start(parameter_declaration_node const& n, int) -> void
+        {
+            if (n.has_name()) {
+                declared_inside.insert( n.name()->as_string_view() );
+            }
+        }
+        auto start(token const& t, int) -> void
+        {
+            if (t.type() == lexeme::Identifier) {
+                ++name_uses[ t.as_string_view() ];
+            }
+        }
+        auto start(auto const&, int) -> void { }
+        auto end  (auto const&, int) -> void { }
+    };
+
+    auto hoist_loop_narrows(iteration_statement_node const& n)
+        -> std::vector<is_as_expression_node const*>
+    {
+        auto v = narrow_visitor{};
+        //  visit() is a non-const walk for historical reasons; this
+        //  visitor only reads (see find() in extrinsic_storage)
+        const_cast<iteration_statement_node&>(n).visit( v, 0 );
+
+        //  Count each name's qualifying conversions, so "every use is
+        //  one of these conversions" is a comparison against the name's
+        //  total token count in the loop
+        auto narrows_of = std::unordered_map<std::string_view, long long>{};
+        for (auto const& c : v.candidates) {
+            if (!hoisted_narrows.contains(c.node)) {    // an enclosing loop already hoisted it
+                ++narrows_of[ c.id->as_string_view() ];
+            }
+        }
+
+        auto hoisted  = std::vector<is_as_expression_node const*>{};
+        auto names_of = std::map<std::pair<std::string_view, std::string>, std::string>{};
+        auto preamble = std::string{};
+        for (auto const& c : v.candidates)
+        {
+            auto name = c.id->as_string_view();
+            if (
+                hoisted_narrows.contains(c.node)
+                || v.declared_inside.contains(name)
+                || v.name_uses[name] != narrows_of[name]
+                )
+            {
+                continue;
+            }
+
+            //  Only function-local names - a type-scope name can be
+            //  mutated by any member call in the loop body
+            auto decl = sema.get_declaration_of(*c.id, true);
+            if (
+                !decl
+                || !decl->declaration
+                || !decl->declaration->parent_is_function()
+                )
+            {
+                continue;
+            }
+
+            auto  type_text = print_to_string(*c.type);
+            auto& local     = names_of[{ name, type_text }];
+            if (local.empty()) {
+                local = "cpp2_hoisted_" + std::to_string(hoisted_narrow_ordinal++);
+                preamble += "auto const " + local
+                          + " = cpp2::impl::as_<" + type_text + ">(" + std::string{name} + "); ";
+            }
+            hoisted_narrows.emplace( c.node, local );
+            hoisted.push_back( c.node );
+        }
+
+        if (!hoisted.empty()) {
+            printer.print_cpp2( "{ " + preamble, n.position() );
         }
+        return hoisted;
     }
 
 
-    //-----------------------------------------------------------------------
-    //
     auto emit(iteration_statement_node const& n)
         -> void
     {   STACKINSTR
@@ -2250,6 +4420,13 @@ public:
             labelname = n.label->to_string();
         }
 
+        //  -hoist-loop-narrowing: run invariant narrowing conversions
+        //  once here, in a scope wrapping the loop
+        auto hoisted = std::vector<is_as_expression_node const*>{};
+        if (flag_hoist_loop_narrowing) {
+            hoisted = hoist_loop_narrows(n);
+        }
+
         //  Handle while
         //
         if (*n.identifier == "while") {
@@ -2391,6 +4568,14 @@ public:
             );
         }
 
+        //  Close the -hoist-loop-narrowing scope and retire its entries
+        if (!hoisted.empty()) {
+            printer.print_cpp2( " }", n.position() );
+            for (auto p : hoisted) {
+                hoisted_narrows.erase(p);
+            }
+        }
+
         iteration_statements.pop_back();
     }
 
@@ -2746,11 +4931,14 @@ public:
     auto emit(primary_expression_node const& n)
         -> void
     {   STACKINSTR
-        try_emit<primary_expression_node::identifier     >(n.expr);
-        try_emit<primary_expression_node::expression_list>(n.expr);
-        try_emit<primary_expression_node::id_expression  >(n.expr);
-        try_emit<primary_expression_node::inspect        >(n.expr, true);
-        try_emit<primary_expression_node::literal        >(n.expr);
+        switch (n.expr.index()) {
+        break;case primary_expression_node::identifier     : emit_alt<primary_expression_node::identifier     >(n.expr);
+        break;case primary_expression_node::expression_list: emit_alt<primary_expression_node::expression_list>(n.expr);
+        break;case primary_expression_node::id_expression  : emit_alt<primary_expression_node::id_expression  >(n.expr);
+        break;case primary_expression_node::inspect        : emit_alt<primary_expression_node::inspect        >(n.expr, true);
+        break;case primary_expression_node::literal        : emit_alt<primary_expression_node::literal        >(n.expr);
+        break;default: ;
+        }
 
         if (n.expr.index() == primary_expression_node::declaration)
         {
@@ -3067,6 +5255,97 @@ public:
         return false;
     }
 
+    enum class ufcs_resolution : u8 { unknown, member_call, free_call };
+
+    //  For a UFCS call 'obj.func(...)', try to prove from the symbol table
+    //  which form the call must resolve to, so the emitter can lower it to
+    //  a direct call instead of the CPP2_UFCS dispatch lambda
+    //
+    //  We can only prove it when we know obj's complete member list - i.e.,
+    //  obj's declaration has an explicit unqualified type that names a
+    //  non-template Cpp2 type in this file with no base types. Then if that
+    //  type has a member function named 'func' the member form is preferred,
+    //  and if it has no member named 'func' at all only the non-member form
+    //  can apply. Every other case (unknown/dependent/Cpp1 types, base
+    //  types that could contribute members, a non-function member with the
+    //  name) keeps the lambda, which dispatches via Cpp1 overload resolution
+    //
+    auto resolve_ufcs_call_form(
+        token const* obj,
+        token const* func
+    )
+        -> ufcs_resolution
+    {
+        if (
+            !obj
+            || !func
+            || obj->type()  != lexeme::Identifier
+            || func->type() != lexeme::Identifier
+            )
+        {
+            return ufcs_resolution::unknown;
+        }
+
+        //  Find the object's declaration, and require that it declares
+        //  an explicit, unqualified, non-pointer type
+        auto decl = sema.get_declaration_of(*obj, true);
+        if (
+            !decl
+            || !decl->declaration
+            || !decl->declaration->is_object()
+            )
+        {
+            return ufcs_resolution::unknown;
+        }
+
+        auto& obj_type = **get_if<declaration_node::an_object>(&decl->declaration->type);
+        auto  type_tok = obj_type.get_token();
+        if (
+            !type_tok
+            || type_tok->type() != lexeme::Identifier
+            || !obj_type.pc_qualifiers.empty()
+            || obj_type.address_of
+            || obj_type.dereference_of
+            )
+        {
+            return ufcs_resolution::unknown;
+        }
+
+        //  Require that the type names a non-template Cpp2 type in this file
+        auto type_decl = sema.get_declaration_of(*type_tok, true);
+        if (
+            !type_decl
+            || !type_decl->declaration
+            || !type_decl->declaration->is_type()
+            || type_decl->declaration->template_parameters
+            )
+        {
+            return ufcs_resolution::unknown;
+        }
+
+        //  Scan the complete member list - a base type ('this' member)
+        //  means we don't know the full member set, so give up
+        auto found_member_function = false;
+        for (auto& m : type_decl->declaration->get_type_scope_declarations())
+        {
+            if (m->has_name("this")) {
+                return ufcs_resolution::unknown;
+            }
+            if (m->has_name(*func)) {
+                if (!m->is_function()) {
+                    return ufcs_resolution::unknown;
+                }
+                found_member_function = true;
+            }
+        }
+
+        if (found_member_function) {
+            return ufcs_resolution::member_call;
+        }
+        // else
+        return ufcs_resolution::free_call;
+    }
+
     //-----------------------------------------------------------------------
     //
     auto emit(
@@ -3396,7 +5675,7 @@ public:
                 //  by leveraging the last use only in the non-member branch
                 //  For example, `x.f()` won't emit as 'CPP2_UFCS(cpp2::move(f))(x)'
                 //  to never take the branch that wants to call `x.cpp2::move(f)()`
-                if (auto last_use = is_definite_last_use(i->id_expr->get_token());
+                if (auto last_use = sema.is_definite_last_use(i->id_expr->get_token());
                     last_use
                     && last_use->safe_to_move
                     && !lookup_finds_type_scope_function(*i->id_expr)
@@ -3414,23 +5693,64 @@ public:
                     in_non_rvalue_context.pop_back();
                 }
 
+                //  If the call form can be proved from the symbol table,
+                //  lower to a direct call instead of the dispatch lambda
+                //
+                //  Only the plain 'obj.func(...)' shape is attempted: no
+                //  template arguments or move/forward rewriting (the base
+                //  macro name and an unadorned function name), and the
+                //  object expression must be just the remaining
+                //  primary-expression identifier
+                auto resolution = ufcs_resolution::unknown;
+                if (
+                    (
+                        ufcs_string == "CPP2_UFCS"
+                        || ufcs_string == "CPP2_UFCS_NONLOCAL"
+                        )
+                    && i->id_expr->get_token()
+                    && funcname == i->id_expr->get_token()->to_string()
+                    && i + 1 == n.ops.rend()
+                    && captured_part.empty()
+                    && !for_lambda_capture
+                    )
+                {
+                    resolution = resolve_ufcs_call_form(n.expr->get_token(), i->id_expr->get_token());
+                }
+
                 //  Second, emit the UFCS argument list
 
-                //  If the computed function name is an explicit member access
-                //  we don't need to go through the UFCS macro
-                //  Note: This also works around compiler bugs
-                if (funcname.starts_with("cpp2::move(*this).")) {
-                    prefix.emplace_back(funcname + "(", args.value().open_pos );
-                }
-                else {
-                    prefix.emplace_back(ufcs_string + "(" + funcname + ")(", args.value().open_pos );
-                }
-                suffix.emplace_back(")", args.value().close_pos );
-                if (!args.value().text_chunks.empty()) {
+                //  If the object's type is known to have this member
+                //  function, emit the member call UFCS would prefer
+                if (resolution == ufcs_resolution::member_call) {
+                    suffix.emplace_back(")", args.value().close_pos );
                     for (auto&& e: args.value().text_chunks) {
                         suffix.push_back(e);
                     }
-                    suffix.emplace_back(", ", i->op->position());
+                    suffix.emplace_back("." + funcname + "(", args.value().open_pos );
+                }
+                else
+                {
+                    //  If the object's type is known to have no such member,
+                    //  the non-member form is the only one that can apply
+                    if (resolution == ufcs_resolution::free_call) {
+                        prefix.emplace_back(funcname + "(", args.value().open_pos );
+                    }
+                    //  If the computed function name is an explicit member access
+                    //  we don't need to go through the UFCS macro
+                    //  Note: This also works around compiler bugs
+                    else if (funcname.starts_with("cpp2::move(*this).")) {
+                        prefix.emplace_back(funcname + "(", args.value().open_pos );
+                    }
+                    else {
+                        prefix.emplace_back(ufcs_string + "(" + funcname + ")(", args.value().open_pos );
+                    }
+                    suffix.emplace_back(")", args.value().close_pos );
+                    if (!args.value().text_chunks.empty()) {
+                        for (auto&& e: args.value().text_chunks) {
+                            suffix.push_back(e);
+                        }
+                        suffix.emplace_back(", ", i->op->position());
+                    }
                 }
                 args.reset();
             }
@@ -3457,14 +5777,14 @@ public:
 
                 //  Enable null dereference checks
                 if (
-                    flag_safe_null_pointers
+                    safe.null_pointers
                     && i->op->type() == lexeme::Multiply
                     )
                 {
                     prefix.emplace_back( "cpp2::impl::assert_not_null(", i->op->position() );
                 }
                 if (
-                    flag_safe_null_pointers
+                    safe.null_pointers
                     && i->op->type() == lexeme::Multiply
                     )
                 {
@@ -3503,7 +5823,7 @@ public:
 
                 //  Enable subscript bounds checks
                 if (
-                    flag_safe_subscripts
+                    safe.subscripts
                     && i->op->type() == lexeme::LeftBracket
                     && std::ssize(i->expr_list->expressions) == 1
                     )
@@ -3557,7 +5877,7 @@ public:
 
                 //  Enable subscript bounds checks
                 if (
-                    flag_safe_subscripts
+                    safe.subscripts
                     && i->op->type() == lexeme::LeftBracket
                     && std::ssize(i->expr_list->expressions) == 1
                     )
@@ -3652,6 +5972,15 @@ public:
     auto emit(is_as_expression_node const& n)
         -> void
     {   STACKINSTR
+        //  -hoist-loop-narrowing: a hoisted conversion's use site
+        //  prints the pre-loop local instead of re-converting
+        if (flag_hoist_loop_narrowing) {
+            if (auto h = hoisted_narrows.find(&n); h != hoisted_narrows.end()) {
+                printer.print_cpp2( h->second, n.position() );
+                return;
+            }
+        }
+
         std::string prefix = {};
         std::string suffix = {};
 
@@ -3747,7 +6076,7 @@ public:
     //-----------------------------------------------------------------------
     //
     template<
-        String   Name,
+        string_util::fixed_string Name,
         typename Term
     >
     auto emit(binary_expression_node<Name,Term> const& n)
@@ -3780,7 +6109,7 @@ public:
                 assert (std::ssize(n.terms) == 1);
 
                 //  emit < <= >= > as cmp_*(a,b) calls (if selected)
-                if (flag_safe_comparisons) {
+                if (safe.comparisons) {
                     switch (op.type()) {
                     break;case lexeme::Less:
                         printer.print_cpp2( "cpp2::impl::cmp_less(", n.position());
@@ -3799,7 +6128,7 @@ public:
 
                 //  emit == and != as infix a ? b operators (since we don't have
                 //  any checking/instrumentation we want to do for those)
-                if (flag_safe_comparisons) {
+                if (safe.comparisons) {
                     switch (op.type()) {
                     break;case lexeme::EqualComparison:
                           case lexeme::NotEqualComparison:
@@ -3816,7 +6145,7 @@ public:
 
                 emit(*n.terms.front().expr);
 
-                if (flag_safe_comparisons) {
+                if (safe.comparisons) {
                     switch (op.type()) {
                     break;case lexeme::Less:
                           case lexeme::LessEq:
@@ -3876,7 +6205,7 @@ public:
                     }
 
                     //  emit < <= >= > as cmp_*(a,b) calls (if selected)
-                    if (flag_safe_comparisons) {
+                    if (safe.comparisons) {
                         switch (term.op->type()) {
                         break;case lexeme::Less:
                             lambda_body += "cpp2::impl::cmp_less(";
@@ -3897,7 +6226,7 @@ public:
 
                     //  emit == and != as infix a ? b operators (since we don't have
                     //  any checking/instrumentation we want to do for those)
-                    if (flag_safe_comparisons) {
+                    if (safe.comparisons) {
                         switch (term.op->type()) {
                         break;case lexeme::EqualComparison:
                             lambda_body += *term.op;
@@ -3921,7 +6250,7 @@ public:
                     lhs = term.expr.get();
                     lhs_name = rhs_name;
 
-                    if (flag_safe_comparisons) {
+                    if (safe.comparisons) {
                         switch (term.op->type()) {
                         break;case lexeme::Less:
                                 case lexeme::LessEq:
@@ -4029,8 +6358,20 @@ public:
 
             //  Normally we'll just emit the operator, but if this is an
             //  assignment that's a definite initialization, change it to
-            //  a .construct() call
+            //  a .construct() call - or, for the NRVO return object
+            //  declared right here, to its initializer
             if (
+                x.op->type() == lexeme::Assignment
+                && in_definite_init
+                && in_nrvo_init
+                )
+            {
+                in_nrvo_init = false;
+                printer.print_cpp2( " {", n.position() );
+                emit(*x.expr);
+                printer.print_cpp2( "}", n.position() );
+            }
+            else if (
                 x.op->type() == lexeme::Assignment
                 && in_definite_init
                 )
@@ -4069,7 +6410,7 @@ public:
                     //  If this is a division, wrap the denominator in a not-zero check
                     auto suffix = std::string{};
                     if (
-                        flag_safe_zero_division
+                        safe.zero_division
                         && (
                             x.op->type() == lexeme::Slash
                             || x.op->type() == lexeme::SlashEq
@@ -4334,6 +6675,8 @@ public:
             return;
         }
 
+        printer.note_statement_boundary();
+
         auto emit_parameters =
             !n.emitted
             && n.parameters
@@ -4381,14 +6724,17 @@ public:
         //  aesthetic and aesthetics are important in this case -- we want to keep
         //  the original source's personal whitespace formatting style as much as we can
 
-        try_emit<statement_node::selection  >(n.statement);
-        try_emit<statement_node::declaration>(n.statement);
-        try_emit<statement_node::return_    >(n.statement);
-        try_emit<statement_node::iteration  >(n.statement);
-        try_emit<statement_node::using_     >(n.statement);
-        try_emit<statement_node::contract   >(n.statement);
-        try_emit<statement_node::inspect    >(n.statement, false);
-        try_emit<statement_node::jump       >(n.statement);
+        switch (n.statement.index()) {
+        break;case statement_node::selection  : emit_alt<statement_node::selection  >(n.statement);
+        break;case statement_node::declaration: emit_alt<statement_node::declaration>(n.statement);
+        break;case statement_node::return_    : emit_alt<statement_node::return_    >(n.statement);
+        break;case statement_node::iteration  : emit_alt<statement_node::iteration  >(n.statement);
+        break;case statement_node::using_     : emit_alt<statement_node::using_     >(n.statement);
+        break;case statement_node::contract   : emit_alt<statement_node::contract   >(n.statement);
+        break;case statement_node::inspect    : emit_alt<statement_node::inspect    >(n.statement, false);
+        break;case statement_node::jump       : emit_alt<statement_node::jump       >(n.statement);
+        break;default: ;  // expression and compound were handled above
+        }
 
         printer.preempt_position_pop();
 
@@ -5778,6 +8124,26 @@ public:
             return;
         }
 
+        //  -hot-reload-chunks: note the byte range this function's
+        //  generated declaration (phase 1) or definition (phase 2)
+        //  occupies. Only named non-local functions get a chunk -
+        //  that's the granularity a reload pipeline can patch - and
+        //  only when printing straight to the output, not while being
+        //  captured into an enclosing declaration's emitted text
+        auto chunk = chunk_recorder{};
+        if (
+            flag_hot_reload_chunks
+            && printer.is_batching()
+            && !printer.is_capturing()
+            && printer.get_phase() != printer.phase0_type_decls
+            && n.is_function()
+            && n.has_name()
+            && !n.parent_is_function()
+            )
+        {
+            chunk.open(*this, n);
+        }
+
         //  If this is a generated declaration (negative source line number),
         //  add a line break before
         if (
@@ -6172,9 +8538,10 @@ public:
             if (printer.get_phase() != printer.phase2_func_defs)
             {
                 if (n.requires_clause_expression) {
-                    printer.print_cpp2("requires( ", n.requires_pos);
+                    auto requires_pos = n.requires_pos();
+                    printer.print_cpp2("requires( ", requires_pos);
                     emit(*n.requires_clause_expression);
-                    printer.print_cpp2(" )\n", n.requires_pos);
+                    printer.print_cpp2(" )\n", requires_pos);
                 }
 
                 printer.print_cpp2("class ", n.position());
@@ -6331,7 +8698,7 @@ public:
                                 );
                 auto prefix = "\n" + std::string( indent, ' ' ) + "public: ";
 
-                if (n.member_function_generation)
+                if (n.member_function_generation())
                 {
                     //  If no constructor was defined, there should only be
                     //  a default constructor, so generate that
@@ -6473,10 +8840,43 @@ public:
                 std::string suffix1 = {};
                 std::string suffix2 = {};
 
+                //  With -function-heat, attribute this definition with
+                //  the heat recorded for its source position
+                if (
+                    !flag_function_heat.empty()
+                    && printer.get_phase() == printer.phase2_func_defs
+                    )
+                {
+                    prefix += function_heat_attribute( n.position().lineno );
+                }
+
                 if (n.is_constexpr) {
                     prefix += "constexpr ";
                 }
 
+                //  With -inline-small-functions, mark small out-of-line
+                //  definitions 'inline' so that a generated header included
+                //  from several translation units still gets them inlined
+                //  without requiring LTO
+                if (
+                    flag_inline_small_functions
+                    && printer.get_phase() == printer.phase2_func_defs
+                    && !is_main
+                    && !n.is_constexpr
+                    && !n.is_constructor()
+                    && !n.is_assignment()
+                    && n.initializer
+                    )
+                {
+                    auto body_is_small = true;
+                    if (auto body = std::get_if<statement_node::compound>(&n.initializer->statement)) {
+                        body_is_small = std::ssize((*body)->statements) <= 1;
+                    }
+                    if (body_is_small) {
+                        prefix += "inline ";
+                    }
+                }
+
                 if (
                     !n.has_initializer()
                     && n.is_defaultable_function()
@@ -6797,11 +9197,99 @@ public:
                 {
                     auto& r = std::get<function_type_node::list>(func->returns);
                     assert(r);
+
+                    //  See whether a single uninitialized named return can
+                    //  use the NRVO lowering (see function_info): it must
+                    //  have exactly one definite initialization, and that
+                    //  must be a simple top-level 'name = expr' statement
+                    //  of this function's body, so declaring the object
+                    //  there is visible to every later use
+                    //
+                    //  (not with contracts, whose prolog-emitted checks
+                    //  would run before the object's mid-body declaration)
+                    //
+                    if (
+                        std::ssize(r->parameters) == 1
+                        && r->parameters[0]->declaration
+                        && !r->parameters[0]->declaration->initializer
+                        && n.initializer
+                        && func->contracts.empty()
+                        )
+                    {
+                        auto  ret_decl = r->parameters[0]->declaration.get();
+                        auto  ret_name = ret_decl->name();
+                        auto* body     = std::get_if<statement_node::compound>(&n.initializer->statement);
+
+                        auto top_level_init = (token const*)nullptr;
+                        if (
+                            body
+                            && ret_name
+                            )
+                        {
+                            for (auto& stmt : (*body)->statements) {
+                                auto assignment = stmt->get_lhs_rhs_if_simple_assignment();
+                                if (
+                                    assignment.lhs
+                                    && assignment.lhs->ops.empty()
+                                    )
+                                {
+                                    if (auto tok = assignment.lhs->expr->get_token();
+                                        tok
+                                        && *tok == ret_name->as_string_view()
+                                        && sema.is_definite_initialization(tok)
+                                        )
+                                    {
+                                        top_level_init = tok;
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+
+                        //  The top-level one must also be the only one -
+                        //  an if/else that initializes on both paths has
+                        //  two construction points and keeps deferred_init
+                        //
+                        if (top_level_init) {
+                            auto inits = 0;
+                            for (auto t : sema.definite_initializations) {
+                                if (
+                                    t
+                                    && *t == ret_name->as_string_view()
+                                    )
+                                {
+                                    if (auto d = sema.get_declaration_of(*t, false, true);
+                                        d
+                                        && d->declaration == ret_decl
+                                        )
+                                    {
+                                        ++inits;
+                                    }
+                                }
+                            }
+                            if (inits == 1) {
+                                auto type_text = std::string{};
+                                printer.emit_to_string(&type_text);
+                                emit(*std::get<declaration_node::an_object>(ret_decl->type));
+                                printer.emit_to_string();
+                                current_functions.back().nrvo_decl = ret_decl;
+                                current_functions.back().nrvo_init = top_level_init;
+                                current_functions.back().nrvo_type = std::move(type_text);
+                            }
+                        }
+                    }
+
                     for (auto& param : r->parameters)
                     {
                         assert(param && param->declaration);
                         auto& decl    = *param->declaration;
 
+                        //  The NRVO return object is declared at its
+                        //  construction statement instead of here
+                        if (param->declaration.get() == current_functions.back().nrvo_decl) {
+                            continue;
+                        }
+
                         assert(decl.is_object());
                         auto& id_expr = std::get<declaration_node::an_object>(decl.type);
                         assert(id_expr);
@@ -7120,7 +9608,48 @@ public:
     //-----------------------------------------------------------------------
     //  print_errors
     //
-    auto print_errors()
+    //-----------------------------------------------------------------------
+    //  In -stream-errors mode, print any errors the just-finished phase
+    //  produced, so feedback on a broken file doesn't wait for the rest
+    //  of the compile
+    //
+    auto stream_new_errors()
+        -> void
+    {
+        if (
+            !flag_stream_errors
+            || std::ssize(errors) <= streamed_errors
+            )
+        {
+            return;
+        }
+
+        //  The output is not going to be valid
+        printer.abandon();
+
+        for ( ; streamed_errors < std::ssize(errors); ++streamed_errors) {
+            if (!errors[streamed_errors].suppressed) {
+                errors[streamed_errors].print(std::cerr, strip_path(sourcefile));
+            }
+        }
+        std::cerr.flush();
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  Whether we've hit the -max-errors cap and should stop compiling
+    //
+    auto reached_max_errors() const
+        -> bool
+    {
+        return
+            flag_max_errors > 0
+            && std::ssize(errors) >= flag_max_errors
+            ;
+    }
+
+
+    auto print_errors(std::ostream& o = std::cerr)
         -> void
     {
         if (!errors.empty()) {
@@ -7130,9 +9659,19 @@ public:
 
         error_entry const* prev                  = {};
         bool               print_fallback_errors = true; // true until we find a non-fallback message
+        auto               suppressed_count      = 0;
 
-        for (auto&& error : errors)
+        //  In -stream-errors mode the first streamed_errors entries were
+        //  already printed as they appeared
+        for (auto i = streamed_errors; i < std::ssize(errors); ++i)
         {
+            auto&& error = errors[i];
+            //  Position-only notes past the -diagnostic-budget are
+            //  reported as a count in the trailer, not one by one
+            if (error.suppressed) {
+                ++suppressed_count;
+                continue;
+            }
             //  Only print fallback error messages if we
             //  haven't found a better (non-fallback) one yet
             if (!error.fallback) {
@@ -7149,19 +9688,31 @@ public:
                 || error != *prev
                 )
             {
-                error.print(std::cerr, strip_path(sourcefile));
+                error.print(o, strip_path(sourcefile));
             }
             prev = &error;
         }
 
+        //  The free-form trailers would corrupt a JSON-lines stream, and
+        //  their information is recoverable from the diagnostics themselves
+        if (flag_json_errors) {
+            return;
+        }
+
+        if (reached_max_errors()) {
+            o << "  ==> stopped compiling after " << flag_max_errors << " errors (-max-errors)\n";
+        }
+        if (suppressed_count > 0) {
+            o << "  ==> " << suppressed_count << " more errors noted but not detailed after the first " << flag_diagnostic_budget << " (-diagnostic-budget)\n";
+        }
         if (violates_lifetime_safety) {
-            std::cerr << "  ==> program violates lifetime safety guarantee - see previous errors\n";
+            o << "  ==> program violates lifetime safety guarantee - see previous errors\n";
         }
         if (violates_bounds_safety) {
-            std::cerr << "  ==> program violates bounds safety guarantee - see previous errors\n";
+            o << "  ==> program violates bounds safety guarantee - see previous errors\n";
         }
         if (violates_initialization_safety) {
-            std::cerr << "  ==> program violates initialization safety guarantee - see previous errors\n";
+            o << "  ==> program violates initialization safety guarantee - see previous errors\n";
         }
     }
 
@@ -7171,6 +9722,174 @@ public:
         return errors.empty();
     }
 
+    //  Publish this compile's namespace-scope declarations as the shared
+    //  prelude index that later compiles fall back to in name lookup -
+    //  see -include-prelude in main()
+    //
+    auto share_globals_as_prelude() const
+        -> void
+    {
+        sema.share_globals_as_prelude();
+    }
+
+    //  function_heat_attribute: look up the heat recorded for a function
+    //  declared at this source line - see -function-heat in main(). The
+    //  file has one entry per line, '[source-file] line hot|cold'; the
+    //  optional first field restricts an entry to files whose name ends
+    //  with it, so one heat file can cover a whole build
+    //
+    auto function_heat_attribute(lineno_t lineno)
+        -> std::string_view
+    {
+        if (!function_heat_loaded) {
+            function_heat_loaded = true;
+            auto in = std::ifstream{ flag_function_heat };
+            if (!in.is_open()) {
+                errors.emplace_back(
+                    source_position{},
+                    "could not open -function-heat file '" + flag_function_heat + "'"
+                );
+                return {};
+            }
+            for (auto line = std::string{}; std::getline(in, line); ) {
+                auto fields = std::istringstream{ line };
+                auto a = std::string{};
+                auto b = std::string{};
+                auto c = std::string{};
+                fields >> a >> b >> c;
+                if (c.empty()) {    // two-field form, no source-file restriction
+                    c = b;
+                    b = a;
+                    a = {};
+                }
+                if (
+                    b.empty()
+                    || (c != "hot" && c != "cold")
+                    || (!a.empty() && !sourcefile.ends_with(a))
+                    )
+                {
+                    continue;
+                }
+                function_heat[ atoi(b.c_str()) ] = c == "hot";
+            }
+        }
+
+        if (auto i = function_heat.find(lineno); i != function_heat.end()) {
+            return i->second ? "CPP2_FUNC_HOT " : "CPP2_FUNC_COLD ";
+        }
+        return {};
+    }
+
+    //  run_micro_passes: one fused walk filling every node-local
+    //  analysis, run on first demand and then shared - so asking for
+    //  both -stats and -budget still traverses the tree once
+    //
+    auto run_micro_passes()
+        -> fused_passes<stats_visitor, budget_visitor>&
+    {
+        if (!micro_passes) {
+            micro_passes.emplace();
+            auto prof = profiler.scope("micro-passes");
+            parser.visit( *micro_passes );
+            micro_passes->report_timings();
+        }
+        return *micro_passes;
+    }
+
+
+    //  emit_stats: write this compile's counts and phase timings as one
+    //  JSON object - see -stats in main()
+    //
+    auto emit_stats(std::ostream& o)
+        -> void
+    {
+        auto& v = run_micro_passes().get<stats_visitor>();
+
+        auto token_counts = std::map<std::string, long long>{};
+        auto total_tokens = 0LL;
+        for (auto const& [line, entry] : tokens.get_map()) {
+            for (auto const& t : entry) {
+                ++token_counts[ _as<std::string>(t.type()) ];
+                ++total_tokens;
+            }
+        }
+
+        auto escaped = std::string{};
+        for (auto c : sourcefile) {
+            if (c == '"' || c == '\\') { escaped += '\\'; }
+            escaped += c;
+        }
+
+        o   << "{\"file\":\"" << escaped << "\""
+            << ",\"lines\":"  << std::max(std::ssize(source.get_lines())-1, ptrdiff_t{0})
+            << ",\"tokens\":{";
+        for (auto first = true; auto const& [name, count] : token_counts) {
+            if (!first) { o << ","; }
+            first = false;
+            o << "\"" << name << "\":" << count;
+        }
+        o   << "}"
+            << ",\"nodes\":"          << v.nodes
+            << ",\"declarations\":"   << v.declarations
+            << ",\"functions\":"      << v.functions
+            << ",\"types\":"          << v.types
+            << ",\"namespaces\":"     << v.namespaces
+            << ",\"ufcs_call_sites\":"<< v.ufcs_calls
+            << ",\"inspects\":"       << v.inspects
+            << ",\"metafunctions\":"  << v.metafunctions
+            << ",\"symbols\":"        << std::ssize(sema.symbols)
+            << ",\"errors\":"         << std::ssize(errors)
+            << ",\"reserve\":{"
+            <<      "\"tokens_predicted\":"   << tokens.get_predicted_tokens()
+            <<      ",\"tokens_actual\":"     << total_tokens
+            <<      ",\"symbols_predicted\":" << sema.predicted_symbols
+            <<      ",\"symbols_actual\":"    << std::ssize(sema.symbols)
+            << "}"
+            << ",\"diagnostics_pool\":{"
+            <<      "\"high_water_count\":"    << the_diagnostics_pool.get_high_water_count()
+            <<      ",\"high_water_capacity\":" << the_diagnostics_pool.get_high_water_capacity()
+            << "}"
+            << ",\"arenas\":";
+        arena_registry::print_json( o );
+        o   << ",\"phase_us\":{"
+            <<      "\"lex\":"     << phase_us.lex
+            <<      ",\"parse\":"  << phase_us.parse
+            <<      ",\"sema\":"   << phase_us.sema
+            <<      ",\"emit\":"   << phase_us.emit
+            << "}}";
+    }
+
+
+    //  get_instantiation_budget: count this file's instantiation-heavy
+    //  constructs - see -budget in main()
+    //
+    auto get_instantiation_budget()
+        -> instantiation_budget
+    {
+        auto& v = run_micro_passes().get<budget_visitor>();
+
+        auto ret = instantiation_budget{ sourcefile };
+        ret.ufcs_calls   = v.ufcs_calls;
+        ret.is_as_tests  = v.is_as_tests;
+        ret.inspect_arms = v.inspect_arms;
+
+        //  String interpolation is expanded during lexing, each segment
+        //  becoming a cpp2::to_string(...) call in the token stream, so
+        //  count the cpp2 :: to_string token runs rather than walking
+        //  the parse tree (an explicit call the user wrote costs the
+        //  same instantiation, so counting it too is fine)
+        for (auto const& [line, entry] : tokens.get_map()) {
+            for (auto i = 2; i < std::ssize(entry); ++i) {
+                ret.interpolations +=
+                    entry[i] == "to_string"
+                    && entry[i-1].type() == lexeme::Scope
+                    && entry[i-2] == "cpp2"
+                    ;
+            }
+        }
+        return ret;
+    }
+
 
     //-----------------------------------------------------------------------
     //  debug_print
@@ -7197,6 +9916,30 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  emit_symbols: write the .cpsym symbol-table export for tooling
+    //  (see sema::emit_symbols for the format), returning false if the
+    //  file could not be written
+    //
+    auto emit_symbols(std::string const& filename) const
+        -> bool
+    {
+        auto contents = std::ostringstream{};
+        sema.emit_symbols( contents );
+        return output_batcher::write_file( filename, contents.str() );
+    }
+
+
+    //-----------------------------------------------------------------------
+    //  get_phase_us: this compile's per-phase wall times in microseconds
+    //
+    auto get_phase_us() const
+        -> auto
+    {
+        return phase_us;
+    }
+
+
     //-----------------------------------------------------------------------
     //  has_cpp1: pass through
     //
@@ -7207,6 +9950,16 @@ public:
     }
 
 
+    //-----------------------------------------------------------------------
+    //  close_output: pass through
+    //
+    auto close_output()
+        -> void
+    {
+        printer.finalize();
+    }
+
+
     //-----------------------------------------------------------------------
     //  has_cpp2: pass through
     //
@@ -7217,6 +9970,120 @@ public:
     }
 };
 
+
+//-----------------------------------------------------------------------
+//
+//  compile: in-process compilation of an in-memory Cpp2 source text,
+//           for embedding cppfront in build daemons and tools
+//
+//  Runs the same load/lex/parse/sema/lower pipeline as the command line
+//  driver, but takes the source as a string and returns the generated
+//  Cpp1 and formatted diagnostics as strings - no filesystem access.
+//
+//  Note: the compilation flags are process-wide state, shared with the
+//  command line and any concurrent compiles (just as -jobs shares them
+//  across worker threads), so concurrent callers must use identical
+//  options. The options given here are restored on return.
+//
+struct compile_options
+{
+    std::string filename      = "main.cpp2";    // pseudo-name used in diagnostics and #line directives
+    bool        import_std    = false;
+    bool        include_std   = false;
+    bool        no_exceptions = false;
+    bool        no_rtti       = false;
+    bool        clean_cpp1    = false;
+    bool        cpp2_only     = false;          // like -pure-cpp2, except that the command line
+                                                //  flag also implies import_std - callers wanting
+                                                //  the exact -p behavior should set both
+};
+
+struct compile_result
+{
+    std::string cpp1_text;          // the generated Cpp1 - empty if !ok
+    std::string diagnostics;        // formatted error messages - empty if ok
+    lineno_t    cpp1_lines = 0;
+    lineno_t    cpp2_lines = 0;
+    long long   elapsed_ms = 0;
+    long long   lex_us     = 0;     // per-phase wall times, for callers
+    long long   parse_us   = 0;     //  that profile many small compiles
+    long long   sema_us    = 0;     //  (see run-tests-native -ledger)
+    long long   emit_us    = 0;
+    bool        ok         = false;
+    bool        has_cpp1   = false; // whether the source contained any Cpp1 code
+    bool        has_cpp2   = false; // whether the source contained any Cpp2 code
+};
+
+inline auto compile(
+    std::string_view       source_text,
+    compile_options const& options = {}
+)
+    -> compile_result
+{
+    auto ret = compile_result{};
+
+    cpp2::timer t;
+    t.start();
+
+    //  Apply the options to the process-wide flags, restoring on return
+    auto saved = std::tuple{
+        flag_import_std, flag_include_std,
+        flag_no_exceptions, flag_no_rtti, flag_clean_cpp1,
+        flag_cpp2_only
+    };
+    auto restore = finally([&]{
+        std::tie(
+            flag_import_std, flag_include_std,
+            flag_no_exceptions, flag_no_rtti, flag_clean_cpp1,
+            flag_cpp2_only
+        ) = saved;
+    });
+    flag_import_std    = options.import_std;
+    flag_include_std   = options.include_std;
+    flag_no_exceptions = options.no_exceptions;
+    flag_no_rtti       = options.no_rtti;
+    flag_clean_cpp1    = options.clean_cpp1;
+    flag_cpp2_only     = options.cpp2_only;
+
+    //  Restart this thread's generated-name labels, so the text depends
+    //  only on this source - never on earlier compiles in this process
+    reset_labelized_positions(options.filename);
+
+    //  Scoped, so that the printer has flushed any buffered output into
+    //  ret.cpp1_text before we inspect the results below
+    {
+        cppfront c( options.filename, std::string{source_text} );
+
+        auto count = c.lower_to_cpp1( &ret.cpp1_text );
+        ret.cpp1_lines = count.cpp1_lines;
+        ret.cpp2_lines = count.cpp2_lines;
+        ret.ok         = c.had_no_errors();
+        ret.has_cpp1   = c.has_cpp1();
+        ret.has_cpp2   = c.has_cpp2();
+
+        auto phases    = c.get_phase_us();
+        ret.lex_us     = phases.lex;
+        ret.parse_us   = phases.parse;
+        ret.sema_us    = phases.sema;
+        ret.emit_us    = phases.emit;
+
+        if (!ret.ok) {
+            auto diag = std::ostringstream{};
+            c.print_errors( diag );
+            ret.diagnostics = diag.str();
+        }
+    }
+
+    if (!ret.ok) {
+        ret.cpp1_text = {};
+    }
+
+    t.stop();
+    ret.elapsed_ms = t.elapsed().count();
+
+    return ret;
+}
+
 }
 
 